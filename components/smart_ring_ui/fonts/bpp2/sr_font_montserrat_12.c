@@ -1,1183 +0,0 @@
-#include "lvgl/lvgl.h"
-
-/*******************************************************************************
- * Size: 12 px
- * Bpp: 2
- * Opts: 
- ******************************************************************************/
-
-#ifndef SR_FONT_MONTSERRAT_12
-#define SR_FONT_MONTSERRAT_12 1
-#endif
-
-#if SR_FONT_MONTSERRAT_12
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+20 " " */
-
-    /* U+21 "!" */
-    0x30, 0xc3, 0xc, 0x20, 0x40, 0xc,
-
-    /* U+22 "\"" */
-    0x22, 0x22, 0x22,
-
-    /* U+23 "#" */
-    0x5, 0x8, 0x5, 0x14, 0x2e, 0xba, 0x8, 0x20,
-    0x8, 0x20, 0x6e, 0xb9, 0x8, 0x20, 0x4, 0x20,
-
-    /* U+24 "$" */
-    0x1, 0x0, 0x8, 0x1, 0xba, 0xc, 0x80, 0x32,
-    0x0, 0xbc, 0x0, 0x2b, 0x0, 0x82, 0x12, 0x18,
-    0xae, 0x80, 0x20, 0x0, 0x40,
-
-    /* U+25 "%" */
-    0x29, 0x2, 0x5, 0x10, 0x80, 0x41, 0x54, 0x5,
-    0x22, 0x0, 0x19, 0x86, 0x40, 0x14, 0x45, 0x2,
-    0x14, 0x10, 0x80, 0x98,
-
-    /* U+26 "&" */
-    0xa, 0x80, 0x18, 0x20, 0xc, 0x90, 0xb, 0x40,
-    0x25, 0x80, 0x60, 0x68, 0x60, 0x2c, 0x1a, 0x96,
-    0x0, 0x0,
-
-    /* U+27 "'" */
-    0x22, 0x20,
-
-    /* U+28 "(" */
-    0x20, 0x85, 0x20, 0x82, 0x8, 0x14, 0x20, 0x80,
-
-    /* U+29 ")" */
-    0x20, 0xc1, 0x46, 0x8, 0x21, 0x85, 0x30, 0x80,
-
-    /* U+2A "*" */
-    0x8, 0x1b, 0x82, 0xe0, 0x20, 0x0, 0x0,
-
-    /* U+2B "+" */
-    0x2, 0x0, 0xc, 0x2, 0xba, 0x0, 0xc0, 0x3,
-    0x0,
-
-    /* U+2C "," */
-    0x22, 0x10,
-
-    /* U+2D "-" */
-    0x2a,
-
-    /* U+2E "." */
-    0x2,
-
-    /* U+2F "/" */
-    0x0, 0x0, 0x8, 0x0, 0x80, 0x14, 0x3, 0x0,
-    0x20, 0x8, 0x0, 0x80, 0x14, 0x2, 0x0, 0x20,
-    0x0,
-
-    /* U+30 "0" */
-    0xb, 0xe0, 0x24, 0x18, 0x30, 0xc, 0x60, 0x9,
-    0x60, 0x9, 0x20, 0xc, 0x24, 0x18, 0xb, 0xe0,
-
-    /* U+31 "1" */
-    0xac, 0x30, 0xc3, 0xc, 0x30, 0xc3,
-
-    /* U+32 "2" */
-    0x2f, 0x81, 0x0, 0xc0, 0x3, 0x0, 0x18, 0x1,
-    0x80, 0x18, 0x2, 0x80, 0x1e, 0xa9,
-
-    /* U+33 "3" */
-    0x6a, 0xf0, 0x3, 0x0, 0x30, 0x1, 0xe0, 0x0,
-    0x30, 0x0, 0xc4, 0x3, 0x1b, 0xa0,
-
-    /* U+34 "4" */
-    0x0, 0x50, 0x1, 0x80, 0x2, 0x0, 0xc, 0x10,
-    0x30, 0x30, 0x7a, 0xba, 0x0, 0x30, 0x0, 0x30,
-
-    /* U+35 "5" */
-    0x3a, 0xa0, 0xc0, 0x3, 0x0, 0xe, 0xa0, 0x0,
-    0x30, 0x0, 0x94, 0x3, 0xb, 0xb4,
-
-    /* U+36 "6" */
-    0xb, 0xa0, 0x90, 0x3, 0x0, 0x19, 0xa8, 0x74,
-    0x18, 0xc0, 0x32, 0x1, 0x82, 0xa8,
-
-    /* U+37 "7" */
-    0xba, 0xba, 0x0, 0xc0, 0x6, 0x0, 0x30, 0x0,
-    0x80, 0x8, 0x0, 0x20, 0x2, 0x40,
-
-    /* U+38 "8" */
-    0x1a, 0xa0, 0x30, 0x18, 0x30, 0x18, 0x1e, 0xf0,
-    0x30, 0x18, 0x60, 0xc, 0x30, 0xc, 0x1a, 0xa0,
-
-    /* U+39 "9" */
-    0x2e, 0x81, 0x80, 0xc9, 0x2, 0x58, 0xe, 0x1a,
-    0x98, 0x0, 0x50, 0x3, 0xa, 0xa0,
-
-    /* U+3A ":" */
-    0x30, 0x0, 0x2,
-
-    /* U+3B ";" */
-    0x30, 0x0, 0x3, 0x21,
-
-    /* U+3C "<" */
-    0x0, 0x0, 0x6, 0x82, 0x90, 0xa, 0x40, 0x1,
-    0xa0, 0x0, 0x0,
-
-    /* U+3D "=" */
-    0x2a, 0xa0, 0x0, 0x0, 0x0, 0xa, 0xa8,
-
-    /* U+3E ">" */
-    0x0, 0x0, 0xa4, 0x0, 0x1a, 0x0, 0x68, 0x29,
-    0x0, 0x0, 0x0,
-
-    /* U+3F "?" */
-    0x2e, 0x84, 0x3, 0x0, 0x30, 0x8, 0x3, 0x0,
-    0x10, 0x0, 0x0, 0x20,
-
-    /* U+40 "@" */
-    0x1, 0xaa, 0x80, 0x9, 0x0, 0x24, 0x20, 0xaa,
-    0x88, 0x22, 0x40, 0xc2, 0x53, 0x0, 0x82, 0x53,
-    0x0, 0x82, 0x22, 0x40, 0xc2, 0x20, 0xaa, 0x78,
-    0x8, 0x0, 0x0, 0x1, 0xaa, 0x40,
-
-    /* U+41 "A" */
-    0x1, 0xc0, 0x0, 0xd4, 0x0, 0x63, 0x0, 0x30,
-    0x50, 0x18, 0xc, 0xe, 0xab, 0x46, 0x0, 0x32,
-    0x0, 0x9,
-
-    /* U+42 "B" */
-    0xba, 0xa0, 0x90, 0xc, 0x90, 0x8, 0xba, 0xf0,
-    0x90, 0xc, 0x90, 0x9, 0x90, 0xc, 0xba, 0xa4,
-
-    /* U+43 "C" */
-    0x6, 0xf9, 0x6, 0x0, 0x43, 0x0, 0x1, 0x80,
-    0x0, 0x60, 0x0, 0xc, 0x0, 0x1, 0x80, 0x10,
-    0x1a, 0xe4,
-
-    /* U+44 "D" */
-    0xba, 0xa0, 0x24, 0x2, 0x49, 0x0, 0x32, 0x40,
-    0x8, 0x90, 0x2, 0x24, 0x0, 0xc9, 0x0, 0x92,
-    0xea, 0x90,
-
-    /* U+45 "E" */
-    0xba, 0xa2, 0x40, 0x9, 0x0, 0x2e, 0xa4, 0x90,
-    0x2, 0x40, 0x9, 0x0, 0x2e, 0xa8,
-
-    /* U+46 "F" */
-    0xba, 0xa2, 0x40, 0x9, 0x0, 0x24, 0x0, 0xba,
-    0x92, 0x40, 0x9, 0x0, 0x24, 0x0,
-
-    /* U+47 "G" */
-    0x6, 0xfd, 0x6, 0x0, 0x43, 0x0, 0x1, 0x80,
-    0x0, 0x60, 0x2, 0xc, 0x0, 0x81, 0x80, 0x30,
-    0x1a, 0xa4,
-
-    /* U+48 "H" */
-    0x90, 0x5, 0x90, 0x5, 0x90, 0x5, 0xba, 0xad,
-    0x90, 0x5, 0x90, 0x5, 0x90, 0x5, 0x90, 0x5,
-
-    /* U+49 "I" */
-    0x99, 0x99, 0x99, 0x99,
-
-    /* U+4A "J" */
-    0xa, 0xe0, 0x2, 0x0, 0x20, 0x2, 0x0, 0x20,
-    0x2, 0x10, 0x61, 0xe8,
-
-    /* U+4B "K" */
-    0x90, 0x18, 0x90, 0x60, 0x91, 0x80, 0x97, 0x0,
-    0xab, 0x40, 0xa0, 0xd0, 0x90, 0x30, 0x90, 0xc,
-
-    /* U+4C "L" */
-    0x90, 0x9, 0x0, 0x90, 0x9, 0x0, 0x90, 0x9,
-    0x0, 0x90, 0xb, 0xaa,
-
-    /* U+4D "M" */
-    0x90, 0x0, 0xcb, 0x0, 0x2c, 0x98, 0x2, 0xc8,
-    0x80, 0x8c, 0x83, 0x14, 0xc8, 0x1a, 0xc, 0x80,
-    0xc0, 0xc8, 0x0, 0xc,
-
-    /* U+4E "N" */
-    0xa0, 0x5, 0xb4, 0x5, 0x9c, 0x5, 0x93, 0x5,
-    0x91, 0xc5, 0x90, 0x65, 0x90, 0x2d, 0x90, 0x9,
-
-    /* U+4F "O" */
-    0x6, 0xf9, 0x1, 0x80, 0x24, 0x30, 0x0, 0xc6,
-    0x0, 0x9, 0x60, 0x0, 0x93, 0x0, 0xc, 0x18,
-    0x2, 0x40, 0x6a, 0x90,
-
-    /* U+50 "P" */
-    0xba, 0x92, 0x40, 0xa9, 0x0, 0xe4, 0x3, 0x90,
-    0x26, 0xea, 0x49, 0x0, 0x24, 0x0,
-
-    /* U+51 "Q" */
-    0x6, 0xe9, 0x1, 0x80, 0x24, 0x30, 0x0, 0xc6,
-    0x0, 0x9, 0x60, 0x0, 0x93, 0x0, 0xc, 0x18,
-    0x2, 0x80, 0x6f, 0xd0, 0x0, 0x24, 0x10, 0x0,
-    0x68,
-
-    /* U+52 "R" */
-    0xba, 0x90, 0x90, 0x28, 0x90, 0xc, 0x90, 0xc,
-    0x90, 0x24, 0xba, 0xd0, 0x90, 0x20, 0x90, 0x18,
-
-    /* U+53 "S" */
-    0x1e, 0xa0, 0xc0, 0x3, 0x0, 0xb, 0x40, 0x1,
-    0xb0, 0x0, 0x21, 0x1, 0x8b, 0xa8,
-
-    /* U+54 "T" */
-    0xab, 0xa8, 0xc, 0x0, 0x30, 0x0, 0xc0, 0x3,
-    0x0, 0xc, 0x0, 0x30, 0x0, 0xc0,
-
-    /* U+55 "U" */
-    0x80, 0x8, 0x80, 0x8, 0x80, 0x8, 0x80, 0x8,
-    0x80, 0x8, 0x90, 0xc, 0x30, 0x18, 0x1a, 0xa0,
-
-    /* U+56 "V" */
-    0x80, 0x3, 0x18, 0x0, 0x83, 0x0, 0x80, 0x60,
-    0x20, 0xc, 0x24, 0x1, 0x8c, 0x0, 0x39, 0x0,
-    0x7, 0x0,
-
-    /* U+57 "W" */
-    0x60, 0xd, 0x0, 0x8c, 0x7, 0x80, 0x52, 0x2,
-    0x30, 0x30, 0x60, 0xc5, 0x8, 0xc, 0x50, 0x89,
-    0x2, 0x60, 0x33, 0x0, 0x68, 0x6, 0x80, 0xd,
-    0x0, 0xc0,
-
-    /* U+58 "X" */
-    0x30, 0xc, 0x18, 0x24, 0x9, 0x60, 0x3, 0x80,
-    0x3, 0xc0, 0xc, 0x60, 0x24, 0x28, 0x60, 0x9,
-
-    /* U+59 "Y" */
-    0x90, 0x9, 0x30, 0x18, 0x18, 0x30, 0x8, 0x90,
-    0x3, 0x80, 0x2, 0x40, 0x2, 0x40, 0x2, 0x40,
-
-    /* U+5A "Z" */
-    0x6a, 0xac, 0x0, 0x28, 0x0, 0x60, 0x0, 0xc0,
-    0x3, 0x0, 0xc, 0x0, 0x24, 0x0, 0x7a, 0xa9,
-
-    /* U+5B "[" */
-    0xa6, 0x8, 0x20, 0x82, 0x8, 0x20, 0x82, 0x90,
-
-    /* U+5C "\\" */
-    0x0, 0x2, 0x0, 0x20, 0x1, 0x40, 0xc, 0x0,
-    0x80, 0x2, 0x0, 0x20, 0x1, 0x40, 0x8, 0x0,
-    0x80,
-
-    /* U+5D "]" */
-    0xb4, 0x51, 0x45, 0x14, 0x51, 0x45, 0x16, 0xd0,
-
-    /* U+5E "^" */
-    0x4, 0x6, 0x42, 0x21, 0x44, 0x80, 0x80,
-
-    /* U+5F "_" */
-    0xaa, 0xa0,
-
-    /* U+60 "`" */
-    0x10, 0x8,
-
-    /* U+61 "a" */
-    0x2a, 0x80, 0x3, 0x1a, 0xb2, 0x3, 0x60, 0x32,
-    0xab,
-
-    /* U+62 "b" */
-    0xc0, 0x3, 0x0, 0xd, 0xad, 0x38, 0xc, 0xc0,
-    0x1b, 0x0, 0x6e, 0x3, 0x36, 0xb4,
-
-    /* U+63 "c" */
-    0xa, 0xe0, 0xc0, 0x45, 0x0, 0x14, 0x0, 0x30,
-    0x10, 0x2b, 0x80,
-
-    /* U+64 "d" */
-    0x0, 0xc, 0x0, 0x30, 0xa9, 0xcc, 0xb, 0x60,
-    0xd, 0x40, 0x33, 0x1, 0xc2, 0xa7,
-
-    /* U+65 "e" */
-    0xa, 0x90, 0x80, 0x57, 0xaa, 0x98, 0x0, 0x30,
-    0x10, 0x2f, 0x80,
-
-    /* U+66 "f" */
-    0x1a, 0x8, 0xb, 0xa0, 0x80, 0x20, 0x8, 0x2,
-    0x0, 0x80,
-
-    /* U+67 "g" */
-    0xa, 0x9c, 0x30, 0x1c, 0x50, 0xc, 0x60, 0xc,
-    0x30, 0x1c, 0xa, 0x9c, 0x0, 0x8, 0x1a, 0xa0,
-
-    /* U+68 "h" */
-    0xc0, 0xc, 0x0, 0xda, 0x8e, 0x3, 0xc0, 0x3c,
-    0x3, 0xc0, 0x3c, 0x3,
-
-    /* U+69 "i" */
-    0xc0, 0xcc, 0xcc, 0xcc,
-
-    /* U+6A "j" */
-    0x3, 0x0, 0x0, 0x30, 0xc, 0x3, 0x0, 0xc0,
-    0x30, 0xc, 0x3, 0xa, 0x80,
-
-    /* U+6B "k" */
-    0xc0, 0x3, 0x0, 0xc, 0x9, 0x30, 0xd0, 0xcd,
-    0x3, 0xdc, 0xc, 0xc, 0x30, 0x18,
-
-    /* U+6C "l" */
-    0xcc, 0xcc, 0xcc, 0xcc,
-
-    /* U+6D "m" */
-    0xda, 0x8a, 0xa3, 0x41, 0xd0, 0x9c, 0x3, 0x1,
-    0xb0, 0xc, 0x6, 0xc0, 0x30, 0x1b, 0x0, 0xc0,
-    0x60,
-
-    /* U+6E "n" */
-    0xda, 0x8e, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-    0x3,
-
-    /* U+6F "o" */
-    0xa, 0xa0, 0xc0, 0xa5, 0x0, 0xd8, 0x3, 0x30,
-    0x28, 0x2b, 0x80,
-
-    /* U+70 "p" */
-    0xda, 0x93, 0x80, 0xcc, 0x1, 0xb0, 0x6, 0xe0,
-    0x33, 0x6b, 0x4c, 0x0, 0x30, 0x0,
-
-    /* U+71 "q" */
-    0xa, 0x9c, 0xc0, 0xb5, 0x0, 0xd8, 0x3, 0x30,
-    0x2c, 0x2a, 0x70, 0x0, 0xc0, 0x3,
-
-    /* U+72 "r" */
-    0xdd, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0,
-
-    /* U+73 "s" */
-    0x2a, 0x86, 0x0, 0x34, 0x0, 0x5c, 0x0, 0x56,
-    0xa8,
-
-    /* U+74 "t" */
-    0x10, 0x8, 0xb, 0xa0, 0x80, 0x20, 0x8, 0x2,
-    0x40, 0x39,
-
-    /* U+75 "u" */
-    0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0x90, 0x72,
-    0xa7,
-
-    /* U+76 "v" */
-    0x80, 0x25, 0x80, 0x83, 0x9, 0x6, 0x30, 0xe,
-    0x40, 0x1c, 0x0,
-
-    /* U+77 "w" */
-    0x80, 0x70, 0x25, 0x42, 0x80, 0xc3, 0x8, 0x85,
-    0x9, 0x52, 0x20, 0xa, 0x6, 0x80, 0x24, 0xd,
-    0x0,
-
-    /* U+78 "x" */
-    0x60, 0x60, 0x62, 0x0, 0xb0, 0x2, 0xc0, 0x24,
-    0xc1, 0x80, 0x80,
-
-    /* U+79 "y" */
-    0x20, 0x8, 0x18, 0x8, 0xc, 0x24, 0x6, 0x20,
-    0x3, 0x90, 0x1, 0xc0, 0x2, 0x40, 0x2a, 0x0,
-
-    /* U+7A "z" */
-    0x6a, 0xd0, 0x8, 0x3, 0x0, 0xc0, 0x24, 0x7,
-    0xa9,
-
-    /* U+7B "{" */
-    0xe, 0x18, 0x18, 0x18, 0x34, 0x14, 0x18, 0x18,
-    0x18, 0xe,
-
-    /* U+7C "|" */
-    0x88, 0x88, 0x88, 0x88, 0x88,
-
-    /* U+7D "}" */
-    0xb0, 0x24, 0x24, 0x24, 0x1c, 0x14, 0x24, 0x24,
-    0x24, 0xb0,
-
-    /* U+7E "~" */
-    0x29, 0x10, 0x46, 0x40,
-
-    /* U+A9 "©" */
-    0x1, 0x54, 0x0, 0x40, 0x20, 0x11, 0xa0, 0x40,
-    0x60, 0x4, 0x48, 0x0, 0x40, 0x60, 0x4, 0x21,
-    0xa0, 0x40, 0x40, 0x20, 0x1, 0x54, 0x0,
-
-    /* U+AA "ª" */
-    0x19, 0x16, 0x42, 0x26,
-
-    /* U+AE "®" */
-    0x1, 0x54, 0x0, 0x40, 0x20, 0x12, 0xa0, 0x40,
-    0x20, 0x84, 0x42, 0x8, 0x40, 0x2a, 0x4, 0x22,
-    0x8, 0x40, 0x40, 0x20, 0x1, 0x54, 0x0,
-
-    /* U+B1 "±" */
-    0x2, 0x0, 0xc, 0x2, 0xba, 0x0, 0xc0, 0x3,
-    0x0, 0x0, 0x2, 0xaa, 0x0,
-
-    /* U+B2 "²" */
-    0x2a, 0x0, 0x40, 0x20, 0x60, 0x7a, 0x40,
-
-    /* U+BA "º" */
-    0x2a, 0x20, 0x14, 0x14, 0x64,
-
-    /* U+C0 "À" */
-    0x2, 0x0, 0x0, 0x10, 0x0, 0x1c, 0x0, 0xd,
-    0x40, 0x6, 0x30, 0x3, 0x5, 0x1, 0x80, 0xc0,
-    0xea, 0xb4, 0x60, 0x3, 0x20, 0x0, 0x90,
-
-    /* U+C1 "Á" */
-    0x0, 0x60, 0x0, 0x10, 0x0, 0x1c, 0x0, 0xd,
-    0x40, 0x6, 0x30, 0x3, 0x5, 0x1, 0x80, 0xc0,
-    0xea, 0xb4, 0x60, 0x3, 0x20, 0x0, 0x90,
-
-    /* U+C2 "Â" */
-    0x2, 0x90, 0x0, 0x4, 0x0, 0x1c, 0x0, 0xd,
-    0x40, 0x6, 0x30, 0x3, 0x5, 0x1, 0x80, 0xc0,
-    0xea, 0xb4, 0x60, 0x3, 0x20, 0x0, 0x90,
-
-    /* U+C3 "Ã" */
-    0x2, 0x10, 0x1, 0x14, 0x0, 0x1c, 0x0, 0xd,
-    0x40, 0x6, 0x30, 0x3, 0x5, 0x1, 0x80, 0xc0,
-    0xea, 0xb4, 0x60, 0x3, 0x20, 0x0, 0x90,
-
-    /* U+C7 "Ç" */
-    0x6, 0xf9, 0x6, 0x0, 0x43, 0x0, 0x1, 0x80,
-    0x0, 0x60, 0x0, 0xc, 0x0, 0x1, 0x80, 0x10,
-    0x1b, 0xe4, 0x0, 0x90, 0x0, 0x18, 0x0,
-
-    /* U+C9 "É" */
-    0x1, 0x80, 0x4, 0xb, 0xaa, 0x24, 0x0, 0x90,
-    0x2, 0xea, 0x49, 0x0, 0x24, 0x0, 0x90, 0x2,
-    0xea, 0x80,
-
-    /* U+CA "Ê" */
-    0xa, 0x0, 0x1, 0xb, 0xaa, 0x24, 0x0, 0x90,
-    0x2, 0xea, 0x49, 0x0, 0x24, 0x0, 0x90, 0x2,
-    0xea, 0x80,
-
-    /* U+CD "Í" */
-    0x25, 0x9, 0x24, 0x92, 0x49, 0x24, 0x92, 0x40,
-
-    /* U+D3 "Ó" */
-    0x0, 0x24, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x1,
-    0x80, 0x24, 0x30, 0x0, 0xc6, 0x0, 0x9, 0x60,
-    0x0, 0x93, 0x0, 0xc, 0x18, 0x2, 0x40, 0x6a,
-    0x90,
-
-    /* U+D4 "Ô" */
-    0x0, 0xa0, 0x0, 0x10, 0x40, 0x6, 0xf9, 0x1,
-    0x80, 0x24, 0x30, 0x0, 0xc6, 0x0, 0x9, 0x60,
-    0x0, 0x93, 0x0, 0xc, 0x18, 0x2, 0x40, 0x6a,
-    0x90,
-
-    /* U+D5 "Õ" */
-    0x1, 0x44, 0x0, 0x11, 0x40, 0x6, 0xf9, 0x1,
-    0x80, 0x24, 0x30, 0x0, 0xc6, 0x0, 0x9, 0x60,
-    0x0, 0x93, 0x0, 0xc, 0x18, 0x2, 0x40, 0x6a,
-    0x90,
-
-    /* U+DA "Ú" */
-    0x0, 0x80, 0x1, 0x0, 0x80, 0x8, 0x80, 0x8,
-    0x80, 0x8, 0x80, 0x8, 0x80, 0x8, 0x90, 0xc,
-    0x30, 0x18, 0x1a, 0xa0,
-
-    /* U+E0 "à" */
-    0x9, 0x0, 0x0, 0x2a, 0x80, 0x3, 0x1a, 0xb2,
-    0x3, 0x60, 0x32, 0xab,
-
-    /* U+E1 "á" */
-    0x1, 0x80, 0x0, 0x2a, 0x80, 0x3, 0x1a, 0xb2,
-    0x3, 0x60, 0x32, 0xab,
-
-    /* U+E2 "â" */
-    0xa, 0x40, 0x0, 0x2a, 0x80, 0x3, 0x1a, 0xb2,
-    0x3, 0x60, 0x32, 0xab,
-
-    /* U+E3 "ã" */
-    0xa, 0x40, 0x0, 0x2a, 0x80, 0x3, 0x1a, 0xb2,
-    0x3, 0x60, 0x32, 0xab,
-
-    /* U+E7 "ç" */
-    0xa, 0xe0, 0xc0, 0x45, 0x0, 0x14, 0x0, 0x30,
-    0x10, 0x2f, 0x80, 0x20, 0x0, 0x50,
-
-    /* U+E9 "é" */
-    0x1, 0x80, 0x0, 0x0, 0xa9, 0x8, 0x5, 0x7a,
-    0xa9, 0x80, 0x3, 0x1, 0x2, 0xf8,
-
-    /* U+EA "ê" */
-    0x6, 0x80, 0x0, 0x0, 0xa9, 0x8, 0x5, 0x7a,
-    0xa9, 0x80, 0x3, 0x1, 0x2, 0xf8,
-
-    /* U+ED "í" */
-    0x18, 0x0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-
-    /* U+F3 "ó" */
-    0x0, 0x80, 0x0, 0x0, 0xaa, 0xc, 0xa, 0x50,
-    0xd, 0x80, 0x33, 0x2, 0x82, 0xb8,
-
-    /* U+F4 "ô" */
-    0x6, 0x80, 0x0, 0x0, 0xaa, 0xc, 0xa, 0x50,
-    0xd, 0x80, 0x33, 0x2, 0x82, 0xb8,
-
-    /* U+F5 "õ" */
-    0xa, 0x50, 0x0, 0x0, 0xaa, 0xc, 0xa, 0x50,
-    0xd, 0x80, 0x33, 0x2, 0x82, 0xb8,
-
-    /* U+FA "ú" */
-    0x2, 0x40, 0x0, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-    0x3, 0x90, 0x72, 0xa7,
-
-    /* U+20AC "€" */
-    0x0, 0xbe, 0x40, 0x70, 0x8, 0xc, 0x0, 0x6,
-    0xea, 0x40, 0x6e, 0xa4, 0x0, 0xc0, 0x0, 0x7,
-    0x0, 0x80, 0xb, 0xa4,
-
-    /* U+2122 "™" */
-    0x0, 0x0, 0x1, 0x64, 0xc0, 0x30, 0x82, 0x82,
-    0x82, 0x8, 0x56, 0x8, 0x22, 0x88, 0x10, 0x80,
-    0x10
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 50, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 50, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6, .adv_w = 72, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 9, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25, .adv_w = 118, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 46, .adv_w = 159, .box_w = 10, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 66, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 84, .adv_w = 39, .box_w = 2, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 86, .adv_w = 63, .box_w = 3, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 94, .adv_w = 63, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 102, .adv_w = 74, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 109, .adv_w = 110, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 118, .adv_w = 41, .box_w = 2, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 120, .adv_w = 73, .box_w = 4, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 121, .adv_w = 41, .box_w = 2, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 122, .adv_w = 64, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 139, .adv_w = 127, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 155, .adv_w = 69, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 161, .adv_w = 109, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 175, .adv_w = 108, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 189, .adv_w = 127, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 205, .adv_w = 109, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 219, .adv_w = 117, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 233, .adv_w = 113, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 247, .adv_w = 122, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 263, .adv_w = 117, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 277, .adv_w = 41, .box_w = 2, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 280, .adv_w = 41, .box_w = 2, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 284, .adv_w = 110, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 295, .adv_w = 110, .box_w = 7, .box_h = 4, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 302, .adv_w = 110, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 313, .adv_w = 109, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 325, .adv_w = 198, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 355, .adv_w = 138, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 373, .adv_w = 145, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 389, .adv_w = 138, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 407, .adv_w = 159, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 425, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 439, .adv_w = 122, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 453, .adv_w = 148, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 471, .adv_w = 156, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 487, .adv_w = 58, .box_w = 2, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 491, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 503, .adv_w = 137, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 519, .adv_w = 113, .box_w = 6, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 531, .adv_w = 183, .box_w = 10, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 551, .adv_w = 156, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 567, .adv_w = 161, .box_w = 10, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 587, .adv_w = 138, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 601, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 626, .adv_w = 139, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 642, .adv_w = 118, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 656, .adv_w = 110, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 670, .adv_w = 152, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 686, .adv_w = 134, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 704, .adv_w = 213, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 730, .adv_w = 126, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 746, .adv_w = 122, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 762, .adv_w = 125, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 778, .adv_w = 61, .box_w = 3, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 786, .adv_w = 64, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 803, .adv_w = 61, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 811, .adv_w = 111, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 818, .adv_w = 96, .box_w = 6, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 820, .adv_w = 115, .box_w = 4, .box_h = 2, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 822, .adv_w = 113, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 831, .adv_w = 130, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 845, .adv_w = 108, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 856, .adv_w = 130, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 870, .adv_w = 116, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 881, .adv_w = 65, .box_w = 5, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 891, .adv_w = 132, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 907, .adv_w = 130, .box_w = 6, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 919, .adv_w = 52, .box_w = 2, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 923, .adv_w = 53, .box_w = 5, .box_h = 10, .ofs_x = -2, .ofs_y = -2},
-    {.bitmap_index = 936, .adv_w = 115, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 950, .adv_w = 52, .box_w = 2, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 954, .adv_w = 204, .box_w = 11, .box_h = 6, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 971, .adv_w = 130, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 980, .adv_w = 120, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 991, .adv_w = 130, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1005, .adv_w = 130, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1019, .adv_w = 77, .box_w = 4, .box_h = 6, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1025, .adv_w = 94, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1034, .adv_w = 78, .box_w = 5, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1044, .adv_w = 129, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1053, .adv_w = 104, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1064, .adv_w = 169, .box_w = 11, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1081, .adv_w = 103, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1092, .adv_w = 104, .box_w = 8, .box_h = 8, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 1108, .adv_w = 98, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1117, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1127, .adv_w = 57, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1132, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1142, .adv_w = 110, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 1146, .adv_w = 155, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1169, .adv_w = 77, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 1173, .adv_w = 155, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1196, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1209, .adv_w = 83, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 1216, .adv_w = 79, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 1221, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1244, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1267, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1290, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1313, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1336, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1354, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1372, .adv_w = 58, .box_w = 3, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1380, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1405, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1430, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1455, .adv_w = 152, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1475, .adv_w = 113, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1487, .adv_w = 113, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1499, .adv_w = 113, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1511, .adv_w = 113, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1523, .adv_w = 108, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1537, .adv_w = 116, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1551, .adv_w = 116, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1565, .adv_w = 52, .box_w = 4, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1573, .adv_w = 120, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1587, .adv_w = 120, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1601, .adv_w = 120, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1615, .adv_w = 129, .box_w = 6, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1627, .adv_w = 154, .box_w = 10, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1647, .adv_w = 196, .box_w = 11, .box_h = 6, .ofs_x = 0, .ofs_y = 3}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x1, 0x5, 0x8, 0x9, 0x11, 0x17, 0x18,
-    0x19, 0x1a, 0x1e, 0x20, 0x21, 0x24, 0x2a, 0x2b,
-    0x2c, 0x31, 0x37, 0x38, 0x39, 0x3a, 0x3e, 0x40,
-    0x41, 0x44, 0x4a, 0x4b, 0x4c, 0x51, 0x2003, 0x2079
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 169, .range_length = 8314, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    22, 8, 22, 0, 0, 8, 23, 23,
-    23, 23, 25, 26, 26, 29, 22, 22,
-    22, 30, 45, 45, 45, 45, 47, 49,
-    49, 51, 46, 46, 46, 51, 25, 61
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    23, 8, 23, 0, 0, 8, 24, 24,
-    24, 24, 23, 25, 25, 25, 23, 23,
-    23, 28, 37, 37, 37, 37, 39, 39,
-    39, 42, 39, 39, 39, 45, 49, 50
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 2, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 9, 0, 5, -5, 0,
-    0, 0, 0, -11, -12, 2, 9, 5,
-    3, -8, 2, 10, 1, 9, 2, 7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 12, 1, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, 7, 0, -6, 0, 0,
-    0, 0, 0, -4, 3, 4, 0, 0,
-    -2, 0, -2, 2, 0, -2, 0, -2,
-    -1, -4, 0, 0, 0, 0, -2, 0,
-    0, -3, -3, 0, 0, -2, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, -2, 0, 0, 0, 0, -5,
-    0, -23, 0, 0, -4, 0, 4, 6,
-    0, 0, -4, 2, 2, 7, 4, -3,
-    4, 0, 0, -11, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, -10, 0, -8, -2, 0, 0, 0,
-    0, 1, 8, 0, -6, -1, 0, 0,
-    0, -3, 0, 0, -1, -15, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -15, -1, 9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -6, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 6, 0, 2, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7, 1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 4,
-    2, 6, -2, 0, 0, 4, -2, -6,
-    -27, 2, 5, 4, 1, -3, 0, 8,
-    0, 7, 0, 7, 0, -18, 0, -2,
-    6, 0, 7, -2, 4, 2, 0, 0,
-    0, -2, 0, 0, -3, 15, 0, 15,
-    0, 6, 0, 9, 2, 3, 2, 8,
-    0, 0, 0, -7, 0, 0, 0, 0,
-    0, -1, 0, 2, -3, -2, -4, 2,
-    0, -2, 0, 0, 0, -8, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -12, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    2, -4, 0, -11, 0, -12, 0, 0,
-    0, 0, -1, 0, 20, -2, -2, 2,
-    2, -2, 0, -2, 2, 0, 0, -10,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -19, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -8, 0, 12, 0, 0,
-    -7, 0, 6, 0, -13, -19, -12, -4,
-    6, 0, 0, -13, 0, 3, -4, 0,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 6, 6, -24,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 9, 0, 2,
-    0, 0, 0, 0, 0, 2, 2, -2,
-    -4, 0, 0, 0, -2, 0, 0, -2,
-    0, 0, 0, -4, 0, -1, 0, -4,
-    -4, 0, -5, -6, -6, -4, 0, -4,
-    0, -4, 0, 0, 0, 0, -2, 0,
-    0, 2, 0, 2, -2, 0, 0, 0,
-    0, 0, 0, 2, -2, 0, 0, 0,
-    -2, 2, 2, -1, 0, 0, 0, -4,
-    0, -1, 0, 0, 0, 0, 0, 0,
-    0, 2, -2, 0, -2, 0, -3, 0,
-    0, -2, 0, 6, 0, 0, -2, 0,
-    0, 0, 0, 0, -1, 1, -2, -2,
-    0, 0, 0, -2, 0, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    -1, 0, -2, -2, 0, 0, 0, 0,
-    0, 1, 0, 0, -1, 0, -2, -2,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, -1,
-    -2, 0, 0, 0, 0, -6, -2, -6,
-    4, 0, 0, -4, 2, 4, 5, 0,
-    -5, -1, -3, 0, -1, -10, 2, -2,
-    1, -10, 2, 0, 0, 0, -10, 0,
-    -10, -1, -17, -2, 0, -10, 0, 4,
-    6, 0, 2, 0, 0, 0, 0, 0,
-    0, -3, -2, 0, 2, -4, 0, 0,
-    0, -2, 0, 0, 0, -2, 0, 0,
-    0, 0, 0, -1, -1, 0, -1, -3,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    -2, 0, -1, -2, -2, 0, 0, -2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, -1, 0, 0, 0,
-    0, -2, 0, -4, 2, 0, 0, -3,
-    1, 2, 2, 0, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, 0, 0, 2,
-    0, 0, -2, 0, -2, -2, -3, 0,
-    0, 0, 0, 0, 0, 0, 2, 0,
-    -2, 0, 0, 0, 0, -2, -3, 0,
-    2, 0, 0, 6, -2, 0, -7, 0,
-    0, 5, -10, -10, -8, -4, 2, 0,
-    -2, -12, -4, 0, -4, 0, -4, 3,
-    -4, -13, 0, -5, 0, 0, 1, -1,
-    1, -2, 0, 2, -1, -6, -7, 0,
-    -10, -5, -4, -5, -6, -3, -5, -1,
-    -4, -6, -4, 8, 0, 1, 0, -2,
-    0, 0, 0, 2, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, 0, -1, 0, -1, -2, 0,
-    -3, -4, -4, -1, 0, -6, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 1, -1, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    9, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, -2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, -4, 0, 0, 0,
-    0, -10, -6, 0, 0, 0, -3, -10,
-    0, 0, -2, 2, 0, -6, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    3, 0, 2, -4, -4, 0, -2, -2,
-    -2, 0, 0, 0, 0, 0, 0, -6,
-    0, -2, 0, -3, -2, 0, -4, -5,
-    -6, -2, 0, -4, 0, -6, 0, 0,
-    0, 0, 15, 0, 0, 1, 0, 0,
-    -2, 0, 0, 1, 0, -8, 0, 0,
-    0, 0, 0, -18, -3, 7, 6, -1,
-    -8, 0, 2, -3, 0, -10, -1, -3,
-    2, -13, -2, 2, 0, 3, -7, -3,
-    -7, -6, -8, 0, 0, -12, 0, 11,
-    0, 0, -1, 0, 0, 0, -1, -1,
-    -2, -5, -6, 0, 0, -14, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, -1, -2, -3, 0, 0, -4,
-    0, -2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, -4, 0, 0, 4,
-    0, 3, 0, -4, 2, -2, -1, -6,
-    -2, 0, -3, -2, -1, 0, -3, -3,
-    0, 0, -2, 0, -2, -3, -3, 0,
-    0, -2, 0, 2, -2, 0, -4, 0,
-    0, 0, -4, 0, -3, 0, -3, -3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, 2, 0, -3, 0, -2,
-    -3, -7, -2, -2, -2, -1, -2, -3,
-    -1, 0, 0, 0, 0, 0, -2, -2,
-    -2, 0, 0, 0, 0, 3, -2, 0,
-    -2, 0, 0, 0, -2, -3, -2, -2,
-    -3, -2, 0, 0, 1, 8, -1, 0,
-    -6, 0, -2, 4, 0, -2, -8, -3,
-    3, 0, 0, -10, -3, 2, -3, 1,
-    0, -2, -2, -6, 0, -3, 1, 0,
-    0, -3, 0, 0, 0, 2, 2, -4,
-    -4, 0, -3, -2, -3, -2, -2, 0,
-    -3, 1, -4, -3, 0, 6, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -3, 0, 0, -3, 0, 0, -2,
-    -2, 0, 0, 0, 0, -2, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, -3, 0,
-    -4, 0, 0, 0, -6, 0, 2, -4,
-    4, 0, -2, -9, 0, 0, -4, -2,
-    0, -8, -5, -5, 0, 0, -8, -2,
-    -8, -7, -9, 0, -6, 0, 1, 13,
-    -3, 0, -5, -2, -1, -2, -3, -5,
-    -4, -7, -7, -4, 0, 4, 0, 0,
-    -2, 0, 0, 0, 0, -13, -2, 6,
-    5, -5, -7, 0, 0, -7, 0, -10,
-    -2, -2, 4, -18, -3, 0, 0, 0,
-    -12, -2, -10, -2, -14, 0, 0, -13,
-    0, 12, 0, 0, -2, 0, 0, 0,
-    0, -1, -2, -7, -2, 0, 0, -12,
-    0, 0, 0, 0, -6, 0, -2, 0,
-    0, -6, -9, 0, 0, -1, -3, -6,
-    -2, 0, -1, 0, 0, 0, 0, -9,
-    -2, -7, -6, -1, -3, -5, -2, -3,
-    0, -4, -2, -6, -3, 0, -2, -4,
-    -2, -4, 0, 1, 0, -2, -7, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    3, 0, 2, -4, 7, 0, -2, -2,
-    -2, 0, 0, 0, 0, 0, 0, -6,
-    0, -2, 0, -3, -2, 0, -4, -5,
-    -6, -2, 0, -4, 1, 8, 0, 0,
-    0, 0, 15, 0, 0, 1, 0, 0,
-    -2, 0, 0, 1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -4, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, -2, -2, 0,
-    0, -4, -2, 0, 0, -4, 0, 3,
-    -1, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 4, 1,
-    -2, 0, -7, -4, 0, 6, -6, -6,
-    -4, -4, 8, 3, 2, -17, -1, 4,
-    -2, 0, -2, 1, -2, -7, 0, -2,
-    2, -3, -1, -6, -1, 0, 0, 6,
-    4, 0, -6, 0, -11, -3, 4, -3,
-    -7, 0, -3, -7, -7, -2, 0, 10,
-    2, 0, -3, 0, -5, 0, 1, 7,
-    -4, -7, -8, -5, 6, 0, 0, -14,
-    -1, 2, -3, -1, -4, 0, -4, -7,
-    -3, -3, -1, 0, 0, -4, -4, -2,
-    0, 6, 4, -2, -11, 0, -11, -3,
-    0, -7, -11, 0, -6, -3, -7, -5,
-    0, 8, 0, 0, -3, 0, -4, -2,
-    0, -2, -3, 0, 3, -6, 2, 0,
-    0, -10, 0, -2, -4, -3, -1, -6,
-    -5, -6, -5, 0, -6, -2, -4, -4,
-    -6, -2, 0, 0, 0, 9, -3, 0,
-    -6, -2, 0, -2, -4, -4, -5, -5,
-    -7, -2, 0, 6, 4, 0, -3, 0,
-    -10, -3, 1, 4, -6, -7, -4, -6,
-    6, -2, 1, -18, -3, 4, -4, -3,
-    -7, 0, -6, -8, -3, -2, -1, -2,
-    -4, -6, 0, 0, 0, 6, 5, -2,
-    -12, 0, -12, -6, 4, -7, -13, -4,
-    -7, -8, -10, -6, 0, 10, 0, 0,
-    0, 0, -3, 0, 0, 2, -3, 4,
-    2, -4, 4, 0, 0, -7, -1, 0,
-    -1, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, -2, 0, 0, 0, 0,
-    1, 6, 0, 0, -3, 0, 0, 0,
-    0, -2, -2, -3, 0, 0, 0, 6,
-    0, 1, 0, 0, 0, 0, 1, 0,
-    -2, 0, 7, 0, 3, 0, 0, -2,
-    0, 4, 0, 0, 0, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 6, 0, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 9, 0, -12, 0, -2, 3, 0,
-    6, 0, 0, 20, 3, -4, -4, 2,
-    2, -2, 0, -10, 0, 0, 9, -12,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -12, 7, 27, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -12, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    0, -4, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, -5, 0, 0, 0, 0, 0, 2,
-    26, -4, -2, 7, 5, -5, 2, 0,
-    0, 2, 2, -2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -25,
-    5, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, -10,
-    0, 0, 0, -6, 0, 0, 0, -5,
-    0, 0, 0, 0, -4, -1, 0, 0,
-    0, -4, 0, -3, 0, -9, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -13, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -2, 0, 0,
-    0, -5, 0, -3, 0, -5, 0, 0,
-    0, -3, 2, -3, 0, 0, -5, -2,
-    -5, 0, 0, -5, 0, -2, 0, -9,
-    0, -1, 0, 0, -16, -4, -8, -1,
-    -7, 0, 0, -13, 0, -5, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    -4, -2, 0, -6, 0, 0, 0, 0,
-    -5, 0, -4, 2, -1, 4, 0, -2,
-    -5, -2, -3, -4, 0, -3, -1, -2,
-    1, -5, 0, 0, 0, 0, -18, -1,
-    -2, 0, -3, 0, -2, -9, -2, 0,
-    0, -2, -2, 0, 0, 0, 0, 1,
-    0, -2, -3, -2, 0, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -5, 0, -2, 0, 0, 0, -4,
-    2, 0, 0, 0, -5, -2, -4, 0,
-    0, -6, 0, -2, 0, -9, 0, 0,
-    0, 0, -19, 0, -4, -7, -10, 0,
-    0, -13, 0, -1, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, -2, -3, -1,
-    0, -6, 0, 0, 0, 3, -2, 0,
-    5, 10, -2, -2, -6, 3, 10, 3,
-    5, -5, 3, 9, 3, 6, 5, 5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 12, 9, -3, -2, 0,
-    -2, 15, 8, 15, 0, 0, 0, 2,
-    0, 0, 0, 15, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, -18, -3,
-    -1, -8, -10, 0, 0, -13, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 2, 0, 0, 0, 0,
-    -18, -3, -1, -8, -10, 0, 0, -10,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0,
-    -4, 2, 0, -2, 1, 3, 2, -6,
-    0, -1, -1, 2, 0, 1, 0, 0,
-    0, 0, -6, 0, -2, -2, -4, 0,
-    -2, -8, 0, 12, -2, 0, -4, -2,
-    0, -2, -3, 0, -2, -5, -4, -2,
-    0, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, -18, -3, -1, -8,
-    -10, 0, 0, -13, 0, 0, 0, 0,
-    0, 0, 10, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    -7, -3, -2, 6, -2, -2, -8, 0,
-    -2, 0, -2, -6, 0, 4, 0, 1,
-    0, 1, -5, -7, -3, 0, -9, -4,
-    -5, -8, -8, 0, -4, -4, -3, -2,
-    -2, -2, -2, -2, 0, -2, -1, 3,
-    0, 3, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -2, -2, 0, 0, -5,
-    0, -1, 0, -3, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -12,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, -3,
-    0, 0, 0, 0, -2, 0, 0, -3,
-    -2, 2, 0, -3, -4, -2, 0, -6,
-    -2, -5, -1, -3, 0, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -13, 0, 7, 0, 0, -4, 0,
-    0, 0, 0, -3, 0, -2, 0, 0,
-    0, -5, 0, 0, -2, 0, -4, 0,
-    0, 9, -2, -7, -6, 2, 1, 1,
-    -1, -5, 2, 3, 2, 6, 2, 6,
-    -2, -5, 0, 0, -10, 0, 0, -6,
-    -5, 0, 0, -4, 0, -2, -3, 0,
-    -3, 0, -3, 0, -1, 3, 0, -1,
-    -6, -2, 0, 0, 0, 0, -2, 0,
-    -4, 0, 0, 2, -4, 0, 2, -2,
-    1, -1, 0, -6, 0, -2, 0, 0,
-    -2, 1, -1, 0, 0, 0, -9, -3,
-    -4, 0, -6, 0, 0, -9, 0, 7,
-    -2, 0, -4, 0, 0, 0, -2, 0,
-    -2, -6, 0, -2, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 2, -3, 0,
-    0, 0, -3, -2, 0, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -12,
-    0, 5, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    2, 0, -9, 0, 0, 0, 0, 0,
-    0, 2, 0, 6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 61,
-    .right_class_cnt     = 50,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t sr_font_montserrat_12 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 12,          /*The maximum line height required by the font*/
-    .base_line = 2,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if SR_FONT_MONTSERRAT_12*/
-
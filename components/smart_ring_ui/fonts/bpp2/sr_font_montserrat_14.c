@@ -1,1309 +0,0 @@
-#include "lvgl/lvgl.h"
-
-/*******************************************************************************
- * Size: 14 px
- * Bpp: 2
- * Opts: 
- ******************************************************************************/
-
-#ifndef SR_FONT_MONTSERRAT_14
-#define SR_FONT_MONTSERRAT_14 1
-#endif
-
-#if SR_FONT_MONTSERRAT_14
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+20 " " */
-
-    /* U+21 "!" */
-    0xd9, 0x99, 0x99, 0x80, 0x4, 0x90,
-
-    /* U+22 "\"" */
-    0x32, 0xc, 0x83, 0x20, 0xc8,
-
-    /* U+23 "#" */
-    0x3, 0x2, 0x0, 0x30, 0x20, 0x2, 0x5, 0x3,
-    0xff, 0xfd, 0x2, 0x8, 0x0, 0x50, 0x80, 0x5,
-    0xc, 0x7, 0xff, 0xf8, 0x8, 0x8, 0x0, 0xc0,
-    0x80, 0xc, 0x8, 0x0,
-
-    /* U+24 "$" */
-    0x0, 0x40, 0x0, 0x80, 0xb, 0xf8, 0x28, 0x85,
-    0x30, 0x80, 0x30, 0x80, 0x2d, 0x80, 0x7, 0xe4,
-    0x0, 0xdd, 0x0, 0x87, 0x0, 0x83, 0x34, 0x8a,
-    0x1f, 0xf8, 0x0, 0x80, 0x0, 0x80,
-
-    /* U+25 "%" */
-    0x1a, 0x0, 0x90, 0x20, 0x80, 0x80, 0x50, 0x82,
-    0x0, 0x50, 0x85, 0x0, 0x20, 0x88, 0x0, 0x1a,
-    0x21, 0xa0, 0x0, 0x22, 0x8, 0x0, 0x85, 0x8,
-    0x1, 0x45, 0x8, 0x2, 0x2, 0x8, 0x8, 0x1,
-    0xa0,
-
-    /* U+26 "&" */
-    0x3, 0xe0, 0x0, 0xc1, 0x80, 0xc, 0x18, 0x0,
-    0xd3, 0x0, 0x3, 0xd0, 0x0, 0xac, 0x0, 0x24,
-    0x71, 0x43, 0x2, 0xa4, 0x60, 0xb, 0x3, 0x40,
-    0xf4, 0xb, 0xe0, 0xc0, 0x0, 0x0,
-
-    /* U+27 "'" */
-    0x33, 0x33,
-
-    /* U+28 "(" */
-    0xc, 0x24, 0x30, 0x30, 0x60, 0x60, 0x90, 0x90,
-    0x60, 0x60, 0x30, 0x30, 0x24, 0xc,
-
-    /* U+29 ")" */
-    0x30, 0x30, 0x18, 0xc, 0xc, 0xc, 0xc, 0xc,
-    0xc, 0xc, 0xc, 0x18, 0x30, 0x30,
-
-    /* U+2A "*" */
-    0x8, 0x5, 0x88, 0x1e, 0x6, 0xe8, 0x8, 0x0,
-    0x40,
-
-    /* U+2B "+" */
-    0x0, 0x0, 0x1, 0x40, 0x1, 0x40, 0x3f, 0xfc,
-    0x1, 0x40, 0x1, 0x40, 0x1, 0x40,
-
-    /* U+2C "," */
-    0x20, 0xc3, 0x8,
-
-    /* U+2D "-" */
-    0x3f, 0x40,
-
-    /* U+2E "." */
-    0x20, 0xc0,
-
-    /* U+2F "/" */
-    0x0, 0x30, 0x0, 0x80, 0x9, 0x0, 0x30, 0x0,
-    0x80, 0x9, 0x0, 0x30, 0x0, 0x80, 0x9, 0x0,
-    0x30, 0x0, 0x80, 0x9, 0x0, 0x30, 0x0, 0x80,
-    0x0,
-
-    /* U+30 "0" */
-    0x3, 0xf4, 0x3, 0x43, 0x42, 0x40, 0x30, 0xc0,
-    0x9, 0x30, 0x2, 0x4c, 0x0, 0xa3, 0x0, 0x24,
-    0xc0, 0x9, 0x24, 0x3, 0x3, 0x43, 0x40, 0x3f,
-    0x40,
-
-    /* U+31 "1" */
-    0xfd, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9,
-    0x9, 0x9, 0x9,
-
-    /* U+32 "2" */
-    0x1f, 0xe0, 0x60, 0x28, 0x0, 0xc, 0x0, 0xc,
-    0x0, 0x18, 0x0, 0x30, 0x0, 0xd0, 0x3, 0x40,
-    0xd, 0x0, 0x38, 0x0, 0x7f, 0xfd,
-
-    /* U+33 "3" */
-    0x7f, 0xfc, 0x0, 0x34, 0x0, 0x60, 0x0, 0xc0,
-    0x3, 0x40, 0x3, 0xe0, 0x0, 0x2c, 0x0, 0xc,
-    0x0, 0xc, 0xa0, 0x2c, 0x2f, 0xe0,
-
-    /* U+34 "4" */
-    0x0, 0x28, 0x0, 0x7, 0x0, 0x0, 0xc0, 0x0,
-    0x34, 0x0, 0x6, 0x0, 0x0, 0xc0, 0xc0, 0x30,
-    0xc, 0x7, 0xff, 0xfc, 0x0, 0xc, 0x0, 0x0,
-    0xc0, 0x0, 0xc, 0x0,
-
-    /* U+35 "5" */
-    0x2f, 0xfc, 0x24, 0x0, 0x20, 0x0, 0x30, 0x0,
-    0x30, 0x0, 0x3f, 0xe0, 0x0, 0x1c, 0x0, 0xd,
-    0x0, 0x9, 0x60, 0x1c, 0x1f, 0xe0,
-
-    /* U+36 "6" */
-    0x2, 0xfc, 0x3, 0x40, 0x2, 0x80, 0x0, 0xc0,
-    0x0, 0x30, 0x0, 0xc, 0xbe, 0x3, 0xc0, 0xa0,
-    0xc0, 0xc, 0x30, 0x3, 0x7, 0x2, 0x80, 0x7f,
-    0x80,
-
-    /* U+37 "7" */
-    0xbf, 0xfe, 0x90, 0x9, 0x90, 0xc, 0x0, 0x28,
-    0x0, 0x30, 0x0, 0x60, 0x0, 0x90, 0x0, 0xc0,
-    0x2, 0x80, 0x3, 0x0, 0x6, 0x0,
-
-    /* U+38 "8" */
-    0x7, 0xf4, 0xa, 0x3, 0x43, 0x0, 0x30, 0xc0,
-    0xc, 0x28, 0xd, 0x3, 0xff, 0x3, 0x80, 0xa1,
-    0xc0, 0xc, 0x30, 0x3, 0xd, 0x2, 0xc0, 0xbf,
-    0x80,
-
-    /* U+39 "9" */
-    0xb, 0xe0, 0x34, 0x2c, 0x60, 0xd, 0x90, 0xa,
-    0x60, 0xe, 0x34, 0x2b, 0xb, 0xd6, 0x0, 0x6,
-    0x0, 0xc, 0x0, 0x28, 0x2f, 0xd0,
-
-    /* U+3A ":" */
-    0x30, 0x80, 0x0, 0x0, 0x2, 0xc,
-
-    /* U+3B ";" */
-    0x30, 0x80, 0x0, 0x0, 0x2, 0xc, 0x30, 0x80,
-
-    /* U+3C "<" */
-    0x0, 0x0, 0x0, 0x6c, 0x7, 0x80, 0x38, 0x0,
-    0x1e, 0x0, 0x1, 0xb4, 0x0, 0x8,
-
-    /* U+3D "=" */
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-
-    /* U+3E ">" */
-    0x0, 0x0, 0x3d, 0x0, 0x2, 0xd0, 0x0, 0x2c,
-    0x0, 0xb4, 0x1b, 0x40, 0x20, 0x0,
-
-    /* U+3F "?" */
-    0x1f, 0xe2, 0x80, 0xe0, 0x0, 0xc0, 0x7, 0x0,
-    0x34, 0x3, 0x40, 0x18, 0x0, 0x50, 0x0, 0x0,
-    0x4, 0x0, 0x24, 0x0,
-
-    /* U+40 "@" */
-    0x0, 0x6f, 0xe0, 0x0, 0x34, 0x0, 0x90, 0xc,
-    0x0, 0x2, 0x41, 0x42, 0xf8, 0x8c, 0x30, 0xa0,
-    0x78, 0x52, 0xc, 0x2, 0x82, 0x21, 0x80, 0x8,
-    0x22, 0x18, 0x0, 0x82, 0x20, 0xc0, 0x18, 0x23,
-    0xa, 0x7, 0xc9, 0x14, 0x2f, 0x8b, 0x80, 0xc0,
-    0x0, 0x0, 0x3, 0x40, 0x10, 0x0, 0x6, 0xfe,
-    0x0,
-
-    /* U+41 "A" */
-    0x0, 0xa0, 0x0, 0x3, 0xc0, 0x0, 0x25, 0x80,
-    0x0, 0xc3, 0x0, 0x6, 0x9, 0x0, 0x24, 0x1c,
-    0x0, 0xc0, 0x30, 0xb, 0xff, 0xe0, 0x30, 0x0,
-    0xc1, 0x80, 0x2, 0x4d, 0x0, 0x7, 0x0,
-
-    /* U+42 "B" */
-    0x7f, 0xf8, 0x18, 0x1, 0xc6, 0x0, 0x31, 0x80,
-    0xc, 0x60, 0xb, 0x1f, 0xff, 0x46, 0x0, 0x35,
-    0x80, 0x6, 0x60, 0x1, 0x98, 0x0, 0xd7, 0xff,
-    0xd0,
-
-    /* U+43 "C" */
-    0x1, 0xfe, 0x0, 0xb4, 0x1c, 0x1c, 0x0, 0x3,
-    0x0, 0x0, 0x30, 0x0, 0x3, 0x0, 0x0, 0x30,
-    0x0, 0x3, 0x0, 0x0, 0x1c, 0x0, 0x0, 0xb4,
-    0x1c, 0x1, 0xfe, 0x0,
-
-    /* U+44 "D" */
-    0x7f, 0xf8, 0x6, 0x0, 0x74, 0x60, 0x0, 0xc6,
-    0x0, 0x9, 0x60, 0x0, 0x66, 0x0, 0x3, 0x60,
-    0x0, 0x66, 0x0, 0x9, 0x60, 0x0, 0xc6, 0x0,
-    0x74, 0x7f, 0xf8, 0x0,
-
-    /* U+45 "E" */
-    0x7f, 0xfd, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x7f, 0xf8, 0x60, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x60, 0x0, 0x7f, 0xfe,
-
-    /* U+46 "F" */
-    0x7f, 0xfd, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x60, 0x0, 0x7f, 0xf8, 0x60, 0x0,
-    0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-
-    /* U+47 "G" */
-    0x1, 0xfe, 0x40, 0xb4, 0x1d, 0x1c, 0x0, 0x3,
-    0x0, 0x0, 0x30, 0x0, 0x3, 0x0, 0x4, 0x30,
-    0x0, 0x93, 0x0, 0x9, 0x1c, 0x0, 0x90, 0xb4,
-    0x1d, 0x1, 0xfe, 0x40,
-
-    /* U+48 "H" */
-    0x60, 0x0, 0xd8, 0x0, 0x36, 0x0, 0xd, 0x80,
-    0x3, 0x60, 0x0, 0xdf, 0xff, 0xf6, 0x0, 0xd,
-    0x80, 0x3, 0x60, 0x0, 0xd8, 0x0, 0x36, 0x0,
-    0xc,
-
-    /* U+49 "I" */
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x60,
-
-    /* U+4A "J" */
-    0xf, 0xf8, 0x0, 0xa0, 0x2, 0x80, 0xa, 0x0,
-    0x28, 0x0, 0xa0, 0x2, 0x80, 0x9, 0x0, 0x24,
-    0xd0, 0xc0, 0xfd, 0x0,
-
-    /* U+4B "K" */
-    0x60, 0x3, 0x18, 0x3, 0x46, 0x3, 0x41, 0x82,
-    0x80, 0x62, 0x80, 0x19, 0xe0, 0x7, 0xcd, 0x1,
-    0xc0, 0xc0, 0x60, 0x1c, 0x18, 0x2, 0x86, 0x0,
-    0x24,
-
-    /* U+4C "L" */
-    0x60, 0x0, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x60, 0x0, 0x7f, 0xfc,
-
-    /* U+4D "M" */
-    0x60, 0x0, 0x1d, 0xc0, 0x0, 0xf7, 0xc0, 0x7,
-    0xdb, 0x40, 0x37, 0x63, 0x1, 0x8d, 0x89, 0xc,
-    0x36, 0xc, 0x60, 0xd8, 0x27, 0x3, 0x60, 0x38,
-    0xd, 0x80, 0x40, 0x36, 0x0, 0x0, 0xc0,
-
-    /* U+4E "N" */
-    0x70, 0x0, 0xde, 0x0, 0x37, 0xc0, 0xd, 0x9c,
-    0x3, 0x62, 0x80, 0xd8, 0x34, 0x36, 0x7, 0xd,
-    0x80, 0xa3, 0x60, 0xe, 0xd8, 0x0, 0xf6, 0x0,
-    0x1c,
-
-    /* U+4F "O" */
-    0x1, 0xfe, 0x0, 0xb, 0x41, 0xd0, 0x1c, 0x0,
-    0x30, 0x30, 0x0, 0x18, 0x30, 0x0, 0xc, 0x30,
-    0x0, 0xc, 0x30, 0x0, 0xc, 0x30, 0x0, 0x18,
-    0x1c, 0x0, 0x30, 0xb, 0x41, 0xd0, 0x1, 0xfe,
-    0x40,
-
-    /* U+50 "P" */
-    0x7f, 0xf4, 0x18, 0x3, 0x86, 0x0, 0x31, 0x80,
-    0xc, 0x60, 0x3, 0x18, 0x0, 0xc6, 0x0, 0xe1,
-    0xff, 0xd0, 0x60, 0x0, 0x18, 0x0, 0x6, 0x0,
-    0x0,
-
-    /* U+51 "Q" */
-    0x1, 0xfe, 0x0, 0xb, 0x41, 0xd0, 0x1c, 0x0,
-    0x30, 0x30, 0x0, 0x18, 0x30, 0x0, 0xc, 0x30,
-    0x0, 0xc, 0x30, 0x0, 0xc, 0x30, 0x0, 0x18,
-    0x1c, 0x0, 0x30, 0xb, 0x41, 0xd0, 0x1, 0xfe,
-    0x40, 0x0, 0xa, 0x4, 0x0, 0x1, 0xf8,
-
-    /* U+52 "R" */
-    0x7f, 0xf4, 0x18, 0x3, 0x86, 0x0, 0x31, 0x80,
-    0xc, 0x60, 0x3, 0x18, 0x0, 0xc6, 0x0, 0xe1,
-    0xff, 0xd0, 0x60, 0x28, 0x18, 0x3, 0x46, 0x0,
-    0x30,
-
-    /* U+53 "S" */
-    0xb, 0xf8, 0x28, 0x9, 0x30, 0x0, 0x30, 0x0,
-    0x2d, 0x0, 0x7, 0xe4, 0x0, 0x1d, 0x0, 0x3,
-    0x0, 0x3, 0x34, 0xa, 0x1b, 0xf4,
-
-    /* U+54 "T" */
-    0xff, 0xff, 0x2, 0x80, 0x2, 0x80, 0x2, 0x80,
-    0x2, 0x80, 0x2, 0x80, 0x2, 0x80, 0x2, 0x80,
-    0x2, 0x80, 0x2, 0x80, 0x2, 0x80,
-
-    /* U+55 "U" */
-    0x60, 0x1, 0x98, 0x0, 0x66, 0x0, 0x19, 0x80,
-    0x6, 0x60, 0x1, 0x98, 0x0, 0x66, 0x0, 0x19,
-    0x80, 0x9, 0x30, 0x3, 0xb, 0x2, 0x80, 0x7f,
-    0x80,
-
-    /* U+56 "V" */
-    0xd0, 0x0, 0xa6, 0x0, 0xc, 0x30, 0x1, 0xc2,
-    0x80, 0x24, 0xc, 0x3, 0x0, 0xd0, 0x60, 0x6,
-    0xc, 0x0, 0x31, 0xc0, 0x2, 0x64, 0x0, 0xf,
-    0x0, 0x0, 0xe0, 0x0,
-
-    /* U+57 "W" */
-    0x60, 0x3, 0x40, 0xc, 0x30, 0x3, 0xc0, 0x18,
-    0x24, 0x6, 0xc0, 0x24, 0x18, 0x8, 0x90, 0x30,
-    0xc, 0xc, 0x60, 0x60, 0xc, 0x18, 0x30, 0x90,
-    0xa, 0x24, 0x24, 0xc0, 0x3, 0x30, 0x18, 0xc0,
-    0x3, 0x60, 0xe, 0x40, 0x2, 0xd0, 0xf, 0x0,
-    0x1, 0xc0, 0x7, 0x0,
-
-    /* U+58 "X" */
-    0x30, 0x3, 0x4a, 0x1, 0x80, 0xd0, 0xc0, 0xc,
-    0x90, 0x2, 0xe0, 0x0, 0x34, 0x0, 0x3b, 0x0,
-    0x18, 0xa0, 0xc, 0xd, 0xd, 0x0, 0xc6, 0x0,
-    0x28,
-
-    /* U+59 "Y" */
-    0x90, 0x1, 0x8c, 0x0, 0xc2, 0x40, 0xa0, 0x30,
-    0x30, 0xa, 0x24, 0x0, 0xdc, 0x0, 0x1d, 0x0,
-    0x3, 0x0, 0x0, 0xc0, 0x0, 0x30, 0x0, 0xc,
-    0x0,
-
-    /* U+5A "Z" */
-    0x7f, 0xff, 0x40, 0x1, 0xc0, 0x0, 0xd0, 0x0,
-    0xa0, 0x0, 0x70, 0x0, 0x30, 0x0, 0x24, 0x0,
-    0x1c, 0x0, 0xc, 0x0, 0xd, 0x0, 0x7, 0xff,
-    0xf8,
-
-    /* U+5B "[" */
-    0x7c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x7c,
-
-    /* U+5C "\\" */
-    0x60, 0x0, 0xc0, 0x2, 0x0, 0x6, 0x0, 0xc,
-    0x0, 0x20, 0x0, 0x60, 0x0, 0xc0, 0x2, 0x0,
-    0x6, 0x0, 0xc, 0x0, 0x20, 0x0, 0x60, 0x0,
-    0xc0,
-
-    /* U+5D "]" */
-    0xbc, 0x30, 0xc3, 0xc, 0x30, 0xc3, 0xc, 0x30,
-    0xc3, 0xe, 0xf0,
-
-    /* U+5E "^" */
-    0x1, 0x0, 0xb0, 0xa, 0x2, 0x48, 0x30, 0xc6,
-    0x5, 0x80, 0x20,
-
-    /* U+5F "_" */
-    0xaa, 0xa8,
-
-    /* U+60 "`" */
-    0x28, 0x1, 0x80,
-
-    /* U+61 "a" */
-    0x1f, 0xe0, 0x80, 0xa0, 0x0, 0xc2, 0xff, 0x30,
-    0xc, 0xc0, 0x33, 0x2, 0xc7, 0xf7,
-
-    /* U+62 "b" */
-    0x90, 0x0, 0x90, 0x0, 0x90, 0x0, 0x9b, 0xe0,
-    0xb8, 0x1c, 0xa0, 0x6, 0x90, 0x3, 0x90, 0x3,
-    0xa0, 0x6, 0xb8, 0x1c, 0x9b, 0xe0,
-
-    /* U+63 "c" */
-    0x7, 0xf4, 0x28, 0xc, 0x30, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x30, 0x0, 0x28, 0xc, 0x7, 0xf4,
-
-    /* U+64 "d" */
-    0x0, 0x3, 0x0, 0x0, 0xc0, 0x0, 0x30, 0x1f,
-    0xcc, 0x28, 0xf, 0xc, 0x0, 0xc6, 0x0, 0x31,
-    0x80, 0xc, 0x30, 0x3, 0xa, 0x3, 0xc0, 0x7f,
-    0x30,
-
-    /* U+65 "e" */
-    0xb, 0xf0, 0x28, 0xc, 0x30, 0x6, 0x7f, 0xfe,
-    0x70, 0x0, 0x30, 0x0, 0x2c, 0xc, 0x7, 0xf4,
-
-    /* U+66 "f" */
-    0xb, 0xc1, 0x80, 0x18, 0xb, 0xf8, 0x18, 0x1,
-    0x80, 0x18, 0x1, 0x80, 0x18, 0x1, 0x80, 0x18,
-    0x0,
-
-    /* U+67 "g" */
-    0x7, 0xf3, 0xa, 0x3, 0xc3, 0x0, 0x31, 0x80,
-    0xc, 0x60, 0x3, 0xc, 0x0, 0xc2, 0x80, 0xf0,
-    0x1f, 0xcc, 0x0, 0x3, 0x9, 0x2, 0x80, 0xbf,
-    0x80,
-
-    /* U+68 "h" */
-    0x90, 0x0, 0x90, 0x0, 0x90, 0x0, 0x9b, 0xe0,
-    0xb4, 0x28, 0xa0, 0xc, 0x90, 0xc, 0x90, 0xc,
-    0x90, 0xc, 0x90, 0xc, 0x90, 0xc,
-
-    /* U+69 "i" */
-    0x94, 0x9, 0x99, 0x99, 0x99, 0x90,
-
-    /* U+6A "j" */
-    0x2, 0x80, 0x40, 0x0, 0x9, 0x2, 0x40, 0x90,
-    0x24, 0x9, 0x2, 0x40, 0x90, 0x24, 0x9, 0x3,
-    0x4f, 0x80,
-
-    /* U+6B "k" */
-    0x90, 0x0, 0x90, 0x0, 0x90, 0x0, 0x90, 0x28,
-    0x90, 0xa0, 0x92, 0x80, 0x9b, 0x0, 0xba, 0x80,
-    0xa0, 0xd0, 0x90, 0x30, 0x90, 0x1c,
-
-    /* U+6C "l" */
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
-
-    /* U+6D "m" */
-    0x9b, 0xe1, 0xfd, 0x2d, 0xb, 0xc0, 0xca, 0x0,
-    0xc0, 0x26, 0x40, 0x30, 0x6, 0x90, 0xc, 0x1,
-    0xa4, 0x3, 0x0, 0x69, 0x0, 0xc0, 0x1a, 0x40,
-    0x30, 0x6,
-
-    /* U+6E "n" */
-    0x9b, 0xe0, 0xb4, 0x28, 0xa0, 0xc, 0x90, 0xc,
-    0x90, 0xc, 0x90, 0xc, 0x90, 0xc, 0x90, 0xc,
-
-    /* U+6F "o" */
-    0x7, 0xf4, 0xa, 0x3, 0x43, 0x0, 0x31, 0x80,
-    0xc, 0x60, 0x3, 0xc, 0x0, 0xc2, 0x80, 0xd0,
-    0x1f, 0xd0,
-
-    /* U+70 "p" */
-    0x9b, 0xe0, 0xb4, 0x1c, 0xa0, 0x6, 0x90, 0x3,
-    0x90, 0x3, 0xa0, 0xa, 0xb8, 0x1c, 0x9b, 0xe0,
-    0x90, 0x0, 0x90, 0x0, 0x90, 0x0,
-
-    /* U+71 "q" */
-    0x7, 0xf3, 0xa, 0x3, 0xc3, 0x0, 0x31, 0x80,
-    0xc, 0x60, 0x3, 0xc, 0x0, 0xc2, 0x80, 0xf0,
-    0x1f, 0xcc, 0x0, 0x3, 0x0, 0x0, 0xc0, 0x0,
-    0x30,
-
-    /* U+72 "r" */
-    0x9b, 0x2d, 0xa, 0x2, 0x40, 0x90, 0x24, 0x9,
-    0x2, 0x40,
-
-    /* U+73 "s" */
-    0x1f, 0xe0, 0xc0, 0x46, 0x0, 0xe, 0x40, 0x6,
-    0xf0, 0x0, 0x95, 0x3, 0xb, 0xf4,
-
-    /* U+74 "t" */
-    0x18, 0x1, 0x80, 0xbf, 0x81, 0x80, 0x18, 0x1,
-    0x80, 0x18, 0x1, 0x80, 0x1c, 0x0, 0xbc,
-
-    /* U+75 "u" */
-    0x90, 0xc, 0x90, 0xc, 0x90, 0xc, 0x90, 0xc,
-    0x90, 0xc, 0x90, 0xc, 0x30, 0x2c, 0x1f, 0xcc,
-
-    /* U+76 "v" */
-    0xc0, 0x9, 0x60, 0xc, 0x30, 0x18, 0x24, 0x30,
-    0xc, 0x20, 0x9, 0x90, 0x7, 0xc0, 0x3, 0x80,
-
-    /* U+77 "w" */
-    0x80, 0x1c, 0x3, 0x18, 0xf, 0x0, 0x83, 0x3,
-    0x50, 0x90, 0x91, 0x4c, 0x30, 0x18, 0xc3, 0x18,
-    0x3, 0x20, 0x69, 0x0, 0xb4, 0xf, 0x0, 0x1c,
-    0x2, 0x80,
-
-    /* U+78 "x" */
-    0x30, 0x18, 0x28, 0x30, 0xd, 0xd0, 0x3, 0x80,
-    0x7, 0x80, 0xc, 0x90, 0x24, 0x30, 0x60, 0x1c,
-
-    /* U+79 "y" */
-    0x34, 0x2, 0x46, 0x0, 0xc0, 0xc0, 0x60, 0x24,
-    0x30, 0x3, 0x8, 0x0, 0x99, 0x0, 0x1f, 0x0,
-    0x3, 0x40, 0x0, 0xc0, 0x0, 0x60, 0x3, 0xe0,
-    0x0,
-
-    /* U+7A "z" */
-    0x7f, 0xf4, 0x0, 0xc0, 0xc, 0x0, 0x90, 0x6,
-    0x0, 0x30, 0x3, 0x40, 0x1f, 0xfe,
-
-    /* U+7B "{" */
-    0x7, 0x43, 0x0, 0xc0, 0x30, 0xc, 0x3, 0x3,
-    0x80, 0x30, 0xc, 0x3, 0x0, 0xc0, 0x30, 0xc,
-    0x1, 0xd0,
-
-    /* U+7C "|" */
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-
-    /* U+7D "}" */
-    0xb0, 0x18, 0x18, 0x18, 0x18, 0xc, 0xf, 0xc,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0xb0,
-
-    /* U+7E "~" */
-    0x1e, 0x8, 0x20, 0xb4,
-
-    /* U+A9 "©" */
-    0x0, 0xa9, 0x0, 0x14, 0x2, 0x1, 0x4b, 0xc2,
-    0x8, 0x90, 0x84, 0x13, 0x0, 0x4, 0x48, 0x0,
-    0x21, 0x30, 0x0, 0x48, 0x90, 0x84, 0x14, 0xbc,
-    0x20, 0x14, 0x2, 0x0, 0xa, 0x90, 0x0,
-
-    /* U+AA "ª" */
-    0x2a, 0x0, 0x22, 0xa9, 0x46, 0x25, 0x40,
-
-    /* U+AE "®" */
-    0x0, 0xa9, 0x0, 0x14, 0x2, 0x1, 0x4a, 0x82,
-    0x8, 0x50, 0x84, 0x11, 0x42, 0x4, 0x45, 0xc,
-    0x21, 0x1e, 0xd0, 0x48, 0x51, 0x44, 0x14, 0x41,
-    0x20, 0x14, 0x2, 0x0, 0xa, 0x90, 0x0,
-
-    /* U+B1 "±" */
-    0x1, 0x40, 0x1, 0x40, 0x1, 0x40, 0x3f, 0xfc,
-    0x1, 0x40, 0x1, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc,
-
-    /* U+B2 "²" */
-    0x2a, 0x40, 0xc, 0x2, 0x40, 0x80, 0x3a, 0x80,
-
-    /* U+BA "º" */
-    0x1a, 0x45, 0x8, 0x80, 0x56, 0x8, 0x1a, 0x0,
-
-    /* U+C0 "À" */
-    0x1, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x28, 0x0, 0x0, 0xf0, 0x0, 0x9, 0x60,
-    0x0, 0x30, 0xc0, 0x1, 0x82, 0x40, 0x9, 0x7,
-    0x0, 0x30, 0xc, 0x2, 0xff, 0xf8, 0xc, 0x0,
-    0x30, 0x60, 0x0, 0x93, 0x40, 0x1, 0xc0,
-
-    /* U+C1 "Á" */
-    0x0, 0x4, 0x0, 0x0, 0xd0, 0x0, 0x4, 0x0,
-    0x0, 0x28, 0x0, 0x0, 0xf0, 0x0, 0x9, 0x60,
-    0x0, 0x30, 0xc0, 0x1, 0x82, 0x40, 0x9, 0x7,
-    0x0, 0x30, 0xc, 0x2, 0xff, 0xf8, 0xc, 0x0,
-    0x30, 0x60, 0x0, 0x93, 0x40, 0x1, 0xc0,
-
-    /* U+C2 "Â" */
-    0x0, 0x50, 0x0, 0x6, 0x90, 0x0, 0x10, 0x40,
-    0x0, 0x28, 0x0, 0x0, 0xf0, 0x0, 0x9, 0x60,
-    0x0, 0x30, 0xc0, 0x1, 0x82, 0x40, 0x9, 0x7,
-    0x0, 0x30, 0xc, 0x2, 0xff, 0xf8, 0xc, 0x0,
-    0x30, 0x60, 0x0, 0x93, 0x40, 0x1, 0xc0,
-
-    /* U+C3 "Ã" */
-    0x2, 0x84, 0x0, 0x4, 0xa0, 0x0, 0xa, 0x0,
-    0x0, 0x3c, 0x0, 0x2, 0x58, 0x0, 0xc, 0x30,
-    0x0, 0x60, 0x90, 0x2, 0x41, 0xc0, 0xc, 0x3,
-    0x0, 0xbf, 0xfe, 0x3, 0x0, 0xc, 0x18, 0x0,
-    0x24, 0xd0, 0x0, 0x70,
-
-    /* U+C7 "Ç" */
-    0x1, 0xfe, 0x0, 0xb4, 0x1c, 0x1c, 0x0, 0x3,
-    0x0, 0x0, 0x30, 0x0, 0x3, 0x0, 0x0, 0x30,
-    0x0, 0x3, 0x0, 0x0, 0x1c, 0x0, 0x0, 0xb4,
-    0x1c, 0x1, 0xfe, 0x0, 0x2, 0x0, 0x0, 0xc,
-    0x0, 0x6, 0x80,
-
-    /* U+C9 "É" */
-    0x0, 0x10, 0x0, 0xc0, 0x1, 0x0, 0x7f, 0xfd,
-    0x60, 0x0, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x7f, 0xf8, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x7f, 0xfe,
-
-    /* U+CA "Ê" */
-    0x1, 0x40, 0x6, 0x90, 0x4, 0x10, 0x7f, 0xfd,
-    0x60, 0x0, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x7f, 0xf8, 0x60, 0x0, 0x60, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x7f, 0xfe,
-
-    /* U+CD "Í" */
-    0x4, 0x34, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-
-    /* U+D3 "Ó" */
-    0x0, 0x1, 0x0, 0x0, 0xc, 0x0, 0x0, 0x10,
-    0x0, 0x1, 0xfe, 0x0, 0xb, 0x41, 0xd0, 0x1c,
-    0x0, 0x30, 0x30, 0x0, 0x18, 0x30, 0x0, 0xc,
-    0x30, 0x0, 0xc, 0x30, 0x0, 0xc, 0x30, 0x0,
-    0x18, 0x1c, 0x0, 0x30, 0xb, 0x41, 0xd0, 0x1,
-    0xfe, 0x40,
-
-    /* U+D4 "Ô" */
-    0x0, 0x14, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x41,
-    0x0, 0x1, 0xfe, 0x0, 0xb, 0x41, 0xd0, 0x1c,
-    0x0, 0x30, 0x30, 0x0, 0x18, 0x30, 0x0, 0xc,
-    0x30, 0x0, 0xc, 0x30, 0x0, 0xc, 0x30, 0x0,
-    0x18, 0x1c, 0x0, 0x30, 0xb, 0x41, 0xd0, 0x1,
-    0xfe, 0x40,
-
-    /* U+D5 "Õ" */
-    0x0, 0xa2, 0x0, 0x0, 0x49, 0x0, 0x1, 0xfe,
-    0x0, 0xb, 0x41, 0xd0, 0x1c, 0x0, 0x30, 0x30,
-    0x0, 0x18, 0x30, 0x0, 0xc, 0x30, 0x0, 0xc,
-    0x30, 0x0, 0xc, 0x30, 0x0, 0x18, 0x1c, 0x0,
-    0x30, 0xb, 0x41, 0xd0, 0x1, 0xfe, 0x40,
-
-    /* U+DA "Ú" */
-    0x0, 0x14, 0x0, 0x18, 0x0, 0x4, 0x1, 0x80,
-    0x6, 0x60, 0x1, 0x98, 0x0, 0x66, 0x0, 0x19,
-    0x80, 0x6, 0x60, 0x1, 0x98, 0x0, 0x66, 0x0,
-    0x24, 0xc0, 0xc, 0x2c, 0xa, 0x1, 0xfe, 0x0,
-
-    /* U+E0 "à" */
-    0xa, 0x0, 0x5, 0x0, 0x0, 0x7, 0xf8, 0x20,
-    0x28, 0x0, 0x30, 0xbf, 0xcc, 0x3, 0x30, 0xc,
-    0xc0, 0xb1, 0xfd, 0xc0,
-
-    /* U+E1 "á" */
-    0x0, 0xa0, 0x5, 0x0, 0x0, 0x7, 0xf8, 0x20,
-    0x28, 0x0, 0x30, 0xbf, 0xcc, 0x3, 0x30, 0xc,
-    0xc0, 0xb1, 0xfd, 0xc0,
-
-    /* U+E2 "â" */
-    0x3, 0xc0, 0x20, 0x80, 0x0, 0x7, 0xf8, 0x20,
-    0x28, 0x0, 0x30, 0xbf, 0xcc, 0x3, 0x30, 0xc,
-    0xc0, 0xb1, 0xfd, 0xc0,
-
-    /* U+E3 "ã" */
-    0xa, 0x20, 0x12, 0x80, 0x0, 0x7, 0xf8, 0x20,
-    0x28, 0x0, 0x30, 0xbf, 0xcc, 0x3, 0x30, 0xc,
-    0xc0, 0xb1, 0xfd, 0xc0,
-
-    /* U+E7 "ç" */
-    0x7, 0xf4, 0x28, 0xc, 0x30, 0x0, 0x60, 0x0,
-    0x60, 0x0, 0x30, 0x0, 0x28, 0xc, 0x7, 0xf4,
-    0x1, 0x40, 0x0, 0x90, 0x2, 0x80,
-
-    /* U+E9 "é" */
-    0x0, 0x70, 0x0, 0x80, 0x0, 0x0, 0xb, 0xf0,
-    0x28, 0xc, 0x30, 0x6, 0x7f, 0xfe, 0x70, 0x0,
-    0x30, 0x0, 0x2c, 0xc, 0x7, 0xf4,
-
-    /* U+EA "ê" */
-    0x2, 0xd0, 0x9, 0x20, 0x0, 0x0, 0xb, 0xf0,
-    0x28, 0xc, 0x30, 0x6, 0x7f, 0xfe, 0x70, 0x0,
-    0x30, 0x0, 0x2c, 0xc, 0x7, 0xf4,
-
-    /* U+ED "í" */
-    0xa, 0x5, 0x0, 0x0, 0x90, 0x24, 0x9, 0x2,
-    0x40, 0x90, 0x24, 0x9, 0x2, 0x40,
-
-    /* U+F3 "ó" */
-    0x0, 0x30, 0x0, 0x20, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x28, 0xd, 0xc, 0x0, 0xc6, 0x0, 0x31,
-    0x80, 0xc, 0x30, 0x3, 0xa, 0x3, 0x40, 0x7f,
-    0x40,
-
-    /* U+F4 "ô" */
-    0x2, 0xd0, 0x1, 0x48, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x28, 0xd, 0xc, 0x0, 0xc6, 0x0, 0x31,
-    0x80, 0xc, 0x30, 0x3, 0xa, 0x3, 0x40, 0x7f,
-    0x40,
-
-    /* U+F5 "õ" */
-    0x6, 0x48, 0x2, 0x18, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x28, 0xd, 0xc, 0x0, 0xc6, 0x0, 0x31,
-    0x80, 0xc, 0x30, 0x3, 0xa, 0x3, 0x40, 0x7f,
-    0x40,
-
-    /* U+FA "ú" */
-    0x0, 0xd0, 0x2, 0x0, 0x0, 0x0, 0x90, 0xc,
-    0x90, 0xc, 0x90, 0xc, 0x90, 0xc, 0x90, 0xc,
-    0x90, 0xc, 0x30, 0x2c, 0x1f, 0xcc,
-
-    /* U+20AC "€" */
-    0x0, 0x6f, 0xd0, 0xb, 0x41, 0xd0, 0x70, 0x0,
-    0x2, 0x40, 0x0, 0x6e, 0xaa, 0x0, 0x30, 0x0,
-    0x6, 0xea, 0xa0, 0x2, 0x40, 0x0, 0x7, 0x0,
-    0x0, 0xb, 0x41, 0xd0, 0x6, 0xfd, 0x0,
-
-    /* U+2122 "™" */
-    0xae, 0x88, 0x0, 0x83, 0x3, 0x80, 0xa0, 0xc0,
-    0xa0, 0x58, 0x30, 0x22, 0x22, 0xc, 0x8, 0x70,
-    0x83, 0x2, 0x0, 0x20, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 59, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 58, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6, .adv_w = 84, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 11, .adv_w = 156, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 39, .adv_w = 138, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 69, .adv_w = 186, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 102, .adv_w = 150, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 132, .adv_w = 45, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 134, .adv_w = 74, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 148, .adv_w = 74, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 162, .adv_w = 86, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 171, .adv_w = 129, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 185, .adv_w = 47, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 188, .adv_w = 86, .box_w = 5, .box_h = 1, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 190, .adv_w = 47, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 192, .adv_w = 75, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 217, .adv_w = 148, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 242, .adv_w = 81, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 253, .adv_w = 127, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 275, .adv_w = 126, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 297, .adv_w = 148, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 325, .adv_w = 127, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 347, .adv_w = 136, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 372, .adv_w = 132, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 394, .adv_w = 143, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 419, .adv_w = 136, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 441, .adv_w = 47, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 447, .adv_w = 47, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 455, .adv_w = 129, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 469, .adv_w = 129, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 477, .adv_w = 129, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 491, .adv_w = 127, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 511, .adv_w = 231, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 560, .adv_w = 161, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 591, .adv_w = 169, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 616, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 644, .adv_w = 185, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 672, .adv_w = 150, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 694, .adv_w = 142, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 716, .adv_w = 173, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 744, .adv_w = 182, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 769, .adv_w = 68, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 775, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 795, .adv_w = 159, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 820, .adv_w = 132, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 842, .adv_w = 214, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 873, .adv_w = 182, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 898, .adv_w = 188, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 931, .adv_w = 161, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 956, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 995, .adv_w = 162, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1020, .adv_w = 138, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1042, .adv_w = 129, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1064, .adv_w = 177, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1089, .adv_w = 156, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1117, .adv_w = 249, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1161, .adv_w = 147, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1186, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1211, .adv_w = 146, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1236, .adv_w = 71, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1250, .adv_w = 75, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 1275, .adv_w = 71, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1286, .adv_w = 129, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1297, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1299, .adv_w = 134, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 1302, .adv_w = 132, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1316, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1338, .adv_w = 126, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1354, .adv_w = 152, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1379, .adv_w = 135, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1395, .adv_w = 76, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1412, .adv_w = 154, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1437, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1459, .adv_w = 60, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1465, .adv_w = 61, .box_w = 5, .box_h = 14, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 1483, .adv_w = 135, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1505, .adv_w = 60, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1511, .adv_w = 238, .box_w = 13, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1537, .adv_w = 152, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1553, .adv_w = 140, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1571, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1593, .adv_w = 152, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1618, .adv_w = 90, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1628, .adv_w = 110, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1642, .adv_w = 91, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1657, .adv_w = 151, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1673, .adv_w = 121, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1689, .adv_w = 197, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1715, .adv_w = 120, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1731, .adv_w = 121, .box_w = 9, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1756, .adv_w = 114, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1770, .adv_w = 75, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1788, .adv_w = 66, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1795, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1809, .adv_w = 129, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 1813, .adv_w = 181, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1844, .adv_w = 90, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 1851, .adv_w = 181, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1882, .adv_w = 129, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1900, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 1908, .adv_w = 93, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 1916, .adv_w = 161, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1955, .adv_w = 161, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1994, .adv_w = 161, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2033, .adv_w = 161, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2069, .adv_w = 161, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2104, .adv_w = 150, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2132, .adv_w = 150, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2160, .adv_w = 68, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2174, .adv_w = 188, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2216, .adv_w = 188, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2258, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2297, .adv_w = 177, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2329, .adv_w = 132, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2349, .adv_w = 132, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2369, .adv_w = 132, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2389, .adv_w = 132, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2409, .adv_w = 126, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2431, .adv_w = 135, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2453, .adv_w = 135, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2475, .adv_w = 60, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2489, .adv_w = 140, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2514, .adv_w = 140, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2539, .adv_w = 140, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2564, .adv_w = 151, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2586, .adv_w = 180, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2617, .adv_w = 229, .box_w = 13, .box_h = 7, .ofs_x = 0, .ofs_y = 3}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x1, 0x5, 0x8, 0x9, 0x11, 0x17, 0x18,
-    0x19, 0x1a, 0x1e, 0x20, 0x21, 0x24, 0x2a, 0x2b,
-    0x2c, 0x31, 0x37, 0x38, 0x39, 0x3a, 0x3e, 0x40,
-    0x41, 0x44, 0x4a, 0x4b, 0x4c, 0x51, 0x2003, 0x2079
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 169, .range_length = 8314, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    22, 8, 22, 0, 0, 8, 23, 23,
-    23, 23, 25, 26, 26, 29, 22, 22,
-    22, 30, 45, 45, 45, 45, 47, 49,
-    49, 51, 46, 46, 46, 51, 25, 61
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    23, 8, 23, 0, 0, 8, 24, 24,
-    24, 24, 23, 25, 25, 25, 23, 23,
-    23, 28, 37, 37, 37, 37, 39, 39,
-    39, 42, 39, 39, 39, 45, 49, 50
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 2, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 10, 0, 6, -6, 0,
-    0, 0, 0, -12, -13, 2, 11, 6,
-    4, -9, 2, 12, 1, 10, 2, 8,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 13, 1, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, 9, 0, -7, 0, 0,
-    0, 0, 0, -4, 4, 4, 0, 0,
-    -2, 0, -2, 2, 0, -2, 0, -2,
-    -1, -4, 0, 0, 0, 0, -2, 0,
-    0, -3, -3, 0, 0, -2, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, -2, 0, 0, 0, 0, -6,
-    0, -27, 0, 0, -4, 0, 4, 7,
-    0, 0, -4, 2, 2, 8, 4, -4,
-    4, 0, 0, -13, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -9,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, -12, 0, -9, -2, 0, 0, 0,
-    0, 1, 10, 0, -7, -1, 0, 0,
-    0, -4, 0, 0, -1, -17, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -18, -1, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 7, 0, 2, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 8, 1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -9, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 4,
-    2, 7, -2, 0, 0, 4, -2, -7,
-    -31, 2, 6, 4, 1, -3, 0, 9,
-    0, 8, 0, 8, 0, -21, 0, -2,
-    7, 0, 8, -2, 4, 2, 0, 0,
-    0, -2, 0, 0, -4, 18, 0, 18,
-    0, 7, 0, 10, 3, 4, 2, 9,
-    0, 0, 0, -9, 0, 0, 0, 0,
-    0, -1, 0, 2, -4, -3, -4, 2,
-    0, -2, 0, 0, 0, -9, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -15, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    2, -4, 0, -12, 0, -14, 0, 0,
-    0, 0, -1, 0, 23, -2, -3, 2,
-    2, -3, 0, -3, 2, 0, 0, -12,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -22, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -9, 0, 13, 0, 0,
-    -9, 0, 7, 0, -15, -22, -15, -4,
-    7, 0, 0, -15, 0, 3, -5, 0,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7, 7, -28,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 11, 0, 2,
-    0, 0, 0, 0, 0, 2, 2, -2,
-    -4, 0, 0, 0, -2, 0, 0, -2,
-    0, 0, 0, -4, 0, -2, 0, -5,
-    -4, 0, -6, -7, -7, -5, 0, -4,
-    0, -4, 0, 0, 0, 0, -2, 0,
-    0, 2, 0, 2, -2, 0, 0, 0,
-    0, 0, 0, 2, -2, 0, 0, 0,
-    -2, 2, 2, -1, 0, 0, 0, -5,
-    0, -1, 0, 0, 0, 0, 0, 0,
-    0, 3, -2, 0, -2, 0, -4, 0,
-    0, -2, 0, 7, 0, 0, -2, 0,
-    0, 0, 0, 0, -1, 1, -2, -2,
-    0, 0, 0, -2, 0, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    -1, 0, -2, -3, 0, 0, 0, 0,
-    0, 1, 0, 0, -1, 0, -2, -2,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, -1,
-    -3, 0, 0, 0, 0, -7, -2, -7,
-    4, 0, 0, -4, 2, 4, 6, 0,
-    -6, -1, -3, 0, -1, -11, 2, -2,
-    1, -12, 2, 0, 0, 0, -11, 0,
-    -12, -2, -19, -2, 0, -11, 0, 4,
-    6, 0, 3, 0, 0, 0, 0, 0,
-    0, -3, -3, 0, 2, -4, 0, 0,
-    0, -2, 0, 0, 0, -2, 0, 0,
-    0, 0, 0, -1, -1, 0, -1, -3,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    -2, 0, -1, -2, -2, 0, 0, -2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, -2, 0, -4, 2, 0, 0, -3,
-    1, 2, 2, 0, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, 0, 0, 2,
-    0, 0, -2, 0, -2, -2, -3, 0,
-    0, 0, 0, 0, 0, 0, 2, 0,
-    -2, 0, 0, 0, 0, -2, -3, 0,
-    2, 0, 0, 7, -2, 0, -8, 0,
-    0, 6, -11, -12, -10, -4, 2, 0,
-    -2, -15, -4, 0, -4, 0, -4, 3,
-    -4, -15, 0, -6, 0, 0, 1, -1,
-    2, -2, 0, 2, -1, -7, -9, 0,
-    -11, -6, -5, -6, -7, -3, -6, -1,
-    -5, -7, -4, 9, 0, 1, 0, -2,
-    0, 0, 0, 2, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, 0, -1, 0, -1, -2, 0,
-    -4, -5, -5, -1, 0, -7, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 1, -1, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    10, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, -2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, -5, 0, 0, 0,
-    0, -11, -7, 0, 0, 0, -3, -11,
-    0, 0, -2, 2, 0, -7, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, -5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    3, 0, 2, -4, -4, 0, -2, -2,
-    -2, 0, 0, 0, 0, 0, 0, -7,
-    0, -2, 0, -3, -2, 0, -5, -6,
-    -7, -2, 0, -4, 0, -7, 0, 0,
-    0, 0, 18, 0, 0, 1, 0, 0,
-    -3, 0, 0, 1, 0, -10, 0, 0,
-    0, 0, 0, -21, -3, 8, 7, -2,
-    -9, 0, 2, -3, 0, -11, -1, -3,
-    2, -16, -2, 2, 0, 3, -8, -3,
-    -8, -7, -9, 0, 0, -13, 0, 13,
-    0, 0, -1, 0, 0, 0, -1, -1,
-    -2, -6, -7, 0, 0, -16, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, -1, -2, -3, 0, 0, -4,
-    0, -2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, -4, 0, 0, 4,
-    0, 3, 0, -5, 2, -2, -1, -7,
-    -2, 0, -3, -2, -1, 0, -3, -4,
-    0, 0, -2, 0, -2, -4, -3, 0,
-    0, -2, 0, 2, -2, 0, -5, 0,
-    0, 0, -4, 0, -4, 0, -4, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, 2, 0, -4, 0, -2,
-    -3, -9, -2, -2, -2, -1, -2, -3,
-    -1, 0, 0, 0, 0, 0, -2, -2,
-    -2, 0, 0, 0, 0, 3, -2, 0,
-    -2, 0, 0, 0, -2, -3, -2, -2,
-    -3, -2, 0, 0, 1, 9, -1, 0,
-    -7, 0, -2, 4, 0, -2, -10, -3,
-    3, 0, 0, -11, -4, 2, -4, 1,
-    0, -3, -2, -7, 0, -3, 1, 0,
-    0, -4, 0, 0, 0, 2, 2, -4,
-    -5, 0, -4, -2, -3, -2, -2, 0,
-    -4, 1, -5, -4, 0, 7, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -3, 0, 0, -3, 0, 0, -2,
-    -2, 0, 0, 0, 0, -2, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, -3, 0,
-    -4, 0, 0, 0, -7, 0, 2, -5,
-    4, 0, -2, -11, 0, 0, -5, -2,
-    0, -9, -6, -6, 0, 0, -9, -2,
-    -9, -8, -11, 0, -7, 0, 1, 15,
-    -3, 0, -5, -2, -1, -2, -4, -6,
-    -4, -8, -9, -5, 0, 4, 0, 0,
-    -2, 0, 0, 0, 0, -16, -3, 7,
-    6, -6, -9, 0, 0, -9, 0, -11,
-    -2, -2, 4, -21, -3, 0, 0, 0,
-    -15, -3, -12, -2, -17, 0, 0, -16,
-    0, 14, 0, 0, -2, 0, 0, 0,
-    0, -1, -2, -9, -2, 0, 0, -15,
-    0, 0, 0, 0, -7, 0, -2, 0,
-    0, -6, -11, 0, 0, -1, -3, -7,
-    -2, 0, -1, 0, 0, 0, 0, -10,
-    -2, -8, -7, -1, -4, -6, -2, -4,
-    0, -4, -2, -7, -3, 0, -3, -5,
-    -2, -5, 0, 1, 0, -2, -8, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    3, 0, 2, -4, 8, 0, -2, -2,
-    -2, 0, 0, 0, 0, 0, 0, -7,
-    0, -2, 0, -3, -2, 0, -5, -6,
-    -7, -2, 0, -4, 1, 9, 0, 0,
-    0, 0, 18, 0, 0, 1, 0, 0,
-    -3, 0, 0, 1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -4, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, -2, -2, 0,
-    0, -4, -2, 0, 0, -4, 0, 4,
-    -1, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 4, 1,
-    -2, 0, -8, -4, 0, 7, -7, -7,
-    -4, -4, 9, 3, 2, -20, -1, 4,
-    -2, 0, -2, 2, -2, -8, 0, -2,
-    2, -3, -1, -7, -1, 0, 0, 7,
-    4, 0, -6, 0, -12, -3, 5, -3,
-    -9, 0, -3, -8, -8, -2, 0, 11,
-    2, 0, -3, 0, -6, 0, 1, 8,
-    -5, -8, -9, -6, 7, 0, 0, -16,
-    -2, 2, -4, -1, -5, 0, -5, -8,
-    -3, -3, -1, 0, 0, -5, -4, -2,
-    0, 7, 5, -2, -12, 0, -12, -4,
-    0, -8, -13, 0, -7, -4, -8, -6,
-    0, 9, 0, 0, -3, 0, -4, -2,
-    0, -2, -4, 0, 4, -7, 2, 0,
-    0, -12, 0, -2, -5, -4, -1, -7,
-    -6, -7, -5, 0, -7, -2, -5, -5,
-    -7, -2, 0, 0, 0, 11, -4, 0,
-    -7, -2, 0, -2, -4, -5, -6, -6,
-    -8, -3, 0, 7, 4, 0, -3, 0,
-    -11, -3, 1, 4, -7, -8, -4, -7,
-    7, -2, 1, -21, -4, 4, -5, -4,
-    -8, 0, -7, -9, -3, -2, -1, -2,
-    -4, -7, 0, 0, 0, 7, 6, -2,
-    -15, 0, -13, -6, 4, -9, -15, -4,
-    -8, -9, -11, -7, 0, 11, 0, 0,
-    0, 0, -3, 0, 0, 2, -3, 4,
-    2, -5, 4, 0, 0, -9, -1, 0,
-    -1, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, -2, 0, 0, 0, 0,
-    1, 7, 0, 0, -3, 0, 0, 0,
-    0, -2, -2, -3, 0, 0, 0, 7,
-    0, 1, 0, 0, 0, 0, 1, 0,
-    -2, 0, 8, 0, 3, 0, 0, -3,
-    0, 4, 0, 0, 0, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7, 0, 6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 10, 0, -13, 0, -2, 4, 0,
-    7, 0, 0, 23, 3, -4, -4, 2,
-    2, -2, 0, -11, 0, 0, 10, -13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -15, 8, 31, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -13, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    0, -5, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, -6, 0, 0, 0, 0, 0, 2,
-    30, -4, -2, 8, 6, -6, 2, 0,
-    0, 2, 2, -2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -29,
-    6, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, -11,
-    0, 0, 0, -6, 0, 0, 0, -6,
-    0, 0, 0, 0, -5, -1, 0, 0,
-    0, -5, 0, -3, 0, -11, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -15, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -2, 0, 0,
-    0, -6, 0, -3, 0, -6, 0, 0,
-    0, -4, 2, -3, 0, 0, -6, -2,
-    -5, 0, 0, -6, 0, -2, 0, -11,
-    0, -2, 0, 0, -19, -5, -9, -2,
-    -8, 0, 0, -15, 0, -6, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    -4, -2, 0, -7, 0, 0, 0, 0,
-    -6, 0, -5, 3, -2, 4, 0, -2,
-    -5, -2, -4, -5, 0, -3, -1, -2,
-    1, -6, 0, 0, 0, 0, -21, -1,
-    -2, 0, -3, 0, -2, -11, -2, 0,
-    0, -2, -2, 0, 0, 0, 0, 1,
-    0, -2, -4, -2, 0, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -6, 0, -2, 0, 0, 0, -4,
-    2, 0, 0, 0, -6, -2, -4, 0,
-    0, -6, 0, -2, 0, -11, 0, 0,
-    0, 0, -22, 0, -4, -8, -11, 0,
-    0, -15, 0, -1, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, -2, -3, -1,
-    0, -7, 0, 0, 0, 4, -3, 0,
-    6, 12, -2, -2, -7, 3, 12, 4,
-    6, -6, 3, 10, 3, 7, 6, 6,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 14, 11, -3, -2, 0,
-    -2, 18, 9, 18, 0, 0, 0, 2,
-    0, 0, 0, 18, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, -21, -3,
-    -1, -10, -12, 0, 0, -15, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 2, 0, 0, 0, 0,
-    -21, -3, -1, -10, -12, 0, 0, -11,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0,
-    -5, 2, 0, -2, 1, 3, 2, -7,
-    0, -1, -2, 2, 0, 1, 0, 0,
-    0, 0, -7, 0, -2, -2, -4, 0,
-    -2, -9, 0, 15, -2, 0, -5, -2,
-    0, -2, -4, 0, -2, -6, -4, -2,
-    0, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, -21, -3, -1, -10,
-    -12, 0, 0, -15, 0, 0, 0, 0,
-    0, 0, 11, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    -8, -3, -2, 7, -2, -2, -9, 0,
-    -2, 0, -2, -7, 0, 5, 0, 1,
-    0, 1, -6, -9, -3, 0, -10, -5,
-    -6, -10, -9, 0, -4, -4, -3, -3,
-    -2, -2, -3, -2, 0, -2, -1, 3,
-    0, 3, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -2, -2, 0, 0, -6,
-    0, -1, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, -4,
-    0, 0, 0, 0, -2, 0, 0, -4,
-    -2, 2, 0, -4, -5, -2, 0, -7,
-    -2, -6, -1, -3, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -15, 0, 8, 0, 0, -4, 0,
-    0, 0, 0, -3, 0, -2, 0, 0,
-    0, -6, 0, 0, -2, 0, -5, 0,
-    0, 10, -3, -8, -6, 2, 2, 2,
-    -1, -6, 2, 3, 2, 7, 2, 7,
-    -2, -6, 0, 0, -11, 0, 0, -7,
-    -6, 0, 0, -4, 0, -3, -4, 0,
-    -3, 0, -3, 0, -1, 3, 0, -1,
-    -7, -2, 0, 0, 0, 0, -2, 0,
-    -4, 0, 0, 3, -5, 0, 2, -2,
-    1, -1, 0, -7, 0, -2, 0, 0,
-    -2, 2, -1, 0, 0, 0, -11, -3,
-    -5, 0, -7, 0, 0, -11, 0, 9,
-    -2, 0, -4, 0, 0, 0, -2, 0,
-    -2, -7, 0, -2, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 2, -3, 0,
-    0, 0, -3, -2, 0, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -15,
-    0, 6, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    2, 0, -10, 0, 0, 0, 0, 0,
-    0, 3, 0, 7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 9, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 61,
-    .right_class_cnt     = 50,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t sr_font_montserrat_14 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 17,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if SR_FONT_MONTSERRAT_14*/
-
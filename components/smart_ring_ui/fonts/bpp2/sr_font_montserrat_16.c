@@ -1,1390 +0,0 @@
-#include "lvgl/lvgl.h"
-
-/*******************************************************************************
- * Size: 16 px
- * Bpp: 2
- * Opts: 
- ******************************************************************************/
-
-#ifndef SR_FONT_MONTSERRAT_16
-#define SR_FONT_MONTSERRAT_16 1
-#endif
-
-#if SR_FONT_MONTSERRAT_16
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+20 " " */
-
-    /* U+21 "!" */
-    0xaa, 0xaa, 0x66, 0x66, 0x0, 0x5a,
-
-    /* U+22 "\"" */
-    0xc3, 0xc3, 0xc3, 0xc3, 0x41,
-
-    /* U+23 "#" */
-    0x1, 0x80, 0x80, 0x5, 0x6, 0x0, 0x24, 0x14,
-    0xf, 0xff, 0xfe, 0x3, 0x2, 0x0, 0xc, 0x8,
-    0x0, 0x30, 0x30, 0x0, 0xc0, 0xc0, 0x7f, 0xff,
-    0xf0, 0x18, 0x8, 0x0, 0x50, 0x60, 0x2, 0x41,
-    0x40,
-
-    /* U+24 "$" */
-    0x0, 0x50, 0x0, 0x5, 0x0, 0x7, 0xfe, 0x1,
-    0xd9, 0x64, 0x34, 0x50, 0x3, 0x5, 0x0, 0x28,
-    0x50, 0x0, 0xfe, 0x0, 0x0, 0xbe, 0x0, 0x5,
-    0x38, 0x0, 0x50, 0xc0, 0x5, 0xc, 0x38, 0x57,
-    0x80, 0xbf, 0xd0, 0x0, 0x50, 0x0, 0x5, 0x0,
-
-    /* U+25 "%" */
-    0xf, 0x40, 0x18, 0xc, 0x24, 0xc, 0x2, 0x2,
-    0x9, 0x1, 0x40, 0x82, 0x0, 0x20, 0x23, 0x0,
-    0xc, 0x22, 0x40, 0x0, 0xa4, 0xc6, 0x90, 0x0,
-    0xc3, 0x8, 0x0, 0x61, 0x41, 0x80, 0x30, 0x50,
-    0x60, 0x20, 0x8, 0x24, 0x18, 0x1, 0xa4,
-
-    /* U+26 "&" */
-    0x2, 0xf8, 0x0, 0x28, 0x24, 0x0, 0xd0, 0x60,
-    0x2, 0x83, 0x40, 0x3, 0x74, 0x0, 0xb, 0x40,
-    0x0, 0xd7, 0x1, 0xd, 0x7, 0x18, 0x30, 0x7,
-    0x90, 0xc0, 0xb, 0x2, 0xc0, 0x7a, 0x2, 0xfe,
-    0x9, 0x0, 0x0, 0x0,
-
-    /* U+27 "'" */
-    0xcc, 0xcc, 0x40,
-
-    /* U+28 "(" */
-    0x9, 0xc, 0x28, 0x34, 0x30, 0x30, 0x70, 0x70,
-    0x70, 0x70, 0x30, 0x30, 0x34, 0x28, 0xc, 0x9,
-
-    /* U+29 ")" */
-    0x30, 0x24, 0x1c, 0xc, 0xd, 0x9, 0xa, 0xa,
-    0xa, 0xa, 0x9, 0xd, 0xc, 0x1c, 0x24, 0x30,
-
-    /* U+2A "*" */
-    0x5, 0x5, 0x55, 0x2f, 0x81, 0xf8, 0x55, 0x60,
-    0x50, 0x0, 0x0,
-
-    /* U+2B "+" */
-    0x0, 0x0, 0x3, 0x0, 0x3, 0x0, 0x3, 0x0,
-    0xff, 0xfc, 0x3, 0x0, 0x3, 0x0, 0x3, 0x0,
-
-    /* U+2C "," */
-    0x0, 0xd2, 0x4c, 0x30,
-
-    /* U+2D "-" */
-    0x3f, 0xc0, 0x0,
-
-    /* U+2E "." */
-    0x24, 0xd0,
-
-    /* U+2F "/" */
-    0x0, 0x1c, 0x0, 0x90, 0x3, 0x0, 0x1c, 0x0,
-    0x90, 0x3, 0x0, 0x1c, 0x0, 0x90, 0x3, 0x0,
-    0x1c, 0x0, 0x90, 0x3, 0x0, 0x1c, 0x0, 0x90,
-    0x3, 0x0, 0xc, 0x0,
-
-    /* U+30 "0" */
-    0x2, 0xfd, 0x0, 0xf4, 0x74, 0x1c, 0x1, 0xc3,
-    0x40, 0xd, 0x30, 0x0, 0xa3, 0x0, 0x6, 0x30,
-    0x0, 0x63, 0x0, 0xa, 0x34, 0x0, 0xd1, 0xc0,
-    0x1c, 0xf, 0x47, 0x40, 0x2f, 0xd0,
-
-    /* U+31 "1" */
-    0xff, 0x7, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
-    0x3, 0x3, 0x3, 0x3,
-
-    /* U+32 "2" */
-    0x1b, 0xf4, 0x1d, 0x7, 0x40, 0x0, 0x70, 0x0,
-    0x1c, 0x0, 0x6, 0x0, 0x3, 0x40, 0x3, 0x80,
-    0x3, 0x80, 0x3, 0x80, 0x3, 0x80, 0x2, 0xc0,
-    0x1, 0xff, 0xfd,
-
-    /* U+33 "3" */
-    0x7f, 0xff, 0x0, 0x3, 0x40, 0x2, 0x80, 0x2,
-    0xc0, 0x1, 0xc0, 0x0, 0xfe, 0x0, 0x0, 0xe0,
-    0x0, 0xc, 0x0, 0x3, 0x0, 0x0, 0xcb, 0x41,
-    0xe0, 0x7f, 0xd0,
-
-    /* U+34 "4" */
-    0x0, 0xe, 0x0, 0x0, 0xb0, 0x0, 0x3, 0x0,
-    0x0, 0x34, 0x0, 0x2, 0x80, 0x0, 0x1c, 0xc,
-    0x0, 0xc0, 0x30, 0xe, 0x0, 0xc0, 0x7f, 0xff,
-    0xf4, 0x0, 0xc, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0xc0,
-
-    /* U+35 "5" */
-    0x1f, 0xff, 0x6, 0x0, 0x2, 0x80, 0x0, 0x90,
-    0x0, 0x24, 0x0, 0xf, 0xfd, 0x0, 0x1, 0xf0,
-    0x0, 0xd, 0x0, 0x3, 0x40, 0x0, 0xd7, 0x41,
-    0xf0, 0x6f, 0xe0,
-
-    /* U+36 "6" */
-    0x1, 0xff, 0x40, 0xb4, 0x10, 0x1c, 0x0, 0x3,
-    0x40, 0x0, 0x30, 0x0, 0x3, 0x1f, 0xd0, 0x3a,
-    0x7, 0x83, 0x80, 0xc, 0x34, 0x0, 0xc2, 0x80,
-    0xc, 0xe, 0x7, 0x80, 0x2f, 0xd0,
-
-    /* U+37 "7" */
-    0x7f, 0xff, 0x98, 0x0, 0xd6, 0x0, 0x30, 0x0,
-    0x28, 0x0, 0xc, 0x0, 0x7, 0x0, 0x3, 0x40,
-    0x1, 0xc0, 0x0, 0xa0, 0x0, 0x30, 0x0, 0x28,
-    0x0, 0xd, 0x0,
-
-    /* U+38 "8" */
-    0x7, 0xfd, 0x1, 0xd0, 0x78, 0x34, 0x1, 0xc3,
-    0x40, 0xc, 0x1d, 0x3, 0x80, 0xbf, 0xe0, 0x2d,
-    0x3, 0x83, 0x0, 0xd, 0x30, 0x0, 0xd3, 0x0,
-    0xd, 0x2d, 0x7, 0x80, 0x7f, 0xd0,
-
-    /* U+39 "9" */
-    0xb, 0xf4, 0xe, 0x3, 0x87, 0x0, 0x35, 0x80,
-    0xa, 0x70, 0x3, 0xce, 0x2, 0xb0, 0xbf, 0x5c,
-    0x0, 0x7, 0x0, 0x2, 0x40, 0x0, 0xc1, 0x41,
-    0xd0, 0x7f, 0x80,
-
-    /* U+3A ":" */
-    0x34, 0xd0, 0x0, 0x0, 0x0, 0x9, 0x34,
-
-    /* U+3B ";" */
-    0x34, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x34, 0x83,
-    0x0,
-
-    /* U+3C "<" */
-    0x0, 0x0, 0x0, 0x7c, 0xb, 0x90, 0xb8, 0x0,
-    0xb4, 0x0, 0xb, 0x80, 0x0, 0x78, 0x0, 0x4,
-
-    /* U+3D "=" */
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfc,
-
-    /* U+3E ">" */
-    0x0, 0x0, 0xb4, 0x0, 0xb, 0x80, 0x0, 0x78,
-    0x0, 0x6c, 0x7, 0x90, 0xb8, 0x0, 0x40, 0x0,
-
-    /* U+3F "?" */
-    0x1b, 0xf4, 0x74, 0x1d, 0x0, 0x7, 0x0, 0x7,
-    0x0, 0xd, 0x0, 0x28, 0x0, 0xa0, 0x0, 0xc0,
-    0x0, 0x40, 0x0, 0x0, 0x0, 0x80, 0x1, 0xc0,
-
-    /* U+40 "@" */
-    0x0, 0x1f, 0xf9, 0x0, 0x1, 0xd0, 0x2, 0xc0,
-    0x7, 0x0, 0x0, 0x70, 0xc, 0xb, 0xe3, 0x58,
-    0x24, 0x38, 0x1f, 0x4c, 0x30, 0xa0, 0x7, 0x45,
-    0x30, 0xd0, 0x3, 0x42, 0x20, 0xc0, 0x3, 0x42,
-    0x30, 0xd0, 0x3, 0x42, 0x30, 0xa0, 0x7, 0x45,
-    0x24, 0x38, 0x1e, 0x4c, 0xc, 0xb, 0xe0, 0xf4,
-    0x6, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0, 0x0,
-    0x0, 0x1f, 0xf8, 0x0,
-
-    /* U+41 "A" */
-    0x0, 0x38, 0x0, 0x0, 0x7c, 0x0, 0x0, 0xdd,
-    0x0, 0x1, 0xc7, 0x0, 0x3, 0x43, 0x0, 0x3,
-    0x2, 0x80, 0xa, 0x0, 0xc0, 0xd, 0x0, 0xe0,
-    0x1f, 0xff, 0xf0, 0x34, 0x0, 0x34, 0x70, 0x0,
-    0x2c, 0xd0, 0x0, 0xc,
-
-    /* U+42 "B" */
-    0x3f, 0xfe, 0x0, 0xc0, 0xb, 0x3, 0x0, 0xa,
-    0xc, 0x0, 0x28, 0x30, 0x1, 0xc0, 0xff, 0xfd,
-    0x3, 0x0, 0x1d, 0xc, 0x0, 0xc, 0x30, 0x0,
-    0x30, 0xc0, 0x0, 0xc3, 0x0, 0x1e, 0xf, 0xff,
-    0xd0,
-
-    /* U+43 "C" */
-    0x0, 0xbf, 0x90, 0x1e, 0x41, 0xd0, 0xd0, 0x0,
-    0xa, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc0, 0x0,
-    0x3, 0x0, 0x0, 0xc, 0x0, 0x0, 0x28, 0x0,
-    0x0, 0x34, 0x0, 0x0, 0x79, 0x7, 0x40, 0x2f,
-    0xe4,
-
-    /* U+44 "D" */
-    0x3f, 0xfe, 0x0, 0x30, 0x2, 0xd0, 0x30, 0x0,
-    0x34, 0x30, 0x0, 0x1c, 0x30, 0x0, 0xc, 0x30,
-    0x0, 0xd, 0x30, 0x0, 0xd, 0x30, 0x0, 0xc,
-    0x30, 0x0, 0x1c, 0x30, 0x0, 0x34, 0x30, 0x2,
-    0xd0, 0x3f, 0xfe, 0x0,
-
-    /* U+45 "E" */
-    0x3f, 0xff, 0x8c, 0x0, 0x3, 0x0, 0x0, 0xc0,
-    0x0, 0x30, 0x0, 0xf, 0xff, 0x83, 0x0, 0x0,
-    0xc0, 0x0, 0x30, 0x0, 0xc, 0x0, 0x3, 0x0,
-    0x0, 0xff, 0xff,
-
-    /* U+46 "F" */
-    0x3f, 0xff, 0x8c, 0x0, 0x3, 0x0, 0x0, 0xc0,
-    0x0, 0x30, 0x0, 0xc, 0x0, 0x3, 0xff, 0xe0,
-    0xc0, 0x0, 0x30, 0x0, 0xc, 0x0, 0x3, 0x0,
-    0x0, 0xc0, 0x0,
-
-    /* U+47 "G" */
-    0x0, 0xbf, 0x90, 0x1e, 0x41, 0xe0, 0xd0, 0x0,
-    0xa, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc0, 0x0,
-    0x3, 0x0, 0x1, 0xcc, 0x0, 0x7, 0x28, 0x0,
-    0x1c, 0x34, 0x0, 0x70, 0x79, 0x7, 0x80, 0x2f,
-    0xe4,
-
-    /* U+48 "H" */
-    0x30, 0x0, 0x30, 0xc0, 0x0, 0xc3, 0x0, 0x3,
-    0xc, 0x0, 0xc, 0x30, 0x0, 0x30, 0xff, 0xff,
-    0xc3, 0x0, 0x3, 0xc, 0x0, 0xc, 0x30, 0x0,
-    0x30, 0xc0, 0x0, 0xc3, 0x0, 0x3, 0xc, 0x0,
-    0xc,
-
-    /* U+49 "I" */
-    0x30, 0xc3, 0xc, 0x30, 0xc3, 0xc, 0x30, 0xc3,
-    0xc,
-
-    /* U+4A "J" */
-    0xf, 0xfd, 0x0, 0xd, 0x0, 0xd, 0x0, 0xd,
-    0x0, 0xd, 0x0, 0xd, 0x0, 0xd, 0x0, 0xd,
-    0x0, 0xc, 0x0, 0xc, 0x38, 0x28, 0xb, 0xe0,
-
-    /* U+4B "K" */
-    0x30, 0x0, 0xd0, 0xc0, 0xe, 0x3, 0x0, 0xa0,
-    0xc, 0xb, 0x0, 0x30, 0x70, 0x0, 0xc7, 0x40,
-    0x3, 0x7b, 0x0, 0xf, 0x4e, 0x0, 0x34, 0xe,
-    0x0, 0xc0, 0xd, 0x3, 0x0, 0x1c, 0xc, 0x0,
-    0x2c,
-
-    /* U+4C "L" */
-    0x30, 0x0, 0xc, 0x0, 0x3, 0x0, 0x0, 0xc0,
-    0x0, 0x30, 0x0, 0xc, 0x0, 0x3, 0x0, 0x0,
-    0xc0, 0x0, 0x30, 0x0, 0xc, 0x0, 0x3, 0x0,
-    0x0, 0xff, 0xfd,
-
-    /* U+4D "M" */
-    0x30, 0x0, 0x3, 0x4e, 0x0, 0x1, 0xd3, 0xc0,
-    0x0, 0xf4, 0xd8, 0x0, 0x69, 0x33, 0x40, 0x32,
-    0x4c, 0x70, 0x28, 0x93, 0xd, 0xc, 0x24, 0xc1,
-    0xca, 0x9, 0x30, 0x2b, 0x2, 0x4c, 0x3, 0x40,
-    0x93, 0x0, 0x40, 0x24, 0xc0, 0x0, 0x9,
-
-    /* U+4E "N" */
-    0x30, 0x0, 0x30, 0xf0, 0x0, 0xc3, 0xe0, 0x3,
-    0xc, 0xd0, 0xc, 0x31, 0xc0, 0x30, 0xc2, 0xc0,
-    0xc3, 0x3, 0x83, 0xc, 0x3, 0x4c, 0x30, 0x7,
-    0x30, 0xc0, 0xb, 0xc3, 0x0, 0xf, 0xc, 0x0,
-    0xc,
-
-    /* U+4F "O" */
-    0x0, 0xbf, 0x90, 0x1, 0xe4, 0x2e, 0x0, 0xd0,
-    0x0, 0xe0, 0xa0, 0x0, 0xc, 0x30, 0x0, 0x3,
-    0x4c, 0x0, 0x0, 0xa3, 0x0, 0x0, 0x28, 0xc0,
-    0x0, 0xd, 0x28, 0x0, 0x3, 0x3, 0x40, 0x3,
-    0x80, 0x79, 0x7, 0x80, 0x2, 0xfe, 0x40,
-
-    /* U+50 "P" */
-    0x3f, 0xfd, 0x3, 0x0, 0x78, 0x30, 0x0, 0xd3,
-    0x0, 0xa, 0x30, 0x0, 0xa3, 0x0, 0xd, 0x30,
-    0x3, 0xc3, 0xff, 0xe0, 0x30, 0x0, 0x3, 0x0,
-    0x0, 0x30, 0x0, 0x3, 0x0, 0x0,
-
-    /* U+51 "Q" */
-    0x0, 0xbf, 0x90, 0x0, 0x79, 0xb, 0x80, 0xd,
-    0x0, 0xe, 0x2, 0x80, 0x0, 0x70, 0x30, 0x0,
-    0x3, 0x43, 0x0, 0x0, 0x28, 0x30, 0x0, 0x2,
-    0x83, 0x0, 0x0, 0x34, 0x28, 0x0, 0x3, 0x0,
-    0xd0, 0x0, 0xe0, 0x7, 0x90, 0x78, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x3, 0x81, 0x80, 0x0, 0xb,
-    0xf4,
-
-    /* U+52 "R" */
-    0x3f, 0xfd, 0x3, 0x0, 0x78, 0x30, 0x0, 0xd3,
-    0x0, 0xa, 0x30, 0x0, 0xa3, 0x0, 0xd, 0x30,
-    0x3, 0xc3, 0xff, 0xe0, 0x30, 0xd, 0x3, 0x0,
-    0x30, 0x30, 0x2, 0xc3, 0x0, 0xd,
-
-    /* U+53 "S" */
-    0x7, 0xfd, 0x1, 0xd0, 0x64, 0x34, 0x0, 0x3,
-    0x0, 0x0, 0x2c, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x6e, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xc0, 0x0,
-    0x1c, 0x39, 0x7, 0x80, 0xbf, 0xd0,
-
-    /* U+54 "T" */
-    0xff, 0xff, 0xc0, 0xd, 0x0, 0x0, 0xc0, 0x0,
-    0xc, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0,
-    0xc0, 0x0, 0xc, 0x0, 0x0, 0xc0, 0x0, 0xc,
-    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
-
-    /* U+55 "U" */
-    0x70, 0x0, 0x37, 0x0, 0x3, 0x70, 0x0, 0x37,
-    0x0, 0x3, 0x70, 0x0, 0x37, 0x0, 0x3, 0x70,
-    0x0, 0x33, 0x0, 0x7, 0x30, 0x0, 0x63, 0x80,
-    0xd, 0xe, 0x7, 0xc0, 0x2f, 0xe0,
-
-    /* U+56 "V" */
-    0xa0, 0x0, 0x1c, 0x70, 0x0, 0x28, 0x34, 0x0,
-    0x30, 0x2c, 0x0, 0xa0, 0xc, 0x0, 0xd0, 0xa,
-    0x1, 0xc0, 0x7, 0x3, 0x40, 0x3, 0x43, 0x0,
-    0x1, 0xca, 0x0, 0x0, 0xdc, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x34, 0x0,
-
-    /* U+57 "W" */
-    0x70, 0x0, 0xe0, 0x0, 0xc3, 0x40, 0xf, 0x0,
-    0x18, 0x28, 0x1, 0xb4, 0x2, 0x41, 0xc0, 0x26,
-    0x80, 0x30, 0xc, 0x3, 0xc, 0x7, 0x0, 0xa0,
-    0x60, 0xc0, 0x90, 0x7, 0x9, 0xa, 0xc, 0x0,
-    0x30, 0xc0, 0x71, 0xc0, 0x2, 0x58, 0x3, 0x28,
-    0x0, 0x1e, 0x40, 0x2b, 0x0, 0x0, 0xf0, 0x1,
-    0xf0, 0x0, 0xf, 0x0, 0xe, 0x0,
-
-    /* U+58 "X" */
-    0x34, 0x0, 0xa0, 0x70, 0x7, 0x0, 0xa0, 0x30,
-    0x0, 0xd2, 0x80, 0x1, 0xec, 0x0, 0x2, 0xc0,
-    0x0, 0xf, 0x40, 0x0, 0xa3, 0x0, 0x7, 0xb,
-    0x0, 0x34, 0xd, 0x2, 0x80, 0xc, 0x1c, 0x0,
-    0x1c,
-
-    /* U+59 "Y" */
-    0xa0, 0x0, 0x70, 0xc0, 0x3, 0x42, 0x80, 0x18,
-    0x3, 0x40, 0xc0, 0x7, 0xa, 0x0, 0xd, 0x30,
-    0x0, 0x1f, 0x40, 0x0, 0x2c, 0x0, 0x0, 0xa0,
-    0x0, 0x2, 0x80, 0x0, 0xa, 0x0, 0x0, 0x28,
-    0x0,
-
-    /* U+5A "Z" */
-    0x3f, 0xff, 0xe0, 0x0, 0x1d, 0x0, 0x3, 0x80,
-    0x0, 0xb0, 0x0, 0x1c, 0x0, 0x3, 0x40, 0x0,
-    0xe0, 0x0, 0x2c, 0x0, 0x7, 0x0, 0x0, 0xd0,
-    0x0, 0x38, 0x0, 0x7, 0xff, 0xff,
-
-    /* U+5B "[" */
-    0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f,
-
-    /* U+5C "\\" */
-    0x60, 0x0, 0xc0, 0x2, 0x40, 0x6, 0x0, 0xc,
-    0x0, 0x24, 0x0, 0x60, 0x0, 0xc0, 0x3, 0x40,
-    0x6, 0x0, 0xc, 0x0, 0x34, 0x0, 0x60, 0x0,
-    0xc0, 0x3, 0x40, 0x6,
-
-    /* U+5D "]" */
-    0xbd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
-    0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xbd,
-
-    /* U+5E "^" */
-    0x3, 0x40, 0x1a, 0x0, 0xcc, 0x6, 0x14, 0x20,
-    0x30, 0xc0, 0x95, 0x1, 0x80,
-
-    /* U+5F "_" */
-    0xff, 0xff,
-
-    /* U+60 "`" */
-    0x70, 0xd,
-
-    /* U+61 "a" */
-    0xb, 0xf4, 0x28, 0x1d, 0x0, 0x7, 0x0, 0x3,
-    0xb, 0xff, 0x34, 0x3, 0x30, 0x7, 0x34, 0xf,
-    0xb, 0xe7,
-
-    /* U+62 "b" */
-    0x60, 0x0, 0x6, 0x0, 0x0, 0x60, 0x0, 0x6,
-    0x0, 0x0, 0x62, 0xf8, 0x7, 0xd0, 0xb0, 0x74,
-    0x2, 0x87, 0x0, 0xc, 0x60, 0x0, 0xc7, 0x0,
-    0xc, 0x74, 0x2, 0x87, 0xd0, 0xb0, 0x62, 0xf8,
-    0x0,
-
-    /* U+63 "c" */
-    0x2, 0xf8, 0x3, 0x41, 0xc3, 0x40, 0x0, 0xc0,
-    0x0, 0x30, 0x0, 0xc, 0x0, 0x3, 0x40, 0x0,
-    0x34, 0x1c, 0x2, 0xf8, 0x0,
-
-    /* U+64 "d" */
-    0x0, 0x0, 0xd0, 0x0, 0xd, 0x0, 0x0, 0xd0,
-    0x0, 0xd, 0x2, 0xf8, 0xd1, 0xd0, 0x7d, 0x34,
-    0x1, 0xd3, 0x0, 0xd, 0x30, 0x0, 0xd3, 0x0,
-    0xd, 0x34, 0x1, 0xd1, 0xd0, 0x7d, 0x2, 0xf8,
-    0xd0,
-
-    /* U+65 "e" */
-    0x2, 0xf8, 0x7, 0x42, 0xc3, 0x40, 0x24, 0xc0,
-    0x7, 0x3f, 0xff, 0xcc, 0x0, 0x3, 0x40, 0x0,
-    0x38, 0x1c, 0x2, 0xfd, 0x0,
-
-    /* U+66 "f" */
-    0x7, 0xe0, 0xd0, 0xc, 0x0, 0xc0, 0xbf, 0xd0,
-    0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc,
-    0x0, 0xc0, 0xc, 0x0,
-
-    /* U+67 "g" */
-    0x2, 0xf8, 0x90, 0xe0, 0x7d, 0x34, 0x1, 0xd3,
-    0x0, 0xd, 0x30, 0x0, 0xd3, 0x0, 0xd, 0x34,
-    0x1, 0xd0, 0xe0, 0x7d, 0x2, 0xf8, 0xd0, 0x0,
-    0xc, 0x19, 0x7, 0x80, 0x7f, 0xe0,
-
-    /* U+68 "h" */
-    0x60, 0x0, 0x18, 0x0, 0x6, 0x0, 0x1, 0x80,
-    0x0, 0x62, 0xf8, 0x1f, 0x47, 0x87, 0x0, 0x31,
-    0xc0, 0xd, 0x60, 0x3, 0x58, 0x0, 0xd6, 0x0,
-    0x35, 0x80, 0xd, 0x60, 0x3, 0x40,
-
-    /* U+69 "i" */
-    0x75, 0x0, 0x66, 0x66, 0x66, 0x66, 0x60,
-
-    /* U+6A "j" */
-    0x1, 0xc0, 0x8, 0x0, 0x0, 0x0, 0x1, 0xc0,
-    0x1c, 0x1, 0xc0, 0x1c, 0x1, 0xc0, 0x1c, 0x1,
-    0xc0, 0x1c, 0x1, 0xc0, 0x1c, 0x2, 0x83, 0xe0,
-
-    /* U+6B "k" */
-    0x60, 0x0, 0x18, 0x0, 0x6, 0x0, 0x1, 0x80,
-    0x0, 0x60, 0xa, 0x18, 0xa, 0x6, 0xe, 0x1,
-    0x8f, 0x0, 0x7f, 0xc0, 0x1e, 0x2c, 0x7, 0x3,
-    0x81, 0x80, 0x34, 0x60, 0x7, 0x0,
-
-    /* U+6C "l" */
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60,
-
-    /* U+6D "m" */
-    0x67, 0xf8, 0x2f, 0x81, 0xf0, 0x3b, 0x42, 0xc7,
-    0x0, 0x78, 0x3, 0x5c, 0x0, 0xc0, 0x9, 0x60,
-    0x3, 0x0, 0x25, 0x80, 0xc, 0x0, 0x96, 0x0,
-    0x30, 0x2, 0x58, 0x0, 0xc0, 0x9, 0x60, 0x3,
-    0x0, 0x24,
-
-    /* U+6E "n" */
-    0x63, 0xf8, 0x1f, 0x43, 0x87, 0x0, 0x31, 0xc0,
-    0xd, 0x60, 0x3, 0x58, 0x0, 0xd6, 0x0, 0x35,
-    0x80, 0xd, 0x60, 0x3, 0x40,
-
-    /* U+6F "o" */
-    0x2, 0xf8, 0x0, 0xd0, 0x74, 0x34, 0x1, 0xc3,
-    0x0, 0xc, 0x30, 0x0, 0xd3, 0x0, 0xc, 0x34,
-    0x1, 0xc0, 0xd0, 0x74, 0x2, 0xf8, 0x0,
-
-    /* U+70 "p" */
-    0x62, 0xf8, 0x7, 0xd0, 0xb0, 0x70, 0x2, 0x87,
-    0x0, 0xc, 0x60, 0x0, 0xc7, 0x0, 0xc, 0x74,
-    0x2, 0x87, 0xd0, 0xb0, 0x62, 0xf8, 0x6, 0x0,
-    0x0, 0x60, 0x0, 0x6, 0x0, 0x0,
-
-    /* U+71 "q" */
-    0x2, 0xf8, 0xd1, 0xd0, 0x7d, 0x34, 0x1, 0xd3,
-    0x0, 0xd, 0x30, 0x0, 0xd3, 0x0, 0xd, 0x34,
-    0x1, 0xd1, 0xd0, 0x7d, 0x2, 0xf8, 0xd0, 0x0,
-    0xd, 0x0, 0x0, 0xd0, 0x0, 0xd,
-
-    /* U+72 "r" */
-    0x67, 0xdf, 0x47, 0x1, 0xc0, 0x60, 0x18, 0x6,
-    0x1, 0x80, 0x60, 0x0,
-
-    /* U+73 "s" */
-    0xb, 0xf4, 0x34, 0x18, 0x30, 0x0, 0x38, 0x0,
-    0xb, 0xe0, 0x0, 0x2c, 0x0, 0xd, 0x64, 0x1c,
-    0x2f, 0xe0,
-
-    /* U+74 "t" */
-    0xc, 0x0, 0x30, 0xb, 0xfd, 0x3, 0x0, 0xc,
-    0x0, 0x30, 0x0, 0xc0, 0x3, 0x0, 0xc, 0x0,
-    0x34, 0x0, 0x7e, 0x0,
-
-    /* U+75 "u" */
-    0xa0, 0x3, 0x28, 0x0, 0xca, 0x0, 0x32, 0x80,
-    0xc, 0xa0, 0x3, 0x18, 0x0, 0xc7, 0x0, 0x70,
-    0xe0, 0x7c, 0xb, 0xe3, 0x0,
-
-    /* U+76 "v" */
-    0xd0, 0x2, 0x5c, 0x0, 0xc3, 0x0, 0xa0, 0xa0,
-    0x30, 0xc, 0x1c, 0x2, 0x49, 0x0, 0x73, 0x0,
-    0xf, 0x80, 0x1, 0xc0, 0x0,
-
-    /* U+77 "w" */
-    0x90, 0xa, 0x0, 0x76, 0x0, 0xf0, 0x9, 0x30,
-    0x1a, 0x40, 0xc2, 0x42, 0x5c, 0x18, 0x1c, 0x30,
-    0xc2, 0x40, 0xc6, 0x9, 0x30, 0x9, 0x90, 0x36,
-    0x0, 0x3c, 0x3, 0xd0, 0x3, 0x80, 0x1c, 0x0,
-
-    /* U+78 "x" */
-    0x30, 0xa, 0x7, 0x7, 0x0, 0xa3, 0x0, 0xf,
-    0x80, 0x2, 0xc0, 0x0, 0xe8, 0x0, 0xd3, 0x40,
-    0xa0, 0x30, 0x70, 0x7, 0x0,
-
-    /* U+79 "y" */
-    0x34, 0x0, 0x91, 0xc0, 0xc, 0xd, 0x2, 0x80,
-    0x60, 0x30, 0x3, 0x6, 0x0, 0x28, 0xd0, 0x0,
-    0xdc, 0x0, 0xb, 0x40, 0x0, 0x70, 0x0, 0xa,
-    0x0, 0x11, 0xc0, 0x2, 0xf4, 0x0,
-
-    /* U+7A "z" */
-    0x3f, 0xfd, 0x0, 0x1c, 0x0, 0x30, 0x0, 0xd0,
-    0x2, 0x80, 0x7, 0x0, 0xc, 0x0, 0x34, 0x0,
-    0x7f, 0xfe,
-
-    /* U+7B "{" */
-    0x3, 0xc0, 0xa0, 0xd, 0x0, 0xd0, 0xd, 0x0,
-    0xd0, 0xd, 0x3, 0xc0, 0xd, 0x0, 0xd0, 0xd,
-    0x0, 0xd0, 0xd, 0x0, 0xd0, 0xa, 0x0, 0x3c,
-
-    /* U+7C "|" */
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-
-    /* U+7D "}" */
-    0xb4, 0x7, 0x0, 0xc0, 0x30, 0xc, 0x3, 0x0,
-    0xc0, 0x2d, 0xd, 0x3, 0x0, 0xc0, 0x30, 0xc,
-    0x3, 0x1, 0xc2, 0xd0,
-
-    /* U+7E "~" */
-    0xf, 0x2, 0x8, 0x34, 0xc2, 0x2, 0xd0,
-
-    /* U+A9 "©" */
-    0x0, 0x6a, 0x40, 0x0, 0x90, 0x18, 0x0, 0x82,
-    0xf4, 0x80, 0x83, 0x2, 0x8, 0x22, 0x40, 0x2,
-    0x4, 0x80, 0x0, 0x81, 0x24, 0x0, 0x20, 0x83,
-    0x2, 0x8, 0x20, 0x2f, 0x42, 0x2, 0x0, 0x2,
-    0x0, 0x20, 0x6, 0x0, 0x1, 0xa9, 0x0,
-
-    /* U+AA "ª" */
-    0x2a, 0x80, 0x8, 0x2a, 0xd6, 0x9, 0x29, 0x40,
-
-    /* U+AE "®" */
-    0x0, 0x6a, 0x40, 0x0, 0x90, 0x18, 0x0, 0x8b,
-    0xe4, 0x80, 0x82, 0x3, 0x8, 0x20, 0x80, 0x92,
-    0x4, 0x20, 0x30, 0x81, 0xb, 0xf4, 0x20, 0x82,
-    0x5, 0x8, 0x20, 0x80, 0xc2, 0x2, 0x0, 0x2,
-    0x0, 0x20, 0x6, 0x0, 0x1, 0xa9, 0x0,
-
-    /* U+B1 "±" */
-    0x3, 0x0, 0x3, 0x0, 0x3, 0x0, 0xff, 0xfc,
-    0x3, 0x0, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc,
-
-    /* U+B2 "²" */
-    0x2e, 0x80, 0x1, 0x80, 0x6, 0x0, 0x30, 0x3,
-    0x0, 0x70, 0x3, 0xea, 0x0,
-
-    /* U+BA "º" */
-    0x1e, 0x80, 0x80, 0xc5, 0x3, 0xc, 0x1c, 0x1a,
-    0x80,
-
-    /* U+C0 "À" */
-    0x1, 0xc0, 0x0, 0x0, 0x34, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0xdd, 0x0, 0x1, 0xc7, 0x0, 0x3, 0x43, 0x0,
-    0x3, 0x2, 0x80, 0xa, 0x0, 0xc0, 0xd, 0x0,
-    0xe0, 0x1f, 0xff, 0xf0, 0x34, 0x0, 0x34, 0x70,
-    0x0, 0x2c, 0xd0, 0x0, 0xc,
-
-    /* U+C1 "Á" */
-    0x0, 0xa, 0x0, 0x0, 0x24, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0xdd, 0x0, 0x1, 0xc7, 0x0, 0x3, 0x43, 0x0,
-    0x3, 0x2, 0x80, 0xa, 0x0, 0xc0, 0xd, 0x0,
-    0xe0, 0x1f, 0xff, 0xf0, 0x34, 0x0, 0x34, 0x70,
-    0x0, 0x2c, 0xd0, 0x0, 0xc,
-
-    /* U+C2 "Â" */
-    0x0, 0x7c, 0x0, 0x1, 0x87, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0xdd, 0x0, 0x1, 0xc7, 0x0, 0x3, 0x43, 0x0,
-    0x3, 0x2, 0x80, 0xa, 0x0, 0xc0, 0xd, 0x0,
-    0xe0, 0x1f, 0xff, 0xf0, 0x34, 0x0, 0x34, 0x70,
-    0x0, 0x2c, 0xd0, 0x0, 0xc,
-
-    /* U+C3 "Ã" */
-    0x1, 0xe2, 0x0, 0x2, 0x1a, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0xdd, 0x0, 0x1, 0xc7, 0x0, 0x3, 0x43, 0x0,
-    0x3, 0x2, 0x80, 0xa, 0x0, 0xc0, 0xd, 0x0,
-    0xe0, 0x1f, 0xff, 0xf0, 0x34, 0x0, 0x34, 0x70,
-    0x0, 0x2c, 0xd0, 0x0, 0xc,
-
-    /* U+C7 "Ç" */
-    0x0, 0xbf, 0x90, 0x1e, 0x41, 0xd0, 0xd0, 0x0,
-    0xa, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc0, 0x0,
-    0x3, 0x0, 0x0, 0xc, 0x0, 0x0, 0x28, 0x0,
-    0x0, 0x34, 0x0, 0x0, 0x79, 0x7, 0x40, 0x2f,
-    0xe4, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0, 0x3,
-    0xe0, 0x0,
-
-    /* U+C9 "É" */
-    0x0, 0x28, 0x0, 0x24, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x30, 0x0, 0xc, 0x0, 0x3, 0x0, 0x0,
-    0xc0, 0x0, 0x3f, 0xfe, 0xc, 0x0, 0x3, 0x0,
-    0x0, 0xc0, 0x0, 0x30, 0x0, 0xc, 0x0, 0x3,
-    0xff, 0xfc,
-
-    /* U+CA "Ê" */
-    0x1, 0xe0, 0x1, 0x86, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x30, 0x0, 0xc, 0x0, 0x3, 0x0, 0x0,
-    0xc0, 0x0, 0x3f, 0xfe, 0xc, 0x0, 0x3, 0x0,
-    0x0, 0xc0, 0x0, 0x30, 0x0, 0xc, 0x0, 0x3,
-    0xff, 0xfc,
-
-    /* U+CD "Í" */
-    0xd, 0xc, 0x0, 0x0, 0xc0, 0x30, 0xc, 0x3,
-    0x0, 0xc0, 0x30, 0xc, 0x3, 0x0, 0xc0, 0x30,
-    0xc, 0x3, 0x0,
-
-    /* U+D3 "Ó" */
-    0x0, 0x2, 0x80, 0x0, 0x2, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x40, 0x7, 0x90, 0xb8,
-    0x3, 0x40, 0x3, 0x82, 0x80, 0x0, 0x30, 0xc0,
-    0x0, 0xd, 0x30, 0x0, 0x2, 0x8c, 0x0, 0x0,
-    0xa3, 0x0, 0x0, 0x34, 0xa0, 0x0, 0xc, 0xd,
-    0x0, 0xe, 0x1, 0xe4, 0x1e, 0x0, 0xb, 0xf9,
-    0x0,
-
-    /* U+D4 "Ô" */
-    0x0, 0x1f, 0x0, 0x0, 0x18, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x40, 0x7, 0x90, 0xb8,
-    0x3, 0x40, 0x3, 0x82, 0x80, 0x0, 0x30, 0xc0,
-    0x0, 0xd, 0x30, 0x0, 0x2, 0x8c, 0x0, 0x0,
-    0xa3, 0x0, 0x0, 0x34, 0xa0, 0x0, 0xc, 0xd,
-    0x0, 0xe, 0x1, 0xe4, 0x1e, 0x0, 0xb, 0xf9,
-    0x0,
-
-    /* U+D5 "Õ" */
-    0x0, 0x78, 0x80, 0x0, 0x21, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x40, 0x7, 0x90, 0xb8,
-    0x3, 0x40, 0x3, 0x82, 0x80, 0x0, 0x30, 0xc0,
-    0x0, 0xd, 0x30, 0x0, 0x2, 0x8c, 0x0, 0x0,
-    0xa3, 0x0, 0x0, 0x34, 0xa0, 0x0, 0xc, 0xd,
-    0x0, 0xe, 0x1, 0xe4, 0x1e, 0x0, 0xb, 0xf9,
-    0x0,
-
-    /* U+DA "Ú" */
-    0x0, 0xd, 0x0, 0x3, 0x0, 0x0, 0x0, 0x7,
-    0x0, 0x3, 0x70, 0x0, 0x37, 0x0, 0x3, 0x70,
-    0x0, 0x37, 0x0, 0x3, 0x70, 0x0, 0x37, 0x0,
-    0x3, 0x30, 0x0, 0x73, 0x0, 0x6, 0x38, 0x0,
-    0xd0, 0xe0, 0x7c, 0x2, 0xfe, 0x0,
-
-    /* U+E0 "à" */
-    0xb, 0x0, 0x2, 0x80, 0x0, 0x40, 0x0, 0x0,
-    0xb, 0xf4, 0x28, 0x1d, 0x0, 0x7, 0x0, 0x3,
-    0xb, 0xff, 0x34, 0x3, 0x30, 0x7, 0x34, 0xf,
-    0xb, 0xe7,
-
-    /* U+E1 "á" */
-    0x0, 0x28, 0x0, 0xa0, 0x0, 0x40, 0x0, 0x0,
-    0xb, 0xf4, 0x28, 0x1d, 0x0, 0x7, 0x0, 0x3,
-    0xb, 0xff, 0x34, 0x3, 0x30, 0x7, 0x34, 0xf,
-    0xb, 0xe7,
-
-    /* U+E2 "â" */
-    0x1, 0xe0, 0x7, 0x24, 0x4, 0x4, 0x0, 0x0,
-    0xb, 0xf4, 0x28, 0x1d, 0x0, 0x7, 0x0, 0x3,
-    0xb, 0xff, 0x34, 0x3, 0x30, 0x7, 0x34, 0xf,
-    0xb, 0xe7,
-
-    /* U+E3 "ã" */
-    0x7, 0x48, 0x8, 0x88, 0x8, 0x24, 0x0, 0x0,
-    0xb, 0xf4, 0x28, 0x1d, 0x0, 0x7, 0x0, 0x3,
-    0xb, 0xff, 0x34, 0x3, 0x30, 0x7, 0x34, 0xf,
-    0xb, 0xe7,
-
-    /* U+E7 "ç" */
-    0x2, 0xf8, 0x3, 0x41, 0xc3, 0x40, 0x0, 0xc0,
-    0x0, 0x30, 0x0, 0xc, 0x0, 0x3, 0x40, 0x0,
-    0x34, 0x1c, 0x2, 0xf8, 0x0, 0x30, 0x0, 0x3,
-    0x0, 0xa, 0x80,
-
-    /* U+E9 "é" */
-    0x0, 0x1c, 0x0, 0x1c, 0x0, 0x4, 0x0, 0x0,
-    0x0, 0x2, 0xf8, 0x7, 0x42, 0xc3, 0x40, 0x24,
-    0xc0, 0x7, 0x3f, 0xff, 0xcc, 0x0, 0x3, 0x40,
-    0x0, 0x38, 0x1c, 0x2, 0xfd, 0x0,
-
-    /* U+EA "ê" */
-    0x0, 0xf0, 0x0, 0xc6, 0x0, 0x40, 0x40, 0x0,
-    0x0, 0x2, 0xf8, 0x7, 0x42, 0xc3, 0x40, 0x24,
-    0xc0, 0x7, 0x3f, 0xff, 0xcc, 0x0, 0x3, 0x40,
-    0x0, 0x38, 0x1c, 0x2, 0xfd, 0x0,
-
-    /* U+ED "í" */
-    0xd, 0x34, 0x40, 0x0, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60,
-
-    /* U+F3 "ó" */
-    0x0, 0x1c, 0x0, 0x3, 0x0, 0x0, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0xd0, 0x74, 0x34,
-    0x1, 0xc3, 0x0, 0xc, 0x30, 0x0, 0xd3, 0x0,
-    0xc, 0x34, 0x1, 0xc0, 0xd0, 0x74, 0x2, 0xf8,
-    0x0,
-
-    /* U+F4 "ô" */
-    0x0, 0xf0, 0x0, 0x35, 0xc0, 0x1, 0x4, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0xd0, 0x74, 0x34,
-    0x1, 0xc3, 0x0, 0xc, 0x30, 0x0, 0xd3, 0x0,
-    0xc, 0x34, 0x1, 0xc0, 0xd0, 0x74, 0x2, 0xf8,
-    0x0,
-
-    /* U+F5 "õ" */
-    0x2, 0x81, 0x0, 0x55, 0x50, 0x4, 0x28, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0xd0, 0x74, 0x34,
-    0x1, 0xc3, 0x0, 0xc, 0x30, 0x0, 0xd3, 0x0,
-    0xc, 0x34, 0x1, 0xc0, 0xd0, 0x74, 0x2, 0xf8,
-    0x0,
-
-    /* U+FA "ú" */
-    0x0, 0x34, 0x0, 0x34, 0x0, 0x4, 0x0, 0x0,
-    0x0, 0xa0, 0x3, 0x28, 0x0, 0xca, 0x0, 0x32,
-    0x80, 0xc, 0xa0, 0x3, 0x18, 0x0, 0xc7, 0x0,
-    0x70, 0xe0, 0x7c, 0xb, 0xe3, 0x0,
-
-    /* U+20AC "€" */
-    0x0, 0x1f, 0xf4, 0x0, 0x3d, 0x7, 0xc0, 0x38,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x3, 0x40, 0x0, 0x0, 0xd0, 0x0, 0x1, 0xff,
-    0xff, 0x0, 0x7, 0x0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xf, 0x41, 0xf0, 0x0, 0x7f, 0xd0,
-
-    /* U+2122 "™" */
-    0x0, 0x0, 0x0, 0x2, 0xbe, 0x8c, 0x0, 0x60,
-    0x50, 0x38, 0x3, 0x81, 0x40, 0xe4, 0x26, 0x5,
-    0x3, 0x31, 0x88, 0x14, 0xc, 0x2c, 0x20, 0x50,
-    0x30, 0x50, 0x81, 0x40, 0x80, 0x1
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 67, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 67, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6, .adv_w = 95, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 11, .adv_w = 178, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 44, .adv_w = 157, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 84, .adv_w = 212, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 123, .adv_w = 171, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 159, .adv_w = 52, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 162, .adv_w = 84, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 178, .adv_w = 84, .box_w = 4, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 194, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 205, .adv_w = 147, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 221, .adv_w = 54, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 225, .adv_w = 98, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 228, .adv_w = 54, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 230, .adv_w = 86, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 258, .adv_w = 169, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 288, .adv_w = 92, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 300, .adv_w = 145, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 327, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 354, .adv_w = 169, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 387, .adv_w = 145, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 414, .adv_w = 156, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 444, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 471, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 501, .adv_w = 156, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 528, .adv_w = 54, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 535, .adv_w = 54, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 544, .adv_w = 147, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 560, .adv_w = 147, .box_w = 8, .box_h = 5, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 570, .adv_w = 147, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 586, .adv_w = 145, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 610, .adv_w = 264, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 670, .adv_w = 184, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 706, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 739, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 772, .adv_w = 211, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 808, .adv_w = 171, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 835, .adv_w = 162, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 862, .adv_w = 198, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 895, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 928, .adv_w = 77, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 937, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 961, .adv_w = 182, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 994, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1021, .adv_w = 244, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1060, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1093, .adv_w = 215, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1132, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1162, .adv_w = 215, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1211, .adv_w = 185, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1241, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1271, .adv_w = 147, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1301, .adv_w = 203, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1331, .adv_w = 179, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1367, .adv_w = 284, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1421, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1454, .adv_w = 163, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1487, .adv_w = 167, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1517, .adv_w = 81, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1533, .adv_w = 86, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 1561, .adv_w = 81, .box_w = 4, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1577, .adv_w = 147, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1590, .adv_w = 128, .box_w = 8, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1592, .adv_w = 154, .box_w = 4, .box_h = 2, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 1594, .adv_w = 151, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1612, .adv_w = 174, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1645, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1666, .adv_w = 174, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1699, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1720, .adv_w = 87, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1740, .adv_w = 176, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1770, .adv_w = 173, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1800, .adv_w = 69, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1807, .adv_w = 70, .box_w = 6, .box_h = 16, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 1831, .adv_w = 154, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1861, .adv_w = 69, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1868, .adv_w = 272, .box_w = 15, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1902, .adv_w = 173, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1923, .adv_w = 161, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1946, .adv_w = 174, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1976, .adv_w = 174, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2006, .adv_w = 103, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2018, .adv_w = 125, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2036, .adv_w = 104, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2056, .adv_w = 172, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2077, .adv_w = 139, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2098, .adv_w = 225, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2130, .adv_w = 137, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2151, .adv_w = 139, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 2181, .adv_w = 131, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2199, .adv_w = 86, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2223, .adv_w = 76, .box_w = 2, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 2231, .adv_w = 86, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2251, .adv_w = 147, .box_w = 9, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 2258, .adv_w = 207, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2297, .adv_w = 103, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 2305, .adv_w = 207, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2344, .adv_w = 147, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2364, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 2377, .adv_w = 106, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 2386, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2431, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2476, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2521, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2566, .adv_w = 184, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2608, .adv_w = 171, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2642, .adv_w = 171, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2676, .adv_w = 77, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2695, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2744, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2793, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2842, .adv_w = 203, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2880, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2906, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2932, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2958, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2984, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3011, .adv_w = 155, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3041, .adv_w = 155, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3071, .adv_w = 69, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3084, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3117, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3150, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3183, .adv_w = 172, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3213, .adv_w = 205, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3252, .adv_w = 261, .box_w = 15, .box_h = 8, .ofs_x = 0, .ofs_y = 4}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x1, 0x5, 0x8, 0x9, 0x11, 0x17, 0x18,
-    0x19, 0x1a, 0x1e, 0x20, 0x21, 0x24, 0x2a, 0x2b,
-    0x2c, 0x31, 0x37, 0x38, 0x39, 0x3a, 0x3e, 0x40,
-    0x41, 0x44, 0x4a, 0x4b, 0x4c, 0x51, 0x2003, 0x2079
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 169, .range_length = 8314, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    22, 8, 22, 0, 0, 8, 23, 23,
-    23, 23, 25, 26, 26, 29, 22, 22,
-    22, 30, 45, 45, 45, 45, 47, 49,
-    49, 51, 46, 46, 46, 51, 25, 61
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    23, 8, 23, 0, 0, 8, 24, 24,
-    24, 24, 23, 25, 25, 25, 23, 23,
-    23, 28, 37, 37, 37, 37, 39, 39,
-    39, 42, 39, 39, 39, 45, 49, 50
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 3, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 1, 12, 0, 7, -6, 0,
-    0, 0, 0, -14, -15, 2, 12, 6,
-    5, -10, 2, 14, 1, 12, 3, 9,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 15, 1, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -5, 10, 0, -8, 0, 0,
-    0, 0, 0, -5, 5, 5, 0, 0,
-    -3, 0, -2, 3, 0, -3, 0, -3,
-    -1, -5, 0, 0, 0, 0, -3, 0,
-    0, -4, -4, 0, 0, -3, 0, -5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -3, -3, 0, 0, 0, 0, -7,
-    0, -30, 0, 0, -5, 0, 5, 8,
-    0, 0, -5, 3, 3, 9, 5, -5,
-    5, 0, 0, -15, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -10,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, -14, 0, -10, -2, 0, 0, 0,
-    0, 1, 11, 0, -8, -1, -1, 1,
-    0, -5, 0, 0, -2, -20, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -20, -1, 12, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -8, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 8, 0, 3, 0,
-    0, -5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 9, 1, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -10, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 2, 5,
-    3, 8, -3, 0, 0, 5, -3, -8,
-    -36, 2, 7, 5, 1, -4, 0, 10,
-    0, 9, 0, 9, 0, -24, 0, -3,
-    8, 0, 9, -3, 5, 3, 0, 0,
-    1, -3, 0, 0, -5, 20, 0, 20,
-    0, 8, 0, 12, 3, 5, 2, 10,
-    0, 0, 0, -10, 0, 0, 0, 0,
-    1, -2, 0, 2, -4, -3, -5, 2,
-    0, -3, 0, 0, 0, -10, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -17, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    2, -5, 1, -14, 0, -16, 0, 0,
-    0, 0, -2, 0, 26, -3, -3, 3,
-    3, -3, 0, -3, 3, 0, 0, -13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -25, 0, 3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -10, 0, 15, 0, 0,
-    -10, 0, 8, 0, -17, -25, -17, -5,
-    8, 0, 0, -17, 0, 4, -6, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 8, 8, -32,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 0, 2,
-    0, 0, 0, 0, 0, 2, 2, -3,
-    -5, 0, -1, -1, -3, 0, 0, -2,
-    0, 0, 0, -5, 0, -2, 0, -6,
-    -5, 0, -6, -8, -8, -5, 0, -5,
-    0, -5, 0, 0, 0, 0, -2, 0,
-    0, 3, 0, 2, -3, 0, 0, 0,
-    0, 0, 0, 3, -2, 0, 0, 0,
-    -2, 3, 3, -1, 0, 0, 0, -6,
-    0, -1, 0, 0, 0, 0, 0, 1,
-    0, 3, -2, 0, -3, 0, -4, 0,
-    0, -2, 0, 8, 0, 0, -3, 0,
-    0, 0, 0, 0, -1, 1, -2, -2,
-    0, 0, 0, -3, 0, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    -1, 0, -3, -3, 0, 0, 0, 0,
-    0, 1, 0, 0, -2, 0, -3, -3,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, -2,
-    -3, 0, 0, 0, 0, -8, -2, -8,
-    5, 0, 0, -5, 3, 5, 7, 0,
-    -6, -1, -4, 0, -1, -13, 3, -2,
-    2, -13, 3, 0, 0, 1, -13, 0,
-    -13, -2, -22, -2, 0, -13, 0, 5,
-    7, 0, 3, 0, 0, 0, 0, 0,
-    0, -4, -3, 0, 3, -5, 0, 0,
-    0, -3, 0, 0, 0, -3, 0, 0,
-    0, 0, 0, -1, -1, 0, -1, -4,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    -3, 0, -2, -3, -2, 0, 0, -3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, -2, 0, -5, 3, 0, 0, -4,
-    1, 3, 3, 0, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, 0, 0, 2,
-    0, 0, -3, 0, -3, -2, -4, 0,
-    0, 0, 0, 0, 0, 0, 2, 0,
-    -2, 0, 0, 0, 0, -2, -4, 0,
-    3, 0, 0, 8, -2, 1, -9, 0,
-    0, 7, -13, -14, -11, -5, 3, 0,
-    -2, -17, -5, 0, -5, 0, -5, 4,
-    -5, -17, 0, -7, 0, 0, 1, -1,
-    2, -2, 0, 3, -1, -8, -10, 0,
-    -13, -7, -5, -7, -8, -4, -7, -1,
-    -6, -8, -5, 10, 0, 1, 0, -3,
-    0, 0, 0, 2, 0, 3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -3, 0, -1, 0, -1, -3, 0,
-    -4, -5, -5, -1, 0, -8, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 2, -1, 0, 0, 0, 0, 3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    12, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, -3, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, -6, 0, 0, 0,
-    0, -13, -8, 0, 0, 0, -4, -13,
-    0, 0, -3, 3, 0, -8, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, 0, 0, -5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -5, 0, 0, 0, 0,
-    4, 0, 2, -5, -5, 0, -3, -3,
-    -3, 0, 0, 0, 0, 0, 0, -8,
-    0, -3, 0, -4, -3, 0, -5, -6,
-    -8, -2, 0, -5, 0, -8, 0, 0,
-    0, 0, 20, 0, 0, 1, 0, 0,
-    -3, 0, 0, 1, 0, -11, 0, 0,
-    0, 0, 0, -24, -4, 9, 8, -2,
-    -10, 0, 3, -4, 0, -13, -1, -4,
-    3, -18, -3, 2, 0, 4, -9, -4,
-    -9, -8, -10, 0, 0, -15, 0, 15,
-    0, 0, -1, 0, 0, 0, -1, -1,
-    -3, -7, -8, 0, 0, -18, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, -1, -3, -4, 0, 0, -5,
-    0, -3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -1, 0, -5, 0, 0, 5,
-    -1, 4, 0, -6, 3, -2, -1, -8,
-    -3, 0, -4, -3, -2, 0, -4, -5,
-    0, 0, -2, -1, -2, -5, -4, 0,
-    0, -3, 0, 3, -2, 0, -6, 0,
-    0, 0, -5, 0, -5, 0, -5, -5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -5, 3, 0, -4, 0, -2,
-    -4, -10, -2, -2, -2, -1, -2, -4,
-    -1, 0, 0, 0, 0, 0, -3, -2,
-    -2, 0, 0, 0, 0, 4, -2, 0,
-    -2, 0, 0, 0, -2, -4, -2, -3,
-    -4, -3, 0, 0, 1, 10, -1, 0,
-    -8, 0, -2, 5, 0, -3, -11, -4,
-    4, 0, 0, -13, -5, 3, -5, 2,
-    0, -3, -2, -8, 0, -4, 1, 0,
-    0, -5, 0, 0, 0, 3, 3, -5,
-    -5, 0, -5, -3, -4, -3, -3, 0,
-    -5, 1, -5, -5, 0, 8, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, 0, 0, -4, 0, 0, -3,
-    -3, 0, 0, 0, 0, -3, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, -4, 0,
-    -5, 0, 0, 0, -8, 0, 2, -5,
-    5, 0, -2, -12, 0, 0, -5, -3,
-    0, -10, -6, -7, 0, 0, -10, -3,
-    -10, -9, -12, 0, -8, 0, 1, 17,
-    -4, 0, -6, -3, -1, -3, -5, -7,
-    -5, -9, -10, -6, 0, 5, 0, 0,
-    -2, 0, 1, 0, 0, -18, -3, 8,
-    6, -6, -10, 0, 1, -10, 0, -13,
-    -2, -3, 5, -24, -4, 1, 0, 0,
-    -17, -3, -14, -3, -19, 0, 0, -18,
-    0, 16, 1, 0, -2, 0, 0, 0,
-    0, -1, -2, -10, -2, 0, 0, -17,
-    0, 0, 0, 0, -8, 0, -3, 0,
-    -1, -7, -12, 0, 0, -1, -4, -8,
-    -3, 0, -2, 0, 0, 0, 0, -12,
-    -3, -9, -8, -1, -4, -6, -3, -5,
-    0, -5, -3, -8, -4, 0, -3, -6,
-    -3, -6, 0, 1, 0, -2, -9, 0,
-    0, 0, 0, -5, 0, 0, 0, 0,
-    4, 0, 2, -5, 9, 0, -3, -3,
-    -3, 0, 0, 0, 0, 0, 0, -8,
-    0, -3, 0, -4, -3, 0, -5, -6,
-    -8, -2, 0, -5, 1, 10, 0, 0,
-    0, 0, 20, 0, 0, 1, 0, 0,
-    -3, 0, 0, 1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -5, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, -3, -3, 0,
-    0, -5, -3, 0, 0, -5, 0, 5,
-    -1, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 5, 1,
-    -3, 0, -9, -5, 0, 8, -8, -8,
-    -5, -5, 10, 4, 3, -23, -2, 5,
-    -3, 0, -3, 2, -3, -9, 0, -3,
-    3, -4, -1, -8, -1, 0, 0, 8,
-    5, 0, -7, 0, -14, -4, 6, -4,
-    -10, 1, -4, -9, -9, -3, 0, 13,
-    3, 0, -4, 0, -7, 0, 1, 9,
-    -6, -9, -10, -6, 8, 0, 1, -18,
-    -2, 3, -4, -2, -6, 0, -5, -9,
-    -4, -4, -1, 0, 0, -6, -5, -3,
-    0, 8, 6, -3, -14, 0, -14, -5,
-    0, -9, -15, -1, -8, -4, -9, -7,
-    0, 10, 0, 0, -4, 0, -5, -3,
-    0, -3, -4, 0, 5, -8, 3, 0,
-    0, -13, 0, -3, -5, -4, -2, -8,
-    -6, -8, -6, 0, -8, -3, -6, -6,
-    -8, -3, 0, 0, 1, 12, -4, 0,
-    -8, -3, 0, -3, -5, -6, -7, -6,
-    -9, -3, 0, 8, 5, 0, -4, 0,
-    -13, -4, 1, 5, -8, -9, -5, -8,
-    8, -3, 1, -24, -4, 5, -5, -4,
-    -9, 0, -8, -10, -4, -3, -1, -3,
-    -5, -8, -1, 0, 0, 8, 6, -2,
-    -17, 0, -15, -7, 5, -10, -17, -5,
-    -9, -10, -13, -8, 0, 13, 0, 0,
-    0, 0, -4, 0, 0, 3, -4, 5,
-    2, -5, 5, 0, 0, -10, -1, 0,
-    -1, 0, 1, 1, -2, 0, 0, 0,
-    0, 0, 0, -3, 0, 0, 0, 0,
-    1, 8, 0, 0, -4, 0, 0, 0,
-    0, -2, -2, -4, 0, 0, 0, 8,
-    1, 1, 0, 0, 0, 0, 1, 0,
-    -3, 0, 9, 0, 4, 1, 1, -3,
-    0, 5, 0, 0, 0, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8, 0, 6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 12, 0, -15, 0, -3, 5, 0,
-    8, 0, 0, 26, 4, -5, -5, 3,
-    3, -2, 1, -13, 0, 0, 12, -15,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -17, 9, 36, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -15, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, 0,
-    0, -6, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, -7, 0, 0, 1, 0, 0, 3,
-    34, -5, -2, 9, 7, -7, 3, 0,
-    0, 3, 3, -3, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -33,
-    6, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, -13,
-    0, 0, 0, -7, 0, 0, 0, -7,
-    0, 0, 0, 0, -6, -1, 0, 0,
-    0, -6, 0, -4, 0, -12, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -17, 0, 0, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, -3, 0, 0,
-    0, -7, 0, -4, 0, -7, 0, 0,
-    0, -5, 3, -4, 0, 0, -7, -3,
-    -6, 0, 0, -7, 0, -3, 0, -12,
-    0, -2, 0, 0, -22, -6, -10, -2,
-    -9, 0, 0, -17, 0, -7, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    -5, -2, 0, -8, 0, 0, 0, 0,
-    -6, 0, -5, 3, -2, 5, 0, -2,
-    -6, -2, -5, -6, 0, -4, -1, -2,
-    2, -7, -1, 0, 0, 0, -24, -1,
-    -3, 0, -4, 0, -2, -12, -3, 0,
-    0, -2, -2, 0, 0, 0, 0, 2,
-    0, -2, -5, -2, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, -6, 0, -2, 0, 0, 0, -5,
-    3, 0, 0, 0, -7, -3, -5, 0,
-    0, -7, 0, -3, 0, -12, 0, 0,
-    0, 0, -25, 0, -5, -9, -13, 0,
-    0, -17, 0, -2, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, -3, -4, -1,
-    0, -8, 1, 0, 0, 5, -3, 0,
-    7, 14, -3, -3, -8, 4, 14, 5,
-    6, -7, 4, 12, 4, 8, 6, 7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 16, 12, -4, -3, 0,
-    -2, 20, 11, 20, 0, 0, 0, 3,
-    0, 0, 0, 20, 0, 0, -5, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 3, 0, 0, 0, 0, -24, -4,
-    -1, -11, -14, 0, 0, -17, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 3, 0, 0, 0, 0,
-    -24, -4, -1, -11, -14, 0, 0, -13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0,
-    -6, 3, 0, -3, 1, 4, 3, -8,
-    0, -1, -2, 3, 0, 1, 0, 0,
-    0, 0, -8, 0, -3, -2, -5, 0,
-    -3, -10, 0, 17, -3, 0, -5, -2,
-    0, -2, -4, 0, -3, -7, -5, -3,
-    0, 0, 0, 0, -5, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, 3,
-    0, 0, 0, 0, -24, -4, -1, -11,
-    -14, 0, 0, -17, 0, 0, 0, 0,
-    0, 0, 13, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, 0,
-    -9, -4, -3, 8, -3, -3, -10, 1,
-    -3, 1, -2, -8, 0, 5, 0, 1,
-    1, 1, -7, -10, -4, 0, -12, -6,
-    -7, -11, -10, 0, -5, -5, -4, -3,
-    -2, -2, -3, -2, 0, -2, -1, 4,
-    0, 4, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -3, -3, 0, 0, -7,
-    0, -1, 0, -5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -15,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, -3, 0, 0, -5,
-    0, 0, 0, 0, -2, 0, 0, -5,
-    -3, 3, 0, -5, -5, -2, 0, -8,
-    -2, -6, -2, -4, 0, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -17, 0, 9, 0, 0, -5, 0,
-    0, 0, 0, -4, 0, -3, 0, 0,
-    0, -7, 0, 0, -2, 0, -6, 0,
-    0, 12, -3, -9, -7, 2, 2, 2,
-    -1, -6, 2, 4, 2, 8, 2, 8,
-    -2, -7, 0, 0, -13, 0, 0, -8,
-    -7, 0, 0, -5, 0, -3, -4, 0,
-    -4, 0, -4, 0, -2, 4, 0, -1,
-    -8, -3, 0, 0, 0, 0, -3, 0,
-    -5, 0, 0, 3, -6, 0, 3, -3,
-    1, -1, 0, -8, 0, -2, -1, 0,
-    -3, 2, -1, 0, 0, 0, -13, -4,
-    -5, 0, -8, 0, 0, -12, 0, 10,
-    -3, 0, -5, 0, -1, 0, -3, 0,
-    -3, -8, 0, -3, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 3, -4, 1,
-    0, 0, -4, -2, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -17,
-    0, 6, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, -3, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    3, 0, -12, 0, 0, 0, 0, 0,
-    0, 3, 0, 8, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 10, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 61,
-    .right_class_cnt     = 50,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t sr_font_montserrat_16 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 18,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if SR_FONT_MONTSERRAT_16*/
-
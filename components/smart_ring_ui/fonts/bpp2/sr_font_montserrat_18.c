@@ -1,1476 +0,0 @@
-#include "lvgl/lvgl.h"
-
-/*******************************************************************************
- * Size: 18 px
- * Bpp: 2
- * Opts: 
- ******************************************************************************/
-
-#ifndef SR_FONT_MONTSERRAT_18
-#define SR_FONT_MONTSERRAT_18 1
-#endif
-
-#if SR_FONT_MONTSERRAT_18
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+20 " " */
-
-    /* U+21 "!" */
-    0x71, 0xc7, 0x1c, 0x71, 0xc3, 0xc, 0x30, 0x0,
-    0x1c, 0x70,
-
-    /* U+22 "\"" */
-    0xd2, 0x64, 0x99, 0x26, 0x49, 0x92, 0x40,
-
-    /* U+23 "#" */
-    0x0, 0xc0, 0x30, 0x0, 0xc0, 0x60, 0x0, 0xc0,
-    0x60, 0x3f, 0xff, 0xff, 0x1, 0x80, 0x90, 0x2,
-    0x40, 0xc0, 0x2, 0x40, 0xc0, 0x2, 0x0, 0xc0,
-    0x7f, 0xff, 0xfd, 0x3, 0x1, 0x80, 0x3, 0x1,
-    0x80, 0x3, 0x1, 0x40, 0x6, 0x2, 0x40,
-
-    /* U+24 "$" */
-    0x0, 0x10, 0x0, 0x0, 0xc0, 0x0, 0x3, 0x0,
-    0x0, 0xbf, 0xd0, 0xe, 0x75, 0xe0, 0xb0, 0xc0,
-    0x3, 0x83, 0x0, 0xb, 0xc, 0x0, 0xf, 0x70,
-    0x0, 0xb, 0xf8, 0x0, 0x3, 0x7d, 0x0, 0xc,
-    0x2c, 0x0, 0x30, 0x30, 0x40, 0xc1, 0xc3, 0xd3,
-    0x1e, 0x1, 0xff, 0xd0, 0x0, 0x30, 0x0, 0x0,
-    0xc0, 0x0,
-
-    /* U+25 "%" */
-    0xb, 0xc0, 0x3, 0x0, 0xd0, 0xc0, 0x34, 0x3,
-    0x2, 0x41, 0x80, 0x8, 0x5, 0xc, 0x0, 0x30,
-    0x24, 0x90, 0x0, 0x90, 0xc6, 0x0, 0x0, 0xb8,
-    0x30, 0xb8, 0x0, 0x2, 0x4c, 0x18, 0x0, 0x18,
-    0x60, 0x30, 0x0, 0xc1, 0x40, 0xc0, 0x9, 0x5,
-    0x3, 0x0, 0x60, 0xc, 0x18, 0x3, 0x0, 0xf,
-    0x80,
-
-    /* U+26 "&" */
-    0x1, 0xfd, 0x0, 0x3, 0x43, 0x40, 0x6, 0x2,
-    0x80, 0x7, 0x3, 0x40, 0x3, 0x4e, 0x0, 0x1,
-    0xf4, 0x0, 0x3, 0xb4, 0x0, 0xd, 0x1d, 0xc,
-    0x34, 0x7, 0x5c, 0x30, 0x1, 0xf4, 0x34, 0x0,
-    0xb4, 0x1d, 0x6, 0xec, 0x7, 0xfe, 0x6, 0x0,
-    0x0, 0x0,
-
-    /* U+27 "'" */
-    0xd9, 0x99, 0x90,
-
-    /* U+28 "(" */
-    0x7, 0x3, 0x40, 0xc0, 0x70, 0x28, 0xd, 0x3,
-    0x40, 0xc0, 0x30, 0xc, 0x3, 0x0, 0xd0, 0x34,
-    0xa, 0x1, 0xc0, 0x30, 0x9, 0x1, 0xc0,
-
-    /* U+29 ")" */
-    0x30, 0xa, 0x0, 0xc0, 0x34, 0xa, 0x1, 0x80,
-    0x70, 0x1c, 0x3, 0x0, 0xc0, 0x70, 0x1c, 0x6,
-    0x2, 0x80, 0xd0, 0x30, 0x28, 0xc, 0x0,
-
-    /* U+2A "*" */
-    0x3, 0x1, 0x4c, 0x42, 0xba, 0x3, 0xe0, 0x77,
-    0xb0, 0xc, 0x0, 0x20, 0x0,
-
-    /* U+2B "+" */
-    0x1, 0x80, 0x0, 0x60, 0x0, 0x18, 0x2, 0xff,
-    0xfc, 0x1, 0xc0, 0x0, 0x60, 0x0, 0x18, 0x0,
-    0x6, 0x0,
-
-    /* U+2C "," */
-    0x24, 0xf1, 0x89, 0x30,
-
-    /* U+2D "-" */
-    0xff, 0xc0, 0x0,
-
-    /* U+2E "." */
-    0x0, 0xe3, 0x80,
-
-    /* U+2F "/" */
-    0x0, 0x9, 0x0, 0xc, 0x0, 0x1c, 0x0, 0x28,
-    0x0, 0x30, 0x0, 0x70, 0x0, 0xa0, 0x0, 0xc0,
-    0x1, 0xc0, 0x2, 0x80, 0x3, 0x0, 0x7, 0x0,
-    0xa, 0x0, 0xc, 0x0, 0x1c, 0x0, 0x28, 0x0,
-    0x30, 0x0, 0x70, 0x0,
-
-    /* U+30 "0" */
-    0x1, 0xbe, 0x0, 0x1e, 0x5b, 0x40, 0xd0, 0xb,
-    0xb, 0x0, 0xd, 0x34, 0x0, 0x2c, 0xd0, 0x0,
-    0x73, 0x40, 0x1, 0xcd, 0x0, 0x7, 0x34, 0x0,
-    0x2c, 0xb0, 0x0, 0xd0, 0xd0, 0x7, 0x1, 0xe5,
-    0xb4, 0x1, 0xbe, 0x0,
-
-    /* U+31 "1" */
-    0xff, 0x40, 0xd0, 0x34, 0xd, 0x3, 0x40, 0xd0,
-    0x34, 0xd, 0x3, 0x40, 0xd0, 0x34, 0xd, 0x3,
-    0x40,
-
-    /* U+32 "2" */
-    0xb, 0xf8, 0x7, 0x95, 0xb4, 0x10, 0x2, 0xc0,
-    0x0, 0x1c, 0x0, 0x2, 0xc0, 0x0, 0x34, 0x0,
-    0xa, 0x0, 0x2, 0xc0, 0x0, 0xb0, 0x0, 0x2c,
-    0x0, 0xb, 0x0, 0x2, 0xd0, 0x0, 0x7f, 0xff,
-    0xe0,
-
-    /* U+33 "3" */
-    0x7f, 0xff, 0xc0, 0x0, 0x74, 0x0, 0xd, 0x0,
-    0x3, 0x80, 0x0, 0xe0, 0x0, 0x1f, 0xd0, 0x0,
-    0xb, 0x80, 0x0, 0x1c, 0x0, 0x0, 0xc0, 0x0,
-    0xc, 0x50, 0x2, 0xcb, 0x95, 0xb4, 0xb, 0xf8,
-    0x0,
-
-    /* U+34 "4" */
-    0x0, 0x3, 0x40, 0x0, 0xe, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0x70, 0x0, 0x1, 0xc0, 0x0, 0x3,
-    0x40, 0x80, 0xe, 0x0, 0xc0, 0x2c, 0x0, 0xc0,
-    0x7f, 0xff, 0xfe, 0x0, 0x1, 0xd0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc0,
-
-    /* U+35 "5" */
-    0xf, 0xff, 0xc0, 0xc0, 0x0, 0x1c, 0x0, 0x1,
-    0xc0, 0x0, 0x28, 0x0, 0x2, 0xff, 0x90, 0x0,
-    0x1b, 0x80, 0x0, 0x1c, 0x0, 0x0, 0xd0, 0x0,
-    0xd, 0x10, 0x1, 0xc7, 0xd5, 0xb8, 0xb, 0xfd,
-    0x0,
-
-    /* U+36 "6" */
-    0x0, 0xbf, 0x90, 0x1e, 0x45, 0x40, 0xd0, 0x0,
-    0xb, 0x0, 0x0, 0x34, 0x0, 0x0, 0xd2, 0xfd,
-    0x3, 0x74, 0x6e, 0xf, 0x0, 0x1c, 0x3c, 0x0,
-    0x34, 0xb0, 0x0, 0xd0, 0xc0, 0x7, 0x2, 0xd0,
-    0x78, 0x1, 0xff, 0x40,
-
-    /* U+37 "7" */
-    0x7f, 0xff, 0xf7, 0x0, 0xe, 0x70, 0x0, 0xc6,
-    0x0, 0x28, 0x0, 0x3, 0x40, 0x0, 0xb0, 0x0,
-    0xd, 0x0, 0x1, 0xc0, 0x0, 0x38, 0x0, 0x7,
-    0x0, 0x0, 0xa0, 0x0, 0xc, 0x0, 0x2, 0xc0,
-    0x0,
-
-    /* U+38 "8" */
-    0x2, 0xff, 0x40, 0x39, 0x7, 0x82, 0xc0, 0x7,
-    0xa, 0x0, 0xc, 0xd, 0x1, 0xe0, 0xf, 0xfe,
-    0x0, 0xe4, 0x1e, 0xe, 0x0, 0xd, 0x34, 0x0,
-    0x38, 0xd0, 0x0, 0xe3, 0x80, 0x3, 0x47, 0x90,
-    0x78, 0x2, 0xff, 0x40,
-
-    /* U+39 "9" */
-    0x7, 0xfd, 0x0, 0xb4, 0x1d, 0x3, 0x0, 0xc,
-    0x1c, 0x0, 0x38, 0x70, 0x0, 0xf0, 0xf4, 0x1e,
-    0xc0, 0xbf, 0xd7, 0x0, 0x0, 0x1c, 0x0, 0x0,
-    0xb0, 0x0, 0x3, 0x40, 0x0, 0x2c, 0x6, 0x47,
-    0xd0, 0x1f, 0xf8, 0x0,
-
-    /* U+3A ":" */
-    0x38, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xe0,
-
-    /* U+3B ";" */
-    0x38, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xf1,
-    0x88, 0x20,
-
-    /* U+3C "<" */
-    0x0, 0x1, 0x0, 0x7, 0xc0, 0x2e, 0x41, 0xb8,
-    0x0, 0xb0, 0x0, 0xb, 0xd0, 0x0, 0x1f, 0x80,
-    0x0, 0x2c, 0x0, 0x0, 0x0,
-
-    /* U+3D "=" */
-    0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x0, 0x0, 0x0,
-
-    /* U+3E ">" */
-    0x40, 0x0, 0x2e, 0x0, 0x0, 0xb9, 0x0, 0x1,
-    0xf4, 0x0, 0xb, 0x0, 0x2e, 0x41, 0xf8, 0x2,
-    0xd0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+3F "?" */
-    0xb, 0xf8, 0x1e, 0x46, 0xd1, 0x0, 0x2c, 0x0,
-    0xb, 0x0, 0x3, 0x80, 0x2, 0xc0, 0x2, 0xc0,
-    0x1, 0xc0, 0x0, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0xe0, 0x0,
-
-    /* U+40 "@" */
-    0x0, 0xb, 0xff, 0x40, 0x0, 0xb, 0x80, 0x1b,
-    0x40, 0x3, 0x80, 0x0, 0xe, 0x0, 0xa0, 0x2f,
-    0x87, 0x34, 0xc, 0xe, 0x7, 0xb0, 0xc2, 0x83,
-    0x80, 0xf, 0x9, 0x30, 0x30, 0x0, 0xb0, 0x63,
-    0x7, 0x0, 0x7, 0x6, 0x30, 0x70, 0x0, 0x70,
-    0x63, 0x3, 0x0, 0xb, 0x6, 0x30, 0x38, 0x0,
-    0xf0, 0x92, 0x40, 0xe0, 0x77, 0x1c, 0xc, 0x2,
-    0xf8, 0x2f, 0x0, 0xa0, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x0, 0xb, 0x40, 0x18, 0x0,
-    0x0, 0xb, 0xfe, 0x40, 0x0,
-
-    /* U+41 "A" */
-    0x0, 0x1d, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x7,
-    0x30, 0x0, 0x3, 0x4a, 0x0, 0x0, 0xc0, 0xc0,
-    0x0, 0xa0, 0x28, 0x0, 0x30, 0x3, 0x0, 0x28,
-    0x0, 0xd0, 0xf, 0xff, 0xfc, 0x7, 0x0, 0x3,
-    0x43, 0x40, 0x0, 0xb1, 0xc0, 0x0, 0xc, 0xa0,
-    0x0, 0x2, 0x80,
-
-    /* U+42 "B" */
-    0xff, 0xfe, 0x3, 0x40, 0x1b, 0x4d, 0x0, 0xb,
-    0x34, 0x0, 0x1c, 0xd0, 0x0, 0xa3, 0x40, 0xb,
-    0xf, 0xff, 0xf8, 0x34, 0x0, 0x7c, 0xd0, 0x0,
-    0x37, 0x40, 0x0, 0xed, 0x0, 0x3, 0x74, 0x0,
-    0x7c, 0xff, 0xff, 0x80,
-
-    /* U+43 "C" */
-    0x0, 0x6f, 0xe4, 0x0, 0xb9, 0x5b, 0x80, 0xb0,
-    0x0, 0x10, 0x70, 0x0, 0x0, 0x28, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x3, 0x40, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x28, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0x0, 0xb0, 0x0, 0x10, 0xb, 0x95, 0xb8, 0x0,
-    0x6f, 0xe4, 0x0,
-
-    /* U+44 "D" */
-    0xff, 0xfe, 0x0, 0xe0, 0x16, 0xe0, 0xd0, 0x0,
-    0x78, 0xd0, 0x0, 0x1c, 0xd0, 0x0, 0xe, 0xd0,
-    0x0, 0x7, 0xd0, 0x0, 0x7, 0xd0, 0x0, 0x7,
-    0xd0, 0x0, 0xe, 0xd0, 0x0, 0x1c, 0xd0, 0x0,
-    0x38, 0xe0, 0x6, 0xe0, 0xff, 0xfe, 0x0,
-
-    /* U+45 "E" */
-    0xff, 0xff, 0xb8, 0x0, 0xd, 0x0, 0x3, 0x40,
-    0x0, 0xd0, 0x0, 0x34, 0x0, 0xf, 0xff, 0xf3,
-    0x80, 0x0, 0xd0, 0x0, 0x34, 0x0, 0xd, 0x0,
-    0x3, 0x80, 0x0, 0xff, 0xff, 0xc0,
-
-    /* U+46 "F" */
-    0xff, 0xff, 0xb8, 0x0, 0xd, 0x0, 0x3, 0x40,
-    0x0, 0xd0, 0x0, 0x34, 0x0, 0xf, 0xff, 0xf3,
-    0x80, 0x0, 0xd0, 0x0, 0x34, 0x0, 0xd, 0x0,
-    0x3, 0x40, 0x0, 0xd0, 0x0, 0x0,
-
-    /* U+47 "G" */
-    0x0, 0x6f, 0xe4, 0x0, 0xb9, 0x5b, 0xc0, 0xb0,
-    0x0, 0x10, 0x70, 0x0, 0x0, 0x28, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x3, 0x40, 0x0, 0x20, 0xd0,
-    0x0, 0xc, 0x28, 0x0, 0x3, 0x7, 0x0, 0x0,
-    0xc0, 0xb0, 0x0, 0x30, 0xb, 0x95, 0xbc, 0x0,
-    0x6f, 0xe4, 0x0,
-
-    /* U+48 "H" */
-    0xd0, 0x0, 0x2b, 0x40, 0x0, 0xad, 0x0, 0x2,
-    0xb4, 0x0, 0xa, 0xd0, 0x0, 0x2b, 0x40, 0x0,
-    0xaf, 0xff, 0xff, 0xb8, 0x0, 0xe, 0xd0, 0x0,
-    0x2b, 0x40, 0x0, 0xad, 0x0, 0x2, 0xb4, 0x0,
-    0xa, 0xd0, 0x0, 0x28,
-
-    /* U+49 "I" */
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd0,
-
-    /* U+4A "J" */
-    0xf, 0xff, 0x0, 0x1, 0xc0, 0x0, 0x30, 0x0,
-    0xc, 0x0, 0x3, 0x0, 0x0, 0xc0, 0x0, 0x30,
-    0x0, 0xc, 0x0, 0x3, 0x0, 0x1, 0xc1, 0x0,
-    0xb0, 0xf4, 0x74, 0xb, 0xf4, 0x0,
-
-    /* U+4B "K" */
-    0xd0, 0x0, 0xb3, 0x40, 0xb, 0xd, 0x0, 0xb0,
-    0x34, 0xb, 0x0, 0xd0, 0x70, 0x3, 0x47, 0x40,
-    0xd, 0x7d, 0x0, 0x3b, 0x6c, 0x0, 0xf4, 0x2c,
-    0x3, 0x80, 0x3c, 0xd, 0x0, 0x38, 0x34, 0x0,
-    0x34, 0xd0, 0x0, 0x74,
-
-    /* U+4C "L" */
-    0xd0, 0x0, 0x34, 0x0, 0xd, 0x0, 0x3, 0x40,
-    0x0, 0xd0, 0x0, 0x34, 0x0, 0xd, 0x0, 0x3,
-    0x40, 0x0, 0xd0, 0x0, 0x34, 0x0, 0xd, 0x0,
-    0x3, 0x80, 0x0, 0xff, 0xff, 0x40,
-
-    /* U+4D "M" */
-    0xd0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x3c, 0xf8,
-    0x0, 0x7, 0xce, 0xc0, 0x0, 0xdc, 0xda, 0x0,
-    0x1c, 0xcd, 0x34, 0x3, 0xc, 0xd1, 0xc0, 0xa0,
-    0xcd, 0xd, 0xc, 0xc, 0xd0, 0x72, 0x80, 0xcd,
-    0x3, 0xf0, 0xc, 0xd0, 0xd, 0x0, 0xcd, 0x0,
-    0x40, 0xc, 0xd0, 0x0, 0x0, 0xc0,
-
-    /* U+4E "N" */
-    0xe0, 0x0, 0x2b, 0xd0, 0x0, 0xaf, 0xc0, 0x2,
-    0xb7, 0xc0, 0xa, 0xd3, 0x80, 0x2b, 0x47, 0x40,
-    0xad, 0xb, 0x2, 0xb4, 0xb, 0xa, 0xd0, 0xe,
-    0x2b, 0x40, 0xd, 0xad, 0x0, 0x1f, 0xb4, 0x0,
-    0x2e, 0xd0, 0x0, 0x38,
-
-    /* U+4F "O" */
-    0x0, 0x6f, 0xe4, 0x0, 0xb, 0x95, 0xb8, 0x0,
-    0xb0, 0x0, 0x3c, 0x7, 0x0, 0x0, 0x34, 0x28,
-    0x0, 0x0, 0xb0, 0xd0, 0x0, 0x1, 0xc3, 0x40,
-    0x0, 0x3, 0xd, 0x0, 0x0, 0x1c, 0x28, 0x0,
-    0x0, 0xb0, 0x70, 0x0, 0x3, 0x40, 0xb0, 0x0,
-    0x3c, 0x0, 0xb9, 0x5b, 0x80, 0x0, 0x6f, 0xe4,
-    0x0,
-
-    /* U+50 "P" */
-    0xff, 0xfd, 0xe, 0x1, 0xb8, 0xd0, 0x0, 0xdd,
-    0x0, 0xb, 0xd0, 0x0, 0x7d, 0x0, 0xb, 0xd0,
-    0x0, 0xed, 0x0, 0x7c, 0xff, 0xfe, 0xe, 0x0,
-    0x0, 0xd0, 0x0, 0xd, 0x0, 0x0, 0xd0, 0x0,
-    0x0,
-
-    /* U+51 "Q" */
-    0x0, 0x6f, 0xe4, 0x0, 0xb, 0x95, 0xb8, 0x0,
-    0xb0, 0x0, 0x3c, 0x7, 0x0, 0x0, 0x34, 0x28,
-    0x0, 0x0, 0xb0, 0xd0, 0x0, 0x1, 0xc3, 0x40,
-    0x0, 0x3, 0xd, 0x0, 0x0, 0x1c, 0x38, 0x0,
-    0x0, 0xb0, 0x70, 0x0, 0x3, 0x40, 0xb0, 0x0,
-    0x3c, 0x0, 0xb9, 0x1b, 0xc0, 0x0, 0x6f, 0xe4,
-    0x0, 0x0, 0x3, 0x80, 0x50, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+52 "R" */
-    0xff, 0xfd, 0x3, 0x80, 0x6e, 0xd, 0x0, 0xd,
-    0x34, 0x0, 0x2c, 0xd0, 0x0, 0x73, 0x40, 0x2,
-    0xcd, 0x0, 0xe, 0x34, 0x1, 0xf0, 0xff, 0xfe,
-    0x3, 0x80, 0x38, 0xd, 0x0, 0x34, 0x34, 0x0,
-    0x70, 0xd0, 0x0, 0xa0,
-
-    /* U+53 "S" */
-    0x2, 0xff, 0x40, 0x3d, 0x17, 0x82, 0xc0, 0x0,
-    0xe, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x3d, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x1, 0xf4, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0xc1, 0x0, 0x7, 0xf, 0x91,
-    0xb4, 0x6, 0xfe, 0x40,
-
-    /* U+54 "T" */
-    0xff, 0xff, 0xf4, 0x2, 0xc0, 0x0, 0xb, 0x0,
-    0x0, 0x2c, 0x0, 0x0, 0xb0, 0x0, 0x2, 0xc0,
-    0x0, 0xb, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xb0,
-    0x0, 0x2, 0xc0, 0x0, 0xb, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0xb0, 0x0,
-
-    /* U+55 "U" */
-    0x34, 0x0, 0xd, 0x34, 0x0, 0xd, 0x34, 0x0,
-    0xd, 0x34, 0x0, 0xd, 0x34, 0x0, 0xd, 0x34,
-    0x0, 0xd, 0x34, 0x0, 0xd, 0x34, 0x0, 0xd,
-    0x34, 0x0, 0xc, 0x38, 0x0, 0x1c, 0x1c, 0x0,
-    0x38, 0xb, 0x95, 0xf0, 0x1, 0xff, 0x80,
-
-    /* U+56 "V" */
-    0xa0, 0x0, 0x3, 0x5c, 0x0, 0x1, 0xc3, 0x80,
-    0x0, 0xd0, 0x70, 0x0, 0x70, 0xd, 0x0, 0x38,
-    0x2, 0xc0, 0xc, 0x0, 0x34, 0xa, 0x0, 0xa,
-    0x3, 0x40, 0x1, 0xc1, 0xc0, 0x0, 0x38, 0xd0,
-    0x0, 0x7, 0x70, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x2c, 0x0, 0x0,
-
-    /* U+57 "W" */
-    0x30, 0x0, 0x2c, 0x0, 0xc, 0x38, 0x0, 0x3c,
-    0x0, 0x1c, 0x2c, 0x0, 0x7d, 0x0, 0x28, 0xc,
-    0x0, 0x97, 0x0, 0x30, 0xd, 0x0, 0xc3, 0x0,
-    0x70, 0xb, 0x1, 0xc3, 0x40, 0xa0, 0x3, 0x3,
-    0x41, 0xc0, 0xc0, 0x3, 0x43, 0x0, 0xc1, 0xc0,
-    0x2, 0xc7, 0x0, 0xd2, 0x80, 0x0, 0xcd, 0x0,
-    0x73, 0x0, 0x0, 0xec, 0x0, 0x3b, 0x0, 0x0,
-    0xbc, 0x0, 0x3e, 0x0, 0x0, 0x74, 0x0, 0x1d,
-    0x0,
-
-    /* U+58 "X" */
-    0x34, 0x0, 0x2c, 0x1c, 0x0, 0x70, 0xb, 0x0,
-    0xd0, 0x3, 0x83, 0x80, 0x0, 0xd7, 0x0, 0x0,
-    0x7d, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xae, 0x0,
-    0x1, 0xc7, 0x40, 0x3, 0x42, 0xc0, 0xe, 0x0,
-    0xe0, 0x2c, 0x0, 0x34, 0x70, 0x0, 0x1c,
-
-    /* U+59 "Y" */
-    0xa0, 0x0, 0xc, 0x34, 0x0, 0x38, 0x2c, 0x0,
-    0x70, 0xe, 0x0, 0xd0, 0x7, 0x2, 0x80, 0x2,
-    0x83, 0x0, 0x0, 0xde, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0x34, 0x0, 0x0, 0x34, 0x0, 0x0, 0x34,
-    0x0, 0x0, 0x34, 0x0, 0x0, 0x34, 0x0,
-
-    /* U+5A "Z" */
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0xe0, 0x0, 0x2, 0xc0, 0x0, 0x7, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x38, 0x0, 0x0, 0xb0, 0x0,
-    0x1, 0xc0, 0x0, 0x3, 0x40, 0x0, 0xe, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-
-    /* U+5B "[" */
-    0xfd, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xfd,
-
-    /* U+5C "\\" */
-    0x60, 0x0, 0x30, 0x0, 0x34, 0x0, 0x18, 0x0,
-    0xc, 0x0, 0xd, 0x0, 0x6, 0x0, 0x3, 0x0,
-    0x3, 0x40, 0x1, 0x80, 0x0, 0xc0, 0x0, 0xd0,
-    0x0, 0xa0, 0x0, 0x30, 0x0, 0x34, 0x0, 0x28,
-    0x0, 0xc, 0x0, 0xd,
-
-    /* U+5D "]" */
-    0xbe, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
-    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
-    0xa, 0xbe,
-
-    /* U+5E "^" */
-    0x2, 0xc0, 0x3, 0xd0, 0x6, 0x60, 0x9, 0x30,
-    0xc, 0x28, 0x28, 0xc, 0x30, 0xd, 0x70, 0x6,
-
-    /* U+5F "_" */
-    0xff, 0xff, 0xc0,
-
-    /* U+60 "`" */
-    0x20, 0x7, 0x0, 0x70,
-
-    /* U+61 "a" */
-    0x7, 0xfd, 0xb, 0x42, 0xd0, 0x0, 0x28, 0x0,
-    0x7, 0xb, 0xff, 0xcb, 0x0, 0x73, 0x40, 0x1c,
-    0xd0, 0xb, 0x2c, 0xb, 0xc2, 0xfd, 0x70,
-
-    /* U+62 "b" */
-    0x30, 0x0, 0x0, 0xc0, 0x0, 0x3, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x31, 0xfe, 0x0, 0xed, 0x1f,
-    0x3, 0xc0, 0xb, 0xd, 0x0, 0xc, 0x30, 0x0,
-    0x34, 0xc0, 0x0, 0xd3, 0x40, 0x3, 0xf, 0x0,
-    0x2c, 0x3b, 0x47, 0xc0, 0xc7, 0xf8, 0x0,
-
-    /* U+63 "c" */
-    0x1, 0xfe, 0x0, 0xf4, 0x6c, 0x2c, 0x0, 0x43,
-    0x40, 0x0, 0x30, 0x0, 0x3, 0x0, 0x0, 0x34,
-    0x0, 0x2, 0xc0, 0x4, 0xf, 0x46, 0xc0, 0x1f,
-    0xe0,
-
-    /* U+64 "d" */
-    0x0, 0x0, 0x34, 0x0, 0x0, 0xd0, 0x0, 0x3,
-    0x40, 0x0, 0xd, 0x2, 0xfe, 0x34, 0x3d, 0x1a,
-    0xd2, 0xc0, 0xb, 0x4d, 0x0, 0xd, 0x30, 0x0,
-    0x34, 0xc0, 0x0, 0xd3, 0x40, 0x3, 0x4b, 0x0,
-    0x2d, 0xf, 0x42, 0xf4, 0xb, 0xf8, 0xd0,
-
-    /* U+65 "e" */
-    0x2, 0xfe, 0x0, 0x3d, 0x1f, 0x2, 0x80, 0xe,
-    0xd, 0x0, 0x1c, 0x3f, 0xff, 0xf0, 0xc0, 0x0,
-    0x3, 0x40, 0x0, 0xb, 0x0, 0x10, 0xf, 0x46,
-    0xc0, 0x7, 0xf8, 0x0,
-
-    /* U+66 "f" */
-    0x2, 0xf4, 0x2c, 0x0, 0xd0, 0x3, 0x0, 0xbf,
-    0xf0, 0x34, 0x0, 0xd0, 0x3, 0x40, 0xd, 0x0,
-    0x34, 0x0, 0xd0, 0x3, 0x40, 0xd, 0x0, 0x34,
-    0x0,
-
-    /* U+67 "g" */
-    0x2, 0xfe, 0x28, 0x3d, 0x1b, 0xa2, 0xc0, 0xb,
-    0x8d, 0x0, 0xe, 0x30, 0x0, 0x28, 0xc0, 0x0,
-    0xa3, 0x40, 0x3, 0x8b, 0x0, 0x2e, 0xf, 0x46,
-    0xf8, 0x7, 0xf8, 0xe0, 0x0, 0x3, 0x40, 0x0,
-    0x1c, 0x1e, 0x46, 0xe0, 0xb, 0xfd, 0x0,
-
-    /* U+68 "h" */
-    0x30, 0x0, 0x3, 0x0, 0x0, 0x30, 0x0, 0x3,
-    0x0, 0x0, 0x31, 0xfe, 0x3, 0xb5, 0x78, 0x3c,
-    0x1, 0xc3, 0x40, 0xd, 0x30, 0x0, 0xd3, 0x0,
-    0xe, 0x30, 0x0, 0xe3, 0x0, 0xe, 0x30, 0x0,
-    0xe3, 0x0, 0xe,
-
-    /* U+69 "i" */
-    0x71, 0xc0, 0x0, 0x30, 0xc3, 0xc, 0x30, 0xc3,
-    0xc, 0x30, 0xc0,
-
-    /* U+6A "j" */
-    0x0, 0xd0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0,
-    0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0,
-    0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc,
-    0x12, 0xc7, 0xe0,
-
-    /* U+6B "k" */
-    0x30, 0x0, 0x3, 0x0, 0x0, 0x30, 0x0, 0x3,
-    0x0, 0x0, 0x30, 0x3, 0xc3, 0x0, 0xf0, 0x30,
-    0x3c, 0x3, 0xf, 0x0, 0x33, 0xe0, 0x3, 0xe7,
-    0x40, 0x38, 0x2c, 0x3, 0x0, 0xf0, 0x30, 0x3,
-    0x83, 0x0, 0x1d,
-
-    /* U+6C "l" */
-    0x30, 0xc3, 0xc, 0x30, 0xc3, 0xc, 0x30, 0xc3,
-    0xc, 0x30, 0xc0,
-
-    /* U+6D "m" */
-    0x32, 0xfd, 0x7, 0xf8, 0xe, 0x91, 0xeb, 0x47,
-    0x83, 0x80, 0x1f, 0x0, 0x70, 0xc0, 0x3, 0x40,
-    0xd, 0x30, 0x0, 0xd0, 0x3, 0x4c, 0x0, 0x30,
-    0x0, 0xd3, 0x0, 0xc, 0x0, 0x34, 0xc0, 0x3,
-    0x0, 0xd, 0x30, 0x0, 0xc0, 0x3, 0x4c, 0x0,
-    0x30, 0x0, 0xd0,
-
-    /* U+6E "n" */
-    0x31, 0xfe, 0x3, 0xa4, 0x78, 0x38, 0x0, 0xc3,
-    0x40, 0xd, 0x30, 0x0, 0xd3, 0x0, 0xe, 0x30,
-    0x0, 0xe3, 0x0, 0xe, 0x30, 0x0, 0xe3, 0x0,
-    0xe,
-
-    /* U+6F "o" */
-    0x1, 0xfe, 0x0, 0x3d, 0x1b, 0x2, 0xc0, 0xb,
-    0xd, 0x0, 0xc, 0x30, 0x0, 0x34, 0xc0, 0x0,
-    0xd3, 0x40, 0x3, 0xb, 0x0, 0x2c, 0xf, 0x46,
-    0xc0, 0x7, 0xf8, 0x0,
-
-    /* U+70 "p" */
-    0x31, 0xfe, 0x0, 0xed, 0x1b, 0x3, 0xc0, 0xb,
-    0xd, 0x0, 0xc, 0x30, 0x0, 0x34, 0xc0, 0x0,
-    0xd3, 0x40, 0x3, 0xf, 0x0, 0x2c, 0x3b, 0x47,
-    0xc0, 0xc7, 0xf8, 0x3, 0x0, 0x0, 0xc, 0x0,
-    0x0, 0x30, 0x0, 0x0, 0xc0, 0x0, 0x0,
-
-    /* U+71 "q" */
-    0x2, 0xfe, 0x34, 0x3d, 0x1b, 0xd2, 0xc0, 0xb,
-    0x4d, 0x0, 0xd, 0x30, 0x0, 0x34, 0xc0, 0x0,
-    0xd3, 0x40, 0x3, 0x4b, 0x0, 0x2d, 0xf, 0x46,
-    0xf4, 0xb, 0xf8, 0xd0, 0x0, 0x3, 0x40, 0x0,
-    0xd, 0x0, 0x0, 0x34, 0x0, 0x0, 0xd0,
-
-    /* U+72 "r" */
-    0x32, 0xe3, 0xb4, 0x3c, 0x3, 0x40, 0x30, 0x3,
-    0x0, 0x30, 0x3, 0x0, 0x30, 0x3, 0x0,
-
-    /* U+73 "s" */
-    0xb, 0xf9, 0xf, 0x46, 0x83, 0x0, 0x0, 0xd0,
-    0x0, 0x1f, 0x90, 0x0, 0x6f, 0x40, 0x0, 0x70,
-    0x0, 0xc, 0x79, 0x1f, 0x6, 0xfe, 0x0,
-
-    /* U+74 "t" */
-    0xd, 0x0, 0x34, 0xb, 0xff, 0x3, 0x40, 0xd,
-    0x0, 0x34, 0x0, 0xd0, 0x3, 0x40, 0xd, 0x0,
-    0x34, 0x0, 0xb1, 0x40, 0xbd,
-
-    /* U+75 "u" */
-    0x70, 0x0, 0xd7, 0x0, 0xd, 0x70, 0x0, 0xd7,
-    0x0, 0xd, 0x70, 0x0, 0xd7, 0x0, 0xd, 0x70,
-    0x0, 0xd3, 0x40, 0x2d, 0x2d, 0xb, 0xd0, 0x7f,
-    0x8d,
-
-    /* U+76 "v" */
-    0xe0, 0x0, 0xa7, 0x0, 0xc, 0x34, 0x2, 0x82,
-    0xc0, 0x34, 0xc, 0x7, 0x0, 0xa0, 0xd0, 0x7,
-    0x1c, 0x0, 0x36, 0x80, 0x1, 0xf0, 0x0, 0xe,
-    0x0,
-
-    /* U+77 "w" */
-    0xa0, 0x3, 0x80, 0x9, 0x70, 0x3, 0xc0, 0xc,
-    0x30, 0xa, 0xd0, 0x1c, 0x28, 0xd, 0x60, 0x24,
-    0x1c, 0xc, 0x30, 0x30, 0xd, 0x28, 0x34, 0x60,
-    0xa, 0x30, 0x1c, 0xd0, 0x3, 0x70, 0xd, 0xc0,
-    0x3, 0xd0, 0xb, 0x80, 0x1, 0xc0, 0x7, 0x40,
-
-    /* U+78 "x" */
-    0x34, 0x2, 0x81, 0xc0, 0x70, 0xb, 0xc, 0x0,
-    0x3b, 0x40, 0x0, 0xf0, 0x0, 0x1f, 0x0, 0x3,
-    0x68, 0x0, 0xe0, 0xd0, 0x2c, 0x7, 0x7, 0x0,
-    0x2c,
-
-    /* U+79 "y" */
-    0x38, 0x0, 0x28, 0x70, 0x0, 0xc0, 0xd0, 0xa,
-    0x2, 0xc0, 0x34, 0x3, 0x1, 0xc0, 0xa, 0xd,
-    0x0, 0x1c, 0x30, 0x0, 0x36, 0x80, 0x0, 0x7c,
-    0x0, 0x0, 0xf0, 0x0, 0x3, 0x40, 0x0, 0x1c,
-    0x0, 0x21, 0xd0, 0x0, 0xbd, 0x0, 0x0,
-
-    /* U+7A "z" */
-    0x3f, 0xff, 0x40, 0x2, 0xc0, 0x1, 0xc0, 0x0,
-    0xd0, 0x0, 0xe0, 0x0, 0xb0, 0x0, 0x70, 0x0,
-    0x34, 0x0, 0x3c, 0x0, 0xf, 0xff, 0xd0,
-
-    /* U+7B "{" */
-    0xb, 0x87, 0x41, 0xc0, 0xb0, 0x2c, 0xb, 0x2,
-    0xc0, 0xb0, 0x28, 0x3d, 0x2, 0x80, 0xb0, 0x2c,
-    0xb, 0x2, 0xc0, 0x70, 0x1d, 0x2, 0xe0,
-
-    /* U+7C "|" */
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc,
-
-    /* U+7D "}" */
-    0xb8, 0x7, 0x40, 0xd0, 0x38, 0xe, 0x3, 0x80,
-    0xe0, 0x38, 0xa, 0x0, 0xf0, 0xb0, 0x38, 0xe,
-    0x3, 0x80, 0xe0, 0x38, 0x1d, 0x2e, 0x0,
-
-    /* U+7E "~" */
-    0x2e, 0x2, 0x28, 0xb0, 0xcc, 0x7, 0xd0,
-
-    /* U+A9 "©" */
-    0x0, 0x2a, 0x90, 0x0, 0x18, 0x1, 0x80, 0x5,
-    0x0, 0x2, 0x0, 0x81, 0xfd, 0x8, 0x20, 0xb0,
-    0x70, 0x82, 0xc, 0x0, 0x1, 0x21, 0xc0, 0x0,
-    0x22, 0x1c, 0x0, 0x2, 0x20, 0xc0, 0x0, 0x12,
-    0xb, 0x3, 0x8, 0x8, 0x1f, 0xd0, 0x80, 0x50,
-    0x0, 0x20, 0x1, 0x80, 0x18, 0x0, 0x2, 0xa9,
-    0x0,
-
-    /* U+AA "ª" */
-    0x2a, 0xc0, 0x3, 0x1a, 0xb3, 0x3, 0x30, 0x71,
-    0xa6,
-
-    /* U+AE "®" */
-    0x0, 0x2a, 0x90, 0x0, 0x18, 0x1, 0x80, 0x5,
-    0x0, 0x2, 0x0, 0x83, 0xf9, 0x8, 0x20, 0x20,
-    0x30, 0x82, 0x2, 0x1, 0x41, 0x20, 0x20, 0x24,
-    0x22, 0x2, 0x3, 0x2, 0x20, 0x3f, 0xd0, 0x12,
-    0x2, 0x9, 0x8, 0x8, 0x20, 0x30, 0x80, 0x50,
-    0x0, 0x20, 0x1, 0x80, 0x18, 0x0, 0x2, 0xa9,
-    0x0,
-
-    /* U+B1 "±" */
-    0x1, 0x80, 0x0, 0x60, 0x0, 0x18, 0x2, 0xff,
-    0xfc, 0x1, 0xc0, 0x0, 0x60, 0x0, 0x18, 0x0,
-    0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf0,
-
-    /* U+B2 "²" */
-    0x2f, 0xd0, 0x40, 0xd0, 0x3, 0x40, 0x28, 0x2,
-    0x40, 0x34, 0x3, 0xff, 0x80,
-
-    /* U+BA "º" */
-    0xb, 0xd0, 0xc0, 0x96, 0x0, 0xd8, 0x3, 0x34,
-    0x24, 0x2f, 0x40,
-
-    /* U+C0 "À" */
-    0x0, 0x40, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x7, 0x30, 0x0, 0x3,
-    0x4a, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0xa0, 0x28,
-    0x0, 0x30, 0x3, 0x0, 0x28, 0x0, 0xd0, 0xf,
-    0xff, 0xfc, 0x7, 0x0, 0x3, 0x43, 0x40, 0x0,
-    0xb1, 0xc0, 0x0, 0xc, 0xa0, 0x0, 0x2, 0x80,
-
-    /* U+C1 "Á" */
-    0x0, 0x1, 0x40, 0x0, 0x1, 0xc0, 0x0, 0x0,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x7, 0x30, 0x0, 0x3,
-    0x4a, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0xa0, 0x28,
-    0x0, 0x30, 0x3, 0x0, 0x28, 0x0, 0xd0, 0xf,
-    0xff, 0xfc, 0x7, 0x0, 0x3, 0x43, 0x40, 0x0,
-    0xb1, 0xc0, 0x0, 0xc, 0xa0, 0x0, 0x2, 0x80,
-
-    /* U+C2 "Â" */
-    0x0, 0x8, 0x0, 0x0, 0x1d, 0xd0, 0x0, 0x4,
-    0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x7, 0x30, 0x0, 0x3,
-    0x4a, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0xa0, 0x28,
-    0x0, 0x30, 0x3, 0x0, 0x28, 0x0, 0xd0, 0xf,
-    0xff, 0xfc, 0x7, 0x0, 0x3, 0x43, 0x40, 0x0,
-    0xb1, 0xc0, 0x0, 0xc, 0xa0, 0x0, 0x2, 0x80,
-
-    /* U+C3 "Ã" */
-    0x0, 0xb0, 0x40, 0x0, 0x22, 0x30, 0x0, 0x14,
-    0x34, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x7, 0x30, 0x0, 0x3,
-    0x4a, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0xa0, 0x28,
-    0x0, 0x30, 0x3, 0x0, 0x28, 0x0, 0xd0, 0xf,
-    0xff, 0xfc, 0x7, 0x0, 0x3, 0x43, 0x40, 0x0,
-    0xb1, 0xc0, 0x0, 0xc, 0xa0, 0x0, 0x2, 0x80,
-
-    /* U+C7 "Ç" */
-    0x0, 0x6f, 0xe4, 0x0, 0xb9, 0x5b, 0x80, 0xb0,
-    0x0, 0x10, 0x70, 0x0, 0x0, 0x28, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x3, 0x40, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x28, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0x0, 0xb0, 0x0, 0x10, 0xb, 0x95, 0xb8, 0x0,
-    0x6f, 0xe4, 0x0, 0x1, 0x80, 0x0, 0x0, 0x28,
-    0x0, 0x0, 0x3, 0x0, 0x0, 0x1f, 0x40, 0x0,
-
-    /* U+C9 "É" */
-    0x0, 0x14, 0x0, 0x2c, 0x0, 0x4, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xb8, 0x0, 0xd, 0x0, 0x3,
-    0x40, 0x0, 0xd0, 0x0, 0x34, 0x0, 0xf, 0xff,
-    0xf3, 0x80, 0x0, 0xd0, 0x0, 0x34, 0x0, 0xd,
-    0x0, 0x3, 0x80, 0x0, 0xff, 0xff, 0xc0,
-
-    /* U+CA "Ê" */
-    0x1, 0x80, 0x1, 0xdd, 0x0, 0x40, 0x40, 0x0,
-    0x0, 0xff, 0xff, 0xb8, 0x0, 0xd, 0x0, 0x3,
-    0x40, 0x0, 0xd0, 0x0, 0x34, 0x0, 0xf, 0xff,
-    0xf3, 0x80, 0x0, 0xd0, 0x0, 0x34, 0x0, 0xd,
-    0x0, 0x3, 0x80, 0x0, 0xff, 0xff, 0xc0,
-
-    /* U+CD "Í" */
-    0x1, 0x7, 0x41, 0x0, 0x0, 0x34, 0xd, 0x3,
-    0x40, 0xd0, 0x34, 0xd, 0x3, 0x40, 0xd0, 0x34,
-    0xd, 0x3, 0x40, 0xd0, 0x34, 0x0,
-
-    /* U+D3 "Ó" */
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe4, 0x0, 0xb, 0x95, 0xb8, 0x0, 0xb0,
-    0x0, 0x3c, 0x7, 0x0, 0x0, 0x34, 0x28, 0x0,
-    0x0, 0xb0, 0xd0, 0x0, 0x1, 0xc3, 0x40, 0x0,
-    0x3, 0xd, 0x0, 0x0, 0x1c, 0x28, 0x0, 0x0,
-    0xb0, 0x70, 0x0, 0x3, 0x40, 0xb0, 0x0, 0x3c,
-    0x0, 0xb9, 0x5b, 0x80, 0x0, 0x6f, 0xe4, 0x0,
-
-    /* U+D4 "Ô" */
-    0x0, 0x2, 0x0, 0x0, 0x0, 0x77, 0x40, 0x0,
-    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe4, 0x0, 0xb, 0x95, 0xb8, 0x0, 0xb0,
-    0x0, 0x3c, 0x7, 0x0, 0x0, 0x34, 0x28, 0x0,
-    0x0, 0xb0, 0xd0, 0x0, 0x1, 0xc3, 0x40, 0x0,
-    0x3, 0xd, 0x0, 0x0, 0x1c, 0x28, 0x0, 0x0,
-    0xb0, 0x70, 0x0, 0x3, 0x40, 0xb0, 0x0, 0x3c,
-    0x0, 0xb9, 0x5b, 0x80, 0x0, 0x6f, 0xe4, 0x0,
-
-    /* U+D5 "Õ" */
-    0x0, 0x1c, 0x14, 0x0, 0x0, 0xc8, 0x80, 0x0,
-    0x1, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe4, 0x0, 0xb, 0x95, 0xb8, 0x0, 0xb0,
-    0x0, 0x3c, 0x7, 0x0, 0x0, 0x34, 0x28, 0x0,
-    0x0, 0xb0, 0xd0, 0x0, 0x1, 0xc3, 0x40, 0x0,
-    0x3, 0xd, 0x0, 0x0, 0x1c, 0x28, 0x0, 0x0,
-    0xb0, 0x70, 0x0, 0x3, 0x40, 0xb0, 0x0, 0x3c,
-    0x0, 0xb9, 0x5b, 0x80, 0x0, 0x6f, 0xe4, 0x0,
-
-    /* U+DA "Ú" */
-    0x0, 0x1, 0x40, 0x0, 0xa, 0x0, 0x0, 0x14,
-    0x0, 0x0, 0x0, 0x0, 0x34, 0x0, 0xd, 0x34,
-    0x0, 0xd, 0x34, 0x0, 0xd, 0x34, 0x0, 0xd,
-    0x34, 0x0, 0xd, 0x34, 0x0, 0xd, 0x34, 0x0,
-    0xd, 0x34, 0x0, 0xd, 0x34, 0x0, 0xc, 0x38,
-    0x0, 0x1c, 0x1c, 0x0, 0x38, 0xb, 0x95, 0xf0,
-    0x1, 0xff, 0x80,
-
-    /* U+E0 "à" */
-    0x7, 0x40, 0x0, 0x34, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0xb, 0x42, 0xd0, 0x0, 0x28,
-    0x0, 0x7, 0xb, 0xff, 0xcb, 0x0, 0x73, 0x40,
-    0x1c, 0xd0, 0xb, 0x2c, 0xb, 0xc2, 0xfd, 0x70,
-
-    /* U+E1 "á" */
-    0x0, 0xe, 0x0, 0xd, 0x0, 0x4, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0xb, 0x42, 0xd0, 0x0, 0x28,
-    0x0, 0x7, 0xb, 0xff, 0xcb, 0x0, 0x73, 0x40,
-    0x1c, 0xd0, 0xb, 0x2c, 0xb, 0xc2, 0xfd, 0x70,
-
-    /* U+E2 "â" */
-    0x0, 0xf4, 0x0, 0xd3, 0x0, 0x50, 0x10, 0x0,
-    0x0, 0x7, 0xfd, 0xb, 0x42, 0xd0, 0x0, 0x28,
-    0x0, 0x7, 0xb, 0xff, 0xcb, 0x0, 0x73, 0x40,
-    0x1c, 0xd0, 0xb, 0x2c, 0xb, 0xc2, 0xfd, 0x70,
-
-    /* U+E3 "ã" */
-    0x3, 0xc3, 0x2, 0xb, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0xb, 0x42, 0xd0, 0x0, 0x28,
-    0x0, 0x7, 0xb, 0xff, 0xcb, 0x0, 0x73, 0x40,
-    0x1c, 0xd0, 0xb, 0x2c, 0xb, 0xc2, 0xfd, 0x70,
-
-    /* U+E7 "ç" */
-    0x1, 0xfe, 0x0, 0xf4, 0x6c, 0x2c, 0x0, 0x43,
-    0x40, 0x0, 0x30, 0x0, 0x3, 0x0, 0x0, 0x34,
-    0x0, 0x2, 0xc0, 0x4, 0xf, 0x46, 0xc0, 0x1f,
-    0xe0, 0x0, 0x20, 0x0, 0x2, 0x80, 0x0, 0xc,
-    0x0, 0x1f, 0x40,
-
-    /* U+E9 "é" */
-    0x0, 0xb, 0x0, 0x0, 0xa0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x3d, 0x1f,
-    0x2, 0x80, 0xe, 0xd, 0x0, 0x1c, 0x3f, 0xff,
-    0xf0, 0xc0, 0x0, 0x3, 0x40, 0x0, 0xb, 0x0,
-    0x10, 0xf, 0x46, 0xc0, 0x7, 0xf8, 0x0,
-
-    /* U+EA "ê" */
-    0x0, 0xb8, 0x0, 0xa, 0x28, 0x0, 0x10, 0x10,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x3d, 0x1f,
-    0x2, 0x80, 0xe, 0xd, 0x0, 0x1c, 0x3f, 0xff,
-    0xf0, 0xc0, 0x0, 0x3, 0x40, 0x0, 0xb, 0x0,
-    0x10, 0xf, 0x46, 0xc0, 0x7, 0xf8, 0x0,
-
-    /* U+ED "í" */
-    0xb, 0xe, 0x1, 0x0, 0x0, 0x30, 0xc, 0x3,
-    0x0, 0xc0, 0x30, 0xc, 0x3, 0x0, 0xc0, 0x30,
-    0xc, 0x0,
-
-    /* U+F3 "ó" */
-    0x0, 0xb, 0x0, 0x0, 0xb0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x3d, 0x1b,
-    0x2, 0xc0, 0xb, 0xd, 0x0, 0xc, 0x30, 0x0,
-    0x34, 0xc0, 0x0, 0xd3, 0x40, 0x3, 0xb, 0x0,
-    0x2c, 0xf, 0x46, 0xc0, 0x7, 0xf8, 0x0,
-
-    /* U+F4 "ô" */
-    0x0, 0x78, 0x0, 0x7, 0x28, 0x0, 0x10, 0x10,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x3d, 0x1b,
-    0x2, 0xc0, 0xb, 0xd, 0x0, 0xc, 0x30, 0x0,
-    0x34, 0xc0, 0x0, 0xd3, 0x40, 0x3, 0xb, 0x0,
-    0x2c, 0xf, 0x46, 0xc0, 0x7, 0xf8, 0x0,
-
-    /* U+F5 "õ" */
-    0x2, 0xe1, 0x40, 0x8, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x3d, 0x1b,
-    0x2, 0xc0, 0xb, 0xd, 0x0, 0xc, 0x30, 0x0,
-    0x34, 0xc0, 0x0, 0xd3, 0x40, 0x3, 0xb, 0x0,
-    0x2c, 0xf, 0x46, 0xc0, 0x7, 0xf8, 0x0,
-
-    /* U+FA "ú" */
-    0x0, 0xd, 0x0, 0x7, 0x40, 0x0, 0x40, 0x0,
-    0x0, 0x0, 0x70, 0x0, 0xd7, 0x0, 0xd, 0x70,
-    0x0, 0xd7, 0x0, 0xd, 0x70, 0x0, 0xd7, 0x0,
-    0xd, 0x70, 0x0, 0xd3, 0x40, 0x2d, 0x2d, 0xb,
-    0xd0, 0x7f, 0x8d,
-
-    /* U+20AC "€" */
-    0x0, 0xb, 0xfe, 0x0, 0xb, 0xd5, 0x6d, 0x2,
-    0xd0, 0x0, 0x0, 0x34, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x3, 0x40, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x80, 0x3,
-    0xd5, 0x7c, 0x0, 0x7, 0xfe, 0x0,
-
-    /* U+2122 "™" */
-    0x6a, 0xa4, 0x40, 0x1, 0x15, 0xd4, 0x34, 0x1,
-    0xc0, 0x30, 0xf, 0x0, 0xf0, 0xc, 0x3, 0x60,
-    0x9c, 0x3, 0x0, 0xcc, 0x23, 0x0, 0xc0, 0x30,
-    0xe0, 0xc0, 0x30, 0xc, 0x28, 0x30, 0xc, 0x3,
-    0x0, 0xc
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 75, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 75, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10, .adv_w = 107, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 17, .adv_w = 200, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 56, .adv_w = 177, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 106, .adv_w = 239, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 155, .adv_w = 193, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 197, .adv_w = 58, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 200, .adv_w = 95, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 223, .adv_w = 95, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 246, .adv_w = 111, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 259, .adv_w = 166, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 277, .adv_w = 61, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 281, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 284, .adv_w = 61, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 287, .adv_w = 96, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 323, .adv_w = 191, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 359, .adv_w = 104, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 376, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 409, .adv_w = 162, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 442, .adv_w = 190, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 481, .adv_w = 163, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 514, .adv_w = 175, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 550, .adv_w = 170, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 583, .adv_w = 184, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 619, .adv_w = 175, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 655, .adv_w = 61, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 663, .adv_w = 61, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 673, .adv_w = 166, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 694, .adv_w = 166, .box_w = 9, .box_h = 6, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 708, .adv_w = 166, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 729, .adv_w = 163, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 759, .adv_w = 298, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 836, .adv_w = 206, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 879, .adv_w = 217, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 915, .adv_w = 207, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 958, .adv_w = 238, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 997, .adv_w = 193, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1027, .adv_w = 182, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1057, .adv_w = 223, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1100, .adv_w = 234, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1136, .adv_w = 87, .box_w = 2, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1143, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1173, .adv_w = 205, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1209, .adv_w = 170, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1239, .adv_w = 275, .box_w = 14, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1285, .adv_w = 234, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1321, .adv_w = 242, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1370, .adv_w = 207, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1403, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1463, .adv_w = 208, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1499, .adv_w = 177, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1535, .adv_w = 165, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1571, .adv_w = 228, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1610, .adv_w = 201, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1653, .adv_w = 320, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1718, .adv_w = 189, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1757, .adv_w = 183, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1796, .adv_w = 187, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1835, .adv_w = 92, .box_w = 4, .box_h = 18, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 1853, .adv_w = 96, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 1889, .adv_w = 92, .box_w = 4, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1907, .adv_w = 166, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1923, .adv_w = 144, .box_w = 9, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1926, .adv_w = 173, .box_w = 5, .box_h = 3, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 1930, .adv_w = 170, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1953, .adv_w = 195, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1992, .adv_w = 162, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2017, .adv_w = 195, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2056, .adv_w = 174, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2084, .adv_w = 98, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2109, .adv_w = 198, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2148, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2183, .adv_w = 77, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2194, .adv_w = 79, .box_w = 6, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 2221, .adv_w = 173, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2256, .adv_w = 77, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2267, .adv_w = 306, .box_w = 17, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2310, .adv_w = 195, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2335, .adv_w = 181, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2363, .adv_w = 195, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2402, .adv_w = 195, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2441, .adv_w = 115, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2456, .adv_w = 141, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2479, .adv_w = 117, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2500, .adv_w = 194, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2525, .adv_w = 156, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2550, .adv_w = 253, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2590, .adv_w = 154, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2615, .adv_w = 156, .box_w = 11, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 2654, .adv_w = 147, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2677, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2700, .adv_w = 85, .box_w = 2, .box_h = 18, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 2709, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2732, .adv_w = 166, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2739, .adv_w = 233, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2788, .adv_w = 115, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 2797, .adv_w = 233, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2846, .adv_w = 166, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2871, .adv_w = 124, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 2884, .adv_w = 119, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 2895, .adv_w = 206, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2951, .adv_w = 206, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3007, .adv_w = 206, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3063, .adv_w = 206, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3119, .adv_w = 207, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 3175, .adv_w = 193, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3214, .adv_w = 193, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3253, .adv_w = 87, .box_w = 5, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3275, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3339, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3403, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3467, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3518, .adv_w = 170, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3550, .adv_w = 170, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3582, .adv_w = 170, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3614, .adv_w = 170, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3646, .adv_w = 162, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 3681, .adv_w = 174, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3720, .adv_w = 174, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3759, .adv_w = 77, .box_w = 5, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3777, .adv_w = 181, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3816, .adv_w = 181, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3855, .adv_w = 181, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3894, .adv_w = 194, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3929, .adv_w = 231, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3975, .adv_w = 294, .box_w = 17, .box_h = 8, .ofs_x = 0, .ofs_y = 5}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x1, 0x5, 0x8, 0x9, 0x11, 0x17, 0x18,
-    0x19, 0x1a, 0x1e, 0x20, 0x21, 0x24, 0x2a, 0x2b,
-    0x2c, 0x31, 0x37, 0x38, 0x39, 0x3a, 0x3e, 0x40,
-    0x41, 0x44, 0x4a, 0x4b, 0x4c, 0x51, 0x2003, 0x2079
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 169, .range_length = 8314, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    22, 8, 22, 0, 0, 8, 23, 23,
-    23, 23, 25, 26, 26, 29, 22, 22,
-    22, 30, 45, 45, 45, 45, 47, 49,
-    49, 51, 46, 46, 46, 51, 25, 61
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    23, 8, 23, 0, 0, 8, 24, 24,
-    24, 24, 23, 25, 25, 25, 23, 23,
-    23, 28, 37, 37, 37, 37, 39, 39,
-    39, 42, 39, 39, 39, 45, 49, 50
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 3, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 1, 13, 0, 8, -7, 0,
-    0, 0, 0, -16, -17, 2, 14, 7,
-    5, -12, 2, 15, 1, 13, 3, 10,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 17, 1, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -6, 11, 0, -9, 0, 0,
-    0, 0, 0, -6, 5, 6, 0, 0,
-    -3, 0, -2, 3, 0, -3, 0, -3,
-    -1, -6, 0, 0, 0, 0, -3, 0,
-    0, -4, -4, 0, 0, -3, 0, -6,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -3, -3, 0, 0, 0, 0, -8,
-    0, -34, 0, 0, -6, 0, 6, 9,
-    0, 0, -6, 3, 3, 10, 6, -5,
-    6, 0, 0, -17, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -11,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, -15, 0, -12, -2, 0, 0, 0,
-    0, 1, 12, 0, -9, -1, -1, 1,
-    0, -5, 0, 0, -2, -22, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -23, -1, 13, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -9, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 9, 0, 3, 0,
-    0, -6, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 10, 1, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -11, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 2, 6,
-    3, 9, -3, 0, 0, 6, -3, -9,
-    -40, 2, 8, 6, 1, -4, 0, 12,
-    0, 10, 0, 10, 0, -26, 0, -3,
-    9, 0, 10, -3, 6, 3, 0, 0,
-    1, -3, 0, 0, -5, 23, 0, 23,
-    0, 9, 0, 13, 3, 5, 2, 12,
-    0, 0, 0, -11, 0, 0, 0, 0,
-    1, -2, 0, 2, -5, -3, -6, 2,
-    0, -3, 0, 0, 0, -12, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -19, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    2, -6, 1, -16, 0, -18, 0, 0,
-    0, 0, -2, 0, 30, -3, -3, 3,
-    3, -4, 0, -3, 3, 0, 0, -15,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -28, 0, 3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -12, 0, 17, 0, 0,
-    -11, 0, 9, 0, -19, -28, -19, -6,
-    9, 0, 0, -20, 0, 4, -6, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 9, 9, -36,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 14, 0, 2,
-    0, 0, 0, 0, 0, 2, 2, -3,
-    -6, 0, -1, -1, -3, 0, 0, -2,
-    0, 0, 0, -6, 0, -2, 0, -6,
-    -6, 0, -7, -9, -9, -6, 0, -6,
-    0, -6, 0, 0, 0, 0, -2, 0,
-    0, 3, 0, 2, -3, 0, 0, 0,
-    0, 0, 0, 3, -2, 0, 0, 0,
-    -2, 3, 3, -1, 0, 0, 0, -7,
-    0, -1, 0, 0, 0, 0, 0, 1,
-    0, 3, -2, 0, -3, 0, -5, 0,
-    0, -2, 0, 9, 0, 0, -3, 0,
-    0, 0, 0, 0, -1, 1, -2, -2,
-    0, 0, 0, -3, 0, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    -1, 0, -3, -4, 0, 0, 0, 0,
-    0, 1, 0, 0, -2, 0, -3, -3,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, -2,
-    -3, 0, 0, 0, 0, -9, -2, -9,
-    6, 0, 0, -6, 3, 6, 8, 0,
-    -7, -1, -4, 0, -1, -14, 3, -2,
-    2, -15, 3, 0, 0, 1, -15, 0,
-    -15, -2, -25, -2, 0, -14, 0, 6,
-    8, 0, 3, 0, 0, 0, 0, 0,
-    0, -4, -3, 0, 3, -6, 0, 0,
-    0, -3, 0, 0, 0, -3, 0, 0,
-    0, 0, 0, -1, -1, 0, -1, -4,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    -3, 0, -2, -3, -3, 0, 0, -3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, -2, 0, -6, 3, 0, 0, -4,
-    1, 3, 3, 0, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, 0, 0, 2,
-    0, 0, -3, 0, -3, -2, -4, 0,
-    0, 0, 0, 0, 0, 0, 3, 0,
-    -2, 0, 0, 0, 0, -3, -4, 0,
-    3, 0, 0, 9, -2, 1, -10, 0,
-    0, 8, -14, -15, -12, -6, 3, 0,
-    -3, -19, -5, 0, -5, 0, -6, 4,
-    -5, -19, 0, -8, 0, 0, 1, -1,
-    2, -2, 0, 3, -1, -9, -11, 0,
-    -14, -7, -6, -7, -9, -4, -8, -1,
-    -7, -9, -6, 12, 0, 1, 0, -3,
-    0, 0, 0, 2, 0, 3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -3, 0, -1, 0, -1, -3, 0,
-    -5, -6, -6, -1, 0, -9, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 2, -1, 0, 0, 0, 0, 3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    13, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, -3, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -5,
-    0, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, -7, 0, 0, 0,
-    0, -14, -9, 0, 0, 0, -4, -14,
-    0, 0, -3, 3, 0, -9, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, 0, 0, -6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -5, 0, 0, 0, 0,
-    4, 0, 2, -6, -6, 0, -3, -3,
-    -3, 0, 0, 0, 0, 0, 0, -9,
-    0, -3, 0, -4, -3, 0, -6, -7,
-    -9, -3, 0, -6, 0, -9, 0, 0,
-    0, 0, 23, 0, 0, 1, 0, 0,
-    -3, 0, 0, 1, 0, -13, 0, 0,
-    0, 0, 0, -26, -4, 10, 9, -2,
-    -12, 0, 3, -4, 0, -14, -1, -4,
-    3, -20, -3, 3, 0, 4, -10, -4,
-    -10, -9, -12, 0, 0, -17, 0, 17,
-    0, 0, -1, 0, 0, 0, -1, -1,
-    -3, -7, -9, 0, 0, -21, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, -1, -3, -4, 0, 0, -6,
-    0, -3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -1, 0, -6, 0, 0, 6,
-    -1, 4, 0, -7, 3, -2, -1, -9,
-    -3, 0, -4, -3, -2, 0, -4, -5,
-    0, 0, -3, -1, -2, -5, -4, 0,
-    0, -3, 0, 3, -2, 0, -7, 0,
-    0, 0, -6, 0, -5, 0, -5, -5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -6, 3, 0, -5, 0, -2,
-    -4, -11, -2, -2, -2, -1, -2, -4,
-    -1, 0, 0, 0, 0, 0, -3, -3,
-    -3, 0, 0, 0, 0, 4, -2, 0,
-    -2, 0, 0, 0, -2, -4, -2, -3,
-    -4, -3, 0, 0, 1, 12, -1, 0,
-    -9, 0, -2, 6, 0, -3, -12, -4,
-    4, 0, 0, -14, -5, 3, -5, 2,
-    0, -3, -3, -10, 0, -4, 1, 0,
-    0, -5, 0, 0, 0, 3, 3, -6,
-    -6, 0, -5, -3, -4, -3, -3, 0,
-    -5, 1, -6, -5, 0, 9, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 3,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, 0, 0, -4, 0, 0, -3,
-    -3, 0, 0, 0, 0, -3, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, -4, 0,
-    -6, 0, 0, 0, -9, 0, 2, -6,
-    6, 0, -2, -14, 0, 0, -6, -3,
-    0, -12, -7, -8, 0, 0, -12, -3,
-    -12, -11, -14, 0, -9, 0, 1, 20,
-    -4, 0, -7, -3, -1, -3, -5, -8,
-    -5, -10, -11, -6, 0, 6, 0, 0,
-    -2, 0, 1, 0, 0, -20, -4, 9,
-    7, -7, -11, 0, 1, -11, 0, -14,
-    -2, -3, 6, -27, -4, 1, 0, 0,
-    -19, -4, -15, -3, -21, 0, 0, -20,
-    0, 18, 1, 0, -2, 0, 0, 0,
-    0, -1, -2, -11, -2, 0, 0, -19,
-    0, 0, 0, 0, -10, 0, -3, 0,
-    -1, -8, -14, 0, 0, -1, -4, -9,
-    -3, 0, -2, 0, 0, 0, 0, -13,
-    -3, -10, -10, -1, -5, -7, -3, -5,
-    0, -6, -3, -9, -4, 0, -4, -7,
-    -3, -7, 0, 1, 0, -2, -10, 0,
-    0, 0, 0, -5, 0, 0, 0, 0,
-    4, 0, 2, -6, 11, 0, -3, -3,
-    -3, 0, 0, 0, 0, 0, 0, -9,
-    0, -3, 0, -4, -3, 0, -6, -7,
-    -9, -3, 0, -6, 1, 12, 0, 0,
-    0, 0, 23, 0, 0, 1, 0, 0,
-    -3, 0, 0, 1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -6, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, -3, -3, 0,
-    0, -6, -3, 0, 0, -6, 0, 5,
-    -1, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 6, 1,
-    -3, 0, -10, -5, 0, 9, -9, -9,
-    -6, -6, 12, 4, 3, -25, -2, 6,
-    -3, 0, -3, 2, -3, -10, 0, -3,
-    3, -4, -1, -9, -1, 0, 0, 9,
-    6, 0, -8, 0, -16, -4, 6, -4,
-    -11, 1, -4, -10, -10, -3, 0, 14,
-    3, 0, -4, 0, -8, 0, 1, 10,
-    -6, -10, -12, -7, 9, 0, 1, -21,
-    -2, 3, -5, -2, -6, 0, -6, -10,
-    -4, -4, -1, 0, 0, -6, -5, -3,
-    0, 9, 6, -3, -16, 0, -16, -5,
-    0, -10, -16, -1, -9, -5, -10, -8,
-    0, 12, 0, 0, -4, 0, -6, -3,
-    0, -3, -5, 0, 5, -9, 3, 0,
-    0, -15, 0, -3, -6, -5, -2, -9,
-    -7, -9, -7, 0, -9, -3, -6, -7,
-    -9, -3, 0, 0, 1, 14, -5, 0,
-    -9, -3, 0, -3, -6, -6, -7, -7,
-    -10, -3, 0, 9, 6, 0, -4, 0,
-    -14, -4, 1, 6, -9, -10, -6, -9,
-    9, -3, 1, -26, -5, 6, -6, -5,
-    -10, 0, -9, -12, -4, -3, -1, -3,
-    -5, -9, -1, 0, 0, 9, 7, -2,
-    -19, 0, -17, -8, 6, -11, -19, -6,
-    -10, -12, -14, -9, 0, 14, 0, 0,
-    0, 0, -4, 0, 0, 3, -4, 6,
-    2, -6, 6, 0, 0, -11, -1, 0,
-    -1, 0, 1, 1, -3, 0, 0, 0,
-    0, 0, 0, -3, 0, 0, 0, 0,
-    1, 9, 0, 0, -4, 0, 0, 0,
-    0, -2, -2, -4, 0, 0, 0, 9,
-    1, 1, 0, 0, 0, 0, 1, 0,
-    -3, 0, 10, 0, 4, 1, 1, -3,
-    0, 6, 0, 0, 0, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 9, 0, 7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 13, 0, -17, 0, -3, 5, 0,
-    9, 0, 0, 30, 4, -6, -6, 3,
-    3, -2, 1, -14, 0, 0, 13, -17,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -19, 10, 40, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -17, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, 0,
-    0, -7, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, -8, 0, 0, 1, 0, 0, 3,
-    38, -6, -3, 10, 8, -8, 3, 0,
-    0, 3, 3, -3, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -37,
-    7, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, -14,
-    0, 0, 0, -8, 0, 0, 0, -8,
-    0, 0, 0, 0, -7, -1, 0, 0,
-    0, -7, 0, -4, 0, -14, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -20, 0, 0, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, -3, 0, 0,
-    0, -8, 0, -4, 0, -8, 0, 0,
-    0, -5, 3, -4, 0, 0, -8, -3,
-    -7, 0, 0, -8, 0, -3, 0, -14,
-    0, -2, 0, 0, -24, -7, -12, -2,
-    -10, 0, 0, -20, 0, -8, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    -5, -3, 0, -9, 0, 0, 0, 0,
-    -7, 0, -6, 3, -2, 6, 0, -2,
-    -7, -2, -5, -7, 0, -4, -1, -2,
-    2, -8, -1, 0, 0, 0, -27, -1,
-    -3, 0, -4, 0, -2, -14, -3, 0,
-    0, -2, -3, 0, 0, 0, 0, 2,
-    0, -2, -5, -2, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, -7, 0, -2, 0, 0, 0, -6,
-    3, 0, 0, 0, -8, -3, -6, 0,
-    0, -8, 0, -3, 0, -14, 0, 0,
-    0, 0, -28, 0, -6, -10, -14, 0,
-    0, -20, 0, -2, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, -3, -4, -1,
-    0, -9, 1, 0, 0, 5, -3, 0,
-    8, 15, -3, -3, -9, 4, 15, 5,
-    7, -8, 4, 13, 4, 9, 7, 8,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 18, 14, -4, -3, 0,
-    -3, 23, 12, 23, 0, 0, 0, 3,
-    0, 0, 0, 23, 0, 0, -5, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 3, 0, 0, 0, 0, -26, -4,
-    -1, -13, -15, 0, 0, -20, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 3, 0, 0, 0, 0,
-    -26, -4, -1, -13, -15, 0, 0, -14,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0,
-    -6, 3, 0, -3, 1, 4, 3, -9,
-    0, -1, -2, 3, 0, 1, 0, 0,
-    0, 0, -9, 0, -3, -2, -6, 0,
-    -3, -12, 0, 19, -3, 0, -6, -2,
-    0, -2, -5, 0, -3, -8, -6, -3,
-    0, 0, 0, 0, -5, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, 3,
-    0, 0, 0, 0, -26, -4, -1, -13,
-    -15, 0, 0, -20, 0, 0, 0, 0,
-    0, 0, 14, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, 0,
-    -10, -4, -3, 9, -3, -3, -12, 1,
-    -3, 1, -2, -9, 0, 6, 0, 1,
-    1, 1, -7, -11, -4, 0, -13, -7,
-    -8, -12, -12, 0, -5, -6, -4, -3,
-    -3, -2, -4, -2, 0, -2, -1, 4,
-    0, 4, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, -3, -3, 0, 0, -8,
-    0, -1, 0, -5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -17,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, -3, 0, 0, -5,
-    0, 0, 0, 0, -3, 0, 0, -5,
-    -3, 3, 0, -5, -6, -2, 0, -10,
-    -2, -7, -2, -4, 0, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -20, 0, 10, 0, 0, -5, 0,
-    0, 0, 0, -4, 0, -3, 0, 0,
-    0, -8, 0, 0, -2, 0, -6, 0,
-    0, 13, -3, -10, -8, 2, 2, 2,
-    -1, -7, 2, 4, 2, 9, 2, 9,
-    -2, -7, 0, 0, -14, 0, 0, -9,
-    -8, 0, 0, -6, 0, -3, -5, 0,
-    -4, 0, -4, 0, -2, 4, 0, -1,
-    -9, -3, 0, 0, 0, 0, -3, 0,
-    -6, 0, 0, 3, -6, 0, 3, -3,
-    1, -1, 0, -9, 0, -2, -1, 0,
-    -3, 2, -1, 0, 0, 0, -14, -4,
-    -6, 0, -9, 0, 0, -14, 0, 11,
-    -3, 0, -5, 0, -1, 0, -3, 0,
-    -3, -9, 0, -3, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 3, -4, 1,
-    0, 0, -4, -2, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -19,
-    0, 7, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, -3, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    3, 0, -13, 0, 0, 0, 0, 0,
-    0, 3, 0, 9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 12, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 61,
-    .right_class_cnt     = 50,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t sr_font_montserrat_18 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 21,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if SR_FONT_MONTSERRAT_18*/
-
@@ -1,1676 +0,0 @@
-#include "lvgl/lvgl.h"
-
-/*******************************************************************************
- * Size: 22 px
- * Bpp: 2
- * Opts: 
- ******************************************************************************/
-
-#ifndef SR_FONT_MONTSERRAT_22
-#define SR_FONT_MONTSERRAT_22 1
-#endif
-
-#if SR_FONT_MONTSERRAT_22
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+20 " " */
-
-    /* U+21 "!" */
-    0x3c, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xd3,
-    0x40, 0x0, 0x3, 0xce,
-
-    /* U+22 "\"" */
-    0x70, 0xa7, 0xa, 0x70, 0xa7, 0xa, 0x70, 0xa7,
-    0xa,
-
-    /* U+23 "#" */
-    0x0, 0x34, 0x3, 0x0, 0x0, 0xc0, 0x1c, 0x0,
-    0x3, 0x0, 0x60, 0x0, 0x1c, 0x2, 0x80, 0x2f,
-    0xff, 0xff, 0xf8, 0x2, 0x80, 0x34, 0x0, 0xa,
-    0x0, 0xc0, 0x0, 0x34, 0x3, 0x0, 0x0, 0xd0,
-    0xc, 0x0, 0x3, 0x0, 0x70, 0x7, 0xff, 0xff,
-    0xff, 0x0, 0x70, 0xa, 0x0, 0x1, 0xc0, 0x28,
-    0x0, 0x6, 0x0, 0xd0, 0x0, 0x28, 0x3, 0x40,
-    0x0, 0x90, 0xc, 0x0,
-
-    /* U+24 "$" */
-    0x0, 0x10, 0x0, 0x0, 0x24, 0x0, 0x0, 0x24,
-    0x0, 0x2, 0xff, 0x90, 0x1f, 0xba, 0xf8, 0x38,
-    0x24, 0x14, 0x70, 0x24, 0x0, 0xb0, 0x24, 0x0,
-    0x74, 0x24, 0x0, 0x3e, 0x24, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x25, 0xf8, 0x0,
-    0x24, 0x2d, 0x0, 0x24, 0xd, 0x0, 0x24, 0xd,
-    0xa0, 0x24, 0x3c, 0x7e, 0x7a, 0xf4, 0xb, 0xff,
-    0x90, 0x0, 0x24, 0x0, 0x0, 0x24, 0x0, 0x0,
-    0x10, 0x0,
-
-    /* U+25 "%" */
-    0x7, 0xf0, 0x0, 0x28, 0x0, 0xd1, 0xc0, 0x7,
-    0x0, 0x24, 0xa, 0x0, 0xd0, 0x3, 0x0, 0x60,
-    0x28, 0x0, 0x30, 0x3, 0x3, 0x0, 0x3, 0x0,
-    0x60, 0xd0, 0x0, 0x34, 0xa, 0x2c, 0x0, 0x1,
-    0xc1, 0xc3, 0x0, 0x0, 0x7, 0xf4, 0xd0, 0xbd,
-    0x0, 0x0, 0x2c, 0x38, 0x38, 0x0, 0x3, 0x7,
-    0x0, 0xc0, 0x0, 0xd0, 0xa0, 0xc, 0x0, 0x1c,
-    0xa, 0x0, 0xc0, 0x3, 0x0, 0x60, 0xc, 0x0,
-    0xe0, 0x3, 0x42, 0x80, 0x1c, 0x0, 0xb, 0xe0,
-
-    /* U+26 "&" */
-    0x1, 0xfe, 0x0, 0x0, 0x79, 0x6c, 0x0, 0xe,
-    0x0, 0xd0, 0x0, 0xe0, 0xd, 0x0, 0xf, 0x1,
-    0xc0, 0x0, 0x74, 0x74, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0x2f, 0x40, 0x0, 0xf, 0x2c, 0x0, 0x3,
-    0x80, 0xb0, 0x34, 0xb0, 0x3, 0xc3, 0xe, 0x0,
-    0xf, 0xb0, 0xe0, 0x0, 0x3d, 0xb, 0x40, 0x7,
-    0xf0, 0x3e, 0x57, 0xe3, 0xc0, 0x7f, 0xe4, 0xc,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+27 "'" */
-    0x77, 0x77, 0x77,
-
-    /* U+28 "(" */
-    0x7, 0x3, 0x81, 0xc0, 0xb0, 0x38, 0xd, 0x7,
-    0x2, 0xc0, 0xb0, 0x2c, 0xb, 0x2, 0xc0, 0xb0,
-    0x2c, 0x7, 0x0, 0xd0, 0x38, 0xb, 0x1, 0xc0,
-    0x38, 0x7, 0x0,
-
-    /* U+29 ")" */
-    0x38, 0x7, 0x0, 0xe0, 0x2c, 0x7, 0x0, 0xd0,
-    0x38, 0xf, 0x2, 0xc0, 0xb0, 0x2c, 0xb, 0x2,
-    0xc0, 0xf0, 0x38, 0xd, 0x7, 0x2, 0xc0, 0xe0,
-    0x70, 0x38, 0x0,
-
-    /* U+2A "*" */
-    0x1, 0xc0, 0x0, 0x70, 0x7, 0x9c, 0xe0, 0x2f,
-    0xd0, 0x7, 0xf0, 0xe, 0x77, 0x81, 0x1c, 0x10,
-    0x7, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2B "+" */
-    0x0, 0x20, 0x0, 0x1, 0xc0, 0x0, 0x7, 0x0,
-    0x0, 0x1c, 0x0, 0x0, 0x70, 0x1, 0xff, 0xff,
-    0xc1, 0x5b, 0x55, 0x0, 0x1c, 0x0, 0x0, 0x70,
-    0x0, 0x1, 0xc0, 0x0,
-
-    /* U+2C "," */
-    0x63, 0xd7, 0x4c, 0x62, 0x40,
-
-    /* U+2D "-" */
-    0x0, 0x2, 0xff, 0xc1, 0x55, 0x0,
-
-    /* U+2E "." */
-    0x13, 0xdb, 0x0,
-
-    /* U+2F "/" */
-    0x0, 0x0, 0x40, 0x0, 0x2c, 0x0, 0x3, 0x40,
-    0x0, 0x70, 0x0, 0xb, 0x0, 0x0, 0xd0, 0x0,
-    0x1c, 0x0, 0x2, 0xc0, 0x0, 0x34, 0x0, 0x7,
-    0x0, 0x0, 0xb0, 0x0, 0xd, 0x0, 0x1, 0xc0,
-    0x0, 0x28, 0x0, 0x3, 0x40, 0x0, 0x70, 0x0,
-    0xa, 0x0, 0x0, 0xd0, 0x0, 0x1c, 0x0, 0x2,
-    0x80, 0x0, 0x34, 0x0, 0x7, 0x0, 0x0,
-
-    /* U+30 "0" */
-    0x0, 0xbf, 0x40, 0x1, 0xfa, 0xbc, 0x1, 0xe0,
-    0x3, 0xc0, 0xf0, 0x0, 0x74, 0x74, 0x0, 0xf,
-    0x2c, 0x0, 0x1, 0xcb, 0x0, 0x0, 0x77, 0xc0,
-    0x0, 0xd, 0xf0, 0x0, 0x3, 0x6c, 0x0, 0x1,
-    0xdb, 0x0, 0x0, 0x71, 0xd0, 0x0, 0x3c, 0x3c,
-    0x0, 0x1d, 0x7, 0x80, 0xf, 0x0, 0x7e, 0xaf,
-    0x0, 0x2, 0xfd, 0x0,
-
-    /* U+31 "1" */
-    0xff, 0xd5, 0x6d, 0x0, 0xd0, 0xd, 0x0, 0xd0,
-    0xd, 0x0, 0xd0, 0xd, 0x0, 0xd0, 0xd, 0x0,
-    0xd0, 0xd, 0x0, 0xd0, 0xd, 0x0, 0xd0, 0xd,
-
-    /* U+32 "2" */
-    0x6, 0xff, 0x40, 0x2f, 0xab, 0xf0, 0x74, 0x0,
-    0x78, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x2c, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x74, 0x0, 0x0, 0xf0,
-    0x0, 0x3, 0xc0, 0x0, 0xf, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xf0, 0x0, 0x3, 0xd0, 0x0, 0xf,
-    0x40, 0x0, 0x3e, 0x55, 0x55, 0x3f, 0xff, 0xfe,
-
-    /* U+33 "3" */
-    0x3f, 0xff, 0xf8, 0x15, 0x55, 0xb4, 0x0, 0x0,
-    0xe0, 0x0, 0x3, 0xc0, 0x0, 0xb, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x38, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x1c, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x2c, 0xb4,
-    0x0, 0x7c, 0x3f, 0xab, 0xf0, 0x6, 0xff, 0x40,
-
-    /* U+34 "4" */
-    0x0, 0x0, 0x74, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x2, 0xd0, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xb,
-    0x0, 0x40, 0x0, 0x74, 0x7, 0x0, 0x3, 0x80,
-    0x1c, 0x0, 0x3c, 0x0, 0x70, 0x2, 0xd0, 0x1,
-    0xd0, 0xf, 0xff, 0xff, 0xfc, 0x15, 0x55, 0x6d,
-    0x50, 0x0, 0x0, 0x70, 0x0, 0x0, 0x1, 0xc0,
-    0x0, 0x0, 0x7, 0x0,
-
-    /* U+35 "5" */
-    0xb, 0xff, 0xfc, 0xf, 0x55, 0x54, 0xe, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0xd, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0x1f, 0xff, 0x90,
-    0x5, 0x56, 0xf4, 0x0, 0x0, 0x2c, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0xe, 0x0, 0x0, 0xd, 0x34,
-    0x0, 0x3c, 0x3f, 0xaa, 0xf4, 0x6, 0xff, 0x80,
-
-    /* U+36 "6" */
-    0x0, 0x7f, 0xe4, 0x7, 0xe5, 0xb8, 0xe, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x74, 0x0, 0x0, 0xb0,
-    0x0, 0x0, 0xb0, 0xbf, 0x90, 0xf7, 0x95, 0xf4,
-    0xfd, 0x0, 0x2c, 0xf8, 0x0, 0xe, 0xb4, 0x0,
-    0xe, 0x74, 0x0, 0xe, 0x38, 0x0, 0xd, 0x2d,
-    0x0, 0x3c, 0xb, 0xd6, 0xf4, 0x1, 0xbf, 0x80,
-
-    /* U+37 "7" */
-    0x7f, 0xff, 0xff, 0x1e, 0x55, 0x57, 0xc7, 0x40,
-    0x1, 0xd1, 0xd0, 0x0, 0xb0, 0x10, 0x0, 0x38,
-    0x0, 0x0, 0x2c, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x7, 0x40, 0x0, 0x3, 0xc0, 0x0, 0x1, 0xd0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x38, 0x0, 0x0,
-    0x2c, 0x0, 0x0, 0xe, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x3, 0xc0, 0x0,
-
-    /* U+38 "8" */
-    0x2, 0xff, 0x80, 0x1f, 0x96, 0xf4, 0x3c, 0x0,
-    0x3c, 0x74, 0x0, 0x1d, 0x70, 0x0, 0xd, 0x38,
-    0x0, 0x2c, 0x1e, 0x41, 0xb4, 0x7, 0xff, 0xd0,
-    0x2f, 0x55, 0xf8, 0x74, 0x0, 0x1d, 0xf0, 0x0,
-    0xf, 0xe0, 0x0, 0xb, 0xf0, 0x0, 0xf, 0x78,
-    0x0, 0x2d, 0x2f, 0x96, 0xf8, 0x6, 0xff, 0x90,
-
-    /* U+39 "9" */
-    0x2, 0xff, 0x80, 0x3, 0xe5, 0xbc, 0x3, 0xc0,
-    0x3, 0xc0, 0xd0, 0x0, 0x34, 0x74, 0x0, 0xf,
-    0xd, 0x0, 0x3, 0xc3, 0xc0, 0x2, 0xf0, 0x7d,
-    0x6, 0xdc, 0x7, 0xff, 0x87, 0x0, 0x0, 0x1,
-    0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x2c, 0x0, 0x0, 0x2e, 0x0, 0xe9, 0xbe,
-    0x0, 0x2f, 0xf8, 0x0,
-
-    /* U+3A ":" */
-    0xb3, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x6c,
-
-    /* U+3B ";" */
-    0xb3, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0x5d, 0x31, 0x89, 0x0,
-
-    /* U+3C "<" */
-    0x0, 0x0, 0x10, 0x0, 0xb, 0xc0, 0x6, 0xf4,
-    0x1, 0xf9, 0x0, 0x7d, 0x0, 0x1, 0xe4, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x80,
-
-    /* U+3D "=" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xc1, 0x55, 0x55,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x5, 0x55, 0x54,
-
-    /* U+3E ">" */
-    0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x2, 0xf0, 0x0, 0x7,
-    0xc0, 0x2, 0xf4, 0x1, 0xf9, 0x0, 0x7e, 0x0,
-    0x1, 0x40, 0x0, 0x0,
-
-    /* U+3F "?" */
-    0x6, 0xff, 0x40, 0xfe, 0x6f, 0xc7, 0x40, 0x7,
-    0x80, 0x0, 0xf, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0xe0, 0x0, 0xf, 0x0, 0x0, 0xf0, 0x0, 0xf,
-    0x0, 0x0, 0x74, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0xf, 0x0,
-
-    /* U+40 "@" */
-    0x0, 0x6, 0xff, 0xe4, 0x0, 0x0, 0x1f, 0x90,
-    0x1b, 0xc0, 0x0, 0x2d, 0x0, 0x0, 0x2d, 0x0,
-    0x2c, 0x0, 0x0, 0x1, 0xd0, 0x1c, 0x1, 0xbf,
-    0x4b, 0x1c, 0xd, 0x2, 0xe5, 0xba, 0xc2, 0x87,
-    0x1, 0xd0, 0x3, 0xf0, 0x32, 0x80, 0xe0, 0x0,
-    0x3c, 0xd, 0xd0, 0x34, 0x0, 0xf, 0x2, 0xb4,
-    0x1c, 0x0, 0x2, 0xc0, 0xad, 0x7, 0x0, 0x0,
-    0xb0, 0x2b, 0x40, 0xd0, 0x0, 0x3c, 0xa, 0xa0,
-    0x38, 0x0, 0xf, 0x3, 0x5c, 0x7, 0x40, 0xf,
-    0xc0, 0xc3, 0x40, 0xb9, 0x5e, 0x79, 0xe0, 0x70,
-    0x6, 0xfd, 0xb, 0xe0, 0xb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xe4, 0x16, 0x80, 0x0, 0x0, 0x1b, 0xff, 0x80,
-    0x0,
-
-    /* U+41 "A" */
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x1c, 0x70, 0x0,
-    0x0, 0x38, 0x38, 0x0, 0x0, 0x70, 0x1c, 0x0,
-    0x0, 0xe0, 0xe, 0x0, 0x0, 0xd0, 0xb, 0x0,
-    0x2, 0xc0, 0x3, 0x40, 0x3, 0x40, 0x2, 0xc0,
-    0xb, 0xff, 0xff, 0xd0, 0xe, 0x55, 0x55, 0xf0,
-    0x1c, 0x0, 0x0, 0x70, 0x38, 0x0, 0x0, 0x38,
-    0x74, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x0, 0xe,
-
-    /* U+42 "B" */
-    0x7f, 0xff, 0xe4, 0x7, 0x55, 0x5b, 0xe0, 0x70,
-    0x0, 0xb, 0x47, 0x0, 0x0, 0x38, 0x70, 0x0,
-    0x3, 0x47, 0x0, 0x0, 0x70, 0x70, 0x0, 0x6e,
-    0x7, 0xff, 0xff, 0x80, 0x75, 0x55, 0x6f, 0x7,
-    0x0, 0x0, 0x3c, 0x70, 0x0, 0x1, 0xc7, 0x0,
-    0x0, 0x1d, 0x70, 0x0, 0x1, 0xd7, 0x0, 0x0,
-    0x3c, 0x75, 0x55, 0x6f, 0x47, 0xff, 0xff, 0x80,
-
-    /* U+43 "C" */
-    0x0, 0x2f, 0xf9, 0x0, 0x2f, 0xaa, 0xfc, 0xb,
-    0x80, 0x1, 0xe2, 0xe0, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x7, 0x40, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x2e, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x1e, 0x2, 0xfe, 0xaf, 0xc0, 0x2, 0xff, 0x90,
-
-    /* U+44 "D" */
-    0x7f, 0xff, 0xe0, 0x0, 0x79, 0x56, 0xbe, 0x0,
-    0x70, 0x0, 0xb, 0xc0, 0x70, 0x0, 0x1, 0xe0,
-    0x70, 0x0, 0x0, 0xb4, 0x70, 0x0, 0x0, 0x38,
-    0x70, 0x0, 0x0, 0x3c, 0x70, 0x0, 0x0, 0x2c,
-    0x70, 0x0, 0x0, 0x2c, 0x70, 0x0, 0x0, 0x3c,
-    0x70, 0x0, 0x0, 0x38, 0x70, 0x0, 0x0, 0xb4,
-    0x70, 0x0, 0x1, 0xe0, 0x70, 0x0, 0x7, 0xc0,
-    0x79, 0x56, 0xbe, 0x0, 0x7f, 0xff, 0xe4, 0x0,
-
-    /* U+45 "E" */
-    0x7f, 0xff, 0xfc, 0x79, 0x55, 0x54, 0x70, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x70,
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x75, 0x55, 0x50, 0x70, 0x0, 0x0, 0x70, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x70,
-    0x0, 0x0, 0x79, 0x55, 0x54, 0x7f, 0xff, 0xfd,
-
-    /* U+46 "F" */
-    0x7f, 0xff, 0xfc, 0x79, 0x55, 0x54, 0x70, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x70,
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x7f, 0xff, 0xf0, 0x75, 0x55, 0x50, 0x70, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x70,
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0,
-
-    /* U+47 "G" */
-    0x0, 0x2f, 0xf9, 0x0, 0x2f, 0xaa, 0xfc, 0xb,
-    0x80, 0x1, 0xe2, 0xe0, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x7, 0x40, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xbb,
-    0x0, 0x0, 0xb, 0x74, 0x0, 0x0, 0xb3, 0x80,
-    0x0, 0xb, 0x1e, 0x0, 0x0, 0xb0, 0xb8, 0x0,
-    0xf, 0x2, 0xfe, 0xaf, 0xd0, 0x2, 0xff, 0x90,
-
-    /* U+48 "H" */
-    0x70, 0x0, 0x0, 0xd7, 0x0, 0x0, 0xd, 0x70,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0xd, 0x70, 0x0,
-    0x0, 0xd7, 0x0, 0x0, 0xd, 0x74, 0x0, 0x1,
-    0xd7, 0xff, 0xff, 0xfd, 0x75, 0x55, 0x55, 0xd7,
-    0x0, 0x0, 0xd, 0x70, 0x0, 0x0, 0xd7, 0x0,
-    0x0, 0xd, 0x70, 0x0, 0x0, 0xd7, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0xd7, 0x0, 0x0, 0xd,
-
-    /* U+49 "I" */
-    0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7,
-    0x1c, 0x71, 0xc7, 0x1c,
-
-    /* U+4A "J" */
-    0xb, 0xff, 0xe0, 0x55, 0x5e, 0x0, 0x0, 0xe0,
-    0x0, 0xe, 0x0, 0x0, 0xe0, 0x0, 0xe, 0x0,
-    0x0, 0xe0, 0x0, 0xe, 0x0, 0x0, 0xe0, 0x0,
-    0xe, 0x0, 0x0, 0xe0, 0x0, 0xe, 0x0, 0x0,
-    0xd3, 0x80, 0x2c, 0x1f, 0xaf, 0x80, 0x2f, 0xd0,
-
-    /* U+4B "K" */
-    0x70, 0x0, 0x7, 0x87, 0x0, 0x1, 0xe0, 0x70,
-    0x0, 0x38, 0x7, 0x0, 0xf, 0x0, 0x70, 0x3,
-    0xc0, 0x7, 0x0, 0xf0, 0x0, 0x70, 0x3c, 0x0,
-    0x7, 0xf, 0x80, 0x0, 0x72, 0xfd, 0x0, 0x7,
-    0xf4, 0xf0, 0x0, 0x7d, 0x3, 0xc0, 0x7, 0x40,
-    0xf, 0x0, 0x70, 0x0, 0x78, 0x7, 0x0, 0x2,
-    0xd0, 0x70, 0x0, 0xb, 0x47, 0x0, 0x0, 0x3c,
-
-    /* U+4C "L" */
-    0x70, 0x0, 0x1, 0xc0, 0x0, 0x7, 0x0, 0x0,
-    0x1c, 0x0, 0x0, 0x70, 0x0, 0x1, 0xc0, 0x0,
-    0x7, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x70, 0x0,
-    0x1, 0xc0, 0x0, 0x7, 0x0, 0x0, 0x1c, 0x0,
-    0x0, 0x70, 0x0, 0x1, 0xc0, 0x0, 0x7, 0x95,
-    0x55, 0x5f, 0xff, 0xff,
-
-    /* U+4D "M" */
-    0x70, 0x0, 0x0, 0x3, 0x9e, 0x0, 0x0, 0x2,
-    0xe7, 0xd0, 0x0, 0x0, 0xf9, 0xfc, 0x0, 0x0,
-    0xfe, 0x77, 0x40, 0x0, 0x77, 0x9c, 0xb0, 0x0,
-    0x38, 0xe7, 0xe, 0x0, 0x1c, 0x39, 0xc2, 0xc0,
-    0xe, 0xe, 0x70, 0x38, 0xb, 0x3, 0x9c, 0x7,
-    0x3, 0x40, 0xe7, 0x0, 0xf2, 0xc0, 0x39, 0xc0,
-    0x1e, 0xd0, 0xe, 0x70, 0x2, 0xe0, 0x3, 0x9c,
-    0x0, 0x30, 0x0, 0xe7, 0x0, 0x0, 0x0, 0x39,
-    0xc0, 0x0, 0x0, 0xe,
-
-    /* U+4E "N" */
-    0x70, 0x0, 0x0, 0xd7, 0xc0, 0x0, 0xd, 0x7e,
-    0x0, 0x0, 0xd7, 0xb8, 0x0, 0xd, 0x72, 0xd0,
-    0x0, 0xd7, 0xf, 0x0, 0xd, 0x70, 0x3c, 0x0,
-    0xd7, 0x1, 0xe0, 0xd, 0x70, 0xb, 0x40, 0xd7,
-    0x0, 0x3c, 0xd, 0x70, 0x0, 0xf0, 0xd7, 0x0,
-    0x7, 0x8d, 0x70, 0x0, 0x2e, 0xd7, 0x0, 0x0,
-    0xfd, 0x70, 0x0, 0x3, 0xd7, 0x0, 0x0, 0x1d,
-
-    /* U+4F "O" */
-    0x0, 0x2f, 0xf9, 0x0, 0x0, 0xbe, 0xab, 0xf0,
-    0x0, 0xb8, 0x0, 0x1f, 0x0, 0x78, 0x0, 0x0,
-    0xf0, 0x38, 0x0, 0x0, 0x1e, 0x1d, 0x0, 0x0,
-    0x3, 0xcb, 0x0, 0x0, 0x0, 0xb3, 0xc0, 0x0,
-    0x0, 0x1d, 0xf0, 0x0, 0x0, 0x7, 0x6c, 0x0,
-    0x0, 0x2, 0xc7, 0x40, 0x0, 0x0, 0xf0, 0xe0,
-    0x0, 0x0, 0x78, 0x1e, 0x0, 0x0, 0x3c, 0x2,
-    0xe0, 0x0, 0x7c, 0x0, 0x2f, 0xaa, 0xfc, 0x0,
-    0x0, 0xbf, 0xe4, 0x0,
-
-    /* U+50 "P" */
-    0x7f, 0xff, 0x90, 0x1e, 0x55, 0xbf, 0x7, 0x0,
-    0x1, 0xe1, 0xc0, 0x0, 0x2c, 0x70, 0x0, 0x3,
-    0x5c, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x35, 0xc0,
-    0x0, 0x1d, 0x70, 0x0, 0xf, 0x1d, 0x0, 0x6f,
-    0x7, 0xff, 0xfe, 0x1, 0xd5, 0x50, 0x0, 0x70,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0x1, 0xc0, 0x0, 0x0,
-
-    /* U+51 "Q" */
-    0x0, 0x2f, 0xf9, 0x0, 0x0, 0x2f, 0xaa, 0xfc,
-    0x0, 0xb, 0x80, 0x1, 0xf0, 0x1, 0xe0, 0x0,
-    0x3, 0xc0, 0x38, 0x0, 0x0, 0x1e, 0x7, 0x40,
-    0x0, 0x0, 0xf0, 0xb0, 0x0, 0x0, 0xb, 0xf,
-    0x0, 0x0, 0x0, 0x74, 0xf0, 0x0, 0x0, 0x7,
-    0x4b, 0x0, 0x0, 0x0, 0x70, 0x74, 0x0, 0x0,
-    0xf, 0x3, 0x80, 0x0, 0x1, 0xe0, 0x2d, 0x0,
-    0x0, 0x3c, 0x0, 0xb8, 0x0, 0x1f, 0x0, 0x2,
-    0xfa, 0xaf, 0xc0, 0x0, 0x2, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xb8, 0x0, 0x40, 0x0, 0x2, 0xe0,
-    0x7c, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+52 "R" */
-    0x7f, 0xff, 0x90, 0x1e, 0x55, 0xbf, 0x7, 0x0,
-    0x1, 0xe1, 0xc0, 0x0, 0x2c, 0x70, 0x0, 0x3,
-    0x5c, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x35, 0xc0,
-    0x0, 0x1d, 0x70, 0x0, 0xf, 0x1c, 0x0, 0x1f,
-    0x7, 0xff, 0xfe, 0x1, 0xd5, 0x57, 0x40, 0x70,
-    0x0, 0xb0, 0x1c, 0x0, 0xf, 0x7, 0x0, 0x0,
-    0xe1, 0xc0, 0x0, 0x1d,
-
-    /* U+53 "S" */
-    0x2, 0xff, 0x90, 0x1f, 0x96, 0xf8, 0x38, 0x0,
-    0x14, 0x70, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x74,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x6f, 0xe0, 0x0, 0x1, 0xbc, 0x0, 0x0,
-    0x2d, 0x0, 0x0, 0xd, 0x0, 0x0, 0xd, 0xa0,
-    0x0, 0x3c, 0x7f, 0x96, 0xf4, 0x6, 0xff, 0x80,
-
-    /* U+54 "T" */
-    0xff, 0xff, 0xff, 0x95, 0x5b, 0x95, 0x40, 0x2,
-    0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x2c, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0x2c, 0x0, 0x0, 0xb, 0x0, 0x0, 0x2, 0xc0,
-    0x0, 0x0, 0xb0, 0x0,
-
-    /* U+55 "U" */
-    0xb0, 0x0, 0x2, 0xcb, 0x0, 0x0, 0x2c, 0xb0,
-    0x0, 0x2, 0xcb, 0x0, 0x0, 0x2c, 0xb0, 0x0,
-    0x2, 0xcb, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x2,
-    0xcb, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x2, 0xcb,
-    0x0, 0x0, 0x2c, 0xb0, 0x0, 0x2, 0xc7, 0x40,
-    0x0, 0x38, 0x3c, 0x0, 0x7, 0x41, 0xe0, 0x1,
-    0xf0, 0xb, 0xea, 0xfc, 0x0, 0x1b, 0xfd, 0x0,
-
-    /* U+56 "V" */
-    0xb0, 0x0, 0x0, 0x2c, 0x74, 0x0, 0x0, 0x38,
-    0x3c, 0x0, 0x0, 0x70, 0x1d, 0x0, 0x0, 0xf0,
-    0xe, 0x0, 0x1, 0xd0, 0xb, 0x0, 0x2, 0xc0,
-    0x3, 0x80, 0x3, 0x80, 0x2, 0xc0, 0xb, 0x0,
-    0x1, 0xd0, 0xe, 0x0, 0x0, 0xf0, 0x1d, 0x0,
-    0x0, 0x74, 0x3c, 0x0, 0x0, 0x38, 0x74, 0x0,
-    0x0, 0x2c, 0xb0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x7, 0x80, 0x0,
-
-    /* U+57 "W" */
-    0x38, 0x0, 0x2, 0xc0, 0x0, 0xd, 0x2c, 0x0,
-    0x3, 0xe0, 0x0, 0x1c, 0x1d, 0x0, 0x7, 0xf0,
-    0x0, 0x2c, 0xe, 0x0, 0xb, 0x70, 0x0, 0x38,
-    0xb, 0x0, 0xe, 0x38, 0x0, 0x70, 0x7, 0x40,
-    0x1c, 0x2c, 0x0, 0xb0, 0x3, 0x80, 0x2c, 0x1c,
-    0x0, 0xe0, 0x3, 0xc0, 0x38, 0xe, 0x1, 0xc0,
-    0x1, 0xc0, 0x70, 0xb, 0x2, 0xc0, 0x0, 0xe0,
-    0xb0, 0x7, 0x3, 0x80, 0x0, 0xf0, 0xe0, 0x3,
-    0x47, 0x0, 0x0, 0x71, 0xc0, 0x3, 0xcb, 0x0,
-    0x0, 0x3a, 0xc0, 0x1, 0xce, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0xfd, 0x0, 0x0, 0x1f, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0xf, 0x0, 0x0, 0x78, 0x0,
-
-    /* U+58 "X" */
-    0x3c, 0x0, 0x1, 0xd0, 0x38, 0x0, 0xe, 0x0,
-    0x74, 0x0, 0xf0, 0x0, 0xf0, 0xb, 0x0, 0x0,
-    0xf0, 0x74, 0x0, 0x1, 0xe3, 0x80, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0xf7, 0x40, 0x0, 0xb, 0xb,
-    0x0, 0x0, 0x74, 0xf, 0x0, 0x3, 0x80, 0x1e,
-    0x0, 0x3c, 0x0, 0x2d, 0x2, 0xd0, 0x0, 0x3c,
-    0x1e, 0x0, 0x0, 0x38,
-
-    /* U+59 "Y" */
-    0xb0, 0x0, 0x0, 0xe3, 0x80, 0x0, 0x2c, 0x2c,
-    0x0, 0x3, 0x40, 0xf0, 0x0, 0xb0, 0x7, 0x40,
-    0x1d, 0x0, 0x2c, 0x3, 0x80, 0x0, 0xe0, 0xb0,
-    0x0, 0xb, 0xe, 0x0, 0x0, 0x3e, 0xc0, 0x0,
-    0x1, 0xf4, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf0, 0x0,
-
-    /* U+5A "Z" */
-    0x3f, 0xff, 0xff, 0xd1, 0x55, 0x55, 0x7c, 0x0,
-    0x0, 0xb, 0x40, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x2, 0xd0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x1d,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x2e, 0x55, 0x55, 0x53, 0xff, 0xff, 0xfe,
-
-    /* U+5B "[" */
-    0x7f, 0x9d, 0x47, 0x1, 0xc0, 0x70, 0x1c, 0x7,
-    0x1, 0xc0, 0x70, 0x1c, 0x7, 0x1, 0xc0, 0x70,
-    0x1c, 0x7, 0x1, 0xc0, 0x70, 0x1c, 0x7, 0x1,
-    0xd4, 0x7f, 0x80,
-
-    /* U+5C "\\" */
-    0x50, 0x0, 0x1c, 0x0, 0x3, 0x40, 0x0, 0xe0,
-    0x0, 0x1c, 0x0, 0x3, 0x40, 0x0, 0xa0, 0x0,
-    0x1c, 0x0, 0x3, 0x40, 0x0, 0xa0, 0x0, 0x1c,
-    0x0, 0x3, 0x40, 0x0, 0xa0, 0x0, 0x1c, 0x0,
-    0x3, 0x40, 0x0, 0xa0, 0x0, 0x1c, 0x0, 0x3,
-    0x40, 0x0, 0xa0, 0x0, 0x1c, 0x0, 0x3, 0x40,
-    0x0, 0xb0,
-
-    /* U+5D "]" */
-    0xbf, 0x45, 0xd0, 0x34, 0xd, 0x3, 0x40, 0xd0,
-    0x34, 0xd, 0x3, 0x40, 0xd0, 0x34, 0xd, 0x3,
-    0x40, 0xd0, 0x34, 0xd, 0x3, 0x40, 0xd0, 0x34,
-    0x5d, 0xbf, 0x40,
-
-    /* U+5E "^" */
-    0x0, 0x20, 0x0, 0xb, 0x40, 0x0, 0xec, 0x0,
-    0x28, 0xc0, 0x3, 0x4a, 0x0, 0x70, 0x30, 0xe,
-    0x3, 0x40, 0xc0, 0x1c, 0x28, 0x0, 0xc3, 0x40,
-    0xa,
-
-    /* U+5F "_" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-
-    /* U+60 "`" */
-    0x1e, 0x0, 0x1e, 0x0, 0xe, 0x0,
-
-    /* U+61 "a" */
-    0xb, 0xfe, 0x3, 0xe5, 0xbc, 0x10, 0x1, 0xe0,
-    0x0, 0xf, 0x0, 0x0, 0xb0, 0xbf, 0xff, 0x3d,
-    0x0, 0xbb, 0x0, 0xb, 0xf0, 0x0, 0xfb, 0x0,
-    0x1f, 0x3d, 0x1b, 0xb0, 0xbf, 0x8b,
-
-    /* U+62 "b" */
-    0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe1,
-    0xbf, 0x40, 0xeb, 0x96, 0xf0, 0xfc, 0x0, 0x3c,
-    0xf4, 0x0, 0x1d, 0xf0, 0x0, 0xe, 0xf0, 0x0,
-    0xb, 0xf0, 0x0, 0xb, 0xf0, 0x0, 0xe, 0xf4,
-    0x0, 0x1d, 0xfd, 0x0, 0x3c, 0xeb, 0x96, 0xf0,
-    0xe1, 0xbf, 0x40,
-
-    /* U+63 "c" */
-    0x1, 0xff, 0x40, 0x3e, 0x5b, 0xc3, 0xc0, 0x7,
-    0x1d, 0x0, 0x0, 0xf0, 0x0, 0x3, 0x80, 0x0,
-    0xe, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x74, 0x0,
-    0x0, 0xf0, 0x1, 0xc0, 0xf9, 0x6f, 0x0, 0x7f,
-    0xd0,
-
-    /* U+64 "d" */
-    0x0, 0x0, 0xe, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0xe, 0x0, 0x0, 0xe, 0x2,
-    0xfe, 0xe, 0xf, 0x96, 0xde, 0x3c, 0x0, 0x7e,
-    0x74, 0x0, 0x1e, 0xf0, 0x0, 0xe, 0xe0, 0x0,
-    0xe, 0xe0, 0x0, 0xe, 0xf0, 0x0, 0xe, 0x70,
-    0x0, 0x1e, 0x3c, 0x0, 0x3e, 0xf, 0x96, 0xee,
-    0x2, 0xfe, 0x4e,
-
-    /* U+65 "e" */
-    0x2, 0xfe, 0x40, 0xf, 0x97, 0xe0, 0x3c, 0x0,
-    0x74, 0x70, 0x0, 0x2c, 0xe0, 0x0, 0x1c, 0xff,
-    0xff, 0xfc, 0xe0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x74, 0x0, 0x0, 0x3c, 0x0, 0x30, 0xf, 0x96,
-    0xf0, 0x1, 0xff, 0x80,
-
-    /* U+66 "f" */
-    0x0, 0xbe, 0x0, 0xf5, 0x80, 0x70, 0x0, 0x2c,
-    0x0, 0xb, 0x0, 0x2f, 0xff, 0x81, 0xb5, 0x40,
-    0x2c, 0x0, 0xb, 0x0, 0x2, 0xc0, 0x0, 0xb0,
-    0x0, 0x2c, 0x0, 0xb, 0x0, 0x2, 0xc0, 0x0,
-    0xb0, 0x0, 0x2c, 0x0, 0xb, 0x0, 0x0,
-
-    /* U+67 "g" */
-    0x2, 0xfe, 0x4b, 0xf, 0x96, 0xeb, 0x3c, 0x0,
-    0x3f, 0x74, 0x0, 0x1f, 0xf0, 0x0, 0xf, 0xe0,
-    0x0, 0xb, 0xe0, 0x0, 0xb, 0xf0, 0x0, 0xf,
-    0x74, 0x0, 0x1f, 0x3c, 0x0, 0x3f, 0xf, 0x96,
-    0xeb, 0x1, 0xfe, 0x4b, 0x0, 0x0, 0xe, 0x10,
-    0x0, 0x2c, 0x3f, 0x96, 0xf4, 0x6, 0xff, 0x80,
-
-    /* U+68 "h" */
-    0xe0, 0x0, 0x3, 0x80, 0x0, 0xe, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0xe0, 0x0, 0x3, 0x87, 0xfd,
-    0xe, 0xb9, 0xbe, 0x3f, 0x0, 0x2d, 0xf0, 0x0,
-    0x3b, 0xc0, 0x0, 0xff, 0x0, 0x2, 0xf8, 0x0,
-    0xb, 0xe0, 0x0, 0x2f, 0x80, 0x0, 0xbe, 0x0,
-    0x2, 0xf8, 0x0, 0xb, 0xe0, 0x0, 0x2c,
-
-    /* U+69 "i" */
-    0x3c, 0x3c, 0x0, 0x0, 0x0, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38,
-
-    /* U+6A "j" */
-    0x0, 0xf0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xc0, 0xb, 0x0, 0x2c, 0x0, 0xb0,
-    0x2, 0xc0, 0xb, 0x0, 0x2c, 0x0, 0xb0, 0x2,
-    0xc0, 0xb, 0x0, 0x2c, 0x0, 0xb0, 0x2, 0xc0,
-    0xe, 0x29, 0xb4, 0x7f, 0x40,
-
-    /* U+6B "k" */
-    0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe0,
-    0x0, 0xf0, 0xe0, 0x3, 0xc0, 0xe0, 0xf, 0x0,
-    0xe0, 0x3c, 0x0, 0xe0, 0xf0, 0x0, 0xe3, 0xf0,
-    0x0, 0xff, 0x7c, 0x0, 0xfc, 0x1e, 0x0, 0xf0,
-    0xb, 0x40, 0xe0, 0x3, 0xc0, 0xe0, 0x0, 0xf0,
-    0xe0, 0x0, 0x78,
-
-    /* U+6C "l" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xe0,
-
-    /* U+6D "m" */
-    0xe1, 0xfe, 0x40, 0xbf, 0x80, 0xeb, 0x9b, 0xd7,
-    0xd6, 0xf0, 0xfc, 0x0, 0xfe, 0x0, 0x3c, 0xf0,
-    0x0, 0x7c, 0x0, 0x2c, 0xf0, 0x0, 0x38, 0x0,
-    0x1c, 0xe0, 0x0, 0x38, 0x0, 0x1d, 0xe0, 0x0,
-    0x38, 0x0, 0x1d, 0xe0, 0x0, 0x38, 0x0, 0x1d,
-    0xe0, 0x0, 0x38, 0x0, 0x1d, 0xe0, 0x0, 0x38,
-    0x0, 0x1d, 0xe0, 0x0, 0x38, 0x0, 0x1d, 0xe0,
-    0x0, 0x38, 0x0, 0x1d,
-
-    /* U+6E "n" */
-    0xe1, 0xff, 0x43, 0xae, 0x5f, 0x8f, 0xc0, 0xb,
-    0x7c, 0x0, 0xe, 0xf0, 0x0, 0x3f, 0xc0, 0x0,
-    0xbe, 0x0, 0x2, 0xf8, 0x0, 0xb, 0xe0, 0x0,
-    0x2f, 0x80, 0x0, 0xbe, 0x0, 0x2, 0xf8, 0x0,
-    0xb,
-
-    /* U+6F "o" */
-    0x1, 0xff, 0x40, 0xf, 0x96, 0xf0, 0x3c, 0x0,
-    0x78, 0x74, 0x0, 0x1d, 0xf0, 0x0, 0xe, 0xe0,
-    0x0, 0xe, 0xe0, 0x0, 0xe, 0xf0, 0x0, 0xe,
-    0x74, 0x0, 0x1c, 0x3c, 0x0, 0x78, 0xf, 0x96,
-    0xf0, 0x1, 0xff, 0x40,
-
-    /* U+70 "p" */
-    0xe1, 0xbf, 0x40, 0xeb, 0x96, 0xf0, 0xfc, 0x0,
-    0x3c, 0xf4, 0x0, 0x1d, 0xf0, 0x0, 0xe, 0xf0,
-    0x0, 0xb, 0xf0, 0x0, 0xb, 0xf0, 0x0, 0xe,
-    0xf4, 0x0, 0x1d, 0xfd, 0x0, 0x3c, 0xeb, 0x96,
-    0xf0, 0xe1, 0xbf, 0x40, 0xe0, 0x0, 0x0, 0xe0,
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-
-    /* U+71 "q" */
-    0x2, 0xfe, 0xe, 0xf, 0x96, 0xde, 0x3c, 0x0,
-    0x7e, 0x74, 0x0, 0x1e, 0xf0, 0x0, 0xe, 0xe0,
-    0x0, 0xe, 0xe0, 0x0, 0xe, 0xf0, 0x0, 0xe,
-    0x74, 0x0, 0x1e, 0x3c, 0x0, 0x7e, 0xf, 0x96,
-    0xde, 0x2, 0xfe, 0x4e, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0xe, 0x0, 0x0, 0xe,
-
-    /* U+72 "r" */
-    0xe1, 0xf3, 0xae, 0x8f, 0xc0, 0x3d, 0x0, 0xf0,
-    0x3, 0xc0, 0xe, 0x0, 0x38, 0x0, 0xe0, 0x3,
-    0x80, 0xe, 0x0, 0x38, 0x0,
-
-    /* U+73 "s" */
-    0x2, 0xfe, 0x40, 0x7d, 0x6b, 0x43, 0xc0, 0x0,
-    0xe, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x1b, 0xfc, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0xb0, 0x40, 0x3, 0xc3, 0xe5, 0xbd, 0x2, 0xff,
-    0x80,
-
-    /* U+74 "t" */
-    0x6, 0x0, 0x2, 0xc0, 0x0, 0xb0, 0x2, 0xff,
-    0xf8, 0x1b, 0x54, 0x2, 0xc0, 0x0, 0xb0, 0x0,
-    0x2c, 0x0, 0xb, 0x0, 0x2, 0xc0, 0x0, 0xb0,
-    0x0, 0x2c, 0x0, 0x7, 0x0, 0x0, 0xf5, 0xc0,
-    0xf, 0xe0,
-
-    /* U+75 "u" */
-    0xe0, 0x0, 0x3b, 0x80, 0x0, 0xee, 0x0, 0x3,
-    0xb8, 0x0, 0xe, 0xe0, 0x0, 0x3b, 0x80, 0x0,
-    0xee, 0x0, 0x3, 0xb8, 0x0, 0xe, 0xf0, 0x0,
-    0x79, 0xd0, 0x3, 0xe2, 0xe5, 0xbb, 0x81, 0xff,
-    0x4e,
-
-    /* U+76 "v" */
-    0xf0, 0x0, 0xe, 0x74, 0x0, 0x1d, 0x38, 0x0,
-    0x2c, 0x1c, 0x0, 0x34, 0xe, 0x0, 0xb0, 0xb,
-    0x0, 0xe0, 0x3, 0x41, 0xc0, 0x3, 0xc3, 0x80,
-    0x1, 0xd7, 0x40, 0x0, 0xeb, 0x0, 0x0, 0xbd,
-    0x0, 0x0, 0x3c, 0x0,
-
-    /* U+77 "w" */
-    0xb0, 0x0, 0x38, 0x0, 0x1c, 0x70, 0x0, 0xbc,
-    0x0, 0x38, 0x38, 0x0, 0xed, 0x0, 0x30, 0x2c,
-    0x1, 0xce, 0x0, 0xb0, 0xd, 0x2, 0xc7, 0x0,
-    0xe0, 0xe, 0x3, 0x43, 0x40, 0xc0, 0x7, 0x7,
-    0x2, 0x82, 0xc0, 0x3, 0x4a, 0x1, 0xc3, 0x40,
-    0x2, 0x8d, 0x0, 0xd7, 0x0, 0x1, 0xec, 0x0,
-    0xba, 0x0, 0x0, 0xf8, 0x0, 0x3d, 0x0, 0x0,
-    0xb0, 0x0, 0x3c, 0x0,
-
-    /* U+78 "x" */
-    0x38, 0x0, 0x38, 0x1e, 0x0, 0xf0, 0x7, 0x42,
-    0xc0, 0x2, 0xc7, 0x40, 0x0, 0xee, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x7c, 0x0, 0x0, 0xeb, 0x0,
-    0x3, 0x83, 0x80, 0xb, 0x1, 0xd0, 0x1d, 0x0,
-    0xb0, 0x38, 0x0, 0x3c,
-
-    /* U+79 "y" */
-    0x3c, 0x0, 0x3, 0x87, 0x40, 0x1, 0xc0, 0xf0,
-    0x0, 0xf0, 0x1c, 0x0, 0x34, 0x3, 0x80, 0x2c,
-    0x0, 0xb0, 0xd, 0x0, 0xe, 0xb, 0x0, 0x2,
-    0xc3, 0x80, 0x0, 0x35, 0xc0, 0x0, 0xb, 0xe0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0xf, 0x0, 0x7, 0x9f, 0x40,
-    0x0, 0xbf, 0x40, 0x0,
-
-    /* U+7A "z" */
-    0x3f, 0xff, 0xf0, 0x55, 0x57, 0xc0, 0x0, 0x2c,
-    0x0, 0x1, 0xd0, 0x0, 0xe, 0x0, 0x0, 0xf0,
-    0x0, 0xb, 0x0, 0x0, 0x74, 0x0, 0x3, 0x80,
-    0x0, 0x3c, 0x0, 0x2, 0xd5, 0x55, 0xf, 0xff,
-    0xfd,
-
-    /* U+7B "{" */
-    0x2, 0xf0, 0xb9, 0xe, 0x0, 0xe0, 0xe, 0x0,
-    0xe0, 0xe, 0x0, 0xe0, 0xe, 0x0, 0xe0, 0xbc,
-    0x1, 0xd0, 0xe, 0x0, 0xe0, 0xe, 0x0, 0xe0,
-    0xe, 0x0, 0xe0, 0xe, 0x0, 0xb9, 0x2, 0xf0,
-
-    /* U+7C "|" */
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x70,
-
-    /* U+7D "}" */
-    0xbc, 0x0, 0x7c, 0x0, 0x70, 0x1, 0xd0, 0x7,
-    0x40, 0x1d, 0x0, 0x74, 0x1, 0xd0, 0x7, 0x40,
-    0xe, 0x0, 0x2f, 0x0, 0xe4, 0x7, 0x40, 0x1d,
-    0x0, 0x74, 0x1, 0xd0, 0x7, 0x40, 0x1d, 0x0,
-    0x70, 0x7, 0xc0, 0xbd, 0x0,
-
-    /* U+7E "~" */
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0xc7, 0x5f, 0x47,
-    0x28, 0x7, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+A9 "©" */
-    0x0, 0x2f, 0xf4, 0x0, 0x1, 0xd0, 0x7, 0x40,
-    0xa, 0x0, 0x0, 0xa0, 0x18, 0xb, 0xf4, 0x24,
-    0x30, 0x79, 0x2d, 0xc, 0x50, 0xd0, 0x0, 0x9,
-    0x81, 0xc0, 0x0, 0x6, 0xc1, 0xc0, 0x0, 0x2,
-    0xc1, 0xc0, 0x0, 0x2, 0x80, 0xd0, 0x0, 0x6,
-    0x50, 0x74, 0x1d, 0x9, 0x30, 0x1f, 0xf4, 0xc,
-    0x18, 0x0, 0x0, 0x34, 0xa, 0x0, 0x0, 0x90,
-    0x2, 0xd0, 0x7, 0x40, 0x0, 0x2f, 0xe4, 0x0,
-
-    /* U+AA "ª" */
-    0xb, 0xf0, 0x14, 0x1c, 0x0, 0xc, 0xb, 0xfd,
-    0x30, 0xd, 0x34, 0x1d, 0xb, 0x98,
-
-    /* U+AE "®" */
-    0x0, 0x2f, 0xf4, 0x0, 0x1, 0xd0, 0x7, 0x40,
-    0xa, 0x0, 0x0, 0xa0, 0x18, 0x3f, 0xf4, 0x24,
-    0x30, 0x30, 0x1d, 0xc, 0x50, 0x30, 0x6, 0x9,
-    0x80, 0x30, 0x7, 0x6, 0xc0, 0x30, 0x1d, 0x2,
-    0xc0, 0x3f, 0xf4, 0x2, 0x80, 0x30, 0x34, 0x6,
-    0x50, 0x30, 0x1c, 0x9, 0x30, 0x30, 0x9, 0xc,
-    0x18, 0x10, 0x0, 0x34, 0xa, 0x0, 0x0, 0x90,
-    0x2, 0xd0, 0x7, 0x40, 0x0, 0x2f, 0xe4, 0x0,
-
-    /* U+B1 "±" */
-    0x0, 0x10, 0x0, 0x1, 0xc0, 0x0, 0x7, 0x0,
-    0x0, 0x1c, 0x0, 0x0, 0x70, 0x1, 0xff, 0xff,
-    0xc1, 0x5b, 0x55, 0x0, 0x1c, 0x0, 0x0, 0x70,
-    0x0, 0x1, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0x55, 0x51, 0xff, 0xff, 0xc0,
-
-    /* U+B2 "²" */
-    0x1b, 0xf4, 0xd, 0x3, 0x80, 0x0, 0x70, 0x0,
-    0x28, 0x0, 0x2c, 0x0, 0x28, 0x0, 0x38, 0x0,
-    0x34, 0x0, 0x3f, 0xff, 0x40,
-
-    /* U+BA "º" */
-    0x7, 0xf8, 0xb, 0x2, 0x83, 0x0, 0x30, 0xc0,
-    0xd, 0x30, 0x3, 0xb, 0x3, 0x80, 0x7f, 0x80,
-
-    /* U+C0 "À" */
-    0x0, 0x7c, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x1c, 0x70, 0x0,
-    0x0, 0x38, 0x38, 0x0, 0x0, 0x70, 0x1c, 0x0,
-    0x0, 0xe0, 0xe, 0x0, 0x0, 0xd0, 0xb, 0x0,
-    0x2, 0xc0, 0x3, 0x40, 0x3, 0x40, 0x2, 0xc0,
-    0xb, 0xff, 0xff, 0xd0, 0xe, 0x55, 0x55, 0xf0,
-    0x1c, 0x0, 0x0, 0x70, 0x38, 0x0, 0x0, 0x38,
-    0x74, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x0, 0xe,
-
-    /* U+C1 "Á" */
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x1c, 0x70, 0x0,
-    0x0, 0x38, 0x38, 0x0, 0x0, 0x70, 0x1c, 0x0,
-    0x0, 0xe0, 0xe, 0x0, 0x0, 0xd0, 0xb, 0x0,
-    0x2, 0xc0, 0x3, 0x40, 0x3, 0x40, 0x2, 0xc0,
-    0xb, 0xff, 0xff, 0xd0, 0xe, 0x55, 0x55, 0xf0,
-    0x1c, 0x0, 0x0, 0x70, 0x38, 0x0, 0x0, 0x38,
-    0x74, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x0, 0xe,
-
-    /* U+C2 "Â" */
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x1d, 0xb0, 0x0,
-    0x0, 0x74, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x1c, 0x70, 0x0,
-    0x0, 0x38, 0x38, 0x0, 0x0, 0x70, 0x1c, 0x0,
-    0x0, 0xe0, 0xe, 0x0, 0x0, 0xd0, 0xb, 0x0,
-    0x2, 0xc0, 0x3, 0x40, 0x3, 0x40, 0x2, 0xc0,
-    0xb, 0xff, 0xff, 0xd0, 0xe, 0x55, 0x55, 0xf0,
-    0x1c, 0x0, 0x0, 0x70, 0x38, 0x0, 0x0, 0x38,
-    0x74, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x0, 0xe,
-
-    /* U+C3 "Ã" */
-    0x0, 0x2d, 0x9, 0x0, 0x0, 0x72, 0x4c, 0x0,
-    0x0, 0x50, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x1c, 0x70, 0x0,
-    0x0, 0x38, 0x38, 0x0, 0x0, 0x70, 0x1c, 0x0,
-    0x0, 0xe0, 0xe, 0x0, 0x0, 0xd0, 0xb, 0x0,
-    0x2, 0xc0, 0x3, 0x40, 0x3, 0x40, 0x2, 0xc0,
-    0xb, 0xff, 0xff, 0xd0, 0xe, 0x55, 0x55, 0xf0,
-    0x1c, 0x0, 0x0, 0x70, 0x38, 0x0, 0x0, 0x38,
-    0x74, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x0, 0xe,
-
-    /* U+C7 "Ç" */
-    0x0, 0x2f, 0xf9, 0x0, 0x2f, 0xaa, 0xfc, 0xb,
-    0x80, 0x1, 0xe2, 0xe0, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x7, 0x40, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x2e, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x1e, 0x2, 0xfe, 0xaf, 0xc0, 0x2, 0xff, 0x90,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0xfd, 0x0,
-
-    /* U+C9 "É" */
-    0x0, 0x3, 0xc0, 0x0, 0xe, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x79,
-    0x55, 0x54, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x70, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x75, 0x55, 0x50, 0x70,
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x79, 0x55,
-    0x54, 0x7f, 0xff, 0xfd,
-
-    /* U+CA "Ê" */
-    0x0, 0x7c, 0x0, 0x1, 0xdb, 0x0, 0x7, 0x2,
-    0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x79,
-    0x55, 0x54, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x70, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x75, 0x55, 0x50, 0x70,
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x70, 0x0, 0x0, 0x70, 0x0, 0x0, 0x79, 0x55,
-    0x54, 0x7f, 0xff, 0xfd,
-
-    /* U+CD "Í" */
-    0x2, 0xd0, 0xb4, 0x2c, 0x0, 0x0, 0x1c, 0x1,
-    0xc0, 0x1c, 0x1, 0xc0, 0x1c, 0x1, 0xc0, 0x1c,
-    0x1, 0xc0, 0x1c, 0x1, 0xc0, 0x1c, 0x1, 0xc0,
-    0x1c, 0x1, 0xc0, 0x1c, 0x1, 0xc0,
-
-    /* U+D3 "Ó" */
-    0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x0, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0xbe, 0xab,
-    0xf0, 0x0, 0xb8, 0x0, 0x1f, 0x0, 0x78, 0x0,
-    0x0, 0xf0, 0x38, 0x0, 0x0, 0x1e, 0x1d, 0x0,
-    0x0, 0x3, 0xcb, 0x0, 0x0, 0x0, 0xb3, 0xc0,
-    0x0, 0x0, 0x1d, 0xf0, 0x0, 0x0, 0x7, 0x6c,
-    0x0, 0x0, 0x2, 0xc7, 0x40, 0x0, 0x0, 0xf0,
-    0xe0, 0x0, 0x0, 0x78, 0x1e, 0x0, 0x0, 0x3c,
-    0x2, 0xe0, 0x0, 0x7c, 0x0, 0x2f, 0xaa, 0xfc,
-    0x0, 0x0, 0xbf, 0xe4, 0x0,
-
-    /* U+D4 "Ô" */
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x7, 0x4e, 0x0,
-    0x0, 0x1, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0xbe, 0xab,
-    0xf0, 0x0, 0xb8, 0x0, 0x1f, 0x0, 0x78, 0x0,
-    0x0, 0xf0, 0x38, 0x0, 0x0, 0x1e, 0x1d, 0x0,
-    0x0, 0x3, 0xcb, 0x0, 0x0, 0x0, 0xb3, 0xc0,
-    0x0, 0x0, 0x1d, 0xf0, 0x0, 0x0, 0x7, 0x6c,
-    0x0, 0x0, 0x2, 0xc7, 0x40, 0x0, 0x0, 0xf0,
-    0xe0, 0x0, 0x0, 0x78, 0x1e, 0x0, 0x0, 0x3c,
-    0x2, 0xe0, 0x0, 0x7c, 0x0, 0x2f, 0xaa, 0xfc,
-    0x0, 0x0, 0xbf, 0xe4, 0x0,
-
-    /* U+D5 "Õ" */
-    0x0, 0x1e, 0x6, 0x0, 0x0, 0xd, 0x62, 0x40,
-    0x0, 0x2, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0xbe, 0xab,
-    0xf0, 0x0, 0xb8, 0x0, 0x1f, 0x0, 0x78, 0x0,
-    0x0, 0xf0, 0x38, 0x0, 0x0, 0x1e, 0x1d, 0x0,
-    0x0, 0x3, 0xcb, 0x0, 0x0, 0x0, 0xb3, 0xc0,
-    0x0, 0x0, 0x1d, 0xf0, 0x0, 0x0, 0x7, 0x6c,
-    0x0, 0x0, 0x2, 0xc7, 0x40, 0x0, 0x0, 0xf0,
-    0xe0, 0x0, 0x0, 0x78, 0x1e, 0x0, 0x0, 0x3c,
-    0x2, 0xe0, 0x0, 0x7c, 0x0, 0x2f, 0xaa, 0xfc,
-    0x0, 0x0, 0xbf, 0xe4, 0x0,
-
-    /* U+DA "Ú" */
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x2, 0xcb, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x2,
-    0xcb, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x2, 0xcb,
-    0x0, 0x0, 0x2c, 0xb0, 0x0, 0x2, 0xcb, 0x0,
-    0x0, 0x2c, 0xb0, 0x0, 0x2, 0xcb, 0x0, 0x0,
-    0x2c, 0xb0, 0x0, 0x2, 0xc7, 0x40, 0x0, 0x38,
-    0x3c, 0x0, 0x7, 0x41, 0xe0, 0x1, 0xf0, 0xb,
-    0xea, 0xfc, 0x0, 0x1b, 0xfd, 0x0,
-
-    /* U+E0 "à" */
-    0xf, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe0, 0x3e,
-    0x5b, 0xc1, 0x0, 0x1e, 0x0, 0x0, 0xf0, 0x0,
-    0xb, 0xb, 0xff, 0xf3, 0xd0, 0xb, 0xb0, 0x0,
-    0xbf, 0x0, 0xf, 0xb0, 0x1, 0xf3, 0xd1, 0xbb,
-    0xb, 0xf8, 0xb0,
-
-    /* U+E1 "á" */
-    0x0, 0xb, 0x40, 0x2, 0xd0, 0x0, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe0, 0x3e,
-    0x5b, 0xc1, 0x0, 0x1e, 0x0, 0x0, 0xf0, 0x0,
-    0xb, 0xb, 0xff, 0xf3, 0xd0, 0xb, 0xb0, 0x0,
-    0xbf, 0x0, 0xf, 0xb0, 0x1, 0xf3, 0xd1, 0xbb,
-    0xb, 0xf8, 0xb0,
-
-    /* U+E2 "â" */
-    0x0, 0xf8, 0x0, 0x39, 0xd0, 0xe, 0x3, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe0, 0x3e,
-    0x5b, 0xc1, 0x0, 0x1e, 0x0, 0x0, 0xf0, 0x0,
-    0xb, 0xb, 0xff, 0xf3, 0xd0, 0xb, 0xb0, 0x0,
-    0xbf, 0x0, 0xf, 0xb0, 0x1, 0xf3, 0xd1, 0xbb,
-    0xb, 0xf8, 0xb0,
-
-    /* U+E3 "ã" */
-    0x7, 0xc1, 0x80, 0xc7, 0x24, 0xc, 0x1e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe0, 0x3e,
-    0x5b, 0xc1, 0x0, 0x1e, 0x0, 0x0, 0xf0, 0x0,
-    0xb, 0xb, 0xff, 0xf3, 0xd0, 0xb, 0xb0, 0x0,
-    0xbf, 0x0, 0xf, 0xb0, 0x1, 0xf3, 0xd1, 0xbb,
-    0xb, 0xf8, 0xb0,
-
-    /* U+E7 "ç" */
-    0x1, 0xff, 0x40, 0x3e, 0x5b, 0xc3, 0xc0, 0x7,
-    0x1d, 0x0, 0x0, 0xf0, 0x0, 0x3, 0x80, 0x0,
-    0xe, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x74, 0x0,
-    0x0, 0xf0, 0x1, 0xc0, 0xf9, 0x6f, 0x0, 0x7f,
-    0xd0, 0x0, 0x30, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0xd0, 0x0, 0x7e, 0x0,
-
-    /* U+E9 "é" */
-    0x0, 0x7, 0x80, 0x0, 0x1e, 0x0, 0x0, 0x34,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x40, 0xf, 0x97, 0xe0, 0x3c, 0x0, 0x74,
-    0x70, 0x0, 0x2c, 0xe0, 0x0, 0x1c, 0xff, 0xff,
-    0xfc, 0xe0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x74,
-    0x0, 0x0, 0x3c, 0x0, 0x30, 0xf, 0x96, 0xf0,
-    0x1, 0xff, 0x80,
-
-    /* U+EA "ê" */
-    0x0, 0xbc, 0x0, 0x2, 0xdf, 0x0, 0x7, 0x2,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x40, 0xf, 0x97, 0xe0, 0x3c, 0x0, 0x74,
-    0x70, 0x0, 0x2c, 0xe0, 0x0, 0x1c, 0xff, 0xff,
-    0xfc, 0xe0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x74,
-    0x0, 0x0, 0x3c, 0x0, 0x30, 0xf, 0x96, 0xf0,
-    0x1, 0xff, 0x80,
-
-    /* U+ED "í" */
-    0x3, 0xc0, 0xf0, 0x38, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x38, 0x3, 0x80, 0x38, 0x3, 0x80, 0x38,
-    0x3, 0x80, 0x38, 0x3, 0x80, 0x38, 0x3, 0x80,
-    0x38, 0x0,
-
-    /* U+F3 "ó" */
-    0x0, 0x3, 0xc0, 0x0, 0xf, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0xf, 0x96, 0xf0, 0x3c, 0x0, 0x78,
-    0x74, 0x0, 0x1d, 0xf0, 0x0, 0xe, 0xe0, 0x0,
-    0xe, 0xe0, 0x0, 0xe, 0xf0, 0x0, 0xe, 0x74,
-    0x0, 0x1c, 0x3c, 0x0, 0x78, 0xf, 0x96, 0xf0,
-    0x1, 0xff, 0x40,
-
-    /* U+F4 "ô" */
-    0x0, 0x7c, 0x0, 0x1, 0xdb, 0x0, 0x3, 0x42,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0xf, 0x96, 0xf0, 0x3c, 0x0, 0x78,
-    0x74, 0x0, 0x1d, 0xf0, 0x0, 0xe, 0xe0, 0x0,
-    0xe, 0xe0, 0x0, 0xe, 0xf0, 0x0, 0xe, 0x74,
-    0x0, 0x1c, 0x3c, 0x0, 0x78, 0xf, 0x96, 0xf0,
-    0x1, 0xff, 0x40,
-
-    /* U+F5 "õ" */
-    0x2, 0xd0, 0x90, 0x7, 0x24, 0xc0, 0x9, 0xb,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0xf, 0x96, 0xf0, 0x3c, 0x0, 0x78,
-    0x74, 0x0, 0x1d, 0xf0, 0x0, 0xe, 0xe0, 0x0,
-    0xe, 0xe0, 0x0, 0xe, 0xf0, 0x0, 0xe, 0x74,
-    0x0, 0x1c, 0x3c, 0x0, 0x78, 0xf, 0x96, 0xf0,
-    0x1, 0xff, 0x40,
-
-    /* U+FA "ú" */
-    0x0, 0xb, 0x40, 0x0, 0xb4, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0xee, 0x0, 0x3, 0xb8, 0x0, 0xe, 0xe0, 0x0,
-    0x3b, 0x80, 0x0, 0xee, 0x0, 0x3, 0xb8, 0x0,
-    0xe, 0xe0, 0x0, 0x3b, 0xc0, 0x1, 0xe7, 0x40,
-    0xf, 0x8b, 0x96, 0xee, 0x7, 0xfd, 0x38,
-
-    /* U+20AC "€" */
-    0x0, 0x0, 0xbf, 0xe0, 0x0, 0x2, 0xfa, 0xaf,
-    0x80, 0x3, 0xe0, 0x0, 0x74, 0x2, 0xd0, 0x0,
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xd0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x1, 0xd0, 0x0, 0xbe, 0xab, 0xe0,
-    0x0, 0x2, 0xff, 0x80,
-
-    /* U+2122 "™" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1c,
-    0x0, 0x7, 0x1, 0x80, 0x1f, 0x0, 0xf, 0x1,
-    0x80, 0x1f, 0x40, 0x2b, 0x1, 0x80, 0x1c, 0xc0,
-    0x73, 0x1, 0x80, 0x1c, 0xa0, 0xc3, 0x1, 0x80,
-    0x1c, 0x36, 0x83, 0x1, 0x80, 0x1c, 0x1f, 0x3,
-    0x1, 0x80, 0x1c, 0x9, 0x3, 0x1, 0x80, 0xc,
-    0x0, 0x3
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 92, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 92, .box_w = 3, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12, .adv_w = 131, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 21, .adv_w = 245, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 81, .adv_w = 216, .box_w = 12, .box_h = 22, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 147, .adv_w = 292, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 219, .adv_w = 235, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 279, .adv_w = 71, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 282, .adv_w = 116, .box_w = 5, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 309, .adv_w = 116, .box_w = 5, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 336, .adv_w = 136, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 357, .adv_w = 202, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 385, .adv_w = 75, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 390, .adv_w = 134, .box_w = 7, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 396, .adv_w = 75, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 399, .adv_w = 118, .box_w = 10, .box_h = 22, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 454, .adv_w = 233, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 506, .adv_w = 127, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 530, .adv_w = 200, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 578, .adv_w = 199, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 626, .adv_w = 233, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 686, .adv_w = 199, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 734, .adv_w = 214, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 782, .adv_w = 207, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 834, .adv_w = 225, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 882, .adv_w = 214, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 934, .adv_w = 75, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 943, .adv_w = 75, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 955, .adv_w = 202, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 983, .adv_w = 202, .box_w = 11, .box_h = 8, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 1005, .adv_w = 202, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1033, .adv_w = 200, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1077, .adv_w = 364, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1182, .adv_w = 252, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1246, .adv_w = 265, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1302, .adv_w = 253, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1358, .adv_w = 291, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1422, .adv_w = 235, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1470, .adv_w = 223, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1518, .adv_w = 272, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1574, .adv_w = 286, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1630, .adv_w = 106, .box_w = 3, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1642, .adv_w = 176, .box_w = 10, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1682, .adv_w = 250, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1738, .adv_w = 207, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1782, .adv_w = 336, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1850, .adv_w = 286, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1906, .adv_w = 295, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1974, .adv_w = 253, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2026, .adv_w = 295, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2116, .adv_w = 254, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2168, .adv_w = 216, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2216, .adv_w = 202, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2268, .adv_w = 279, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2324, .adv_w = 246, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2388, .adv_w = 391, .box_w = 24, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2484, .adv_w = 231, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2544, .adv_w = 224, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2600, .adv_w = 229, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2656, .adv_w = 112, .box_w = 5, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 2683, .adv_w = 118, .box_w = 9, .box_h = 22, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 2733, .adv_w = 112, .box_w = 5, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2760, .adv_w = 203, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 2785, .adv_w = 176, .box_w = 11, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2791, .adv_w = 211, .box_w = 7, .box_h = 3, .ofs_x = 2, .ofs_y = 14},
-    {.bitmap_index = 2797, .adv_w = 208, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2827, .adv_w = 239, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2878, .adv_w = 198, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2911, .adv_w = 239, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2962, .adv_w = 213, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2998, .adv_w = 119, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3037, .adv_w = 241, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3085, .adv_w = 238, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3132, .adv_w = 95, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3149, .adv_w = 96, .box_w = 7, .box_h = 21, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 3186, .adv_w = 212, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3237, .adv_w = 95, .box_w = 2, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3246, .adv_w = 373, .box_w = 20, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3306, .adv_w = 238, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3339, .adv_w = 221, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3375, .adv_w = 239, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 3423, .adv_w = 239, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3471, .adv_w = 141, .box_w = 7, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3492, .adv_w = 172, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3525, .adv_w = 143, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3559, .adv_w = 237, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3592, .adv_w = 191, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3628, .adv_w = 309, .box_w = 20, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3688, .adv_w = 188, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3724, .adv_w = 191, .box_w = 13, .box_h = 16, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 3776, .adv_w = 180, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3809, .adv_w = 118, .box_w = 6, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3841, .adv_w = 104, .box_w = 2, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 3852, .adv_w = 118, .box_w = 7, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 3889, .adv_w = 202, .box_w = 11, .box_h = 5, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 3903, .adv_w = 285, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3967, .adv_w = 141, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 3981, .adv_w = 285, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4045, .adv_w = 202, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4084, .adv_w = 151, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 4105, .adv_w = 146, .box_w = 9, .box_h = 7, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 4121, .adv_w = 252, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4201, .adv_w = 252, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4281, .adv_w = 252, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4361, .adv_w = 252, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4441, .adv_w = 253, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4511, .adv_w = 235, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4571, .adv_w = 235, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4631, .adv_w = 106, .box_w = 6, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4661, .adv_w = 295, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4746, .adv_w = 295, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4831, .adv_w = 295, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4916, .adv_w = 279, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4986, .adv_w = 208, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5029, .adv_w = 208, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5072, .adv_w = 208, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5115, .adv_w = 208, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5158, .adv_w = 198, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5202, .adv_w = 213, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5253, .adv_w = 213, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5304, .adv_w = 95, .box_w = 6, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5330, .adv_w = 221, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5381, .adv_w = 221, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5432, .adv_w = 221, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5483, .adv_w = 237, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5530, .adv_w = 282, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5598, .adv_w = 359, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 6}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x1, 0x5, 0x8, 0x9, 0x11, 0x17, 0x18,
-    0x19, 0x1a, 0x1e, 0x20, 0x21, 0x24, 0x2a, 0x2b,
-    0x2c, 0x31, 0x37, 0x38, 0x39, 0x3a, 0x3e, 0x40,
-    0x41, 0x44, 0x4a, 0x4b, 0x4c, 0x51, 0x2003, 0x2079
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 169, .range_length = 8314, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    22, 8, 22, 0, 0, 8, 23, 23,
-    23, 23, 25, 26, 26, 29, 22, 22,
-    22, 30, 45, 45, 45, 45, 47, 49,
-    49, 51, 46, 46, 46, 51, 25, 61
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    23, 8, 23, 0, 0, 8, 24, 24,
-    24, 24, 23, 25, 25, 25, 23, 23,
-    23, 28, 37, 37, 37, 37, 39, 39,
-    39, 42, 39, 39, 39, 45, 49, 50
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 4, 0, 0, 0,
-    0, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2, 1, 16, 0, 10, -9, 0,
-    0, 0, 0, -19, -21, 3, 17, 9,
-    6, -14, 3, 19, 1, 16, 4, 12,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 21, 2, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, 13, 0, -11, 0, 0,
-    0, 0, 0, -7, 6, 7, 0, 0,
-    -4, 0, -3, 4, 0, -4, 0, -4,
-    -2, -7, 0, 0, 0, 0, -4, 0,
-    0, -5, -5, 0, 0, -4, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, -4, 0, 0, 0, 0, -10,
-    0, -42, 0, 0, -7, 0, 7, 11,
-    0, 0, -7, 4, 4, 12, 7, -6,
-    7, 0, 0, -20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, -19, 0, -14, -3, 0, 0, 0,
-    0, 2, 15, 0, -11, -2, -1, 1,
-    0, -6, 0, 0, -2, -27, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -28, -2, 16, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -11, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 11, 0, 4, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 12, 2, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -13, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 2, 7,
-    4, 11, -4, 0, 0, 7, -4, -11,
-    -49, 3, 10, 7, 1, -5, 0, 14,
-    0, 12, 0, 12, 0, -32, 0, -4,
-    11, 0, 12, -4, 7, 4, 0, 0,
-    1, -4, 0, 0, -6, 28, 0, 28,
-    0, 11, 0, 16, 4, 6, 3, 14,
-    0, 0, 0, -13, 0, 0, 0, 0,
-    1, -2, 0, 3, -6, -4, -7, 3,
-    0, -4, 0, 0, 0, -14, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -23, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    3, -7, 1, -19, 0, -22, 0, 0,
-    0, 0, -2, 0, 36, -4, -4, 4,
-    4, -5, 0, -4, 4, 0, 0, -18,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -34, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, -14, 0, 21, 0, 0,
-    -13, 0, 11, 0, -24, -34, -23, -7,
-    11, 0, 0, -24, 0, 5, -8, 0,
-    -5, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 11, 11, -44,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 17, 0, 3,
-    0, 0, 0, 0, 0, 3, 3, -4,
-    -7, 0, -1, -1, -4, 0, 0, -3,
-    0, 0, 0, -7, 0, -2, 0, -8,
-    -7, 0, -9, -11, -11, -7, 0, -7,
-    0, -7, 0, 0, 0, 0, -3, 0,
-    0, 4, 0, 3, -4, 0, 0, 0,
-    0, 0, 0, 4, -3, 0, 0, 0,
-    -3, 4, 4, -1, 0, 0, 0, -8,
-    0, -1, 0, 0, 0, 0, 0, 1,
-    0, 4, -3, 0, -4, 0, -6, 0,
-    0, -3, 0, 11, 0, 0, -4, 0,
-    0, 0, 0, 0, -1, 1, -3, -3,
-    0, 0, 0, -4, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    -2, 0, -4, -5, 0, 0, 0, 0,
-    0, 1, 0, 0, -2, 0, -4, -4,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, -2,
-    -4, 0, 0, 0, 0, -11, -3, -11,
-    7, 0, 0, -7, 4, 7, 10, 0,
-    -9, -1, -5, 0, -1, -18, 4, -3,
-    2, -18, 4, 0, 0, 1, -18, 0,
-    -18, -2, -30, -3, 0, -18, 0, 7,
-    10, 0, 4, 0, 0, 0, 0, 0,
-    0, -5, -4, 0, 4, -7, 0, 0,
-    0, -4, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, -2, -2, 0, -2, -5,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    -4, 0, -2, -4, -3, 0, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, -2, 0, 0, 0,
-    0, -3, 0, -7, 4, 0, 0, -5,
-    2, 4, 4, 0, 0, 0, 0, 0,
-    0, -3, 0, 0, 0, 0, 0, 3,
-    0, 0, -4, 0, -4, -3, -5, 0,
-    0, 0, 0, 0, 0, 0, 3, 0,
-    -3, 0, 0, 0, 0, -3, -5, 0,
-    4, 0, 0, 11, -3, 1, -12, 0,
-    0, 10, -18, -19, -15, -7, 4, 0,
-    -3, -23, -7, 0, -7, 0, -7, 5,
-    -7, -23, 0, -10, 0, 0, 2, -1,
-    2, -3, 0, 4, -1, -11, -14, 0,
-    -18, -9, -7, -9, -11, -5, -10, -2,
-    -8, -11, -7, 14, 0, 1, 0, -4,
-    0, 0, 0, 3, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, 0, -2, 0, -1, -4, 0,
-    -6, -7, -7, -1, 0, -11, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, 2, -1, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    16, 0, 0, 0, 0, 0, 0, 3,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -6,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, -8, 0, 0, 0,
-    0, -18, -11, 0, 0, 0, -5, -18,
-    0, 0, -4, 4, 0, -11, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, 0, 0, -7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -7, 0, 0, 0, 0,
-    5, 0, 3, -7, -7, 0, -4, -4,
-    -4, 0, 0, 0, 0, 0, 0, -11,
-    0, -4, 0, -5, -4, 0, -7, -9,
-    -11, -3, 0, -7, 0, -11, 0, 0,
-    0, 0, 28, 0, 0, 2, 0, 0,
-    -4, 0, 0, 2, 0, -15, 0, 0,
-    0, 0, 0, -32, -5, 12, 11, -2,
-    -14, 0, 4, -5, 0, -18, -2, -5,
-    4, -25, -4, 3, 0, 5, -12, -5,
-    -13, -11, -14, 0, 0, -21, 0, 20,
-    0, 0, -2, 0, 0, 0, -2, -2,
-    -4, -9, -11, 0, 0, -25, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, -2, -4, -5, 0, 0, -7,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -1, 0, -7, 0, 0, 7,
-    -1, 5, 0, -8, 4, -3, -1, -11,
-    -4, 0, -5, -4, -2, 0, -5, -6,
-    0, 0, -3, -1, -3, -6, -5, 0,
-    0, -4, 0, 4, -3, 0, -8, 0,
-    0, 0, -7, 0, -6, 0, -6, -6,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, 4, 0, -6, 0, -3,
-    -5, -13, -3, -3, -3, -1, -3, -5,
-    -1, 0, 0, 0, 0, 0, -4, -3,
-    -3, 0, 0, 0, 0, 5, -3, 0,
-    -3, 0, 0, 0, -3, -5, -3, -4,
-    -5, -4, 0, 0, 2, 14, -1, 0,
-    -11, 0, -3, 7, 0, -4, -15, -5,
-    5, 0, 0, -18, -6, 4, -6, 2,
-    0, -4, -3, -12, 0, -5, 2, 0,
-    0, -6, 0, 0, 0, 4, 4, -7,
-    -7, 0, -6, -4, -5, -4, -4, 0,
-    -6, 2, -7, -6, 0, 11, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -6,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -5, 0, 0, -5, 0, 0, -4,
-    -4, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, 0, -5, 0,
-    -7, 0, 0, 0, -11, 0, 3, -7,
-    7, 0, -3, -17, 0, 0, -7, -4,
-    0, -14, -9, -10, 0, 0, -14, -4,
-    -14, -13, -17, 0, -11, 0, 2, 24,
-    -5, 0, -8, -4, -1, -4, -6, -10,
-    -7, -13, -14, -8, 0, 7, 0, 0,
-    -3, 0, 1, 0, 0, -25, -5, 11,
-    9, -9, -13, 0, 1, -13, 0, -18,
-    -3, -4, 7, -33, -5, 1, 0, 0,
-    -23, -5, -19, -4, -26, 0, 0, -25,
-    0, 22, 1, 0, -3, 0, 0, 0,
-    0, -2, -3, -14, -3, 0, 0, -23,
-    0, 0, 0, 0, -12, 0, -4, 0,
-    -1, -10, -17, 0, 0, -2, -5, -11,
-    -4, 0, -2, 0, 0, 0, 0, -16,
-    -4, -12, -12, -2, -6, -9, -4, -6,
-    0, -7, -4, -11, -5, 0, -5, -8,
-    -4, -8, 0, 2, 0, -3, -12, 0,
-    0, 0, 0, -7, 0, 0, 0, 0,
-    5, 0, 3, -7, 13, 0, -4, -4,
-    -4, 0, 0, 0, 0, 0, 0, -11,
-    0, -4, 0, -5, -4, 0, -7, -9,
-    -11, -3, 0, -7, 2, 14, 0, 0,
-    0, 0, 28, 0, 0, 2, 0, 0,
-    -4, 0, 0, 2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -7, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, -4, -4, 0,
-    0, -7, -4, 0, 0, -7, 0, 6,
-    -2, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, 0, 0, 7, 2,
-    -4, 0, -12, -7, 0, 11, -11, -11,
-    -7, -7, 14, 5, 4, -31, -2, 7,
-    -4, 0, -4, 2, -4, -12, 0, -4,
-    4, -5, -2, -11, -2, 0, 0, 11,
-    7, 0, -10, 0, -19, -5, 8, -5,
-    -14, 1, -5, -12, -12, -4, 0, 18,
-    4, 0, -5, 0, -10, 0, 2, 12,
-    -8, -13, -14, -9, 11, 0, 1, -25,
-    -2, 4, -6, -2, -8, 0, -7, -13,
-    -5, -5, -2, 0, 0, -8, -7, -4,
-    0, 11, 8, -4, -19, 0, -19, -6,
-    0, -12, -20, -1, -11, -6, -12, -10,
-    0, 14, 0, 0, -5, 0, -7, -4,
-    0, -4, -6, 0, 6, -11, 4, 0,
-    0, -18, 0, -4, -7, -6, -2, -11,
-    -9, -11, -8, 0, -11, -4, -8, -8,
-    -11, -4, 0, 0, 1, 17, -6, 0,
-    -11, -4, 0, -4, -7, -8, -9, -9,
-    -12, -4, 0, 11, 7, 0, -5, 0,
-    -18, -5, 1, 7, -11, -13, -7, -11,
-    11, -4, 2, -32, -6, 7, -7, -6,
-    -13, 0, -11, -14, -5, -4, -2, -4,
-    -7, -11, -1, 0, 0, 11, 9, -3,
-    -23, 0, -21, -10, 7, -14, -24, -7,
-    -12, -14, -18, -11, 0, 18, 0, 0,
-    0, 0, -5, 0, 0, 4, -5, 7,
-    3, -7, 7, 0, 0, -13, -1, 0,
-    -1, 0, 1, 1, -3, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    2, 11, 0, 0, -5, 0, 0, 0,
-    0, -3, -3, -5, 0, 0, 0, 11,
-    1, 2, 0, 0, 0, 0, 2, 0,
-    -4, 0, 12, 0, 5, 1, 1, -4,
-    0, 7, 0, 0, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 11, 0, 9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 16, 0, -21, 0, -4, 6, 0,
-    11, 0, 0, 36, 5, -7, -7, 4,
-    4, -3, 1, -18, 0, 0, 16, -21,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -23, 12, 49, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -21, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, 0,
-    0, -8, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, -10, 0, 0, 1, 0, 0, 4,
-    47, -7, -3, 12, 10, -10, 4, 0,
-    0, 4, 4, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -46,
-    9, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -3, -18,
-    0, 0, 0, -10, 0, 0, 0, -10,
-    0, 0, 0, 0, -8, -2, 0, 0,
-    0, -8, 0, -5, 0, -17, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -24, 0, 0, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, -4, 0, 0,
-    0, -10, 0, -5, 0, -10, 0, 0,
-    0, -6, 4, -5, 0, 0, -10, -4,
-    -8, 0, 0, -10, 0, -4, 0, -17,
-    0, -2, 0, 0, -30, -8, -14, -2,
-    -12, 0, 0, -24, 0, -10, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -5,
-    -7, -3, 0, -11, 0, 0, 0, 0,
-    -9, 0, -7, 4, -2, 7, 0, -3,
-    -8, -3, -6, -8, 0, -5, -2, -3,
-    2, -10, -1, 0, 0, 0, -33, -2,
-    -4, 0, -5, 0, -3, -17, -4, 0,
-    0, -3, -3, 0, 0, 0, 0, 2,
-    0, -3, -6, -3, 0, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, -9, 0, -3, 0, 0, 0, -7,
-    4, 0, 0, 0, -10, -4, -7, 0,
-    0, -10, 0, -4, 0, -17, 0, 0,
-    0, 0, -34, 0, -7, -13, -18, 0,
-    0, -24, 0, -2, -5, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, -5, -2,
-    0, -11, 1, 0, 0, 6, -4, 0,
-    10, 19, -4, -4, -11, 5, 19, 6,
-    9, -10, 5, 16, 5, 11, 9, 10,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 23, 17, -5, -4, 0,
-    -3, 28, 15, 28, 0, 0, 0, 4,
-    0, 0, 0, 28, 0, 0, -7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, -32, -5,
-    -2, -15, -19, 0, 0, -24, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 4, 0, 0, 0, 0,
-    -32, -5, -2, -15, -19, 0, 0, -18,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    -8, 4, 0, -4, 2, 5, 4, -11,
-    0, -2, -2, 4, 0, 2, 0, 0,
-    0, 0, -11, 0, -4, -3, -7, 0,
-    -4, -14, 0, 23, -4, 0, -7, -3,
-    0, -3, -6, 0, -4, -10, -7, -4,
-    0, 0, 0, 0, -7, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, -32, -5, -2, -15,
-    -19, 0, 0, -24, 0, 0, 0, 0,
-    0, 0, 18, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, 0,
-    -12, -5, -4, 11, -4, -4, -14, 1,
-    -4, 1, -3, -11, 0, 7, 0, 2,
-    1, 2, -9, -13, -5, 0, -16, -8,
-    -10, -15, -14, 0, -7, -7, -5, -4,
-    -3, -3, -5, -3, 0, -3, -1, 5,
-    0, 5, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -4, -4, 0, 0, -10,
-    0, -2, 0, -6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -21,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, -6,
-    0, 0, 0, 0, -3, 0, 0, -6,
-    -4, 4, 0, -6, -7, -3, 0, -12,
-    -3, -9, -2, -5, 0, -6, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -24, 0, 12, 0, 0, -7, 0,
-    0, 0, 0, -5, 0, -4, 0, 0,
-    0, -10, 0, 0, -3, 0, -8, 0,
-    0, 16, -4, -12, -10, 3, 2, 2,
-    -2, -9, 3, 5, 3, 11, 3, 11,
-    -3, -9, 0, 0, -18, 0, 0, -11,
-    -10, 0, 0, -7, 0, -4, -6, 0,
-    -5, 0, -5, 0, -2, 5, 0, -2,
-    -11, -4, 0, 0, 0, 0, -4, 0,
-    -7, 0, 0, 4, -8, 0, 4, -4,
-    2, -1, 0, -11, 0, -3, -1, 0,
-    -4, 2, -2, 0, 0, 0, -17, -5,
-    -7, 0, -11, 0, 0, -17, 0, 13,
-    -4, 0, -7, 0, -1, 0, -4, 0,
-    -4, -11, 0, -4, 0, 0, 0, 0,
-    0, 0, -3, 0, 0, 4, -5, 1,
-    0, 0, -5, -3, 0, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -23,
-    0, 9, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    4, 0, -16, 0, 0, 0, 0, 0,
-    0, 4, 0, 11, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 14, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 61,
-    .right_class_cnt     = 50,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t sr_font_montserrat_22 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 24,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if SR_FONT_MONTSERRAT_22*/
-
@@ -1,1808 +0,0 @@
-#include "lvgl/lvgl.h"
-
-/*******************************************************************************
- * Size: 24 px
- * Bpp: 2
- * Opts: 
- ******************************************************************************/
-
-#ifndef SR_FONT_MONTSERRAT_24
-#define SR_FONT_MONTSERRAT_24 1
-#endif
-
-#if SR_FONT_MONTSERRAT_24
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+20 " " */
-
-    /* U+21 "!" */
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x0, 0x0, 0x14, 0x3d,
-    0x3c,
-
-    /* U+22 "\"" */
-    0x70, 0x35, 0xc0, 0xc7, 0x3, 0x1c, 0xc, 0x70,
-    0x30, 0xc0, 0xc1, 0x1, 0x0,
-
-    /* U+23 "#" */
-    0x0, 0x1c, 0x0, 0xc0, 0x0, 0x28, 0x1, 0xc0,
-    0x0, 0x28, 0x1, 0xc0, 0x0, 0x34, 0x2, 0x80,
-    0x2f, 0xff, 0xff, 0xff, 0x5, 0x75, 0x57, 0x95,
-    0x0, 0x30, 0x3, 0x40, 0x0, 0x70, 0x3, 0x0,
-    0x0, 0x70, 0x3, 0x0, 0x0, 0xa0, 0x7, 0x0,
-    0x0, 0xa0, 0x7, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x15, 0xe5, 0x5e, 0x54, 0x0, 0xd0, 0xd, 0x0,
-    0x0, 0xc0, 0xd, 0x0, 0x1, 0xc0, 0xd, 0x0,
-    0x1, 0xc0, 0xc, 0x0,
-
-    /* U+24 "$" */
-    0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x7, 0xff, 0x90, 0xf, 0xee, 0xbe,
-    0xf, 0x43, 0x1, 0x47, 0x80, 0xc0, 0x1, 0xd0,
-    0x30, 0x0, 0x78, 0xc, 0x0, 0xf, 0x43, 0x0,
-    0x0, 0xfe, 0xc0, 0x0, 0xb, 0xfe, 0x40, 0x0,
-    0xe, 0xfc, 0x0, 0x3, 0x7, 0xc0, 0x0, 0xc0,
-    0x74, 0x0, 0x30, 0xe, 0x0, 0xc, 0x7, 0x6d,
-    0x3, 0x3, 0xc3, 0xfa, 0xeb, 0xd0, 0x1b, 0xff,
-    0x80, 0x0, 0xc, 0x0, 0x0, 0x3, 0x0, 0x0,
-    0x0, 0xc0, 0x0,
-
-    /* U+25 "%" */
-    0xf, 0xe0, 0x0, 0x1c, 0x3, 0x87, 0x80, 0x3,
-    0x40, 0xa0, 0xc, 0x0, 0xa0, 0xd, 0x0, 0x90,
-    0x1c, 0x0, 0xc0, 0xa, 0x3, 0x40, 0xd, 0x0,
-    0xa0, 0xa0, 0x0, 0xa0, 0xd, 0x1c, 0x0, 0x3,
-    0x42, 0xc3, 0x40, 0x0, 0x1f, 0xe0, 0xe0, 0xbe,
-    0x0, 0x0, 0x1c, 0x3d, 0x2c, 0x0, 0x3, 0x47,
-    0x0, 0xe0, 0x0, 0xe0, 0xa0, 0x7, 0x0, 0x1c,
-    0xa, 0x0, 0x70, 0x3, 0x40, 0xa0, 0x7, 0x0,
-    0xe0, 0x7, 0x0, 0xa0, 0x1c, 0x0, 0x38, 0x2c,
-    0x3, 0x40, 0x0, 0xbe, 0x0,
-
-    /* U+26 "&" */
-    0x0, 0xbf, 0x80, 0x0, 0xf, 0x57, 0xc0, 0x0,
-    0xb0, 0x7, 0x40, 0x2, 0xc0, 0xd, 0x0, 0xb,
-    0x0, 0x70, 0x0, 0xe, 0x7, 0x80, 0x0, 0x1e,
-    0xb8, 0x0, 0x0, 0x3f, 0x40, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x78, 0x2d, 0x1, 0x43, 0x80, 0x2d,
-    0xe, 0x2c, 0x0, 0x2d, 0x74, 0xf0, 0x0, 0x2f,
-    0xc2, 0xc0, 0x0, 0x3e, 0x7, 0x80, 0x2, 0xfd,
-    0xb, 0xe5, 0xbe, 0x3d, 0x2, 0xff, 0x80, 0x34,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+27 "'" */
-    0x71, 0xc7, 0x1c, 0x70, 0xc1, 0x0,
-
-    /* U+28 "(" */
-    0x3, 0x81, 0xc0, 0xe0, 0x74, 0x2c, 0xf, 0x3,
-    0x80, 0xd0, 0x74, 0x1d, 0x7, 0x1, 0xc0, 0x70,
-    0x1d, 0x7, 0x40, 0xd0, 0x38, 0xf, 0x2, 0xc0,
-    0x34, 0xe, 0x1, 0xc0, 0x38,
-
-    /* U+29 ")" */
-    0x3c, 0x1, 0xd0, 0xf, 0x0, 0xb0, 0x3, 0x40,
-    0x38, 0x3, 0xc0, 0x2c, 0x1, 0xc0, 0x1d, 0x1,
-    0xd0, 0x1d, 0x1, 0xd0, 0x1d, 0x1, 0xc0, 0x2c,
-    0x3, 0xc0, 0x38, 0x3, 0x40, 0xb0, 0xf, 0x1,
-    0xd0, 0x3c, 0x0,
-
-    /* U+2A "*" */
-    0x0, 0xc0, 0x0, 0x30, 0x7, 0x4c, 0x78, 0x7f,
-    0xf4, 0x3, 0xf0, 0x7, 0xfb, 0x83, 0x4c, 0x38,
-    0x3, 0x0, 0x0, 0xc0, 0x0,
-
-    /* U+2B "+" */
-    0x0, 0x14, 0x0, 0x0, 0x38, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x38, 0x0, 0x7f,
-    0xff, 0xfc, 0x15, 0x7d, 0x54, 0x0, 0x38, 0x0,
-    0x0, 0x38, 0x0, 0x0, 0x38, 0x0, 0x0, 0x38,
-    0x0,
-
-    /* U+2C "," */
-    0x1, 0xeb, 0xce, 0x31, 0xca, 0x0,
-
-    /* U+2D "-" */
-    0x6a, 0xa6, 0xff, 0xe0,
-
-    /* U+2E "." */
-    0x22, 0xf7, 0x40,
-
-    /* U+2F "/" */
-    0x0, 0x0, 0xe0, 0x0, 0xd, 0x0, 0x2, 0xc0,
-    0x0, 0x38, 0x0, 0x3, 0x40, 0x0, 0xb0, 0x0,
-    0xe, 0x0, 0x1, 0xd0, 0x0, 0x2c, 0x0, 0x3,
-    0x80, 0x0, 0x74, 0x0, 0xb, 0x0, 0x0, 0xe0,
-    0x0, 0x1c, 0x0, 0x2, 0xc0, 0x0, 0x38, 0x0,
-    0x7, 0x0, 0x0, 0xb0, 0x0, 0xe, 0x0, 0x1,
-    0xc0, 0x0, 0x2c, 0x0, 0x3, 0x40, 0x0, 0x70,
-    0x0, 0x0,
-
-    /* U+30 "0" */
-    0x0, 0xbf, 0xd0, 0x0, 0x3f, 0xaf, 0xc0, 0xf,
-    0x40, 0x1f, 0x2, 0xd0, 0x0, 0x78, 0x3c, 0x0,
-    0x3, 0xc7, 0x40, 0x0, 0x2d, 0xb0, 0x0, 0x1,
-    0xdb, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x1, 0xd7, 0x40,
-    0x0, 0x2d, 0x3c, 0x0, 0x3, 0xc2, 0xd0, 0x0,
-    0x78, 0xf, 0x40, 0x1f, 0x0, 0x3f, 0xaf, 0xc0,
-    0x0, 0xbf, 0xd0, 0x0,
-
-    /* U+31 "1" */
-    0xff, 0xf6, 0xaf, 0x0, 0xf0, 0xf, 0x0, 0xf0,
-    0xf, 0x0, 0xf0, 0xf, 0x0, 0xf0, 0xf, 0x0,
-    0xf0, 0xf, 0x0, 0xf0, 0xf, 0x0, 0xf0, 0xf,
-    0x0, 0xf0,
-
-    /* U+32 "2" */
-    0x2, 0xff, 0x90, 0xb, 0xfa, 0xfe, 0x7, 0x80,
-    0x3, 0xd0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0xb4, 0x0, 0x0, 0xb4,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0xb4, 0x0, 0x0, 0xb4, 0x0, 0x0, 0xb4, 0x0,
-    0x0, 0xfe, 0xaa, 0xa9, 0x3f, 0xff, 0xff, 0x80,
-
-    /* U+33 "3" */
-    0x3f, 0xff, 0xfe, 0xa, 0xaa, 0xaf, 0x40, 0x0,
-    0x7, 0x80, 0x0, 0x3, 0xc0, 0x0, 0x3, 0xc0,
-    0x0, 0x3, 0xc0, 0x0, 0x2, 0xd0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x15, 0xbc, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0xb, 0x44, 0x0, 0x3, 0xcb, 0x80, 0x2,
-    0xe0, 0xbf, 0xaf, 0xe0, 0x2, 0xff, 0x90, 0x0,
-
-    /* U+34 "4" */
-    0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0xb, 0x40, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0xf0, 0xb, 0x0,
-    0x3, 0xc0, 0xb, 0x0, 0xb, 0x40, 0xb, 0x0,
-    0x1e, 0x0, 0xb, 0x0, 0x3f, 0xff, 0xff, 0xfe,
-    0x2a, 0xaa, 0xaf, 0xa9, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0xb, 0x0,
-
-    /* U+35 "5" */
-    0x7, 0xff, 0xff, 0x2, 0xea, 0xaa, 0x40, 0xb0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0x80, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x3f,
-    0xfe, 0x40, 0xa, 0xaa, 0xfc, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x74, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x1, 0xd3, 0x80, 0x1,
-    0xf0, 0xbf, 0xab, 0xf0, 0x2, 0xff, 0xd0, 0x0,
-
-    /* U+36 "6" */
-    0x0, 0x2f, 0xf9, 0x0, 0xbe, 0xab, 0x80, 0xf8,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x38, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0xb, 0x1, 0x54, 0x2, 0xc7,
-    0xff, 0xe0, 0xb7, 0x80, 0x2e, 0x2f, 0x40, 0x2,
-    0xdb, 0xc0, 0x0, 0x39, 0xe0, 0x0, 0xf, 0x38,
-    0x0, 0x3, 0xcf, 0x0, 0x0, 0xe0, 0xf0, 0x0,
-    0xf0, 0x1f, 0xaa, 0xf4, 0x0, 0xbf, 0xe0, 0x0,
-
-    /* U+37 "7" */
-    0x3f, 0xff, 0xff, 0xc3, 0xea, 0xaa, 0xbc, 0x34,
-    0x0, 0x7, 0x83, 0x40, 0x0, 0xf0, 0x34, 0x0,
-    0xe, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x1d, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xe0,
-    0x0, 0x0, 0x2c, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0xb4, 0x0, 0x0,
-
-    /* U+38 "8" */
-    0x1, 0xff, 0xe0, 0x0, 0xfe, 0xaf, 0xd0, 0x3d,
-    0x0, 0xf, 0x3, 0x80, 0x0, 0x74, 0x38, 0x0,
-    0x3, 0x43, 0xc0, 0x0, 0xb0, 0x1f, 0x40, 0x7e,
-    0x0, 0x3f, 0xff, 0x40, 0x1f, 0x95, 0xbe, 0x3,
-    0xc0, 0x0, 0xb4, 0xb0, 0x0, 0x3, 0xcf, 0x0,
-    0x0, 0x2c, 0xf0, 0x0, 0x2, 0xcb, 0x40, 0x0,
-    0x3c, 0x3d, 0x0, 0xf, 0x41, 0xfe, 0xab, 0xd0,
-    0x1, 0xff, 0xe0, 0x0,
-
-    /* U+39 "9" */
-    0x1, 0xbf, 0x90, 0x0, 0xbe, 0xaf, 0xc0, 0x2e,
-    0x0, 0x1f, 0x3, 0xc0, 0x0, 0x74, 0x38, 0x0,
-    0x3, 0xc3, 0x80, 0x0, 0x3c, 0x3c, 0x0, 0x7,
-    0xc2, 0xe0, 0x1, 0xed, 0xb, 0xea, 0xf9, 0xd0,
-    0x1b, 0xf8, 0x1d, 0x0, 0x0, 0x2, 0xc0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x3d, 0x0, 0xfa, 0xbf, 0x40,
-    0x7, 0xff, 0x40, 0x0,
-
-    /* U+3A ":" */
-    0x76, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x2f, 0x74,
-
-    /* U+3B ";" */
-    0x76, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xbc, 0xe3, 0x1c, 0xa0,
-
-    /* U+3C "<" */
-    0x0, 0x0, 0x4, 0x0, 0x0, 0xbc, 0x0, 0x1f,
-    0xe0, 0x2, 0xf9, 0x0, 0x2f, 0x80, 0x0, 0x7c,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x1, 0xfd, 0x0,
-    0x0, 0xb, 0xe4, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x0,
-
-    /* U+3D "=" */
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x15, 0x55,
-    0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc,
-    0x15, 0x55, 0x54,
-
-    /* U+3E ">" */
-    0x10, 0x0, 0x0, 0x7e, 0x0, 0x0, 0xb, 0xe4,
-    0x0, 0x0, 0x7f, 0x40, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x3c, 0x0, 0x7, 0xf4, 0x0, 0xbe, 0x40,
-    0x1f, 0xe0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+3F "?" */
-    0x2, 0xff, 0x90, 0x2f, 0xea, 0xf8, 0x78, 0x0,
-    0x3d, 0x10, 0x0, 0xe, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf4,
-    0x0, 0x3, 0xd0, 0x0, 0xb, 0x40, 0x0, 0xe,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x2e, 0x0,
-    0x0, 0x1d, 0x0,
-
-    /* U+40 "@" */
-    0x0, 0x1, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0xbe,
-    0x55, 0x6f, 0x40, 0x0, 0xf, 0x40, 0x0, 0x7,
-    0xc0, 0x0, 0xf0, 0x0, 0x0, 0x2, 0xc0, 0xf,
-    0x0, 0x7f, 0xd0, 0xd3, 0x80, 0x70, 0xb, 0xe6,
-    0xf3, 0x43, 0x43, 0x80, 0xb4, 0x0, 0xfd, 0xb,
-    0x1c, 0x3, 0x80, 0x0, 0xf4, 0xc, 0xb0, 0x2c,
-    0x0, 0x2, 0xd0, 0x36, 0x80, 0xf0, 0x0, 0x7,
-    0x40, 0xda, 0x3, 0x80, 0x0, 0xd, 0x2, 0xa8,
-    0xf, 0x0, 0x0, 0x74, 0xa, 0xa0, 0x2c, 0x0,
-    0x2, 0xd0, 0x35, 0xc0, 0x38, 0x0, 0xf, 0x40,
-    0xc3, 0x0, 0xb4, 0x0, 0xfe, 0xb, 0xe, 0x0,
-    0xbe, 0x6f, 0x3d, 0xb4, 0x1c, 0x0, 0x7f, 0xd0,
-    0x3f, 0x40, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x95, 0x5f, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0,
-
-    /* U+41 "A" */
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x7, 0x78, 0x0, 0x0, 0x0, 0xf2,
-    0xc0, 0x0, 0x0, 0x1d, 0xe, 0x0, 0x0, 0x3,
-    0xc0, 0xf0, 0x0, 0x0, 0x38, 0x7, 0x40, 0x0,
-    0xb, 0x0, 0x3c, 0x0, 0x0, 0xe0, 0x1, 0xd0,
-    0x0, 0x2c, 0x0, 0xf, 0x0, 0x3, 0xc0, 0x0,
-    0xb0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0xf, 0x55,
-    0x55, 0x6c, 0x1, 0xd0, 0x0, 0x0, 0xe0, 0x3c,
-    0x0, 0x0, 0xf, 0x7, 0x80, 0x0, 0x0, 0x74,
-    0xb0, 0x0, 0x0, 0x3, 0xc0,
-
-    /* U+42 "B" */
-    0x7f, 0xff, 0xf9, 0x1, 0xfa, 0xaa, 0xbe, 0x7,
-    0x80, 0x0, 0x3d, 0x1e, 0x0, 0x0, 0x3c, 0x78,
-    0x0, 0x0, 0xf1, 0xe0, 0x0, 0x3, 0xc7, 0x80,
-    0x0, 0x1d, 0x1e, 0x0, 0x6, 0xe0, 0x7f, 0xff,
-    0xff, 0x1, 0xe5, 0x55, 0x6f, 0x47, 0x80, 0x0,
-    0xb, 0x1e, 0x0, 0x0, 0xe, 0x78, 0x0, 0x0,
-    0x39, 0xe0, 0x0, 0x0, 0xe7, 0x80, 0x0, 0xf,
-    0x5f, 0xaa, 0xaa, 0xf8, 0x7f, 0xff, 0xfe, 0x0,
-
-    /* U+43 "C" */
-    0x0, 0x1b, 0xfe, 0x40, 0x0, 0xff, 0xaf, 0xf0,
-    0x7, 0xe0, 0x0, 0x7c, 0xf, 0x0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
-    0xb4, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
-    0xb4, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x7c, 0x0, 0xff, 0xab, 0xf0,
-    0x0, 0x1b, 0xfe, 0x40,
-
-    /* U+44 "D" */
-    0x7f, 0xff, 0xf8, 0x0, 0x1f, 0xaa, 0xaf, 0xe0,
-    0x7, 0x80, 0x0, 0x2f, 0x1, 0xe0, 0x0, 0x1,
-    0xf0, 0x78, 0x0, 0x0, 0x1e, 0x1e, 0x0, 0x0,
-    0x3, 0xc7, 0x80, 0x0, 0x0, 0x75, 0xe0, 0x0,
-    0x0, 0x1e, 0x78, 0x0, 0x0, 0x3, 0x9e, 0x0,
-    0x0, 0x1, 0xe7, 0x80, 0x0, 0x0, 0x75, 0xe0,
-    0x0, 0x0, 0x3c, 0x78, 0x0, 0x0, 0x1e, 0x1e,
-    0x0, 0x0, 0x1f, 0x7, 0x80, 0x0, 0x2f, 0x1,
-    0xfa, 0xaa, 0xfe, 0x0, 0x7f, 0xff, 0xf9, 0x0,
-    0x0,
-
-    /* U+45 "E" */
-    0x7f, 0xff, 0xff, 0x5f, 0xaa, 0xaa, 0x87, 0x80,
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xfa,
-    0xaa, 0xa0, 0x7f, 0xff, 0xfc, 0x1e, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x1e, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x1, 0xfa, 0xaa, 0xa9, 0x7f, 0xff, 0xff, 0x80,
-
-    /* U+46 "F" */
-    0x7f, 0xff, 0xff, 0x5f, 0xaa, 0xaa, 0x87, 0x80,
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x1f, 0xaa, 0xaa,
-    0x7, 0x80, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x1e, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-
-    /* U+47 "G" */
-    0x0, 0x1b, 0xfe, 0x40, 0x0, 0xff, 0xab, 0xf4,
-    0x7, 0xe0, 0x0, 0x7c, 0xf, 0x40, 0x0, 0x4,
-    0x3d, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
-    0xb4, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x1d,
-    0xb4, 0x0, 0x0, 0x1d, 0x38, 0x0, 0x0, 0x1d,
-    0x3d, 0x0, 0x0, 0x1d, 0xf, 0x40, 0x0, 0x1d,
-    0x7, 0xe0, 0x0, 0x7c, 0x0, 0xff, 0xab, 0xf4,
-    0x0, 0x1b, 0xfe, 0x40,
-
-    /* U+48 "H" */
-    0x78, 0x0, 0x0, 0x3d, 0xe0, 0x0, 0x0, 0xf7,
-    0x80, 0x0, 0x3, 0xde, 0x0, 0x0, 0xf, 0x78,
-    0x0, 0x0, 0x3d, 0xe0, 0x0, 0x0, 0xf7, 0x80,
-    0x0, 0x3, 0xdf, 0xaa, 0xaa, 0xaf, 0x7f, 0xff,
-    0xff, 0xfd, 0xe0, 0x0, 0x0, 0xf7, 0x80, 0x0,
-    0x3, 0xde, 0x0, 0x0, 0xf, 0x78, 0x0, 0x0,
-    0x3d, 0xe0, 0x0, 0x0, 0xf7, 0x80, 0x0, 0x3,
-    0xde, 0x0, 0x0, 0xf, 0x78, 0x0, 0x0, 0x3c,
-
-    /* U+49 "I" */
-    0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7,
-    0x9e, 0x79, 0xe7, 0x9e, 0x78,
-
-    /* U+4A "J" */
-    0x7, 0xff, 0xf4, 0x1a, 0xaa, 0xd0, 0x0, 0x7,
-    0x40, 0x0, 0x1d, 0x0, 0x0, 0x74, 0x0, 0x1,
-    0xd0, 0x0, 0x7, 0x40, 0x0, 0x1d, 0x0, 0x0,
-    0x74, 0x0, 0x1, 0xd0, 0x0, 0x7, 0x40, 0x0,
-    0x1d, 0x0, 0x0, 0x74, 0x0, 0x2, 0xc3, 0xc0,
-    0xf, 0x7, 0xea, 0xf4, 0x2, 0xfe, 0x0,
-
-    /* U+4B "K" */
-    0x78, 0x0, 0x0, 0xf1, 0xe0, 0x0, 0xf, 0x7,
-    0x80, 0x0, 0xf0, 0x1e, 0x0, 0xf, 0x0, 0x78,
-    0x0, 0xf0, 0x1, 0xe0, 0xf, 0x40, 0x7, 0x80,
-    0xf4, 0x0, 0x1e, 0xf, 0x40, 0x0, 0x78, 0xff,
-    0x0, 0x1, 0xeb, 0x6e, 0x0, 0x7, 0xf4, 0x2d,
-    0x0, 0x1f, 0x80, 0x3d, 0x0, 0x78, 0x0, 0x3c,
-    0x1, 0xe0, 0x0, 0x3c, 0x7, 0x80, 0x0, 0x7c,
-    0x1e, 0x0, 0x0, 0x78, 0x78, 0x0, 0x0, 0xb8,
-
-    /* U+4C "L" */
-    0x78, 0x0, 0x0, 0x78, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x78, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x78, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x78, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x7e, 0xaa, 0xaa,
-    0x7f, 0xff, 0xff,
-
-    /* U+4D "M" */
-    0x74, 0x0, 0x0, 0x0, 0xb1, 0xf0, 0x0, 0x0,
-    0x3, 0xc7, 0xe0, 0x0, 0x0, 0x2f, 0x1f, 0xc0,
-    0x0, 0x1, 0xfc, 0x77, 0xc0, 0x0, 0xf, 0xb1,
-    0xd7, 0x40, 0x0, 0x76, 0xc7, 0x4f, 0x0, 0x3,
-    0x8b, 0x1d, 0xe, 0x0, 0x2c, 0x2c, 0x74, 0x2c,
-    0x0, 0xe0, 0xb1, 0xd0, 0x38, 0xb, 0x2, 0xc7,
-    0x40, 0x74, 0x74, 0xb, 0x1d, 0x0, 0xf3, 0xc0,
-    0x2c, 0x74, 0x1, 0xfc, 0x0, 0xb1, 0xd0, 0x2,
-    0xe0, 0x2, 0xc7, 0x40, 0x3, 0x0, 0xb, 0x1d,
-    0x0, 0x0, 0x0, 0x2c, 0x74, 0x0, 0x0, 0x0,
-    0xb0,
-
-    /* U+4E "N" */
-    0x78, 0x0, 0x0, 0x3d, 0xf4, 0x0, 0x0, 0xf7,
-    0xf0, 0x0, 0x3, 0xdf, 0xf0, 0x0, 0xf, 0x79,
-    0xe0, 0x0, 0x3d, 0xe2, 0xe0, 0x0, 0xf7, 0x83,
-    0xd0, 0x3, 0xde, 0x3, 0xc0, 0xf, 0x78, 0x7,
-    0xc0, 0x3d, 0xe0, 0xb, 0x80, 0xf7, 0x80, 0xf,
-    0x43, 0xde, 0x0, 0xf, 0xf, 0x78, 0x0, 0xf,
-    0x3d, 0xe0, 0x0, 0x1f, 0xf7, 0x80, 0x0, 0x2f,
-    0xde, 0x0, 0x0, 0x3f, 0x78, 0x0, 0x0, 0x3c,
-
-    /* U+4F "O" */
-    0x0, 0x1b, 0xfe, 0x40, 0x0, 0xf, 0xfa, 0xff,
-    0x0, 0x7, 0xe0, 0x0, 0x7d, 0x0, 0xf0, 0x0,
-    0x0, 0xf0, 0x3d, 0x0, 0x0, 0x3, 0xc3, 0x80,
-    0x0, 0x0, 0x2d, 0xb4, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0xfb, 0x0, 0x0, 0x0, 0xf, 0xb4, 0x0, 0x0,
-    0x0, 0xe3, 0x80, 0x0, 0x0, 0x2d, 0x3d, 0x0,
-    0x0, 0x3, 0xc0, 0xf0, 0x0, 0x0, 0xf0, 0x7,
-    0xe0, 0x0, 0x7d, 0x0, 0xf, 0xfa, 0xff, 0x0,
-    0x0, 0x1b, 0xfe, 0x40, 0x0,
-
-    /* U+50 "P" */
-    0x7f, 0xff, 0xe4, 0x7, 0xea, 0xab, 0xf0, 0x78,
-    0x0, 0x7, 0xc7, 0x80, 0x0, 0x2d, 0x78, 0x0,
-    0x0, 0xe7, 0x80, 0x0, 0xf, 0x78, 0x0, 0x0,
-    0xf7, 0x80, 0x0, 0xe, 0x78, 0x0, 0x3, 0xd7,
-    0x80, 0x1, 0xf8, 0x7f, 0xff, 0xfd, 0x7, 0xea,
-    0xa5, 0x0, 0x78, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0,
-
-    /* U+51 "Q" */
-    0x0, 0x1b, 0xfe, 0x40, 0x0, 0x3, 0xfe, 0xbf,
-    0xc0, 0x0, 0x7e, 0x0, 0x7, 0xd0, 0x3, 0xc0,
-    0x0, 0x3, 0xc0, 0x3d, 0x0, 0x0, 0x3, 0xc0,
-    0xe0, 0x0, 0x0, 0xb, 0x4b, 0x40, 0x0, 0x0,
-    0xe, 0x2c, 0x0, 0x0, 0x0, 0x3c, 0xb0, 0x0,
-    0x0, 0x0, 0xf2, 0xc0, 0x0, 0x0, 0x3, 0xcb,
-    0x40, 0x0, 0x0, 0xe, 0xe, 0x0, 0x0, 0x0,
-    0xb4, 0x3d, 0x0, 0x0, 0x3, 0xc0, 0x3c, 0x0,
-    0x0, 0x3d, 0x0, 0x7e, 0x0, 0x7, 0xd0, 0x0,
-    0x3f, 0xeb, 0xfd, 0x0, 0x0, 0x1b, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0xb8, 0x0, 0x40, 0x0, 0x0,
-    0xbd, 0x1b, 0x40, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x0, 0x0, 0x4, 0x0,
-
-    /* U+52 "R" */
-    0x7f, 0xff, 0xe4, 0x1, 0xfa, 0xaa, 0xfc, 0x7,
-    0x80, 0x0, 0x7c, 0x1e, 0x0, 0x0, 0xb4, 0x78,
-    0x0, 0x0, 0xe1, 0xe0, 0x0, 0x3, 0xc7, 0x80,
-    0x0, 0xf, 0x1e, 0x0, 0x0, 0x38, 0x78, 0x0,
-    0x3, 0xc1, 0xe0, 0x0, 0x7e, 0x7, 0xff, 0xff,
-    0xd0, 0x1f, 0xaa, 0xad, 0x0, 0x78, 0x0, 0x3c,
-    0x1, 0xe0, 0x0, 0x38, 0x7, 0x80, 0x0, 0xb4,
-    0x1e, 0x0, 0x0, 0xf0, 0x78, 0x0, 0x0, 0xf0,
-
-    /* U+53 "S" */
-    0x1, 0xbf, 0xe0, 0x3, 0xfa, 0xbf, 0x83, 0xd0,
-    0x0, 0x51, 0xe0, 0x0, 0x0, 0x74, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x1, 0xff, 0xd0, 0x0, 0x1, 0xbf,
-    0x40, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x1, 0xdb, 0x40, 0x0,
-    0xf0, 0xfe, 0xab, 0xf4, 0x6, 0xff, 0xd0, 0x0,
-
-    /* U+54 "T" */
-    0xff, 0xff, 0xff, 0xea, 0xaa, 0xfa, 0xa9, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0xf, 0x0, 0x0,
-
-    /* U+55 "U" */
-    0x74, 0x0, 0x0, 0x75, 0xd0, 0x0, 0x1, 0xd7,
-    0x40, 0x0, 0x7, 0x5d, 0x0, 0x0, 0x1d, 0x74,
-    0x0, 0x0, 0x75, 0xd0, 0x0, 0x1, 0xd7, 0x40,
-    0x0, 0x7, 0x5d, 0x0, 0x0, 0x1d, 0x74, 0x0,
-    0x0, 0x75, 0xd0, 0x0, 0x1, 0xd7, 0x40, 0x0,
-    0x7, 0x4e, 0x0, 0x0, 0x2c, 0x3c, 0x0, 0x0,
-    0xf0, 0xb4, 0x0, 0x7, 0x80, 0xf4, 0x0, 0x7c,
-    0x0, 0xfe, 0xaf, 0xc0, 0x0, 0x7f, 0xf4, 0x0,
-
-    /* U+56 "V" */
-    0xb0, 0x0, 0x0, 0x7, 0x5e, 0x0, 0x0, 0x3,
-    0xc3, 0xc0, 0x0, 0x0, 0xe0, 0x78, 0x0, 0x0,
-    0xb0, 0xf, 0x0, 0x0, 0x38, 0x2, 0xd0, 0x0,
-    0x2d, 0x0, 0x3c, 0x0, 0xf, 0x0, 0xb, 0x40,
-    0x7, 0x40, 0x0, 0xe0, 0x3, 0xc0, 0x0, 0x3c,
-    0x1, 0xe0, 0x0, 0x7, 0x80, 0xb0, 0x0, 0x0,
-    0xf0, 0x38, 0x0, 0x0, 0x1d, 0x2c, 0x0, 0x0,
-    0x3, 0xcf, 0x0, 0x0, 0x0, 0xbb, 0x40, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x2, 0xd0, 0x0,
-    0x0,
-
-    /* U+57 "W" */
-    0x3c, 0x0, 0x0, 0xb4, 0x0, 0x0, 0xe2, 0xc0,
-    0x0, 0xf, 0x80, 0x0, 0x1d, 0x1e, 0x0, 0x1,
-    0xfc, 0x0, 0x2, 0xc0, 0xf0, 0x0, 0x2d, 0xd0,
-    0x0, 0x38, 0xb, 0x0, 0x3, 0x8e, 0x0, 0x7,
-    0x40, 0x78, 0x0, 0x74, 0xb0, 0x0, 0xf0, 0x3,
-    0xc0, 0xb, 0x7, 0x40, 0xe, 0x0, 0x2c, 0x0,
-    0xe0, 0x3c, 0x1, 0xd0, 0x1, 0xe0, 0x1d, 0x2,
-    0xc0, 0x3c, 0x0, 0xf, 0x2, 0xc0, 0x1d, 0x3,
-    0x80, 0x0, 0xb0, 0x38, 0x0, 0xf0, 0x74, 0x0,
-    0x7, 0x87, 0x40, 0xb, 0xf, 0x0, 0x0, 0x3c,
-    0xb0, 0x0, 0x74, 0xe0, 0x0, 0x2, 0xde, 0x0,
-    0x3, 0xdd, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0xb, 0x80, 0x0, 0xf, 0x40, 0x0,
-
-    /* U+58 "X" */
-    0x3c, 0x0, 0x0, 0x78, 0xf, 0x0, 0x0, 0xf0,
-    0x7, 0x80, 0x3, 0xc0, 0x2, 0xd0, 0xb, 0x40,
-    0x0, 0xf0, 0x1e, 0x0, 0x0, 0x3c, 0x3c, 0x0,
-    0x0, 0x1e, 0xb0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x3c, 0x78, 0x0, 0x0, 0xb4, 0x2d, 0x0,
-    0x1, 0xe0, 0xf, 0x0, 0x3, 0xc0, 0x7, 0xc0,
-    0xf, 0x40, 0x2, 0xe0, 0x2e, 0x0, 0x0, 0xf4,
-    0x3c, 0x0, 0x0, 0x3c,
-
-    /* U+59 "Y" */
-    0xb0, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0, 0x74,
-    0x1d, 0x0, 0x0, 0xe0, 0xf, 0x0, 0x2, 0xc0,
-    0x7, 0x80, 0x7, 0x40, 0x2, 0xc0, 0xf, 0x0,
-    0x0, 0xf0, 0x1d, 0x0, 0x0, 0x74, 0x38, 0x0,
-    0x0, 0x3c, 0xb0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x7, 0x80, 0x0,
-
-    /* U+5A "Z" */
-    0xff, 0xff, 0xff, 0xe6, 0xaa, 0xaa, 0xbd, 0x0,
-    0x0, 0xb, 0x80, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x2, 0xd0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x2e,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0xb, 0xea, 0xaa, 0xa9,
-    0xff, 0xff, 0xff, 0xf0,
-
-    /* U+5B "[" */
-    0x7f, 0xc7, 0x94, 0x74, 0x7, 0x40, 0x74, 0x7,
-    0x40, 0x74, 0x7, 0x40, 0x74, 0x7, 0x40, 0x74,
-    0x7, 0x40, 0x74, 0x7, 0x40, 0x74, 0x7, 0x40,
-    0x74, 0x7, 0x40, 0x74, 0x7, 0x40, 0x74, 0x7,
-    0x94, 0x7f, 0xc0,
-
-    /* U+5C "\\" */
-    0xb0, 0x0, 0x7, 0x0, 0x0, 0x38, 0x0, 0x2,
-    0xc0, 0x0, 0x1d, 0x0, 0x0, 0xe0, 0x0, 0xb,
-    0x0, 0x0, 0x74, 0x0, 0x3, 0x80, 0x0, 0x2c,
-    0x0, 0x0, 0xd0, 0x0, 0xe, 0x0, 0x0, 0xb0,
-    0x0, 0x3, 0x40, 0x0, 0x38, 0x0, 0x2, 0xc0,
-    0x0, 0xd, 0x0, 0x0, 0xe0, 0x0, 0x7, 0x0,
-    0x0, 0x34, 0x0, 0x3, 0xc0, 0x0, 0x1c, 0x0,
-    0x0, 0xd0,
-
-    /* U+5D "]" */
-    0xbf, 0xc5, 0xf0, 0x3c, 0xf, 0x3, 0xc0, 0xf0,
-    0x3c, 0xf, 0x3, 0xc0, 0xf0, 0x3c, 0xf, 0x3,
-    0xc0, 0xf0, 0x3c, 0xf, 0x3, 0xc0, 0xf0, 0x3c,
-    0xf, 0x3, 0xc5, 0xfb, 0xfc,
-
-    /* U+5E "^" */
-    0x0, 0x3c, 0x0, 0x1, 0xf4, 0x0, 0xd, 0xa0,
-    0x0, 0x71, 0xc0, 0x2, 0x83, 0x80, 0xd, 0x7,
-    0x0, 0xb0, 0xd, 0x3, 0x40, 0x2c, 0x1c, 0x0,
-    0x30, 0xe0, 0x0, 0xe0,
-
-    /* U+5F "_" */
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-
-    /* U+60 "`" */
-    0x7c, 0x0, 0xf0, 0x2, 0xd0,
-
-    /* U+61 "a" */
-    0x6, 0xff, 0x40, 0xfe, 0xaf, 0x83, 0x40, 0xb,
-    0x40, 0x0, 0xe, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0xf0, 0xbf, 0xff, 0xcf, 0x90, 0xf, 0xb4, 0x0,
-    0x3e, 0xc0, 0x0, 0xf7, 0x40, 0xb, 0xcf, 0x95,
-    0xff, 0x7, 0xfd, 0x2c,
-
-    /* U+62 "b" */
-    0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb0,
-    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0xb, 0x7, 0xfd, 0x0, 0xb3, 0xea, 0xfc,
-    0xb, 0xf0, 0x1, 0xf0, 0xbc, 0x0, 0x7, 0x4b,
-    0x40, 0x0, 0x3c, 0xb0, 0x0, 0x2, 0xcb, 0x0,
-    0x0, 0x2c, 0xb0, 0x0, 0x2, 0xcb, 0x40, 0x0,
-    0x3c, 0xbc, 0x0, 0x7, 0x4b, 0xf0, 0x1, 0xf0,
-    0xb3, 0xea, 0xfc, 0xb, 0xb, 0xfd, 0x0,
-
-    /* U+63 "c" */
-    0x1, 0xbf, 0x90, 0xb, 0xea, 0xf8, 0x2e, 0x0,
-    0x2d, 0x38, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x2e, 0x0,
-    0x2d, 0xb, 0xea, 0xf8, 0x1, 0xbf, 0x90,
-
-    /* U+64 "d" */
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x3,
-    0xc0, 0x6f, 0xe0, 0xf0, 0xbe, 0xaf, 0x7c, 0xb8,
-    0x0, 0xbf, 0x38, 0x0, 0xb, 0xec, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0xf, 0xf0,
-    0x0, 0x3, 0xec, 0x0, 0x0, 0xf3, 0x80, 0x0,
-    0xbc, 0xb8, 0x0, 0xbf, 0xb, 0xe6, 0xf6, 0xc0,
-    0x6f, 0xe0, 0xb0,
-
-    /* U+65 "e" */
-    0x1, 0xbf, 0x80, 0x2, 0xfa, 0xbd, 0x2, 0xe0,
-    0x3, 0xc0, 0xe0, 0x0, 0x38, 0xb0, 0x0, 0xb,
-    0x3c, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xf7, 0xd5,
-    0x55, 0x54, 0xb0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x2, 0xe0, 0x0, 0xc0, 0x2f, 0xab, 0xf0, 0x0,
-    0xbf, 0xd0, 0x0,
-
-    /* U+66 "f" */
-    0x0, 0xbf, 0x40, 0xba, 0xa0, 0x38, 0x0, 0x1d,
-    0x0, 0x7, 0x40, 0x2f, 0xff, 0xc5, 0xb9, 0x50,
-    0x1d, 0x0, 0x7, 0x40, 0x1, 0xd0, 0x0, 0x74,
-    0x0, 0x1d, 0x0, 0x7, 0x40, 0x1, 0xd0, 0x0,
-    0x74, 0x0, 0x1d, 0x0, 0x7, 0x40, 0x1, 0xd0,
-    0x0,
-
-    /* U+67 "g" */
-    0x1, 0xbf, 0x82, 0xc0, 0xbe, 0xaf, 0x6c, 0x2e,
-    0x0, 0x1f, 0xc3, 0x80, 0x0, 0xbc, 0xb0, 0x0,
-    0x3, 0xcf, 0x0, 0x0, 0x2c, 0xf0, 0x0, 0x2,
-    0xcf, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x3, 0xc3,
-    0x80, 0x0, 0xbc, 0x2e, 0x0, 0x1f, 0xc0, 0xbe,
-    0xaf, 0x6c, 0x1, 0xbf, 0x82, 0xc0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x3, 0x82, 0x80, 0x0, 0xf0,
-    0x2f, 0xea, 0xbd, 0x0, 0x2f, 0xfe, 0x0,
-
-    /* U+68 "h" */
-    0xb0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb0,
-    0xbf, 0xd0, 0xb7, 0xea, 0xf8, 0xbe, 0x0, 0x3d,
-    0xbc, 0x0, 0xe, 0xb4, 0x0, 0xf, 0xb0, 0x0,
-    0xf, 0xb0, 0x0, 0xb, 0xb0, 0x0, 0xb, 0xb0,
-    0x0, 0xb, 0xb0, 0x0, 0xb, 0xb0, 0x0, 0xb,
-    0xb0, 0x0, 0xb, 0xb0, 0x0, 0xb,
-
-    /* U+69 "i" */
-    0x2c, 0x3d, 0x4, 0x0, 0x0, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c,
-
-    /* U+6A "j" */
-    0x0, 0x2d, 0x0, 0x3e, 0x0, 0x4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2c,
-    0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2c,
-    0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2c,
-    0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2c,
-    0x0, 0x3c, 0x3a, 0xf4, 0x2f, 0xd0,
-
-    /* U+6B "k" */
-    0xb0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0x2c, 0x0, 0xf, 0x4b, 0x0, 0xf, 0x42, 0xc0,
-    0xf, 0x0, 0xb0, 0xf, 0x0, 0x2c, 0xf, 0x0,
-    0xb, 0x1f, 0x80, 0x2, 0xdf, 0xf4, 0x0, 0xbf,
-    0xf, 0x0, 0x2f, 0x1, 0xf0, 0xb, 0x0, 0x2e,
-    0x2, 0xc0, 0x3, 0xd0, 0xb0, 0x0, 0x3c, 0x2c,
-    0x0, 0x7, 0xc0,
-
-    /* U+6C "l" */
-    0xb2, 0xcb, 0x2c, 0xb2, 0xcb, 0x2c, 0xb2, 0xcb,
-    0x2c, 0xb2, 0xcb, 0x2c, 0xb2, 0xc0,
-
-    /* U+6D "m" */
-    0xb0, 0xbf, 0x80, 0x1f, 0xf8, 0xb, 0x7e, 0x6f,
-    0x4f, 0xab, 0xf0, 0xbd, 0x0, 0x3f, 0xc0, 0xb,
-    0x8b, 0x80, 0x1, 0xf4, 0x0, 0x3c, 0xb4, 0x0,
-    0xf, 0x0, 0x2, 0xcb, 0x0, 0x0, 0xe0, 0x0,
-    0x2c, 0xb0, 0x0, 0xe, 0x0, 0x2, 0xcb, 0x0,
-    0x0, 0xe0, 0x0, 0x2c, 0xb0, 0x0, 0xe, 0x0,
-    0x2, 0xcb, 0x0, 0x0, 0xe0, 0x0, 0x2c, 0xb0,
-    0x0, 0xe, 0x0, 0x2, 0xcb, 0x0, 0x0, 0xe0,
-    0x0, 0x2c, 0xb0, 0x0, 0xe, 0x0, 0x2, 0xc0,
-
-    /* U+6E "n" */
-    0xb0, 0xbf, 0xd0, 0xb7, 0xe6, 0xf8, 0xbe, 0x0,
-    0x3d, 0xb8, 0x0, 0xe, 0xb4, 0x0, 0xf, 0xb0,
-    0x0, 0xb, 0xb0, 0x0, 0xb, 0xb0, 0x0, 0xb,
-    0xb0, 0x0, 0xb, 0xb0, 0x0, 0xb, 0xb0, 0x0,
-    0xb, 0xb0, 0x0, 0xb, 0xb0, 0x0, 0xb,
-
-    /* U+6F "o" */
-    0x1, 0xbf, 0x90, 0x2, 0xfa, 0xbe, 0x2, 0xe0,
-    0x2, 0xe0, 0xe0, 0x0, 0x2c, 0xb0, 0x0, 0x3,
-    0xbc, 0x0, 0x0, 0xff, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0xf, 0xb0, 0x0, 0x3, 0x8e, 0x0, 0x2,
-    0xc2, 0xe0, 0x2, 0xe0, 0x2f, 0xab, 0xe0, 0x1,
-    0xbf, 0x90, 0x0,
-
-    /* U+70 "p" */
-    0xb0, 0xbf, 0xd0, 0xb, 0x3e, 0x6f, 0xc0, 0xbe,
-    0x0, 0x1f, 0xb, 0xc0, 0x0, 0x74, 0xb4, 0x0,
-    0x3, 0xcb, 0x0, 0x0, 0x2c, 0xb0, 0x0, 0x2,
-    0xcb, 0x0, 0x0, 0x2c, 0xb4, 0x0, 0x3, 0xcb,
-    0xc0, 0x0, 0x74, 0xbf, 0x0, 0x1f, 0xb, 0x3e,
-    0xaf, 0xc0, 0xb0, 0xbf, 0xd0, 0xb, 0x0, 0x0,
-    0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
-
-    /* U+71 "q" */
-    0x1, 0xbf, 0x82, 0xc2, 0xfa, 0xbd, 0xb2, 0xe0,
-    0x2, 0xfc, 0xe0, 0x0, 0x2f, 0xb0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0xff, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0xf, 0xb0, 0x0, 0x3, 0xce, 0x0, 0x2,
-    0xf2, 0xe0, 0x2, 0xfc, 0x2f, 0xab, 0xdf, 0x1,
-    0xbf, 0x83, 0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0xf0,
-
-    /* U+72 "r" */
-    0xb0, 0xba, 0xcf, 0xeb, 0xe0, 0x2f, 0x0, 0xb4,
-    0x2, 0xc0, 0xb, 0x0, 0x2c, 0x0, 0xb0, 0x2,
-    0xc0, 0xb, 0x0, 0x2c, 0x0, 0xb0, 0x0,
-
-    /* U+73 "s" */
-    0x2, 0xff, 0x90, 0x3e, 0xab, 0xd2, 0xd0, 0x1,
-    0xf, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x7e, 0x40,
-    0x0, 0x6f, 0xf8, 0x0, 0x1, 0xbd, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0xf2, 0x40, 0x3, 0x8f, 0xea,
-    0xbc, 0x6, 0xff, 0x80,
-
-    /* U+74 "t" */
-    0x7, 0x40, 0x0, 0x74, 0x0, 0x7, 0x40, 0xb,
-    0xff, 0xf0, 0x5b, 0x95, 0x0, 0x74, 0x0, 0x7,
-    0x40, 0x0, 0x74, 0x0, 0x7, 0x40, 0x0, 0x74,
-    0x0, 0x7, 0x40, 0x0, 0x74, 0x0, 0x7, 0x40,
-    0x0, 0x38, 0x0, 0x2, 0xfa, 0x80, 0xb, 0xf4,
-
-    /* U+75 "u" */
-    0xf0, 0x0, 0xf, 0xf0, 0x0, 0xf, 0xf0, 0x0,
-    0xf, 0xf0, 0x0, 0xf, 0xf0, 0x0, 0xf, 0xf0,
-    0x0, 0xf, 0xf0, 0x0, 0xf, 0xb0, 0x0, 0xf,
-    0xb0, 0x0, 0xf, 0x74, 0x0, 0x2f, 0x3c, 0x0,
-    0x7f, 0x1f, 0x9b, 0xdf, 0x2, 0xfe, 0xf,
-
-    /* U+76 "v" */
-    0xf0, 0x0, 0x3, 0xdd, 0x0, 0x1, 0xd3, 0xc0,
-    0x0, 0xf0, 0x74, 0x0, 0x34, 0xe, 0x0, 0x2c,
-    0x2, 0xc0, 0xe, 0x0, 0x38, 0xb, 0x0, 0xf,
-    0x3, 0x80, 0x1, 0xd1, 0xd0, 0x0, 0x3c, 0xf0,
-    0x0, 0x7, 0xb4, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x2e, 0x0, 0x0,
-
-    /* U+77 "w" */
-    0xb0, 0x0, 0x1d, 0x0, 0x3, 0x9d, 0x0, 0xb,
-    0xc0, 0x0, 0xd3, 0x80, 0x3, 0xf0, 0x0, 0xb0,
-    0xb0, 0x1, 0xce, 0x0, 0x38, 0xd, 0x0, 0xe2,
-    0xc0, 0x1d, 0x3, 0xc0, 0x34, 0x74, 0xb, 0x0,
-    0x70, 0x2c, 0xe, 0x3, 0x80, 0xe, 0xe, 0x2,
-    0xc1, 0xc0, 0x2, 0xc7, 0x0, 0x34, 0xb0, 0x0,
-    0x72, 0xc0, 0xf, 0x34, 0x0, 0xe, 0xd0, 0x1,
-    0xec, 0x0, 0x2, 0xf0, 0x0, 0x3e, 0x0, 0x0,
-    0x38, 0x0, 0xb, 0x40, 0x0,
-
-    /* U+78 "x" */
-    0x3c, 0x0, 0xe, 0x3, 0x80, 0xf, 0x0, 0x74,
-    0xb, 0x0, 0xb, 0x7, 0x40, 0x0, 0xf7, 0x80,
-    0x0, 0xf, 0xc0, 0x0, 0x3, 0xe0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0xe3, 0xc0, 0x0, 0xf0, 0x38,
-    0x0, 0xb0, 0x7, 0x40, 0x74, 0x0, 0xb0, 0x38,
-    0x0, 0xf, 0x0,
-
-    /* U+79 "y" */
-    0x3c, 0x0, 0x0, 0xf1, 0xd0, 0x0, 0x1d, 0xf,
-    0x0, 0x3, 0xc0, 0x74, 0x0, 0x34, 0x3, 0x80,
-    0xb, 0x0, 0x2c, 0x0, 0xe0, 0x0, 0xe0, 0x1c,
-    0x0, 0xb, 0x3, 0x80, 0x0, 0x74, 0x74, 0x0,
-    0x3, 0xcf, 0x0, 0x0, 0x1d, 0xd0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0xb0,
-    0x0, 0x0, 0xe, 0x0, 0x0, 0x2, 0xc0, 0x0,
-    0x7a, 0xb8, 0x0, 0x2, 0xfd, 0x0, 0x0,
-
-    /* U+7A "z" */
-    0xff, 0xff, 0xf1, 0x55, 0x5b, 0xc0, 0x0, 0x3c,
-    0x0, 0x2, 0xd0, 0x0, 0x1e, 0x0, 0x0, 0xf0,
-    0x0, 0xf, 0x0, 0x0, 0xb4, 0x0, 0x7, 0x80,
-    0x0, 0x38, 0x0, 0x3, 0xc0, 0x0, 0x2e, 0x55,
-    0x54, 0xff, 0xff, 0xf4,
-
-    /* U+7B "{" */
-    0x1, 0xf8, 0xf, 0x80, 0xb0, 0x2, 0xc0, 0xb,
-    0x0, 0x2c, 0x0, 0xb0, 0x2, 0xc0, 0xb, 0x0,
-    0x2c, 0x0, 0xf0, 0x2f, 0x40, 0x1f, 0x0, 0x2c,
-    0x0, 0xb0, 0x2, 0xc0, 0xb, 0x0, 0x2c, 0x0,
-    0xb0, 0x2, 0xc0, 0xb, 0x0, 0x1f, 0x80, 0x1f,
-    0x80,
-
-    /* U+7C "|" */
-    0x75, 0xd7, 0x5d, 0x75, 0xd7, 0x5d, 0x75, 0xd7,
-    0x5d, 0x75, 0xd7, 0x5d, 0x75, 0xd7, 0x5d, 0x75,
-    0xd7, 0x40,
-
-    /* U+7D "}" */
-    0xbd, 0x0, 0xbd, 0x0, 0x38, 0x0, 0xe0, 0x3,
-    0x80, 0xe, 0x0, 0x38, 0x0, 0xe0, 0x3, 0x80,
-    0xe, 0x0, 0x3c, 0x0, 0x7e, 0x3, 0xd0, 0xe,
-    0x0, 0x38, 0x0, 0xe0, 0x3, 0x80, 0xe, 0x0,
-    0x38, 0x0, 0xe0, 0x3, 0x80, 0xbd, 0xb, 0xd0,
-    0x0,
-
-    /* U+7E "~" */
-    0x0, 0x0, 0x0, 0x1f, 0xd0, 0xc, 0x39, 0xbc,
-    0x2c, 0x70, 0xb, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+A9 "©" */
-    0x0, 0x1b, 0xfe, 0x0, 0x0, 0xe, 0x40, 0x2d,
-    0x0, 0x7, 0x0, 0x0, 0x28, 0x0, 0xc0, 0x7f,
-    0xd0, 0xa0, 0x34, 0x2e, 0x5b, 0x43, 0x3, 0x7,
-    0x0, 0x10, 0x18, 0x90, 0xe0, 0x0, 0x0, 0xc9,
-    0xd, 0x0, 0x0, 0xc, 0x80, 0xd0, 0x0, 0x0,
-    0x89, 0xe, 0x0, 0x0, 0xc, 0x90, 0xb0, 0x0,
-    0x0, 0xc3, 0x3, 0xd0, 0x74, 0x18, 0x34, 0xb,
-    0xfd, 0x3, 0x0, 0xc0, 0x0, 0x0, 0x90, 0x7,
-    0x0, 0x0, 0x28, 0x0, 0xe, 0x40, 0x1d, 0x0,
-    0x0, 0x1b, 0xfd, 0x0, 0x0,
-
-    /* U+AA "ª" */
-    0xb, 0xf8, 0x14, 0xe, 0x0, 0x7, 0xb, 0xff,
-    0x38, 0x7, 0x30, 0x7, 0x28, 0x1f, 0xb, 0xe7,
-
-    /* U+AE "®" */
-    0x0, 0x1b, 0xfe, 0x0, 0x0, 0xe, 0x40, 0x2d,
-    0x0, 0x7, 0x0, 0x0, 0x28, 0x0, 0xc2, 0xff,
-    0x90, 0xa0, 0x34, 0x28, 0x7, 0x43, 0x3, 0x2,
-    0x80, 0x1c, 0x18, 0x90, 0x28, 0x1, 0xc0, 0xc9,
-    0x2, 0x80, 0x1c, 0xc, 0x80, 0x28, 0x7, 0x40,
-    0x89, 0x2, 0xff, 0xd0, 0xc, 0x90, 0x28, 0xc,
-    0x0, 0xc3, 0x2, 0x80, 0x70, 0x18, 0x34, 0x28,
-    0x2, 0x83, 0x0, 0xc0, 0x0, 0x4, 0x90, 0x7,
-    0x0, 0x0, 0x28, 0x0, 0xe, 0x40, 0x1d, 0x0,
-    0x0, 0x1b, 0xfd, 0x0, 0x0,
-
-    /* U+B1 "±" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x38, 0x0, 0x7f,
-    0xff, 0xfc, 0x15, 0x7d, 0x54, 0x0, 0x38, 0x0,
-    0x0, 0x38, 0x0, 0x0, 0x38, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0x55, 0x54, 0x7f, 0xff, 0xfc,
-
-    /* U+B2 "²" */
-    0xb, 0xf8, 0x3, 0x80, 0xb0, 0x0, 0x3, 0x80,
-    0x0, 0x34, 0x0, 0xb, 0x0, 0x2, 0xc0, 0x0,
-    0xb0, 0x0, 0x38, 0x0, 0xe, 0x0, 0x3, 0xff,
-    0xfc,
-
-    /* U+BA "º" */
-    0x2, 0xf8, 0x1, 0xd0, 0xb0, 0x34, 0x2, 0xc3,
-    0x0, 0xc, 0x30, 0x0, 0xc3, 0x40, 0x1c, 0x1d,
-    0x7, 0x40, 0x7f, 0xd0, 0x0, 0x0, 0x0,
-
-    /* U+C0 "À" */
-    0x0, 0x14, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x77, 0x80, 0x0, 0x0, 0xf, 0x2c, 0x0,
-    0x0, 0x1, 0xd0, 0xe0, 0x0, 0x0, 0x3c, 0xf,
-    0x0, 0x0, 0x3, 0x80, 0x74, 0x0, 0x0, 0xb0,
-    0x3, 0xc0, 0x0, 0xe, 0x0, 0x1d, 0x0, 0x2,
-    0xc0, 0x0, 0xf0, 0x0, 0x3c, 0x0, 0xb, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0xf5, 0x55, 0x56,
-    0xc0, 0x1d, 0x0, 0x0, 0xe, 0x3, 0xc0, 0x0,
-    0x0, 0xf0, 0x78, 0x0, 0x0, 0x7, 0x4b, 0x0,
-    0x0, 0x0, 0x3c,
-
-    /* U+C1 "Á" */
-    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x2, 0xd0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x14,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x77, 0x80, 0x0, 0x0, 0xf, 0x2c, 0x0,
-    0x0, 0x1, 0xd0, 0xe0, 0x0, 0x0, 0x3c, 0xf,
-    0x0, 0x0, 0x3, 0x80, 0x74, 0x0, 0x0, 0xb0,
-    0x3, 0xc0, 0x0, 0xe, 0x0, 0x1d, 0x0, 0x2,
-    0xc0, 0x0, 0xf0, 0x0, 0x3c, 0x0, 0xb, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0xf5, 0x55, 0x56,
-    0xc0, 0x1d, 0x0, 0x0, 0xe, 0x3, 0xc0, 0x0,
-    0x0, 0xf0, 0x78, 0x0, 0x0, 0x7, 0x4b, 0x0,
-    0x0, 0x0, 0x3c,
-
-    /* U+C2 "Â" */
-    0x0, 0x1, 0x90, 0x0, 0x0, 0x0, 0x7b, 0x80,
-    0x0, 0x0, 0x1d, 0x1e, 0x0, 0x0, 0x1, 0x40,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x77, 0x80, 0x0, 0x0, 0xf, 0x2c, 0x0,
-    0x0, 0x1, 0xd0, 0xe0, 0x0, 0x0, 0x3c, 0xf,
-    0x0, 0x0, 0x3, 0x80, 0x74, 0x0, 0x0, 0xb0,
-    0x3, 0xc0, 0x0, 0xe, 0x0, 0x1d, 0x0, 0x2,
-    0xc0, 0x0, 0xf0, 0x0, 0x3c, 0x0, 0xb, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0xf5, 0x55, 0x56,
-    0xc0, 0x1d, 0x0, 0x0, 0xe, 0x3, 0xc0, 0x0,
-    0x0, 0xf0, 0x78, 0x0, 0x0, 0x7, 0x4b, 0x0,
-    0x0, 0x0, 0x3c,
-
-    /* U+C3 "Ã" */
-    0x0, 0xf, 0x2, 0x40, 0x0, 0x3, 0x5d, 0x30,
-    0x0, 0x0, 0x30, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x77, 0x80, 0x0, 0x0, 0xf, 0x2c, 0x0,
-    0x0, 0x1, 0xd0, 0xe0, 0x0, 0x0, 0x3c, 0xf,
-    0x0, 0x0, 0x3, 0x80, 0x74, 0x0, 0x0, 0xb0,
-    0x3, 0xc0, 0x0, 0xe, 0x0, 0x1d, 0x0, 0x2,
-    0xc0, 0x0, 0xf0, 0x0, 0x3c, 0x0, 0xb, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0xf5, 0x55, 0x56,
-    0xc0, 0x1d, 0x0, 0x0, 0xe, 0x3, 0xc0, 0x0,
-    0x0, 0xf0, 0x78, 0x0, 0x0, 0x7, 0x4b, 0x0,
-    0x0, 0x0, 0x3c,
-
-    /* U+C7 "Ç" */
-    0x0, 0x1b, 0xfe, 0x40, 0x0, 0xff, 0xaf, 0xf0,
-    0x7, 0xe0, 0x0, 0x7c, 0xf, 0x0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
-    0xb4, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
-    0xb4, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x7c, 0x0, 0xff, 0xab, 0xf0,
-    0x0, 0x1b, 0xfe, 0x40, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x2c, 0x0,
-    0x0, 0x0, 0x2c, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+C9 "É" */
-    0x0, 0x0, 0x50, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xd7, 0xea, 0xaa, 0xa1, 0xe0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x7e,
-    0xaa, 0xa8, 0x1f, 0xff, 0xff, 0x7, 0x80, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0x7e, 0xaa, 0xaa, 0x5f, 0xff, 0xff, 0xe0,
-
-    /* U+CA "Ê" */
-    0x0, 0x19, 0x0, 0x0, 0x1e, 0xd0, 0x0, 0x1d,
-    0x1d, 0x0, 0x4, 0x0, 0x40, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xd7, 0xea, 0xaa, 0xa1, 0xe0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x7e,
-    0xaa, 0xa8, 0x1f, 0xff, 0xff, 0x7, 0x80, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0x7e, 0xaa, 0xaa, 0x5f, 0xff, 0xff, 0xe0,
-
-    /* U+CD "Í" */
-    0x1, 0x40, 0xb4, 0x3c, 0x5, 0x0, 0x0, 0x7,
-    0x80, 0x78, 0x7, 0x80, 0x78, 0x7, 0x80, 0x78,
-    0x7, 0x80, 0x78, 0x7, 0x80, 0x78, 0x7, 0x80,
-    0x78, 0x7, 0x80, 0x78, 0x7, 0x80, 0x78, 0x7,
-    0x80,
-
-    /* U+D3 "Ó" */
-    0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x2, 0xd0,
-    0x0, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xe4, 0x0, 0x0, 0xff, 0xaf, 0xf0, 0x0,
-    0x7e, 0x0, 0x7, 0xd0, 0xf, 0x0, 0x0, 0xf,
-    0x3, 0xd0, 0x0, 0x0, 0x3c, 0x38, 0x0, 0x0,
-    0x2, 0xdb, 0x40, 0x0, 0x0, 0xe, 0xb0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0xfb, 0x40, 0x0, 0x0, 0xe,
-    0x38, 0x0, 0x0, 0x2, 0xd3, 0xd0, 0x0, 0x0,
-    0x3c, 0xf, 0x0, 0x0, 0xf, 0x0, 0x7e, 0x0,
-    0x7, 0xd0, 0x0, 0xff, 0xaf, 0xf0, 0x0, 0x1,
-    0xbf, 0xe4, 0x0,
-
-    /* U+D4 "Ô" */
-    0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x3a, 0xd0,
-    0x0, 0x0, 0xe, 0xb, 0x0, 0x0, 0x1, 0x40,
-    0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xe4, 0x0, 0x0, 0xff, 0xaf, 0xf0, 0x0,
-    0x7e, 0x0, 0x7, 0xd0, 0xf, 0x0, 0x0, 0xf,
-    0x3, 0xd0, 0x0, 0x0, 0x3c, 0x38, 0x0, 0x0,
-    0x2, 0xdb, 0x40, 0x0, 0x0, 0xe, 0xb0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0xfb, 0x40, 0x0, 0x0, 0xe,
-    0x38, 0x0, 0x0, 0x2, 0xd3, 0xd0, 0x0, 0x0,
-    0x3c, 0xf, 0x0, 0x0, 0xf, 0x0, 0x7e, 0x0,
-    0x7, 0xd0, 0x0, 0xff, 0xaf, 0xf0, 0x0, 0x1,
-    0xbf, 0xe4, 0x0,
-
-    /* U+D5 "Õ" */
-    0x0, 0xb, 0x80, 0xc0, 0x0, 0x1, 0xca, 0x28,
-    0x0, 0x0, 0x24, 0x2f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xe4, 0x0, 0x0, 0xff, 0xaf, 0xf0, 0x0,
-    0x7e, 0x0, 0x7, 0xd0, 0xf, 0x0, 0x0, 0xf,
-    0x3, 0xd0, 0x0, 0x0, 0x3c, 0x38, 0x0, 0x0,
-    0x2, 0xdb, 0x40, 0x0, 0x0, 0xe, 0xb0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0xfb, 0x40, 0x0, 0x0, 0xe,
-    0x38, 0x0, 0x0, 0x2, 0xd3, 0xd0, 0x0, 0x0,
-    0x3c, 0xf, 0x0, 0x0, 0xf, 0x0, 0x7e, 0x0,
-    0x7, 0xd0, 0x0, 0xff, 0xaf, 0xf0, 0x0, 0x1,
-    0xbf, 0xe4, 0x0,
-
-    /* U+DA "Ú" */
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x38, 0x0, 0x0, 0x1, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xd0, 0x0, 0x1, 0xd7, 0x40,
-    0x0, 0x7, 0x5d, 0x0, 0x0, 0x1d, 0x74, 0x0,
-    0x0, 0x75, 0xd0, 0x0, 0x1, 0xd7, 0x40, 0x0,
-    0x7, 0x5d, 0x0, 0x0, 0x1d, 0x74, 0x0, 0x0,
-    0x75, 0xd0, 0x0, 0x1, 0xd7, 0x40, 0x0, 0x7,
-    0x5d, 0x0, 0x0, 0x1d, 0x38, 0x0, 0x0, 0xb0,
-    0xf0, 0x0, 0x3, 0xc2, 0xd0, 0x0, 0x1e, 0x3,
-    0xd0, 0x1, 0xf0, 0x3, 0xfa, 0xbf, 0x0, 0x1,
-    0xff, 0xd0, 0x0,
-
-    /* U+E0 "à" */
-    0xb, 0x80, 0x0, 0x7, 0x80, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfd,
-    0x3, 0xfa, 0xbe, 0xd, 0x0, 0x2d, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0xf0, 0x0, 0x3, 0xc2, 0xff,
-    0xff, 0x3e, 0x40, 0x3e, 0xd0, 0x0, 0xfb, 0x0,
-    0x3, 0xdd, 0x0, 0x2f, 0x3e, 0x57, 0xfc, 0x1f,
-    0xf4, 0xb0,
-
-    /* U+E1 "á" */
-    0x0, 0x3, 0xd0, 0x0, 0x3c, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfd,
-    0x3, 0xfa, 0xbe, 0xd, 0x0, 0x2d, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0xf0, 0x0, 0x3, 0xc2, 0xff,
-    0xff, 0x3e, 0x40, 0x3e, 0xd0, 0x0, 0xfb, 0x0,
-    0x3, 0xdd, 0x0, 0x2f, 0x3e, 0x57, 0xfc, 0x1f,
-    0xf4, 0xb0,
-
-    /* U+E2 "â" */
-    0x0, 0xbc, 0x0, 0xb, 0x6d, 0x0, 0xb0, 0x1d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfd,
-    0x3, 0xfa, 0xbe, 0xd, 0x0, 0x2d, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0xf0, 0x0, 0x3, 0xc2, 0xff,
-    0xff, 0x3e, 0x40, 0x3e, 0xd0, 0x0, 0xfb, 0x0,
-    0x3, 0xdd, 0x0, 0x2f, 0x3e, 0x57, 0xfc, 0x1f,
-    0xf4, 0xb0,
-
-    /* U+E3 "ã" */
-    0x3, 0xd0, 0x60, 0x28, 0xd3, 0x40, 0xc0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfd,
-    0x3, 0xfa, 0xbe, 0xd, 0x0, 0x2d, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0xf0, 0x0, 0x3, 0xc2, 0xff,
-    0xff, 0x3e, 0x40, 0x3e, 0xd0, 0x0, 0xfb, 0x0,
-    0x3, 0xdd, 0x0, 0x2f, 0x3e, 0x57, 0xfc, 0x1f,
-    0xf4, 0xb0,
-
-    /* U+E7 "ç" */
-    0x1, 0xbf, 0x90, 0xb, 0xea, 0xf8, 0x2e, 0x0,
-    0x2d, 0x38, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x2e, 0x0,
-    0x2d, 0xb, 0xea, 0xf8, 0x1, 0xbf, 0x90, 0x0,
-    0x24, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+E9 "é" */
-    0x0, 0x2, 0xe0, 0x0, 0x2, 0xd0, 0x0, 0x2,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe0, 0x0, 0xbe, 0xaf, 0x40, 0xb8,
-    0x0, 0xf0, 0x38, 0x0, 0xe, 0x2c, 0x0, 0x2,
-    0xcf, 0x0, 0x0, 0x77, 0xff, 0xff, 0xfd, 0xf5,
-    0x55, 0x55, 0x2c, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0xb8, 0x0, 0x30, 0xb, 0xea, 0xfc, 0x0,
-    0x2f, 0xf4, 0x0,
-
-    /* U+EA "ê" */
-    0x0, 0x3e, 0x0, 0x0, 0x39, 0xe0, 0x0, 0x38,
-    0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe0, 0x0, 0xbe, 0xaf, 0x40, 0xb8,
-    0x0, 0xf0, 0x38, 0x0, 0xe, 0x2c, 0x0, 0x2,
-    0xcf, 0x0, 0x0, 0x77, 0xff, 0xff, 0xfd, 0xf5,
-    0x55, 0x55, 0x2c, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0xb8, 0x0, 0x30, 0xb, 0xea, 0xfc, 0x0,
-    0x2f, 0xf4, 0x0,
-
-    /* U+ED "í" */
-    0x2, 0xe0, 0x2d, 0x2, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xb0, 0x2, 0xc0, 0xb, 0x0, 0x2c, 0x0,
-    0xb0, 0x2, 0xc0, 0xb, 0x0, 0x2c, 0x0, 0xb0,
-    0x2, 0xc0, 0xb, 0x0, 0x2c, 0x0, 0xb0, 0x0,
-
-    /* U+F3 "ó" */
-    0x0, 0x1, 0xf0, 0x0, 0x1, 0xe0, 0x0, 0x1,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe4, 0x0, 0xbe, 0xaf, 0x80, 0xb8,
-    0x0, 0xb8, 0x38, 0x0, 0xb, 0x2c, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0xf, 0xf0,
-    0x0, 0x3, 0xec, 0x0, 0x0, 0xe3, 0x80, 0x0,
-    0xb0, 0xb8, 0x0, 0xb8, 0xb, 0xea, 0xf8, 0x0,
-    0x6f, 0xe4, 0x0,
-
-    /* U+F4 "ô" */
-    0x0, 0x3f, 0x0, 0x0, 0x3c, 0xf0, 0x0, 0x38,
-    0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe4, 0x0, 0xbe, 0xaf, 0x80, 0xb8,
-    0x0, 0xb8, 0x38, 0x0, 0xb, 0x2c, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0xf, 0xf0,
-    0x0, 0x3, 0xec, 0x0, 0x0, 0xe3, 0x80, 0x0,
-    0xb0, 0xb8, 0x0, 0xb8, 0xb, 0xea, 0xf8, 0x0,
-    0x6f, 0xe4, 0x0,
-
-    /* U+F5 "õ" */
-    0x1, 0xf0, 0x30, 0x0, 0xd7, 0xc, 0x0, 0x30,
-    0x3d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe4, 0x0, 0xbe, 0xaf, 0x80, 0xb8,
-    0x0, 0xb8, 0x38, 0x0, 0xb, 0x2c, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0xf, 0xf0,
-    0x0, 0x3, 0xec, 0x0, 0x0, 0xe3, 0x80, 0x0,
-    0xb0, 0xb8, 0x0, 0xb8, 0xb, 0xea, 0xf8, 0x0,
-    0x6f, 0xe4, 0x0,
-
-    /* U+FA "ú" */
-    0x0, 0x2, 0xd0, 0x0, 0xf, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0xf, 0xf0, 0x0, 0xf, 0xf0, 0x0, 0xf,
-    0xf0, 0x0, 0xf, 0xf0, 0x0, 0xf, 0xf0, 0x0,
-    0xf, 0xf0, 0x0, 0xf, 0xb0, 0x0, 0xf, 0xb0,
-    0x0, 0xf, 0x74, 0x0, 0x2f, 0x3c, 0x0, 0x7f,
-    0x1f, 0x9b, 0xdf, 0x2, 0xfe, 0xf,
-
-    /* U+20AC "€" */
-    0x0, 0x0, 0x6f, 0xf9, 0x0, 0x0, 0x1f, 0xfa,
-    0xbf, 0x0, 0x1, 0xf4, 0x0, 0x1f, 0x0, 0x1f,
-    0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xc0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1e, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x1, 0x40, 0x0, 0xf8, 0x0, 0x2f, 0x0,
-    0x0, 0xbf, 0xaf, 0xf0, 0x0, 0x0, 0x6f, 0xf9,
-    0x0,
-
-    /* U+2122 "™" */
-    0xff, 0xff, 0xc7, 0x0, 0x0, 0x70, 0x1d, 0x0,
-    0x78, 0x0, 0xf, 0x0, 0xc0, 0x7, 0xc0, 0x2,
-    0xf0, 0xc, 0x0, 0x77, 0x0, 0x77, 0x0, 0xc0,
-    0x7, 0x38, 0xd, 0x70, 0xc, 0x0, 0x70, 0xc2,
-    0x87, 0x0, 0xc0, 0x7, 0xb, 0x30, 0x70, 0xc,
-    0x0, 0x70, 0x3d, 0x7, 0x0, 0xc0, 0x7, 0x0,
-    0x80, 0x70, 0xc, 0x0, 0x70, 0x0, 0x7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 101, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 100, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17, .adv_w = 143, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 30, .adv_w = 267, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 98, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 173, .adv_w = 318, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 250, .adv_w = 257, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 318, .adv_w = 78, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 324, .adv_w = 126, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 353, .adv_w = 126, .box_w = 6, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 388, .adv_w = 148, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 409, .adv_w = 221, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 442, .adv_w = 81, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 448, .adv_w = 147, .box_w = 7, .box_h = 2, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 452, .adv_w = 81, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 455, .adv_w = 129, .box_w = 10, .box_h = 23, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 513, .adv_w = 254, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 573, .adv_w = 139, .box_w = 6, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 599, .adv_w = 218, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 655, .adv_w = 217, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 711, .adv_w = 254, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 779, .adv_w = 217, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 835, .adv_w = 234, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 891, .adv_w = 226, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 951, .adv_w = 245, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1011, .adv_w = 234, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1071, .adv_w = 81, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1081, .adv_w = 81, .box_w = 3, .box_h = 17, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1094, .adv_w = 221, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1127, .adv_w = 221, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 1154, .adv_w = 221, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1187, .adv_w = 218, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1238, .adv_w = 397, .box_w = 23, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1365, .adv_w = 275, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1442, .adv_w = 290, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1506, .adv_w = 276, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1574, .adv_w = 317, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1647, .adv_w = 257, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1703, .adv_w = 243, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1759, .adv_w = 297, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1827, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1891, .adv_w = 116, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1904, .adv_w = 192, .box_w = 11, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1951, .adv_w = 273, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2015, .adv_w = 226, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2066, .adv_w = 367, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2147, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2211, .adv_w = 322, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2288, .adv_w = 276, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2348, .adv_w = 322, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2448, .adv_w = 278, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2512, .adv_w = 236, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2568, .adv_w = 220, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2628, .adv_w = 304, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2692, .adv_w = 268, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2765, .adv_w = 427, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2876, .adv_w = 252, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2944, .adv_w = 244, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3012, .adv_w = 250, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3072, .adv_w = 122, .box_w = 6, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 3107, .adv_w = 129, .box_w = 10, .box_h = 23, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 3165, .adv_w = 122, .box_w = 5, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 3194, .adv_w = 221, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 3222, .adv_w = 192, .box_w = 12, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3228, .adv_w = 230, .box_w = 6, .box_h = 3, .ofs_x = 3, .ofs_y = 15},
-    {.bitmap_index = 3233, .adv_w = 227, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3269, .adv_w = 260, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3332, .adv_w = 216, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3371, .adv_w = 260, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3430, .adv_w = 232, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3473, .adv_w = 130, .box_w = 9, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3514, .adv_w = 263, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3577, .adv_w = 260, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3631, .adv_w = 103, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3649, .adv_w = 105, .box_w = 8, .box_h = 23, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 3695, .adv_w = 231, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3754, .adv_w = 103, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3768, .adv_w = 407, .box_w = 22, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3840, .adv_w = 260, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3879, .adv_w = 241, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3922, .adv_w = 260, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 3985, .adv_w = 260, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4044, .adv_w = 154, .box_w = 7, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4067, .adv_w = 188, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4103, .adv_w = 156, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4143, .adv_w = 258, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4182, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4225, .adv_w = 338, .box_w = 21, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4294, .adv_w = 205, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4337, .adv_w = 208, .box_w = 14, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 4400, .adv_w = 196, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4436, .adv_w = 128, .box_w = 7, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4477, .adv_w = 113, .box_w = 3, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 4495, .adv_w = 128, .box_w = 7, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 4536, .adv_w = 221, .box_w = 12, .box_h = 5, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 4551, .adv_w = 311, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4628, .adv_w = 154, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 4644, .adv_w = 311, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4721, .adv_w = 221, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4766, .adv_w = 165, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 4791, .adv_w = 159, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 4814, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4913, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5012, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5111, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5210, .adv_w = 276, .box_w = 16, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 5302, .adv_w = 257, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5374, .adv_w = 257, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5446, .adv_w = 116, .box_w = 6, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5479, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5578, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5677, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5776, .adv_w = 304, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5859, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5909, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5959, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6009, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6059, .adv_w = 216, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 6116, .adv_w = 232, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6175, .adv_w = 232, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6234, .adv_w = 103, .box_w = 7, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6266, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6325, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6384, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6443, .adv_w = 258, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6497, .adv_w = 308, .box_w = 19, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6578, .adv_w = 392, .box_w = 22, .box_h = 11, .ofs_x = 0, .ofs_y = 6}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x1, 0x5, 0x8, 0x9, 0x11, 0x17, 0x18,
-    0x19, 0x1a, 0x1e, 0x20, 0x21, 0x24, 0x2a, 0x2b,
-    0x2c, 0x31, 0x37, 0x38, 0x39, 0x3a, 0x3e, 0x40,
-    0x41, 0x44, 0x4a, 0x4b, 0x4c, 0x51, 0x2003, 0x2079
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 169, .range_length = 8314, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    22, 8, 22, 0, 0, 8, 23, 23,
-    23, 23, 25, 26, 26, 29, 22, 22,
-    22, 30, 45, 45, 45, 45, 47, 49,
-    49, 51, 46, 46, 46, 51, 25, 61
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    23, 8, 23, 0, 0, 8, 24, 24,
-    24, 24, 23, 25, 25, 25, 23, 23,
-    23, 28, 37, 37, 37, 37, 39, 39,
-    39, 42, 39, 39, 39, 45, 49, 50
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 4, 0, 0, 0,
-    0, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2, 1, 17, 0, 11, -10, 0,
-    0, 0, 0, -21, -23, 3, 18, 10,
-    7, -15, 3, 20, 2, 17, 4, 13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 23, 2, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -8, 15, 0, -12, 0, 0,
-    0, 0, 0, -8, 7, 8, 0, 0,
-    -4, 0, -3, 4, 0, -4, 0, -4,
-    -2, -8, 0, 0, 0, 0, -4, 0,
-    0, -5, -6, 0, 0, -4, 0, -8,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, -4, 0, 0, 0, 0, -11,
-    0, -46, 0, 0, -8, 0, 8, 12,
-    0, 0, -8, 4, 4, 13, 8, -7,
-    8, 0, 0, -22, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -15,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, -20, 0, -15, -3, 0, 0, 0,
-    0, 2, 17, 0, -12, -2, -1, 1,
-    0, -7, 0, 0, -2, -30, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -31, -2, 17, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -12, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 12, 0, 4, 0,
-    0, -8, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 13, 2, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -15, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 2, 8,
-    4, 12, -4, 0, 0, 8, -4, -12,
-    -54, 3, 11, 8, 1, -5, 0, 15,
-    0, 13, 0, 13, 0, -35, 0, -4,
-    12, 0, 13, -4, 8, 4, 0, 0,
-    1, -4, 0, 0, -7, 31, 0, 31,
-    0, 12, 0, 17, 5, 7, 3, 15,
-    0, 0, 0, -15, 0, 0, 0, 0,
-    1, -2, 0, 3, -7, -5, -8, 3,
-    0, -4, 0, 0, 0, -15, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -25, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    3, -8, 1, -21, 0, -24, 0, 0,
-    0, 0, -2, 0, 40, -4, -5, 4,
-    4, -5, 0, -5, 4, 0, 0, -20,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -38, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, -15, 0, 23, 0, 0,
-    -15, 0, 12, 0, -26, -38, -25, -8,
-    12, 0, 0, -26, 0, 6, -8, 0,
-    -6, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 12, -48,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 18, 0, 3,
-    0, 0, 0, 0, 0, 3, 3, -4,
-    -8, 0, -1, -1, -4, 0, 0, -3,
-    0, 0, 0, -8, 0, -3, 0, -8,
-    -8, 0, -10, -12, -12, -8, 0, -8,
-    0, -8, 0, 0, 0, 0, -3, 0,
-    0, 4, 0, 3, -4, 0, 0, 0,
-    0, 0, 0, 4, -3, 0, 0, 0,
-    -3, 4, 4, -2, 0, 0, 0, -9,
-    0, -2, 0, 0, 0, 0, 0, 1,
-    0, 5, -3, 0, -4, 0, -6, 0,
-    0, -3, 0, 12, 0, 0, -4, 0,
-    0, 0, 0, 0, -2, 2, -3, -3,
-    0, 0, 0, -4, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    -2, 0, -4, -5, 0, 0, 0, 0,
-    0, 2, 0, 0, -2, 0, -4, -4,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, -2,
-    -5, 0, 0, 0, 0, -12, -3, -12,
-    8, 0, 0, -8, 4, 8, 11, 0,
-    -10, -2, -6, 0, -2, -19, 4, -3,
-    2, -20, 4, 0, 0, 1, -20, 0,
-    -20, -3, -33, -3, 0, -19, 0, 8,
-    11, 0, 5, 0, 0, 0, 0, 0,
-    0, -6, -5, 0, 4, -8, 0, 0,
-    0, -4, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, -2, -2, 0, -2, -5,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    -4, 0, -2, -4, -3, 0, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, -3, 0, 0, 0,
-    0, -3, 0, -8, 4, 0, 0, -6,
-    2, 4, 4, 0, 0, 0, 0, 0,
-    0, -3, 0, 0, 0, 0, 0, 3,
-    0, 0, -4, 0, -4, -3, -6, 0,
-    0, 0, 0, 0, 0, 0, 3, 0,
-    -3, 0, 0, 0, 0, -3, -6, 0,
-    4, 0, 0, 12, -3, 1, -13, 0,
-    0, 11, -19, -20, -17, -8, 4, 0,
-    -3, -25, -7, 0, -7, 0, -8, 6,
-    -7, -25, 0, -11, 0, 0, 2, -2,
-    3, -3, 0, 4, -1, -12, -15, 0,
-    -19, -10, -8, -10, -12, -6, -11, -2,
-    -9, -12, -8, 15, 0, 2, 0, -4,
-    0, 0, 0, 3, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, 0, -2, 0, -2, -4, 0,
-    -6, -8, -8, -2, 0, -12, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, 2, -2, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    17, 0, 0, 0, 0, 0, 0, 3,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -7,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, -9, 0, 0, 0,
-    0, -19, -12, 0, 0, 0, -6, -19,
-    0, 0, -4, 4, 0, -12, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, 0, 0, -8, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -7, 0, 0, 0, 0,
-    6, 0, 3, -8, -8, 0, -4, -4,
-    -4, 0, 0, 0, 0, 0, 0, -12,
-    0, -4, 0, -6, -4, 0, -8, -10,
-    -12, -3, 0, -8, 0, -12, 0, 0,
-    0, 0, 31, 0, 0, 2, 0, 0,
-    -5, 0, 0, 2, 0, -17, 0, 0,
-    0, 0, 0, -35, -6, 13, 12, -3,
-    -16, 0, 4, -6, 0, -19, -2, -5,
-    4, -27, -4, 3, 0, 6, -13, -6,
-    -14, -12, -16, 0, 0, -23, 0, 22,
-    0, 0, -2, 0, 0, 0, -2, -2,
-    -4, -10, -12, 0, 0, -28, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, -2, -4, -6, 0, 0, -8,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -2, 0, -8, 0, 0, 8,
-    -1, 5, 0, -9, 4, -3, -2, -12,
-    -4, 0, -5, -4, -2, 0, -6, -7,
-    0, 0, -3, -1, -3, -7, -6, 0,
-    0, -4, 0, 4, -3, 0, -9, 0,
-    0, 0, -8, 0, -7, 0, -7, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -8, 4, 0, -6, 0, -3,
-    -6, -15, -3, -3, -3, -2, -3, -6,
-    -2, 0, 0, 0, 0, 0, -4, -3,
-    -3, 0, 0, 0, 0, 6, -3, 0,
-    -3, 0, 0, 0, -3, -6, -3, -4,
-    -6, -4, 0, 0, 2, 15, -2, 0,
-    -12, 0, -3, 8, 0, -4, -17, -5,
-    6, 0, 0, -19, -7, 4, -7, 2,
-    0, -5, -3, -13, 0, -6, 2, 0,
-    0, -7, 0, 0, 0, 4, 4, -8,
-    -8, 0, -7, -4, -6, -4, -4, 0,
-    -7, 2, -8, -7, 0, 12, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -6, 0, 0, -5, 0, 0, -4,
-    -4, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, 0, -6, 0,
-    -8, 0, 0, 0, -12, 0, 3, -8,
-    8, 0, -3, -18, 0, 0, -8, -4,
-    0, -15, -10, -10, 0, 0, -15, -4,
-    -15, -14, -18, 0, -12, 0, 2, 26,
-    -5, 0, -9, -4, -2, -4, -7, -11,
-    -7, -14, -15, -8, 0, 8, 0, 0,
-    -3, 0, 1, 0, 0, -27, -5, 12,
-    10, -10, -15, 0, 1, -15, 0, -19,
-    -3, -4, 8, -36, -5, 1, 0, 0,
-    -25, -5, -20, -4, -28, 0, 0, -27,
-    0, 24, 1, 0, -3, 0, 0, 0,
-    0, -2, -3, -15, -3, 0, 0, -25,
-    0, 0, 0, 0, -13, 0, -4, 0,
-    -1, -11, -18, 0, 0, -2, -6, -12,
-    -4, 0, -2, 0, 0, 0, 0, -17,
-    -4, -13, -13, -2, -6, -10, -4, -7,
-    0, -8, -4, -12, -6, 0, -5, -9,
-    -4, -9, 0, 2, 0, -3, -13, 0,
-    0, 0, 0, -7, 0, 0, 0, 0,
-    6, 0, 3, -8, 14, 0, -4, -4,
-    -4, 0, 0, 0, 0, 0, 0, -12,
-    0, -4, 0, -6, -4, 0, -8, -10,
-    -12, -3, 0, -8, 2, 15, 0, 0,
-    0, 0, 31, 0, 0, 2, 0, 0,
-    -5, 0, 0, 2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -8, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, -4, -4, 0,
-    0, -8, -4, 0, 0, -8, 0, 7,
-    -2, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, 0, 0, 8, 2,
-    -4, 0, -13, -7, 0, 12, -12, -12,
-    -8, -8, 15, 6, 4, -34, -2, 8,
-    -4, 0, -4, 3, -4, -13, 0, -4,
-    4, -5, -2, -12, -2, 0, 0, 12,
-    8, 0, -11, 0, -21, -5, 8, -5,
-    -15, 1, -5, -13, -13, -4, 0, 19,
-    4, 0, -6, 0, -11, 0, 2, 13,
-    -8, -14, -15, -10, 12, 0, 1, -28,
-    -3, 4, -6, -2, -8, 0, -8, -14,
-    -6, -6, -2, 0, 0, -8, -7, -4,
-    0, 12, 8, -4, -21, 0, -21, -7,
-    0, -13, -22, -1, -12, -6, -13, -10,
-    0, 15, 0, 0, -5, 0, -8, -4,
-    0, -4, -7, 0, 7, -12, 4, 0,
-    0, -20, 0, -4, -8, -6, -2, -12,
-    -10, -12, -9, 0, -12, -4, -8, -9,
-    -12, -4, 0, 0, 1, 18, -6, 0,
-    -12, -4, 0, -4, -8, -8, -10, -10,
-    -13, -5, 0, 12, 8, 0, -6, 0,
-    -19, -6, 2, 8, -12, -14, -8, -12,
-    12, -4, 2, -35, -7, 8, -8, -6,
-    -14, 0, -12, -16, -6, -4, -2, -4,
-    -7, -12, -1, 0, 0, 12, 10, -3,
-    -25, 0, -23, -11, 8, -15, -26, -8,
-    -13, -16, -19, -12, 0, 19, 0, 0,
-    0, 0, -6, 0, 0, 4, -6, 8,
-    3, -8, 8, 0, 0, -15, -2, 0,
-    -2, 0, 1, 1, -3, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    2, 12, 0, 0, -6, 0, 0, 0,
-    0, -3, -3, -6, 0, 0, 0, 12,
-    1, 2, 0, 0, 0, 0, 2, 0,
-    -4, 0, 13, 0, 6, 1, 1, -5,
-    0, 8, 0, 0, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 12, 0, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 17, 0, -23, 0, -4, 7, 0,
-    12, 0, 0, 40, 6, -8, -8, 4,
-    4, -3, 1, -19, 0, 0, 17, -23,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -25, 13, 54, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -23, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, 0,
-    0, -9, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, -11, 0, 0, 1, 0, 0, 4,
-    51, -8, -3, 13, 11, -11, 4, 0,
-    0, 4, 4, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -50,
-    10, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -3, -19,
-    0, 0, 0, -11, 0, 0, 0, -11,
-    0, 0, 0, 0, -9, -2, 0, 0,
-    0, -9, 0, -6, 0, -18, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -26, 0, 0, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, -4, 0, 0,
-    0, -11, 0, -6, 0, -11, 0, 0,
-    0, -7, 4, -6, 0, 0, -11, -4,
-    -9, 0, 0, -11, 0, -4, 0, -18,
-    0, -3, 0, 0, -32, -9, -15, -3,
-    -13, 0, 0, -26, 0, -11, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -6,
-    -7, -3, 0, -12, 0, 0, 0, 0,
-    -10, 0, -8, 5, -3, 8, 0, -3,
-    -9, -3, -7, -9, 0, -6, -2, -3,
-    2, -11, -1, 0, 0, 0, -36, -2,
-    -4, 0, -6, 0, -3, -18, -4, 0,
-    0, -3, -3, 0, 0, 0, 0, 2,
-    0, -3, -7, -3, 0, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, -10, 0, -3, 0, 0, 0, -8,
-    4, 0, 0, 0, -11, -4, -8, 0,
-    0, -11, 0, -4, 0, -18, 0, 0,
-    0, 0, -38, 0, -8, -14, -19, 0,
-    0, -26, 0, -2, -6, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, -6, -2,
-    0, -12, 1, 0, 0, 7, -5, 0,
-    10, 20, -4, -4, -12, 6, 20, 7,
-    10, -11, 6, 17, 6, 12, 10, 11,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 25, 18, -6, -4, 0,
-    -3, 31, 16, 31, 0, 0, 0, 4,
-    0, 0, 0, 31, 0, 0, -7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, -35, -6,
-    -2, -17, -20, 0, 0, -26, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 4, 0, 0, 0, 0,
-    -35, -6, -2, -17, -20, 0, 0, -19,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    -8, 4, 0, -4, 2, 6, 4, -12,
-    0, -2, -3, 4, 0, 2, 0, 0,
-    0, 0, -12, 0, -4, -3, -8, 0,
-    -4, -15, 0, 25, -4, 0, -8, -3,
-    0, -3, -6, 0, -4, -10, -8, -4,
-    0, 0, 0, 0, -7, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, -35, -6, -2, -17,
-    -20, 0, 0, -26, 0, 0, 0, 0,
-    0, 0, 19, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, 0,
-    -13, -6, -4, 12, -4, -4, -15, 1,
-    -4, 1, -3, -12, 0, 8, 0, 2,
-    1, 2, -10, -15, -6, 0, -17, -9,
-    -11, -17, -16, 0, -7, -8, -6, -5,
-    -3, -3, -5, -3, 0, -3, -2, 6,
-    0, 6, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -4, -4, 0, 0, -11,
-    0, -2, 0, -7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -23,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, -7,
-    0, 0, 0, 0, -3, 0, 0, -7,
-    -4, 4, 0, -7, -8, -3, 0, -13,
-    -3, -10, -2, -6, 0, -7, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -26, 0, 13, 0, 0, -7, 0,
-    0, 0, 0, -5, 0, -4, 0, 0,
-    0, -11, 0, 0, -3, 0, -8, 0,
-    0, 17, -5, -13, -11, 3, 3, 3,
-    -2, -10, 3, 6, 3, 12, 3, 12,
-    -3, -10, 0, 0, -19, 0, 0, -12,
-    -11, 0, 0, -8, 0, -5, -6, 0,
-    -6, 0, -6, 0, -2, 6, 0, -2,
-    -12, -4, 0, 0, 0, 0, -4, 0,
-    -8, 0, 0, 5, -8, 0, 4, -4,
-    2, -1, 0, -12, 0, -3, -1, 0,
-    -4, 3, -2, 0, 0, 0, -19, -6,
-    -8, 0, -12, 0, 0, -18, 0, 15,
-    -4, 0, -7, 0, -1, 0, -4, 0,
-    -4, -12, 0, -4, 0, 0, 0, 0,
-    0, 0, -3, 0, 0, 4, -5, 1,
-    0, 0, -6, -3, 0, -6, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -25,
-    0, 10, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    4, 0, -17, 0, 0, 0, 0, 0,
-    0, 5, 0, 12, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 15, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 61,
-    .right_class_cnt     = 50,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t sr_font_montserrat_24 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 28,          /*The maximum line height required by the font*/
-    .base_line = 6,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if SR_FONT_MONTSERRAT_24*/
-
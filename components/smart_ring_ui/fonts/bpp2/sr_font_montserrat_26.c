@@ -1,1941 +0,0 @@
-#include "lvgl/lvgl.h"
-
-/*******************************************************************************
- * Size: 26 px
- * Bpp: 2
- * Opts: 
- ******************************************************************************/
-
-#ifndef SR_FONT_MONTSERRAT_26
-#define SR_FONT_MONTSERRAT_26 1
-#endif
-
-#if SR_FONT_MONTSERRAT_26
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+20 " " */
-
-    /* U+21 "!" */
-    0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6c, 0x71, 0xc7,
-    0x1c, 0x70, 0x0, 0x18, 0xfa, 0xd0,
-
-    /* U+22 "\"" */
-    0x34, 0x3c, 0xd0, 0xb3, 0x42, 0xcd, 0xb, 0x34,
-    0x2c, 0xd0, 0xb3, 0x42, 0x80,
-
-    /* U+23 "#" */
-    0x0, 0xd, 0x0, 0x30, 0x0, 0x0, 0xd0, 0x7,
-    0x0, 0x0, 0x1c, 0x0, 0xb0, 0x0, 0x1, 0xc0,
-    0xa, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xd0, 0x57,
-    0xd5, 0x5e, 0x54, 0x0, 0x38, 0x0, 0xd0, 0x0,
-    0x3, 0x80, 0xd, 0x0, 0x0, 0x34, 0x1, 0xc0,
-    0x0, 0x3, 0x40, 0x1c, 0x0, 0x0, 0x30, 0x1,
-    0xc0, 0x0, 0x7, 0x0, 0x2c, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x41, 0x5b, 0x55, 0x79, 0x50, 0x0,
-    0xa0, 0x3, 0x40, 0x0, 0xe, 0x0, 0x34, 0x0,
-    0x0, 0xd0, 0x3, 0x0, 0x0, 0xd, 0x0, 0x70,
-    0x0,
-
-    /* U+24 "$" */
-    0x0, 0x5, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0,
-    0xa, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x1, 0xbf,
-    0xf8, 0x0, 0xbf, 0xfb, 0xf8, 0x2f, 0xa, 0x2,
-    0x83, 0xc0, 0xa0, 0x0, 0x78, 0xa, 0x0, 0x7,
-    0x80, 0xa0, 0x0, 0x3d, 0xa, 0x0, 0x1, 0xf9,
-    0xa0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x2, 0xff,
-    0xd0, 0x0, 0xb, 0x6f, 0x80, 0x0, 0xa0, 0x3d,
-    0x0, 0xa, 0x1, 0xe0, 0x0, 0xa0, 0xe, 0x10,
-    0xa, 0x1, 0xeb, 0x80, 0xa0, 0x7c, 0x2f, 0xef,
-    0xbf, 0x40, 0x2f, 0xff, 0x80, 0x0, 0xa, 0x0,
-    0x0, 0x0, 0xa0, 0x0, 0x0, 0xa, 0x0, 0x0,
-
-    /* U+25 "%" */
-    0xb, 0xf4, 0x0, 0x3, 0x40, 0x3d, 0x6d, 0x0,
-    0xe, 0x0, 0xb0, 0xb, 0x0, 0x2c, 0x0, 0xe0,
-    0x3, 0x0, 0x34, 0x0, 0xd0, 0x3, 0x40, 0xe0,
-    0x0, 0xe0, 0x3, 0x2, 0xc0, 0x0, 0xb0, 0x7,
-    0x7, 0x40, 0x0, 0x38, 0x1d, 0xe, 0x0, 0x0,
-    0xf, 0xf4, 0x2c, 0x2f, 0xd0, 0x0, 0x0, 0x70,
-    0xb4, 0x74, 0x0, 0x0, 0xe1, 0xc0, 0x1c, 0x0,
-    0x2, 0xc2, 0xc0, 0xd, 0x0, 0x7, 0x2, 0x80,
-    0xd, 0x0, 0xd, 0x2, 0x80, 0xd, 0x0, 0x38,
-    0x2, 0x80, 0xd, 0x0, 0x70, 0x1, 0xc0, 0x1c,
-    0x0, 0xd0, 0x0, 0xb0, 0x74, 0x3, 0x80, 0x0,
-    0x2f, 0xd0,
-
-    /* U+26 "&" */
-    0x0, 0x7f, 0xd0, 0x0, 0x0, 0xbd, 0x6e, 0x0,
-    0x0, 0x38, 0x2, 0xc0, 0x0, 0x1d, 0x0, 0x34,
-    0x0, 0x7, 0x40, 0x1c, 0x0, 0x0, 0xf0, 0x1e,
-    0x0, 0x0, 0x1e, 0x2f, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x1, 0xf6,
-    0xe0, 0x0, 0x2, 0xe0, 0x2e, 0x2, 0xc0, 0xe0,
-    0x2, 0xe0, 0xe0, 0xb0, 0x0, 0x2e, 0x74, 0x2c,
-    0x0, 0x2, 0xfc, 0xb, 0x40, 0x0, 0x3e, 0x0,
-    0xf4, 0x0, 0x3f, 0xe0, 0x1f, 0xea, 0xfd, 0x2e,
-    0x0, 0xbf, 0xf4, 0x2, 0x80, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+27 "'" */
-    0x34, 0xd3, 0x4d, 0x34, 0xd3, 0x40,
-
-    /* U+28 "(" */
-    0x2, 0xc0, 0x3c, 0xb, 0x40, 0xf0, 0xe, 0x1,
-    0xd0, 0x2c, 0x3, 0xc0, 0x3c, 0x3, 0x80, 0x38,
-    0x3, 0x80, 0x78, 0x3, 0x80, 0x38, 0x3, 0x80,
-    0x3c, 0x3, 0xc0, 0x2c, 0x1, 0xd0, 0xe, 0x0,
-    0xf0, 0x7, 0x40, 0x3c, 0x2, 0xc0,
-
-    /* U+29 ")" */
-    0xb0, 0xe, 0x3, 0xc0, 0x74, 0xe, 0x3, 0xc0,
-    0xb0, 0x1d, 0x3, 0x80, 0xe0, 0x38, 0xf, 0x3,
-    0xc0, 0xf0, 0x38, 0xe, 0x3, 0x81, 0xd0, 0xb0,
-    0x3c, 0xe, 0x7, 0x43, 0xc0, 0xe0, 0xb0, 0x0,
-
-    /* U+2A "*" */
-    0x0, 0xa0, 0x0, 0xa, 0x0, 0x34, 0xa1, 0xc1,
-    0xfb, 0xf4, 0x2, 0xf8, 0x0, 0x7f, 0xd0, 0x3d,
-    0xa7, 0xc2, 0xa, 0x4, 0x0, 0xa0, 0x0, 0x5,
-    0x0,
-
-    /* U+2B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x40, 0x0, 0x1,
-    0xd0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x1d, 0x0,
-    0xa, 0xab, 0xaa, 0x83, 0xff, 0xff, 0xf0, 0x0,
-    0x74, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x7, 0x40,
-    0x0, 0x1, 0xd0, 0x0, 0x0, 0x74, 0x0,
-
-    /* U+2C "," */
-    0x24, 0xbc, 0x7c, 0x3c, 0x34, 0x30, 0x70,
-
-    /* U+2D "-" */
-    0x6a, 0xa8, 0x7f, 0xfd,
-
-    /* U+2E "." */
-    0x38, 0xbc, 0x38,
-
-    /* U+2F "/" */
-    0x0, 0x0, 0x34, 0x0, 0x2, 0xc0, 0x0, 0xf,
-    0x0, 0x0, 0x74, 0x0, 0x2, 0xc0, 0x0, 0xe,
-    0x0, 0x0, 0x74, 0x0, 0x2, 0xc0, 0x0, 0xe,
-    0x0, 0x0, 0x74, 0x0, 0x2, 0xc0, 0x0, 0xe,
-    0x0, 0x0, 0x74, 0x0, 0x2, 0xc0, 0x0, 0xe,
-    0x0, 0x0, 0x74, 0x0, 0x2, 0xc0, 0x0, 0xe,
-    0x0, 0x0, 0x74, 0x0, 0x3, 0xc0, 0x0, 0xe,
-    0x0, 0x0, 0x70, 0x0, 0x3, 0xc0, 0x0, 0xe,
-    0x0, 0x0, 0x70, 0x0, 0x0,
-
-    /* U+30 "0" */
-    0x0, 0x6f, 0xe4, 0x0, 0xb, 0xff, 0xf8, 0x0,
-    0xbd, 0x0, 0xbc, 0x7, 0xc0, 0x0, 0xb8, 0x3d,
-    0x0, 0x0, 0xf0, 0xf0, 0x0, 0x2, 0xd7, 0x80,
-    0x0, 0x7, 0xad, 0x0, 0x0, 0xf, 0xb4, 0x0,
-    0x0, 0x3e, 0xd0, 0x0, 0x0, 0xfb, 0x40, 0x0,
-    0x3, 0xde, 0x0, 0x0, 0x1e, 0x3c, 0x0, 0x0,
-    0xb4, 0xf0, 0x0, 0x3, 0xc1, 0xf0, 0x0, 0x2e,
-    0x2, 0xf0, 0x2, 0xf0, 0x2, 0xff, 0xff, 0x0,
-    0x1, 0xbf, 0x90, 0x0,
-
-    /* U+31 "1" */
-    0xff, 0xf6, 0xab, 0xd0, 0x7, 0x40, 0x1d, 0x0,
-    0x74, 0x1, 0xd0, 0x7, 0x40, 0x1d, 0x0, 0x74,
-    0x1, 0xd0, 0x7, 0x40, 0x1d, 0x0, 0x74, 0x1,
-    0xd0, 0x7, 0x40, 0x1d, 0x0, 0x74, 0x1, 0xd0,
-
-    /* U+32 "2" */
-    0x1, 0xbf, 0xe0, 0x1, 0xff, 0xff, 0xe0, 0x3d,
-    0x0, 0x1f, 0x41, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x2e, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x2, 0xf0, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x2e, 0x0, 0x0, 0xb, 0x80,
-    0x0, 0x2, 0xe0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x3f, 0xaa, 0xaa, 0xa3, 0xff, 0xff, 0xff,
-
-    /* U+33 "3" */
-    0x3f, 0xff, 0xff, 0x82, 0xaa, 0xaa, 0xf8, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x2, 0xf5, 0x0, 0x0, 0x3f, 0xfd, 0x0,
-    0x0, 0x2, 0xf4, 0x0, 0x0, 0x7, 0xc0, 0x0,
-    0x0, 0x2d, 0x0, 0x0, 0x2, 0xd0, 0x0, 0x0,
-    0x2d, 0x20, 0x0, 0x3, 0xcb, 0xd0, 0x1, 0xf4,
-    0x2f, 0xff, 0xfe, 0x0, 0x1b, 0xfe, 0x0,
-
-    /* U+34 "4" */
-    0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x3d, 0x0, 0x0,
-    0x0, 0xb4, 0x0, 0x0, 0x2, 0xe0, 0xb, 0x0,
-    0x7, 0x80, 0xb, 0x0, 0xf, 0x0, 0xb, 0x0,
-    0x3c, 0x0, 0xb, 0x0, 0xfe, 0xaa, 0xaf, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0,
-
-    /* U+35 "5" */
-    0x7, 0xff, 0xff, 0x80, 0x7e, 0xaa, 0xa8, 0x7,
-    0x40, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x40, 0xa, 0xab, 0xff, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x3, 0xd0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x1e, 0x20, 0x0, 0x3, 0xd3, 0xe0, 0x0, 0xbc,
-    0x1f, 0xff, 0xff, 0x0, 0x1b, 0xfe, 0x40,
-
-    /* U+36 "6" */
-    0x0, 0x1f, 0xfe, 0x0, 0x7, 0xfe, 0xbe, 0x0,
-    0x7d, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x7, 0x40,
-    0x0, 0x0, 0x2d, 0xb, 0xfe, 0x0, 0xb5, 0xfa,
-    0xbf, 0x42, 0xee, 0x0, 0x1f, 0xb, 0xe0, 0x0,
-    0x1e, 0x1f, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0,
-    0xf0, 0xf0, 0x0, 0x3, 0xc1, 0xe0, 0x0, 0x1e,
-    0x3, 0xe0, 0x1, 0xf0, 0x3, 0xfa, 0xbf, 0x40,
-    0x1, 0xbf, 0xd0, 0x0,
-
-    /* U+37 "7" */
-    0x3f, 0xff, 0xff, 0xf0, 0xfa, 0xaa, 0xab, 0xc3,
-    0x80, 0x0, 0x1e, 0xe, 0x0, 0x0, 0xf0, 0x38,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x2d, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0xb, 0x40, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x2, 0xd0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x3d, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0,
-
-    /* U+38 "8" */
-    0x1, 0xbf, 0xe4, 0x0, 0x2f, 0xea, 0xfd, 0x2,
-    0xf0, 0x0, 0x7c, 0xf, 0x0, 0x0, 0x78, 0x3c,
-    0x0, 0x0, 0xe0, 0xf0, 0x0, 0x7, 0x81, 0xe0,
-    0x0, 0x7c, 0x1, 0xfa, 0xaf, 0xc0, 0x3, 0xff,
-    0xfd, 0x0, 0x7d, 0x0, 0x6f, 0x3, 0xc0, 0x0,
-    0x1e, 0x2d, 0x0, 0x0, 0x3c, 0xb0, 0x0, 0x0,
-    0xb6, 0xd0, 0x0, 0x2, 0xc7, 0x80, 0x0, 0xf,
-    0xf, 0x80, 0x1, 0xf4, 0xf, 0xfa, 0xbf, 0x40,
-    0x6, 0xff, 0xe0, 0x0,
-
-    /* U+39 "9" */
-    0x0, 0xbf, 0xe4, 0x0, 0x1f, 0xeb, 0xf8, 0x1,
-    0xf0, 0x0, 0xb8, 0xf, 0x0, 0x0, 0xb4, 0x3c,
-    0x0, 0x0, 0xf0, 0xe0, 0x0, 0x3, 0xc3, 0xc0,
-    0x0, 0x1f, 0x4b, 0x40, 0x0, 0xfd, 0xf, 0x90,
-    0x1f, 0x74, 0xf, 0xff, 0xe1, 0xd0, 0x1, 0xa4,
-    0xb, 0x40, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x7, 0xd0, 0xf, 0xeb, 0xfc, 0x0,
-    0x1b, 0xfe, 0x40, 0x0,
-
-    /* U+3A ":" */
-    0x78, 0xbc, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xbc, 0x38,
-
-    /* U+3B ";" */
-    0x78, 0xbc, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x24, 0xbc, 0x7c, 0x3c, 0x34,
-    0x30, 0x70,
-
-    /* U+3C "<" */
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x1b, 0xc0, 0x0,
-    0x7f, 0x80, 0x2, 0xfd, 0x0, 0x1f, 0xe0, 0x0,
-    0xf, 0x40, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x1b,
-    0xe4, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
-
-    /* U+3D "=" */
-    0x2a, 0xaa, 0xaa, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaa, 0xaa, 0xa0, 0xff,
-    0xff, 0xfc,
-
-    /* U+3E ">" */
-    0x10, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0xbf,
-    0x40, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0x0, 0x7, 0xc0, 0x0, 0x7, 0xf0, 0x0,
-    0x6f, 0x90, 0x1, 0xfe, 0x0, 0xb, 0xe4, 0x0,
-    0x3, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+3F "?" */
-    0x1, 0xbf, 0xe0, 0x7, 0xfe, 0xff, 0x87, 0xd0,
-    0x1, 0xf4, 0x40, 0x0, 0x1e, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0xb8, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x3, 0xc0, 0x0,
-
-    /* U+40 "@" */
-    0x0, 0x0, 0x6f, 0xfe, 0x40, 0x0, 0x0, 0x2,
-    0xfa, 0x56, 0xbe, 0x0, 0x0, 0x7, 0xd0, 0x0,
-    0x1, 0xf4, 0x0, 0xb, 0x80, 0x0, 0x0, 0xb,
-    0x80, 0x7, 0x40, 0x1f, 0xf4, 0x3c, 0x74, 0x3,
-    0x80, 0x3f, 0xab, 0xcf, 0xb, 0x2, 0xc0, 0x3d,
-    0x0, 0x2f, 0xc0, 0xe0, 0xe0, 0x2d, 0x0, 0x3,
-    0xf0, 0x1c, 0x70, 0xf, 0x0, 0x0, 0x7c, 0x3,
-    0x1c, 0x3, 0x80, 0x0, 0xf, 0x0, 0xdb, 0x1,
-    0xd0, 0x0, 0x3, 0xc0, 0x36, 0xc0, 0x74, 0x0,
-    0x0, 0xf0, 0xe, 0xb0, 0xe, 0x0, 0x0, 0x3c,
-    0x3, 0x5c, 0x3, 0xc0, 0x0, 0x1f, 0x0, 0xd7,
-    0x0, 0xb4, 0x0, 0xf, 0xc0, 0x70, 0xe0, 0xf,
-    0x40, 0xb, 0xb0, 0x38, 0x2c, 0x0, 0xfe, 0xaf,
-    0x1f, 0xbc, 0x3, 0x80, 0x7, 0xfd, 0x1, 0xfc,
-    0x0, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x56, 0xf8,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xe4, 0x0, 0x0,
-
-    /* U+41 "A" */
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x3e, 0xd0, 0x0, 0x0, 0x0,
-    0xe3, 0xc0, 0x0, 0x0, 0xb, 0xb, 0x40, 0x0,
-    0x0, 0x38, 0xf, 0x0, 0x0, 0x2, 0xc0, 0x2d,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x0, 0xb4,
-    0x0, 0xb0, 0x0, 0x3, 0xc0, 0x0, 0xe0, 0x0,
-    0x1d, 0x0, 0x2, 0xc0, 0x0, 0xfa, 0xaa, 0xaf,
-    0x80, 0x7, 0xff, 0xff, 0xff, 0x0, 0x3c, 0x0,
-    0x0, 0x1e, 0x1, 0xe0, 0x0, 0x0, 0x3c, 0xf,
-    0x0, 0x0, 0x0, 0xb4, 0x78, 0x0, 0x0, 0x0,
-    0xf2, 0xd0, 0x0, 0x0, 0x2, 0xd0,
-
-    /* U+42 "B" */
-    0x3f, 0xff, 0xfe, 0x40, 0xf, 0xaa, 0xab, 0xfc,
-    0x3, 0xc0, 0x0, 0xf, 0x80, 0xf0, 0x0, 0x0,
-    0xf0, 0x3c, 0x0, 0x0, 0x3c, 0xf, 0x0, 0x0,
-    0xf, 0x3, 0xc0, 0x0, 0x7, 0xc0, 0xf0, 0x0,
-    0xb, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0xf, 0xaa,
-    0xaa, 0xfd, 0x3, 0xc0, 0x0, 0x3, 0xd0, 0xf0,
-    0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0, 0xf, 0xf,
-    0x0, 0x0, 0x3, 0xc3, 0xc0, 0x0, 0x0, 0xf0,
-    0xf0, 0x0, 0x0, 0xf8, 0x3e, 0xaa, 0xab, 0xf8,
-    0xf, 0xff, 0xff, 0xe4, 0x0,
-
-    /* U+43 "C" */
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x3f, 0x80, 0x2, 0xf4, 0x2f, 0x0, 0x0,
-    0x8, 0x1f, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x2, 0xd0, 0x0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x20,
-    0xf, 0xe0, 0x0, 0xbd, 0x0, 0x7f, 0xff, 0xfd,
-    0x0, 0x1, 0xbf, 0xe4, 0x0,
-
-    /* U+44 "D" */
-    0x3f, 0xff, 0xfe, 0x40, 0x0, 0xfa, 0xaa, 0xff,
-    0xc0, 0x3, 0xc0, 0x0, 0x1b, 0xd0, 0xf, 0x0,
-    0x0, 0x7, 0xd0, 0x3c, 0x0, 0x0, 0x7, 0xc0,
-    0xf0, 0x0, 0x0, 0xb, 0x43, 0xc0, 0x0, 0x0,
-    0xf, 0xf, 0x0, 0x0, 0x0, 0x3c, 0x3c, 0x0,
-    0x0, 0x0, 0xf0, 0xf0, 0x0, 0x0, 0x3, 0xc3,
-    0xc0, 0x0, 0x0, 0xf, 0xf, 0x0, 0x0, 0x0,
-    0x3c, 0x3c, 0x0, 0x0, 0x2, 0xd0, 0xf0, 0x0,
-    0x0, 0x1f, 0x3, 0xc0, 0x0, 0x1, 0xf4, 0xf,
-    0x0, 0x0, 0x6f, 0x40, 0x3e, 0xaa, 0xbf, 0xf0,
-    0x0, 0xff, 0xff, 0xf9, 0x0, 0x0,
-
-    /* U+45 "E" */
-    0x3f, 0xff, 0xff, 0xd3, 0xea, 0xaa, 0xa9, 0x3c,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x43,
-    0xea, 0xaa, 0xa0, 0x3c, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x3e, 0xaa, 0xaa, 0xa3, 0xff, 0xff, 0xff,
-
-    /* U+46 "F" */
-    0x3f, 0xff, 0xff, 0xd3, 0xea, 0xaa, 0xa9, 0x3c,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x3e, 0xaa, 0xaa, 0x3,
-    0xff, 0xff, 0xf4, 0x3c, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-
-    /* U+47 "G" */
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x2f, 0x80, 0x1, 0xf4, 0x2f, 0x0, 0x0,
-    0x8, 0x1f, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x2, 0xd0, 0x0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0x0,
-    0x0, 0x0, 0xeb, 0x40, 0x0, 0x0, 0x39, 0xe0,
-    0x0, 0x0, 0xe, 0x3c, 0x0, 0x0, 0x3, 0x87,
-    0xc0, 0x0, 0x0, 0xe0, 0xbc, 0x0, 0x0, 0x38,
-    0xb, 0xe0, 0x0, 0x7e, 0x0, 0x7f, 0xff, 0xfd,
-    0x0, 0x1, 0xbf, 0xe4, 0x0,
-
-    /* U+48 "H" */
-    0x3c, 0x0, 0x0, 0xb, 0xf, 0x0, 0x0, 0x2,
-    0xc3, 0xc0, 0x0, 0x0, 0xb0, 0xf0, 0x0, 0x0,
-    0x2c, 0x3c, 0x0, 0x0, 0xb, 0xf, 0x0, 0x0,
-    0x2, 0xc3, 0xc0, 0x0, 0x0, 0xb0, 0xf0, 0x0,
-    0x0, 0x2c, 0x3f, 0xff, 0xff, 0xff, 0xf, 0xaa,
-    0xaa, 0xab, 0xc3, 0xc0, 0x0, 0x0, 0xb0, 0xf0,
-    0x0, 0x0, 0x2c, 0x3c, 0x0, 0x0, 0xb, 0xf,
-    0x0, 0x0, 0x2, 0xc3, 0xc0, 0x0, 0x0, 0xb0,
-    0xf0, 0x0, 0x0, 0x2c, 0x3c, 0x0, 0x0, 0xb,
-    0xf, 0x0, 0x0, 0x2, 0xc0,
-
-    /* U+49 "I" */
-    0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3,
-    0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf0,
-
-    /* U+4A "J" */
-    0x7, 0xff, 0xfc, 0x2, 0xaa, 0xbc, 0x0, 0x0,
-    0x2c, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x2c, 0x0,
-    0x0, 0x2c, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0x2c, 0x0, 0x0, 0x2c, 0x0, 0x0,
-    0x2c, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x2c, 0x0,
-    0x0, 0x3c, 0x14, 0x0, 0x3c, 0x3d, 0x0, 0xb8,
-    0xf, 0xef, 0xf0, 0x2, 0xff, 0x80,
-
-    /* U+4B "K" */
-    0x3c, 0x0, 0x0, 0x3d, 0xf, 0x0, 0x0, 0x3d,
-    0x3, 0xc0, 0x0, 0x3d, 0x0, 0xf0, 0x0, 0x3d,
-    0x0, 0x3c, 0x0, 0x3d, 0x0, 0xf, 0x0, 0x3d,
-    0x0, 0x3, 0xc0, 0x3e, 0x0, 0x0, 0xf0, 0x3e,
-    0x0, 0x0, 0x3c, 0x2f, 0x0, 0x0, 0xf, 0x2e,
-    0xf0, 0x0, 0x3, 0xee, 0x1f, 0x0, 0x0, 0xfe,
-    0x2, 0xe0, 0x0, 0x3e, 0x0, 0x2e, 0x0, 0xf,
-    0x0, 0x3, 0xd0, 0x3, 0xc0, 0x0, 0x3d, 0x0,
-    0xf0, 0x0, 0x3, 0xc0, 0x3c, 0x0, 0x0, 0x7c,
-    0xf, 0x0, 0x0, 0x7, 0xc0,
-
-    /* U+4C "L" */
-    0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x3e, 0xaa, 0xaa, 0x83, 0xff, 0xff, 0xfc,
-
-    /* U+4D "M" */
-    0x3c, 0x0, 0x0, 0x0, 0xf, 0x3d, 0x0, 0x0,
-    0x0, 0x2f, 0x3f, 0x0, 0x0, 0x0, 0x3f, 0x3f,
-    0x80, 0x0, 0x0, 0xff, 0x3e, 0xc0, 0x0, 0x1,
-    0xdf, 0x3c, 0xf0, 0x0, 0x3, 0xcf, 0x3c, 0xb4,
-    0x0, 0xb, 0x4f, 0x3c, 0x3c, 0x0, 0xe, 0xf,
-    0x3c, 0x1e, 0x0, 0x2c, 0xf, 0x3c, 0xb, 0x0,
-    0x78, 0xf, 0x3c, 0x3, 0xc0, 0xf0, 0xf, 0x3c,
-    0x2, 0xd1, 0xd0, 0xf, 0x3c, 0x0, 0xf3, 0xc0,
-    0xf, 0x3c, 0x0, 0x7f, 0x0, 0xf, 0x3c, 0x0,
-    0x3e, 0x0, 0xf, 0x3c, 0x0, 0x8, 0x0, 0xf,
-    0x3c, 0x0, 0x0, 0x0, 0xf, 0x3c, 0x0, 0x0,
-    0x0, 0xf,
-
-    /* U+4E "N" */
-    0x3c, 0x0, 0x0, 0xb, 0xf, 0x80, 0x0, 0x2,
-    0xc3, 0xf8, 0x0, 0x0, 0xb0, 0xff, 0x40, 0x0,
-    0x2c, 0x3c, 0xf0, 0x0, 0xb, 0xf, 0x1f, 0x0,
-    0x2, 0xc3, 0xc2, 0xe0, 0x0, 0xb0, 0xf0, 0x3e,
-    0x0, 0x2c, 0x3c, 0x3, 0xd0, 0xb, 0xf, 0x0,
-    0x3c, 0x2, 0xc3, 0xc0, 0x7, 0xc0, 0xb0, 0xf0,
-    0x0, 0xbc, 0x2c, 0x3c, 0x0, 0xf, 0x8b, 0xf,
-    0x0, 0x0, 0xf6, 0xc3, 0xc0, 0x0, 0xf, 0xf0,
-    0xf0, 0x0, 0x1, 0xfc, 0x3c, 0x0, 0x0, 0x2f,
-    0xf, 0x0, 0x0, 0x3, 0xc0,
-
-    /* U+4F "O" */
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x0, 0x7f, 0xff,
-    0xfd, 0x0, 0x2, 0xf4, 0x0, 0x2f, 0x80, 0xb,
-    0xc0, 0x0, 0x3, 0xe0, 0x1f, 0x0, 0x0, 0x0,
-    0xf4, 0x3c, 0x0, 0x0, 0x0, 0x7c, 0x78, 0x0,
-    0x0, 0x0, 0x3c, 0xb4, 0x0, 0x0, 0x0, 0x2d,
-    0xb4, 0x0, 0x0, 0x0, 0x2d, 0xb4, 0x0, 0x0,
-    0x0, 0x2d, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0x78,
-    0x0, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0, 0x0,
-    0x7c, 0x1f, 0x0, 0x0, 0x0, 0xf4, 0xb, 0xc0,
-    0x0, 0x3, 0xe0, 0x2, 0xf4, 0x0, 0x2f, 0x80,
-    0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0, 0x6, 0xff,
-    0x90, 0x0,
-
-    /* U+50 "P" */
-    0x3f, 0xff, 0xf9, 0x0, 0x3e, 0xaa, 0xbf, 0xc0,
-    0x3c, 0x0, 0x2, 0xf0, 0x3c, 0x0, 0x0, 0xb8,
-    0x3c, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0, 0x3c,
-    0x3c, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0, 0x3c,
-    0x3c, 0x0, 0x0, 0xb8, 0x3c, 0x0, 0x2, 0xf0,
-    0x3e, 0xaa, 0xbf, 0xc0, 0x3f, 0xff, 0xf9, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-
-    /* U+51 "Q" */
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x40, 0x0, 0x2f, 0x80, 0x2, 0xf8, 0x0,
-    0x2f, 0x0, 0x0, 0xf, 0x40, 0x1f, 0x0, 0x0,
-    0x0, 0xf4, 0xf, 0x0, 0x0, 0x0, 0x1f, 0x7,
-    0x80, 0x0, 0x0, 0x3, 0xc2, 0xd0, 0x0, 0x0,
-    0x0, 0xb4, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0x2d,
-    0x0, 0x0, 0x0, 0xb, 0x4b, 0x40, 0x0, 0x0,
-    0x2, 0xd1, 0xe0, 0x0, 0x0, 0x0, 0xf0, 0x3c,
-    0x0, 0x0, 0x0, 0x78, 0x7, 0xc0, 0x0, 0x0,
-    0x3d, 0x0, 0xbc, 0x0, 0x0, 0x3e, 0x0, 0xf,
-    0xd0, 0x0, 0xbe, 0x0, 0x0, 0xbf, 0xff, 0xfd,
-    0x0, 0x0, 0x2, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x10, 0x0, 0x0, 0xf, 0xd0,
-    0x7c, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0,
-    0x0, 0x1, 0xa4, 0x0,
-
-    /* U+52 "R" */
-    0x3f, 0xff, 0xf9, 0x0, 0x3e, 0xaa, 0xbf, 0xc0,
-    0x3c, 0x0, 0x2, 0xf0, 0x3c, 0x0, 0x0, 0xb8,
-    0x3c, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0, 0x3c,
-    0x3c, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0, 0x3c,
-    0x3c, 0x0, 0x0, 0xb8, 0x3c, 0x0, 0x2, 0xf0,
-    0x3e, 0xaa, 0xbf, 0xc0, 0x3f, 0xff, 0xfd, 0x0,
-    0x3c, 0x0, 0x1e, 0x0, 0x3c, 0x0, 0xb, 0x40,
-    0x3c, 0x0, 0x3, 0xc0, 0x3c, 0x0, 0x1, 0xf0,
-    0x3c, 0x0, 0x0, 0xb4, 0x3c, 0x0, 0x0, 0x3c,
-
-    /* U+53 "S" */
-    0x1, 0xbf, 0xf8, 0x0, 0xbf, 0xab, 0xf8, 0x2f,
-    0x0, 0x2, 0x83, 0xc0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3d, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x3, 0xfe, 0x40, 0x0,
-    0x1, 0xbf, 0xd0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x3d, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0xe, 0x10, 0x0, 0x1, 0xeb, 0xd0, 0x0, 0x7c,
-    0x2f, 0xfa, 0xff, 0x0, 0x1b, 0xfe, 0x40,
-
-    /* U+54 "T" */
-    0xff, 0xff, 0xff, 0xfe, 0xaa, 0xbf, 0xaa, 0xa0,
-    0x0, 0xb4, 0x0, 0x0, 0x2, 0xd0, 0x0, 0x0,
-    0xb, 0x40, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x0,
-    0xb4, 0x0, 0x0, 0x2, 0xd0, 0x0, 0x0, 0xb,
-    0x40, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0xb4,
-    0x0, 0x0, 0x2, 0xd0, 0x0, 0x0, 0xb, 0x40,
-    0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0xb4, 0x0,
-    0x0, 0x2, 0xd0, 0x0, 0x0, 0xb, 0x40, 0x0,
-    0x0, 0x2d, 0x0, 0x0,
-
-    /* U+55 "U" */
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x3c, 0x0, 0x0, 0xe, 0x3c, 0x0, 0x0, 0xe,
-    0x3c, 0x0, 0x0, 0x1e, 0x2d, 0x0, 0x0, 0x3d,
-    0x1f, 0x0, 0x0, 0x7c, 0xb, 0xd0, 0x2, 0xf0,
-    0x2, 0xff, 0xff, 0xd0, 0x0, 0x2f, 0xf9, 0x0,
-
-    /* U+56 "V" */
-    0xb4, 0x0, 0x0, 0x0, 0xf1, 0xf0, 0x0, 0x0,
-    0xb, 0x43, 0xd0, 0x0, 0x0, 0x3c, 0x7, 0x80,
-    0x0, 0x1, 0xe0, 0xf, 0x0, 0x0, 0xf, 0x0,
-    0x1e, 0x0, 0x0, 0x78, 0x0, 0x3c, 0x0, 0x3,
-    0xc0, 0x0, 0xb4, 0x0, 0xe, 0x0, 0x0, 0xf0,
-    0x0, 0xb4, 0x0, 0x2, 0xd0, 0x3, 0xc0, 0x0,
-    0x3, 0xc0, 0x2d, 0x0, 0x0, 0xf, 0x40, 0xf0,
-    0x0, 0x0, 0x1e, 0x7, 0x40, 0x0, 0x0, 0x3c,
-    0x3c, 0x0, 0x0, 0x0, 0x79, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xd0, 0x0, 0x0,
-
-    /* U+57 "W" */
-    0x3c, 0x0, 0x0, 0x2e, 0x0, 0x0, 0xf, 0x2d,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x1d, 0xf, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x2c, 0xf, 0x0, 0x0,
-    0xb7, 0x80, 0x0, 0x3c, 0xb, 0x40, 0x0, 0xf3,
-    0xc0, 0x0, 0x74, 0x3, 0xc0, 0x1, 0xd2, 0xd0,
-    0x0, 0xf0, 0x3, 0xc0, 0x2, 0xc0, 0xe0, 0x0,
-    0xe0, 0x1, 0xd0, 0x3, 0xc0, 0xf0, 0x1, 0xd0,
-    0x0, 0xf0, 0x7, 0x40, 0xb4, 0x3, 0xc0, 0x0,
-    0xf0, 0xb, 0x0, 0x38, 0x3, 0x80, 0x0, 0x74,
-    0xe, 0x0, 0x3c, 0x7, 0x40, 0x0, 0x3c, 0x1d,
-    0x0, 0x1d, 0xf, 0x0, 0x0, 0x3c, 0x3c, 0x0,
-    0xe, 0xe, 0x0, 0x0, 0x1e, 0x38, 0x0, 0xf,
-    0x2d, 0x0, 0x0, 0xf, 0x74, 0x0, 0x7, 0x7c,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x7, 0xe0, 0x0, 0x2, 0xf4, 0x0, 0x0,
-    0x3, 0xd0, 0x0, 0x1, 0xf0, 0x0,
-
-    /* U+58 "X" */
-    0x2d, 0x0, 0x0, 0x1e, 0x3, 0xc0, 0x0, 0xf,
-    0x0, 0x7c, 0x0, 0xf, 0x40, 0xb, 0x80, 0xb,
-    0x80, 0x0, 0xf4, 0x7, 0xc0, 0x0, 0xf, 0x3,
-    0xc0, 0x0, 0x1, 0xf3, 0xd0, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xf7, 0xc0, 0x0, 0x0,
-    0xb4, 0x7c, 0x0, 0x0, 0x78, 0xb, 0x80, 0x0,
-    0x3c, 0x0, 0xf4, 0x0, 0x3c, 0x0, 0xf, 0x0,
-    0x2d, 0x0, 0x1, 0xe0, 0x1e, 0x0, 0x0, 0x2d,
-    0xf, 0x0, 0x0, 0x3, 0xc0,
-
-    /* U+59 "Y" */
-    0xb4, 0x0, 0x0, 0xb, 0xf, 0x0, 0x0, 0x7,
-    0x81, 0xe0, 0x0, 0x3, 0xc0, 0x3c, 0x0, 0x2,
-    0xd0, 0x3, 0xc0, 0x0, 0xe0, 0x0, 0xb4, 0x0,
-    0xf0, 0x0, 0xf, 0x0, 0x74, 0x0, 0x1, 0xe0,
-    0x3c, 0x0, 0x0, 0x2d, 0x2c, 0x0, 0x0, 0x3,
-    0xde, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0,
-    0x0, 0xb0, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0x2, 0xc0, 0x0,
-    0x0, 0x0, 0xb0, 0x0, 0x0,
-
-    /* U+5A "Z" */
-    0xbf, 0xff, 0xff, 0xfc, 0x6a, 0xaa, 0xaa, 0xf8,
-    0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x3d, 0x0,
-    0x0, 0x0, 0xb8, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x3d, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x0,
-    0xbe, 0xaa, 0xaa, 0xa8, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+5B "[" */
-    0x3f, 0xe3, 0xe9, 0x3c, 0x3, 0xc0, 0x3c, 0x3,
-    0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-    0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0,
-    0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3,
-    0xc0, 0x3c, 0x3, 0xe9, 0x3f, 0xe0,
-
-    /* U+5C "\\" */
-    0xb0, 0x0, 0x1, 0xd0, 0x0, 0x3, 0x80, 0x0,
-    0xb, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0xb0, 0x0, 0x1, 0xd0, 0x0, 0x3, 0x80,
-    0x0, 0xb, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0xb0, 0x0, 0x1, 0xd0, 0x0, 0x3,
-    0xc0, 0x0, 0xb, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xd0, 0x0,
-    0x3, 0xc0, 0x0, 0xb, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0xb0,
-
-    /* U+5D "]" */
-    0x7f, 0xd2, 0xbd, 0x2, 0xd0, 0x2d, 0x2, 0xd0,
-    0x2d, 0x2, 0xd0, 0x2d, 0x2, 0xd0, 0x2d, 0x2,
-    0xd0, 0x2d, 0x2, 0xd0, 0x2d, 0x2, 0xd0, 0x2d,
-    0x2, 0xd0, 0x2d, 0x2, 0xd0, 0x2d, 0x2, 0xd0,
-    0x2d, 0x2, 0xd6, 0xbd, 0x7f, 0xd0,
-
-    /* U+5E "^" */
-    0x0, 0xb8, 0x0, 0x3, 0xf0, 0x0, 0x1d, 0xd0,
-    0x0, 0xa3, 0x80, 0x3, 0x47, 0x0, 0x2c, 0xe,
-    0x0, 0xe0, 0x2c, 0x7, 0x0, 0x34, 0x38, 0x0,
-    0xb0, 0xd0, 0x1, 0xcb, 0x0, 0x3, 0x80,
-
-    /* U+5F "_" */
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0,
-
-    /* U+60 "`" */
-    0x14, 0x0, 0x7c, 0x0, 0x3c, 0x0, 0x3c,
-
-    /* U+61 "a" */
-    0x2, 0xff, 0x90, 0x2f, 0xeb, 0xf8, 0x38, 0x0,
-    0x3d, 0x0, 0x0, 0x1e, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0xf, 0x7, 0xff, 0xff, 0x2f, 0x55, 0x5f,
-    0x78, 0x0, 0xf, 0xb4, 0x0, 0xf, 0xb4, 0x0,
-    0x1f, 0x3c, 0x0, 0x7f, 0x2f, 0x96, 0xef, 0x6,
-    0xfe, 0x4f,
-
-    /* U+62 "b" */
-    0x74, 0x0, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x7,
-    0x40, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x74,
-    0x0, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x7, 0x42,
-    0xfe, 0x40, 0x1d, 0x7f, 0xbf, 0xc0, 0x7f, 0x80,
-    0xb, 0xc1, 0xf8, 0x0, 0xb, 0x87, 0xc0, 0x0,
-    0xf, 0x1e, 0x0, 0x0, 0x2d, 0x74, 0x0, 0x0,
-    0x75, 0xd0, 0x0, 0x1, 0xd7, 0x80, 0x0, 0xb,
-    0x5f, 0x0, 0x0, 0x3c, 0x7e, 0x0, 0x2, 0xe1,
-    0xee, 0x0, 0x2f, 0x7, 0x5f, 0xef, 0xf0, 0x1d,
-    0xb, 0xf9, 0x0,
-
-    /* U+63 "c" */
-    0x0, 0x7f, 0xe0, 0x1, 0xfe, 0xbf, 0x80, 0xf4,
-    0x0, 0xf4, 0xf4, 0x0, 0x4, 0x78, 0x0, 0x0,
-    0x2d, 0x0, 0x0, 0xb, 0x0, 0x0, 0x2, 0xc0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x10, 0x3d, 0x0, 0x3d, 0x7,
-    0xfa, 0xfe, 0x0, 0x1f, 0xf8, 0x0,
-
-    /* U+64 "d" */
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0xb,
-    0xfd, 0xf, 0x1, 0xfe, 0xbf, 0x3c, 0x1f, 0x40,
-    0xf, 0xf0, 0xf4, 0x0, 0xf, 0xc7, 0x80, 0x0,
-    0x1f, 0x2d, 0x0, 0x0, 0x3c, 0xb0, 0x0, 0x0,
-    0xf2, 0xc0, 0x0, 0x3, 0xcb, 0x0, 0x0, 0xf,
-    0x1e, 0x0, 0x0, 0x7c, 0x3c, 0x0, 0x3, 0xf0,
-    0x7d, 0x0, 0x3f, 0xc0, 0x7f, 0xab, 0xcb, 0x0,
-    0x2f, 0xf8, 0x2c,
-
-    /* U+65 "e" */
-    0x0, 0xbf, 0xd0, 0x0, 0x7f, 0xaf, 0xc0, 0x1f,
-    0x0, 0x1f, 0x3, 0xc0, 0x0, 0x38, 0x74, 0x0,
-    0x2, 0xcb, 0x0, 0x0, 0x1d, 0xbf, 0xff, 0xff,
-    0xdb, 0x55, 0x55, 0x54, 0xb4, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x3d, 0x0, 0x1, 0x0, 0xf4,
-    0x0, 0xb4, 0x7, 0xfa, 0xfe, 0x0, 0x7, 0xfe,
-    0x40,
-
-    /* U+66 "f" */
-    0x0, 0x7f, 0x80, 0x1f, 0xad, 0x3, 0xc0, 0x0,
-    0x3c, 0x0, 0x3, 0x80, 0x0, 0x38, 0x0, 0xbf,
-    0xff, 0xc6, 0xbe, 0xa8, 0x3, 0x80, 0x0, 0x38,
-    0x0, 0x3, 0x80, 0x0, 0x38, 0x0, 0x3, 0x80,
-    0x0, 0x38, 0x0, 0x3, 0x80, 0x0, 0x38, 0x0,
-    0x3, 0x80, 0x0, 0x38, 0x0, 0x3, 0x80, 0x0,
-    0x38, 0x0,
-
-    /* U+67 "g" */
-    0x0, 0xbf, 0xe0, 0xb0, 0x1f, 0xeb, 0xf6, 0xc1,
-    0xf4, 0x0, 0xbf, 0xf, 0x0, 0x0, 0xbc, 0x74,
-    0x0, 0x0, 0xf2, 0xc0, 0x0, 0x2, 0xcf, 0x0,
-    0x0, 0xb, 0x2c, 0x0, 0x0, 0x2c, 0x78, 0x0,
-    0x0, 0xf0, 0xf0, 0x0, 0xb, 0xc1, 0xf4, 0x0,
-    0xbf, 0x1, 0xfe, 0xbf, 0x6c, 0x0, 0xbf, 0xe0,
-    0xb0, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0xf,
-    0x1, 0x0, 0x0, 0x78, 0x2e, 0x0, 0x7, 0xc0,
-    0x3f, 0xea, 0xfd, 0x0, 0x1b, 0xff, 0x80, 0x0,
-
-    /* U+68 "h" */
-    0x74, 0x0, 0x0, 0x7, 0x40, 0x0, 0x0, 0x74,
-    0x0, 0x0, 0x7, 0x40, 0x0, 0x0, 0x74, 0x0,
-    0x0, 0x7, 0x40, 0x0, 0x0, 0x74, 0x6f, 0xe4,
-    0x7, 0x6f, 0xaf, 0xe0, 0x7f, 0x40, 0x1f, 0x47,
-    0xd0, 0x0, 0x7c, 0x7c, 0x0, 0x3, 0xc7, 0x80,
-    0x0, 0x2c, 0x74, 0x0, 0x2, 0xc7, 0x40, 0x0,
-    0x2c, 0x74, 0x0, 0x2, 0xc7, 0x40, 0x0, 0x2c,
-    0x74, 0x0, 0x2, 0xc7, 0x40, 0x0, 0x2c, 0x74,
-    0x0, 0x2, 0xc7, 0x40, 0x0, 0x2c,
-
-    /* U+69 "i" */
-    0x77, 0xf2, 0x0, 0x0, 0x7, 0x5d, 0x75, 0xd7,
-    0x5d, 0x75, 0xd7, 0x5d, 0x75, 0xd7, 0x5d,
-
-    /* U+6A "j" */
-    0x0, 0x1e, 0x0, 0x2f, 0x0, 0x9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x0, 0x1e,
-    0x0, 0x1e, 0x0, 0x1e, 0x0, 0x1e, 0x0, 0x1e,
-    0x0, 0x1e, 0x0, 0x1e, 0x0, 0x1e, 0x0, 0x1e,
-    0x0, 0x1e, 0x0, 0x1e, 0x0, 0x1e, 0x0, 0x1e,
-    0x0, 0x1e, 0x0, 0x1d, 0x0, 0x3d, 0x3e, 0xfc,
-    0x2f, 0xe0,
-
-    /* U+6B "k" */
-    0x74, 0x0, 0x0, 0x7, 0x40, 0x0, 0x0, 0x74,
-    0x0, 0x0, 0x7, 0x40, 0x0, 0x0, 0x74, 0x0,
-    0x0, 0x7, 0x40, 0x0, 0x0, 0x74, 0x0, 0xf,
-    0x47, 0x40, 0x3, 0xd0, 0x74, 0x0, 0xf4, 0x7,
-    0x40, 0x3d, 0x0, 0x74, 0x1f, 0x40, 0x7, 0x47,
-    0xd0, 0x0, 0x75, 0xfe, 0x0, 0x7, 0xfd, 0xf4,
-    0x0, 0x7f, 0x3, 0xc0, 0x7, 0xc0, 0x1f, 0x0,
-    0x74, 0x0, 0xb8, 0x7, 0x40, 0x3, 0xd0, 0x74,
-    0x0, 0xf, 0x47, 0x40, 0x0, 0x7c,
-
-    /* U+6C "l" */
-    0x75, 0xd7, 0x5d, 0x75, 0xd7, 0x5d, 0x75, 0xd7,
-    0x5d, 0x75, 0xd7, 0x5d, 0x75, 0xd7, 0x5d,
-
-    /* U+6D "m" */
-    0x74, 0x6f, 0xe0, 0x6, 0xfe, 0x40, 0x76, 0xfa,
-    0xfd, 0x2f, 0xab, 0xe0, 0x7f, 0x40, 0x1f, 0xb8,
-    0x0, 0xf4, 0x7d, 0x0, 0xb, 0xe0, 0x0, 0x7c,
-    0x7c, 0x0, 0x3, 0xc0, 0x0, 0x3c, 0x78, 0x0,
-    0x3, 0xc0, 0x0, 0x2c, 0x74, 0x0, 0x3, 0xc0,
-    0x0, 0x2c, 0x74, 0x0, 0x3, 0xc0, 0x0, 0x2c,
-    0x74, 0x0, 0x3, 0xc0, 0x0, 0x2c, 0x74, 0x0,
-    0x3, 0xc0, 0x0, 0x2c, 0x74, 0x0, 0x3, 0xc0,
-    0x0, 0x2c, 0x74, 0x0, 0x3, 0xc0, 0x0, 0x2c,
-    0x74, 0x0, 0x3, 0xc0, 0x0, 0x2c, 0x74, 0x0,
-    0x3, 0xc0, 0x0, 0x2c,
-
-    /* U+6E "n" */
-    0x74, 0x6f, 0xe4, 0x7, 0x6f, 0xab, 0xe0, 0x7f,
-    0x40, 0xf, 0x47, 0xd0, 0x0, 0x7c, 0x7c, 0x0,
-    0x3, 0xc7, 0x80, 0x0, 0x2c, 0x74, 0x0, 0x2,
-    0xc7, 0x40, 0x0, 0x2c, 0x74, 0x0, 0x2, 0xc7,
-    0x40, 0x0, 0x2c, 0x74, 0x0, 0x2, 0xc7, 0x40,
-    0x0, 0x2c, 0x74, 0x0, 0x2, 0xc7, 0x40, 0x0,
-    0x2c,
-
-    /* U+6F "o" */
-    0x0, 0x7f, 0xe0, 0x0, 0x1f, 0xeb, 0xf8, 0x0,
-    0xf4, 0x0, 0xf8, 0xf, 0x0, 0x0, 0xf0, 0x78,
-    0x0, 0x1, 0xe2, 0xd0, 0x0, 0x3, 0xcb, 0x0,
-    0x0, 0xf, 0x2c, 0x0, 0x0, 0x3c, 0xb4, 0x0,
-    0x0, 0xf1, 0xe0, 0x0, 0x7, 0x83, 0xc0, 0x0,
-    0x3c, 0x3, 0xd0, 0x3, 0xe0, 0x7, 0xfa, 0xfe,
-    0x0, 0x1, 0xff, 0x80, 0x0,
-
-    /* U+70 "p" */
-    0x74, 0x2f, 0xe4, 0x1, 0xdb, 0xea, 0xfc, 0x7,
-    0xf8, 0x0, 0xbc, 0x1f, 0x80, 0x0, 0xb8, 0x7c,
-    0x0, 0x0, 0xf1, 0xe0, 0x0, 0x2, 0xd7, 0x40,
-    0x0, 0x7, 0x5d, 0x0, 0x0, 0x1d, 0x78, 0x0,
-    0x0, 0xb5, 0xf0, 0x0, 0x3, 0xc7, 0xe0, 0x0,
-    0x2e, 0x1f, 0xe0, 0x2, 0xf0, 0x75, 0xfe, 0xff,
-    0x1, 0xd0, 0xbf, 0x90, 0x7, 0x40, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x1,
-    0xd0, 0x0, 0x0, 0x7, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+71 "q" */
-    0x0, 0xbf, 0xd0, 0xb0, 0x1f, 0xeb, 0xf2, 0xc1,
-    0xf4, 0x0, 0xff, 0xf, 0x40, 0x0, 0xfc, 0x78,
-    0x0, 0x1, 0xf2, 0xd0, 0x0, 0x3, 0xcb, 0x0,
-    0x0, 0xf, 0x2c, 0x0, 0x0, 0x3c, 0xb4, 0x0,
-    0x0, 0xf1, 0xe0, 0x0, 0x7, 0xc3, 0xc0, 0x0,
-    0x3f, 0x7, 0xd0, 0x3, 0xfc, 0x7, 0xfa, 0xfc,
-    0xf0, 0x2, 0xff, 0x43, 0xc0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf, 0x0,
-
-    /* U+72 "r" */
-    0x74, 0x6d, 0x76, 0xfd, 0x7f, 0x40, 0x7d, 0x0,
-    0x7c, 0x0, 0x78, 0x0, 0x74, 0x0, 0x74, 0x0,
-    0x74, 0x0, 0x74, 0x0, 0x74, 0x0, 0x74, 0x0,
-    0x74, 0x0, 0x74, 0x0,
-
-    /* U+73 "s" */
-    0x1, 0xff, 0xe0, 0xf, 0xea, 0xfc, 0x2e, 0x0,
-    0x8, 0x3c, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x1f,
-    0x40, 0x0, 0xb, 0xfe, 0x40, 0x0, 0x6f, 0xf8,
-    0x0, 0x0, 0x7d, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0xf, 0x38, 0x0, 0x2e, 0x3f, 0xea, 0xfc, 0x6,
-    0xff, 0x90,
-
-    /* U+74 "t" */
-    0x3, 0x80, 0x0, 0x38, 0x0, 0x3, 0x80, 0xb,
-    0xff, 0xfc, 0x6b, 0xea, 0x80, 0x38, 0x0, 0x3,
-    0x80, 0x0, 0x38, 0x0, 0x3, 0x80, 0x0, 0x38,
-    0x0, 0x3, 0x80, 0x0, 0x38, 0x0, 0x3, 0x80,
-    0x0, 0x3c, 0x0, 0x3, 0xc0, 0x0, 0x1f, 0xae,
-    0x0, 0x7f, 0x80,
-
-    /* U+75 "u" */
-    0xb4, 0x0, 0x3, 0xed, 0x0, 0x0, 0xfb, 0x40,
-    0x0, 0x3e, 0xd0, 0x0, 0xf, 0xb4, 0x0, 0x3,
-    0xed, 0x0, 0x0, 0xfb, 0x40, 0x0, 0x3e, 0xd0,
-    0x0, 0xf, 0xb4, 0x0, 0x3, 0xdd, 0x0, 0x1,
-    0xf3, 0xc0, 0x0, 0xfc, 0xb8, 0x0, 0xbf, 0xf,
-    0xea, 0xf7, 0xc0, 0x7f, 0xe0, 0xf0,
-
-    /* U+76 "v" */
-    0xf0, 0x0, 0x0, 0xf1, 0xe0, 0x0, 0x7, 0x43,
-    0xc0, 0x0, 0x3c, 0x7, 0x40, 0x1, 0xe0, 0xf,
-    0x0, 0xb, 0x0, 0x2d, 0x0, 0x38, 0x0, 0x38,
-    0x2, 0xc0, 0x0, 0xb0, 0xf, 0x0, 0x1, 0xe0,
-    0x74, 0x0, 0x3, 0xc3, 0xc0, 0x0, 0x7, 0x5e,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x3c, 0x0, 0x0,
-
-    /* U+77 "w" */
-    0xb0, 0x0, 0xb, 0x40, 0x0, 0x34, 0xe0, 0x0,
-    0x3f, 0x0, 0x2, 0xc3, 0xc0, 0x1, 0xfc, 0x0,
-    0xe, 0xb, 0x0, 0xb, 0x78, 0x0, 0x74, 0xe,
-    0x0, 0x38, 0xf0, 0x2, 0xc0, 0x3c, 0x1, 0xd1,
-    0xd0, 0xe, 0x0, 0x74, 0xb, 0x3, 0x80, 0x70,
-    0x0, 0xe0, 0x38, 0xb, 0x3, 0xc0, 0x2, 0xc1,
-    0xc0, 0x1d, 0xd, 0x0, 0x7, 0x4f, 0x0, 0x38,
-    0xb0, 0x0, 0xf, 0x34, 0x0, 0xb3, 0xc0, 0x0,
-    0x2e, 0xc0, 0x0, 0xed, 0x0, 0x0, 0x3e, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0xf4, 0x0, 0x7, 0x80,
-    0x0,
-
-    /* U+78 "x" */
-    0x3c, 0x0, 0x7, 0x80, 0xf0, 0x0, 0xf0, 0x7,
-    0x80, 0x3c, 0x0, 0x2d, 0xb, 0x40, 0x0, 0xf1,
-    0xe0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x2, 0xf4, 0x0, 0x0, 0x7b, 0xc0, 0x0,
-    0xf, 0xf, 0x0, 0x3, 0xc0, 0x78, 0x0, 0xb4,
-    0x2, 0xd0, 0x1e, 0x0, 0xf, 0x43, 0xc0, 0x0,
-    0x3c,
-
-    /* U+79 "y" */
-    0x2c, 0x0, 0x0, 0x3c, 0x1e, 0x0, 0x0, 0x74,
-    0xf, 0x0, 0x0, 0xf0, 0x7, 0x40, 0x1, 0xe0,
-    0x3, 0xc0, 0x2, 0xc0, 0x2, 0xd0, 0x3, 0x80,
-    0x0, 0xf0, 0xb, 0x0, 0x0, 0xb0, 0xe, 0x0,
-    0x0, 0x38, 0x1d, 0x0, 0x0, 0x3c, 0x3c, 0x0,
-    0x0, 0x1e, 0x74, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x10, 0x1e, 0x0, 0x0, 0x7e, 0xfc, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0,
-
-    /* U+7A "z" */
-    0xff, 0xff, 0xfc, 0x6a, 0xaa, 0xfc, 0x0, 0x0,
-    0xf0, 0x0, 0x3, 0xd0, 0x0, 0xb, 0x80, 0x0,
-    0x1f, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf4, 0x0,
-    0x2, 0xd0, 0x0, 0x7, 0x80, 0x0, 0xf, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0xbe, 0xaa, 0xa8, 0xff,
-    0xff, 0xfc,
-
-    /* U+7B "{" */
-    0x0, 0xbc, 0x3, 0xf8, 0x3, 0x80, 0x7, 0x40,
-    0x7, 0x40, 0x7, 0x40, 0x7, 0x40, 0x7, 0x40,
-    0x7, 0x40, 0x7, 0x40, 0x7, 0x40, 0xb, 0x40,
-    0x7e, 0x0, 0x6f, 0x0, 0x7, 0x40, 0x7, 0x40,
-    0x7, 0x40, 0x7, 0x40, 0x7, 0x40, 0x7, 0x40,
-    0x7, 0x40, 0x7, 0x40, 0x7, 0x80, 0x3, 0xf8,
-    0x0, 0xbc,
-
-    /* U+7C "|" */
-    0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3,
-    0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38,
-    0xe3, 0x8e, 0x38,
-
-    /* U+7D "}" */
-    0x7e, 0x0, 0x2f, 0x80, 0x3, 0xc0, 0x3, 0xc0,
-    0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0,
-    0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0, 0x2, 0xd0,
-    0x0, 0xfc, 0x1, 0xf8, 0x2, 0xc0, 0x3, 0xc0,
-    0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0,
-    0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0, 0x6f, 0x80,
-    0x7e, 0x0,
-
-    /* U+7E "~" */
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0xd2, 0xd7,
-    0xc0, 0x30, 0xd0, 0x3c, 0x38, 0x70, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+A9 "©" */
-    0x0, 0x6, 0xff, 0x80, 0x0, 0x1, 0xe0, 0x2,
-    0xe0, 0x0, 0x2c, 0x0, 0x0, 0xa0, 0x2, 0x80,
-    0x0, 0x0, 0xa0, 0x1c, 0x2, 0xff, 0x40, 0xd0,
-    0xd0, 0x3d, 0x5f, 0x40, 0xc3, 0x3, 0xc0, 0x9,
-    0x3, 0x58, 0x1c, 0x0, 0x0, 0x6, 0x90, 0xb0,
-    0x0, 0x0, 0x1a, 0x42, 0xc0, 0x0, 0x0, 0x69,
-    0xb, 0x0, 0x0, 0x1, 0x98, 0x1c, 0x0, 0x0,
-    0x9, 0x30, 0x38, 0x0, 0x40, 0x30, 0xd0, 0x7d,
-    0xb, 0x81, 0xc1, 0xc0, 0x3f, 0xf4, 0xd, 0x2,
-    0x80, 0x0, 0x0, 0xa0, 0x2, 0xc0, 0x0, 0xe,
-    0x0, 0x1, 0xe0, 0x2, 0xd0, 0x0, 0x0, 0x7f,
-    0xf4, 0x0, 0x0,
-
-    /* U+AA "ª" */
-    0x1f, 0xf4, 0x74, 0x2c, 0x0, 0xd, 0x0, 0xe,
-    0x2f, 0xfe, 0xe0, 0xe, 0xe0, 0x1e, 0x2f, 0xda,
-
-    /* U+AE "®" */
-    0x0, 0x6, 0xff, 0x80, 0x0, 0x1, 0xe0, 0x2,
-    0xe0, 0x0, 0x2c, 0x0, 0x0, 0xa0, 0x2, 0x80,
-    0x0, 0x0, 0xa0, 0x1c, 0xf, 0xff, 0x40, 0xd0,
-    0xd0, 0x34, 0x1b, 0x40, 0xc3, 0x0, 0xd0, 0x7,
-    0x3, 0x58, 0x3, 0x40, 0xc, 0x6, 0x90, 0xd,
-    0x0, 0x70, 0x1a, 0x40, 0x34, 0x7, 0x80, 0x69,
-    0x0, 0xff, 0xf8, 0x1, 0x98, 0x3, 0x41, 0xc0,
-    0x9, 0x30, 0xd, 0x2, 0xc0, 0x30, 0xd0, 0x34,
-    0x3, 0x41, 0xc1, 0xc0, 0xd0, 0x7, 0xd, 0x2,
-    0x80, 0x0, 0x0, 0xa0, 0x2, 0xc0, 0x0, 0xe,
-    0x0, 0x1, 0xe0, 0x2, 0xd0, 0x0, 0x0, 0x7f,
-    0xf4, 0x0, 0x0,
-
-    /* U+B1 "±" */
-    0x0, 0x1d, 0x0, 0x0, 0x7, 0x40, 0x0, 0x1,
-    0xd0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x1d, 0x0,
-    0xf, 0xff, 0xff, 0xc2, 0xaa, 0xea, 0xa0, 0x0,
-    0x74, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x7, 0x40,
-    0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaa, 0xaa,
-    0xa0, 0xff, 0xff, 0xfc,
-
-    /* U+B2 "²" */
-    0xb, 0xfe, 0x3, 0xd0, 0x7c, 0x0, 0x1, 0xc0,
-    0x0, 0x1c, 0x0, 0x3, 0x40, 0x1, 0xd0, 0x0,
-    0x74, 0x0, 0x2c, 0x0, 0xf, 0x0, 0x2, 0xff,
-    0xff,
-
-    /* U+BA "º" */
-    0x2, 0xfe, 0x0, 0xe4, 0x7c, 0x38, 0x0, 0xe3,
-    0x40, 0xb, 0x34, 0x0, 0xb3, 0x80, 0xe, 0x1e,
-    0x2, 0xc0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-
-    /* U+C0 "À" */
-    0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x3,
-    0xed, 0x0, 0x0, 0x0, 0xe, 0x3c, 0x0, 0x0,
-    0x0, 0xb0, 0xb4, 0x0, 0x0, 0x3, 0x80, 0xf0,
-    0x0, 0x0, 0x2c, 0x2, 0xd0, 0x0, 0x0, 0xe0,
-    0x3, 0x80, 0x0, 0xb, 0x40, 0xb, 0x0, 0x0,
-    0x3c, 0x0, 0xe, 0x0, 0x1, 0xd0, 0x0, 0x2c,
-    0x0, 0xf, 0xaa, 0xaa, 0xf8, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x3, 0xc0, 0x0, 0x1, 0xe0, 0x1e,
-    0x0, 0x0, 0x3, 0xc0, 0xf0, 0x0, 0x0, 0xb,
-    0x47, 0x80, 0x0, 0x0, 0xf, 0x2d, 0x0, 0x0,
-    0x0, 0x2d,
-
-    /* U+C1 "Á" */
-    0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x0, 0x3d,
-    0x0, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x3,
-    0xed, 0x0, 0x0, 0x0, 0xe, 0x3c, 0x0, 0x0,
-    0x0, 0xb0, 0xb4, 0x0, 0x0, 0x3, 0x80, 0xf0,
-    0x0, 0x0, 0x2c, 0x2, 0xd0, 0x0, 0x0, 0xe0,
-    0x3, 0x80, 0x0, 0xb, 0x40, 0xb, 0x0, 0x0,
-    0x3c, 0x0, 0xe, 0x0, 0x1, 0xd0, 0x0, 0x2c,
-    0x0, 0xf, 0xaa, 0xaa, 0xf8, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x3, 0xc0, 0x0, 0x1, 0xe0, 0x1e,
-    0x0, 0x0, 0x3, 0xc0, 0xf0, 0x0, 0x0, 0xb,
-    0x47, 0x80, 0x0, 0x0, 0xf, 0x2d, 0x0, 0x0,
-    0x0, 0x2d,
-
-    /* U+C2 "Â" */
-    0x0, 0x0, 0x64, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0xb4, 0xb0, 0x0, 0x0, 0x7,
-    0x40, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x3,
-    0xed, 0x0, 0x0, 0x0, 0xe, 0x3c, 0x0, 0x0,
-    0x0, 0xb0, 0xb4, 0x0, 0x0, 0x3, 0x80, 0xf0,
-    0x0, 0x0, 0x2c, 0x2, 0xd0, 0x0, 0x0, 0xe0,
-    0x3, 0x80, 0x0, 0xb, 0x40, 0xb, 0x0, 0x0,
-    0x3c, 0x0, 0xe, 0x0, 0x1, 0xd0, 0x0, 0x2c,
-    0x0, 0xf, 0xaa, 0xaa, 0xf8, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x3, 0xc0, 0x0, 0x1, 0xe0, 0x1e,
-    0x0, 0x0, 0x3, 0xc0, 0xf0, 0x0, 0x0, 0xb,
-    0x47, 0x80, 0x0, 0x0, 0xf, 0x2d, 0x0, 0x0,
-    0x0, 0x2d,
-
-    /* U+C3 "Ã" */
-    0x0, 0xb, 0x80, 0xd0, 0x0, 0x0, 0x76, 0xc3,
-    0x0, 0x0, 0x2, 0x41, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0xfb, 0x40, 0x0, 0x0, 0x3,
-    0x8f, 0x0, 0x0, 0x0, 0x2c, 0x2d, 0x0, 0x0,
-    0x0, 0xe0, 0x3c, 0x0, 0x0, 0xb, 0x0, 0xb4,
-    0x0, 0x0, 0x38, 0x0, 0xe0, 0x0, 0x2, 0xd0,
-    0x2, 0xc0, 0x0, 0xf, 0x0, 0x3, 0x80, 0x0,
-    0x74, 0x0, 0xb, 0x0, 0x3, 0xea, 0xaa, 0xbe,
-    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0xf0, 0x0,
-    0x0, 0x78, 0x7, 0x80, 0x0, 0x0, 0xf0, 0x3c,
-    0x0, 0x0, 0x2, 0xd1, 0xe0, 0x0, 0x0, 0x3,
-    0xcb, 0x40, 0x0, 0x0, 0xb, 0x40,
-
-    /* U+C7 "Ç" */
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x3f, 0x80, 0x2, 0xf4, 0x2f, 0x0, 0x0,
-    0x8, 0x1f, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x2, 0xd0, 0x0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x20,
-    0xf, 0xe0, 0x0, 0xbd, 0x0, 0x7f, 0xff, 0xfd,
-    0x0, 0x1, 0xbf, 0xe4, 0x0, 0x0, 0x7, 0x0,
-    0x0, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x10,
-    0xe0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+C9 "É" */
-    0x0, 0x0, 0x14, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xd3, 0xea, 0xaa, 0xa9, 0x3c, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x43, 0xea, 0xaa, 0xa0,
-    0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3e, 0xaa, 0xaa,
-    0xa3, 0xff, 0xff, 0xff,
-
-    /* U+CA "Ê" */
-    0x0, 0x6, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0xb4, 0xf0, 0x0, 0x2d, 0x2, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xd3, 0xea, 0xaa, 0xa9, 0x3c, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x43, 0xea, 0xaa, 0xa0,
-    0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3e, 0xaa, 0xaa,
-    0xa3, 0xff, 0xff, 0xff,
-
-    /* U+CD "Í" */
-    0x0, 0x90, 0x1f, 0x1, 0xf0, 0x1e, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0xf, 0x0, 0x3c, 0x0,
-    0xf0, 0x3, 0xc0, 0xf, 0x0, 0x3c, 0x0, 0xf0,
-    0x3, 0xc0, 0xf, 0x0, 0x3c, 0x0, 0xf0, 0x3,
-    0xc0, 0xf, 0x0, 0x3c, 0x0, 0xf0, 0x3, 0xc0,
-    0xf, 0x0,
-
-    /* U+D3 "Ó" */
-    0x0, 0x0, 0x0, 0x90, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x90, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0,
-    0x2, 0xf4, 0x0, 0x2f, 0x80, 0xb, 0xc0, 0x0,
-    0x3, 0xe0, 0x1f, 0x0, 0x0, 0x0, 0xf4, 0x3c,
-    0x0, 0x0, 0x0, 0x7c, 0x78, 0x0, 0x0, 0x0,
-    0x3c, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0xb4, 0x0,
-    0x0, 0x0, 0x2d, 0xb4, 0x0, 0x0, 0x0, 0x2d,
-    0xb4, 0x0, 0x0, 0x0, 0x2d, 0x78, 0x0, 0x0,
-    0x0, 0x3c, 0x3c, 0x0, 0x0, 0x0, 0x7c, 0x1f,
-    0x0, 0x0, 0x0, 0xf4, 0xb, 0xc0, 0x0, 0x3,
-    0xe0, 0x2, 0xf4, 0x0, 0x2f, 0x80, 0x0, 0x7f,
-    0xff, 0xfd, 0x0, 0x0, 0x6, 0xff, 0x90, 0x0,
-
-    /* U+D4 "Ô" */
-    0x0, 0x0, 0x24, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xc3, 0x80, 0x0, 0x0,
-    0xf, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x90, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0,
-    0x2, 0xf4, 0x0, 0x2f, 0x80, 0xb, 0xc0, 0x0,
-    0x3, 0xe0, 0x1f, 0x0, 0x0, 0x0, 0xf4, 0x3c,
-    0x0, 0x0, 0x0, 0x7c, 0x78, 0x0, 0x0, 0x0,
-    0x3c, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0xb4, 0x0,
-    0x0, 0x0, 0x2d, 0xb4, 0x0, 0x0, 0x0, 0x2d,
-    0xb4, 0x0, 0x0, 0x0, 0x2d, 0x78, 0x0, 0x0,
-    0x0, 0x3c, 0x3c, 0x0, 0x0, 0x0, 0x7c, 0x1f,
-    0x0, 0x0, 0x0, 0xf4, 0xb, 0xc0, 0x0, 0x3,
-    0xe0, 0x2, 0xf4, 0x0, 0x2f, 0x80, 0x0, 0x7f,
-    0xff, 0xfd, 0x0, 0x0, 0x6, 0xff, 0x90, 0x0,
-
-    /* U+D5 "Õ" */
-    0x0, 0x7, 0xe4, 0x70, 0x0, 0x0, 0xd, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x90, 0x0, 0x0, 0x7f,
-    0xff, 0xfd, 0x0, 0x2, 0xf4, 0x0, 0x2f, 0x80,
-    0xb, 0xc0, 0x0, 0x3, 0xe0, 0x1f, 0x0, 0x0,
-    0x0, 0xf4, 0x3c, 0x0, 0x0, 0x0, 0x7c, 0x78,
-    0x0, 0x0, 0x0, 0x3c, 0xb4, 0x0, 0x0, 0x0,
-    0x2d, 0xb4, 0x0, 0x0, 0x0, 0x2d, 0xb4, 0x0,
-    0x0, 0x0, 0x2d, 0xb4, 0x0, 0x0, 0x0, 0x2d,
-    0x78, 0x0, 0x0, 0x0, 0x3c, 0x3c, 0x0, 0x0,
-    0x0, 0x7c, 0x1f, 0x0, 0x0, 0x0, 0xf4, 0xb,
-    0xc0, 0x0, 0x3, 0xe0, 0x2, 0xf4, 0x0, 0x2f,
-    0x80, 0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0, 0x6,
-    0xff, 0x90, 0x0,
-
-    /* U+DA "Ú" */
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x3d, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x38, 0x0, 0x0, 0xf, 0x38, 0x0, 0x0, 0xf,
-    0x3c, 0x0, 0x0, 0xe, 0x3c, 0x0, 0x0, 0xe,
-    0x3c, 0x0, 0x0, 0x1e, 0x2d, 0x0, 0x0, 0x3d,
-    0x1f, 0x0, 0x0, 0x7c, 0xb, 0xd0, 0x2, 0xf0,
-    0x2, 0xff, 0xff, 0xd0, 0x0, 0x2f, 0xf9, 0x0,
-
-    /* U+E0 "à" */
-    0x7, 0xc0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x90, 0x2f, 0xeb, 0xf8,
-    0x38, 0x0, 0x3d, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0xf, 0x7, 0xff, 0xff, 0x2f,
-    0x55, 0x5f, 0x78, 0x0, 0xf, 0xb4, 0x0, 0xf,
-    0xb4, 0x0, 0x1f, 0x3c, 0x0, 0x7f, 0x2f, 0x96,
-    0xef, 0x6, 0xfe, 0x4f,
-
-    /* U+E1 "á" */
-    0x0, 0x0, 0xf0, 0x0, 0x3, 0xc0, 0x0, 0xf,
-    0x0, 0x0, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x90, 0x2f, 0xeb, 0xf8,
-    0x38, 0x0, 0x3d, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0xf, 0x7, 0xff, 0xff, 0x2f,
-    0x55, 0x5f, 0x78, 0x0, 0xf, 0xb4, 0x0, 0xf,
-    0xb4, 0x0, 0x1f, 0x3c, 0x0, 0x7f, 0x2f, 0x96,
-    0xef, 0x6, 0xfe, 0x4f,
-
-    /* U+E2 "â" */
-    0x0, 0x3f, 0x0, 0x0, 0xf7, 0x80, 0x3, 0xc1,
-    0xe0, 0x6, 0x0, 0x24, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x90, 0x2f, 0xeb, 0xf8,
-    0x38, 0x0, 0x3d, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0xf, 0x7, 0xff, 0xff, 0x2f,
-    0x55, 0x5f, 0x78, 0x0, 0xf, 0xb4, 0x0, 0xf,
-    0xb4, 0x0, 0x1f, 0x3c, 0x0, 0x7f, 0x2f, 0x96,
-    0xef, 0x6, 0xfe, 0x4f,
-
-    /* U+E3 "ã" */
-    0x1, 0xe0, 0x24, 0x3, 0x68, 0x34, 0x6, 0xd,
-    0x30, 0x9, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x90, 0x2f, 0xeb, 0xf8,
-    0x38, 0x0, 0x3d, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0xf, 0x7, 0xff, 0xff, 0x2f,
-    0x55, 0x5f, 0x78, 0x0, 0xf, 0xb4, 0x0, 0xf,
-    0xb4, 0x0, 0x1f, 0x3c, 0x0, 0x7f, 0x2f, 0x96,
-    0xef, 0x6, 0xfe, 0x4f,
-
-    /* U+E7 "ç" */
-    0x0, 0x7f, 0xe0, 0x1, 0xfe, 0xbf, 0x80, 0xf4,
-    0x0, 0xf4, 0xf4, 0x0, 0x4, 0x78, 0x0, 0x0,
-    0x2d, 0x0, 0x0, 0xb, 0x0, 0x0, 0x2, 0xc0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x10, 0x3d, 0x0, 0x3d, 0x7,
-    0xfa, 0xfe, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0xc0,
-    0x0, 0x0, 0x74, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x70, 0x0, 0x4, 0x2c, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+E9 "é" */
-    0x0, 0x0, 0xb8, 0x0, 0x0, 0x2e, 0x0, 0x0,
-    0xb, 0x40, 0x0, 0x1, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x7f, 0xaf, 0xc0, 0x1f, 0x0, 0x1f, 0x3,
-    0xc0, 0x0, 0x38, 0x74, 0x0, 0x2, 0xcb, 0x0,
-    0x0, 0x1d, 0xbf, 0xff, 0xff, 0xdb, 0x55, 0x55,
-    0x54, 0xb4, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x3d, 0x0, 0x1, 0x0, 0xf4, 0x0, 0xb4, 0x7,
-    0xfa, 0xfe, 0x0, 0x7, 0xfe, 0x40,
-
-    /* U+EA "ê" */
-    0x0, 0x2f, 0x40, 0x0, 0x7, 0xbc, 0x0, 0x1,
-    0xe0, 0xb0, 0x0, 0x24, 0x2, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x7f, 0xaf, 0xc0, 0x1f, 0x0, 0x1f, 0x3,
-    0xc0, 0x0, 0x38, 0x74, 0x0, 0x2, 0xcb, 0x0,
-    0x0, 0x1d, 0xbf, 0xff, 0xff, 0xdb, 0x55, 0x55,
-    0x54, 0xb4, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x3d, 0x0, 0x1, 0x0, 0xf4, 0x0, 0xb4, 0x7,
-    0xfa, 0xfe, 0x0, 0x7, 0xfe, 0x40,
-
-    /* U+ED "í" */
-    0x0, 0xf4, 0xf, 0x0, 0xf0, 0xa, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xd0, 0x7, 0x40, 0x1d, 0x0,
-    0x74, 0x1, 0xd0, 0x7, 0x40, 0x1d, 0x0, 0x74,
-    0x1, 0xd0, 0x7, 0x40, 0x1d, 0x0, 0x74, 0x1,
-    0xd0, 0x7, 0x40,
-
-    /* U+F3 "ó" */
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x2, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x1, 0xfe, 0xbf, 0x80, 0xf, 0x40,
-    0xf, 0x80, 0xf0, 0x0, 0xf, 0x7, 0x80, 0x0,
-    0x1e, 0x2d, 0x0, 0x0, 0x3c, 0xb0, 0x0, 0x0,
-    0xf2, 0xc0, 0x0, 0x3, 0xcb, 0x40, 0x0, 0xf,
-    0x1e, 0x0, 0x0, 0x78, 0x3c, 0x0, 0x3, 0xc0,
-    0x3d, 0x0, 0x3e, 0x0, 0x7f, 0xaf, 0xe0, 0x0,
-    0x1f, 0xf8, 0x0,
-
-    /* U+F4 "ô" */
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0xfb, 0x40, 0x0,
-    0xe, 0xb, 0x40, 0x0, 0xa0, 0x6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x1, 0xfe, 0xbf, 0x80, 0xf, 0x40,
-    0xf, 0x80, 0xf0, 0x0, 0xf, 0x7, 0x80, 0x0,
-    0x1e, 0x2d, 0x0, 0x0, 0x3c, 0xb0, 0x0, 0x0,
-    0xf2, 0xc0, 0x0, 0x3, 0xcb, 0x40, 0x0, 0xf,
-    0x1e, 0x0, 0x0, 0x78, 0x3c, 0x0, 0x3, 0xc0,
-    0x3d, 0x0, 0x3e, 0x0, 0x7f, 0xaf, 0xe0, 0x0,
-    0x1f, 0xf8, 0x0,
-
-    /* U+F5 "õ" */
-    0x0, 0xb8, 0xc, 0x0, 0xb, 0x68, 0x70, 0x0,
-    0x34, 0x2f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x1, 0xfe, 0xbf, 0x80, 0xf, 0x40,
-    0xf, 0x80, 0xf0, 0x0, 0xf, 0x7, 0x80, 0x0,
-    0x1e, 0x2d, 0x0, 0x0, 0x3c, 0xb0, 0x0, 0x0,
-    0xf2, 0xc0, 0x0, 0x3, 0xcb, 0x40, 0x0, 0xf,
-    0x1e, 0x0, 0x0, 0x78, 0x3c, 0x0, 0x3, 0xc0,
-    0x3d, 0x0, 0x3e, 0x0, 0x7f, 0xaf, 0xe0, 0x0,
-    0x1f, 0xf8, 0x0,
-
-    /* U+FA "ú" */
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x40, 0x0, 0x3e, 0xd0,
-    0x0, 0xf, 0xb4, 0x0, 0x3, 0xed, 0x0, 0x0,
-    0xfb, 0x40, 0x0, 0x3e, 0xd0, 0x0, 0xf, 0xb4,
-    0x0, 0x3, 0xed, 0x0, 0x0, 0xfb, 0x40, 0x0,
-    0x3d, 0xd0, 0x0, 0x1f, 0x3c, 0x0, 0xf, 0xcb,
-    0x80, 0xb, 0xf0, 0xfe, 0xaf, 0x7c, 0x7, 0xfe,
-    0xf,
-
-    /* U+20AC "€" */
-    0x0, 0x0, 0x1b, 0xfe, 0x40, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0x0, 0xf, 0xd0, 0x0, 0x7d, 0x0,
-    0x3e, 0x0, 0x0, 0x4, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf8, 0x0, 0x2, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x0, 0x0, 0x8, 0x0, 0xb, 0xe0, 0x0, 0x7d,
-    0x0, 0x1, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1b,
-    0xfe, 0x40,
-
-    /* U+2122 "™" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xe3, 0x80, 0x0, 0xd, 0x0, 0xe0, 0x3, 0xc0,
-    0x0, 0x2d, 0x0, 0xe0, 0x3, 0xf0, 0x0, 0x7d,
-    0x0, 0xe0, 0x3, 0xb8, 0x0, 0xdd, 0x0, 0xe0,
-    0x3, 0x5c, 0x2, 0x8d, 0x0, 0xe0, 0x3, 0x4b,
-    0x7, 0xd, 0x0, 0xe0, 0x3, 0x43, 0x4d, 0xd,
-    0x0, 0xe0, 0x3, 0x41, 0xec, 0xd, 0x0, 0xe0,
-    0x3, 0x40, 0xb0, 0xd, 0x0, 0xe0, 0x3, 0x40,
-    0x10, 0xd, 0x0, 0x90, 0x2, 0x40, 0x0, 0x9
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 109, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 108, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14, .adv_w = 155, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 11},
-    {.bitmap_index = 27, .adv_w = 290, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 108, .adv_w = 256, .box_w = 14, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 196, .adv_w = 345, .box_w = 20, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 286, .adv_w = 278, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 367, .adv_w = 84, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 11},
-    {.bitmap_index = 373, .adv_w = 137, .box_w = 6, .box_h = 25, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 411, .adv_w = 137, .box_w = 5, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 443, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 468, .adv_w = 239, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 507, .adv_w = 88, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 514, .adv_w = 159, .box_w = 8, .box_h = 2, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 518, .adv_w = 88, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 521, .adv_w = 139, .box_w = 11, .box_h = 25, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 590, .adv_w = 275, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 658, .adv_w = 150, .box_w = 7, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 690, .adv_w = 236, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 753, .adv_w = 235, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 816, .adv_w = 275, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 888, .adv_w = 235, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 951, .adv_w = 253, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1019, .adv_w = 245, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1087, .adv_w = 265, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1155, .adv_w = 253, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1223, .adv_w = 88, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1237, .adv_w = 88, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1255, .adv_w = 239, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1294, .adv_w = 239, .box_w = 13, .box_h = 8, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 1320, .adv_w = 239, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1359, .adv_w = 236, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1418, .adv_w = 430, .box_w = 25, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1562, .adv_w = 298, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1648, .adv_w = 314, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1725, .adv_w = 299, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1802, .adv_w = 344, .box_w = 19, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1888, .adv_w = 278, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1951, .adv_w = 263, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2014, .adv_w = 322, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2091, .adv_w = 338, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2168, .adv_w = 126, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2182, .adv_w = 208, .box_w = 12, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2236, .adv_w = 296, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2313, .adv_w = 245, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2376, .adv_w = 397, .box_w = 20, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2466, .adv_w = 338, .box_w = 17, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2543, .adv_w = 349, .box_w = 20, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2633, .adv_w = 299, .box_w = 16, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2705, .adv_w = 349, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2821, .adv_w = 301, .box_w = 16, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2893, .adv_w = 256, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2956, .adv_w = 239, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3024, .adv_w = 329, .box_w = 16, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3096, .adv_w = 290, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3182, .adv_w = 462, .box_w = 28, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3308, .adv_w = 273, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3385, .adv_w = 264, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3462, .adv_w = 271, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3534, .adv_w = 132, .box_w = 6, .box_h = 25, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 3572, .adv_w = 139, .box_w = 11, .box_h = 25, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 3641, .adv_w = 132, .box_w = 6, .box_h = 25, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 3679, .adv_w = 240, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3710, .adv_w = 208, .box_w = 13, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3720, .adv_w = 250, .box_w = 7, .box_h = 4, .ofs_x = 3, .ofs_y = 16},
-    {.bitmap_index = 3727, .adv_w = 245, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3769, .adv_w = 282, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3844, .adv_w = 234, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3890, .adv_w = 282, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3965, .adv_w = 251, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4014, .adv_w = 141, .box_w = 10, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4064, .adv_w = 285, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4136, .adv_w = 282, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4206, .adv_w = 112, .box_w = 3, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4221, .adv_w = 114, .box_w = 8, .box_h = 25, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 4271, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4341, .adv_w = 112, .box_w = 3, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4356, .adv_w = 441, .box_w = 24, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4440, .adv_w = 282, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4489, .adv_w = 261, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4542, .adv_w = 282, .box_w = 15, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 4614, .adv_w = 282, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4686, .adv_w = 167, .box_w = 8, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4714, .adv_w = 203, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4756, .adv_w = 169, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4799, .adv_w = 280, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4845, .adv_w = 225, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4898, .adv_w = 366, .box_w = 23, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4979, .adv_w = 222, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5028, .adv_w = 225, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 5104, .adv_w = 213, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5146, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 5196, .adv_w = 123, .box_w = 3, .box_h = 25, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 5215, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 5265, .adv_w = 239, .box_w = 13, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 5285, .adv_w = 337, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5376, .adv_w = 167, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 11},
-    {.bitmap_index = 5392, .adv_w = 337, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5483, .adv_w = 239, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5535, .adv_w = 179, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 5560, .adv_w = 172, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 5583, .adv_w = 298, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5697, .adv_w = 298, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5811, .adv_w = 298, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5925, .adv_w = 298, .box_w = 19, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6035, .adv_w = 299, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 6142, .adv_w = 278, .box_w = 14, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6226, .adv_w = 278, .box_w = 14, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6310, .adv_w = 126, .box_w = 7, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6352, .adv_w = 349, .box_w = 20, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6472, .adv_w = 349, .box_w = 20, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6592, .adv_w = 349, .box_w = 20, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6707, .adv_w = 329, .box_w = 16, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6803, .adv_w = 245, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6863, .adv_w = 245, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6923, .adv_w = 245, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6983, .adv_w = 245, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7043, .adv_w = 234, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 7112, .adv_w = 251, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7182, .adv_w = 251, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7252, .adv_w = 112, .box_w = 7, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7287, .adv_w = 261, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7362, .adv_w = 261, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7437, .adv_w = 261, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7512, .adv_w = 280, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7577, .adv_w = 334, .box_w = 20, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7667, .adv_w = 425, .box_w = 24, .box_h = 12, .ofs_x = 0, .ofs_y = 7}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x1, 0x5, 0x8, 0x9, 0x11, 0x17, 0x18,
-    0x19, 0x1a, 0x1e, 0x20, 0x21, 0x24, 0x2a, 0x2b,
-    0x2c, 0x31, 0x37, 0x38, 0x39, 0x3a, 0x3e, 0x40,
-    0x41, 0x44, 0x4a, 0x4b, 0x4c, 0x51, 0x2003, 0x2079
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 169, .range_length = 8314, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    22, 8, 22, 0, 0, 8, 23, 23,
-    23, 23, 25, 26, 26, 29, 22, 22,
-    22, 30, 45, 45, 45, 45, 47, 49,
-    49, 51, 46, 46, 46, 51, 25, 61
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    23, 8, 23, 0, 0, 8, 24, 24,
-    24, 24, 23, 25, 25, 25, 23, 23,
-    23, 28, 37, 37, 37, 37, 39, 39,
-    39, 42, 39, 39, 39, 45, 49, 50
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 4, 0, 0, 0,
-    0, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2, 1, 19, 0, 12, -10, 0,
-    0, 0, 0, -23, -25, 3, 20, 10,
-    7, -17, 3, 22, 2, 19, 4, 15,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 25, 2, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -8, 16, 0, -12, 0, 0,
-    0, 0, 0, -8, 7, 8, 0, 0,
-    -4, 0, -3, 4, 0, -4, 0, -4,
-    -2, -8, 0, 0, 0, 0, -4, 0,
-    0, -6, -6, 0, 0, -4, 0, -8,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, -4, 0, 0, 0, 0, -12,
-    0, -50, 0, 0, -8, 0, 8, 12,
-    0, 0, -8, 4, 4, 14, 8, -7,
-    8, 0, 0, -24, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -16,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, -22, 0, -17, -3, 0, 0, 0,
-    0, 2, 18, 0, -12, -2, -1, 1,
-    0, -7, 0, 0, -2, -32, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -33, -2, 19, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -13, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 13, 0, 4, 0,
-    0, -8, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 15, 2, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -16, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 2, 8,
-    4, 12, -4, 0, 0, 8, -4, -13,
-    -58, 3, 12, 8, 1, -6, 0, 17,
-    0, 15, 0, 15, 0, -38, 0, -5,
-    12, 0, 14, -4, 8, 4, 0, 0,
-    1, -4, 0, 0, -7, 33, 0, 33,
-    0, 12, 0, 19, 5, 7, 3, 17,
-    0, 0, 0, -16, 0, 0, 0, 0,
-    1, -2, 0, 3, -7, -5, -8, 3,
-    0, -4, 0, 0, 0, -17, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -27, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    3, -8, 1, -23, 0, -26, 0, 0,
-    0, 0, -2, 0, 43, -5, -5, 4,
-    4, -5, 0, -5, 4, 0, 0, -22,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -41, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, -17, 0, 25, 0, 0,
-    -16, 0, 13, 0, -28, -41, -27, -8,
-    12, 0, 0, -28, 0, 6, -9, 0,
-    -6, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 12, -52,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 20, 0, 3,
-    0, 0, 0, 0, 0, 3, 3, -5,
-    -8, 0, -1, -1, -4, 0, 0, -3,
-    0, 0, 0, -8, 0, -3, 0, -9,
-    -8, 0, -10, -13, -13, -9, 0, -8,
-    0, -8, 0, 0, 0, 0, -3, 0,
-    0, 4, 0, 3, -4, 0, 0, 0,
-    0, 0, 0, 4, -3, 0, 0, 0,
-    -3, 4, 4, -2, 0, 0, 0, -10,
-    0, -2, 0, 0, 0, 0, 0, 1,
-    0, 5, -3, 0, -5, 0, -7, 0,
-    0, -3, 0, 12, 0, 0, -4, 0,
-    0, 0, 0, 0, -2, 2, -3, -3,
-    0, 0, 0, -4, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    -2, 0, -4, -5, 0, 0, 0, 0,
-    0, 2, 0, 0, -2, 0, -4, -4,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, -2,
-    -5, 0, 0, 0, 0, -12, -3, -12,
-    8, 0, 0, -8, 4, 8, 12, 0,
-    -10, -2, -6, 0, -2, -21, 4, -3,
-    2, -22, 4, 0, 0, 1, -21, 0,
-    -22, -3, -36, -3, 0, -21, 0, 8,
-    12, 0, 5, 0, 0, 0, 0, 0,
-    0, -6, -5, 0, 4, -8, 0, 0,
-    0, -4, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, -2, -2, 0, -2, -6,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    -4, 0, -2, -5, -4, 0, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, -3, 0, 0, 0,
-    0, -3, 0, -8, 4, 0, 0, -6,
-    2, 4, 4, 0, 0, 0, 0, 0,
-    0, -3, 0, 0, 0, 0, 0, 3,
-    0, 0, -4, 0, -4, -3, -6, 0,
-    0, 0, 0, 0, 0, 0, 4, 0,
-    -3, 0, 0, 0, 0, -4, -6, 0,
-    4, 0, 0, 12, -3, 1, -15, 0,
-    0, 12, -21, -22, -18, -8, 4, 0,
-    -4, -27, -8, 0, -8, 0, -8, 6,
-    -8, -27, 0, -12, 0, 0, 2, -2,
-    3, -3, 0, 4, -1, -12, -16, 0,
-    -21, -11, -9, -11, -12, -6, -12, -2,
-    -10, -12, -8, 17, 0, 2, 0, -4,
-    0, 0, 0, 3, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, 0, -2, 0, -2, -4, 0,
-    -7, -9, -9, -2, 0, -12, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, 2, -2, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    19, 0, 0, 0, 0, 0, 0, 3,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -7,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, -10, 0, 0, 0,
-    0, -21, -12, 0, 0, 0, -6, -21,
-    0, 0, -4, 4, 0, -13, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -8, 0, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -8, 0, 0, 0, 0,
-    6, 0, 3, -8, -8, 0, -4, -4,
-    -5, 0, 0, 0, 0, 0, 0, -12,
-    0, -4, 0, -6, -4, 0, -9, -10,
-    -12, -4, 0, -8, 0, -12, 0, 0,
-    0, 0, 33, 0, 0, 2, 0, 0,
-    -5, 0, 0, 2, 0, -18, 0, 0,
-    0, 0, 0, -38, -6, 14, 12, -3,
-    -17, 0, 4, -6, 0, -21, -2, -6,
-    4, -29, -4, 4, 0, 6, -15, -6,
-    -15, -13, -17, 0, 0, -25, 0, 24,
-    0, 0, -2, 0, 0, 0, -2, -2,
-    -4, -11, -13, 0, 0, -30, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, -2, -4, -6, 0, 0, -8,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -2, 0, -8, 0, 0, 8,
-    -1, 6, 0, -10, 4, -3, -2, -12,
-    -4, 0, -6, -4, -2, 0, -6, -7,
-    0, 0, -4, -1, -3, -7, -6, 0,
-    0, -4, 0, 4, -3, 0, -10, 0,
-    0, 0, -8, 0, -7, 0, -7, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -8, 4, 0, -7, 0, -3,
-    -6, -16, -3, -3, -3, -2, -3, -6,
-    -2, 0, 0, 0, 0, 0, -4, -4,
-    -4, 0, 0, 0, 0, 6, -3, 0,
-    -3, 0, 0, 0, -3, -6, -3, -5,
-    -6, -5, 0, 0, 2, 17, -2, 0,
-    -12, 0, -3, 8, 0, -4, -18, -6,
-    6, 0, 0, -21, -7, 4, -7, 2,
-    0, -5, -4, -14, 0, -6, 2, 0,
-    0, -7, 0, 0, 0, 4, 4, -8,
-    -9, 0, -7, -4, -6, -4, -4, 0,
-    -7, 2, -9, -7, 0, 12, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -6, 0, 0, -6, 0, 0, -4,
-    -4, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, 0, -6, 0,
-    -8, 0, 0, 0, -13, 0, 3, -9,
-    8, 0, -3, -20, 0, 0, -9, -4,
-    0, -17, -10, -11, 0, 0, -17, -4,
-    -17, -15, -20, 0, -12, 0, 2, 28,
-    -6, 0, -10, -4, -2, -4, -7, -12,
-    -8, -15, -16, -9, 0, 8, 0, 0,
-    -3, 0, 1, 0, 0, -29, -5, 12,
-    10, -10, -16, 0, 1, -16, 0, -21,
-    -3, -4, 8, -40, -6, 1, 0, 0,
-    -27, -5, -22, -4, -31, 0, 0, -29,
-    0, 26, 1, 0, -3, 0, 0, 0,
-    0, -2, -3, -16, -3, 0, 0, -27,
-    0, 0, 0, 0, -14, 0, -5, 0,
-    -1, -12, -20, 0, 0, -2, -6, -12,
-    -4, 0, -2, 0, 0, 0, 0, -19,
-    -4, -14, -14, -2, -7, -10, -4, -7,
-    0, -8, -5, -13, -6, 0, -5, -10,
-    -4, -10, 0, 2, 0, -3, -14, 0,
-    0, 0, 0, -8, 0, 0, 0, 0,
-    6, 0, 3, -8, 15, 0, -4, -4,
-    -5, 0, 0, 0, 0, 0, 0, -12,
-    0, -4, 0, -6, -4, 0, -9, -10,
-    -12, -4, 0, -8, 2, 17, 0, 0,
-    0, 0, 33, 0, 0, 2, 0, 0,
-    -5, 0, 0, 2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -8, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, -4, -4, 0,
-    0, -8, -4, 0, 0, -8, 0, 7,
-    -2, 0, 0, 0, 0, 0, 0, 2,
-    0, 0, 0, 0, 0, 0, 8, 2,
-    -5, 0, -15, -8, 0, 12, -13, -13,
-    -8, -8, 17, 6, 4, -37, -2, 8,
-    -4, 0, -4, 3, -4, -15, 0, -4,
-    4, -6, -2, -12, -2, 0, 0, 12,
-    8, 0, -12, 0, -23, -6, 9, -6,
-    -16, 1, -6, -14, -14, -4, 0, 21,
-    4, 0, -6, 0, -12, 0, 2, 14,
-    -9, -15, -17, -10, 12, 0, 1, -30,
-    -3, 4, -7, -2, -9, 0, -9, -15,
-    -6, -6, -2, 0, 0, -9, -8, -4,
-    0, 12, 9, -4, -23, 0, -23, -7,
-    0, -15, -24, -1, -13, -7, -14, -11,
-    0, 17, 0, 0, -6, 0, -8, -5,
-    0, -4, -7, 0, 7, -13, 4, 0,
-    0, -22, 0, -4, -9, -7, -2, -12,
-    -10, -13, -10, 0, -12, -4, -9, -10,
-    -12, -4, 0, 0, 1, 20, -7, 0,
-    -12, -4, 0, -4, -8, -9, -11, -10,
-    -15, -5, 0, 12, 8, 0, -6, 0,
-    -21, -6, 2, 8, -13, -15, -8, -13,
-    13, -4, 2, -38, -7, 8, -9, -7,
-    -15, 0, -12, -17, -6, -4, -2, -4,
-    -8, -12, -1, 0, 0, 12, 10, -3,
-    -27, 0, -25, -12, 8, -16, -28, -8,
-    -15, -17, -21, -13, 0, 21, 0, 0,
-    0, 0, -6, 0, 0, 4, -6, 8,
-    3, -9, 8, 0, 0, -16, -2, 0,
-    -2, 0, 1, 1, -4, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    2, 12, 0, 0, -6, 0, 0, 0,
-    0, -3, -3, -6, 0, 0, 0, 12,
-    1, 2, 0, 0, 0, 0, 2, 0,
-    -4, 0, 15, 0, 6, 1, 1, -5,
-    0, 8, 0, 0, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 12, 0, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 19, 0, -25, 0, -4, 7, 0,
-    12, 0, 0, 43, 6, -8, -8, 4,
-    4, -3, 1, -21, 0, 0, 19, -25,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -27, 15, 58, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -25, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -8, 0,
-    0, -10, -5, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, -12, 0, 0, 1, 0, 0, 4,
-    55, -8, -4, 15, 12, -12, 4, 0,
-    0, 4, 4, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -54,
-    10, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -3, -21,
-    0, 0, 0, -12, 0, 0, 0, -12,
-    0, 0, 0, 0, -10, -2, 0, 0,
-    0, -10, 0, -6, 0, -20, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -28, 0, 0, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, -4, 0, 0,
-    0, -12, 0, -6, 0, -12, 0, 0,
-    0, -7, 4, -6, 0, 0, -12, -4,
-    -10, 0, 0, -12, 0, -4, 0, -20,
-    0, -3, 0, 0, -35, -10, -17, -3,
-    -14, 0, 0, -28, 0, -12, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -6,
-    -8, -4, 0, -12, 0, 0, 0, 0,
-    -10, 0, -9, 5, -3, 8, 0, -3,
-    -10, -3, -7, -10, 0, -6, -2, -3,
-    2, -12, -1, 0, 0, 0, -40, -2,
-    -4, 0, -6, 0, -3, -20, -5, 0,
-    0, -3, -4, 0, 0, 0, 0, 2,
-    0, -3, -7, -3, 0, -6, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, -10, 0, -3, 0, 0, 0, -8,
-    4, 0, 0, 0, -12, -4, -8, 0,
-    0, -12, 0, -4, 0, -20, 0, 0,
-    0, 0, -41, 0, -8, -15, -21, 0,
-    0, -28, 0, -2, -6, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, -6, -2,
-    0, -12, 1, 0, 0, 7, -5, 0,
-    11, 22, -4, -4, -12, 6, 22, 7,
-    10, -12, 6, 19, 6, 13, 10, 12,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 27, 20, -6, -4, 0,
-    -4, 33, 17, 33, 0, 0, 0, 4,
-    0, 0, 0, 33, 0, 0, -8, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, -38, -6,
-    -2, -18, -22, 0, 0, -28, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -8, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 4, 0, 0, 0, 0,
-    -38, -6, -2, -18, -22, 0, 0, -21,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    -9, 4, 0, -4, 2, 6, 4, -12,
-    0, -2, -3, 4, 0, 2, 0, 0,
-    0, 0, -13, 0, -5, -3, -8, 0,
-    -5, -17, 0, 27, -4, 0, -9, -3,
-    0, -3, -7, 0, -4, -11, -8, -5,
-    0, 0, 0, 0, -8, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, -38, -6, -2, -18,
-    -22, 0, 0, -28, 0, 0, 0, 0,
-    0, 0, 21, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -8, 0,
-    -15, -6, -5, 12, -5, -4, -17, 1,
-    -4, 1, -3, -12, 0, 9, 0, 2,
-    1, 2, -11, -16, -6, 0, -19, -10,
-    -12, -18, -17, 0, -8, -8, -6, -5,
-    -4, -3, -5, -3, 0, -3, -2, 6,
-    0, 6, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -4, -4, 0, 0, -12,
-    0, -2, 0, -7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -25,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, -7,
-    0, 0, 0, 0, -4, 0, 0, -7,
-    -4, 4, 0, -7, -9, -3, 0, -14,
-    -3, -10, -2, -6, 0, -7, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -28, 0, 15, 0, 0, -8, 0,
-    0, 0, 0, -6, 0, -4, 0, 0,
-    0, -12, 0, 0, -3, 0, -9, 0,
-    0, 19, -5, -14, -12, 3, 3, 3,
-    -2, -10, 3, 6, 3, 12, 3, 13,
-    -3, -11, 0, 0, -21, 0, 0, -12,
-    -12, 0, 0, -8, 0, -5, -7, 0,
-    -6, 0, -6, 0, -2, 6, 0, -2,
-    -12, -4, 0, 0, 0, 0, -5, 0,
-    -8, 0, 0, 5, -9, 0, 4, -4,
-    2, -1, 0, -13, 0, -3, -1, 0,
-    -4, 3, -2, 0, 0, 0, -20, -6,
-    -9, 0, -12, 0, 0, -20, 0, 16,
-    -4, 0, -8, 0, -1, 0, -4, 0,
-    -4, -12, 0, -4, 0, 0, 0, 0,
-    0, 0, -3, 0, 0, 4, -6, 1,
-    0, 0, -6, -3, 0, -6, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -27,
-    0, 10, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    4, 0, -19, 0, 0, 0, 0, 0,
-    0, 5, 0, 12, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 17, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 61,
-    .right_class_cnt     = 50,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t sr_font_montserrat_26 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 31,          /*The maximum line height required by the font*/
-    .base_line = 7,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if SR_FONT_MONTSERRAT_26*/
-
@@ -0,0 +1,120 @@
+/**
+ * @file font_cache.c
+ * @brief Cache of the glyphs of the fonts compressed by tools/font_subset.py.
+ * LVGL decompresses a glyph each time it's drawn, into a single buffer, so the
+ * glyphs are copied from there into a cache sized by
+ * CONFIG_SR_UI_FONT_CACHE_SIZE and drawn from it while the UI shows them
+ * @version 2.1.2
+ * @date 2024-11-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "font_cache.h"
+
+#include <stdlib.h>
+
+/**
+ * @brief  Decompressed glyph
+ */
+struct font_cache_entry_t {
+  const lv_font_t *font;
+  uint32_t letter;
+  uint8_t *bitmap;
+  uint32_t size;
+  uint32_t used;
+};
+
+static struct font_cache_entry_t font_cache[FONT_CACHE_ENTRIES];
+static struct font_cache_stats_t font_cache_stats;
+// Glyphs drawn, to find the least recently used one
+static uint32_t font_cache_clock = 0;
+
+/**
+ * @brief  Get the room for a decompressed glyph, dropping the least recently
+ *         used glyphs
+ * @param  size: Size of the decompressed glyph
+ * @retval Entry of the glyph, NULL if it doesn't fit
+ */
+static struct font_cache_entry_t *font_cache_alloc(uint32_t size) {
+  const uint32_t capacity = CONFIG_SR_UI_FONT_CACHE_SIZE * 1024;
+
+  if (size > capacity) {
+    return NULL;
+  }
+
+  for (;;) {
+    struct font_cache_entry_t *free_entry = NULL;
+    struct font_cache_entry_t *oldest = NULL;
+
+    for (int i = 0; i < FONT_CACHE_ENTRIES; i++) {
+      struct font_cache_entry_t *entry = &font_cache[i];
+      if (entry->font == NULL) {
+        free_entry = free_entry ? free_entry : entry;
+      } else if (oldest == NULL || entry->used < oldest->used) {
+        oldest = entry;
+      }
+    }
+
+    if (free_entry != NULL && font_cache_stats.used + size <= capacity) {
+      free_entry->bitmap = malloc(size);
+      if (free_entry->bitmap == NULL) {
+        return NULL;
+      }
+      free_entry->size = size;
+      font_cache_stats.used += size;
+      font_cache_stats.glyphs++;
+      return free_entry;
+    }
+
+    if (oldest == NULL) {
+      return NULL;
+    }
+    free(oldest->bitmap);
+    font_cache_stats.used -= oldest->size;
+    font_cache_stats.glyphs--;
+    font_cache_stats.evictions++;
+    memset(oldest, 0, sizeof(*oldest));
+  }
+}
+
+const uint8_t *font_cache_get_bitmap(const lv_font_t *font, uint32_t letter) {
+  font_cache_clock++;
+  for (int i = 0; i < FONT_CACHE_ENTRIES; i++) {
+    if (font_cache[i].font == font && font_cache[i].letter == letter) {
+      font_cache[i].used = font_cache_clock;
+      font_cache_stats.hits++;
+      return font_cache[i].bitmap;
+    }
+  }
+
+  // Decompressed by LVGL into its buffer, overwritten by the next glyph
+  const uint8_t *bitmap = lv_font_get_bitmap_fmt_txt(font, letter);
+  if (bitmap == NULL) {
+    return NULL;
+  }
+  font_cache_stats.misses++;
+
+  lv_font_glyph_dsc_t glyph;
+  lv_font_get_glyph_dsc_fmt_txt(font, &glyph, letter, 0);
+  // LVGL decompresses the 3 bpp fonts to 4 bpp
+  uint8_t bpp = glyph.bpp == 3 ? 4 : glyph.bpp;
+  uint32_t size = ((uint32_t)glyph.box_w * glyph.box_h * bpp + 7) / 8;
+
+  // Drawn from the LVGL buffer when it doesn't fit
+  struct font_cache_entry_t *entry = font_cache_alloc(size);
+  if (entry == NULL) {
+    return bitmap;
+  }
+  memcpy(entry->bitmap, bitmap, size);
+  entry->font   = font;
+  entry->letter = letter;
+  entry->used   = font_cache_clock;
+
+  return entry->bitmap;
+}
+
+void font_cache_get_stats(struct font_cache_stats_t *stats) {
+  *stats = font_cache_stats;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file font_cache.h
+ * @brief Cache of the glyphs of the compressed fonts header
+ * @version 2.1.2
+ * @date 2024-11-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef __FONT_CACHE_H_
+#define __FONT_CACHE_H_
+
+#include "lvgl.h"
+
+/* Glyphs kept decompressed at most */
+#define FONT_CACHE_ENTRIES 128
+
+/**
+ * @brief  Statistics of the cache of decompressed glyphs
+ * @param hits       Glyphs drawn already decompressed
+ * @param misses     Glyphs decompressed
+ * @param evictions  Glyphs dropped to make room for another
+ * @param used       Memory of the decompressed glyphs (bytes)
+ * @param glyphs     Glyphs decompressed
+ */
+typedef struct font_cache_stats_t {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+  uint32_t used;
+  uint8_t  glyphs;
+} font_cache_stats_t;
+
+/**
+ * @brief  Bitmap of a glyph of a compressed font, the get_glyph_bitmap of the
+ *         fonts generated by tools/font_subset.py with --compress
+ * @param  *font: Font of the glyph
+ * @param  letter: Character of the glyph
+ * @retval Bitmap of the glyph, valid until the next glyph, NULL if there's none
+ */
+const uint8_t *font_cache_get_bitmap(const lv_font_t *font, uint32_t letter);
+
+/**
+ * @brief  Get the statistics of the cache of decompressed glyphs
+ * @param  *stats: Filled with the statistics
+ * @retval None
+ */
+void font_cache_get_stats(struct font_cache_stats_t *stats);
+
+#endif
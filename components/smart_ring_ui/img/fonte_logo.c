@@ -1,215 +0,0 @@
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-#ifndef LV_ATTRIBUTE_IMG_FONTE_LOGO
-#define LV_ATTRIBUTE_IMG_FONTE_LOGO
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_FONTE_LOGO uint8_t fonte_logo_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x6e, 0x29, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x05, 0x00, 0x01, 0x00, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x6e, 0xdb, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x05, 0x05, 0x05, 0x29, 0x25, 0xbb, 0xff, 0xff, 0xdf, 0x6e, 0x05, 0x01, 0x00, 0x05, 0x49, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x29, 0x05, 0x01, 0x05, 0x29, 0x97, 0xff, 0xff, 0xff, 0x29, 0x05, 0x05, 0x05, 0x05, 0x05, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x4e, 0x05, 0x05, 0x05, 0x29, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x25, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x25, 0xdb, 0xb7, 0x05, 0xb7, 0xdb, 0x25, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x29, 0xff, 0xff, 0xff, 0xb7, 0x49, 0x05, 0x05, 0x29, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x01, 0x05, 0x05, 0x05, 0x00, 0xb7, 0xff, 0xbb, 0x05, 0x00, 0x05, 0x29, 0x29, 0x05, 0x00, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x00, 0x01, 0x25, 0x29, 0x05, 0x01, 0x00, 0x6e, 0xff, 0xff, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xdb, 0xff, 0xff, 0xff, 0x92, 0x00, 0x00, 0x05, 0x29, 0x05, 0x01, 0x00, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x05, 0xff, 0x92, 0x00, 0x92, 0xff, 0x05, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x00, 0x29, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x05, 0x05, 0x01, 0x00, 0x05, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x29, 0x05, 0xbb, 0xff, 0xff, 0xdf, 0x05, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x92, 0x05, 0x00, 0x97, 0xff, 0xff, 0xff, 0x29, 0x00, 0x29, 0xdb, 0xff, 0xff, 0xff, 0xb7, 0x05, 0x00, 0x72, 0xff, 0xff, 0xdf, 0x29, 0x05, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x05, 0x92, 0xff, 0xff, 0xff, 0xdb, 0x29, 0x00, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x92, 0xff, 0x92, 0x00, 0x92, 0xff, 0x4e, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x96, 0xff, 0x4e, 0x00, 0x25, 0xb7, 0xff, 0xff, 0xdb, 0x72, 0x01, 0x01, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x25, 0xff, 0xff, 0x97, 0x00, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x05, 0x01, 0xdb, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x01, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x05, 0xdf, 0xff, 0x92, 0x00, 0x92, 0xff, 0xbb, 0x00, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x05, 0x05, 0xff, 0xb7, 0x00, 0x25, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x01, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xdf, 0xff, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x00, 0xbb, 0xff, 0x49, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00, 0x72, 0xff, 0xff, 0x25, 0x05, 0xff, 0xff, 0xff, 0xff, 0x97, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x01, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x4e, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0x29, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00, 0x72, 0xff, 0x29, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x01, 0xff, 0xff, 0xdb, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00, 0x92, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00, 0x72, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xbb, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x00, 0xb7, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0x96, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0xdb, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x01, 0xff, 0xff, 0xb7, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x00, 0xbb, 0xff, 0xff, 0xff, 0xdb, 0x01, 0x05, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x29, 0xff, 0xff, 0x05, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x01, 0xff, 0xff, 0xb7, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0x25, 0x05, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x01, 0x29, 0x49, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x6e, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x92, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x92, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x96, 0xff, 0xdf, 0x01, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xb7, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x05, 0x05, 0xff, 0xff, 0xff, 0x05, 0x05, 0xdb, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x29, 0xff, 0xff, 0xdf, 0x05, 0x05, 0xff, 0xff, 0xdf, 0x05, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xdb, 0x01, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0xb7, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0x29, 0x00, 0xdb, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x00, 0xb7, 0xff, 0x97, 0x00, 0x49, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0x29, 0x00, 0xdb, 0xff, 0x72, 0x00, 0x4e, 0xff, 0xff, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0x29, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x05, 0x05, 0xff, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0x72, 0x00, 0x72, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x4e, 0xff, 0x49, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x72, 0xff, 0x29, 0x00, 0xbb, 0xff, 0xff, 0xff, 0x49, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x05, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x29, 0x00, 0x6e, 0xff, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0xff, 0x05, 0x01, 0x92, 0xff, 0xff, 0xff, 0x29, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x05, 0x00, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x05, 0x92, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x05, 0x05, 0x92, 0x05, 0x29, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x05, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x01, 0x01, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0x05, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00, 0x05, 0x4e, 0x97, 0xb7, 0x72, 0x05, 0x00, 0x49, 0xff, 0xff, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0xff, 0xb7, 0x05, 0x00, 0x4e, 0x96, 0xff, 0xdb, 0x05, 0x00, 0x29, 0x92, 0xbb, 0xb7, 0x6e, 0x01, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x01, 0x05, 0x01, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x01, 0x05, 0x01, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x05, 0x92, 0xdb, 0xdb, 0xb7, 0x4d, 0x00, 0x05, 0x05, 0x25, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x25, 0x00, 0x00, 0x00, 0x00, 0x05, 0x72, 0xff, 0xff, 0xff, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x49, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x29, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x25, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x05, 0x00, 0x01, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x01, 0x05, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xdb, 0x72, 0x00, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x92, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0x96, 0x72, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x4e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x4e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x96, 0x4e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0x92, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbb, 0xdf, 0xdf, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xbf, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xdf, 0x9b, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9b, 0xdf, 0xbb, 0xbf, 0xdf, 0x9b, 0xff, 0xdf, 0xff, 0xff, 0xbb, 0xbf, 0xff, 0xbf, 0xdf, 0xbf, 0xbf, 0xdf, 0xbf, 0x9b, 0xff, 0xdf, 0xdf, 0xbf, 0xdf, 0xdf, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xdf, 0xbb, 0xdf, 0xbb, 0xdf, 0xdf, 0xff, 0xff, 0xbb, 0xbf, 0xbf, 0xbf, 0xdf, 0x9b, 0xff, 0xff, 0xbb, 0xdf, 0xdf, 0x9b, 0xbf, 0xbf, 0xbb, 0xdf, 0x9b, 0xff, 0xff, 0xbb, 0xbb, 0xdf, 0x9b, 0xbf, 0xdf, 0xbb, 0xff, 0xbb, 0x9b, 0xff, 0xdf, 0xdf, 0xbb, 0xdf, 0xbb, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x9b, 0xff, 0x9b, 0xbb, 0xff, 0x9b, 0xdf, 0xdf, 0xff, 0xff, 0x9b, 0xdf, 0xdf, 0x9b, 0xff, 0xdf, 0x9b, 0xbf, 0x9b, 0x9b, 0xdf, 0x7b, 0xdf, 0xdf, 0xdf, 0xff, 0x9b, 0xbb, 0xff, 0xff, 0xbb, 0xbf, 0xdf, 0xdf, 0xff, 0x9b, 0xbb, 0xff, 0xff, 0xff, 0x77, 0xdf, 0xbf, 0x9b, 0xff, 0x9b, 0xdf, 0x9b, 0xbf, 0xff, 0xbf, 0x7b, 0xdf, 0xbf, 0x9b, 0xff, 0x9b, 0xdf, 0x9b, 0x9b, 0xff, 0xbb, 0x77, 0xdf, 0xdf, 0x9b, 0xdf, 0x9b, 0xdf, 0xdf, 0x97, 0xff, 0xdf, 0xdf, 0xdf, 0x9b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x9f, 0xdf, 0xdf, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xbf, 0xbb, 0xff, 0xdf, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xbb, 0xdf, 0xdf, 0xbf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xdf, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0x9b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0x9b, 0xdf, 0xdf, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xbb, 0xdf, 0xbf, 0xbb, 0xdf, 0xdf, 0xbb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbb, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x4e, 0x5b, 0x2a, 0x2a, 0x4f, 0x5b, 0x19, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xbe, 0xc6, 0x00, 0x03, 0x00, 0x44, 0x00, 0x01, 0x00, 0x0a, 0x3a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xc6, 0x18, 0xbe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x4a, 0x03, 0x00, 0x4f, 0x5b, 0x39, 0xbe, 0x32, 0x7c, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x88, 0x19, 0x84, 0x00, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x21, 0x85, 0x00, 0xdc, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x89, 0x19, 0xc6, 0x00, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x5d, 0xef, 0xea, 0x21, 0xc6, 0x00, 0x59, 0xc6, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0x9a, 0xce, 0x7a, 0xc6, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xdb, 0xd6, 0x9a, 0xce, 0xdb, 0xd6, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xfc, 0xde, 0xa9, 0x19, 0xe7, 0x00, 0x9a, 0xc6, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0xdb, 0xd6, 0xfc, 0xde, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x5d, 0xe7, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x4a, 0x68, 0x11, 0x07, 0x01, 0xe6, 0x00, 0x89, 0x11, 0x68, 0x11, 0xb7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xce, 0x2e, 0x53, 0x47, 0x09, 0x44, 0x00, 0x23, 0x00, 0xe6, 0x00, 0x6c, 0x32, 0x56, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x52, 0x7c, 0xa9, 0x19, 0xa5, 0x00, 0x44, 0x00, 0xc5, 0x00, 0x0a, 0x2a, 0xd4, 0x94, 0xdf, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0xc9, 0x21, 0x68, 0x09, 0xe7, 0x00, 0xe6, 0x00, 0x68, 0x09, 0x68, 0x11, 0x18, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xa5, 0xac, 0x42, 0x27, 0x09, 0xa5, 0x00, 0xc6, 0x00, 0xc9, 0x21, 0x11, 0x74, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xce, 0x68, 0x19, 0x8c, 0x42, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xed, 0x4a, 0x67, 0x19, 0x59, 0xc6, 0x35, 0x9d, 0x27, 0x09, 0x56, 0xa5, 0xf8, 0xbd, 0x67, 0x11, 0x2e, 0x53, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x6b, 0x32, 0xea, 0x29, 0xdb, 0xde, 0xff, 0xff, 0xbf, 0xf7, 0x15, 0x95, 0x8c, 0x3a, 0x68, 0x11, 0x48, 0x09, 0x89, 0x19, 0x4f, 0x5b, 0x39, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x2a, 0x64, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xa6, 0x00, 0x24, 0x00, 0x15, 0x9d, 0xff, 0xff, 0xb7, 0xb5, 0xe6, 0x00, 0x03, 0x00, 0xc6, 0x00, 0xea, 0x21, 0x0a, 0x2a, 0x27, 0x09, 0x03, 0x00, 0x44, 0x00, 0x73, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x0a, 0x2a, 0x03, 0x00, 0x44, 0x00, 0x88, 0x11, 0xea, 0x21, 0x47, 0x09, 0x24, 0x00, 0x23, 0x00, 0x2e, 0x53, 0xff, 0xff, 0x1c, 0xe7, 0x27, 0x09, 0xc6, 0x00, 0xe7, 0x00, 0xc8, 0x00, 0xe6, 0x00, 0xa5, 0x00, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x7c, 0x44, 0x00, 0x03, 0x00, 0xc6, 0x00, 0x88, 0x19, 0x48, 0x09, 0x44, 0x00, 0x03, 0x00, 0xa9, 0x21, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x68, 0x11, 0x03, 0x00, 0x96, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb5, 0x23, 0x00, 0x06, 0x09, 0x9e, 0xef, 0x52, 0x7c, 0x01, 0x00, 0x73, 0x84, 0x7e, 0xef, 0xa5, 0x00, 0x65, 0x00, 0xbb, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x94, 0x02, 0x00, 0xc9, 0x21, 0xff, 0xff, 0x9e, 0xf7, 0x8c, 0x3a, 0x23, 0x00, 0x23, 0x00, 0xa5, 0x00, 0xe6, 0x00, 0x65, 0x00, 0x03, 0x00, 0x85, 0x00, 0xd4, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xbb, 0xd6, 0xc9, 0x19, 0xc6, 0x00, 0xb7, 0xb5, 0x1c, 0xdf, 0xff, 0xff, 0xbb, 0xce, 0x27, 0x09, 0x23, 0x00, 0x2f, 0x5b, 0xdb, 0xd6, 0xdf, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0x53, 0x7c, 0xa6, 0x00, 0x44, 0x00, 0xf4, 0x94, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x2a, 0x32, 0x03, 0x00, 0xea, 0x29, 0x18, 0xbe, 0x9e, 0xf7, 0xdf, 0xff, 0x7d, 0xef, 0x35, 0x9d, 0x27, 0x09, 0x23, 0x00, 0xb0, 0x63, 0xff, 0xff, 0x5d, 0xef, 0xbb, 0xce, 0xa9, 0x11, 0x07, 0x01, 0x39, 0xc6, 0x3d, 0xe7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x84, 0x24, 0x00, 0xa6, 0x00, 0x52, 0x7c, 0x1c, 0xe7, 0x9e, 0xf7, 0x7e, 0xef, 0x18, 0xb6, 0x2a, 0x2a, 0x03, 0x00, 0x0a, 0x2a, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x7c, 0x03, 0x00, 0xac, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x53, 0x03, 0x00, 0x11, 0x74, 0xff, 0xff, 0x32, 0x7c, 0x02, 0x00, 0x73, 0x84, 0xff, 0xff, 0x2e, 0x53, 0x03, 0x00, 0x32, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x3a, 0x03, 0x00, 0x93, 0x94, 0xff, 0xff, 0xac, 0x42, 0x03, 0x00, 0x88, 0x11, 0x56, 0x9d, 0x1c, 0xdf, 0x3d, 0xe7, 0x9a, 0xce, 0xd0, 0x6b, 0x64, 0x00, 0x65, 0x00, 0xf4, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x21, 0xa5, 0x00, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xed, 0x4a, 0x03, 0x00, 0xed, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x8c, 0x44, 0x00, 0x68, 0x19, 0x9e, 0xef, 0xff, 0xff, 0xd4, 0x94, 0x03, 0x00, 0xc9, 0x19, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb5, 0xc6, 0x00, 0x64, 0x00, 0x39, 0xc6, 0xff, 0xff, 0xdf, 0xff, 0xa9, 0x19, 0xe6, 0x00, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x06, 0x01, 0x65, 0x00, 0xf4, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0xea, 0x21, 0x03, 0x00, 0x52, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0xa6, 0x00, 0xc6, 0x00, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0x06, 0x01, 0xa6, 0x00, 0xbb, 0xd6, 0xff, 0xff, 0x32, 0x7c, 0x02, 0x00, 0x73, 0x84, 0xff, 0xff, 0xb6, 0xb5, 0x24, 0x00, 0x68, 0x11, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xce, 0xa6, 0x00, 0x07, 0x09, 0x7e, 0xef, 0x35, 0x9d, 0x03, 0x00, 0x68, 0x11, 0x9a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x84, 0x44, 0x00, 0x27, 0x09, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x19, 0x85, 0x00, 0xbb, 0xd6, 0xff, 0xff, 0x1c, 0xdf, 0xc6, 0x00, 0x27, 0x09, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x2a, 0x24, 0x00, 0xb8, 0xb5, 0xff, 0xff, 0x8c, 0x3a, 0x23, 0x00, 0x36, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x6c, 0x03, 0x00, 0xb0, 0x6b, 0xff, 0xff, 0x9e, 0xf7, 0x89, 0x11, 0xc6, 0x00, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x94, 0x03, 0x00, 0x2f, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xbe, 0x85, 0x00, 0xa9, 0x21, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x42, 0x03, 0x00, 0x93, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x8c, 0x03, 0x00, 0xad, 0x42, 0xff, 0xff, 0xff, 0xff, 0x32, 0x7c, 0x02, 0x00, 0x73, 0x84, 0xff, 0xff, 0xbf, 0xf7, 0x0a, 0x2a, 0x23, 0x00, 0x56, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6b, 0x03, 0x00, 0xb0, 0x63, 0xff, 0xff, 0x2a, 0x32, 0x24, 0x00, 0x97, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x42, 0x03, 0x00, 0xf4, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x19, 0x85, 0x00, 0xbb, 0xd6, 0xff, 0xff, 0xf7, 0xb5, 0x44, 0x00, 0xac, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x74, 0x03, 0x00, 0x93, 0x84, 0xff, 0xff, 0x88, 0x11, 0xa5, 0x00, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb5, 0x24, 0x00, 0x6c, 0x3a, 0xff, 0xff, 0x9e, 0xf7, 0x89, 0x11, 0xc6, 0x00, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x6c, 0x23, 0x00, 0xd1, 0x6b, 0x9a, 0xce, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x59, 0xc6, 0x7a, 0xce, 0xf8, 0xb5, 0x68, 0x09, 0xc6, 0x00, 0x1c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x9d, 0x23, 0x00, 0x0a, 0x2a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b, 0x32, 0x03, 0x00, 0xf5, 0x94, 0xff, 0xff, 0xff, 0xff, 0x32, 0x7c, 0x03, 0x00, 0x73, 0x84, 0xff, 0xff, 0xff, 0xff, 0x93, 0x84, 0x03, 0x00, 0xcd, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0x48, 0x11, 0x44, 0x00, 0x39, 0xc6, 0x7e, 0xef, 0xe6, 0x00, 0x47, 0x09, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x84, 0x03, 0x00, 0x8f, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x19, 0x85, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0x56, 0xa5, 0x23, 0x00, 0x2f, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x84, 0x03, 0x00, 0x52, 0x7c, 0xdf, 0xf7, 0x27, 0x09, 0x07, 0x09, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xc6, 0x24, 0x00, 0x6b, 0x3a, 0xff, 0xff, 0xbe, 0xf7, 0x89, 0x11, 0xe6, 0x00, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x53, 0x65, 0x00, 0xc6, 0x00, 0x64, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x85, 0x00, 0x65, 0x00, 0x85, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0x88, 0x19, 0x24, 0x00, 0xd8, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xbe, 0x65, 0x00, 0x48, 0x11, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x32, 0x7c, 0x02, 0x00, 0x73, 0x84, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xe6, 0x00, 0xe6, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x94, 0x03, 0x00, 0x2b, 0x32, 0xff, 0xff, 0xdb, 0xd6, 0xa5, 0x00, 0x0a, 0x2a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xa5, 0x03, 0x00, 0x2e, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x19, 0x85, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0x56, 0x9d, 0x23, 0x00, 0x2e, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x84, 0x03, 0x00, 0x52, 0x7c, 0xbf, 0xf7, 0x07, 0x09, 0x27, 0x09, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x23, 0x00, 0x8c, 0x3a, 0xff, 0xff, 0x9e, 0xf7, 0x88, 0x11, 0xe6, 0x00, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x53, 0x65, 0x00, 0xeb, 0x19, 0x6c, 0x32, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x0b, 0x2a, 0x0b, 0x2a, 0x2a, 0x32, 0x1c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x7c, 0x03, 0x00, 0x2e, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x63, 0x02, 0x00, 0xf1, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x74, 0x02, 0x00, 0x73, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x42, 0x03, 0x00, 0x93, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x42, 0x03, 0x00, 0xb3, 0x8c, 0xff, 0xff, 0x9a, 0xce, 0x65, 0x00, 0x0a, 0x2a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xa5, 0x03, 0x00, 0x4f, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x19, 0x85, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0x76, 0xa5, 0x23, 0x00, 0xed, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x7c, 0x03, 0x00, 0x73, 0x84, 0xbf, 0xf7, 0x07, 0x09, 0x27, 0x09, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x24, 0x00, 0x8c, 0x3a, 0xff, 0xff, 0xdf, 0xff, 0xa9, 0x19, 0xa5, 0x00, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x53, 0x24, 0x00, 0x56, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0xc5, 0x00, 0x27, 0x09, 0x3d, 0xe7, 0xff, 0xff, 0x5d, 0xef, 0x27, 0x09, 0x85, 0x00, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x74, 0x02, 0x00, 0x93, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xa5, 0x24, 0x00, 0xea, 0x21, 0xdf, 0xff, 0xff, 0xff, 0x9b, 0xce, 0xc6, 0x00, 0xe6, 0x00, 0xfb, 0xde, 0xff, 0xff, 0x9b, 0xce, 0x85, 0x00, 0xea, 0x29, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x9d, 0x03, 0x00, 0x4f, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x21, 0x85, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0x9a, 0xce, 0x65, 0x00, 0xc9, 0x19, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x42, 0x03, 0x00, 0x55, 0xa5, 0x9e, 0xf7, 0x07, 0x09, 0x27, 0x09, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x24, 0x00, 0x8c, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x32, 0x24, 0x00, 0xf8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x7c, 0x02, 0x00, 0x52, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x93, 0x8c, 0xf4, 0x9c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x3a, 0x23, 0x00, 0x15, 0x95, 0xff, 0xff, 0xd4, 0x94, 0x03, 0x00, 0x8c, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x74, 0x03, 0x00, 0x93, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xa9, 0x19, 0x44, 0x00, 0xf8, 0xbd, 0xff, 0xff, 0xb0, 0x6b, 0x03, 0x00, 0x0d, 0x53, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0xe6, 0x00, 0x47, 0x09, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x7c, 0x03, 0x00, 0x4f, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x19, 0x85, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0xdf, 0xff, 0xe9, 0x21, 0x44, 0x00, 0x35, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xce, 0xe6, 0x00, 0xa5, 0x00, 0x1c, 0xdf, 0x9e, 0xf7, 0x07, 0x09, 0x27, 0x09, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x23, 0x00, 0x8c, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x6b, 0x03, 0x00, 0xb0, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xad, 0x23, 0x00, 0x0a, 0x2a, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x84, 0x01, 0x00, 0x2a, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x94, 0x03, 0x00, 0xac, 0x42, 0xff, 0xff, 0x8c, 0x3a, 0x03, 0x00, 0xb4, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x74, 0x02, 0x00, 0x93, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x74, 0x03, 0x00, 0xb0, 0x63, 0xdf, 0xff, 0xa9, 0x19, 0x24, 0x00, 0xb7, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b, 0x3a, 0x23, 0x00, 0x56, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x2b, 0x32, 0x24, 0x00, 0x6f, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x21, 0x85, 0x00, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x35, 0x9d, 0x24, 0x00, 0xc6, 0x00, 0xb7, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xce, 0xea, 0x21, 0x03, 0x00, 0x6f, 0x63, 0xff, 0xff, 0x5d, 0xef, 0x06, 0x09, 0x27, 0x09, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0x24, 0x00, 0x8c, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0xc6, 0x00, 0x64, 0x00, 0x73, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x32, 0x03, 0x00, 0x2e, 0x53, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x9c, 0xa5, 0x00, 0x24, 0x00, 0x97, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x47, 0x11, 0xc6, 0x00, 0x73, 0x84, 0x07, 0x01, 0x06, 0x01, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x74, 0x02, 0x00, 0x93, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xce, 0x85, 0x00, 0x68, 0x11, 0x52, 0x7c, 0x85, 0x00, 0xe9, 0x21, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x9d, 0x23, 0x00, 0x27, 0x09, 0x19, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xd0, 0x6b, 0x65, 0x00, 0x65, 0x00, 0x90, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x19, 0x85, 0x00, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x63, 0x03, 0x00, 0x85, 0x00, 0x0e, 0x53, 0xd4, 0x8c, 0x56, 0x9d, 0xd1, 0x6b, 0xe6, 0x00, 0x03, 0x00, 0x6b, 0x3a, 0x5d, 0xef, 0xff, 0xff, 0x3d, 0xe7, 0x06, 0x01, 0x27, 0x09, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xc6, 0x24, 0x00, 0x8c, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0x9d, 0x85, 0x00, 0x23, 0x00, 0x8c, 0x42, 0xd4, 0x8c, 0xfc, 0xde, 0x7b, 0xce, 0x48, 0x11, 0x03, 0x00, 0xea, 0x21, 0x93, 0x84, 0xd8, 0xb5, 0x76, 0xa5, 0x4f, 0x5b, 0x64, 0x00, 0x23, 0x00, 0x52, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x74, 0x44, 0x00, 0x68, 0x01, 0x64, 0x00, 0x4f, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x74, 0x02, 0x00, 0x93, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x3a, 0x65, 0x00, 0x68, 0x01, 0x64, 0x00, 0x72, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x63, 0x03, 0x00, 0xe6, 0x00, 0x32, 0x74, 0x19, 0xbe, 0x7a, 0xce, 0x97, 0xad, 0x8c, 0x3a, 0x23, 0x00, 0x07, 0x01, 0xa6, 0x00, 0x68, 0x11, 0xf5, 0x94, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x47, 0x11, 0x23, 0x00, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x8c, 0x68, 0x11, 0x23, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xe6, 0x00, 0xd1, 0x6b, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xa5, 0x00, 0xc5, 0x00, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbd, 0x02, 0x00, 0x2b, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xad, 0xea, 0x21, 0x23, 0x00, 0x01, 0x00, 0xcd, 0x4a, 0xff, 0xff, 0xdb, 0xd6, 0xac, 0x42, 0x44, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x68, 0x11, 0xf4, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xce, 0xa5, 0x00, 0x24, 0x00, 0x64, 0x00, 0x19, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x63, 0x00, 0x00, 0x52, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x94, 0x24, 0x00, 0x24, 0x00, 0xc5, 0x00, 0x9a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf1, 0x73, 0xa5, 0x00, 0x03, 0x00, 0x24, 0x00, 0x24, 0x00, 0x03, 0x00, 0x23, 0x00, 0xea, 0x29, 0x39, 0xbe, 0xb0, 0x63, 0x02, 0x00, 0x02, 0x00, 0x7a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9c, 0x72, 0x84, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xf8, 0xb5, 0xb4, 0x8c, 0x93, 0x8c, 0x76, 0xa5, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x15, 0x9d, 0x35, 0x9d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xef, 0x73, 0x84, 0xb7, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xf8, 0xb5, 0x32, 0x74, 0x35, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xc6, 0xb4, 0x8c, 0xb0, 0x63, 0xf1, 0x73, 0x76, 0xa5, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0x9d, 0xed, 0x52, 0x56, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xbd, 0x4f, 0x5b, 0x19, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x32, 0x7c, 0xcc, 0x4a, 0x76, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0xb3, 0x8c, 0x0e, 0x53, 0xad, 0x42, 0x6f, 0x5b, 0x56, 0x9d, 0x9e, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0x74, 0x84, 0x2e, 0x5b, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x7d, 0xdf, 0x1c, 0xcf, 0xfb, 0xce, 0xdb, 0xce, 0xdb, 0xbe, 0x1c, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xe7, 0x9a, 0xb6, 0x18, 0x96, 0x1c, 0xc7, 0x9e, 0xef, 0xbe, 0xef, 0x5d, 0xd7, 0x59, 0xb6, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xcf, 0x5d, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xdf, 0x7a, 0xae, 0x5d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xdf, 0x18, 0x96, 0x5d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xcf, 0x3d, 0xd7, 0xdf, 0xef, 0x9e, 0xe7, 0x5d, 0xd7, 0xbe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x59, 0x9e, 0x9a, 0xae, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xef, 0xdb, 0xae, 0x39, 0x9e, 0xfc, 0xce, 0xdb, 0xce, 0x3d, 0xcf, 0x5d, 0xcf, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xd7, 0x9a, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xc7, 0xf8, 0x8d, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xe7, 0xbb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xbf, 0x18, 0x8e, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xe7, 0x9e, 0xe7, 0xbe, 0xef, 0xdf, 0xff, 0xdf, 0xff, 0xbe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x7d, 0xd7, 0xf8, 0x7d, 0xfb, 0xb6, 0x9e, 0xef, 0x3c, 0xd7, 0x1b, 0xc7, 0xff, 0xff, 0x9e, 0xe7, 0x1c, 0xc7, 0xd7, 0x75, 0x3c, 0xc7, 0xff, 0xff, 0x7d, 0xdf, 0xba, 0xbe, 0xff, 0xf7, 0x3c, 0xd7, 0xbb, 0xb6, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xe7, 0x9a, 0xbe, 0x7e, 0xdf, 0x9e, 0xdf, 0x79, 0xae, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x9e, 0xef, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0xef, 0xfb, 0xc6, 0x9e, 0xe7, 0xdf, 0xf7, 0x9e, 0xef, 0xdf, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x9a, 0xb6, 0x5d, 0xd7, 0xff, 0xff, 0x9e, 0xe7, 0xdf, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xbe, 0xef, 0x39, 0x96, 0xfb, 0xae, 0xff, 0xff, 0x7e, 0xdf, 0x3c, 0xcf, 0xff, 0xff, 0x1c, 0xc7, 0x5d, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xc7, 0xdb, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xd7, 0xd7, 0x7d, 0xfb, 0xb6, 0x39, 0x96, 0xdb, 0xae, 0xfb, 0xc6, 0xd7, 0x8d, 0xff, 0xef, 0x3c, 0xd7, 0x1c, 0xdf, 0xff, 0xff, 0x7a, 0x9e, 0xdb, 0xae, 0xdf, 0xe7, 0xbb, 0xa6, 0x1c, 0xc7, 0xbb, 0xa6, 0xbb, 0xa6, 0x1c, 0xc7, 0xdb, 0xa6, 0x7a, 0x8e, 0xff, 0xff, 0x3d, 0xcf, 0x1c, 0xc7, 0xdb, 0xb6, 0xfb, 0xc6, 0xfb, 0xbe, 0xbb, 0x9e, 0xdf, 0xef, 0xdb, 0xce, 0xbe, 0xf7, 0x9e, 0xe7, 0xfb, 0xbe, 0xfc, 0xc6, 0x7a, 0xae, 0x1c, 0xc7, 0x18, 0x9e, 0x9e, 0xd7, 0xfb, 0xce, 0x9e, 0xef, 0xff, 0xff, 0x7a, 0xa6, 0xba, 0xa6, 0xbb, 0xa6, 0xbb, 0xae, 0x1c, 0xcf, 0xf8, 0x8d, 0x7d, 0xd7, 0x9e, 0xe7, 0x9a, 0xae, 0xfc, 0xbe, 0xdb, 0xb6, 0x5a, 0x8e, 0xdb, 0xae, 0xba, 0xae, 0x79, 0xa6, 0x3d, 0xcf, 0xf8, 0x95, 0x7d, 0xdf, 0xdf, 0xe7, 0x39, 0x96, 0x5a, 0xa6, 0x1c, 0xbf, 0x5a, 0x8e, 0xbb, 0xae, 0xdb, 0xbe, 0x18, 0x9e, 0xff, 0xff, 0x59, 0x96, 0x5a, 0x8e, 0xbe, 0xdf, 0xdb, 0xbe, 0xfc, 0xbe, 0x79, 0xa6, 0x1c, 0xc7, 0x7a, 0xa6, 0xdb, 0xae, 0xff, 0xf7, 0xdb, 0xce, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb6, 0x39, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5d, 0xd7, 0xd7, 0x7d, 0xd7, 0x7d, 0xbe, 0xe7, 0x19, 0x8e, 0x7a, 0x9e, 0x7e, 0xdf, 0x18, 0x8e, 0x1c, 0xb7, 0xdb, 0xce, 0xdf, 0xff, 0xff, 0xff, 0x39, 0x8e, 0x3c, 0xbf, 0xfb, 0xbe, 0xf8, 0x7d, 0xdf, 0xdf, 0xfb, 0xb6, 0xf8, 0x75, 0xdb, 0xb6, 0x18, 0x8e, 0x7a, 0x8e, 0x3c, 0xc7, 0x97, 0x75, 0x5d, 0xc7, 0x1c, 0xc7, 0x3d, 0xcf, 0xdf, 0xd7, 0xf8, 0x7d, 0x79, 0xae, 0x7d, 0xe7, 0xff, 0xff, 0x9a, 0xae, 0xdb, 0x9e, 0x3c, 0xcf, 0x3c, 0xc7, 0xdf, 0xdf, 0xf8, 0x85, 0x59, 0x96, 0x5d, 0xdf, 0xff, 0xff, 0x7e, 0xdf, 0x76, 0x75, 0x3d, 0xc7, 0xdb, 0xa6, 0xf7, 0x8d, 0x5d, 0xdf, 0x59, 0x8e, 0xfc, 0xb6, 0xf8, 0x85, 0xdb, 0xae, 0x9e, 0xd7, 0xbb, 0xa6, 0xb7, 0x6d, 0x3d, 0xc7, 0xdb, 0xa6, 0xf8, 0x8d, 0x5d, 0xd7, 0x39, 0x86, 0x1c, 0xbf, 0xf8, 0x85, 0x7a, 0x86, 0x9e, 0xd7, 0x9a, 0x9e, 0x56, 0x55, 0x1c, 0xc7, 0x3c, 0xc7, 0x39, 0x86, 0x1c, 0xc7, 0x97, 0x75, 0x5d, 0xb7, 0x1c, 0xc7, 0x96, 0x75, 0xbf, 0xd7, 0xfb, 0xc6, 0x5d, 0xcf, 0x9e, 0xcf, 0x18, 0x86, 0x9a, 0xb6, 0x7d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xdf, 0x97, 0x65, 0xbb, 0x8e, 0x5d, 0xc7, 0x1c, 0xb7, 0x79, 0xae, 0x3c, 0xd7, 0x7d, 0xd7, 0xbf, 0xef, 0xff, 0xff, 0x7d, 0xdf, 0xdf, 0xf7, 0xff, 0xff, 0x3d, 0xd7, 0x7d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xc7, 0xdb, 0xbe, 0x9e, 0xe7, 0xdb, 0xae, 0x59, 0xa6, 0x7d, 0xe7, 0x3c, 0xcf, 0x3d, 0xcf, 0xbf, 0xe7, 0xba, 0xb6, 0x7d, 0xd7, 0x1c, 0xc7, 0x18, 0x9e, 0x3d, 0xd7, 0x3c, 0xd7, 0x9a, 0xb6, 0xfc, 0xb6, 0x9e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xdf, 0x19, 0x96, 0x3c, 0xcf, 0x7d, 0xdf, 0xbb, 0xbe, 0xfc, 0xbe, 0x9e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xe7, 0x7e, 0xdf, 0xff, 0xff, 0x7d, 0xdf, 0x9e, 0xe7, 0xff, 0xff, 0x5d, 0xd7, 0x5d, 0xd7, 0x5d, 0xc7, 0xf8, 0x8d, 0xfc, 0xc6, 0x7d, 0xdf, 0x7d, 0xdf, 0xff, 0xff, 0x7d, 0xdf, 0x9e, 0xe7, 0xff, 0xff, 0x3d, 0xcf, 0x5d, 0xd7, 0x1c, 0xbf, 0x18, 0x8e, 0xfc, 0xc6, 0x3d, 0xd7, 0x3d, 0xcf, 0xff, 0xff, 0xbe, 0xef, 0x9a, 0xb6, 0x7d, 0xdf, 0x1c, 0xc7, 0x9a, 0xb6, 0x5d, 0xd7, 0xbb, 0xa6, 0x39, 0x9e, 0x3c, 0xd7, 0xbb, 0xce, 0x79, 0xa6, 0xdb, 0xb6, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xd7, 0x5a, 0x96, 0x39, 0x9e, 0xdb, 0xbe, 0xbe, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x5a, 0x5b, 0x4e, 0x2a, 0x2a, 0x5b, 0x4f, 0xbe, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x39, 0x00, 0xc6, 0x00, 0x03, 0x00, 0x44, 0x00, 0x01, 0x3a, 0x0a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x59, 0xbe, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xed, 0x00, 0x03, 0x5b, 0x4f, 0xbe, 0x39, 0x7c, 0x32, 0xc6, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0x19, 0x88, 0x00, 0x84, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xe9, 0x00, 0x85, 0xd6, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x19, 0x89, 0x00, 0xc6, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xef, 0x5d, 0x21, 0xea, 0x00, 0xc6, 0xc6, 0x59, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0xce, 0x9a, 0xc6, 0x7a, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xd6, 0xdb, 0xce, 0x9a, 0xd6, 0xdb, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xde, 0xfc, 0x19, 0xa9, 0x00, 0xe7, 0xc6, 0x9a, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0xd6, 0xdb, 0xde, 0xfc, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xe7, 0x5d, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xed, 0x11, 0x68, 0x01, 0x07, 0x00, 0xe6, 0x11, 0x89, 0x11, 0x68, 0xb5, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xce, 0x9a, 0x53, 0x2e, 0x09, 0x47, 0x00, 0x44, 0x00, 0x23, 0x00, 0xe6, 0x32, 0x6c, 0x9d, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x7c, 0x52, 0x19, 0xa9, 0x00, 0xa5, 0x00, 0x44, 0x00, 0xc5, 0x2a, 0x0a, 0x94, 0xd4, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0x1c, 0x21, 0xc9, 0x09, 0x68, 0x00, 0xe7, 0x00, 0xe6, 0x09, 0x68, 0x11, 0x68, 0xbe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x76, 0x42, 0xac, 0x09, 0x27, 0x00, 0xa5, 0x00, 0xc6, 0x21, 0xc9, 0x74, 0x11, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x5a, 0x19, 0x68, 0x42, 0x8c, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0x4a, 0xed, 0x19, 0x67, 0xc6, 0x59, 0x9d, 0x35, 0x09, 0x27, 0xa5, 0x56, 0xbd, 0xf8, 0x11, 0x67, 0x53, 0x2e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x32, 0x6b, 0x29, 0xea, 0xde, 0xdb, 0xff, 0xff, 0xf7, 0xbf, 0x95, 0x15, 0x3a, 0x8c, 0x11, 0x68, 0x09, 0x48, 0x19, 0x89, 0x5b, 0x4f, 0xc6, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x0a, 0x00, 0x64, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xa6, 0x00, 0x24, 0x9d, 0x15, 0xff, 0xff, 0xb5, 0xb7, 0x00, 0xe6, 0x00, 0x03, 0x00, 0xc6, 0x21, 0xea, 0x2a, 0x0a, 0x09, 0x27, 0x00, 0x03, 0x00, 0x44, 0x84, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x2a, 0x0a, 0x00, 0x03, 0x00, 0x44, 0x11, 0x88, 0x21, 0xea, 0x09, 0x47, 0x00, 0x24, 0x00, 0x23, 0x53, 0x2e, 0xff, 0xff, 0xe7, 0x1c, 0x09, 0x27, 0x00, 0xc6, 0x00, 0xe7, 0x00, 0xc8, 0x00, 0xe6, 0x00, 0xa5, 0xbd, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x52, 0x00, 0x44, 0x00, 0x03, 0x00, 0xc6, 0x19, 0x88, 0x09, 0x48, 0x00, 0x44, 0x00, 0x03, 0x21, 0xa9, 0xd6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0x11, 0x68, 0x00, 0x03, 0xa5, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xf8, 0x00, 0x23, 0x09, 0x06, 0xef, 0x9e, 0x7c, 0x52, 0x00, 0x01, 0x84, 0x73, 0xef, 0x7e, 0x00, 0xa5, 0x00, 0x65, 0xce, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xf4, 0x00, 0x02, 0x21, 0xc9, 0xff, 0xff, 0xf7, 0x9e, 0x3a, 0x8c, 0x00, 0x23, 0x00, 0x23, 0x00, 0xa5, 0x00, 0xe6, 0x00, 0x65, 0x00, 0x03, 0x00, 0x85, 0x94, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0xd6, 0xbb, 0x19, 0xc9, 0x00, 0xc6, 0xb5, 0xb7, 0xdf, 0x1c, 0xff, 0xff, 0xce, 0xbb, 0x09, 0x27, 0x00, 0x23, 0x5b, 0x2f, 0xd6, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x3d, 0x7c, 0x53, 0x00, 0xa6, 0x00, 0x44, 0x94, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0x32, 0x2a, 0x00, 0x03, 0x29, 0xea, 0xbe, 0x18, 0xf7, 0x9e, 0xff, 0xdf, 0xef, 0x7d, 0x9d, 0x35, 0x09, 0x27, 0x00, 0x23, 0x63, 0xb0, 0xff, 0xff, 0xef, 0x5d, 0xce, 0xbb, 0x11, 0xa9, 0x01, 0x07, 0xc6, 0x39, 0xe7, 0x3d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x84, 0x93, 0x00, 0x24, 0x00, 0xa6, 0x7c, 0x52, 0xe7, 0x1c, 0xf7, 0x9e, 0xef, 0x7e, 0xb6, 0x18, 0x2a, 0x2a, 0x00, 0x03, 0x2a, 0x0a, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x73, 0x00, 0x03, 0x42, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x2e, 0x00, 0x03, 0x74, 0x11, 0xff, 0xff, 0x7c, 0x32, 0x00, 0x02, 0x84, 0x73, 0xff, 0xff, 0x53, 0x2e, 0x00, 0x03, 0x7c, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x8c, 0x00, 0x03, 0x94, 0x93, 0xff, 0xff, 0x42, 0xac, 0x00, 0x03, 0x11, 0x88, 0x9d, 0x56, 0xdf, 0x1c, 0xe7, 0x3d, 0xce, 0x9a, 0x6b, 0xd0, 0x00, 0x64, 0x00, 0x65, 0x94, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xc9, 0x00, 0xa5, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xed, 0x00, 0x03, 0x4a, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xb4, 0x00, 0x44, 0x19, 0x68, 0xef, 0x9e, 0xff, 0xff, 0x94, 0xd4, 0x00, 0x03, 0x19, 0xc9, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xf8, 0x00, 0xc6, 0x00, 0x64, 0xc6, 0x39, 0xff, 0xff, 0xff, 0xdf, 0x19, 0xa9, 0x00, 0xe6, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfc, 0x01, 0x06, 0x00, 0x65, 0x9c, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5d, 0x21, 0xea, 0x00, 0x03, 0x7c, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xdb, 0x00, 0xa6, 0x00, 0xc6, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1c, 0x01, 0x06, 0x00, 0xa6, 0xd6, 0xbb, 0xff, 0xff, 0x7c, 0x32, 0x00, 0x02, 0x84, 0x73, 0xff, 0xff, 0xb5, 0xb6, 0x00, 0x24, 0x11, 0x68, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x9a, 0x00, 0xa6, 0x09, 0x07, 0xef, 0x7e, 0x9d, 0x35, 0x00, 0x03, 0x11, 0x68, 0xce, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x73, 0x00, 0x44, 0x09, 0x27, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xa9, 0x00, 0x85, 0xd6, 0xbb, 0xff, 0xff, 0xdf, 0x1c, 0x00, 0xc6, 0x09, 0x27, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x0a, 0x00, 0x24, 0xb5, 0xb8, 0xff, 0xff, 0x3a, 0x8c, 0x00, 0x23, 0x9d, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x11, 0x00, 0x03, 0x6b, 0xb0, 0xff, 0xff, 0xf7, 0x9e, 0x11, 0x89, 0x00, 0xc6, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xf5, 0x00, 0x03, 0x53, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x5a, 0x00, 0x85, 0x21, 0xa9, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0xcd, 0x00, 0x03, 0x8c, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xb4, 0x00, 0x03, 0x42, 0xad, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x32, 0x00, 0x02, 0x84, 0x73, 0xff, 0xff, 0xf7, 0xbf, 0x2a, 0x0a, 0x00, 0x23, 0xa5, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0xf0, 0x00, 0x03, 0x63, 0xb0, 0xff, 0xff, 0x32, 0x2a, 0x00, 0x24, 0xa5, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0xad, 0x00, 0x03, 0x94, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xa9, 0x00, 0x85, 0xd6, 0xbb, 0xff, 0xff, 0xb5, 0xf7, 0x00, 0x44, 0x3a, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x11, 0x00, 0x03, 0x84, 0x93, 0xff, 0xff, 0x11, 0x88, 0x00, 0xa5, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xf8, 0x00, 0x24, 0x3a, 0x6c, 0xff, 0xff, 0xf7, 0x9e, 0x11, 0x89, 0x00, 0xc6, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x11, 0x00, 0x23, 0x6b, 0xd1, 0xce, 0x9a, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x59, 0xce, 0x7a, 0xb5, 0xf8, 0x09, 0x68, 0x00, 0xc6, 0xdf, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x56, 0x00, 0x23, 0x2a, 0x0a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x4b, 0x00, 0x03, 0x94, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x32, 0x00, 0x03, 0x84, 0x73, 0xff, 0xff, 0xff, 0xff, 0x84, 0x93, 0x00, 0x03, 0x4a, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5d, 0x11, 0x48, 0x00, 0x44, 0xc6, 0x39, 0xef, 0x7e, 0x00, 0xe6, 0x09, 0x47, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x93, 0x00, 0x03, 0x63, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xa9, 0x00, 0x85, 0xd6, 0xdb, 0xff, 0xff, 0xa5, 0x56, 0x00, 0x23, 0x53, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x93, 0x00, 0x03, 0x7c, 0x52, 0xf7, 0xdf, 0x09, 0x27, 0x09, 0x07, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x7a, 0x00, 0x24, 0x3a, 0x6b, 0xff, 0xff, 0xf7, 0xbe, 0x11, 0x89, 0x00, 0xe6, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x4f, 0x00, 0x65, 0x00, 0xc6, 0x00, 0x64, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x85, 0x00, 0x65, 0x00, 0x85, 0xd6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9e, 0x19, 0x88, 0x00, 0x24, 0xb5, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x19, 0x00, 0x65, 0x11, 0x48, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x32, 0x00, 0x02, 0x84, 0x73, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfc, 0x00, 0xe6, 0x00, 0xe6, 0xd6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xf4, 0x00, 0x03, 0x32, 0x2b, 0xff, 0xff, 0xd6, 0xdb, 0x00, 0xa5, 0x2a, 0x0a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x75, 0x00, 0x03, 0x5b, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xa9, 0x00, 0x85, 0xd6, 0xdb, 0xff, 0xff, 0x9d, 0x56, 0x00, 0x23, 0x53, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x93, 0x00, 0x03, 0x7c, 0x52, 0xf7, 0xbf, 0x09, 0x07, 0x09, 0x27, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x5a, 0x00, 0x23, 0x3a, 0x8c, 0xff, 0xff, 0xf7, 0x9e, 0x11, 0x88, 0x00, 0xe6, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x2e, 0x00, 0x65, 0x19, 0xeb, 0x32, 0x6c, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x0b, 0x2a, 0x0b, 0x32, 0x2a, 0xdf, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x32, 0x00, 0x03, 0x53, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x8f, 0x00, 0x02, 0x73, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x32, 0x00, 0x02, 0x84, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0xac, 0x00, 0x03, 0x84, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0xac, 0x00, 0x03, 0x8c, 0xb3, 0xff, 0xff, 0xce, 0x9a, 0x00, 0x65, 0x2a, 0x0a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x76, 0x00, 0x03, 0x5b, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xa9, 0x00, 0x85, 0xd6, 0xdb, 0xff, 0xff, 0xa5, 0x76, 0x00, 0x23, 0x42, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x52, 0x00, 0x03, 0x84, 0x73, 0xf7, 0xbf, 0x09, 0x07, 0x09, 0x27, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x5a, 0x00, 0x24, 0x3a, 0x8c, 0xff, 0xff, 0xff, 0xdf, 0x19, 0xa9, 0x00, 0xa5, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x4f, 0x00, 0x24, 0x9d, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbb, 0x00, 0xc5, 0x09, 0x27, 0xe7, 0x3d, 0xff, 0xff, 0xef, 0x5d, 0x09, 0x27, 0x00, 0x85, 0xce, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x32, 0x00, 0x02, 0x8c, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x96, 0x00, 0x24, 0x21, 0xea, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x9b, 0x00, 0xc6, 0x00, 0xe6, 0xde, 0xfb, 0xff, 0xff, 0xce, 0x9b, 0x00, 0x85, 0x29, 0xea, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x56, 0x00, 0x03, 0x5b, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xa9, 0x00, 0x85, 0xd6, 0xdb, 0xff, 0xff, 0xce, 0x9a, 0x00, 0x65, 0x19, 0xc9, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0xac, 0x00, 0x03, 0xa5, 0x55, 0xf7, 0x9e, 0x09, 0x07, 0x09, 0x27, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x5a, 0x00, 0x24, 0x3a, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x32, 0x2b, 0x00, 0x24, 0xbd, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x32, 0x00, 0x02, 0x7c, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x8c, 0x93, 0x9c, 0xf4, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x8b, 0x00, 0x23, 0x95, 0x15, 0xff, 0xff, 0x94, 0xd4, 0x00, 0x03, 0x3a, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x32, 0x00, 0x03, 0x8c, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0x19, 0xa9, 0x00, 0x44, 0xbd, 0xf8, 0xff, 0xff, 0x6b, 0xb0, 0x00, 0x03, 0x53, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1c, 0x00, 0xe6, 0x09, 0x47, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x52, 0x00, 0x03, 0x5b, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xa9, 0x00, 0x85, 0xd6, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0x21, 0xe9, 0x00, 0x44, 0x9d, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x9a, 0x00, 0xe6, 0x00, 0xa5, 0xdf, 0x1c, 0xf7, 0x9e, 0x09, 0x07, 0x09, 0x27, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x5a, 0x00, 0x23, 0x3a, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x6b, 0xb0, 0x00, 0x03, 0x63, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x96, 0x00, 0x23, 0x2a, 0x0a, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x73, 0x00, 0x01, 0x32, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xf4, 0x00, 0x03, 0x42, 0xac, 0xff, 0xff, 0x3a, 0x8c, 0x00, 0x03, 0x8c, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x32, 0x00, 0x02, 0x8c, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x11, 0x00, 0x03, 0x63, 0xb0, 0xff, 0xdf, 0x19, 0xa9, 0x00, 0x24, 0xad, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x4b, 0x00, 0x23, 0x9d, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x32, 0x2b, 0x00, 0x24, 0x6b, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xa9, 0x00, 0x85, 0xd6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x35, 0x00, 0x24, 0x00, 0xc6, 0xad, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x9b, 0x21, 0xea, 0x00, 0x03, 0x63, 0x6f, 0xff, 0xff, 0xef, 0x5d, 0x09, 0x06, 0x09, 0x27, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x5a, 0x00, 0x24, 0x3a, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbb, 0x00, 0xc6, 0x00, 0x64, 0x84, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x2b, 0x00, 0x03, 0x53, 0x2e, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf5, 0x00, 0xa5, 0x00, 0x24, 0xb5, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x11, 0x47, 0x00, 0xc6, 0x84, 0x73, 0x01, 0x07, 0x01, 0x06, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x12, 0x00, 0x02, 0x8c, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7a, 0x00, 0x85, 0x11, 0x68, 0x7c, 0x52, 0x00, 0x85, 0x21, 0xe9, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x36, 0x00, 0x23, 0x09, 0x27, 0xbe, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x6b, 0xd0, 0x00, 0x65, 0x00, 0x65, 0x63, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xa9, 0x00, 0x85, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xb0, 0x00, 0x03, 0x00, 0x85, 0x53, 0x0e, 0x8c, 0xd4, 0x9d, 0x56, 0x6b, 0xd1, 0x00, 0xe6, 0x00, 0x03, 0x3a, 0x6b, 0xef, 0x5d, 0xff, 0xff, 0xe7, 0x3d, 0x01, 0x06, 0x09, 0x27, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x59, 0x00, 0x24, 0x3a, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x35, 0x00, 0x85, 0x00, 0x23, 0x42, 0x8c, 0x8c, 0xd4, 0xde, 0xfc, 0xce, 0x7b, 0x11, 0x48, 0x00, 0x03, 0x21, 0xea, 0x84, 0x93, 0xb5, 0xd8, 0xa5, 0x76, 0x5b, 0x4f, 0x00, 0x64, 0x00, 0x23, 0x7c, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x11, 0x00, 0x44, 0x01, 0x68, 0x00, 0x64, 0x5b, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x12, 0x00, 0x02, 0x8c, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x6b, 0x00, 0x65, 0x01, 0x68, 0x00, 0x64, 0x7c, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x8f, 0x00, 0x03, 0x00, 0xe6, 0x74, 0x32, 0xbe, 0x19, 0xce, 0x7a, 0xad, 0x97, 0x3a, 0x8c, 0x00, 0x23, 0x01, 0x07, 0x00, 0xa6, 0x11, 0x68, 0x94, 0xf5, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x11, 0x47, 0x00, 0x23, 0xd6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xb4, 0x11, 0x68, 0x00, 0x23, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xe6, 0x6b, 0xd1, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0xa5, 0x00, 0xc5, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf8, 0x00, 0x02, 0x32, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x97, 0x21, 0xea, 0x00, 0x23, 0x00, 0x01, 0x4a, 0xcd, 0xff, 0xff, 0xd6, 0xdb, 0x42, 0xac, 0x00, 0x44, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x11, 0x68, 0x94, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7a, 0x00, 0xa5, 0x00, 0x24, 0x00, 0x64, 0xbe, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xb0, 0x00, 0x00, 0x84, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xf5, 0x00, 0x24, 0x00, 0x24, 0x00, 0xc5, 0xce, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x73, 0xf1, 0x00, 0xa5, 0x00, 0x03, 0x00, 0x24, 0x00, 0x24, 0x00, 0x03, 0x00, 0x23, 0x29, 0xea, 0xbe, 0x39, 0x63, 0xb0, 0x00, 0x02, 0x00, 0x02, 0xd6, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf4, 0x84, 0x72, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xb5, 0xf8, 0x8c, 0xb4, 0x8c, 0x93, 0xa5, 0x76, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9d, 0x15, 0x9d, 0x35, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5c, 0x84, 0x73, 0xb5, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xb5, 0xf8, 0x74, 0x32, 0x9d, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x5a, 0x8c, 0xb4, 0x63, 0xb0, 0x73, 0xf1, 0xa5, 0x76, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x35, 0x52, 0xed, 0xa5, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd8, 0x5b, 0x4f, 0xc6, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7c, 0x32, 0x4a, 0xcc, 0xa5, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbb, 0x8c, 0xb3, 0x53, 0x0e, 0x42, 0xad, 0x5b, 0x6f, 0x9d, 0x56, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xdf, 0x84, 0x74, 0x5b, 0x2e, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xdf, 0x7d, 0xcf, 0x1c, 0xce, 0xfb, 0xce, 0xdb, 0xbe, 0xdb, 0xcf, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9d, 0xb6, 0x9a, 0x96, 0x18, 0xc7, 0x1c, 0xef, 0x9e, 0xef, 0xbe, 0xd7, 0x5d, 0xb6, 0x59, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x3c, 0xcf, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7d, 0xae, 0x7a, 0xdf, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x5d, 0x96, 0x18, 0xdf, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x1c, 0xd7, 0x3d, 0xef, 0xdf, 0xe7, 0x9e, 0xd7, 0x5d, 0xef, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9e, 0x59, 0xae, 0x9a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbe, 0xae, 0xdb, 0x9e, 0x39, 0xce, 0xfc, 0xce, 0xdb, 0xcf, 0x3d, 0xcf, 0x5d, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x5d, 0xbe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x3c, 0x8d, 0xf8, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9e, 0xbe, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x1c, 0x8e, 0x18, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9e, 0xe7, 0x9e, 0xef, 0xbe, 0xff, 0xdf, 0xff, 0xdf, 0xef, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd7, 0x7d, 0x7d, 0xf8, 0xb6, 0xfb, 0xef, 0x9e, 0xd7, 0x3c, 0xc7, 0x1b, 0xff, 0xff, 0xe7, 0x9e, 0xc7, 0x1c, 0x75, 0xd7, 0xc7, 0x3c, 0xff, 0xff, 0xdf, 0x7d, 0xbe, 0xba, 0xf7, 0xff, 0xd7, 0x3c, 0xb6, 0xbb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9e, 0xbe, 0x9a, 0xdf, 0x7e, 0xdf, 0x9e, 0xae, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xdf, 0xef, 0x9e, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xbe, 0xc6, 0xfb, 0xe7, 0x9e, 0xf7, 0xdf, 0xef, 0x9e, 0xff, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xb6, 0x9a, 0xd7, 0x5d, 0xff, 0xff, 0xe7, 0x9e, 0xff, 0xdf, 0xef, 0xbf, 0xff, 0xff, 0xef, 0xbe, 0x96, 0x39, 0xae, 0xfb, 0xff, 0xff, 0xdf, 0x7e, 0xcf, 0x3c, 0xff, 0xff, 0xc7, 0x1c, 0xcf, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x1c, 0xa6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x7e, 0x7d, 0xd7, 0xb6, 0xfb, 0x96, 0x39, 0xae, 0xdb, 0xc6, 0xfb, 0x8d, 0xd7, 0xef, 0xff, 0xd7, 0x3c, 0xdf, 0x1c, 0xff, 0xff, 0x9e, 0x7a, 0xae, 0xdb, 0xe7, 0xdf, 0xa6, 0xbb, 0xc7, 0x1c, 0xa6, 0xbb, 0xa6, 0xbb, 0xc7, 0x1c, 0xa6, 0xdb, 0x8e, 0x7a, 0xff, 0xff, 0xcf, 0x3d, 0xc7, 0x1c, 0xb6, 0xdb, 0xc6, 0xfb, 0xbe, 0xfb, 0x9e, 0xbb, 0xef, 0xdf, 0xce, 0xdb, 0xf7, 0xbe, 0xe7, 0x9e, 0xbe, 0xfb, 0xc6, 0xfc, 0xae, 0x7a, 0xc7, 0x1c, 0x9e, 0x18, 0xd7, 0x9e, 0xce, 0xfb, 0xef, 0x9e, 0xff, 0xff, 0xa6, 0x7a, 0xa6, 0xba, 0xa6, 0xbb, 0xae, 0xbb, 0xcf, 0x1c, 0x8d, 0xf8, 0xd7, 0x7d, 0xe7, 0x9e, 0xae, 0x9a, 0xbe, 0xfc, 0xb6, 0xdb, 0x8e, 0x5a, 0xae, 0xdb, 0xae, 0xba, 0xa6, 0x79, 0xcf, 0x3d, 0x95, 0xf8, 0xdf, 0x7d, 0xe7, 0xdf, 0x96, 0x39, 0xa6, 0x5a, 0xbf, 0x1c, 0x8e, 0x5a, 0xae, 0xbb, 0xbe, 0xdb, 0x9e, 0x18, 0xff, 0xff, 0x96, 0x59, 0x8e, 0x5a, 0xdf, 0xbe, 0xbe, 0xdb, 0xbe, 0xfc, 0xa6, 0x79, 0xc7, 0x1c, 0xa6, 0x7a, 0xae, 0xdb, 0xf7, 0xff, 0xce, 0xdb, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfc, 0x86, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd7, 0x5d, 0x7d, 0xd7, 0x7d, 0xd7, 0xe7, 0xbe, 0x8e, 0x19, 0x9e, 0x7a, 0xdf, 0x7e, 0x8e, 0x18, 0xb7, 0x1c, 0xce, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0x8e, 0x39, 0xbf, 0x3c, 0xbe, 0xfb, 0x7d, 0xf8, 0xdf, 0xdf, 0xb6, 0xfb, 0x75, 0xf8, 0xb6, 0xdb, 0x8e, 0x18, 0x8e, 0x7a, 0xc7, 0x3c, 0x75, 0x97, 0xc7, 0x5d, 0xc7, 0x1c, 0xcf, 0x3d, 0xd7, 0xdf, 0x7d, 0xf8, 0xae, 0x79, 0xe7, 0x7d, 0xff, 0xff, 0xae, 0x9a, 0x9e, 0xdb, 0xcf, 0x3c, 0xc7, 0x3c, 0xdf, 0xdf, 0x85, 0xf8, 0x96, 0x59, 0xdf, 0x5d, 0xff, 0xff, 0xdf, 0x7e, 0x75, 0x76, 0xc7, 0x3d, 0xa6, 0xdb, 0x8d, 0xf7, 0xdf, 0x5d, 0x8e, 0x59, 0xb6, 0xfc, 0x85, 0xf8, 0xae, 0xdb, 0xd7, 0x9e, 0xa6, 0xbb, 0x6d, 0xb7, 0xc7, 0x3d, 0xa6, 0xdb, 0x8d, 0xf8, 0xd7, 0x5d, 0x86, 0x39, 0xbf, 0x1c, 0x85, 0xf8, 0x86, 0x7a, 0xd7, 0x9e, 0x9e, 0x9a, 0x55, 0x56, 0xc7, 0x1c, 0xc7, 0x3c, 0x86, 0x39, 0xc7, 0x1c, 0x75, 0x97, 0xb7, 0x5d, 0xc7, 0x1c, 0x75, 0x96, 0xd7, 0xbf, 0xc6, 0xfb, 0xcf, 0x5d, 0xcf, 0x9e, 0x86, 0x18, 0xb6, 0x9a, 0xe7, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9e, 0x65, 0x97, 0x8e, 0xbb, 0xc7, 0x5d, 0xb7, 0x1c, 0xae, 0x79, 0xd7, 0x3c, 0xd7, 0x7d, 0xef, 0xbf, 0xff, 0xff, 0xdf, 0x7d, 0xf7, 0xdf, 0xff, 0xff, 0xd7, 0x3d, 0xdf, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x3d, 0xbe, 0xdb, 0xe7, 0x9e, 0xae, 0xdb, 0xa6, 0x59, 0xe7, 0x7d, 0xcf, 0x3c, 0xcf, 0x3d, 0xe7, 0xbf, 0xb6, 0xba, 0xd7, 0x7d, 0xc7, 0x1c, 0x9e, 0x18, 0xd7, 0x3d, 0xd7, 0x3c, 0xb6, 0x9a, 0xb6, 0xfc, 0xe7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7d, 0x96, 0x19, 0xcf, 0x3c, 0xdf, 0x7d, 0xbe, 0xbb, 0xbe, 0xfc, 0xe7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9e, 0xdf, 0x7e, 0xff, 0xff, 0xdf, 0x7d, 0xe7, 0x9e, 0xff, 0xff, 0xd7, 0x5d, 0xd7, 0x5d, 0xc7, 0x5d, 0x8d, 0xf8, 0xc6, 0xfc, 0xdf, 0x7d, 0xdf, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xe7, 0x9e, 0xff, 0xff, 0xcf, 0x3d, 0xd7, 0x5d, 0xbf, 0x1c, 0x8e, 0x18, 0xc6, 0xfc, 0xd7, 0x3d, 0xcf, 0x3d, 0xff, 0xff, 0xef, 0xbe, 0xb6, 0x9a, 0xdf, 0x7d, 0xc7, 0x1c, 0xb6, 0x9a, 0xd7, 0x5d, 0xa6, 0xbb, 0x9e, 0x39, 0xd7, 0x3c, 0xce, 0xbb, 0xa6, 0x79, 0xb6, 0xdb, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x7e, 0x96, 0x5a, 0x9e, 0x39, 0xbe, 0xdb, 0xe7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc9, 0xc2, 0xff, 0x74, 0x69, 0x55, 0xff, 0x54, 0x45, 0x2c, 0xff, 0x76, 0x69, 0x59, 0xff, 0xc5, 0xc0, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xc4, 0xbc, 0xff, 0x30, 0x1a, 0x01, 0xff, 0x1b, 0x02, 0x00, 0xff, 0x21, 0x08, 0x00, 0xff, 0x08, 0x00, 0x00, 0xff, 0x50, 0x41, 0x36, 0xff, 0xf8, 0xf8, 0xf7, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xca, 0xc8, 0xc2, 0xff, 0xc4, 0xc1, 0xbb, 0xff, 0xf8, 0xf8, 0xf9, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x5c, 0x47, 0xff, 0x1b, 0x02, 0x00, 0xff, 0x79, 0x69, 0x59, 0xff, 0xcb, 0xc3, 0xbc, 0xff, 0x8e, 0x86, 0x7b, 0xff, 0xc9, 0xc6, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xef, 0xf0, 0xef, 0xff, 0x3f, 0x30, 0x18, 0xff, 0x23, 0x12, 0x00, 0xff, 0xde, 0xdc, 0xd9, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x3c, 0x22, 0xff, 0x2a, 0x10, 0x00, 0xff, 0xdd, 0xd8, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0x49, 0x32, 0x16, 0xff, 0x2d, 0x17, 0x00, 0xff, 0xe6, 0xe6, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xec, 0xe9, 0xe5, 0xff, 0x4e, 0x3b, 0x1e, 0xff, 0x30, 0x17, 0x00, 0xff, 0xca, 0xc8, 0xbd, 0xff, 0xf4, 0xf5, 0xf4, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe6, 0xe3, 0xff, 0xd4, 0xd0, 0xca, 0xff, 0xcf, 0xcb, 0xc0, 0xff, 0xde, 0xdd, 0xd7, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf0, 0xff, 0xda, 0xd7, 0xd0, 0xff, 0xd2, 0xcf, 0xc5, 0xff, 0xdb, 0xd9, 0xd2, 0xff, 0xf5, 0xf7, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xef, 0xef, 0xed, 0xff, 0xe0, 0xdd, 0xd6, 0xff, 0x4c, 0x35, 0x18, 0xff, 0x35, 0x1e, 0x02, 0xff, 0xd2, 0xcf, 0xc4, 0xff, 0xf0, 0xf0, 0xed, 0xff, 0xf9, 0xfc, 0xfc, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe5, 0xe2, 0xff, 0xdb, 0xd7, 0xd0, 0xff, 0xde, 0xdb, 0xd6, 0xff, 0xf5, 0xf6, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xec, 0xec, 0xe9, 0xff, 0xf7, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf8, 0xf9, 0xf8, 0xff, 0xee, 0xef, 0xed, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xf0, 0xf0, 0xed, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xf0, 0xf0, 0xed, 0xff, 0xf8, 0xfc, 0xfa, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfb, 0xf7, 0xff, 0xf5, 0xf5, 0xf3, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xed, 0xea, 0xff, 0xe8, 0xe8, 0xe3, 0xff, 0xf0, 0xf0, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x41, 0x2e, 0x10, 0xff, 0x39, 0x20, 0x00, 0xff, 0x33, 0x1b, 0x00, 0xff, 0x46, 0x32, 0x12, 0xff, 0x41, 0x2e, 0x14, 0xff, 0xb7, 0xb4, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xd1, 0xcb, 0xff, 0x73, 0x66, 0x52, 0xff, 0x39, 0x27, 0x08, 0xff, 0x22, 0x0a, 0x00, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x31, 0x1b, 0x01, 0xff, 0x5d, 0x4c, 0x34, 0xff, 0xad, 0xa7, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xe5, 0xff, 0x93, 0x89, 0x7b, 0xff, 0x4a, 0x36, 0x1c, 0xff, 0x29, 0x13, 0x00, 0xff, 0x21, 0x08, 0x00, 0xff, 0x2c, 0x17, 0x00, 0xff, 0x50, 0x40, 0x27, 0xff, 0xa2, 0x9a, 0x8e, 0xff, 0xf6, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdc, 0xff, 0x49, 0x39, 0x20, 0xff, 0x41, 0x2b, 0x0a, 0xff, 0x36, 0x1e, 0x00, 0xff, 0x34, 0x1d, 0x00, 0xff, 0x43, 0x2e, 0x0c, 0xff, 0x3d, 0x2b, 0x10, 0xff, 0xc4, 0xc1, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xae, 0xa4, 0xff, 0x64, 0x55, 0x43, 0xff, 0x3a, 0x24, 0x08, 0xff, 0x29, 0x13, 0x00, 0xff, 0x33, 0x19, 0x00, 0xff, 0x4b, 0x39, 0x20, 0xff, 0x89, 0x7f, 0x70, 0xff, 0xe7, 0xe5, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xca, 0xc5, 0xff, 0x3e, 0x2d, 0x17, 0xff, 0x5f, 0x4f, 0x3d, 0xff, 0xf1, 0xee, 0xeb, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xf7, 0xf6, 0xf3, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x3c, 0x2d, 0x18, 0xff, 0xc9, 0xca, 0xc4, 0xff, 0xa9, 0xa4, 0x98, 0xff, 0x35, 0x23, 0x0c, 0xff, 0xad, 0xa8, 0x9f, 0xff, 0xbf, 0xbb, 0xbb, 0xff, 0x3c, 0x2d, 0x12, 0xff, 0x70, 0x65, 0x51, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xe2, 0xdf, 0xff, 0x5b, 0x4b, 0x34, 0xff, 0x4d, 0x3e, 0x2a, 0xff, 0xda, 0xd8, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf5, 0xf3, 0xff, 0xa8, 0xa2, 0x94, 0xff, 0x60, 0x4f, 0x39, 0xff, 0x42, 0x2e, 0x10, 0xff, 0x3e, 0x27, 0x0a, 0xff, 0x45, 0x32, 0x17, 0xff, 0x76, 0x68, 0x55, 0xff, 0xc8, 0xc5, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x40, 0x2b, 0xff, 0x24, 0x0b, 0x00, 0xff, 0x34, 0x1a, 0x00, 0xff, 0x3c, 0x1a, 0x00, 0xff, 0x30, 0x16, 0x00, 0xff, 0x1e, 0x06, 0x00, 0xff, 0xa5, 0xa2, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xb6, 0xad, 0xff, 0x32, 0x1b, 0x02, 0xff, 0x1a, 0x01, 0x00, 0xff, 0x2d, 0x17, 0x00, 0xff, 0x4d, 0x3c, 0x22, 0xff, 0x4f, 0x3f, 0x29, 0xff, 0x38, 0x23, 0x06, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x20, 0x08, 0x00, 0xff, 0x95, 0x8b, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe1, 0xdd, 0xff, 0x50, 0x41, 0x2a, 0xff, 0x17, 0x01, 0x00, 0xff, 0x24, 0x08, 0x00, 0xff, 0x43, 0x30, 0x11, 0xff, 0x4e, 0x3d, 0x21, 0xff, 0x3c, 0x27, 0x06, 0xff, 0x21, 0x06, 0x00, 0xff, 0x1a, 0x03, 0x00, 0xff, 0x70, 0x63, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xe2, 0xdf, 0xff, 0x36, 0x25, 0x0c, 0xff, 0x31, 0x1a, 0x00, 0xff, 0x36, 0x1b, 0x00, 0xff, 0x3d, 0x1a, 0x00, 0xff, 0x33, 0x1b, 0x00, 0xff, 0x27, 0x13, 0x00, 0xff, 0xbe, 0xbb, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x89, 0x7b, 0xff, 0x20, 0x08, 0x00, 0xff, 0x1a, 0x02, 0x00, 0xff, 0x31, 0x1a, 0x01, 0xff, 0x44, 0x31, 0x16, 0xff, 0x3d, 0x28, 0x08, 0xff, 0x24, 0x0a, 0x00, 0xff, 0x18, 0x01, 0x00, 0xff, 0x45, 0x35, 0x1f, 0xff, 0xdb, 0xd7, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xef, 0xee, 0xeb, 0xff, 0x40, 0x2d, 0x13, 0xff, 0x19, 0x01, 0x00, 0xff, 0xb1, 0xb0, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xbc, 0xb3, 0xff, 0x1c, 0x06, 0x00, 0xff, 0x33, 0x1f, 0x06, 0xff, 0xef, 0xef, 0xeb, 0xff, 0x91, 0x87, 0x76, 0xff, 0x08, 0x00, 0x00, 0xff, 0x95, 0x8d, 0x81, 0xff, 0xed, 0xeb, 0xe7, 0xff, 0x2b, 0x14, 0x00, 0xff, 0x28, 0x0e, 0x00, 0xff, 0xd7, 0xd3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x9c, 0x8f, 0xff, 0x10, 0x00, 0x00, 0xff, 0x4a, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf1, 0xf0, 0xed, 0xff, 0x5f, 0x51, 0x3c, 0xff, 0x1a, 0x03, 0x00, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x2c, 0x14, 0x00, 0xff, 0x34, 0x1d, 0x02, 0xff, 0x27, 0x0e, 0x00, 0xff, 0x19, 0x02, 0x00, 0xff, 0x27, 0x11, 0x00, 0xff, 0xa2, 0x9a, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe4, 0xe1, 0xff, 0xda, 0xd5, 0xd0, 0xff, 0x4c, 0x37, 0x1c, 0xff, 0x2e, 0x19, 0x00, 0xff, 0xbc, 0xb6, 0xad, 0xff, 0xe1, 0xdf, 0xdb, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xd5, 0xd3, 0xcc, 0xff, 0x3a, 0x25, 0x08, 0xff, 0x1b, 0x03, 0x00, 0xff, 0x75, 0x66, 0x55, 0xff, 0xdc, 0xd8, 0xd3, 0xff, 0xfc, 0xf9, 0xf9, 0xff, 0xfc, 0xfd, 0xfa, 0xff, 0xe8, 0xe5, 0xe2, 0xff, 0x95, 0x8a, 0x7c, 0xff, 0x2d, 0x16, 0x00, 0xff, 0x1f, 0x08, 0x00, 0xff, 0xa3, 0x9b, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xee, 0xff, 0x53, 0x44, 0x30, 0xff, 0x18, 0x02, 0x00, 0xff, 0x4f, 0x3e, 0x25, 0xff, 0xc2, 0xbf, 0xb5, 0xff, 0xf0, 0xf2, 0xef, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xec, 0xec, 0xe8, 0xff, 0xab, 0xa5, 0x97, 0xff, 0x38, 0x25, 0x06, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x7f, 0x75, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe8, 0xff, 0xd8, 0xd3, 0xcc, 0xff, 0x4a, 0x33, 0x14, 0xff, 0x36, 0x1f, 0x02, 0xff, 0xca, 0xc5, 0xbe, 0xff, 0xe5, 0xe3, 0xe1, 0xff, 0xf5, 0xf7, 0xf7, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x8f, 0x84, 0xff, 0x1f, 0x06, 0x00, 0xff, 0x2d, 0x16, 0x00, 0xff, 0x92, 0x89, 0x7a, 0xff, 0xe3, 0xe1, 0xde, 0xff, 0xf3, 0xf1, 0xf0, 0xff, 0xef, 0xee, 0xea, 0xff, 0xc3, 0xbf, 0xb4, 0xff, 0x54, 0x44, 0x2c, 0xff, 0x1a, 0x02, 0x00, 0xff, 0x4f, 0x41, 0x27, 0xff, 0xea, 0xe8, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x8b, 0x7c, 0xff, 0x1a, 0x02, 0x00, 0xff, 0x64, 0x56, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x64, 0x4e, 0xff, 0x17, 0x01, 0x00, 0xff, 0x89, 0x80, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x86, 0x75, 0xff, 0x13, 0x00, 0x00, 0xff, 0x96, 0x8d, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x18, 0x01, 0x00, 0xff, 0x90, 0x86, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x5f, 0x52, 0x39, 0xff, 0x19, 0x02, 0x00, 0xff, 0x9c, 0x92, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x54, 0x40, 0xff, 0x17, 0x01, 0x00, 0xff, 0x41, 0x30, 0x14, 0xff, 0xad, 0xa7, 0x9a, 0xff, 0xe1, 0xdf, 0xd9, 0xff, 0xe7, 0xe6, 0xe3, 0xff, 0xd4, 0xd0, 0xc9, 0xff, 0x83, 0x78, 0x65, 0xff, 0x24, 0x0b, 0x00, 0xff, 0x27, 0x0d, 0x00, 0xff, 0xa4, 0x9c, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x39, 0x21, 0xff, 0x2a, 0x13, 0x00, 0xff, 0xdf, 0xde, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x5c, 0x49, 0xff, 0x18, 0x01, 0x00, 0xff, 0x6b, 0x5d, 0x4b, 0xff, 0xfb, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x95, 0x88, 0xff, 0x20, 0x08, 0x00, 0xff, 0x42, 0x2d, 0x16, 0xff, 0xf1, 0xf0, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x9a, 0x8d, 0xff, 0x19, 0x02, 0x00, 0xff, 0x47, 0x38, 0x1b, 0xff, 0xe4, 0xe3, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xbb, 0xb2, 0xff, 0x31, 0x19, 0x00, 0xff, 0x24, 0x0d, 0x00, 0xff, 0xcb, 0xc6, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf9, 0xfa, 0xff, 0x47, 0x33, 0x17, 0xff, 0x32, 0x1b, 0x01, 0xff, 0xea, 0xeb, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xde, 0xd8, 0xff, 0x34, 0x1f, 0x03, 0xff, 0x25, 0x0d, 0x00, 0xff, 0xa4, 0x9b, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe7, 0xe2, 0xff, 0x4f, 0x3e, 0x24, 0xff, 0x16, 0x01, 0x00, 0xff, 0x92, 0x88, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd8, 0xd0, 0xff, 0x2e, 0x16, 0x00, 0xff, 0x2e, 0x19, 0x01, 0xff, 0xdf, 0xdb, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xdf, 0xd8, 0xff, 0x34, 0x21, 0x02, 0xff, 0x2d, 0x13, 0x00, 0xff, 0xd7, 0xd3, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x86, 0x75, 0xff, 0x14, 0x00, 0x00, 0xff, 0x96, 0x8d, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xb5, 0xad, 0xff, 0x20, 0x06, 0x00, 0xff, 0x40, 0x2e, 0x12, 0xff, 0xee, 0xef, 0xec, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xd0, 0xc5, 0xff, 0x2d, 0x16, 0x00, 0xff, 0x35, 0x20, 0x05, 0xff, 0xef, 0xee, 0xe9, 0xff, 0xa7, 0xa3, 0x95, 0xff, 0x1a, 0x02, 0x00, 0xff, 0x42, 0x2e, 0x13, 0xff, 0xd3, 0xd1, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x8e, 0x81, 0xff, 0x23, 0x08, 0x00, 0xff, 0x39, 0x23, 0x08, 0xff, 0xe4, 0xe2, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0x49, 0x35, 0x1b, 0xff, 0x28, 0x12, 0x00, 0xff, 0xd6, 0xd5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe0, 0xd9, 0xff, 0x2d, 0x18, 0x00, 0xff, 0x37, 0x24, 0x06, 0xff, 0xe7, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xf8, 0xff, 0x53, 0x42, 0x2a, 0xff, 0x1f, 0x06, 0x00, 0xff, 0xbd, 0xb6, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x50, 0x38, 0xff, 0x1c, 0x03, 0x00, 0xff, 0xae, 0xa6, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x7f, 0x6c, 0xff, 0x17, 0x01, 0x00, 0xff, 0x81, 0x75, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf0, 0xff, 0x46, 0x30, 0x14, 0xff, 0x31, 0x19, 0x01, 0xff, 0xe6, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x9c, 0x90, 0xff, 0x17, 0x02, 0x00, 0xff, 0x76, 0x66, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc8, 0xbc, 0xff, 0x2a, 0x10, 0x00, 0xff, 0x4a, 0x36, 0x1f, 0xff, 0xf3, 0xf3, 0xf2, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x65, 0x59, 0x42, 0xff, 0x19, 0x01, 0x00, 0xff, 0x9c, 0x91, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x95, 0x88, 0xff, 0x19, 0x02, 0x00, 0xff, 0x67, 0x56, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x85, 0x75, 0xff, 0x14, 0x00, 0x00, 0xff, 0x96, 0x8d, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf4, 0xff, 0x50, 0x3f, 0x27, 0xff, 0x1a, 0x03, 0x00, 0xff, 0xad, 0xa7, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x7e, 0x66, 0xff, 0x17, 0x01, 0x00, 0xff, 0x80, 0x73, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x45, 0x2d, 0xff, 0x1e, 0x06, 0x00, 0xff, 0xb6, 0xb0, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x55, 0x40, 0xff, 0x19, 0x02, 0x00, 0xff, 0xa3, 0x9b, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0x49, 0x36, 0x1b, 0xff, 0x29, 0x10, 0x00, 0xff, 0xda, 0xd6, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xbd, 0xb4, 0xff, 0x1e, 0x08, 0x00, 0xff, 0x64, 0x54, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x80, 0x6e, 0xff, 0x1a, 0x01, 0x00, 0xff, 0x99, 0x8f, 0x83, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x41, 0x31, 0x13, 0xff, 0x2b, 0x16, 0x00, 0xff, 0xe2, 0xdc, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xbd, 0xb2, 0xff, 0x1f, 0x05, 0x00, 0xff, 0x5d, 0x4e, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf1, 0xff, 0x45, 0x32, 0x14, 0xff, 0x31, 0x19, 0x00, 0xff, 0xe5, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x80, 0x66, 0xff, 0x1b, 0x03, 0x00, 0xff, 0x86, 0x78, 0x68, 0xff, 0xd4, 0xd2, 0xca, 0xff, 0xc8, 0xc5, 0xc0, 0xff, 0xc8, 0xc4, 0xbf, 0xff, 0xc8, 0xc5, 0xc0, 0xff, 0xc9, 0xc5, 0xc0, 0xff, 0xca, 0xc7, 0xc0, 0xff, 0xce, 0xcd, 0xc9, 0xff, 0xc3, 0xbc, 0xb0, 0xff, 0x41, 0x2b, 0x0b, 0xff, 0x2e, 0x19, 0x01, 0xff, 0xe0, 0xdf, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xa7, 0x99, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x52, 0x41, 0x2b, 0xff, 0xfa, 0xfa, 0xf6, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0x5c, 0x4a, 0x32, 0xff, 0x1b, 0x02, 0x00, 0xff, 0xa5, 0x9d, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x84, 0x75, 0xff, 0x17, 0x00, 0x00, 0xff, 0x97, 0x8e, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x91, 0x84, 0xff, 0x18, 0x01, 0x00, 0xff, 0x69, 0x5a, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe7, 0xe3, 0xff, 0x3d, 0x29, 0x0d, 0xff, 0x1f, 0x08, 0x00, 0xff, 0xc8, 0xc4, 0xbd, 0xff, 0xef, 0xee, 0xe9, 0xff, 0x33, 0x1d, 0x02, 0xff, 0x39, 0x28, 0x08, 0xff, 0xf1, 0xef, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x90, 0x81, 0xff, 0x19, 0x02, 0x00, 0xff, 0x7b, 0x70, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xfa, 0xff, 0x49, 0x34, 0x1b, 0xff, 0x2b, 0x10, 0x00, 0xff, 0xd9, 0xd7, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xaa, 0x9d, 0xff, 0x1b, 0x03, 0x00, 0xff, 0x75, 0x63, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x8f, 0x81, 0xff, 0x17, 0x00, 0x00, 0xff, 0x93, 0x88, 0x7c, 0xff, 0xf9, 0xf8, 0xf4, 0xff, 0x38, 0x24, 0x06, 0xff, 0x38, 0x22, 0x06, 0xff, 0xef, 0xee, 0xea, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xcb, 0xc3, 0xff, 0x20, 0x06, 0x00, 0xff, 0x5c, 0x4d, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf1, 0xff, 0x45, 0x32, 0x14, 0xff, 0x31, 0x1b, 0x01, 0xff, 0xe7, 0xe4, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x67, 0x53, 0xff, 0x29, 0x0c, 0x00, 0xff, 0x30, 0x17, 0x00, 0xff, 0x24, 0x0c, 0x00, 0xff, 0x22, 0x08, 0x00, 0xff, 0x22, 0x08, 0x00, 0xff, 0x22, 0x08, 0x00, 0xff, 0x22, 0x0b, 0x00, 0xff, 0x22, 0x0b, 0x00, 0xff, 0x24, 0x0b, 0x00, 0xff, 0x2a, 0x11, 0x00, 0xff, 0x29, 0x0e, 0x00, 0xff, 0x25, 0x11, 0x00, 0xff, 0xdb, 0xd7, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xef, 0xef, 0xea, 0xff, 0x41, 0x30, 0x16, 0xff, 0x20, 0x06, 0x00, 0xff, 0xbd, 0xb8, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xc1, 0xbb, 0xff, 0x25, 0x0c, 0x00, 0xff, 0x3e, 0x2a, 0x0e, 0xff, 0xe7, 0xe6, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x84, 0x75, 0xff, 0x14, 0x00, 0x00, 0xff, 0x97, 0x8e, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdc, 0xd8, 0xff, 0x34, 0x1d, 0x00, 0xff, 0x32, 0x1b, 0x00, 0xff, 0xdb, 0xd7, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x9c, 0x91, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x59, 0x45, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd9, 0xd1, 0xff, 0x2a, 0x13, 0x00, 0xff, 0x4f, 0x3f, 0x25, 0xff, 0xf8, 0xfa, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xac, 0x9f, 0xff, 0x18, 0x02, 0x00, 0xff, 0x73, 0x66, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfa, 0xff, 0x49, 0x34, 0x1b, 0xff, 0x29, 0x10, 0x00, 0xff, 0xd8, 0xd8, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xa8, 0x9c, 0xff, 0x1b, 0x03, 0x00, 0xff, 0x74, 0x64, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x90, 0x82, 0xff, 0x17, 0x00, 0x00, 0xff, 0x94, 0x89, 0x7c, 0xff, 0xf7, 0xf5, 0xf2, 0xff, 0x36, 0x22, 0x06, 0xff, 0x36, 0x24, 0x06, 0xff, 0xf0, 0xef, 0xeb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc8, 0xc4, 0xff, 0x1c, 0x06, 0x00, 0xff, 0x5e, 0x4f, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x43, 0x30, 0x13, 0xff, 0x31, 0x1b, 0x01, 0xff, 0xe6, 0xe5, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x63, 0x4e, 0xff, 0x28, 0x0b, 0x00, 0xff, 0x56, 0x3c, 0x1c, 0xff, 0x5d, 0x4c, 0x32, 0xff, 0x57, 0x45, 0x2b, 0xff, 0x57, 0x44, 0x2b, 0xff, 0x55, 0x44, 0x2b, 0xff, 0x55, 0x44, 0x29, 0xff, 0x54, 0x44, 0x2a, 0xff, 0x54, 0x43, 0x28, 0xff, 0x56, 0x42, 0x29, 0xff, 0x55, 0x41, 0x25, 0xff, 0x54, 0x46, 0x32, 0xff, 0xe3, 0xe0, 0xdb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x84, 0x76, 0xff, 0x17, 0x00, 0x00, 0xff, 0x72, 0x64, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x70, 0x5f, 0xff, 0x14, 0x00, 0x00, 0xff, 0x89, 0x7e, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x84, 0x74, 0xff, 0x14, 0x00, 0x00, 0xff, 0x97, 0x8e, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x54, 0x41, 0xff, 0x18, 0x00, 0x00, 0xff, 0x99, 0x90, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x56, 0x41, 0xff, 0x18, 0x01, 0x00, 0xff, 0x9c, 0x93, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xd1, 0xca, 0xff, 0x27, 0x0e, 0x00, 0xff, 0x4f, 0x40, 0x28, 0xff, 0xfa, 0xfa, 0xf8, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xad, 0xa0, 0xff, 0x18, 0x02, 0x00, 0xff, 0x75, 0x67, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x47, 0x33, 0x1b, 0xff, 0x29, 0x12, 0x00, 0xff, 0xdb, 0xd8, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xae, 0xa4, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x6c, 0x5b, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x87, 0x78, 0xff, 0x18, 0x01, 0x00, 0xff, 0x95, 0x8b, 0x7e, 0xff, 0xf7, 0xf4, 0xf3, 0xff, 0x36, 0x21, 0x06, 0xff, 0x36, 0x24, 0x06, 0xff, 0xf0, 0xef, 0xeb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc8, 0xc4, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5d, 0x4f, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x4a, 0x36, 0x19, 0xff, 0x2c, 0x13, 0x00, 0xff, 0xdf, 0xde, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x69, 0x53, 0xff, 0x1e, 0x04, 0x00, 0xff, 0xb0, 0xa9, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd5, 0xce, 0xff, 0x2c, 0x17, 0x00, 0xff, 0x37, 0x23, 0x06, 0xff, 0xe5, 0xe4, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xe8, 0xe5, 0xff, 0x39, 0x25, 0x08, 0xff, 0x29, 0x12, 0x00, 0xff, 0xd1, 0xcd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x84, 0x74, 0xff, 0x13, 0x00, 0x00, 0xff, 0x97, 0x8f, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xaf, 0xa4, 0xff, 0x1f, 0x06, 0x00, 0xff, 0x4d, 0x3c, 0x24, 0xff, 0xf6, 0xf7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xd1, 0xc9, 0xff, 0x2d, 0x17, 0x00, 0xff, 0x32, 0x1e, 0x03, 0xff, 0xdc, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xd2, 0xca, 0xff, 0x2a, 0x12, 0x00, 0xff, 0x4e, 0x3d, 0x25, 0xff, 0xf8, 0xf9, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xa8, 0x9c, 0xff, 0x19, 0x02, 0x00, 0xff, 0x75, 0x69, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xfb, 0xff, 0x46, 0x33, 0x1e, 0xff, 0x29, 0x12, 0x00, 0xff, 0xd9, 0xd8, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xcf, 0xca, 0xff, 0x25, 0x0c, 0x00, 0xff, 0x4b, 0x37, 0x1c, 0xff, 0xfc, 0xfa, 0xfa, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x56, 0x43, 0xff, 0x18, 0x02, 0x00, 0xff, 0xa7, 0xa8, 0x9d, 0xff, 0xf4, 0xf2, 0xf1, 0xff, 0x36, 0x21, 0x05, 0xff, 0x38, 0x24, 0x08, 0xff, 0xf0, 0xf0, 0xec, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xc8, 0xc4, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x4f, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x45, 0x2d, 0xff, 0x1f, 0x06, 0x00, 0xff, 0xc3, 0xbe, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x85, 0x77, 0xff, 0x12, 0x00, 0x00, 0xff, 0x91, 0x88, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf5, 0xff, 0x97, 0x90, 0x87, 0xff, 0xa1, 0x9c, 0x95, 0xff, 0xf9, 0xf9, 0xfb, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x4f, 0x39, 0xff, 0x1a, 0x03, 0x00, 0xff, 0xa6, 0x9f, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x9a, 0x8e, 0xff, 0x19, 0x02, 0x00, 0xff, 0x5f, 0x4f, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x83, 0x73, 0xff, 0x16, 0x00, 0x00, 0xff, 0x98, 0x90, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf6, 0xf5, 0xf3, 0xff, 0x4a, 0x36, 0x1b, 0xff, 0x1f, 0x08, 0x00, 0xff, 0xc4, 0xbe, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x76, 0x68, 0xff, 0x17, 0x01, 0x00, 0xff, 0x6c, 0x5f, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xdf, 0xda, 0xff, 0x31, 0x1d, 0x02, 0xff, 0x38, 0x27, 0x08, 0xff, 0xf1, 0xf0, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x87, 0x79, 0xff, 0x19, 0x02, 0x00, 0xff, 0x75, 0x6a, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x47, 0x33, 0x1c, 0xff, 0x29, 0x12, 0x00, 0xff, 0xdb, 0xd8, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0x4c, 0x3c, 0x24, 0xff, 0x20, 0x08, 0x00, 0xff, 0xa5, 0xa3, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xcf, 0xc8, 0xff, 0x32, 0x1d, 0x01, 0xff, 0x2b, 0x14, 0x00, 0xff, 0xe2, 0xe2, 0xdc, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0x36, 0x1f, 0x05, 0xff, 0x38, 0x24, 0x08, 0xff, 0xf0, 0xf0, 0xed, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xc8, 0xc3, 0xff, 0x1b, 0x05, 0x00, 0xff, 0x5f, 0x50, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x76, 0x67, 0xff, 0x16, 0x00, 0x00, 0xff, 0x80, 0x74, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xaf, 0xa5, 0xff, 0x1a, 0x04, 0x00, 0xff, 0x50, 0x3f, 0x27, 0xff, 0xf4, 0xf3, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x8c, 0x7f, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x54, 0x46, 0x34, 0xff, 0xfb, 0xfc, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x9c, 0x91, 0xff, 0x17, 0x02, 0x00, 0xff, 0x61, 0x54, 0x3f, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0x5d, 0x4f, 0x39, 0xff, 0x18, 0x01, 0x00, 0xff, 0x9f, 0x96, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x83, 0x73, 0xff, 0x14, 0x00, 0x00, 0xff, 0x99, 0x90, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x81, 0x74, 0xff, 0x16, 0x01, 0x00, 0xff, 0x83, 0x75, 0x64, 0xff, 0xfd, 0xfa, 0xf7, 0xff, 0x45, 0x33, 0x1b, 0xff, 0x1f, 0x05, 0x00, 0xff, 0xba, 0xb3, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x59, 0x4a, 0x35, 0xff, 0x1b, 0x03, 0x00, 0xff, 0xae, 0xa8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xf5, 0xff, 0x57, 0x45, 0x2d, 0xff, 0x20, 0x06, 0x00, 0xff, 0x78, 0x6c, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x47, 0x33, 0x1e, 0xff, 0x29, 0x12, 0x00, 0xff, 0xdb, 0xd8, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xa5, 0x99, 0xff, 0x1f, 0x06, 0x00, 0xff, 0x31, 0x19, 0x01, 0xff, 0xb7, 0xb3, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xd2, 0xcb, 0xff, 0x4e, 0x3d, 0x23, 0xff, 0x17, 0x01, 0x00, 0xff, 0x79, 0x6d, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xe9, 0xe6, 0xff, 0x34, 0x1f, 0x05, 0xff, 0x38, 0x24, 0x08, 0xff, 0xf0, 0xf0, 0xed, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc7, 0xc1, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x5f, 0x50, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xd5, 0xd1, 0xff, 0x2d, 0x1a, 0x01, 0xff, 0x23, 0x0c, 0x00, 0xff, 0x97, 0x8e, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x45, 0x2e, 0xff, 0x1b, 0x02, 0x00, 0xff, 0x72, 0x65, 0x52, 0xff, 0xf2, 0xf1, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x9e, 0x99, 0xff, 0x2a, 0x13, 0x00, 0xff, 0x1f, 0x06, 0x00, 0xff, 0xb6, 0xaf, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe6, 0xff, 0x3c, 0x2a, 0x10, 0xff, 0x2e, 0x19, 0x00, 0xff, 0x97, 0x8d, 0x7f, 0xff, 0x35, 0x20, 0x03, 0xff, 0x34, 0x20, 0x04, 0xff, 0xdf, 0xdd, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x82, 0x72, 0xff, 0x14, 0x00, 0x00, 0xff, 0x9a, 0x91, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xcc, 0xc6, 0xff, 0x2b, 0x11, 0x00, 0xff, 0x44, 0x2c, 0x0e, 0xff, 0x94, 0x88, 0x79, 0xff, 0x29, 0x11, 0x00, 0xff, 0x4a, 0x3b, 0x20, 0xff, 0xf5, 0xf4, 0xf2, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xa5, 0x9a, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x39, 0x25, 0x06, 0xff, 0xc7, 0xc2, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xf7, 0xff, 0x84, 0x78, 0x67, 0xff, 0x29, 0x0d, 0x00, 0xff, 0x2b, 0x0e, 0x00, 0xff, 0x7d, 0x70, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xfa, 0xff, 0x46, 0x33, 0x1a, 0xff, 0x29, 0x11, 0x00, 0xff, 0xdb, 0xd9, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x75, 0x63, 0xff, 0x17, 0x01, 0x00, 0xff, 0x29, 0x11, 0x00, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0xa1, 0x98, 0x8b, 0xff, 0xae, 0xa8, 0x9a, 0xff, 0x85, 0x7a, 0x69, 0xff, 0x34, 0x1b, 0x01, 0xff, 0x19, 0x01, 0x00, 0xff, 0x5b, 0x4d, 0x38, 0xff, 0xea, 0xea, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe5, 0xe2, 0xff, 0x34, 0x1f, 0x03, 0xff, 0x38, 0x25, 0x06, 0xff, 0xf1, 0xf0, 0xed, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xc7, 0xc1, 0xff, 0x1e, 0x05, 0x00, 0xff, 0x60, 0x4f, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xa4, 0x98, 0xff, 0x29, 0x11, 0x00, 0xff, 0x1b, 0x03, 0x00, 0xff, 0x62, 0x52, 0x3d, 0xff, 0xa0, 0x97, 0x8b, 0xff, 0xdf, 0xdb, 0xd8, 0xff, 0xd5, 0xcd, 0xca, 0xff, 0x3f, 0x28, 0x0d, 0xff, 0x16, 0x00, 0x00, 0xff, 0x4e, 0x3d, 0x24, 0xff, 0x9a, 0x90, 0x83, 0xff, 0xbe, 0xb7, 0xad, 0xff, 0xb1, 0xab, 0x9f, 0xff, 0x75, 0x67, 0x55, 0xff, 0x23, 0x0d, 0x00, 0xff, 0x1a, 0x03, 0x00, 0xff, 0x93, 0x88, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x80, 0x71, 0xff, 0x22, 0x08, 0x00, 0xff, 0x43, 0x2c, 0x04, 0xff, 0x24, 0x0b, 0x00, 0xff, 0x77, 0x6a, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x82, 0x72, 0xff, 0x13, 0x00, 0x00, 0xff, 0x9a, 0x91, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0x5c, 0x4c, 0x36, 0xff, 0x2b, 0x0e, 0x00, 0xff, 0x41, 0x2b, 0x02, 0xff, 0x23, 0x0b, 0x00, 0xff, 0x94, 0x8b, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0x7b, 0x70, 0x5f, 0xff, 0x18, 0x02, 0x00, 0xff, 0x34, 0x1d, 0x02, 0xff, 0x8f, 0x84, 0x74, 0xff, 0xc7, 0xc1, 0xb7, 0xff, 0xd1, 0xcd, 0xc5, 0xff, 0xb6, 0xb0, 0xa6, 0xff, 0x5f, 0x51, 0x3a, 0xff, 0x1c, 0x03, 0x00, 0xff, 0x37, 0x21, 0x02, 0xff, 0x2e, 0x14, 0x00, 0xff, 0x44, 0x2e, 0x12, 0xff, 0xa6, 0x9e, 0x94, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf6, 0xf7, 0xf7, 0xff, 0x37, 0x27, 0x11, 0xff, 0x18, 0x04, 0x00, 0xff, 0xd6, 0xd6, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0x9d, 0x95, 0x8a, 0xff, 0x3e, 0x2c, 0x12, 0xff, 0x19, 0x03, 0x00, 0xff, 0x18, 0x01, 0x00, 0xff, 0x17, 0x01, 0x00, 0xff, 0x17, 0x01, 0x00, 0xff, 0x33, 0x1d, 0x03, 0xff, 0x85, 0x79, 0x6b, 0xff, 0xf0, 0xf0, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xe3, 0xe1, 0xdd, 0xff, 0x28, 0x13, 0x00, 0xff, 0x2b, 0x1a, 0x02, 0xff, 0xee, 0xee, 0xe9, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xbd, 0xb7, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x55, 0x46, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xaf, 0xaa, 0xff, 0x4f, 0x3b, 0x24, 0xff, 0x1c, 0x06, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x65, 0x59, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd9, 0xd3, 0xff, 0x63, 0x54, 0x42, 0xff, 0x22, 0x0a, 0x00, 0xff, 0x16, 0x00, 0x00, 0xff, 0x16, 0x01, 0x00, 0xff, 0x16, 0x01, 0x00, 0xff, 0x18, 0x02, 0x00, 0xff, 0x3d, 0x2b, 0x11, 0xff, 0xa2, 0x9b, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xcd, 0xc7, 0xff, 0x28, 0x13, 0x00, 0xff, 0x1f, 0x03, 0x00, 0xff, 0x22, 0x0d, 0x00, 0xff, 0xc5, 0xc1, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x74, 0x64, 0xff, 0x04, 0x00, 0x00, 0xff, 0x91, 0x89, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x9e, 0x94, 0xff, 0x1e, 0x06, 0x00, 0xff, 0x21, 0x06, 0x00, 0xff, 0x2b, 0x17, 0x00, 0xff, 0xd4, 0xd0, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xf8, 0xff, 0x85, 0x7c, 0x6e, 0xff, 0x2b, 0x14, 0x00, 0xff, 0x17, 0x00, 0x00, 0xff, 0x1e, 0x03, 0x00, 0xff, 0x1f, 0x06, 0x00, 0xff, 0x17, 0x01, 0x00, 0xff, 0x1b, 0x03, 0x00, 0xff, 0x50, 0x3e, 0x29, 0xff, 0xc8, 0xc5, 0xbb, 0xff, 0x81, 0x75, 0x63, 0xff, 0x14, 0x01, 0x00, 0xff, 0x14, 0x02, 0x00, 0xff, 0xd1, 0xcc, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xf9, 0xfb, 0xfd, 0xff, 0xa3, 0x9d, 0x97, 0xff, 0x94, 0x8d, 0x83, 0xff, 0xeb, 0xed, 0xec, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xeb, 0xea, 0xff, 0xc2, 0xbb, 0xb2, 0xff, 0xa1, 0x96, 0x8c, 0xff, 0x9a, 0x90, 0x85, 0xff, 0xb4, 0xac, 0xa2, 0xff, 0xe8, 0xe5, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xf5, 0xf4, 0xf5, 0xff, 0xa8, 0xa0, 0x96, 0xff, 0xa8, 0xa3, 0x98, 0xff, 0xf8, 0xf9, 0xf8, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xe2, 0xe8, 0xe5, 0xff, 0x95, 0x8c, 0x82, 0xff, 0xb9, 0xb5, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf0, 0xff, 0xc2, 0xbc, 0xb2, 0xff, 0x8d, 0x83, 0x74, 0xff, 0xa8, 0xa4, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xce, 0xca, 0xc0, 0xff, 0x9f, 0x95, 0x87, 0xff, 0x7f, 0x74, 0x62, 0xff, 0x89, 0x7e, 0x6e, 0xff, 0xb1, 0xac, 0x9e, 0xff, 0xec, 0xec, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xf8, 0xff, 0xfb, 0xfc, 0xf6, 0xff, 0xfb, 0xfc, 0xf6, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xa4, 0x9b, 0xff, 0x6b, 0x5d, 0x4e, 0xff, 0xad, 0xa7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xba, 0xb5, 0xff, 0x75, 0x68, 0x5b, 0xff, 0xc5, 0xc1, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0x8e, 0x86, 0x7b, 0xff, 0x64, 0x57, 0x47, 0xff, 0xb0, 0xab, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xd4, 0xd0, 0xff, 0x9b, 0x93, 0x86, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x65, 0x56, 0x42, 0xff, 0x76, 0x6b, 0x5a, 0xff, 0xae, 0xa8, 0x9c, 0xff, 0xf4, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xf5, 0xff, 0x9f, 0x8e, 0x83, 0xff, 0x71, 0x65, 0x55, 0xff, 0xe6, 0xe4, 0xe2, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xf6, 0xf8, 0xef, 0xff, 0xe9, 0xeb, 0xd7, 0xff, 0xe1, 0xe2, 0xc5, 0xff, 0xda, 0xdb, 0xc7, 0xff, 0xda, 0xda, 0xc5, 0xff, 0xd5, 0xd7, 0xbb, 0xff, 0xe2, 0xe2, 0xc6, 0xff, 0xf9, 0xfb, 0xf5, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfb, 0xfd, 0xfb, 0xff, 0xfa, 0xfc, 0xf9, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfc, 0xff, 0xec, 0xef, 0xe2, 0xff, 0xd0, 0xd1, 0xad, 0xff, 0xbf, 0xc0, 0x93, 0xff, 0xe1, 0xe2, 0xbe, 0xff, 0xf1, 0xf2, 0xe6, 0xff, 0xf4, 0xf5, 0xec, 0xff, 0xe5, 0xe7, 0xd4, 0xff, 0xc7, 0xc8, 0xad, 0xff, 0xf7, 0xf9, 0xf2, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xe3, 0xe6, 0xca, 0xff, 0xe6, 0xe8, 0xc9, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xea, 0xeb, 0xd9, 0xff, 0xcd, 0xce, 0xa9, 0xff, 0xe9, 0xe9, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf8, 0xfb, 0xf7, 0xff, 0xf9, 0xfb, 0xf7, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xea, 0xea, 0xd6, 0xff, 0xbd, 0xc0, 0x92, 0xff, 0xe9, 0xea, 0xd5, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdf, 0xe0, 0xc6, 0xff, 0xe5, 0xe6, 0xcd, 0xff, 0xfa, 0xf9, 0xec, 0xff, 0xee, 0xef, 0xde, 0xff, 0xe8, 0xea, 0xce, 0xff, 0xf1, 0xf3, 0xea, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfb, 0xfd, 0xfa, 0xff, 0xf7, 0xf8, 0xf4, 0xff, 0xfb, 0xfd, 0xfc, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xf7, 0xf7, 0xf5, 0xff, 0xc8, 0xc8, 0x9a, 0xff, 0xce, 0xcf, 0xa9, 0xff, 0xf7, 0xf9, 0xfb, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfb, 0xfe, 0xfb, 0xff, 0xf9, 0xfb, 0xf8, 0xff, 0xfa, 0xfd, 0xfd, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfa, 0xfd, 0xfc, 0xff, 0xf3, 0xf4, 0xe7, 0xff, 0xda, 0xd9, 0xa9, 0xff, 0xc5, 0xc5, 0x9b, 0xff, 0xde, 0xde, 0xcb, 0xff, 0xd7, 0xd8, 0xc5, 0xff, 0xe5, 0xe6, 0xc9, 0xff, 0xe6, 0xe8, 0xc9, 0xff, 0xf0, 0xf2, 0xe8, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xea, 0xe9, 0xd1, 0xff, 0xd1, 0xd2, 0xb9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfa, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xc2, 0xff, 0xbd, 0xbd, 0x88, 0xff, 0xef, 0xf0, 0xe5, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xf9, 0xfa, 0xf5, 0xff, 0xf7, 0xf9, 0xef, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfb, 0xfd, 0xf9, 0xff, 0xfb, 0xfd, 0xfc, 0xff, 0xf9, 0xfb, 0xf8, 0xff, 0xf1, 0xf3, 0xed, 0xff, 0xfb, 0xfc, 0xfb, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xf9, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf0, 0xf1, 0xe0, 0xff, 0xd6, 0xd6, 0xba, 0xff, 0xf8, 0xfb, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xf9, 0xfb, 0xf5, 0xff, 0xf9, 0xfa, 0xf5, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xe0, 0xe0, 0xbb, 0xff, 0xc4, 0xc1, 0x86, 0xff, 0xfa, 0xfa, 0xe9, 0xff, 0xfa, 0xfb, 0xfc, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf0, 0xdf, 0xff, 0xef, 0xf0, 0xe1, 0xff, 0xf3, 0xf4, 0xe6, 0xff, 0xf7, 0xf9, 0xf5, 0xff, 0xf8, 0xfa, 0xf9, 0xff, 0xf3, 0xf4, 0xe7, 0xff, 0xfb, 0xfd, 0xf7, 0xff, 0xfa, 0xfc, 0xfa, 0xff, 0xf7, 0xf9, 0xf8, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xec, 0xec, 0xd3, 0xff, 0xbf, 0xbc, 0x7c, 0xff, 0xdb, 0xdb, 0xb0, 0xff, 0xf0, 0xf0, 0xea, 0xff, 0xe3, 0xe4, 0xcd, 0xff, 0xd8, 0xe1, 0xc0, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xef, 0xe0, 0xff, 0xdf, 0xdf, 0xbf, 0xff, 0xbb, 0xba, 0x72, 0xff, 0xe4, 0xe4, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xed, 0xdb, 0xff, 0xd2, 0xd4, 0xb9, 0xff, 0xf8, 0xfb, 0xf1, 0xff, 0xe3, 0xe4, 0xcd, 0xff, 0xd6, 0xd6, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfa, 0xf7, 0xff, 0xf9, 0xfb, 0xf9, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xee, 0xf0, 0xe2, 0xff, 0xd0, 0xd1, 0xb5, 0xff, 0xee, 0xed, 0xdc, 0xff, 0xee, 0xef, 0xda, 0xff, 0xcb, 0xcd, 0xab, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xfb, 0xf7, 0xff, 0xf7, 0xfa, 0xf5, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf6, 0xf7, 0xed, 0xff, 0xef, 0xf0, 0xe5, 0xff, 0xf6, 0xf7, 0xf1, 0xff, 0xf7, 0xf8, 0xf5, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xeb, 0xff, 0xf9, 0xfa, 0xf5, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf3, 0xf4, 0xe7, 0xff, 0xdb, 0xdc, 0xc2, 0xff, 0xef, 0xf0, 0xe3, 0xff, 0xf6, 0xf7, 0xf2, 0xff, 0xef, 0xf0, 0xe5, 0xff, 0xf6, 0xf7, 0xf5, 0xff, 0xf5, 0xf7, 0xee, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xf6, 0xf7, 0xee, 0xff, 0xf9, 0xfb, 0xf6, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xef, 0xff, 0xd0, 0xd1, 0xb3, 0xff, 0xe5, 0xe7, 0xcd, 0xff, 0xfb, 0xfe, 0xf5, 0xff, 0xef, 0xf0, 0xe1, 0xff, 0xf8, 0xf9, 0xf7, 0xff, 0xf5, 0xf5, 0xec, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xf3, 0xf4, 0xe8, 0xff, 0xc8, 0xc6, 0x8d, 0xff, 0xdb, 0xdb, 0xa6, 0xff, 0xfc, 0xff, 0xf5, 0xff, 0xed, 0xee, 0xdb, 0xff, 0xe3, 0xe4, 0xca, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xe2, 0xe2, 0xbd, 0xff, 0xe6, 0xe7, 0xc7, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf8, 0xfb, 0xf9, 0xff, 0xfa, 0xfc, 0xfb, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe2, 0xe1, 0xc0, 0xff, 0xdb, 0xd9, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xed, 0xec, 0xce, 0xff, 0xba, 0xb9, 0x77, 0xff, 0xda, 0xdb, 0xb4, 0xff, 0xc6, 0xc4, 0x93, 0xff, 0xd8, 0xd9, 0xa6, 0xff, 0xdb, 0xdd, 0xbe, 0xff, 0xbc, 0xba, 0x8c, 0xff, 0xfb, 0xfc, 0xe7, 0xff, 0xe3, 0xe6, 0xce, 0xff, 0xe0, 0xe2, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xce, 0x99, 0xff, 0xd8, 0xd7, 0xa9, 0xff, 0xf7, 0xf7, 0xde, 0xff, 0xd7, 0xd6, 0xa1, 0xff, 0xe0, 0xe0, 0xbe, 0xff, 0xd6, 0xd6, 0xa2, 0xff, 0xd7, 0xd6, 0xa1, 0xff, 0xe0, 0xdf, 0xbf, 0xff, 0xd8, 0xd7, 0xa4, 0xff, 0xd0, 0xce, 0x87, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xe5, 0xe4, 0xc6, 0xff, 0xe0, 0xe0, 0xc1, 0xff, 0xd6, 0xd7, 0xad, 0xff, 0xda, 0xdb, 0xbe, 0xff, 0xdb, 0xdc, 0xba, 0xff, 0xd5, 0xd4, 0x9a, 0xff, 0xfa, 0xfa, 0xec, 0xff, 0xd7, 0xd9, 0xc7, 0xff, 0xf3, 0xf6, 0xef, 0xff, 0xef, 0xf0, 0xdf, 0xff, 0xdc, 0xdd, 0xb7, 0xff, 0xdd, 0xde, 0xbe, 0xff, 0xce, 0xce, 0xa8, 0xff, 0xe0, 0xe0, 0xc4, 0xff, 0xc4, 0xc2, 0x96, 0xff, 0xf1, 0xf2, 0xd0, 0xff, 0xd9, 0xdb, 0xc9, 0xff, 0xee, 0xf0, 0xe7, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xce, 0xcd, 0x9d, 0xff, 0xce, 0xd5, 0xa0, 0xff, 0xd7, 0xd6, 0xa4, 0xff, 0xd6, 0xd6, 0xa6, 0xff, 0xe3, 0xe2, 0xc8, 0xff, 0xbd, 0xbc, 0x87, 0xff, 0xeb, 0xeb, 0xd3, 0xff, 0xef, 0xef, 0xdd, 0xff, 0xcd, 0xcf, 0xa7, 0xff, 0xdd, 0xdd, 0xb9, 0xff, 0xda, 0xd9, 0xb4, 0xff, 0xd2, 0xc9, 0x8a, 0xff, 0xd8, 0xd8, 0xa6, 0xff, 0xd4, 0xd5, 0xa6, 0xff, 0xcb, 0xcb, 0x9e, 0xff, 0xe6, 0xe6, 0xc6, 0xff, 0xc0, 0xbe, 0x8d, 0xff, 0xea, 0xeb, 0xd5, 0xff, 0xf7, 0xf7, 0xe2, 0xff, 0xc9, 0xc6, 0x91, 0xff, 0xd1, 0xca, 0x9e, 0xff, 0xe1, 0xe2, 0xb8, 0xff, 0xd1, 0xc8, 0x8b, 0xff, 0xd6, 0xd6, 0xa5, 0xff, 0xdb, 0xda, 0xb9, 0xff, 0xc3, 0xc2, 0x95, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xcb, 0xc7, 0x91, 0xff, 0xd2, 0xc8, 0x89, 0xff, 0xf4, 0xf6, 0xdc, 0xff, 0xda, 0xda, 0xb7, 0xff, 0xde, 0xdd, 0xbb, 0xff, 0xcb, 0xcb, 0xa2, 0xff, 0xe0, 0xe0, 0xc3, 0xff, 0xce, 0xce, 0xa0, 0xff, 0xd9, 0xd9, 0xab, 0xff, 0xfb, 0xfc, 0xf0, 0xff, 0xd7, 0xd7, 0xc9, 0xff, 0xf7, 0xf8, 0xf4, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xdf, 0xdc, 0xae, 0xff, 0xc9, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf7, 0xf9, 0xf8, 0xff, 0xe6, 0xe7, 0xd2, 0xff, 0xba, 0xb7, 0x78, 0xff, 0xbb, 0xb8, 0x76, 0xff, 0xf4, 0xf6, 0xdf, 0xff, 0xc5, 0xc2, 0x8b, 0xff, 0xcf, 0xcc, 0x9c, 0xff, 0xf0, 0xeb, 0xd7, 0xff, 0xc2, 0xc0, 0x86, 0xff, 0xdf, 0xdf, 0xb2, 0xff, 0xda, 0xda, 0xc8, 0xff, 0xf8, 0xfa, 0xf5, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xc8, 0xc5, 0x87, 0xff, 0xe3, 0xe3, 0xbb, 0xff, 0xdc, 0xdc, 0xbb, 0xff, 0xc2, 0xbe, 0x76, 0xff, 0xf8, 0xf7, 0xd7, 0xff, 0xdc, 0xdc, 0xb4, 0xff, 0xc1, 0xbe, 0x71, 0xff, 0xdc, 0xda, 0xad, 0xff, 0xc1, 0xbf, 0x89, 0xff, 0xd0, 0xce, 0x8a, 0xff, 0xe3, 0xe4, 0xbe, 0xff, 0xb6, 0xb2, 0x6d, 0xff, 0xeb, 0xea, 0xbd, 0xff, 0xe0, 0xe1, 0xc2, 0xff, 0xe6, 0xe6, 0xc9, 0xff, 0xf7, 0xf7, 0xd4, 0xff, 0xc3, 0xbe, 0x7b, 0xff, 0xcb, 0xcb, 0xa9, 0xff, 0xeb, 0xed, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xd0, 0xaa, 0xff, 0xdb, 0xd9, 0x98, 0xff, 0xe4, 0xe5, 0xc5, 0xff, 0xe3, 0xe4, 0xc4, 0xff, 0xf6, 0xf7, 0xda, 0xff, 0xc1, 0xbe, 0x84, 0xff, 0xc8, 0xc7, 0x93, 0xff, 0xe9, 0xea, 0xdb, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xee, 0xee, 0xd5, 0xff, 0xaf, 0xad, 0x6e, 0xff, 0xe6, 0xe5, 0xc2, 0xff, 0xda, 0xd9, 0x9d, 0xff, 0xbc, 0xbb, 0x86, 0xff, 0xe9, 0xea, 0xda, 0xff, 0xca, 0xc7, 0x86, 0xff, 0xdf, 0xde, 0xb3, 0xff, 0xc0, 0xbd, 0x81, 0xff, 0xd9, 0xd8, 0xa9, 0xff, 0xed, 0xef, 0xd3, 0xff, 0xd6, 0xd5, 0xa3, 0xff, 0xb6, 0xb5, 0x65, 0xff, 0xe6, 0xe5, 0xbf, 0xff, 0xd8, 0xd8, 0xa3, 0xff, 0xbd, 0xbb, 0x85, 0xff, 0xea, 0xea, 0xd2, 0xff, 0xc8, 0xc6, 0x82, 0xff, 0xe1, 0xe1, 0xb7, 0xff, 0xc0, 0xbd, 0x83, 0xff, 0xd0, 0xce, 0x83, 0xff, 0xef, 0xf1, 0xd2, 0xff, 0xd1, 0xd0, 0x9b, 0xff, 0xad, 0xa7, 0x52, 0xff, 0xdf, 0xdf, 0xbe, 0xff, 0xe4, 0xe4, 0xc0, 0xff, 0xc8, 0xc5, 0x7f, 0xff, 0xe1, 0xe1, 0xbd, 0xff, 0xb5, 0xb2, 0x72, 0xff, 0xea, 0xe8, 0xb4, 0xff, 0xe2, 0xe2, 0xbe, 0xff, 0xb0, 0xb0, 0x72, 0xff, 0xf8, 0xf6, 0xd2, 0xff, 0xdc, 0xdc, 0xbe, 0xff, 0xe8, 0xe8, 0xcc, 0xff, 0xf2, 0xf0, 0xc9, 0xff, 0xc0, 0xbf, 0x84, 0xff, 0xd1, 0xd1, 0xb1, 0xff, 0xec, 0xed, 0xe1, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf2, 0xf0, 0xd8, 0xff, 0xb5, 0xaf, 0x5e, 0xff, 0xd9, 0xd4, 0x8a, 0xff, 0xe9, 0xe7, 0xc0, 0xff, 0xe2, 0xe1, 0xb2, 0xff, 0xcb, 0xcc, 0xa6, 0xff, 0xe3, 0xe4, 0xce, 0xff, 0xeb, 0xec, 0xd4, 0xff, 0xf5, 0xf5, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xdb, 0xff, 0xf8, 0xf8, 0xf2, 0xff, 0xfa, 0xfb, 0xfd, 0xff, 0xe5, 0xe6, 0xd1, 0xff, 0xec, 0xee, 0xdb, 0xff, 0xfb, 0xfb, 0xfd, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xe5, 0xe5, 0xc0, 0xff, 0xd7, 0xd7, 0xbb, 0xff, 0xef, 0xf0, 0xe3, 0xff, 0xdc, 0xda, 0xa7, 0xff, 0xc9, 0xc8, 0xa4, 0xff, 0xec, 0xec, 0xde, 0xff, 0xe4, 0xe4, 0xc5, 0xff, 0xe6, 0xe5, 0xcc, 0xff, 0xf5, 0xf5, 0xe3, 0xff, 0xd3, 0xd4, 0xaf, 0xff, 0xeb, 0xec, 0xd3, 0xff, 0xe2, 0xe1, 0xbe, 0xff, 0xc4, 0xc2, 0x96, 0xff, 0xe5, 0xe6, 0xcf, 0xff, 0xe4, 0xe4, 0xd0, 0xff, 0xd2, 0xd1, 0xb0, 0xff, 0xdf, 0xde, 0xb2, 0xff, 0xf1, 0xf2, 0xe4, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xeb, 0xec, 0xd7, 0xff, 0xc5, 0xc2, 0x90, 0xff, 0xe2, 0xe3, 0xcb, 0xff, 0xe9, 0xeb, 0xda, 0xff, 0xd5, 0xd4, 0xb8, 0xff, 0xdf, 0xde, 0xb7, 0xff, 0xef, 0xf0, 0xdd, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xe4, 0xff, 0xee, 0xed, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xec, 0xd7, 0xff, 0xef, 0xf0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xcf, 0xff, 0xe6, 0xe7, 0xcf, 0xff, 0xe7, 0xe7, 0xc4, 0xff, 0xbf, 0xbc, 0x8c, 0xff, 0xde, 0xde, 0xc2, 0xff, 0xeb, 0xec, 0xd8, 0xff, 0xeb, 0xeb, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xda, 0xff, 0xef, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe6, 0xcc, 0xff, 0xe6, 0xe7, 0xcd, 0xff, 0xe0, 0xdf, 0xbc, 0xff, 0xc3, 0xc0, 0x88, 0xff, 0xdd, 0xdd, 0xc1, 0xff, 0xe5, 0xe5, 0xcd, 0xff, 0xe7, 0xe6, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf3, 0xe6, 0xff, 0xd2, 0xd2, 0xae, 0xff, 0xeb, 0xec, 0xd6, 0xff, 0xe0, 0xe1, 0xc2, 0xff, 0xce, 0xd0, 0xad, 0xff, 0xe9, 0xea, 0xd0, 0xff, 0xd6, 0xd5, 0x9e, 0xff, 0xc8, 0xc4, 0x95, 0xff, 0xe4, 0xe4, 0xce, 0xff, 0xdc, 0xd5, 0xc6, 0xff, 0xcb, 0xcb, 0xa4, 0xff, 0xda, 0xda, 0xaf, 0xff, 0xf1, 0xf2, 0xe5, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xef, 0xec, 0xcf, 0xff, 0xcd, 0xc8, 0x93, 0xff, 0xc8, 0xc5, 0x96, 0xff, 0xd7, 0xd7, 0xb6, 0xff, 0xf1, 0xf3, 0xe2, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xfc, 0xff, 0xfa, 0xfa, 0xf2, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xf9, 0xfa, 0xef, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfa, 0xfc, 0xf6, 0xff, 0xfb, 0xfb, 0xf4, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xfb, 0xfb, 0xf9, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfb, 0xfe, 0xfa, 0xff, 0xfb, 0xfc, 0xf7, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf8, 0xf9, 0xec, 0xff, 0xfb, 0xfb, 0xf3, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xfe, 0xff, 0xf7, 0xf7, 0xe9, 0xff, 0xfa, 0xfb, 0xf8, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfa, 0xfb, 0xf4, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfa, 0xfb, 0xf8, 0xff, 0xf8, 0xf8, 0xea, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xf8, 0xf9, 0xf1, 0xff, 0xf9, 0xf9, 0xef, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
-};
-
-const lv_img_dsc_t fonte_logo = {
-  .header.always_zero = 0,
-  .header.w = 150,
-  .header.h = 45,
-  .data_size = 6750 * LV_COLOR_SIZE / 8,
-  .header.cf = LV_IMG_CF_TRUE_COLOR,
-  .data = fonte_logo_map,
-};
@@ -1,133 +0,0 @@
-#include "lvgl/lvgl.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_ICON_AUTO
-#define LV_ATTRIBUTE_IMG_ICON_AUTO
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ICON_AUTO uint8_t icon_auto_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0x50, 0x17, 0x9f, 0x17, 0xdf, 0x17, 0xef, 0x17, 0xff, 0x17, 0xff, 0x17, 0xcf, 0x17, 0x9f, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x7f, 0x17, 0xef, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xdf, 0x17, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xcf, 0x17, 0xff, 0x17, 0xff, 0x17, 0xbf, 0x17, 0x70, 0x17, 0x30, 0x17, 0x10, 0x00, 0x00, 0x17, 0x10, 0x17, 0x30, 0x17, 0x70, 0x17, 0xcf, 0x17, 0xff, 0x17, 0xff, 0x17, 0xdf, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xef, 0x17, 0xff, 0x17, 0xdf, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x17, 0xdf, 0x17, 0xff, 0x17, 0xef, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xef, 0x17, 0xff, 0x17, 0xa0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xef, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xdf, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xcf, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x7f, 0x17, 0xff, 0x17, 0xdf, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xdf, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xdf, 0x17, 0xff, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0x60, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xef, 0x17, 0x10, 
-  0x17, 0x60, 0x17, 0xff, 0x17, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbf, 0x17, 0xff, 0x17, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbf, 0x17, 0xff, 0x17, 0x50, 
-  0x17, 0x9f, 0x17, 0xff, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x70, 0x17, 0xff, 0x17, 0x9f, 
-  0x17, 0xcf, 0x17, 0xff, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x90, 0x17, 0xff, 0x17, 0xcf, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xff, 0x17, 0xdf, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xdf, 0x17, 0xff, 0x17, 0x30, 0x17, 0xff, 0x17, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xff, 0x17, 0xef, 
-  0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xbf, 0x00, 0x00, 0x17, 0xbf, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xef, 0x17, 0xff, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x9f, 0x17, 0xff, 0x17, 0x7f, 0x17, 0x20, 0x17, 0x7f, 0x17, 0xff, 0x17, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xff, 0x17, 0xff, 
-  0x17, 0xdf, 0x17, 0xff, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xef, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xff, 0x17, 0xcf, 
-  0x17, 0xa0, 0x17, 0xff, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xff, 0x17, 0xdf, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0xcf, 0x17, 0xff, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x70, 0x17, 0xff, 0x17, 0x9f, 
-  0x17, 0x50, 0x17, 0xff, 0x17, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbf, 0x17, 0xff, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x70, 0x17, 0xff, 0x17, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xcf, 0x17, 0xff, 0x17, 0x60, 
-  0x17, 0x10, 0x17, 0xef, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x9f, 0x17, 0x9f, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0x9f, 0x17, 0x9f, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x17, 0xff, 0x17, 0xdf, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xdf, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xdf, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xcf, 0x17, 0xff, 0x17, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x9f, 0x17, 0xff, 0x17, 0xdf, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xef, 0x17, 0xff, 0x17, 0x9f, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0x9f, 0x17, 0xff, 0x17, 0xef, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xef, 0x17, 0xff, 0x17, 0xdf, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xdf, 0x17, 0xff, 0x17, 0xef, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xdf, 0x17, 0xff, 0x17, 0xff, 0x17, 0xcf, 0x17, 0x70, 0x17, 0x30, 0x17, 0x10, 0x00, 0x00, 0x17, 0x10, 0x17, 0x30, 0x17, 0x70, 0x17, 0xbf, 0x17, 0xff, 0x17, 0xff, 0x17, 0xcf, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xdf, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xef, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xa0, 0x17, 0xcf, 0x17, 0xff, 0x17, 0xff, 0x17, 0xef, 0x17, 0xdf, 0x17, 0x9f, 0x17, 0x50, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x10, 0x5c, 0x05, 0x50, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x7f, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x7c, 0x05, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x20, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xbf, 0x5c, 0x05, 0x70, 0x5c, 0x05, 0x30, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x10, 0x5c, 0x05, 0x30, 0x5c, 0x05, 0x70, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x30, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x50, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x3c, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x20, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xa0, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x10, 0x5c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0x7f, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x10, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x30, 0x5c, 0x05, 0x60, 0x5c, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x1c, 0x05, 0x10, 
-  0x5c, 0x05, 0x60, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xbf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xbf, 0x5c, 0x05, 0xff, 0x3c, 0x05, 0x50, 
-  0x5c, 0x05, 0x9f, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x20, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x70, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x9f, 
-  0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x3c, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x90, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x30, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x30, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x10, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xbf, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xbf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 
-  0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x7f, 0x5c, 0x05, 0x20, 0x7c, 0x05, 0x7f, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x10, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 
-  0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x3c, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x10, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x30, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xcf, 
-  0x5c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x60, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x70, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x9f, 
-  0x5c, 0x05, 0x50, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xbf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x70, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x60, 
-  0x9c, 0x05, 0x10, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x10, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0x9f, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x50, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x10, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x20, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x9f, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x10, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x30, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xdf, 0x3c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x40, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x20, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0x70, 0x3c, 0x05, 0x30, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x10, 0x3c, 0x05, 0x30, 0x5c, 0x05, 0x70, 0x5c, 0x05, 0xbf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x60, 0x5c, 0x05, 0xa0, 0x5c, 0x05, 0xcf, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xef, 0x5c, 0x05, 0xdf, 0x5c, 0x05, 0x9f, 0x5c, 0x05, 0x50, 0x1c, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x10, 0x05, 0x5c, 0x50, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x7f, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x05, 0x7c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x20, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xbf, 0x05, 0x5c, 0x70, 0x05, 0x5c, 0x30, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x10, 0x05, 0x5c, 0x30, 0x05, 0x5c, 0x70, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x30, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x50, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x3c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x20, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xa0, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9c, 0x10, 0x05, 0x5c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0x7f, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9c, 0x10, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x30, 0x05, 0x5c, 0x60, 0x05, 0x5c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x1c, 0x10, 
-  0x05, 0x5c, 0x60, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xbf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xbf, 0x05, 0x5c, 0xff, 0x05, 0x3c, 0x50, 
-  0x05, 0x5c, 0x9f, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x20, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x70, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x9f, 
-  0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x3c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x90, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x30, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x30, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9c, 0x10, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xbf, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xbf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 
-  0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x7f, 0x05, 0x5c, 0x20, 0x05, 0x7c, 0x7f, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9c, 0x10, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 
-  0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x3c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9c, 0x10, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x30, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xcf, 
-  0x05, 0x5c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x60, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x70, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x9f, 
-  0x05, 0x5c, 0x50, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xbf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x70, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x60, 
-  0x05, 0x9c, 0x10, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9c, 0x10, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0x9f, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x50, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x10, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x20, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x9f, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x10, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x30, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xdf, 0x05, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x40, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x20, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0x70, 0x05, 0x3c, 0x30, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x10, 0x05, 0x3c, 0x30, 0x05, 0x5c, 0x70, 0x05, 0x5c, 0xbf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x60, 0x05, 0x5c, 0xa0, 0x05, 0x5c, 0xcf, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xef, 0x05, 0x5c, 0xdf, 0x05, 0x5c, 0x9f, 0x05, 0x5c, 0x50, 0x05, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0x10, 0xdf, 0xa9, 0x00, 0x50, 0xe1, 0xaa, 0x00, 0x9f, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xcf, 0xe1, 0xaa, 0x00, 0x9f, 0xdf, 0xa7, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xab, 0x00, 0x7f, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0xe1, 0xab, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa8, 0x00, 0xbf, 0xdf, 0xa8, 0x00, 0x70, 0xdf, 0xaa, 0x00, 0x30, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0x10, 0xdf, 0xaa, 0x00, 0x30, 0xdf, 0xa8, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0xdf, 0xa7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0xdf, 0xa7, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa9, 0x00, 0x50, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xdf, 0xa5, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0xa0, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaf, 0x00, 0x10, 0xdf, 0xa9, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xdf, 0xa7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa9, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe1, 0xab, 0x00, 0x7f, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa9, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaa, 0x00, 0x30, 0xdf, 0xa7, 0x00, 0x60, 0xdf, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xdf, 0x9f, 0x00, 0x10, 
-  0xdf, 0xa7, 0x00, 0x60, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xbf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xbf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa6, 0x00, 0x50, 
-  0xe1, 0xaa, 0x00, 0x9f, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe6, 0xad, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa8, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa8, 0x00, 0x9f, 
-  0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa5, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa8, 0x00, 0x90, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa8, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xbf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 
-  0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x9f, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xab, 0x00, 0x7f, 0xdf, 0xa7, 0x00, 0x20, 0xe1, 0xab, 0x00, 0x7f, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa8, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 
-  0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa5, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xcf, 
-  0xdf, 0xa7, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x60, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0xdf, 0xa7, 0x00, 0x80, 0xdf, 0xa7, 0x00, 0x80, 0xdf, 0xa7, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa8, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa8, 0x00, 0x9f, 
-  0xdf, 0xa9, 0x00, 0x50, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xbf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa8, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0x60, 
-  0xdf, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa8, 0x00, 0x9f, 0xe1, 0xa8, 0x00, 0x9f, 0xdf, 0xa7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaf, 0x00, 0x10, 0xe1, 0xa8, 0x00, 0x9f, 0xe1, 0xa8, 0x00, 0x9f, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa9, 0x00, 0x50, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xdf, 0xa7, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xaa, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x9f, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xaa, 0x00, 0x9f, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0x10, 0xe1, 0xaa, 0x00, 0x9f, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xdf, 0xa7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xdf, 0xdf, 0xa6, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xdf, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xcf, 0xdf, 0xa8, 0x00, 0x70, 0xdf, 0xa5, 0x00, 0x30, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0x10, 0xdf, 0xa5, 0x00, 0x30, 0xdf, 0xa8, 0x00, 0x70, 0xe0, 0xaa, 0x00, 0xbf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xcf, 0xdf, 0xa7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xdf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xdf, 0xa7, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x00, 0x60, 0xdf, 0xa7, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xcf, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xef, 0xe0, 0xa8, 0x00, 0xdf, 0xe1, 0xa8, 0x00, 0x9f, 0xdf, 0xa9, 0x00, 0x50, 0xdf, 0x9f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t icon_auto = {
-  .header.always_zero = 0,
-  .header.w = 25,
-  .header.h = 25,
-  .data_size = 625 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = icon_auto_map,
-};
-
@@ -1,498 +0,0 @@
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_ICON_BOTTLE_100
-#define LV_ATTRIBUTE_IMG_ICON_BOTTLE_100
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_ICON_BOTTLE_100 uint8_t icon_bottle_100_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xa0, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0xa0, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x20, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x70, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 
-  0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 
-  0x17, 0x20, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x30, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xb0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x90, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x10, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x17, 0x10, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x10, 0x00, 0x00, 
-  0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 
-  0x17, 0x20, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x20, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x10, 0x17, 0x80, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x80, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x10, 0x17, 0x90, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x90, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x17, 0x30, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x30, 0x00, 0x00, 
-  0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x10, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x30, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 
-  0x17, 0x10, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x17, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xb0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xb0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0x90, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xb0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x7c, 0x05, 0xa0, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0xa0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xbe, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xbe, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xff, 0xbf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbf, 0x05, 0xff, 0x7c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0x70, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbe, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbe, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 
-  0x9d, 0x05, 0x20, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbe, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbe, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x9d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x90, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9e, 0x05, 0x10, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 
-  0x9d, 0x05, 0x20, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0x80, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0x90, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0x90, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x7d, 0x05, 0x30, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0x10, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0x30, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 
-  0x9e, 0x05, 0x10, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x60, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xbf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x60, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0xb0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xb0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xbf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x7c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0x90, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xff, 0xbe, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbe, 0x05, 0xff, 0x7c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x50, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xff, 0xbe, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xbe, 0x05, 0xff, 0x7c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xb0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x9d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x50, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x7c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xdf, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0x9e, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0xff, 0xbe, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xdf, 0x05, 0xff, 0xbe, 0x05, 0xff, 0x7d, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x7c, 0xa0, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0xa0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xbe, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xbe, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xff, 0x05, 0xbf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbf, 0xff, 0x05, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0x70, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xbe, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbe, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 
-  0x05, 0x9d, 0x20, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xbf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xbe, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbe, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x9d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x90, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x9e, 0x10, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 
-  0x05, 0x9d, 0x20, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0x80, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0x90, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0x90, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x7d, 0x30, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0x10, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0x30, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 
-  0x05, 0x9e, 0x10, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xbf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x60, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xbf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x60, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0xb0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xb0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xbf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x7c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0x90, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xff, 0x05, 0xbe, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbe, 0xff, 0x05, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x50, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xff, 0x05, 0xbe, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xbe, 0xff, 0x05, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xb0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9d, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x9d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x50, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0x9e, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0xff, 0x05, 0xbe, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xdf, 0xff, 0x05, 0xbe, 0xff, 0x05, 0x7d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xaa, 0x00, 0xa0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xf1, 0xb3, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf1, 0xb3, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf1, 0xb3, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf1, 0xb3, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xea, 0xae, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0x90, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-  0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe1, 0xa9, 0x00, 0x80, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0x90, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xaa, 0x00, 0x90, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xef, 0xaf, 0x00, 0x10, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xaa, 0x00, 0x30, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-  0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x60, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xaa, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x60, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe1, 0xaa, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xb0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xb0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf5, 0xb5, 0x00, 0xff, 0xe4, 0xab, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe2, 0xac, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0x90, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xed, 0xb0, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xac, 0x00, 0x50, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xed, 0xb0, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xed, 0xb0, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe1, 0xaa, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xb0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xf9, 0xb7, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xea, 0xae, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xef, 0xb1, 0x00, 0xff, 0xea, 0xae, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xac, 0x00, 0x50, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xac, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe2, 0xaa, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfb, 0xb8, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe6, 0xac, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xfd, 0xb9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xec, 0xaf, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf7, 0xb6, 0x00, 0xff, 0xf3, 0xb4, 0x00, 0xff, 0xe8, 0xad, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t icon_bottle_100 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 67,
-  .header.h = 115,
-  .data_size = 7705 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = icon_bottle_100_map,
-};
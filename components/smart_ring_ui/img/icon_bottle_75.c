@@ -1,498 +0,0 @@
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_ICON_BOTTLE_75
-#define LV_ATTRIBUTE_IMG_ICON_BOTTLE_75
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_ICON_BOTTLE_75 uint8_t icon_bottle_75_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xa0, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0xa0, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x70, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x70, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x20, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x70, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 
-  0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 
-  0x17, 0x20, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x30, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x70, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xb0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x90, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x30, 0x5b, 0x40, 0x5b, 0x70, 0x5b, 0x80, 0x5b, 0x80, 0x5b, 0x80, 0x5b, 0x80, 0x5b, 0x80, 0x5b, 0x40, 0x5b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x30, 0x5b, 0x80, 0x5b, 0xc0, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xd0, 0x5b, 0xb0, 0x5b, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x20, 0x5b, 0x90, 0x5b, 0xe0, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xc0, 0x5b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x20, 0x5b, 0x70, 0x5b, 0xd0, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xc0, 0x5b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x10, 0x5b, 0x60, 0x5b, 0xb0, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xd0, 0x5b, 0x60, 0x5b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x50, 0x5b, 0xa0, 0x5b, 0xf0, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xc0, 0x5b, 0x80, 0x5b, 0x40, 0x5b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x40, 0x5b, 0x70, 0x5b, 0xa0, 0x5b, 0xf0, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xc0, 0x5b, 0xc0, 0x5b, 0xc0, 0x5b, 0xc0, 0x5b, 0xc0, 0x5b, 0xf0, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x10, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x17, 0x10, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x10, 0x00, 0x00, 
-  0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 
-  0x17, 0x20, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x20, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x10, 0x17, 0x80, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x80, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x17, 0x10, 0x17, 0x90, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x90, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x17, 0x30, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x30, 0x00, 0x00, 
-  0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x10, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x30, 
-  0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x00, 0x00, 
-  0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 
-  0x17, 0x10, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x17, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf8, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xfe, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xf8, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf9, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xb0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xb0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0x90, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x17, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x20, 0x17, 0xc0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xc0, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x17, 0xf0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf0, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0xa0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xb0, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x17, 0x80, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x90, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x1b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x1b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x17, 0xe0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xe0, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x7c, 0x05, 0xa0, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0xa0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x7c, 0x05, 0x70, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x40, 0x7c, 0x05, 0x70, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x50, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0x70, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x60, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 
-  0x9d, 0x05, 0x20, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x50, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x70, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xb0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x90, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x30, 0x9f, 0x56, 0x40, 0x9f, 0x56, 0x70, 0x9f, 0x56, 0x80, 0x9f, 0x56, 0x80, 0x9f, 0x56, 0x80, 0x9f, 0x56, 0x80, 0x9f, 0x56, 0x80, 0x9f, 0x56, 0x40, 0x9f, 0x56, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x30, 0x9f, 0x56, 0x80, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xd0, 0x9f, 0x56, 0xb0, 0x9f, 0x56, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x20, 0x9f, 0x56, 0x90, 0x9f, 0x56, 0xe0, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x20, 0x9f, 0x56, 0x70, 0x9f, 0x56, 0xd0, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x10, 0x9f, 0x56, 0x60, 0x9f, 0x56, 0xb0, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xd0, 0x9f, 0x56, 0x60, 0x9f, 0x56, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x50, 0x9f, 0x56, 0xa0, 0x9f, 0x56, 0xf0, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0x80, 0x9f, 0x56, 0x40, 0x9f, 0x56, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x40, 0x9f, 0x56, 0x70, 0x9f, 0x56, 0xa0, 0x9f, 0x56, 0xf0, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0xc0, 0x9f, 0x56, 0xf0, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9e, 0x05, 0x10, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 
-  0x9d, 0x05, 0x20, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0x80, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0x90, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0x90, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x7d, 0x05, 0x30, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9e, 0x05, 0x10, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7d, 0x05, 0x30, 
-  0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x00, 0x00, 0x00, 
-  0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 
-  0x9e, 0x05, 0x10, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7f, 0x4e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x4e, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x3f, 0x3e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x3f, 0x3e, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xde, 0x25, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0xde, 0x25, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x60, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x3f, 0x3e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5f, 0x46, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf8, 0x5f, 0x46, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5f, 0x46, 0xff, 0x7c, 0x0d, 0xfe, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xfe, 0x2d, 0xf8, 0x7f, 0x4e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x4e, 0xff, 0xfe, 0x2d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x0d, 0xf9, 0x3f, 0x3e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x3f, 0x3e, 0xff, 0x9d, 0x0d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x60, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x7f, 0x46, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x46, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0xb0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xfe, 0x2d, 0xff, 0x7f, 0x4e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x4e, 0xff, 0xfe, 0x2d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xb0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x0d, 0xff, 0x3f, 0x3e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x3f, 0x3e, 0xff, 0x9d, 0x0d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x7c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0x90, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x5f, 0x46, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x46, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x30, 0x5c, 0x05, 0xd0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xfe, 0x25, 0xff, 0x7f, 0x4e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x4e, 0xff, 0xfe, 0x2d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xd0, 0x7d, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x0d, 0xff, 0x1e, 0x36, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x1e, 0x36, 0xff, 0x7c, 0x0d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x05, 0x20, 0x7c, 0x05, 0xc0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x5f, 0x46, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5f, 0x46, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xc0, 0x9d, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x60, 0x7c, 0x05, 0xf0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xfe, 0x25, 0xff, 0x7f, 0x4e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x4e, 0xff, 0xfe, 0x25, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0xf0, 0x7c, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x7c, 0x05, 0xa0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x0d, 0xff, 0x1e, 0x36, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x1e, 0x36, 0xff, 0x7c, 0x0d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xb0, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x5f, 0x46, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x5f, 0x46, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x10, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x1d, 0xff, 0xfe, 0x2d, 0xff, 0xfe, 0x2d, 0xff, 0xfe, 0x2d, 0xff, 0xfe, 0x2d, 0xff, 0xbd, 0x1d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x90, 0x9e, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x50, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x0d, 0xff, 0xbd, 0x15, 0xff, 0xbd, 0x15, 0xff, 0xbd, 0x15, 0xff, 0xbd, 0x15, 0xff, 0xbd, 0x15, 0xff, 0xbd, 0x15, 0xff, 0x7c, 0x0d, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x15, 0xff, 0x7f, 0x4e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x4e, 0xff, 0x9d, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7f, 0x46, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x46, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x9d, 0x15, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9d, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7f, 0x4e, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x7f, 0x4e, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xde, 0x25, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0x9f, 0x56, 0xff, 0xde, 0x25, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0xbd, 0x15, 0xff, 0x1e, 0x36, 0xff, 0x3f, 0x3e, 0xff, 0x3f, 0x3e, 0xff, 0x3f, 0x3e, 0xff, 0x3f, 0x3e, 0xff, 0x1e, 0x36, 0xff, 0xbd, 0x15, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x40, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x7c, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x80, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xff, 0x5c, 0x05, 0xe0, 0x5c, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x7c, 0xa0, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0xa0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x7c, 0x70, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x40, 0x05, 0x7c, 0x70, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x50, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0x70, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x60, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 
-  0x05, 0x9d, 0x20, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x50, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x70, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xb0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x90, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9f, 0x30, 0x56, 0x9f, 0x40, 0x56, 0x9f, 0x70, 0x56, 0x9f, 0x80, 0x56, 0x9f, 0x80, 0x56, 0x9f, 0x80, 0x56, 0x9f, 0x80, 0x56, 0x9f, 0x80, 0x56, 0x9f, 0x40, 0x56, 0x9f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9f, 0x30, 0x56, 0x9f, 0x80, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xd0, 0x56, 0x9f, 0xb0, 0x56, 0x9f, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9f, 0x20, 0x56, 0x9f, 0x90, 0x56, 0x9f, 0xe0, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9f, 0x20, 0x56, 0x9f, 0x70, 0x56, 0x9f, 0xd0, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9f, 0x10, 0x56, 0x9f, 0x60, 0x56, 0x9f, 0xb0, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xd0, 0x56, 0x9f, 0x60, 0x56, 0x9f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9f, 0x50, 0x56, 0x9f, 0xa0, 0x56, 0x9f, 0xf0, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0x80, 0x56, 0x9f, 0x40, 0x56, 0x9f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x9f, 0x40, 0x56, 0x9f, 0x70, 0x56, 0x9f, 0xa0, 0x56, 0x9f, 0xf0, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0xc0, 0x56, 0x9f, 0xf0, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x9e, 0x10, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 
-  0x05, 0x9d, 0x20, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0x80, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0x90, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0x90, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x7d, 0x30, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x9e, 0x10, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7d, 0x30, 
-  0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x00, 0x00, 0x00, 
-  0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 
-  0x05, 0x9e, 0x10, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x4e, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x4e, 0x7f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x3e, 0x3f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x3e, 0x3f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x25, 0xde, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x25, 0xde, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x60, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x3e, 0x3f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x46, 0x5f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf8, 0x46, 0x5f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x46, 0x5f, 0xff, 0x0d, 0x7c, 0xfe, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x2d, 0xfe, 0xf8, 0x4e, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x4e, 0x7f, 0xff, 0x2d, 0xfe, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x0d, 0x7c, 0xf9, 0x3e, 0x3f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x3e, 0x3f, 0xff, 0x0d, 0x9d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x60, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x46, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x46, 0x7f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0xb0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x2d, 0xfe, 0xff, 0x4e, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x4e, 0x7f, 0xff, 0x2d, 0xfe, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xb0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x0d, 0x9d, 0xff, 0x3e, 0x3f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x3e, 0x3f, 0xff, 0x0d, 0x9d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x7c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0x90, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x46, 0x5f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x46, 0x7f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x30, 0x05, 0x5c, 0xd0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x25, 0xfe, 0xff, 0x4e, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x4e, 0x7f, 0xff, 0x2d, 0xfe, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xd0, 0x05, 0x7d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x0d, 0x7c, 0xff, 0x36, 0x1e, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x36, 0x1e, 0xff, 0x0d, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d, 0x20, 0x05, 0x7c, 0xc0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x46, 0x5f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x46, 0x5f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xc0, 0x05, 0x9d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x60, 0x05, 0x7c, 0xf0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x25, 0xfe, 0xff, 0x4e, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x4e, 0x7f, 0xff, 0x25, 0xfe, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0xf0, 0x05, 0x7c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x7c, 0xa0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x0d, 0x7c, 0xff, 0x36, 0x1e, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x36, 0x1e, 0xff, 0x0d, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xb0, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x46, 0x5f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x46, 0x5f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9e, 0x10, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x1d, 0xbd, 0xff, 0x2d, 0xfe, 0xff, 0x2d, 0xfe, 0xff, 0x2d, 0xfe, 0xff, 0x2d, 0xfe, 0xff, 0x1d, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x90, 0x05, 0x9e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x50, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x0d, 0x7c, 0xff, 0x15, 0xbd, 0xff, 0x15, 0xbd, 0xff, 0x15, 0xbd, 0xff, 0x15, 0xbd, 0xff, 0x15, 0xbd, 0xff, 0x15, 0xbd, 0xff, 0x0d, 0x7c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0x9d, 0xff, 0x4e, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x4e, 0x7f, 0xff, 0x15, 0x9d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x46, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x46, 0x7f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0x9d, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x15, 0x9d, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x4e, 0x7f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x4e, 0x7f, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x25, 0xde, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x56, 0x9f, 0xff, 0x25, 0xde, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x15, 0xbd, 0xff, 0x36, 0x1e, 0xff, 0x3e, 0x3f, 0xff, 0x3e, 0x3f, 0xff, 0x3e, 0x3f, 0xff, 0x3e, 0x3f, 0xff, 0x36, 0x1e, 0xff, 0x15, 0xbd, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0x40, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x80, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xff, 0x05, 0x5c, 0xe0, 0x05, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xaa, 0x00, 0xa0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe1, 0xaa, 0x00, 0x70, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe3, 0xab, 0x00, 0x40, 0xe1, 0xaa, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe2, 0xac, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xac, 0x00, 0x50, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xaa, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x60, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xac, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xac, 0x00, 0x50, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xaa, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x70, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xb0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0x90, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4f, 0x30, 0xff, 0xcf, 0x4f, 0x40, 0xff, 0xcf, 0x4d, 0x70, 0xff, 0xcf, 0x4d, 0x80, 0xff, 0xcf, 0x4d, 0x80, 0xff, 0xcf, 0x4d, 0x80, 0xff, 0xcf, 0x4d, 0x80, 0xff, 0xcf, 0x4d, 0x80, 0xff, 0xcf, 0x4f, 0x40, 0xff, 0xcf, 0x4f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4f, 0x30, 0xff, 0xcf, 0x4d, 0x80, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfe, 0xcf, 0x4c, 0xd0, 0xfe, 0xcf, 0x4c, 0xb0, 0xff, 0xcf, 0x4d, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4f, 0x20, 0xff, 0xcf, 0x4c, 0x90, 0xff, 0xcf, 0x4c, 0xe0, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4f, 0x20, 0xff, 0xcf, 0x4d, 0x70, 0xfe, 0xcf, 0x4c, 0xd0, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4f, 0x10, 0xff, 0xcf, 0x4d, 0x60, 0xfe, 0xcf, 0x4c, 0xb0, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfe, 0xcf, 0x4c, 0xd0, 0xff, 0xcf, 0x4d, 0x60, 0xff, 0xcf, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4c, 0x50, 0xff, 0xcf, 0x4c, 0xa0, 0xff, 0xcf, 0x4c, 0xf0, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4d, 0x80, 0xff, 0xcf, 0x4f, 0x40, 0xff, 0xcf, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4f, 0x40, 0xff, 0xcf, 0x4d, 0x70, 0xff, 0xcf, 0x4c, 0xa0, 0xff, 0xcf, 0x4c, 0xf0, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4d, 0xc0, 0xff, 0xcf, 0x4c, 0xf0, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-  0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe1, 0xa9, 0x00, 0x80, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0x90, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xaa, 0x00, 0x90, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xef, 0xaf, 0x00, 0x10, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xaa, 0x00, 0x30, 
-  0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-  0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf5, 0xc3, 0x34, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf5, 0xc3, 0x34, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xec, 0xb7, 0x1c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xec, 0xb7, 0x1c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x60, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xf7, 0xc5, 0x39, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf9, 0xc8, 0x3e, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xaa, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xaa, 0x02, 0xf8, 0xf9, 0xc8, 0x3e, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf9, 0xc8, 0x3e, 0xff, 0xe2, 0xab, 0x04, 0xfe, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xef, 0xbb, 0x25, 0xf8, 0xfd, 0xcd, 0x47, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xad, 0x08, 0xf9, 0xf5, 0xc3, 0x34, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf5, 0xc3, 0x34, 0xff, 0xe4, 0xae, 0x09, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x60, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xfb, 0xca, 0x42, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfb, 0xca, 0x42, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe1, 0xaa, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xa9, 0x00, 0xb0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xb0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe4, 0xae, 0x09, 0xff, 0xf5, 0xc3, 0x34, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf5, 0xc3, 0x34, 0xff, 0xe4, 0xae, 0x09, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe2, 0xac, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0x90, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xf9, 0xc8, 0x3e, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfb, 0xca, 0x42, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xaa, 0x00, 0x30, 0xe0, 0xa9, 0x00, 0xd0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xed, 0xba, 0x21, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xd0, 0xe4, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xab, 0x04, 0xff, 0xf3, 0xc1, 0x2f, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf3, 0xc1, 0x2f, 0xff, 0xe2, 0xab, 0x04, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xaf, 0x00, 0x20, 0xe0, 0xaa, 0x00, 0xc0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xf9, 0xc8, 0x3e, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf9, 0xc8, 0x3e, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xc0, 0xe7, 0xaf, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaa, 0x00, 0x60, 0xe0, 0xaa, 0x00, 0xf0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xed, 0xba, 0x21, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xed, 0xba, 0x21, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0xf0, 0xe1, 0xaa, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe0, 0xaa, 0x00, 0xa0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xab, 0x04, 0xff, 0xf3, 0xc1, 0x2f, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf3, 0xc1, 0x2f, 0xff, 0xe2, 0xab, 0x04, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xb0, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xf9, 0xc8, 0x3e, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xf9, 0xc8, 0x3e, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xaf, 0x00, 0x10, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xea, 0xb5, 0x18, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xef, 0xbc, 0x26, 0xff, 0xea, 0xb5, 0x18, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xaa, 0x00, 0x90, 0xef, 0xaf, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xac, 0x00, 0x50, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xac, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe2, 0xab, 0x04, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe2, 0xab, 0x04, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe6, 0xb0, 0x0e, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xe6, 0xb0, 0x0e, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfb, 0xca, 0x42, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfb, 0xca, 0x42, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe6, 0xb0, 0x0e, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe6, 0xb0, 0x0e, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xfd, 0xcd, 0x47, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xec, 0xb7, 0x1c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xff, 0xcf, 0x4c, 0xff, 0xec, 0xb7, 0x1c, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xf3, 0xc1, 0x2f, 0xff, 0xf7, 0xc5, 0x39, 0xff, 0xf7, 0xc5, 0x39, 0xff, 0xf7, 0xc5, 0x39, 0xff, 0xf7, 0xc5, 0x39, 0xff, 0xf3, 0xc1, 0x2f, 0xff, 0xe8, 0xb2, 0x13, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xab, 0x00, 0x40, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe3, 0xab, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa9, 0x00, 0x80, 0xe0, 0xa9, 0x00, 0xe0, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xff, 0xe0, 0xa9, 0x00, 0xe0, 0xe1, 0xa9, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t icon_bottle_75 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 67,
-  .header.h = 115,
-  .data_size = 7705 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = icon_bottle_75_map,
-};
@@ -1,137 +0,0 @@
-#include "lvgl/lvgl.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_ICON_COG
-#define LV_ATTRIBUTE_IMG_ICON_COG
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ICON_COG uint8_t icon_cog_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x50, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xbf, 0x6e, 0xff, 0x6d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xef, 0x6e, 0xff, 0x6d, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6d, 0x60, 0x6e, 0xff, 0x6e, 0x9f, 0x6d, 0x40, 0x00, 0x00, 0x6d, 0x20, 0x6d, 0xbf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xcf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x9f, 0x6d, 0x20, 0x00, 0x00, 0x6d, 0x40, 0x6d, 0xbf, 0x6e, 0xff, 0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x6d, 0x20, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0xef, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xef, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xef, 0x6d, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x6d, 0x90, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xbf, 0x6e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3f, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x8f, 0x00, 0x00, 
-  0x6d, 0x20, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x20, 0x6d, 0x8f, 0x6d, 0xdf, 0x6d, 0xef, 0x6d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x6d, 0x20, 0x6d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x60, 0x6d, 0xef, 0x6d, 0xef, 0x6d, 0x7f, 0x6d, 0x20, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x30, 
-  0x6d, 0xcf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x6d, 0x10, 0x6e, 0x80, 0x6d, 0xef, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xef, 0x6e, 0x9f, 0x6d, 0x20, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x70, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xbf, 
-  0x6d, 0xcf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x20, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x80, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xbf, 
-  0x00, 0x00, 0x6d, 0x7f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xaf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x8f, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6d, 0x50, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xbf, 0x00, 0x00, 0x6d, 0x20, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x6d, 0xcf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x10, 0x00, 0x00, 0x6d, 0xcf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x50, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xaf, 0x00, 0x00, 0x6d, 0x50, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x60, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x5f, 0x00, 0x00, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x00, 0x00, 0x6d, 0x60, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x4f, 0x00, 0x00, 0x6e, 0xaf, 0x6e, 0xff, 0x6e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6d, 0x40, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xcf, 0x00, 0x00, 0x6d, 0x10, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xcf, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x20, 0x00, 0x00, 0x6d, 0xbf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x50, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x6d, 0x90, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xbf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0xcf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xa0, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x80, 0x00, 0x00, 
-  0x6d, 0xbf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x20, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xcf, 
-  0x6d, 0xbf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x6d, 0x20, 0x6d, 0x9f, 0x6d, 0xef, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xef, 0x6d, 0x7f, 0x6d, 0x10, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7f, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xcf, 
-  0x6d, 0x30, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x20, 0x6e, 0x80, 0x6d, 0xef, 0x6d, 0xef, 0x6e, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x30, 0x6e, 0x1f, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x50, 0x6d, 0xef, 0x6d, 0xdf, 0x6e, 0x8f, 0x6d, 0x20, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x20, 
-  0x00, 0x00, 0x6d, 0x8f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x9f, 0x6d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x40, 0x6d, 0xbf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x00, 0x00, 
-  0x00, 0x00, 0x6d, 0x10, 0x6d, 0xef, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xef, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xa0, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xef, 0x6d, 0xdf, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0x6d, 0x20, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6d, 0x70, 0x6e, 0xff, 0x6d, 0xbf, 0x6e, 0x3f, 0x00, 0x00, 0x6d, 0x20, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xbf, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xbf, 0x6d, 0x20, 0x00, 0x00, 0x6e, 0x3f, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0x5f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xcf, 0x6e, 0xff, 0x6d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xef, 0x6e, 0xff, 0x6d, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x9f, 0x6e, 0x9f, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x40, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x50, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x6f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x60, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xcf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x40, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0c, 0x63, 0x90, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x3f, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x8f, 0x00, 0x00, 0x00, 
-  0x0c, 0x63, 0x20, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0x8f, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x60, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0x7f, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x30, 
-  0x0c, 0x63, 0xcf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x0c, 0x63, 0x80, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x70, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 
-  0x0c, 0x63, 0xcf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x80, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 
-  0x00, 0x00, 0x00, 0x0c, 0x63, 0x7f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x6f, 0x0c, 0x63, 0x6f, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xaf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x8f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x50, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x0c, 0x63, 0xcf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xcf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xaf, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x50, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x60, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x5f, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x60, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x6f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x4f, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xaf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x40, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xcf, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xcf, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0c, 0x63, 0x90, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x6f, 0x0c, 0x63, 0x6f, 0x0c, 0x63, 0xcf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xa0, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x80, 0x00, 0x00, 0x00, 
-  0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x7f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xcf, 
-  0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0x7f, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x7f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xcf, 
-  0x0c, 0x63, 0x30, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0x80, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x30, 0x2c, 0x63, 0x1f, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x50, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x8f, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x20, 
-  0x00, 0x00, 0x00, 0x0c, 0x63, 0x8f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x40, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xa0, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xdf, 0x0c, 0x63, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x70, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0x3f, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x20, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 0x0c, 0x63, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x3f, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xcf, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0xef, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0x9f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x6f, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x40, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x50, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x6f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x60, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0x40, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xcf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x40, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x63, 0x0c, 0x90, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x3f, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x8f, 0x00, 0x00, 0x00, 
-  0x63, 0x0c, 0x20, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0x8f, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x60, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0x7f, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x30, 
-  0x63, 0x0c, 0xcf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x63, 0x0c, 0x80, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x70, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 
-  0x63, 0x0c, 0xcf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x80, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 
-  0x00, 0x00, 0x00, 0x63, 0x0c, 0x7f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x6f, 0x63, 0x0c, 0x6f, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xaf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x8f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x50, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x63, 0x0c, 0xcf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xcf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xaf, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x50, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x60, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x5f, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x60, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x6f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x4f, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xaf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x40, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xcf, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xcf, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x63, 0x0c, 0x90, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x6f, 0x63, 0x0c, 0x6f, 0x63, 0x0c, 0xcf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xa0, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x80, 0x00, 0x00, 0x00, 
-  0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x7f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xcf, 
-  0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0x7f, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x7f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xcf, 
-  0x63, 0x0c, 0x30, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0x80, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x30, 0x63, 0x2c, 0x1f, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x50, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x8f, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x20, 
-  0x00, 0x00, 0x00, 0x63, 0x0c, 0x8f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x40, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xa0, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xdf, 0x63, 0x0c, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x70, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0x3f, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x20, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 0x63, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x3f, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xcf, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0xef, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0x9f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x6f, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x40, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x50, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x6f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x60, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0x9f, 0x5f, 0x5f, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xcf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0x9f, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x40, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x90, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x3f, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0x8f, 0x00, 0x00, 0x00, 0x00, 
-  0x5f, 0x5f, 0x5f, 0x20, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0x8f, 0x60, 0x60, 0x60, 0xdf, 0x60, 0x60, 0x60, 0xef, 0x5f, 0x5f, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x5f, 0x5f, 0x5f, 0x20, 0x5f, 0x5f, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x60, 0x60, 0xef, 0x60, 0x60, 0x60, 0xef, 0x60, 0x60, 0x60, 0x7f, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x30, 
-  0x60, 0x60, 0x60, 0xcf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x61, 0x61, 0x61, 0x80, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x62, 0x62, 0x62, 0x9f, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62, 0x70, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 
-  0x60, 0x60, 0x60, 0xcf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x80, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x7f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x60, 0x60, 0x60, 0x6f, 0x60, 0x60, 0x60, 0x6f, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62, 0xaf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x8f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x50, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x20, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x60, 0x60, 0x60, 0xcf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xcf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x50, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x60, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x60, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x6f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62, 0xaf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x40, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xcf, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x90, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x60, 0x60, 0x60, 0x6f, 0x60, 0x60, 0x60, 0x6f, 0x60, 0x60, 0x60, 0xcf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xa0, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x7f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xcf, 
-  0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0x9f, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x60, 0x60, 0x60, 0x7f, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x7f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xcf, 
-  0x5f, 0x5f, 0x5f, 0x30, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x5f, 0x5f, 0x5f, 0x20, 0x61, 0x61, 0x61, 0x80, 0x60, 0x60, 0x60, 0xef, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x30, 0x63, 0x63, 0x63, 0x1f, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x50, 0x60, 0x60, 0x60, 0xef, 0x60, 0x60, 0x60, 0xdf, 0x62, 0x62, 0x62, 0x8f, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0x20, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x8f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0x9f, 0x5f, 0x5f, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x40, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xa0, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x60, 0x60, 0x60, 0xdf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xdf, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x70, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x20, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xbf, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x3f, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xcf, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xef, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0x9f, 0x62, 0x62, 0x62, 0x9f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x6f, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0x40, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t icon_cog = {
-  .header.always_zero = 0,
-  .header.w = 26,
-  .header.h = 26,
-  .data_size = 676 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = icon_cog_map,
-};
-
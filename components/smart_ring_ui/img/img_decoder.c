@@ -0,0 +1,349 @@
+/**
+ * @file img_decoder.c
+ * @brief LVGL decoder of the RLE images generated by tools/img_assets.py. The
+ * images are decoded once into a cache sized by CONFIG_SR_UI_IMG_CACHE_SIZE
+ * and drawn from there, so swapping the bottle levels or the signal bars
+ * doesn't decode them again. The images that don't fit are decoded for each
+ * draw, or a row at a time while drawn when there's no memory for them
+ * @version 2.1.2
+ * @date 2024-11-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "img_decoder.h"
+
+#include <stdlib.h>
+
+#include "esp_log.h"
+
+static const char *TAG = "UI_IMG";
+
+/**
+ * @brief  Decoded image, kept after it's closed until its room is needed
+ */
+struct img_cache_entry_t {
+  const lv_img_dsc_t *src;
+  uint8_t *data;
+  uint32_t size;
+  uint32_t used;
+  uint16_t opened;
+};
+
+/**
+ * @brief  Image decoded a row at a time, the rows are read top to bottom
+ */
+struct img_line_t {
+  const uint8_t *runs;
+  lv_coord_t row;
+  lv_coord_t decoded_row;
+  uint8_t *pixels;
+  uint8_t palette[];
+};
+
+static struct img_cache_entry_t img_cache[IMG_CACHE_ENTRIES];
+static struct img_cache_stats_t img_cache_stats;
+// Opens of the images, to find the least recently used one
+static uint32_t img_cache_clock = 0;
+
+/**
+ * @brief  Size of a decoded pixel
+ */
+static inline uint8_t img_px_size(bool alpha) {
+  return alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : LV_COLOR_SIZE / 8;
+}
+
+/**
+ * @brief  Write a pixel of the encoded data in the LVGL format
+ * @param  *dst: Decoded pixel
+ * @param  *src: RGB565 color in little endian, followed by the alpha byte if any
+ * @param  alpha: Whether the pixel has an alpha byte
+ * @retval None
+ */
+static inline void img_put_px(uint8_t *dst, const uint8_t *src, bool alpha) {
+  uint16_t rgb565 = src[0] | (src[1] << 8);
+  lv_color_t color;
+
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+  color.full = rgb565;
+#elif LV_COLOR_DEPTH == 16
+  color.full = (rgb565 >> 8) | (rgb565 << 8);
+#else
+  color = lv_color_make((rgb565 >> 8) & 0xF8, (rgb565 >> 3) & 0xFC, (rgb565 << 3) & 0xF8);
+#endif
+
+  memcpy(dst, &color, sizeof(color));
+  if (alpha) {
+    dst[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = src[2];
+  }
+}
+
+/**
+ * @brief  Decode the palette of an indexed image
+ * @param  *header: Header of the image, followed by the palette
+ * @param  *palette: Filled with the decoded pixels of the palette
+ * @retval Runs of the first row
+ */
+static const uint8_t *img_decode_palette(const img_rle_header_t *header, uint8_t *palette) {
+  const uint8_t *src = (const uint8_t *)(header + 1);
+  uint8_t px_size = img_px_size(header->alpha);
+  uint8_t entry_size = header->alpha ? 3 : 2;
+
+  for (int i = 0; i < header->colors; i++) {
+    img_put_px(&palette[i * px_size], src, header->alpha);
+    src += entry_size;
+  }
+
+  return src;
+}
+
+/**
+ * @brief  Decode the runs of a row
+ * @param  *header: Header of the image
+ * @param  *runs: Runs of the row
+ * @param  *dst: Filled with the pixels of the row, NULL to skip the row
+ * @param  width: Pixels of a row
+ * @param  *palette: Decoded palette, for an indexed image
+ * @retval Runs of the next row
+ */
+static const uint8_t *img_decode_row(const img_rle_header_t *header, const uint8_t *runs, uint8_t *dst,
+                                     lv_coord_t width, const uint8_t *palette) {
+  bool indexed = header->format == IMG_RLE_INDEXED;
+  uint8_t px_size = img_px_size(header->alpha);
+  uint8_t item_size = indexed ? 1 : (header->alpha ? 3 : 2);
+
+  for (lv_coord_t x = 0; x < width;) {
+    uint8_t control = *runs++;
+    bool repeat = control & 0x80;
+    lv_coord_t count = LV_MATH_MIN((control & 0x7F) + 1, width - x);
+
+    if (dst == NULL) {
+      runs += repeat ? item_size : count * item_size;
+    } else if (repeat) {
+      if (indexed) {
+        memcpy(dst, &palette[*runs * px_size], px_size);
+      } else {
+        img_put_px(dst, runs, header->alpha);
+      }
+      for (lv_coord_t i = 1; i < count; i++) {
+        memcpy(&dst[i * px_size], dst, px_size);
+      }
+      runs += item_size;
+      dst += count * px_size;
+    } else {
+      for (lv_coord_t i = 0; i < count; i++) {
+        if (indexed) {
+          memcpy(dst, &palette[*runs * px_size], px_size);
+        } else {
+          img_put_px(dst, runs, header->alpha);
+        }
+        runs += item_size;
+        dst += px_size;
+      }
+    }
+    x += count;
+  }
+
+  return runs;
+}
+
+/**
+ * @brief  Get the room for a decoded image, dropping the least recently used
+ *         images that aren't open
+ * @param  size: Size of the decoded image
+ * @retval Entry of the image, NULL if it doesn't fit
+ */
+static struct img_cache_entry_t *img_cache_alloc(uint32_t size) {
+  const uint32_t capacity = CONFIG_SR_UI_IMG_CACHE_SIZE * 1024;
+
+  if (size > capacity) {
+    return NULL;
+  }
+
+  for (;;) {
+    struct img_cache_entry_t *free_entry = NULL;
+    struct img_cache_entry_t *oldest = NULL;
+
+    for (int i = 0; i < IMG_CACHE_ENTRIES; i++) {
+      struct img_cache_entry_t *entry = &img_cache[i];
+      if (entry->src == NULL) {
+        free_entry = free_entry ? free_entry : entry;
+      } else if (entry->opened == 0 && (oldest == NULL || entry->used < oldest->used)) {
+        oldest = entry;
+      }
+    }
+
+    if (free_entry != NULL && img_cache_stats.used + size <= capacity) {
+      free_entry->data = malloc(size);
+      if (free_entry->data == NULL) {
+        ESP_LOGW(TAG, "No memory to decode an image of %u bytes", size);
+        return NULL;
+      }
+      free_entry->size = size;
+      img_cache_stats.used += size;
+      img_cache_stats.images++;
+      return free_entry;
+    }
+
+    // The images open are being drawn, the others are dropped oldest first
+    if (oldest == NULL) {
+      return NULL;
+    }
+    free(oldest->data);
+    img_cache_stats.used -= oldest->size;
+    img_cache_stats.images--;
+    img_cache_stats.evictions++;
+    memset(oldest, 0, sizeof(*oldest));
+  }
+}
+
+/**
+ * @brief  Get the header of the image, decoded to LVGL true color
+ */
+static lv_res_t img_decoder_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+  (void)decoder;
+
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+    return LV_RES_INV;
+  }
+
+  const lv_img_dsc_t *img = src;
+  if (img->header.cf != IMG_RLE_CF) {
+    return LV_RES_INV;
+  }
+
+  const img_rle_header_t *rle = (const img_rle_header_t *)img->data;
+  header->w           = img->header.w;
+  header->h           = img->header.h;
+  header->always_zero = 0;
+  header->cf          = rle->alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+
+  return LV_RES_OK;
+}
+
+/**
+ * @brief  Decode the image, into the cache if it fits, or prepare to decode it
+ *         a row at a time if there's no memory for it
+ */
+static lv_res_t img_decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  (void)decoder;
+
+  const lv_img_dsc_t *img = dsc->src;
+  const img_rle_header_t *rle = (const img_rle_header_t *)img->data;
+  uint8_t px_size = img_px_size(rle->alpha);
+  lv_coord_t width = img->header.w;
+
+  img_cache_clock++;
+  for (int i = 0; i < IMG_CACHE_ENTRIES; i++) {
+    if (img_cache[i].src == img) {
+      img_cache[i].opened++;
+      img_cache[i].used = img_cache_clock;
+      img_cache_stats.hits++;
+      dsc->img_data = img_cache[i].data;
+      return LV_RES_OK;
+    }
+  }
+
+  // Decoded into the cache, or for this draw only when the cache is full of
+  // open images. LVGL can only zoom the images decoded whole
+  uint32_t size = (uint32_t)width * img->header.h * px_size;
+  struct img_cache_entry_t *entry = img_cache_alloc(size);
+  uint8_t *data = entry != NULL ? entry->data : malloc(size);
+  img_cache_stats.misses++;
+
+  if (data != NULL) {
+    // Only used while decoding, by the UI task
+    static uint8_t palette[256 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    const uint8_t *runs = img_decode_palette(rle, palette);
+
+    for (lv_coord_t y = 0; y < img->header.h; y++) {
+      runs = img_decode_row(rle, runs, &data[y * width * px_size], width, palette);
+    }
+
+    if (entry != NULL) {
+      entry->src    = img;
+      entry->opened = 1;
+      entry->used   = img_cache_clock;
+    }
+    dsc->img_data = data;
+    return LV_RES_OK;
+  }
+
+  struct img_line_t *line = lv_mem_alloc(sizeof(*line) + (rle->colors + width) * px_size);
+  if (line == NULL) {
+    return LV_RES_INV;
+  }
+  line->runs        = img_decode_palette(rle, line->palette);
+  line->row         = 0;
+  line->decoded_row = -1;
+  line->pixels      = &line->palette[rle->colors * px_size];
+  img_cache_stats.lines++;
+  dsc->user_data = line;
+
+  return LV_RES_OK;
+}
+
+/**
+ * @brief  Read a part of a row of an image decoded a row at a time
+ */
+static lv_res_t img_decoder_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc, lv_coord_t x,
+                                      lv_coord_t y, lv_coord_t len, uint8_t *buf) {
+  (void)decoder;
+
+  const lv_img_dsc_t *img = dsc->src;
+  const img_rle_header_t *rle = (const img_rle_header_t *)img->data;
+  struct img_line_t *line = dsc->user_data;
+  uint8_t px_size = img_px_size(rle->alpha);
+
+  if (line->decoded_row != y) {
+    // The runs don't go backwards, start again from the first row
+    if (y < line->row) {
+      line->runs = img_decode_palette(rle, line->palette);
+      line->row  = 0;
+    }
+    for (; line->row < y; line->row++) {
+      line->runs = img_decode_row(rle, line->runs, NULL, img->header.w, NULL);
+    }
+    line->runs = img_decode_row(rle, line->runs, line->pixels, img->header.w, line->palette);
+    line->row++;
+    line->decoded_row = y;
+  }
+
+  memcpy(buf, &line->pixels[x * px_size], len * px_size);
+  return LV_RES_OK;
+}
+
+/**
+ * @brief  Keep the decoded image in the cache, free the others
+ */
+static void img_decoder_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  (void)decoder;
+
+  if (dsc->user_data != NULL) {
+    lv_mem_free(dsc->user_data);
+    dsc->user_data = NULL;
+    return;
+  }
+
+  for (int i = 0; i < IMG_CACHE_ENTRIES; i++) {
+    if (img_cache[i].data != NULL && img_cache[i].data == dsc->img_data) {
+      img_cache[i].opened--;
+      return;
+    }
+  }
+  free((void *)dsc->img_data);
+}
+
+void img_decoder_init(void) {
+  lv_img_decoder_t *decoder = lv_img_decoder_create();
+
+  lv_img_decoder_set_info_cb(decoder, img_decoder_info);
+  lv_img_decoder_set_open_cb(decoder, img_decoder_open);
+  lv_img_decoder_set_read_line_cb(decoder, img_decoder_read_line);
+  lv_img_decoder_set_close_cb(decoder, img_decoder_close);
+}
+
+void img_decoder_get_stats(struct img_cache_stats_t *stats) {
+  *stats = img_cache_stats;
+}
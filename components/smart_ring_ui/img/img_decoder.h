@@ -0,0 +1,72 @@
+/**
+ * @file img_decoder.h
+ * @brief Decoder of the RLE images header
+ * @version 2.1.2
+ * @date 2024-11-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef __IMG_DECODER_H_
+#define __IMG_DECODER_H_
+
+#include "lvgl.h"
+
+/* Color format of the images converted by tools/img_assets.py */
+#define IMG_RLE_CF        LV_IMG_CF_USER_ENCODED_0
+/* Runs of palette indexes, after the palette */
+#define IMG_RLE_INDEXED   1
+/* Runs of RGB565 pixels, with their alpha byte if any */
+#define IMG_RLE_RAW       2
+/* Images kept decoded at most */
+#define IMG_CACHE_ENTRIES 16
+
+/**
+ * @brief  Header of the data of an RLE image, followed by the palette and the
+ *         runs of the rows. A run starts with a control byte: (count - 1) | 0x80
+ *         for a repeated pixel, count - 1 for that many different pixels
+ * @param format   IMG_RLE_INDEXED or IMG_RLE_RAW
+ * @param alpha    1 when the pixels have an alpha byte
+ * @param colors   Entries of the palette, RGB565 in little endian and the
+ *                 alpha byte if any
+ */
+typedef struct img_rle_header_t {
+  uint8_t  format;
+  uint8_t  alpha;
+  uint16_t colors;
+} img_rle_header_t;
+
+/**
+ * @brief  Statistics of the cache of decoded images
+ * @param hits       Opens of an image already decoded
+ * @param misses     Opens decoding the image
+ * @param evictions  Images dropped to make room for another
+ * @param lines      Opens without the memory to decode the image, decoded a
+ *                   row at a time while drawn
+ * @param used       Memory of the decoded images (bytes)
+ * @param images     Images decoded
+ */
+typedef struct img_cache_stats_t {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+  uint32_t lines;
+  uint32_t used;
+  uint8_t  images;
+} img_cache_stats_t;
+
+/**
+ * @brief  Register the decoder of the RLE images with LVGL, after lv_init
+ * @retval None
+ */
+void img_decoder_init(void);
+
+/**
+ * @brief  Get the statistics of the cache of decoded images
+ * @param  *stats: Filled with the statistics
+ * @retval None
+ */
+void img_decoder_get_stats(struct img_cache_stats_t *stats);
+
+#endif
@@ -43,7 +43,7 @@ static void boot_menu_select_communication_handler(lv_obj_t *button, lv_event_t
 
     switch (communication) {
       case 'w': smart_ring_ui_set_connection_type('w');
-                smart_ring_ui_get_controller()->flags.flag.select_communication = true;
+                smart_ring_ui_send_request(UI_REQUEST_SELECT_COMMUNICATION);
                 break;
       default:  break;
     }
@@ -69,11 +69,11 @@ static void boot_reset_wifi(lv_obj_t *button, lv_event_t event) {
 #endif
       esp_timer_stop(smart_ring_ui_get_controller()->timer);
       modal_create_template(lv_scr_act(), smart_ring_ui_get_controller(), "Reset Wi-Fi", "Por favor aguarde", true);
-      smart_ring_ui_get_controller()->flags.flag.reset_wifi = true;
+      smart_ring_ui_send_request(UI_REQUEST_RESET_WIFI);
   }
 }
 
-void boot_update_warning_label(char *text) {
+void boot_update_warning_label(const char *text) {
   lv_label_set_text(warning_label, text);
 }
 
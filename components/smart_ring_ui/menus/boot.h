@@ -21,7 +21,7 @@
  *
  * @param text - Message to be written on screen
  */
-void boot_update_warning_label(char *text);
+void boot_update_warning_label(const char *text);
 
 /**
  * @brief
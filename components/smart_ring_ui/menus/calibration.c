@@ -25,7 +25,7 @@ LV_IMG_DECLARE(spinner_check)
 static void smart_ring_calibration_no_bottle_check_handler(lv_obj_t *button, lv_event_t event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-    smart_ring_ui_get_controller()->flags.flag.start_calibration = true;
+    smart_ring_ui_send_request(UI_REQUEST_START_CALIBRATION);
     smart_ring_ui_update_state(STATE_30);
   }
 }
@@ -34,7 +34,7 @@ static void smart_ring_calibration_full_bottle_check_handler(lv_obj_t *button, l
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
     smart_ring_ui_update_state(STATE_30);
-    smart_ring_ui_get_controller()->flags.flag.empty_calibration = true;
+    smart_ring_ui_send_request(UI_REQUEST_EMPTY_CALIBRATION);
   }
 }
 
@@ -43,7 +43,7 @@ static void smart_ring_calibration_cancel_handler(lv_obj_t *button, lv_event_t e
      // esp_restart();
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
     smart_ring_ui_update_state(STATE_28);
-    smart_ring_ui_get_controller()->flags.flag.cancel_calibration = true;
+    smart_ring_ui_send_request(UI_REQUEST_CANCEL_CALIBRATION);
   }
 }
 
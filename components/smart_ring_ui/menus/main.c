@@ -53,6 +53,13 @@ static lv_obj_t *eta_label         = NULL;
 static lv_obj_t *main_bottle_img   = NULL;
 static lv_obj_t *label_stock       = NULL;
 static lv_obj_t *delivery_mode_img = NULL;
+static bool      main_new_version  = false;  // The screen was created with the update button
+
+// Dashboard variables
+static lv_obj_t *dashboard_tabview     = NULL;
+static lv_obj_t *dashboard_label_stock = NULL;
+static bool      dashboard_is_admin    = false;  // Roles the order tab was created for
+static bool      dashboard_is_master   = false;
 
 // Support variables
 static struct smart_ring_support_option_t support_options[] = {
@@ -72,9 +79,9 @@ static uint8_t support_pages = 1;
 static void main_support_view_option_select_handler(lv_obj_t *button, lv_event_t event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-#ifndef NDEBUG
-
     struct smart_ring_support_option_t *option = lv_obj_get_user_data(button);
+
+#ifndef NDEBUG
     printf("Support type: "
            "%d\n",
            option->type);
@@ -156,7 +163,7 @@ static void main_support_view_previous_page_handler(lv_obj_t *button, lv_event_t
 static void main_sign_in_event_handler(lv_obj_t *button, lv_event_t event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-    smart_ring_ui_get_controller()->flags.flag.start_login          = true;
+    smart_ring_ui_send_request(UI_REQUEST_START_LOGIN);
   }
 }
 
@@ -166,7 +173,7 @@ static void main_update_event_handler(lv_obj_t *button, lv_event_t event) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
     smart_ring_ui_update_state(STATE_34);
 
-    smart_ring_ui_get_controller()->flags.flag.update_firmware      = true;
+    smart_ring_ui_send_request(UI_REQUEST_UPDATE_FIRMWARE);
   }
 }
 
@@ -215,7 +222,7 @@ static void order_tab_order_mode_handler(lv_obj_t *button, lv_event_t event) {
 static void order_tab_manage_order_handler(lv_obj_t *button, lv_event_t event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-    smart_ring_ui_get_controller()->flags.flag.manage_orders        = true;
+    smart_ring_ui_send_request(UI_REQUEST_MANAGE_ORDERS);
     modal_create_template(lv_scr_act(), smart_ring_ui_get_controller(), "Encomendas", "A verificar encomendas", true);
 
     smart_ring_ui_get_controller()->timer_type = REQUESTING_ORDERS;
@@ -229,7 +236,7 @@ static void stock_tab_add_bottle_handler(lv_obj_t *button, lv_event_t event) {
 #ifndef NDEBUG
     ESP_LOGI(TAG, "Adding new stock bottle");
 #endif
-    int stock = atoi(lv_label_get_text(label_stock));
+    int stock = atoi(lv_label_get_text(dashboard_label_stock));
 #ifndef NDEBUG
     ESP_LOGI(TAG, "Updating bottle stock %d", stock);
 #endif
@@ -242,7 +249,7 @@ static void stock_tab_add_bottle_handler(lv_obj_t *button, lv_event_t event) {
 static void stock_tab_remove_bottle_handler(lv_obj_t *button, lv_event_t event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-    int stock = atoi(lv_label_get_text(label_stock));
+    int stock = atoi(lv_label_get_text(dashboard_label_stock));
     main_update_stock(stock == 0 ? 0 : stock - 1);
   }
 }
@@ -276,7 +283,6 @@ static void smart_ring_ui_debug_update_handler(lv_obj_t *button, lv_event_t even
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
     smart_ring_ui_update_state(STATE_43);
-    smart_ring_ui_get_controller()->flags.flag.update = true;
   }
 }
 
@@ -284,8 +290,9 @@ static void smart_ring_ui_debug_update_handler(lv_obj_t *button, lv_event_t even
 void smart_ring_ui_check_handler(lv_obj_t *button, lv_event_t event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-    smart_ring_ui_get_controller()->flags.flag.check_option = true;
 
+    struct smart_ring_ui_event_t check = {.type = UI_EVENT_CHECK_OPTION};
+    smart_ring_ui_post_event(&check);
   }
 }
 
@@ -313,7 +320,7 @@ static void main_tabview_screen_change_handler(lv_obj_t *tabview, lv_event_t eve
     } else {
       smart_ring_ui_get_controller()->state = 11;
     }
-    lv_label_set_text_fmt(label_stock, "%d", smart_ring_ui_get_controller()->stock);
+    smart_ring_ui_label_set_text_fmt(dashboard_label_stock, "%d", smart_ring_ui_get_controller()->stock);
     is_stock_tabview = false;
   } else {
     smart_ring_ui_get_controller()->state = 13;
@@ -324,7 +331,7 @@ static void main_tabview_screen_change_handler(lv_obj_t *tabview, lv_event_t eve
 
 
 void smart_ring_ui_main_update_stock_value(int stock) {
-  lv_label_set_text_fmt(label_stock, "%d", stock);
+  smart_ring_ui_label_set_text_fmt(label_stock, "#979797 %d#", stock);
 }
 
 
@@ -334,7 +341,7 @@ void smart_ring_ui_main_clear_next_eta(void) {
   }
 
   lv_obj_set_style_local_text_color(eta_label, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, lv_color_make(0x97, 0x97, 0x97));
-  lv_label_set_text(
+  smart_ring_ui_label_set_text(
       eta_label, "Não existem encomendas pendentes                          "
                  "                                                      ");
   lv_label_set_long_mode(eta_label, LV_LABEL_LONG_SROLL_CIRC);
@@ -381,11 +388,14 @@ void smart_ring_ui_main_update_next_eta(void) {
 #endif
 
   lv_obj_set_style_local_text_color(eta_label, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, lv_color_make(0x33, 0x33, 0x33));
-  lv_label_set_text_fmt(eta_label, "Próxima entrega : %d/%d", day, month);
+  char eta[32];
+  snprintf(eta, sizeof(eta), "Próxima entrega : %d/%d", day, month);
+  smart_ring_ui_label_set_text(eta_label, eta);
   lv_label_set_long_mode(eta_label, LV_LABEL_LONG_EXPAND);
 }
 
 void main_create_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller) {
+  main_new_version = ui_controller->newVersion;
   lv_obj_add_style(parent, LV_PAGE_PART_BG, &(ui_controller->styles.blank_page));
 
   /*********
@@ -450,9 +460,8 @@ void main_create_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_
   label_stock = lv_label_create(header, NULL);
   lv_label_set_recolor(label_stock, true);
   lv_label_set_text(label_stock, aux_stock);
-  lv_obj_set_width(label_stock, 14);
+  smart_ring_ui_label_set_fixed_width(label_stock, 30, LV_LABEL_ALIGN_LEFT);
   lv_obj_align(label_stock, NULL, LV_ALIGN_IN_LEFT_MID, 222, 0);
-  lv_label_set_align(label_stock, LV_LABEL_ALIGN_LEFT);
 
   /*********
    * Footer
@@ -727,9 +736,9 @@ static void main_create_stock_view(lv_obj_t *parent, struct smart_ring_ui_contro
   lv_obj_align(cont_stock, cont_bottle, LV_ALIGN_OUT_LEFT_MID, -14, 6);
   // lv_obj_align(cont_stock, cont_bottle, LV_ALIGN_OUT_RIGHT_MID, 14, 6);
 
-  label_stock = lv_label_create(cont_stock, NULL);
-  lv_label_set_text_fmt(label_stock, "%d", ui_controller->stock);
-  lv_obj_align(label_stock, NULL, LV_ALIGN_CENTER, 0, 0);
+  dashboard_label_stock = lv_label_create(cont_stock, NULL);
+  lv_label_set_text_fmt(dashboard_label_stock, "%d", ui_controller->stock);
+  lv_obj_align(dashboard_label_stock, NULL, LV_ALIGN_CENTER, 0, 0);
 
   static lv_style_t style_stock_text;
   lv_style_init(&style_stock_text);
@@ -820,17 +829,17 @@ static struct smart_ring_ui_debug_sensor_t {
 
 void smart_ring_main_debug_update_sensor_values(int old_value, int new_value, bool stable) {
   if (old_value != NO_UPDATE) {
-    lv_label_set_text_fmt(container_debug_sensor.label_sensor_old, "%d", old_value);
+    smart_ring_ui_label_set_text_fmt(container_debug_sensor.label_sensor_old, "%d", old_value);
   }
   if (new_value != NO_UPDATE) {
-    lv_label_set_text_fmt(container_debug_sensor.label_sensor_new, "%d", new_value);
+    smart_ring_ui_label_set_text_fmt(container_debug_sensor.label_sensor_new, "%d", new_value);
   }
   if (stable) {
-    lv_img_set_src(container_debug_sensor.img_stability, &icon_stable);
-    lv_label_set_text(container_debug_sensor.label_stability, "#00FF00 Estável");
+    smart_ring_ui_img_set_src(container_debug_sensor.img_stability, &icon_stable);
+    smart_ring_ui_label_set_text(container_debug_sensor.label_stability, "#00FF00 Estável");
   } else {
-    lv_img_set_src(container_debug_sensor.img_stability, &icon_unstable);
-    lv_label_set_text(container_debug_sensor.label_stability, "#FF0000 Instável");
+    smart_ring_ui_img_set_src(container_debug_sensor.img_stability, &icon_unstable);
+    smart_ring_ui_label_set_text(container_debug_sensor.label_stability, "#FF0000 Instável");
   }
 }
 
@@ -865,8 +874,9 @@ void main_create_debug_menu(lv_obj_t *parent, struct smart_ring_ui_controller_t
   lv_obj_align(img_sensor_arrow, NULL, LV_ALIGN_CENTER, -100, 10);
 
   container_debug_sensor.label_sensor_old = lv_label_create(cont_debug, NULL);
-  lv_label_set_text_fmt(container_debug_sensor.label_sensor_old, "0");
+  lv_label_set_text(container_debug_sensor.label_sensor_old, "0");
   lv_obj_add_style(container_debug_sensor.label_sensor_old, LV_LABEL_PART_MAIN, &ui_controller->styles.font_18_bold);
+  smart_ring_ui_label_set_fixed_width(container_debug_sensor.label_sensor_old, 100, LV_LABEL_ALIGN_CENTER);
   lv_obj_set_auto_realign(container_debug_sensor.label_sensor_old, true);
   lv_obj_align_origo(container_debug_sensor.label_sensor_old, img_sensor_arrow,LV_ALIGN_IN_TOP_MID, 0, -17);
 
@@ -883,6 +893,7 @@ void main_create_debug_menu(lv_obj_t *parent, struct smart_ring_ui_controller_t
   container_debug_sensor.label_sensor_new = lv_label_create(cont_debug, NULL);
   lv_label_set_text(container_debug_sensor.label_sensor_new, "0");
   lv_obj_add_style(container_debug_sensor.label_sensor_new, LV_LABEL_PART_MAIN, &ui_controller->styles.font_18_bold);
+  smart_ring_ui_label_set_fixed_width(container_debug_sensor.label_sensor_new, 100, LV_LABEL_ALIGN_CENTER);
   lv_obj_set_auto_realign(container_debug_sensor.label_sensor_new, true);
   lv_obj_align_origo(container_debug_sensor.label_sensor_new, label_sensor_type, LV_ALIGN_IN_BOTTOM_MID, 0, 10);
 
@@ -913,6 +924,7 @@ void main_create_debug_menu(lv_obj_t *parent, struct smart_ring_ui_controller_t
   lv_label_set_recolor(container_debug_sensor.label_stability, true);
   lv_label_set_text(container_debug_sensor.label_stability, "#FF0000 Instável");
   lv_obj_add_style(container_debug_sensor.label_stability, LV_LABEL_PART_MAIN, &(ui_controller->styles.font_16_normal));
+  smart_ring_ui_label_set_fixed_width(container_debug_sensor.label_stability, 80, LV_LABEL_ALIGN_CENTER);
   lv_obj_set_auto_realign(container_debug_sensor.label_stability, true);
   lv_obj_align_origo(container_debug_sensor.label_stability, NULL, LV_ALIGN_IN_RIGHT_MID, -60, -30);
 
@@ -964,6 +976,10 @@ void main_create_debug_menu(lv_obj_t *parent, struct smart_ring_ui_controller_t
   lv_img_set_src(img_btn_home_img, &icon_home);
 
   smart_ring_main_debug_update_sensor_values(NO_UPDATE, NO_UPDATE, false);
+
+#ifdef CONFIG_SR_UI_PERF_OVERLAY
+  perf_create_overlay(parent, ui_controller);
+#endif
 }
 
 
@@ -1226,6 +1242,9 @@ void main_create_dashboard_menu(lv_obj_t *parent, struct smart_ring_ui_controlle
   ESP_LOGI(TAG, "Tabviewcreation");
 #endif
   lv_obj_t *tabview = lv_tabview_create(parent, NULL);
+  dashboard_tabview   = tabview;
+  dashboard_is_admin  = ui_controller->is_admin;
+  dashboard_is_master = ui_controller->is_master;
   lv_obj_set_size(tabview, 320, 240);
   lv_obj_add_style(tabview, LV_OBJ_PART_MAIN, &(ui_controller->styles.blank_page));
   lv_obj_add_style(tabview, LV_OBJ_PART_MAIN, &style_options_menu);
@@ -1291,11 +1310,11 @@ void main_update_rssi_signal(uint8_t rssi_level) {
   ESP_LOGI(TAG, "Updating icon to %d", rssi_level);
 #endif
   switch (rssi_level) {
-  case 0:  lv_img_set_src(com_signal_img, &wifi_signal_0); break;
-  case 1:  lv_img_set_src(com_signal_img, &wifi_signal_1); break;
-  case 2:  lv_img_set_src(com_signal_img, &wifi_signal_2); break;
-  case 3:  lv_img_set_src(com_signal_img, &wifi_signal_3); break;
-  default: lv_img_set_src(com_signal_img, &wifi_signal_0); break;
+  case 0:  smart_ring_ui_img_set_src(com_signal_img, &wifi_signal_0); break;
+  case 1:  smart_ring_ui_img_set_src(com_signal_img, &wifi_signal_1); break;
+  case 2:  smart_ring_ui_img_set_src(com_signal_img, &wifi_signal_2); break;
+  case 3:  smart_ring_ui_img_set_src(com_signal_img, &wifi_signal_3); break;
+  default: smart_ring_ui_img_set_src(com_signal_img, &wifi_signal_0); break;
   }
 }
 
@@ -1317,28 +1336,84 @@ void main_update_bottle_icon(struct smart_ring_ui_controller_t *ui_controller) {
 #endif
 
   if (percentage >= 75) {
-    lv_img_set_src(main_bottle_img, &icon_bottle_100);
+    smart_ring_ui_img_set_src(main_bottle_img, &icon_bottle_100);
   } else if (percentage >= 50) {
-    lv_img_set_src(main_bottle_img, &icon_bottle_75);
+    smart_ring_ui_img_set_src(main_bottle_img, &icon_bottle_75);
   } else if (percentage >= 25) {
-    lv_img_set_src(main_bottle_img, &icon_bottle_50);
+    smart_ring_ui_img_set_src(main_bottle_img, &icon_bottle_50);
   } else {
-    lv_img_set_src(main_bottle_img, &icon_bottle_25);
+    smart_ring_ui_img_set_src(main_bottle_img, &icon_bottle_25);
   }
 }
 
 void main_update_stock(int stock) {
   smart_ring_ui_get_controller()->updated_stock = stock;
-  lv_label_set_text_fmt(label_stock, "%d", stock);
+  smart_ring_ui_label_set_text_fmt(dashboard_label_stock, "%d", stock);
 }
 
 void main_update_order_mode(char order_mode) {
 
   if (order_mode == 'm') {
-    lv_img_set_src(delivery_mode_img, &icon_manual);
+    smart_ring_ui_img_set_src(delivery_mode_img, &icon_manual);
   } else {
-    lv_img_set_src(delivery_mode_img, &icon_auto);
+    smart_ring_ui_img_set_src(delivery_mode_img, &icon_auto);
+  }
+}
+
+bool main_refresh_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller) {
+  // The sign in button turns into the update one when a new version is found
+  if (ui_controller->newVersion != main_new_version) {
+    return false;
   }
+
+  char aux_text[64];
+  snprintf(aux_text, sizeof(aux_text), "#979797 %s#", ui_controller->device_name);
+  smart_ring_ui_label_set_text(device_name_label, aux_text);
+
+  snprintf(aux_text, sizeof(aux_text), "#979797 %d#", ui_controller->stock);
+  smart_ring_ui_label_set_text(label_stock, aux_text);
+
+  main_update_order_mode(ui_controller->order_mode);
+  main_update_rssi_signal(ui_controller->rssi_level);
+  main_update_bottle_icon(ui_controller);
+
+  if (ui_controller->number_of_deliveries > 0) {
+    smart_ring_ui_main_update_next_eta();
+  } else {
+    smart_ring_ui_main_clear_next_eta();
+  }
+
+  return true;
+}
+
+bool main_refresh_dashboard_menu(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller) {
+  // The order tab buttons depend on the role of the user signed in
+  if (ui_controller->is_admin != dashboard_is_admin || ui_controller->is_master != dashboard_is_master) {
+    return false;
+  }
+
+  lv_tabview_set_tab_act(dashboard_tabview, 0, LV_ANIM_OFF);
+  is_stock_tabview = false;
+
+  // Drop the stock changed but not confirmed
+  char aux_stock[8];
+  snprintf(aux_stock, sizeof(aux_stock), "%d", ui_controller->stock);
+  smart_ring_ui_label_set_text(dashboard_label_stock, aux_stock);
+
+  // Back to the first page of the support options
+  current_page = 1;
+  smart_ring_ui_label_set_text(label_support_option_1, support_options[0].text);
+  lv_obj_set_user_data(lv_obj_get_parent(label_support_option_1), &(support_options[0]));
+
+  if (num_options > 1) {
+    lv_obj_t *parent_button = lv_obj_get_parent(label_support_option_2);
+
+    smart_ring_ui_label_set_text(label_support_option_2, support_options[1].text);
+    lv_obj_set_user_data(parent_button, &(support_options[1]));
+    lv_obj_set_hidden(parent_button, false);
+  }
+
+  return true;
 }
 
 static void smart_ring_ui_sleep_handler(lv_obj_t *element, lv_event_t event) {
@@ -1347,7 +1422,6 @@ static void smart_ring_ui_sleep_handler(lv_obj_t *element, lv_event_t event) {
 
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
     smart_ring_ui_update_state(STATE_5);
-    gpio_set_level(CONFIG_LV_DISP_PIN_BCKL, 1);
   }
 }
 
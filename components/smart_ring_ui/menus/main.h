@@ -81,6 +81,23 @@ void main_create_reset_menu(lv_obj_t *parent, struct smart_ring_ui_controller_t
  * @retval None
  */
 void main_create_info_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
+
+/**
+ * @brief  Refresh the values of the retained main screen before it's shown again
+ * @param  *parent: Screen object
+ * @param  *ui_controller: UI controller object
+ * @retval false when the layout changed and the screen must be created again
+ */
+bool main_refresh_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
+
+/**
+ * @brief  Refresh the retained dashboard screen before it's shown again, back
+ *         to its first tab
+ * @param  *parent: Screen object
+ * @param  *ui_controller: UI controller object
+ * @retval false when the layout changed and the screen must be created again
+ */
+bool main_refresh_dashboard_menu(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
 void main_home_handler(lv_obj_t *button, lv_event_t event);
 void main_update_rssi_signal(uint8_t rssi_level);
 void main_update_device_name(char *device_name);
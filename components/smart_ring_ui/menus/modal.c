@@ -137,7 +137,7 @@ void modal_create_template(lv_obj_t *parent, struct smart_ring_ui_controller_t *
 
 
 void modal_complete_progress(struct smart_ring_ui_controller_t *ui_controller, bool successfull, 
-                                                                         char *error_message) {
+                                                                         const char *error_message) {
 
     // Complete the spinner
     lv_spinner_set_arc_length(spinner, 359);
@@ -147,9 +147,9 @@ void modal_complete_progress(struct smart_ring_ui_controller_t *ui_controller, b
         lv_label_set_text(spinner_icon, LV_SYMBOL_OK);
         lv_obj_set_hidden(spinner_icon, false);
 
-        lv_label_set_text(modal_title, ui_controller->flags.flag.update_pin ? "Atualizado" : "Concluído");
+        lv_label_set_text(modal_title, ui_controller->flags.update_pin ? "Atualizado" : "Concluído");
         lv_label_set_text(modal_subheader, "Aguarde 3 segundos");
-        ui_controller->flags.flag.update_pin  = false;
+        ui_controller->flags.update_pin  = false;
     } else {
         lv_label_set_text(spinner_icon, LV_SYMBOL_CLOSE);
         lv_obj_set_style_local_text_color(spinner_icon, LV_LABEL_PART_MAIN,   LV_STATE_DEFAULT, LV_COLOR_RED);
@@ -47,5 +47,5 @@ void modal_create_template(lv_obj_t                          *parent,
  * @retval None
  */
 void modal_complete_progress(struct smart_ring_ui_controller_t *ui_controller,
-                             bool successfull, char *error_message);
+                             bool successfull, const char *error_message);
 #endif /* __MODAL_H_ */
\ No newline at end of file
@@ -133,7 +133,7 @@ static void order_change_mode_handler(lv_obj_t *toggle, lv_event_t event) {
       lv_switch_on(toggle, LV_ANIM_OFF);
     }
 
-    smart_ring_ui_get_controller()->flags.flag.change_order_mode = true;
+    smart_ring_ui_send_request(UI_REQUEST_CHANGE_ORDER_MODE);
   }
 }
 
@@ -188,7 +188,7 @@ static void smart_ring_ui_order_start_order_handler(lv_obj_t *button, lv_event_t
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
     if (smart_ring_ui_get_controller()->order.bottles != 0 ||
         smart_ring_ui_get_controller()->order.cups != 0) {
-      smart_ring_ui_get_controller()->flags.flag.start_order = true;
+      smart_ring_ui_send_request(UI_REQUEST_START_ORDER);
     }
   }
 }
@@ -336,6 +336,18 @@ void order_create_new_order_screen(lv_obj_t *parent, struct smart_ring_ui_contro
   lv_img_set_src(img_btn_home_img, &icon_home);
 }
 
+bool order_refresh_new_order_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller) {
+  char quantity[8];
+
+  snprintf(quantity, sizeof(quantity), "%d", ui_controller->order.bottles);
+  smart_ring_ui_label_set_text(label_bottle_quantity, quantity);
+
+  snprintf(quantity, sizeof(quantity), "%d", ui_controller->order.cups);
+  smart_ring_ui_label_set_text(label_cups_quantity, quantity);
+
+  return true;
+}
+
 static void smart_ring_ui_order_cancel_order_handler(lv_obj_t *button, lv_event_t event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
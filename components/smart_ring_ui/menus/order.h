@@ -36,6 +36,8 @@ _____________________________________/\\\______________________________________/
  */
 void order_create_new_order_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
 
+bool order_refresh_new_order_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
+
 /**
  * @brief  Create the review order screen
  * @note   It may change during the course of the fimrware integration
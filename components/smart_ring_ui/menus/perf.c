@@ -0,0 +1,257 @@
+/**
+ * @file perf.c
+ * @brief Records the time LVGL takes to draw and flush the frames of each
+ * menu, the area drawn and the state of the LVGL memory pool, to find the
+ * slow screens on the device
+ * @version 2.1.2
+ * @date 2024-10-29
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "perf.h"
+
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+
+static const char *TAG = "UI_PERF";
+
+/**
+ * @brief  Statistics of a menu, summed until they're read
+ */
+struct perf_menu_t {
+  uint16_t menu;
+  uint32_t frames;
+  uint64_t render_sum_us;
+  uint32_t render_max_us;
+  uint64_t flush_sum_us;
+  uint32_t flush_max_us;
+  uint64_t area_sum_px;
+  uint32_t area_max_px;
+  uint8_t  mem_used_pct;
+  uint8_t  mem_frag_pct;
+  uint32_t mem_biggest_free;
+};
+
+static struct perf_menu_t perf_menus[PERF_MAX_MENUS];
+static int perf_menus_count = 0;
+static struct perf_frame_t perf_last_frame;
+static portMUX_TYPE perf_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Flushes of the frame being drawn, only touched by the UI task
+static uint32_t perf_frame_flush_us = 0;
+
+// Refresh task callback of LVGL, wrapped by perf_refr_task
+static lv_task_cb_t perf_refr_task_cb = NULL;
+
+// Start of the refresh running (us), 0 outside of perf_refr_task
+static int64_t perf_refr_start_us = 0;
+
+/**
+ * @brief  Refresh task of the display, timed in us. LVGL only gives the
+ *         monitor callback whole ms, more than a partial refresh takes
+ */
+static void perf_refr_task(lv_task_t *task) {
+  perf_refr_start_us = esp_timer_get_time();
+  perf_refr_task_cb(task);
+  perf_refr_start_us = 0;
+}
+
+void perf_monitor_attach(lv_disp_t *disp) {
+  if (perf_refr_task_cb == NULL) {
+    perf_refr_task_cb = disp->refr_task->task_cb;
+    disp->refr_task->task_cb = perf_refr_task;
+  }
+}
+
+void perf_flush_done(uint32_t flush_us) {
+  perf_frame_flush_us += flush_us;
+}
+
+void perf_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+  (void)disp_drv;
+
+  struct perf_frame_t frame;
+  lv_mem_monitor_t mem;
+
+  // The refresh with the flushes, in ms when lv_refr_now ran it unwrapped
+  uint32_t time_us = perf_refr_start_us ? (uint32_t)(esp_timer_get_time() - perf_refr_start_us)
+                                        : time * 1000;
+  frame.menu      = smart_ring_ui_get_controller()->menu;
+  frame.flush_us  = perf_frame_flush_us;
+  frame.render_us = time_us > frame.flush_us ? time_us - frame.flush_us : 0;
+  frame.area_px   = px;
+  perf_frame_flush_us = 0;
+
+  lv_mem_monitor(&mem);
+  frame.mem_used_pct = mem.used_pct;
+  frame.mem_frag_pct = mem.frag_pct;
+
+  portENTER_CRITICAL(&perf_lock);
+  frame.frames = perf_last_frame.frames + 1;
+  perf_last_frame = frame;
+
+  struct perf_menu_t *stats = NULL;
+  for (int i = 0; i < perf_menus_count; i++) {
+    if (perf_menus[i].menu == frame.menu) {
+      stats = &perf_menus[i];
+      break;
+    }
+  }
+  if (stats == NULL && perf_menus_count < PERF_MAX_MENUS) {
+    stats = &perf_menus[perf_menus_count++];
+    memset(stats, 0, sizeof(*stats));
+    stats->menu             = frame.menu;
+    stats->mem_biggest_free = UINT32_MAX;
+  }
+
+  if (stats != NULL) {
+    stats->frames++;
+    stats->render_sum_us += frame.render_us;
+    stats->flush_sum_us  += frame.flush_us;
+    stats->area_sum_px   += frame.area_px;
+    stats->render_max_us    = LV_MATH_MAX(stats->render_max_us, frame.render_us);
+    stats->flush_max_us     = LV_MATH_MAX(stats->flush_max_us, frame.flush_us);
+    stats->area_max_px      = LV_MATH_MAX(stats->area_max_px, frame.area_px);
+    stats->mem_used_pct     = LV_MATH_MAX(stats->mem_used_pct, frame.mem_used_pct);
+    stats->mem_frag_pct     = LV_MATH_MAX(stats->mem_frag_pct, frame.mem_frag_pct);
+    stats->mem_biggest_free = LV_MATH_MIN(stats->mem_biggest_free, mem.free_biggest_size);
+  }
+  portEXIT_CRITICAL(&perf_lock);
+}
+
+void perf_get_last_frame(struct perf_frame_t *frame) {
+  portENTER_CRITICAL(&perf_lock);
+  *frame = perf_last_frame;
+  portEXIT_CRITICAL(&perf_lock);
+}
+
+int perf_get_summaries(struct perf_summary_t *summaries, int max, bool reset) {
+  struct perf_menu_t menus[PERF_MAX_MENUS];
+  int count;
+
+  portENTER_CRITICAL(&perf_lock);
+  count = perf_menus_count;
+  memcpy(menus, perf_menus, count * sizeof(menus[0]));
+  if (reset) {
+    perf_menus_count = 0;
+  }
+  portEXIT_CRITICAL(&perf_lock);
+
+  int filled = 0;
+  for (int i = 0; i < count; i++) {
+    struct perf_summary_t summary = {
+        .menu             = menus[i].menu,
+        .frames           = menus[i].frames,
+        .render_avg_us    = menus[i].render_sum_us / menus[i].frames,
+        .render_max_us    = menus[i].render_max_us,
+        .flush_avg_us     = menus[i].flush_sum_us / menus[i].frames,
+        .flush_max_us     = menus[i].flush_max_us,
+        .area_avg_px      = menus[i].area_sum_px / menus[i].frames,
+        .area_max_px      = menus[i].area_max_px,
+        .mem_used_pct     = menus[i].mem_used_pct,
+        .mem_frag_pct     = menus[i].mem_frag_pct,
+        .mem_biggest_free = menus[i].mem_biggest_free,
+    };
+    uint32_t frame_us = summary.render_avg_us + summary.flush_avg_us;
+
+    // Insert it after the slower menus, the faster ones are dropped
+    int position = filled;
+    while (position > 0 && summaries[position - 1].render_avg_us + summaries[position - 1].flush_avg_us < frame_us) {
+      position--;
+    }
+    if (position >= max) {
+      continue;
+    }
+
+    int last = filled < max ? filled : max - 1;
+    memmove(&summaries[position + 1], &summaries[position], (last - position) * sizeof(summaries[0]));
+    summaries[position] = summary;
+    if (filled < max) {
+      filled++;
+    }
+  }
+
+  return filled;
+}
+
+void perf_print(void) {
+  struct perf_summary_t summaries[PERF_MAX_MENUS];
+  int count = perf_get_summaries(summaries, PERF_MAX_MENUS, false);
+
+  ESP_LOGI(TAG, "UI frames of %d menus, the slowest first", count);
+  ESP_LOGI(TAG, "%4s %6s %15s %15s %13s %4s %4s %7s", "menu", "frames", "render avg/max", "flush avg/max",
+           "area avg/max", "mem", "frag", "biggest");
+  for (int i = 0; i < count; i++) {
+    ESP_LOGI(TAG, "%4u %6u %6u/%6u us %6u/%6u us %6u/%6u %3u%% %3u%% %7u", summaries[i].menu, summaries[i].frames,
+             summaries[i].render_avg_us, summaries[i].render_max_us, summaries[i].flush_avg_us,
+             summaries[i].flush_max_us, summaries[i].area_avg_px, summaries[i].area_max_px, summaries[i].mem_used_pct,
+             summaries[i].mem_frag_pct, summaries[i].mem_biggest_free);
+  }
+
+  struct img_cache_stats_t images;
+  img_decoder_get_stats(&images);
+  ESP_LOGI(TAG, "Decoded images: %u (%u bytes), %u hits, %u misses, %u evictions, %u by rows", images.images,
+           images.used, images.hits, images.misses, images.evictions, images.lines);
+
+  struct font_cache_stats_t glyphs;
+  font_cache_get_stats(&glyphs);
+  ESP_LOGI(TAG, "Decompressed glyphs: %u (%u bytes), %u hits, %u misses, %u evictions", glyphs.glyphs, glyphs.used,
+           glyphs.hits, glyphs.misses, glyphs.evictions);
+}
+
+#ifdef CONFIG_SR_UI_PERF_OVERLAY
+// Refresh task of the overlay, deleted with it
+static lv_task_t *perf_overlay_refresh = NULL;
+// Frames drawn at the last refresh
+static uint32_t perf_overlay_frames = 0;
+
+/**
+ * @brief  Refresh the overlay with the frames drawn since the last period
+ */
+static void perf_overlay_task(lv_task_t *task) {
+  lv_obj_t *label = task->user_data;
+  struct perf_frame_t frame;
+
+  perf_get_last_frame(&frame);
+
+  // The overlay itself is drawn once per period, it isn't counted
+  uint32_t fps = frame.frames - perf_overlay_frames;
+  fps = fps > 0 ? (fps - 1) * 1000 / PERF_OVERLAY_PERIOD_MS : 0;
+  perf_overlay_frames = frame.frames;
+
+  smart_ring_ui_label_set_text_fmt(label, "%u fps R %u.%u F %u.%u ms\n%u px M %u%% F %u%%", fps,
+                                   frame.render_us / 1000, frame.render_us / 100 % 10, frame.flush_us / 1000,
+                                   frame.flush_us / 100 % 10, frame.area_px, frame.mem_used_pct, frame.mem_frag_pct);
+}
+
+/**
+ * @brief  Delete the refresh task with the overlay
+ */
+static void perf_overlay_event_handler(lv_obj_t *obj, lv_event_t event) {
+  if (event == LV_EVENT_DELETE && perf_overlay_refresh != NULL) {
+    lv_task_del(perf_overlay_refresh);
+    perf_overlay_refresh = NULL;
+  }
+}
+
+void perf_create_overlay(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller) {
+  lv_obj_t *label = lv_label_create(parent, NULL);
+  lv_obj_add_style(label, LV_LABEL_PART_MAIN, &(ui_controller->styles.font_12_normal));
+  lv_obj_set_style_local_bg_opa(label, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
+  lv_obj_set_style_local_bg_color(label, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+  lv_obj_set_style_local_text_color(label, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+  lv_label_set_text(label, "-\n-");
+  smart_ring_ui_label_set_fixed_width(label, 150, LV_LABEL_ALIGN_LEFT);
+  lv_obj_align(label, NULL, LV_ALIGN_IN_TOP_RIGHT, 0, 0);
+
+  struct perf_frame_t frame;
+  perf_get_last_frame(&frame);
+  perf_overlay_frames = frame.frames;
+
+  perf_overlay_refresh = lv_task_create(perf_overlay_task, PERF_OVERLAY_PERIOD_MS, LV_TASK_PRIO_LOW, label);
+  lv_obj_set_event_cb(label, perf_overlay_event_handler);
+}
+#endif
+
+#endif
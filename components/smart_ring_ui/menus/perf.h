@@ -0,0 +1,135 @@
+/**
+ * @file perf.h
+ * @brief UI performance monitor header
+ * @version 2.1.2
+ * @date 2024-10-29
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef __PERF_H_
+#define __PERF_H_
+
+#include "lvgl.h"
+#include "smart_ring_ui.h"
+
+/* Menus with their own statistics, the frames of the others are dropped */
+#define PERF_MAX_MENUS         24
+/* Slowest menus sent in a report */
+#define PERF_REPORT_MENUS      4
+/* Refresh period of the overlay (ms) */
+#define PERF_OVERLAY_PERIOD_MS 1000
+
+/**
+ * @brief  Last frame drawn
+ * @param menu          Menu shown
+ * @param render_us     Time LVGL took to draw it, the flushes excluded (us)
+ * @param flush_us      Time spent in the flushes of the strips (us)
+ * @param area_px       Pixels invalidated and drawn
+ * @param mem_used_pct  LVGL memory pool used after it (%)
+ * @param mem_frag_pct  Fragmentation of the free pool after it (%)
+ * @param frames        Frames drawn since boot
+ */
+typedef struct perf_frame_t {
+  uint16_t menu;
+  uint32_t render_us;
+  uint32_t flush_us;
+  uint32_t area_px;
+  uint8_t  mem_used_pct;
+  uint8_t  mem_frag_pct;
+  uint32_t frames;
+} perf_frame_t;
+
+/**
+ * @brief  Statistics of the frames drawn on a menu
+ * @param menu             Menu id
+ * @param frames           Frames drawn
+ * @param render_avg_us    Average draw time, the flushes excluded (us)
+ * @param render_max_us    Longest draw time (us)
+ * @param flush_avg_us     Average time in the flushes of a frame (us)
+ * @param flush_max_us     Longest time in the flushes of a frame (us)
+ * @param area_avg_px      Average pixels drawn by a frame
+ * @param area_max_px      Most pixels drawn by a frame
+ * @param mem_used_pct     Highest use of the LVGL memory pool (%)
+ * @param mem_frag_pct     Highest fragmentation of the free pool (%)
+ * @param mem_biggest_free Smallest of the biggest free blocks (bytes)
+ */
+typedef struct perf_summary_t {
+  uint16_t menu;
+  uint32_t frames;
+  uint32_t render_avg_us;
+  uint32_t render_max_us;
+  uint32_t flush_avg_us;
+  uint32_t flush_max_us;
+  uint32_t area_avg_px;
+  uint32_t area_max_px;
+  uint8_t  mem_used_pct;
+  uint8_t  mem_frag_pct;
+  uint32_t mem_biggest_free;
+} perf_summary_t;
+
+/**
+ * @brief  Time the refreshes of the display in us, by wrapping its refresh
+ *         task. Called once the display driver is registered
+ * @param  *disp: Display
+ * @retval None
+ */
+void perf_monitor_attach(lv_disp_t *disp);
+
+/**
+ * @brief  Add the time of a flush to the frame being drawn. Called by the
+ *         flush callback of the display driver
+ * @param  flush_us: Time spent in the flush (us)
+ * @retval None
+ */
+void perf_flush_done(uint32_t flush_us);
+
+/**
+ * @brief  Monitor callback of the display driver, called by LVGL after each
+ *         frame. Closes the frame and adds it to the statistics of the menu
+ * @param  *disp_drv: Display driver
+ * @param  time: Time of the refresh, flushes included (ms), only used when
+ *         perf_monitor_attach could not time it in us
+ * @param  px: Pixels drawn
+ * @retval None
+ */
+void perf_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+
+/**
+ * @brief  Get the last frame drawn
+ * @param  *frame: Filled with the frame
+ * @retval None
+ */
+void perf_get_last_frame(struct perf_frame_t *frame);
+
+/**
+ * @brief  Get the statistics of the menus, the slowest first
+ * @param  *summaries: Filled with the statistics
+ * @param  max: Menus that fit in summaries
+ * @param  reset: Start new statistics, for the next report
+ * @retval Menus filled
+ */
+int perf_get_summaries(struct perf_summary_t *summaries, int max, bool reset);
+
+/**
+ * @brief  Print the statistics of the menus, of the decoded images and of the
+ *         decompressed glyphs on the serial console
+ * @retval None
+ */
+void perf_print(void);
+
+#ifdef CONFIG_SR_UI_PERF_OVERLAY
+/**
+ * @brief  Overlay showing the frame rate, the times of the last frame and the
+ *         LVGL memory pool, refreshed every PERF_OVERLAY_PERIOD_MS
+ * @note   The overlay is itself redrawn, adding a small area to the frames of
+ *         its screen
+ * @param  *parent: Screen object
+ * @param  *ui_controller: UI controller object
+ * @retval None
+ */
+void perf_create_overlay(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
+#endif
+
+#endif
@@ -32,6 +32,7 @@
 static const char *TAG = "UI_PIN";
 
 static lv_obj_t   *inserted_pin;
+static bool        pin_update_mode = false;  // The screen was created to change the pin
 static const char *map_keyboard[] = {"1", "2",  "3",  "\n", "4",
                                      "5", "6",  "\n", "7",  "8",
                                      "9", "\n", " ",  "0",  LV_SYMBOL_BACKSPACE,
@@ -50,7 +51,7 @@ char *pin_get_inserted_pin() {
 void pin_sign_in_handler(lv_obj_t *button, lv_event_t *event) {
   if (event == LV_EVENT_RELEASED && strlen(pin_get_inserted_pin()) == 4) {
       smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-      if(!smart_ring_ui_get_controller()->flags.flag.update_pin)
+      if(!smart_ring_ui_get_controller()->flags.update_pin)
          smart_ring_ui_update_state(STATE_8);
       else
          smart_ring_ui_update_state(STATE_44);
@@ -61,12 +62,14 @@ void pin_sign_in_handler(lv_obj_t *button, lv_event_t *event) {
 void pin_cancel_sign_in_handler(lv_obj_t *button, lv_event_t *event) {
   if (event == LV_EVENT_RELEASED) {
     smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-    smart_ring_ui_get_controller()->flags.flag.update_pin           = false;
+    smart_ring_ui_get_controller()->flags.update_pin           = false;
     smart_ring_ui_update_state(STATE_5);
   }
 }
 
 void create_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller) {
+  pin_update_mode = ui_controller->flags.update_pin;
+
   lv_obj_set_style_local_bg_color(parent, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
   /************
    * Keyboard
@@ -131,7 +134,7 @@ void create_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_
 #endif
   lv_obj_add_style(inserted_pin, LV_TEXTAREA_PART_BG, &style_font_blue);
   lv_obj_add_style(inserted_pin, LV_TEXTAREA_PART_BG, 
-          smart_ring_ui_get_controller()->flags.flag.update_pin ? &(ui_controller->styles.font_18_normal) : &(ui_controller->styles.font_26_normal));
+          smart_ring_ui_get_controller()->flags.update_pin ? &(ui_controller->styles.font_18_normal) : &(ui_controller->styles.font_26_normal));
 #ifndef NDEBUG
   printf("Adding textarea cursor\n");
 #endif
@@ -144,7 +147,7 @@ void create_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_
   lv_textarea_set_one_line(inserted_pin, true);
   lv_textarea_set_text(inserted_pin, "");
   lv_textarea_set_max_length(inserted_pin, 4);
-  lv_textarea_set_pwd_mode(inserted_pin, smart_ring_ui_get_controller()->flags.flag.update_pin ? false : true);
+  lv_textarea_set_pwd_mode(inserted_pin, smart_ring_ui_get_controller()->flags.update_pin ? false : true);
   lv_textarea_set_pwd_show_time(inserted_pin, 0);
   lv_textarea_set_scrollbar_mode(inserted_pin, LV_SCROLLBAR_MODE_OFF);
   lv_textarea_set_cursor_click_pos(inserted_pin, false);
@@ -158,7 +161,7 @@ void create_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_
   lv_obj_t *label_pin = lv_label_create(parent, NULL);
   lv_obj_add_style(label_pin, LV_LABEL_PART_MAIN, &style_font_blue);
   lv_obj_add_style(label_pin, LV_LABEL_PART_MAIN, &(ui_controller->styles.font_16_normal));
-  lv_label_set_text(label_pin, smart_ring_ui_get_controller()->flags.flag.update_pin ? "Alterar PIN" : "Inserir PIN");
+  lv_label_set_text(label_pin, smart_ring_ui_get_controller()->flags.update_pin ? "Alterar PIN" : "Inserir PIN");
   lv_obj_align(label_pin, inserted_pin, LV_ALIGN_OUT_TOP_MID, 0, 0);
 
   static lv_style_t style_underscore;
@@ -185,7 +188,7 @@ void create_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_
   lv_obj_align(btn_validate, inserted_pin, LV_ALIGN_OUT_BOTTOM_MID, 0, 22);
 
   lv_obj_t *label_btn = lv_label_create(btn_validate, NULL);
-  lv_label_set_text(label_btn, smart_ring_ui_get_controller()->flags.flag.update_pin ? "Atualizar" : "Validar");
+  lv_label_set_text(label_btn, smart_ring_ui_get_controller()->flags.update_pin ? "Atualizar" : "Validar");
     
 
   /******************
@@ -203,4 +206,14 @@ void create_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_
 
   label_btn = lv_label_create(btn_cancel, NULL);
   lv_label_set_text(label_btn, "Cancelar");
-}
\ No newline at end of file
+}
+
+bool pin_refresh_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller) {
+  // Changing the pin shows it in clear text, with other labels
+  if (ui_controller->flags.update_pin != pin_update_mode) {
+    return false;
+  }
+
+  lv_textarea_set_text(inserted_pin, "");
+  return true;
+}
@@ -45,4 +45,13 @@ char *pin_get_inserted_pin();
  */
 void create_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
 
+/**
+ * @brief  Clear the pin of the retained pin screen before it's shown again
+ * @param  *parent: Screen object
+ * @param  *ui_controller: UI controller object
+ * @retval false when the screen must be created again, to change the pin
+ *         instead of signing in or the other way around
+ */
+bool pin_refresh_insert_pin_screen(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
+
 #endif /* __PIN_H_ */
\ No newline at end of file
@@ -41,7 +41,7 @@ static void smart_ring_ui_reset_cancel_handler(lv_obj_t  *button, lv_event_t eve
 static void smart_ring_ui_reset_device_handler(lv_obj_t  *button, lv_event_t event) {
     if (event == LV_EVENT_RELEASED) {
         smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-        smart_ring_ui_get_controller()->flags.flag.reset_device         = true;
+        smart_ring_ui_send_request(UI_REQUEST_RESET_DEVICE);
     }
 }
 
@@ -49,7 +49,7 @@ static void smart_ring_ui_reset_wifi_handler(lv_obj_t  *button, lv_event_t event
     if (event == LV_EVENT_RELEASED) {
         smart_ring_ui_get_controller()->standby_controller.has_callback = true;
         smart_ring_ui_update_state(STATE_39);
-        smart_ring_ui_get_controller()->flags.flag.reset_wifi = true;
+        smart_ring_ui_send_request(UI_REQUEST_RESET_WIFI);
     }
 }
 
@@ -21,8 +21,8 @@ static lv_obj_t *spinner;
 static void smart_ring_ui_update_cancel_handler(lv_obj_t  *button, lv_event_t event) {
     if (event == LV_EVENT_RELEASED) {
         smart_ring_ui_get_controller()->standby_controller.has_callback = true;
+        smart_ring_ui_set_update_result(false);
         smart_ring_ui_update_state(STATE_28);
-        smart_ring_ui_get_controller()->flags.flag.cancel_update = true;
     }
 }
 
@@ -31,11 +31,12 @@ void smart_ring_ui_update_download_started() {
     lv_obj_add_style(label_arc, LV_LABEL_PART_MAIN, &smart_ring_ui_get_controller()->styles.font_24_normal);
     lv_spinner_set_arc_length(spinner, 60);
     lv_label_set_text(label_arc, "0%");
+    smart_ring_ui_label_set_fixed_width(label_arc, 80, LV_LABEL_ALIGN_CENTER);
 }
 
 
 void smart_ring_ui_update_change_percentage(int percentage) {
-    lv_label_set_text_fmt(label_arc, "%d%%", percentage);
+    smart_ring_ui_label_set_text_fmt(label_arc, "%d%%", percentage);
 }
 
 
@@ -136,7 +137,7 @@ static void smart_ring_ui_update_option_firmware_handler(lv_obj_t  *button, lv_e
     if (event == LV_EVENT_RELEASED) {
         smart_ring_ui_get_controller()->standby_controller.has_callback = true;
         smart_ring_ui_update_state(STATE_34);
-        smart_ring_ui_get_controller()->flags.flag.update_firmware      = true;
+        smart_ring_ui_send_request(UI_REQUEST_UPDATE_FIRMWARE);
     }
 }
 
@@ -144,7 +145,7 @@ static void smart_ring_ui_update_option_firmware_handler(lv_obj_t  *button, lv_e
 static void smart_ring_ui_update_option_pin_handler(lv_obj_t  *button, lv_event_t event) {
     if (event == LV_EVENT_RELEASED) {
         smart_ring_ui_get_controller()->standby_controller.has_callback = true;
-        smart_ring_ui_get_controller()->flags.flag.update_pin           = true;
+        smart_ring_ui_get_controller()->flags.update_pin           = true;
         smart_ring_ui_update_state(STATE_7);
     }
 }
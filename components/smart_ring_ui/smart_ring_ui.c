@@ -32,13 +32,27 @@ LV_FONT_DECLARE(sr_font_montserrat_22)
 LV_FONT_DECLARE(sr_font_montserrat_24)
 LV_FONT_DECLARE(sr_font_montserrat_26)
 
+// Task running lv_task_handler, notified when the UI has work to do
+static TaskHandle_t smart_ring_ui_task = NULL;
+
+// Events posted to the UI task, and requests of the UI to the main task
+static QueueHandle_t smart_ring_ui_events = NULL;
+static QueueHandle_t smart_ring_ui_requests = NULL;
+
+// Shortest time between two updates of the widgets of a value, 0 if not
+// limited
+static const uint16_t smart_ring_ui_value_interval_ms[UI_EVENT_MAX] = {
+    [UI_EVENT_RSSI]              = UI_RSSI_MIN_INTERVAL_MS,
+    [UI_EVENT_SENSOR]            = UI_SENSOR_MIN_INTERVAL_MS,
+    [UI_EVENT_DOWNLOAD_PROGRESS] = UI_PROGRESS_MIN_INTERVAL_MS,
+};
+
 // Controller for the ui system
 static struct smart_ring_ui_controller_t smart_ring_ui_controller = {
     .screen           = NULL,
     .menu             = MENU_ID_BOOT,
     .state            = STATE_0,
     .old_state        = STATE_0,
-    .flags.has_flags  = 0x00,
     .timer_type       = CLOSE_MODAL,
     .timer            = NULL,
     .firmware_version = "0.0.0",
@@ -61,6 +75,9 @@ static struct smart_ring_ui_controller_t smart_ring_ui_controller = {
 
 esp_err_t smart_ring_ui_init_system(void) {
 
+  /* Images stored run-length encoded */
+  img_decoder_init();
+
   /* Blank page style */
   lv_style_init(&(smart_ring_ui_controller.styles.blank_page));
   lv_style_set_bg_color(&(smart_ring_ui_controller.styles.blank_page), LV_STATE_DEFAULT, LV_COLOR_WHITE);
@@ -197,6 +214,73 @@ esp_err_t smart_ring_ui_init_system(void) {
   return ESP_OK;
 }
 
+#ifdef CONFIG_SR_UI_SCREEN_CACHE
+/**
+ * @brief  Retained screen of a menu, kept after leaving it and refreshed from
+ *         the controller when it's shown again
+ * @param menu     Menu id
+ * @param refresh  Update the values of the screen, false when it must be
+ *                 created again
+ * @param screen   Screen object, NULL until the menu is first shown
+ * @param children Children of the screen once created, the ones added after
+ *                 are modals
+ */
+struct smart_ring_ui_cached_screen_t {
+  int        menu;
+  bool     (*refresh)(lv_obj_t *parent, struct smart_ring_ui_controller_t *ui_controller);
+  lv_obj_t  *screen;
+  uint16_t   children;
+};
+
+static struct smart_ring_ui_cached_screen_t smart_ring_ui_screen_cache[] = {
+    {.menu = MENU_ID_MAIN,      .refresh = main_refresh_screen},
+    {.menu = MENU_ID_DASHBOARD, .refresh = main_refresh_dashboard_menu},
+    {.menu = MENU_ID_PIN,       .refresh = pin_refresh_insert_pin_screen},
+    {.menu = MENU_ID_NEW_ORDER, .refresh = order_refresh_new_order_screen},
+};
+
+static struct smart_ring_ui_cached_screen_t *smart_ring_ui_cache_find(int menu_id, lv_obj_t *screen) {
+  for (size_t i = 0; i < sizeof(smart_ring_ui_screen_cache) / sizeof(smart_ring_ui_screen_cache[0]); i++) {
+    struct smart_ring_ui_cached_screen_t *cached = &smart_ring_ui_screen_cache[i];
+
+    if ((screen == NULL && cached->menu == menu_id) || (screen != NULL && cached->screen == screen)) {
+      return cached;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief  Delete the modals left on a retained screen
+ */
+static void smart_ring_ui_cache_strip(struct smart_ring_ui_cached_screen_t *cached) {
+  // The last child created is the first one of the list
+  while (lv_obj_count_children(cached->screen) > cached->children) {
+    lv_obj_del(lv_obj_get_child(cached->screen, NULL));
+  }
+}
+#endif
+
+/**
+ * @brief  Release the screen that was replaced, deleting it unless it's retained
+ */
+static void smart_ring_ui_release_screen(lv_obj_t *old_screen) {
+  if (old_screen == smart_ring_ui_controller.screen) {
+    return;
+  }
+
+#ifdef CONFIG_SR_UI_SCREEN_CACHE
+  struct smart_ring_ui_cached_screen_t *cached = smart_ring_ui_cache_find(0, old_screen);
+  if (cached != NULL) {
+    smart_ring_ui_cache_strip(cached);
+    return;
+  }
+#endif
+
+  lv_obj_del(old_screen);
+}
+
 static void smart_ring_ui_select_menu(int menu_id) {
 
 #ifndef NDEBUG
@@ -206,6 +290,31 @@ static void smart_ring_ui_select_menu(int menu_id) {
   lv_obj_t *old_screen = lv_scr_act();
   int old_screen_id    = smart_ring_ui_controller.menu;
 
+#ifdef CONFIG_SR_UI_SCREEN_CACHE
+  struct smart_ring_ui_cached_screen_t *cached = smart_ring_ui_cache_find(menu_id, NULL);
+
+  if (cached != NULL && cached->screen != NULL) {
+    smart_ring_ui_cache_strip(cached);
+
+    if (cached->refresh(cached->screen, &smart_ring_ui_controller)) {
+      smart_ring_ui_controller.screen = cached->screen;
+      smart_ring_ui_controller.menu   = menu_id;
+
+      lv_scr_load(smart_ring_ui_controller.screen);
+      lv_disp_trig_activity(NULL);
+      smart_ring_ui_release_screen(old_screen);
+      return;
+    }
+
+    // The layout of the menu changed, the screen is created again
+    lv_obj_t *stale_screen = cached->screen;
+    cached->screen = NULL;
+    if (stale_screen != old_screen) {
+      lv_obj_del(stale_screen);
+    }
+  }
+#endif
+
   smart_ring_ui_controller.screen = lv_obj_create(NULL, NULL);
   smart_ring_ui_controller.menu   = menu_id;
 
@@ -333,6 +442,13 @@ static void smart_ring_ui_select_menu(int menu_id) {
   printf("Finished the creation of the display\n");
 #endif
 
+#ifdef CONFIG_SR_UI_SCREEN_CACHE
+  if (cached != NULL && smart_ring_ui_controller.screen != old_screen) {
+    cached->screen   = smart_ring_ui_controller.screen;
+    cached->children = lv_obj_count_children(cached->screen);
+  }
+#endif
+
   lv_scr_load(smart_ring_ui_controller.screen);
   lv_disp_trig_activity(NULL);
 
@@ -341,7 +457,7 @@ static void smart_ring_ui_select_menu(int menu_id) {
          smart_ring_ui_controller.menu);
 #endif
 
-  lv_obj_del(old_screen);
+  smart_ring_ui_release_screen(old_screen);
 }
 
 char *smart_ring_ui_get_firwmare(void)
@@ -361,12 +477,14 @@ char *smart_ring_ui_get_device_name(void)
 
 void smart_ring_ui_set_device_name(char *name)
 {
-  strcpy(smart_ring_ui_controller.device_name, name);
-
-  if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+  if (strcmp(smart_ring_ui_controller.device_name, name) == 0)
   {
-    main_update_device_name(name);
+    return;
   }
+  strcpy(smart_ring_ui_controller.device_name, name);
+
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_DEVICE_NAME};
+  smart_ring_ui_post_event(&event);
 }
 
 char *smart_ring_ui_get_mac_address(void)
@@ -396,11 +514,14 @@ char smart_ring_ui_get_order_mode(void)
 
 void smart_ring_ui_set_order_mode(char mode)
 {
-  smart_ring_ui_controller.order_mode = mode;
-  if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+  if (smart_ring_ui_controller.order_mode == mode)
   {
-    main_update_order_mode(mode);
+    return;
   }
+  smart_ring_ui_controller.order_mode = mode;
+
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_ORDER_MODE};
+  smart_ring_ui_post_event(&event);
 }
 
 char smart_ring_ui_get_connection_type(void)
@@ -422,12 +543,14 @@ void smart_ring_ui_set_calibration(int no_deposit, int full_deposit, bool is_sta
 
 void smart_ring_ui_set_current_deposit(int current_deposit)
 {
-  smart_ring_ui_controller.current_deposit = current_deposit;
-
-  if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+  if (smart_ring_ui_controller.current_deposit == current_deposit)
   {
-    main_update_bottle_icon(&smart_ring_ui_controller);
+    return;
   }
+  smart_ring_ui_controller.current_deposit = current_deposit;
+
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_DEPOSIT};
+  smart_ring_ui_post_event(&event);
 }
 
 uint8_t smart_ring_ui_get_rssi_level()
@@ -437,26 +560,116 @@ uint8_t smart_ring_ui_get_rssi_level()
 
 void smart_ring_ui_set_rssi_level(uint8_t rssi_level)
 {
+  if (smart_ring_ui_controller.rssi_level == rssi_level)
+  {
+    return;
+  }
 #ifndef NDEBUG
   ESP_LOGI(TAG, "Changing UI RSSI");
 #endif
   smart_ring_ui_controller.rssi_level = rssi_level;
 
-  if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
-  {
-#ifndef NDEBUG
-    ESP_LOGI(TAG, "Updating signal icon");
-#endif
-    main_update_rssi_signal(rssi_level);
-  }
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_RSSI};
+  smart_ring_ui_post_event(&event);
 }
 
 void smart_ring_ui_set_stock(int stock)
 {
+  if (smart_ring_ui_controller.stock == stock)
+  {
+    return;
+  }
   smart_ring_ui_controller.stock = stock;
-  if (smart_ring_ui_controller.menu == MENU_ID_MAIN || smart_ring_ui_controller.state == STATE_13)
+
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_STOCK};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_set_sensor_values(int old_value, int new_value, bool stable)
+{
+  struct smart_ring_ui_event_t event = {
+      .type = UI_EVENT_SENSOR,
+      .sensor = {.old_value = old_value, .new_value = new_value, .stable = stable},
+  };
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_update_deliveries(void)
+{
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_DELIVERIES};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_set_order_price(float price)
+{
+  smart_ring_ui_controller.order.price = price;
+
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_ORDER_PRICE};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_set_download_started(void)
+{
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_DOWNLOAD_STARTED};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_set_download_progress(int percentage)
+{
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_DOWNLOAD_PROGRESS, .value = percentage};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_set_update_result(bool complete)
+{
+  struct smart_ring_ui_event_t event = {.type = complete ? UI_EVENT_UPDATE_COMPLETE : UI_EVENT_UPDATE_FAILED};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_request_failed(const char *message)
+{
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_REQUEST_FAILED, .message = message};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_set_boot_warning(const char *message)
+{
+  struct smart_ring_ui_event_t event = {.type = UI_EVENT_BOOT_WARNING, .message = message};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_label_set_text(lv_obj_t *label, const char *text)
+{
+  if (strcmp(lv_label_get_text(label), text) != 0)
+  {
+    lv_label_set_text(label, text);
+  }
+}
+
+void smart_ring_ui_label_set_text_fmt(lv_obj_t *label, const char *fmt, ...)
+{
+  char text[UI_LABEL_FMT_MAX_LEN];
+  va_list args;
+
+  va_start(args, fmt);
+  vsnprintf(text, sizeof(text), fmt, args);
+  va_end(args);
+
+  smart_ring_ui_label_set_text(label, text);
+}
+
+void smart_ring_ui_label_set_fixed_width(lv_obj_t *label, lv_coord_t width, lv_label_align_t align)
+{
+  lv_label_set_long_mode(label, LV_LABEL_LONG_CROP);
+  lv_label_set_align(label, align);
+  lv_obj_set_width(label, width);
+}
+
+void smart_ring_ui_img_set_src(lv_obj_t *img, const void *src)
+{
+  if (lv_img_get_src(img) != src)
   {
-    main_update_stock(stock);
+    lv_img_set_src(img, src);
   }
 }
 
@@ -478,424 +691,625 @@ void create_header(lv_obj_t *parent, char *title, struct smart_ring_ui_controlle
   lv_obj_align(label, NULL, LV_ALIGN_CENTER, 0, 0);
 }
 
-void smart_ring_ui_check_flags()
+static void smart_ring_ui_check_option(void)
 {
+  switch (smart_ring_ui_controller.state)
+  {
+  case STATE_13:
+    modal_create_template(lv_scr_act(), &smart_ring_ui_controller, "Stock", "A enviar pedido", true);
+    smart_ring_ui_send_request(UI_REQUEST_CHANGE_STOCK);
+    break;
+  case STATE_14:
+    smart_ring_ui_update_state(STATE_11);
+    break;
+  case STATE_16:
+    modal_create_template(lv_scr_act(), &smart_ring_ui_controller, "Suporte", "A enviar pedido", true);
+    smart_ring_ui_send_request(UI_REQUEST_SEND_TICKET);
+    break;
+  case STATE_17:
+    smart_ring_ui_update_state(STATE_11);
+    break;
+  case STATE_19:
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    smart_ring_ui_update_state(STATE_11);
+    break;
+  case STATE_21:
+    smart_ring_ui_update_state(STATE_11);
+    break;
+  default:
+    break;
+  }
+}
 
-  int retries = 0;
-  if (!smart_ring_ui_controller.flags.has_flags)
+static void smart_ring_ui_touch_pressed(void)
+{
+#ifndef NDEBUG
+  ESP_LOGI(TAG, "Standby timer : %s", esp_timer_is_active(smart_ring_ui_controller.standby_timer) ? "ON" : "NOK");
+#endif
+  // Get if any timer is active
+  if (esp_timer_is_active(smart_ring_ui_controller.standby_timer))
   {
-    return;
+
+    // Stop the timer
+    esp_timer_stop(smart_ring_ui_controller.standby_timer);
+
+    // Get the timer type
+    if (smart_ring_ui_controller.standby_timer_type == STANDBY)
+    {
+      smart_ring_ui_controller.standby_controller.standby_active = true;
+    }
+    else if (smart_ring_ui_controller.standby_timer_type == SLEEP)
+    {
+      smart_ring_ui_controller.standby_controller.sleep_active = true;
+    }
+    else
+    {
+      smart_ring_ui_controller.standby_controller.standby_dashboard_active = true;
+    }
+
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "Stopping standby timers\n\tSleep     : %s\n\tStandby   : %s\n\tDashboard : %s",
+             smart_ring_ui_controller.standby_controller.sleep_active ? "ON" : "NOK",
+             smart_ring_ui_controller.standby_controller.standby_active ? "ON" : "NOK",
+             smart_ring_ui_controller.standby_controller.standby_dashboard_active ? "ON" : "NOK");
+#endif
   }
+}
 
-  if (smart_ring_ui_controller.flags.flag.check_option)
+static void smart_ring_ui_touch_released(void)
+{
+  // Get if the touch was for an action
+  if (!smart_ring_ui_controller.standby_controller.has_callback)
   {
-    switch (smart_ring_ui_controller.state)
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "Has no callback, check for timers\n\tSleep     : %s\n\tStandby   : %s\n\tDashboard : %s",
+             smart_ring_ui_controller.standby_controller.sleep_active ? "ON" : "NOK",
+             smart_ring_ui_controller.standby_controller.standby_active ? "ON" : "NOK",
+             smart_ring_ui_controller.standby_controller.standby_dashboard_active ? "ON" : "NOK");
+#endif
+    if (smart_ring_ui_controller.standby_controller.sleep_active)
+    {
+      smart_ring_ui_controller.standby_timer_type = SLEEP;
+      esp_timer_start_once(smart_ring_ui_controller.standby_timer, SLEEP_TIMEOUT * 1000000);
+    }
+    else if (smart_ring_ui_controller.standby_controller.standby_active)
+    {
+      smart_ring_ui_controller.standby_timer_type = STANDBY;
+      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    }
+    else if (smart_ring_ui_controller.standby_controller.standby_dashboard_active)
     {
-    case STATE_13:
-      modal_create_template(lv_scr_act(), &smart_ring_ui_controller, "Stock", "A enviar pedido", true);
-      smart_ring_ui_controller.flags.flag.change_stock = true;
-      break;
-    case STATE_14:
-      smart_ring_ui_update_state(STATE_11);
-      break;
-    case STATE_16:
-      modal_create_template(lv_scr_act(), &smart_ring_ui_controller, "Suporte", "A enviar pedido", true);
-      smart_ring_ui_controller.flags.flag.send_ticket = true;
-      break;
-    case STATE_17:
-      smart_ring_ui_update_state(STATE_11);
-      break;
-    case STATE_19:
       smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
       esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      smart_ring_ui_update_state(STATE_11);
-      break;
-    case STATE_21:
-      smart_ring_ui_update_state(STATE_11);
-      break;
-    default:
-      break;
     }
-    smart_ring_ui_controller.flags.flag.check_option = false;
-  }
 
-  if (smart_ring_ui_controller.flags.flag.cancel_update)
-  {
-    smart_ring_ui_select_menu(MENU_ID_FIRMWARE_UPDATE_FAILED);
-    smart_ring_ui_controller.flags.flag.cancel_update = false;
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "Timers restarted");
+#endif
   }
 
-  if (smart_ring_ui_controller.flags.flag.success)
-  {
-    smart_ring_ui_select_menu(MENU_ID_FIRMWARE_UPDATE_COMPLETE);
-    smart_ring_ui_controller.flags.flag.success = false;
-  }
+  smart_ring_ui_controller.standby_controller.has_callback = false;
+  smart_ring_ui_controller.standby_controller.sleep_active = false;
+  smart_ring_ui_controller.standby_controller.standby_active = false;
+  smart_ring_ui_controller.standby_controller.standby_dashboard_active = false;
+}
 
-  if (smart_ring_ui_controller.flags.flag.touch_pressed)
+static void smart_ring_ui_show_state(enum smart_ring_ui_state_machine_t state,
+                                     enum smart_ring_ui_state_machine_t old_state)
+{
+  switch (state)
   {
+  case STATE_0:
+    smart_ring_ui_select_menu(MENU_ID_BOOT);
+    break;
+  case STATE_1:
+    smart_ring_ui_select_menu(MENU_ID_SELECT_COMMUNICATION);
+    break;
+  case STATE_2:
+    smart_ring_ui_select_menu(MENU_ID_SELECTED_COMMUNICATION);
+    smart_ring_ui_controller.timer_type = BOOT_START_COMMUNICATION;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
+    break;
+  case STATE_3:
+    modal_create_provision(smart_ring_ui_controller.screen, &smart_ring_ui_controller);
+    break;
+  case STATE_4:
+    boot_update_connection_screen();
+    break;
+  case STATE_5:
+    smart_ring_ui_controller.is_admin = false;
+    smart_ring_ui_controller.is_master = false;
+    smart_ring_ui_select_menu(MENU_ID_MAIN);
+    smart_ring_ui_controller.standby_timer_type = SLEEP;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, SLEEP_TIMEOUT * 1000000);
+    break;
+  case STATE_6:
+    modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Erro", "Sem ligação à internet", true);
+    modal_complete_progress(&smart_ring_ui_controller, false, "Sem ligação à internet");
 
+    // Create the timer to close the modal in 3 seconds
+    smart_ring_ui_controller.timer_type = CLOSE_MODAL;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+
+    // The modal is shown over the previous state, unless another one was
+    // posted meanwhile
+    if (smart_ring_ui_controller.state == STATE_6)
+    {
+      smart_ring_ui_controller.state = old_state;
+    }
+    break;
+  case STATE_7:
+    smart_ring_ui_select_menu(MENU_ID_PIN);
+    smart_ring_ui_controller.standby_timer_type = STANDBY;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_8:
 #ifndef NDEBUG
-    ESP_LOGI(TAG, "Standby timer : %s", esp_timer_is_active(smart_ring_ui_controller.standby_timer) ? "ON" : "NOK");
+    ESP_LOGI(TAG, "Inserted pin: %s", pin_get_inserted_pin());
 #endif
-    // Get if any timer is active
-    if (esp_timer_is_active(smart_ring_ui_controller.standby_timer))
-    {
+    // Create the modal
+    modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Validação de pin", "A validar", true);
+    smart_ring_ui_send_request(UI_REQUEST_SIGN_IN);
 
-      // Stop the timer
-      esp_timer_stop(smart_ring_ui_controller.standby_timer);
+    // Start the timer for the timeout
+    smart_ring_ui_controller.timer_type = LOGIN_VALIDATION;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
+    break;
+  case STATE_9:
+    modal_complete_progress(&smart_ring_ui_controller, false, "Erro ao validar pin");
 
-      // Get the timer type
-      if (smart_ring_ui_controller.standby_timer_type == STANDBY)
-      {
-        smart_ring_ui_controller.standby_controller.standby_active = true;
-      }
-      else if (smart_ring_ui_controller.standby_timer_type == SLEEP)
-      {
-        smart_ring_ui_controller.standby_controller.sleep_active = true;
-      }
-      else
-      {
-        smart_ring_ui_controller.standby_controller.standby_dashboard_active = true;
-      }
+    // Create the timer to close the modal in 3 seconds
+    smart_ring_ui_controller.timer_type = CLOSE_MODAL;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+    smart_ring_ui_controller.state = STATE_7;
+    break;
+  case STATE_10:
+    modal_complete_progress(&smart_ring_ui_controller, true, "Validado com sucesso");
+
+    // Create the timer to close the modal in 3 seconds
+    smart_ring_ui_controller.timer_type = LOGIN_SUCCESSFULL;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+    break;
+  case STATE_11:
+    smart_ring_ui_select_menu(MENU_ID_DASHBOARD);
+    smart_ring_ui_controller.standby_timer_type = STANDBY;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_12:
+    smart_ring_ui_select_menu(MENU_ID_INFO);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_13:
+    // TABVIEW NOTHING TO BE MADE
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_14:
+    smart_ring_ui_select_menu(MENU_ID_CHANGED_STOCK);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_15:
+    // TABVIEW NOTHING TO BE MADE
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_16:
+    smart_ring_ui_select_menu(MENU_ID_SUPPORT_REVIEW);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_17:
+    smart_ring_ui_select_menu(MENU_ID_SUPPORT_SUBMITED);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_18:
+    smart_ring_ui_select_menu(MENU_ID_MANAGE_ORDERS);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_19:
+    smart_ring_ui_select_menu(MENU_ID_ERROR_MANAGE);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_20:
+    smart_ring_ui_select_menu(MENU_ID_CHANGE_ORDER_MODE);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_21:
+    smart_ring_ui_select_menu(MENU_ID_SUCCESSFULL_MODE_CHANGE);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_22:
+    smart_ring_ui_controller.order.bottles = 0;
+    smart_ring_ui_controller.order.cups = 0;
+    smart_ring_ui_controller.order.changing_bottles = true;
+    smart_ring_ui_select_menu(MENU_ID_NEW_ORDER);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_23:
+    smart_ring_ui_select_menu(MENU_ID_REVIEW_ORDER);
+    break;
+  case STATE_24:
+    smart_ring_ui_controller.order.confirmation = 'x';
+    smart_ring_ui_select_menu(MENU_ID_CANCELED_ORDER);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_25:
+    smart_ring_ui_controller.order.confirmation = 'a';
+    smart_ring_ui_controller.timer_type = CONFIRM_ORDER;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 5 * 1000000);
+    smart_ring_ui_select_menu(MENU_ID_PROCESSING_ORDER);
+    smart_ring_ui_send_request(UI_REQUEST_CONFIRM_ORDER);
+    break;
+  case STATE_26:
+    smart_ring_ui_select_menu(MENU_ID_ERROR_ORDER);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_27:
+    esp_timer_stop(smart_ring_ui_controller.timer);
+    smart_ring_ui_select_menu(MENU_ID_SUCCESSFULL_ORDER);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_28:
+    smart_ring_ui_select_menu(MENU_ID_SETTINGS);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_29:
+    smart_ring_ui_select_menu(MENU_ID_CALIBRATION_EMPTY);
+    break;
+  case STATE_30:
+    smart_ring_ui_select_menu(MENU_ID_CALIBRATION_PROGRESS);
+    smart_ring_ui_calibration_update_progress_screen(false);
+    break;
+  case STATE_31:
+    smart_ring_ui_calibration_update_progress_screen(true);
+    if (smart_ring_ui_get_controller()->calibration_step == 1)
+    {
+      smart_ring_ui_controller.timer_type = CALIBRATION_EMPTY;
+      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+    }
+    else
+    {
+      smart_ring_ui_controller.timer_type = CALIBRATION_FULL;
+      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+    }
+    break;
+  case STATE_32:
+    smart_ring_ui_select_menu(MENU_ID_CALIBRATION_FULL);
+    break;
+  case STATE_33:
+    smart_ring_ui_select_menu(MENU_ID_CALIBRATION_FINISHED);
+    break;
+  case STATE_34:
+    smart_ring_ui_select_menu(MENU_ID_FIRMWARE_UPDATE);
+    break;
+  case STATE_35:
+    smart_ring_ui_send_request(UI_REQUEST_PENDING_ORDERS);
+    // Create the modal
+    modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Nova encomenda", "a verificar pedidos pendentes", true);
 
+    // Start the timer for the timeout
+
+    smart_ring_ui_controller.timer_type = PENDING_ORDERS;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 5 * 1000000);
+    break;
+  case STATE_36:
+    smart_ring_ui_select_menu(MENU_ID_RESET);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_37:
+    smart_ring_ui_select_menu(MENU_ID_RESET_DEVICE);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_38:
+    smart_ring_ui_select_menu(MENU_ID_RESET_WIFI);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_39:
+    smart_ring_ui_select_menu(MENU_ID_RESET_PROGRESS);
+    break;
+  case STATE_40:
+    smart_ring_ui_select_menu(MENU_ID_RESET_SUCCESS);
+    break;
+  case STATE_41:
+    smart_ring_ui_select_menu(MENU_ID_RESET_FAILED);
+    break;
+  case STATE_42:
+    smart_ring_ui_select_menu(MENU_ID_SLEEP);
+    break;
+  case STATE_43:
+    smart_ring_ui_select_menu(MENU_ID_UPDATE);
+    break;
+  case STATE_44:
 #ifndef NDEBUG
-      ESP_LOGI(TAG, "Stopping standby timers\n\tSleep     : %s\n\tStandby   : %s\n\tDashboard : %s",
-               smart_ring_ui_controller.standby_controller.sleep_active ? "ON" : "NOK",
-               smart_ring_ui_controller.standby_controller.standby_active ? "ON" : "NOK",
-               smart_ring_ui_controller.standby_controller.standby_dashboard_active ? "ON" : "NOK");
+    ESP_LOGI(TAG, "Inserted change pin: %s", pin_get_inserted_pin());
 #endif
-    }
-    smart_ring_ui_controller.flags.flag.touch_pressed = false;
+    // Create the modal
+    modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Atualização PIN",
+                          "A alterar pin...", true);
+
+    smart_ring_ui_send_request(UI_REQUEST_CHANGE_PIN);
+
+    // Start the timer for the timeout
+    smart_ring_ui_controller.timer_type = PIN_UPDATION;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
+    break;
+
+  case STATE_45:
+    modal_complete_progress(&smart_ring_ui_controller, false, "Erro a atualizar pin");
+
+    // Create the timer to close the modal in 3 seconds
+    smart_ring_ui_controller.timer_type = CLOSE_MODAL;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+    smart_ring_ui_controller.flags.update_pin = true;
+    smart_ring_ui_controller.state = STATE_7;
+    break;
+
+  case STATE_46:
+    modal_complete_progress(&smart_ring_ui_controller, false, "Erro ao obter pedidos pendentes");
+
+    // Create the timer to close the modal in 3 seconds
+    smart_ring_ui_controller.timer_type = CLOSE_MODAL;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+    break;
+
+  case STATE_47:
+    smart_ring_ui_select_menu(MENU_ID_POPUP_PENDING_ORDER);
+    smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
+    esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+    break;
+  case STATE_48:
+    // Create the modal
+    modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Conexão perdida ",
+                          "A reiniciar o dispositivo", true);
+
+    // Create the timer to close the modal in 3 seconds
+    smart_ring_ui_controller.timer_type = CLOSE_MODAL;
+
+    smart_ring_ui_send_request(UI_REQUEST_RESET_DEVICE);
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
+    break;
+  default:
+    break;
   }
+}
 
-  if (smart_ring_ui_controller.flags.flag.touch_released)
+/**
+ * @brief  Apply an event, with the GUI semaphore taken
+ * @param  *event: Event
+ * @retval None
+ */
+static void smart_ring_ui_handle_event(const struct smart_ring_ui_event_t *event)
+{
+  switch (event->type)
   {
+  case UI_EVENT_STATE:
+    smart_ring_ui_show_state(event->state, event->old_state);
+    break;
+  case UI_EVENT_TOUCH_PRESSED:
+    smart_ring_ui_touch_pressed();
+    break;
+  case UI_EVENT_TOUCH_RELEASED:
+    smart_ring_ui_touch_released();
+    break;
+  case UI_EVENT_CHECK_OPTION:
+    smart_ring_ui_check_option();
+    break;
+  case UI_EVENT_CLOSE_MODAL:
+#ifndef NDEBUG
+    printf("Closing modal\n");
+#endif
+    // Since the modal is the last child, use that position to delete the
+    // object
+    if (lv_obj_count_children(smart_ring_ui_controller.screen) > 0)
+    {
+      lv_obj_del(lv_obj_get_child(smart_ring_ui_controller.screen, NULL));
+    }
+    break;
+  case UI_EVENT_REQUEST_FAILED:
+    modal_complete_progress(&smart_ring_ui_controller, false, event->message);
 
-    // Get if the touch was for an action
-    if (!smart_ring_ui_controller.standby_controller.has_callback)
+    // Create the timer to close the modal in 3 seconds
+    smart_ring_ui_controller.timer_type = CLOSE_MODAL;
+    esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
+    break;
+  case UI_EVENT_BOOT_WARNING:
+    // The label is gone with the boot screen
+    if (smart_ring_ui_controller.menu == MENU_ID_BOOT)
+    {
+      boot_update_warning_label(event->message);
+    }
+    break;
+  case UI_EVENT_UPDATE_FAILED:
+    smart_ring_ui_select_menu(MENU_ID_FIRMWARE_UPDATE_FAILED);
+    break;
+  case UI_EVENT_UPDATE_COMPLETE:
+    smart_ring_ui_select_menu(MENU_ID_FIRMWARE_UPDATE_COMPLETE);
+    break;
+  case UI_EVENT_DOWNLOAD_STARTED:
+    if (smart_ring_ui_controller.menu == MENU_ID_FIRMWARE_UPDATE)
+    {
+      smart_ring_ui_update_download_started();
+    }
+    break;
+  case UI_EVENT_RSSI:
+    if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
     {
 #ifndef NDEBUG
-      ESP_LOGI(TAG, "Has no callback, check for timers\n\tSleep     : %s\n\tStandby   : %s\n\tDashboard : %s",
-               smart_ring_ui_controller.standby_controller.sleep_active ? "ON" : "NOK",
-               smart_ring_ui_controller.standby_controller.standby_active ? "ON" : "NOK",
-               smart_ring_ui_controller.standby_controller.standby_dashboard_active ? "ON" : "NOK");
+      ESP_LOGI(TAG, "Updating signal icon");
 #endif
-      if (smart_ring_ui_controller.standby_controller.sleep_active)
-      {
-        smart_ring_ui_controller.standby_timer_type = SLEEP;
-        esp_timer_start_once(smart_ring_ui_controller.standby_timer, SLEEP_TIMEOUT * 1000000);
-      }
-      else if (smart_ring_ui_controller.standby_controller.standby_active)
+      main_update_rssi_signal(smart_ring_ui_controller.rssi_level);
+    }
+    break;
+  case UI_EVENT_STOCK:
+    if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+    {
+      smart_ring_ui_main_update_stock_value(smart_ring_ui_controller.stock);
+    }
+    else if (smart_ring_ui_controller.state == STATE_13)
+    {
+      main_update_stock(smart_ring_ui_controller.stock);
+    }
+    break;
+  case UI_EVENT_DEPOSIT:
+    if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+    {
+      main_update_bottle_icon(&smart_ring_ui_controller);
+    }
+    break;
+  case UI_EVENT_SENSOR:
+    if (smart_ring_ui_controller.menu == MENU_ID_SETTINGS)
+    {
+      smart_ring_main_debug_update_sensor_values(event->sensor.old_value, event->sensor.new_value,
+                                                 event->sensor.stable);
+    }
+    break;
+  case UI_EVENT_ORDER_MODE:
+    if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+    {
+      main_update_order_mode(smart_ring_ui_controller.order_mode);
+    }
+    break;
+  case UI_EVENT_DEVICE_NAME:
+    if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+    {
+      main_update_device_name(smart_ring_ui_controller.device_name);
+    }
+    break;
+  case UI_EVENT_DELIVERIES:
+    // Check by menu, because the state changes before the screen is created
+    if (smart_ring_ui_controller.menu == MENU_ID_MAIN)
+    {
+      if (smart_ring_ui_controller.number_of_deliveries > 0)
       {
-        smart_ring_ui_controller.standby_timer_type = STANDBY;
-        esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+        smart_ring_ui_main_update_next_eta();
       }
-      else if (smart_ring_ui_controller.standby_controller.standby_dashboard_active)
+      else
       {
-        smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-        esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
+        smart_ring_ui_main_clear_next_eta();
       }
-
-#ifndef NDEBUG
-      ESP_LOGI(TAG, "Timers restarted");
-#endif
     }
+    break;
+  case UI_EVENT_ORDER_PRICE:
+    if (smart_ring_ui_controller.menu == MENU_ID_REVIEW_ORDER)
+    {
+      smart_ring_ui_order_update_review_data(smart_ring_ui_controller.order.price);
+    }
+    break;
+  case UI_EVENT_DOWNLOAD_PROGRESS:
+    if (smart_ring_ui_controller.menu == MENU_ID_FIRMWARE_UPDATE)
+    {
+      smart_ring_ui_update_change_percentage(event->value);
+    }
+    break;
+  default:
+    break;
+  }
+}
 
-    smart_ring_ui_controller.standby_controller.has_callback = false;
-    smart_ring_ui_controller.standby_controller.sleep_active = false;
-    smart_ring_ui_controller.standby_controller.standby_active = false;
-    smart_ring_ui_controller.standby_controller.standby_dashboard_active = false;
-    smart_ring_ui_controller.flags.flag.touch_released = false;
+void smart_ring_ui_events_init(void)
+{
+  if (smart_ring_ui_events != NULL)
+  {
+    return;
   }
 
-  if (smart_ring_ui_controller.flags.flag.update_state)
+  smart_ring_ui_events = xQueueCreate(UI_EVENT_QUEUE_LENGTH, sizeof(struct smart_ring_ui_event_t));
+  smart_ring_ui_requests = xQueueCreate(UI_REQUEST_QUEUE_LENGTH, sizeof(enum smart_ring_ui_request_t));
+  assert(smart_ring_ui_events != NULL && smart_ring_ui_requests != NULL);
+}
+
+bool smart_ring_ui_post_event(const struct smart_ring_ui_event_t *event)
+{
+  if (smart_ring_ui_events == NULL)
   {
-    switch (smart_ring_ui_controller.state)
-    {
-    case STATE_0:
-      smart_ring_ui_select_menu(MENU_ID_BOOT);
-      break;
-    case STATE_1:
-      smart_ring_ui_select_menu(MENU_ID_SELECT_COMMUNICATION);
-      break;
-    case STATE_2:
-      smart_ring_ui_select_menu(MENU_ID_SELECTED_COMMUNICATION);
-      smart_ring_ui_controller.timer_type = BOOT_START_COMMUNICATION;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
-      break;
-    case STATE_3:
-      modal_create_provision(smart_ring_ui_controller.screen, &smart_ring_ui_controller);
-      break;
-    case STATE_4:
-      boot_update_connection_screen();
-      break;
-    case STATE_5:
-      smart_ring_ui_controller.is_admin = false;
-      smart_ring_ui_controller.is_master = false;
-      smart_ring_ui_select_menu(MENU_ID_MAIN);
-      smart_ring_ui_controller.standby_timer_type = SLEEP;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, SLEEP_TIMEOUT * 1000000);
-      break;
-    case STATE_6:
-      modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Erro", "Sem ligação à internet", true);
-      modal_complete_progress(&smart_ring_ui_controller, false, "Sem ligação à internet");
+    ESP_LOGE(TAG, "Event %d posted before the queue was created", event->type);
+    return false;
+  }
 
-      // Create the timer to close the modal in 3 seconds
-      smart_ring_ui_controller.timer_type = CLOSE_MODAL;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
-      smart_ring_ui_controller.state = smart_ring_ui_controller.old_state;
-      break;
-    case STATE_7:
-      smart_ring_ui_select_menu(MENU_ID_PIN);
-      smart_ring_ui_controller.standby_timer_type = STANDBY;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_8:
-#ifndef NDEBUG
-      ESP_LOGI(TAG, "Inserted pin: %s", pin_get_inserted_pin());
-#endif
-      // Create the modal
-      modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Validação de pin", "A validar", true);
-      smart_ring_ui_controller.flags.flag.sign_in = true;
-
-      // Start the timer for the timeout
-      smart_ring_ui_controller.timer_type = LOGIN_VALIDATION;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
-      break;
-    case STATE_9:
-      modal_complete_progress(&smart_ring_ui_controller, false, "Erro ao validar pin");
-
-      // Create the timer to close the modal in 3 seconds
-      smart_ring_ui_controller.timer_type = CLOSE_MODAL;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
-      smart_ring_ui_controller.state = STATE_7;
-      break;
-    case STATE_10:
-      modal_complete_progress(&smart_ring_ui_controller, true, "Validado com sucesso");
+  // The UI task is the only one emptying the queue, it can't wait for room
+  bool from_ui = smart_ring_ui_task == xTaskGetCurrentTaskHandle();
+  TickType_t wait = from_ui ? 0 : pdMS_TO_TICKS(UI_EVENT_POST_TIMEOUT);
 
-      // Create the timer to close the modal in 3 seconds
-      smart_ring_ui_controller.timer_type = LOGIN_SUCCESSFULL;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
-      break;
-    case STATE_11:
-      smart_ring_ui_select_menu(MENU_ID_DASHBOARD);
-      smart_ring_ui_controller.standby_timer_type = STANDBY;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_12:
-      smart_ring_ui_select_menu(MENU_ID_INFO);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_13:
-      // TABVIEW NOTHING TO BE MADE
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_14:
-      smart_ring_ui_select_menu(MENU_ID_CHANGED_STOCK);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_15:
-      // TABVIEW NOTHING TO BE MADE
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_16:
-      smart_ring_ui_select_menu(MENU_ID_SUPPORT_REVIEW);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_17:
-      smart_ring_ui_select_menu(MENU_ID_SUPPORT_SUBMITED);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_18:
-      smart_ring_ui_select_menu(MENU_ID_MANAGE_ORDERS);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_19:
-      smart_ring_ui_select_menu(MENU_ID_ERROR_MANAGE);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_20:
-      smart_ring_ui_select_menu(MENU_ID_CHANGE_ORDER_MODE);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_21:
-      smart_ring_ui_select_menu(MENU_ID_SUCCESSFULL_MODE_CHANGE);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_22:
-      smart_ring_ui_controller.order.bottles = 0;
-      smart_ring_ui_controller.order.cups = 0;
-      smart_ring_ui_controller.order.changing_bottles = true;
-      smart_ring_ui_select_menu(MENU_ID_NEW_ORDER);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_23:
-      smart_ring_ui_select_menu(MENU_ID_REVIEW_ORDER);
-      break;
-    case STATE_24:
-      smart_ring_ui_controller.order.confirmation = 'x';
-      smart_ring_ui_select_menu(MENU_ID_CANCELED_ORDER);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_25:
-      smart_ring_ui_controller.order.confirmation = 'a';
-      smart_ring_ui_controller.timer_type = CONFIRM_ORDER;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 5 * 1000000);
-      smart_ring_ui_select_menu(MENU_ID_PROCESSING_ORDER);
-      smart_ring_ui_controller.flags.flag.confirm_order = true;
-      break;
-    case STATE_26:
-      smart_ring_ui_select_menu(MENU_ID_ERROR_ORDER);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_27:
-      esp_timer_stop(smart_ring_ui_controller.timer);
-      smart_ring_ui_select_menu(MENU_ID_SUCCESSFULL_ORDER);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_28:
-      smart_ring_ui_select_menu(MENU_ID_SETTINGS);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_29:
-      smart_ring_ui_select_menu(MENU_ID_CALIBRATION_EMPTY);
-      break;
-    case STATE_30:
-      smart_ring_ui_select_menu(MENU_ID_CALIBRATION_PROGRESS);
-      smart_ring_ui_calibration_update_progress_screen(false);
-      break;
-    case STATE_31:
-      smart_ring_ui_calibration_update_progress_screen(true);
-      if (smart_ring_ui_get_controller()->calibration_step == 1)
-      {
-        smart_ring_ui_controller.timer_type = CALIBRATION_EMPTY;
-        esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
-      }
-      else
-      {
-        smart_ring_ui_controller.timer_type = CALIBRATION_FULL;
-        esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
-      }
-      break;
-    case STATE_32:
-      smart_ring_ui_select_menu(MENU_ID_CALIBRATION_FULL);
-      break;
-    case STATE_33:
-      smart_ring_ui_select_menu(MENU_ID_CALIBRATION_FINISHED);
-      break;
-    case STATE_34:
-      smart_ring_ui_select_menu(MENU_ID_FIRMWARE_UPDATE);
-      break;
-    case STATE_35:
-      smart_ring_ui_controller.flags.flag.order_popup_message = true;
-      // Create the modal
-      modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Nova encomenda", "a verificar pedidos pendentes", true);
-
-      // Start the timer for the timeout
-
-      smart_ring_ui_controller.timer_type = PENDING_ORDERS;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 5 * 1000000);
-      break;
-    case STATE_36:
-      smart_ring_ui_select_menu(MENU_ID_RESET);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_37:
-      smart_ring_ui_select_menu(MENU_ID_RESET_DEVICE);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_38:
-      smart_ring_ui_select_menu(MENU_ID_RESET_WIFI);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_39:
-      smart_ring_ui_select_menu(MENU_ID_RESET_PROGRESS);
-      break;
-    case STATE_40:
-      smart_ring_ui_select_menu(MENU_ID_RESET_SUCCESS);
-      break;
-    case STATE_41:
-      smart_ring_ui_select_menu(MENU_ID_RESET_FAILED);
-      break;
-    case STATE_42:
-      smart_ring_ui_select_menu(MENU_ID_SLEEP);
-      gpio_set_level(CONFIG_LV_DISP_PIN_BCKL, 0);
-      break;
-    case STATE_43:
-      smart_ring_ui_select_menu(MENU_ID_UPDATE);
-      break;
-    case STATE_44:
-#ifndef NDEBUG
-      ESP_LOGI(TAG, "Inserted change pin: %s", pin_get_inserted_pin());
-#endif
-      // Create the modal
-      modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Atualização PIN",
-                            "A alterar pin...", true);
+  if (xQueueSend(smart_ring_ui_events, event, wait) != pdTRUE)
+  {
+    ESP_LOGE(TAG, "Event queue full, event %d dropped", event->type);
+    return false;
+  }
 
-      smart_ring_ui_controller.flags.flag.pin_changed = true;
+  smart_ring_ui_wake();
+  return true;
+}
 
-      // Start the timer for the timeout
-      smart_ring_ui_controller.timer_type = PIN_UPDATION;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
-      break;
+uint32_t smart_ring_ui_process_events(void)
+{
+  // The rate limited values wait here for their interval
+  static struct smart_ring_ui_event_t latest[UI_EVENT_MAX];
+  static int64_t applied_ms[UI_EVENT_MAX];
+  static uint32_t pending = 0;
 
-    case STATE_45:
-      modal_complete_progress(&smart_ring_ui_controller, false, "Erro a atualizar pin");
+  struct smart_ring_ui_event_t event;
+  uint32_t next_ms = UINT32_MAX;
 
-      // Create the timer to close the modal in 3 seconds
-      smart_ring_ui_controller.timer_type = CLOSE_MODAL;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
-      smart_ring_ui_get_controller()->flags.flag.update_pin = true;
-      smart_ring_ui_update_state(STATE_7);
-      break;
+  // The events posted while they're handled are handled in the same run
+  while (xQueueReceive(smart_ring_ui_events, &event, 0) == pdTRUE)
+  {
+    if (event.type < UI_EVENT_FIRST_VALUE)
+    {
+      smart_ring_ui_handle_event(&event);
+      continue;
+    }
 
-    case STATE_46:
-      modal_complete_progress(&smart_ring_ui_controller, false, "Erro ao obter pedidos pendentes");
+    // Keep the latest value, the sensor values not sent are kept too
+    if ((pending & (1UL << event.type)) && event.type == UI_EVENT_SENSOR)
+    {
+      if (event.sensor.old_value == NO_UPDATE)
+        event.sensor.old_value = latest[UI_EVENT_SENSOR].sensor.old_value;
+      if (event.sensor.new_value == NO_UPDATE)
+        event.sensor.new_value = latest[UI_EVENT_SENSOR].sensor.new_value;
+    }
+    latest[event.type] = event;
+    pending |= 1UL << event.type;
+  }
 
-      // Create the timer to close the modal in 3 seconds
-      smart_ring_ui_controller.timer_type = CLOSE_MODAL;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 3);
-      break;
+  // The values are applied once the screen of the last state is shown
+  int64_t now_ms = esp_timer_get_time() / 1000;
+  for (int type = UI_EVENT_FIRST_VALUE; type < UI_EVENT_MAX; type++)
+  {
+    if (!(pending & (1UL << type)))
+    {
+      continue;
+    }
 
-    case STATE_47:
-      smart_ring_ui_select_menu(MENU_ID_POPUP_PENDING_ORDER);
-      smart_ring_ui_controller.standby_timer_type = STANDBY_DASHBOARD;
-      esp_timer_start_once(smart_ring_ui_controller.standby_timer, STANDBY_TIMEOUT * 1000000);
-      break;
-    case STATE_48:
-      // Create the modal
-      modal_create_template(smart_ring_ui_controller.screen, &smart_ring_ui_controller, "Conexão perdida ",
-                            "A reiniciar o dispositivo", true);
-
-      // Create the timer to close the modal in 3 seconds
-      smart_ring_ui_controller.timer_type = CLOSE_MODAL;
-
-      smart_ring_ui_get_controller()->flags.flag.reset_device = true;
-      esp_timer_start_once(smart_ring_ui_controller.timer, 1000000 * 5);
-      break;
-    default:
-      break;
+    int64_t due_ms = applied_ms[type] + smart_ring_ui_value_interval_ms[type];
+    if (now_ms < due_ms)
+    {
+      if (due_ms - now_ms < next_ms)
+        next_ms = due_ms - now_ms;
+      continue;
     }
-    smart_ring_ui_controller.flags.flag.update_state = false;
+
+    pending &= ~(1UL << type);
+    applied_ms[type] = now_ms;
+    smart_ring_ui_handle_event(&latest[type]);
   }
+
+  return next_ms;
 }
 
 void smart_ring_ui_update_state(enum smart_ring_ui_state_machine_t state)
@@ -905,7 +1319,43 @@ void smart_ring_ui_update_state(enum smart_ring_ui_state_machine_t state)
 #endif
   smart_ring_ui_controller.old_state = smart_ring_ui_controller.state;
   smart_ring_ui_controller.state = state;
-  smart_ring_ui_controller.flags.flag.update_state = true;
+
+  // Every state is shown in order, none is overwritten by the next one
+  struct smart_ring_ui_event_t event = {
+      .type = UI_EVENT_STATE, .state = state, .old_state = smart_ring_ui_controller.old_state};
+  smart_ring_ui_post_event(&event);
+}
+
+void smart_ring_ui_send_request(enum smart_ring_ui_request_t request)
+{
+  if (smart_ring_ui_requests == NULL || xQueueSend(smart_ring_ui_requests, &request, 0) != pdTRUE)
+  {
+    ESP_LOGE(TAG, "Request %d dropped", request);
+  }
+}
+
+bool smart_ring_ui_receive_request(enum smart_ring_ui_request_t *request, TickType_t wait)
+{
+  if (smart_ring_ui_requests == NULL)
+  {
+    vTaskDelay(wait);
+    return false;
+  }
+
+  return xQueueReceive(smart_ring_ui_requests, request, wait) == pdTRUE;
+}
+
+void smart_ring_ui_set_task(TaskHandle_t task)
+{
+  smart_ring_ui_task = task;
+}
+
+void smart_ring_ui_wake()
+{
+  // The UI task notifies itself too, so the events posted by the LVGL
+  // callbacks don't wait for the next LVGL task deadline
+  if (smart_ring_ui_task != NULL)
+    xTaskNotifyGive(smart_ring_ui_task);
 }
 
 struct smart_ring_ui_controller_t *smart_ring_ui_get_controller()
@@ -948,18 +1398,17 @@ static void ui_callback_timer_callback(void *arg)
   switch (smart_ring_ui_controller.timer_type)
   {
   case CLOSE_MODAL:
-#ifndef NDEBUG
-    printf("Closing modal\n");
-#endif
-    // Since the modal is the last child, use that position to delete the
-    // object
-    lv_obj_del(lv_obj_get_child(smart_ring_ui_controller.screen, NULL));
+  {
+    // The timer task can't call LVGL
+    struct smart_ring_ui_event_t event = {.type = UI_EVENT_CLOSE_MODAL};
+    smart_ring_ui_post_event(&event);
     break;
+  }
   case BOOT_START_COMMUNICATION:
 #ifndef NDEBUG
     ESP_LOGI(TAG, "Starting communication");
 #endif
-    smart_ring_ui_controller.flags.flag.start_communication = true;
+    smart_ring_ui_send_request(UI_REQUEST_START_COMMUNICATION);
     break;
   case LOGIN_VALIDATION:
     smart_ring_ui_update_state(STATE_9);
@@ -18,6 +18,10 @@ extern "C" {
 #include "esp_log.h"
 #include <esp_system.h>
 #include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include <stdarg.h>
 #include <stdio.h>
 
 #include "./menus/boot.h"
@@ -25,11 +29,14 @@ extern "C" {
 #include "./menus/main.h"
 #include "./menus/modal.h"
 #include "./menus/order.h"
+#include "./menus/perf.h"
 #include "./menus/pin.h"
 #include "./menus/reset.h"
 #include "./menus/stock.h"
 #include "./menus/support.h"
 #include "./menus/update.h"
+#include "./img/img_decoder.h"
+#include "./fonts/font_cache.h"
 #include "lvgl.h"
 
 //===================//
@@ -40,6 +47,19 @@ extern "C" {
 #define SLEEP_TIMEOUT           60
 #define STANDBY_TIMEOUT         10
 
+/* Events posted to the UI task and requests sent by it */
+#define UI_EVENT_QUEUE_LENGTH   32
+#define UI_REQUEST_QUEUE_LENGTH 8
+/* Time another task waits for room in the event queue (ms) */
+#define UI_EVENT_POST_TIMEOUT   100
+
+/* Shortest time between two updates of the widgets showing a value (ms) */
+#define UI_RSSI_MIN_INTERVAL_MS     1000
+#define UI_SENSOR_MIN_INTERVAL_MS   500
+#define UI_PROGRESS_MIN_INTERVAL_MS 250
+/* Longest text set by smart_ring_ui_label_set_text_fmt */
+#define UI_LABEL_FMT_MAX_LEN        64
+
 #define SR_DEFAULT_BTN_RADIUS   5
 #define SR_DEFAULT_BTN_WIDTH    96
 #define SR_DEFAULT_BTN_HEIGHT   35
@@ -110,53 +130,99 @@ extern "C" {
  **********************/
 
 /**
- * @brief  Flags to integrate the UI component with the rtest of the
- * firmware and assure that the actions are taken at the right time by the
- * LVGL library.
+ * @brief  Modes of the UI shared with the rest of the firmware. The actions
+ * are not flags anymore, they're posted as smart_ring_ui_event_t to the UI
+ * task and sent back as smart_ring_ui_request_t
  * @note   It may change during the course of the firmware integration
  */
 typedef struct smart_ring_ui_flags_t {
-    int update_state             : 1; // Update the state the UI is on
-    int select_communication     : 1;
-    int start_communication      : 1;
-    int sign_in                  : 1;
-    int check_option             : 1;
-    int cancel_option            : 1;
-    int change_stock             : 1;
-    int send_ticket              : 1;
-    int change_order_mode        : 1;
-    int resend_order_mode        : 1;
-    int manage_orders            : 1;
-    int reset_device             : 1;
-    int reset_wifi               : 1;
-    int update                   : 1;
-    int update_pin               : 1;
-    int update_stock_manual      : 1; 
-    int update_firmware          : 1;
-    int pin_changed              : 1;
-    int cancel_update            : 1;
-    int success                  : 1;
-    int start_login              : 1;
-    int start_order              : 1;
-    int start_calibration        : 1;
-    int cancel_calibration       : 1;
-    int empty_calibration        : 1;
-    int confirm_order            : 1;
-    int touch_pressed            : 1;
-    int touch_released           : 1;
-    int order_confirmed_response : 1;
-    int order_popup_message      : 1;
-    int register_water_level     : 1;
-    int flag_25                  : 1;
-    int flag_26                  : 1;
-    int flag_27                  : 1;
-    int flag_28                  : 1;
-    int flag_29                  : 1;
-    int flag_30                  : 1;
-    int flag_31                  : 1;
-    int flag_32                  : 1;
+    bool update_pin;               // The PIN screen changes the PIN instead of validating it
+    bool update_stock_manual;      // The stock sent was changed by the sensors, not the user
+    bool order_confirmed_response; // The back-end answered the order confirmation
+    bool register_water_level;
 };
 
+/**
+ * @brief  Events handled by the UI task, in the order they're posted. Only the
+ * UI task calls LVGL, the other tasks and the UI timers post events instead
+ * @note   The value events from UI_EVENT_RSSI on are coalesced, only the
+ * latest one of each type pending is applied, and some are rate limited
+ */
+typedef enum smart_ring_ui_event_type_t {
+    UI_EVENT_STATE,             // Show the screen of a state
+    UI_EVENT_TOUCH_PRESSED,
+    UI_EVENT_TOUCH_RELEASED,
+    UI_EVENT_CHECK_OPTION,      // Confirm button of the current screen
+    UI_EVENT_CLOSE_MODAL,
+    UI_EVENT_REQUEST_FAILED,    // Complete the progress modal with an error
+    UI_EVENT_BOOT_WARNING,      // Message of the boot screen
+    UI_EVENT_UPDATE_FAILED,
+    UI_EVENT_UPDATE_COMPLETE,
+    UI_EVENT_DOWNLOAD_STARTED,
+    UI_EVENT_RSSI,
+    UI_EVENT_STOCK,
+    UI_EVENT_DEPOSIT,
+    UI_EVENT_SENSOR,
+    UI_EVENT_ORDER_MODE,
+    UI_EVENT_DEVICE_NAME,
+    UI_EVENT_DELIVERIES,
+    UI_EVENT_ORDER_PRICE,
+    UI_EVENT_DOWNLOAD_PROGRESS,
+    UI_EVENT_MAX,
+} smart_ring_ui_event_type_t;
+
+/* First event type that is coalesced */
+#define UI_EVENT_FIRST_VALUE UI_EVENT_RSSI
+
+/**
+ * @brief  Event posted to the UI task. The values kept by the controller are
+ * set by the poster, the event only carries the ones that aren't
+ * @note   It may change during the course of the firmware integration
+ */
+typedef struct smart_ring_ui_event_t {
+    enum smart_ring_ui_event_type_t type;
+    union {
+        struct {
+            int state;
+            int old_state;      // State before it, restored after STATE_6
+        };                      // UI_EVENT_STATE
+        int         value;      // UI_EVENT_DOWNLOAD_PROGRESS
+        const char *message;    // UI_EVENT_REQUEST_FAILED and
+                                // UI_EVENT_BOOT_WARNING, a string literal
+        struct {
+            int  old_value;
+            int  new_value;
+            bool stable;
+        } sensor;               // UI_EVENT_SENSOR, NO_UPDATE keeps a value
+    };
+} smart_ring_ui_event_t;
+
+/**
+ * @brief  Requests of the UI to the rest of the firmware, received by the
+ * main task with smart_ring_ui_receive_request
+ * @note   It may change during the course of the firmware integration
+ */
+typedef enum smart_ring_ui_request_t {
+    UI_REQUEST_START_LOGIN,
+    UI_REQUEST_SELECT_COMMUNICATION,
+    UI_REQUEST_START_COMMUNICATION,
+    UI_REQUEST_SIGN_IN,
+    UI_REQUEST_CHANGE_PIN,
+    UI_REQUEST_SEND_TICKET,
+    UI_REQUEST_CHANGE_STOCK,
+    UI_REQUEST_PENDING_ORDERS,
+    UI_REQUEST_CHANGE_ORDER_MODE,
+    UI_REQUEST_MANAGE_ORDERS,
+    UI_REQUEST_RESET_DEVICE,
+    UI_REQUEST_RESET_WIFI,
+    UI_REQUEST_UPDATE_FIRMWARE,
+    UI_REQUEST_START_ORDER,
+    UI_REQUEST_START_CALIBRATION,
+    UI_REQUEST_EMPTY_CALIBRATION,
+    UI_REQUEST_CANCEL_CALIBRATION,
+    UI_REQUEST_CONFIRM_ORDER,
+} smart_ring_ui_request_t;
+
 /**
  * @brief  Pending delivery information
  * @note   It may change during the course of the firmware integration
@@ -290,9 +356,7 @@ typedef struct smart_ring_ui_standby_controller_t {
  * @param screen           Current screen object
  * @param menu             Current menu id
  * @param state            Current state of the state machine
- * @param has_flags        Inform the controller that there are flags, to prevent
- *                         running the checks every cycle
- * @param flags            Flags for the operation of the controller
+ * @param flags            Modes of the UI shared with the rest of the firmware
  * @param timer            Timer used for timeouts or flow control
  * @param firmware_version Firmware version
  * @param device_name      Device name to present on main screen
@@ -310,10 +374,7 @@ typedef struct smart_ring_ui_controller_t {
     uint16_t                           menu;
     enum smart_ring_ui_state_machine_t state;
     enum smart_ring_ui_state_machine_t old_state;
-    union map {
-        struct smart_ring_ui_flags_t flag;
-        int                          has_flags;  
-    } flags;
+    struct smart_ring_ui_flags_t              flags;
     enum smart_ring_ui_timer_type_t           timer_type;
     esp_timer_handle_t                        timer;
     enum smart_ring_ui_timer_type_t           standby_timer_type;
@@ -420,6 +481,62 @@ void smart_ring_ui_set_stock(int stock);
 uint8_t smart_ring_ui_get_rssi_level();
 void    smart_ring_ui_set_rssi_level(uint8_t rssi_level);
 
+/**
+ * @brief  Show the sensor values on the settings screen
+ * @param  old_value: Previous reading, NO_UPDATE to keep the shown one
+ * @param  new_value: Current reading, NO_UPDATE to keep the shown one
+ * @param  stable: The reading is stable
+ * @retval None
+ */
+void smart_ring_ui_set_sensor_values(int old_value, int new_value, bool stable);
+
+/**
+ * @brief  Show the deliveries of the controller again, after they're received
+ * @retval None
+ */
+void smart_ring_ui_update_deliveries(void);
+
+/**
+ * @brief  Show the price of the order on the review screen
+ * @param  price: Price of the order
+ * @retval None
+ */
+void smart_ring_ui_set_order_price(float price);
+
+/**
+ * @brief  Show the firmware download progress, from 0%
+ * @retval None
+ */
+void smart_ring_ui_set_download_started(void);
+
+/**
+ * @brief  Show the firmware download progress
+ * @param  percentage: Downloaded percentage
+ * @retval None
+ */
+void smart_ring_ui_set_download_progress(int percentage);
+
+/**
+ * @brief  Show the result of the firmware update
+ * @param  complete: The image was written and set as the boot partition
+ * @retval None
+ */
+void smart_ring_ui_set_update_result(bool complete);
+
+/**
+ * @brief  Complete the progress modal with an error and close it
+ * @param  *message: Message of the modal, a string literal
+ * @retval None
+ */
+void smart_ring_ui_request_failed(const char *message);
+
+/**
+ * @brief  Show a message on the boot screen, if it's still shown
+ * @param  *message: Message, a string literal
+ * @retval None
+ */
+void smart_ring_ui_set_boot_warning(const char *message);
+
 /**
  * @brief  Create the header for the screens
  * @note   It may change during the course of the firmware integration
@@ -430,14 +547,95 @@ void    smart_ring_ui_set_rssi_level(uint8_t rssi_level);
 void create_header(lv_obj_t *parent, char *title, struct smart_ring_ui_controller_t *ui_controller);
 
 /**
- * @brief  Function to check for existing flags and execute the proper
- * functionality
- * @note   It may change during the course of the firmware integration
+ * @brief  Set the text of a label only when it changed, since setting the same
+ *         text still redraws the label
+ * @param  *label: Label object
+ * @param  *text: New text
  * @retval None
  */
-void smart_ring_ui_check_flags();
+void smart_ring_ui_label_set_text(lv_obj_t *label, const char *text);
+
+/**
+ * @brief  Format the text of a label and set it only when it changed
+ * @param  *label: Label object
+ * @param  *fmt: printf format, the text is cut at UI_LABEL_FMT_MAX_LEN
+ * @retval None
+ */
+void smart_ring_ui_label_set_text_fmt(lv_obj_t *label, const char *fmt, ...);
+
+/**
+ * @brief  Give a label showing a changing value a fixed size, so a new value
+ *         only redraws the label area instead of the old and new text sizes.
+ *         Called once the text and the font are set, the height is kept
+ * @param  *label: Label object
+ * @param  width: Width fitting the longest value
+ * @param  align: Alignment of the text in the label
+ * @retval None
+ */
+void smart_ring_ui_label_set_fixed_width(lv_obj_t *label, lv_coord_t width, lv_label_align_t align);
+
+/**
+ * @brief  Set the source of an image only when it changed
+ * @param  *img: Image object
+ * @param  *src: New image source
+ * @retval None
+ */
+void smart_ring_ui_img_set_src(lv_obj_t *img, const void *src);
+
+/**
+ * @brief  Create the event and request queues. Must be called before any other
+ *         task uses the UI
+ * @retval None
+ */
+void smart_ring_ui_events_init(void);
+
+/**
+ * @brief  Post an event to the UI task and wake it. The UI task never waits
+ *         for room in the queue, the other tasks wait UI_EVENT_POST_TIMEOUT
+ * @param  *event: Event, copied into the queue
+ * @retval If the event was posted
+ */
+bool smart_ring_ui_post_event(const struct smart_ring_ui_event_t *event);
+
+/**
+ * @brief  Handle the pending events, from the UI task with the GUI semaphore
+ *         taken. The values posted several times are only applied once, and
+ *         the rate limited ones wait for their interval
+ * @retval Time until a value held back is due (ms), UINT32_MAX if none is
+ */
+uint32_t smart_ring_ui_process_events(void);
 
 void smart_ring_ui_update_state(enum smart_ring_ui_state_machine_t state);
+
+/**
+ * @brief  Send a request to the main task. Called from the UI task, it doesn't
+ *         wait for room in the queue
+ * @param  request: Request
+ * @retval None
+ */
+void smart_ring_ui_send_request(enum smart_ring_ui_request_t request);
+
+/**
+ * @brief  Wait for a request of the UI
+ * @param  *request: Received request
+ * @param  wait: Ticks to wait for a request
+ * @retval If a request was received
+ */
+bool smart_ring_ui_receive_request(enum smart_ring_ui_request_t *request, TickType_t wait);
+
+/**
+ * @brief  Set the task running lv_task_handler, woken by smart_ring_ui_wake
+ * @param  task: Handle of the UI task
+ * @retval None
+ */
+void smart_ring_ui_set_task(TaskHandle_t task);
+
+/**
+ * @brief  Wake the UI task so a change is handled without waiting for the next
+ *         LVGL task deadline
+ * @retval None
+ */
+void smart_ring_ui_wake();
 struct smart_ring_ui_controller_t *smart_ring_ui_get_controller();
 
 static void ui_callback_standby_timer_callback(void *arg);
@@ -0,0 +1,74 @@
+/**
+ * @file boot_profiler.h
+ * @brief Boot sequence timeline and dependencies header
+ * @version 2.1.2
+ * @date 2023-05-03
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef __BOOT_PROFILER_H_
+#define __BOOT_PROFILER_H_
+
+// Timeline
+/// Phases kept in the boot timeline, the later ones are dropped
+#define BOOT_PROFILER_MAX_PHASES 32
+
+// Boot dependencies
+/// LVGL and the drivers are initialized and the UI thread is running
+#define BOOT_UI_READY_BIT        BIT0
+/// The settings are loaded from the NVS into the controllers
+#define BOOT_SETTINGS_LOADED_BIT BIT1
+/// The device configuration was received from the backend
+#define BOOT_CONFIG_RECEIVED_BIT BIT2
+/// The main screen was shown for the first time
+#define BOOT_MAIN_SCREEN_BIT     BIT3
+/// Longest wait for the UI thread before the boot carries on without it (ms)
+#define BOOT_UI_READY_TIMEOUT_MS 5000
+
+/**
+ * @brief
+ * Create the boot event group and record the first phase. Called first in
+ * app_main
+ *
+ */
+void boot_profiler_init(void);
+
+/**
+ * @brief
+ * Record the end of a boot phase, with the time and the task that ran it
+ *
+ * @param phase Name of the phase, must be a string literal
+ *
+ */
+void boot_profiler_mark(const char *phase);
+
+/**
+ * @brief
+ * Print the boot timeline recorded so far
+ *
+ */
+void boot_profiler_print(void);
+
+/**
+ * @brief
+ * Signal that a boot step is done, releasing the steps waiting for it
+ *
+ * @param bits BOOT_*_BIT of the steps done
+ *
+ */
+void boot_signal(EventBits_t bits);
+
+/**
+ * @brief
+ * Wait for boot steps to be done
+ *
+ * @param bits BOOT_*_BIT of the steps to wait for
+ * @param ticks Longest time to wait
+ * @return true when all the steps are done
+ *
+ */
+bool boot_wait(EventBits_t bits, TickType_t ticks);
+
+#endif
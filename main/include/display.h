@@ -0,0 +1,105 @@
+/**
+ * @file display.h
+ * @brief Display rendering pipeline header
+ * @version 2.1.2
+ * @date 2024-10-22
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef __DISPLAY_H_
+#define __DISPLAY_H_
+
+// Strip buffers
+/// Lines of each of the two DMA strip buffers
+#ifdef CONFIG_SR_DISPLAY_BUFFER_LINES
+#define DISPLAY_BUFFER_LINES CONFIG_SR_DISPLAY_BUFFER_LINES
+#else
+#define DISPLAY_BUFFER_LINES 20
+#endif
+/// Pixels of each strip buffer, at most DISP_BUF_SIZE which sizes the
+/// largest SPI transfer of the bus
+#define DISPLAY_BUFFER_SIZE  (LV_HOR_RES_MAX * DISPLAY_BUFFER_LINES)
+
+// Power
+/// Seconds without a touch before the backlight is dimmed, 0 to never dim it
+#ifdef CONFIG_SR_DISPLAY_DIM_TIMEOUT
+#define DISPLAY_DIM_TIMEOUT        CONFIG_SR_DISPLAY_DIM_TIMEOUT
+#else
+#define DISPLAY_DIM_TIMEOUT        30
+#endif
+/// Brightness of the dimmed backlight (%)
+#ifdef CONFIG_SR_DISPLAY_DIM_LEVEL
+#define DISPLAY_DIM_LEVEL          CONFIG_SR_DISPLAY_DIM_LEVEL
+#else
+#define DISPLAY_DIM_LEVEL          20
+#endif
+/// Duration of the fade of the backlight to the dimmed level (ms)
+#define DISPLAY_DIM_FADE_MS        500
+/// Time the panel stays awake after a wake up, for the touch that woke it to
+/// be read, and at least the 120 ms the ILI9341 needs between a sleep out and
+/// a sleep in (ms)
+#define DISPLAY_WAKE_GRACE_MS      1000
+/// Time the ILI9341 needs after a sleep out before the next command (ms)
+#define DISPLAY_SLEEP_OUT_MS       5
+/// Time the ILI9341 needs between a sleep in and a sleep out (ms)
+#define DISPLAY_SLEEP_IN_MS        120
+/// LEDC channel and duty resolution of the backlight, as set up by
+/// disp_driver_init
+#define DISPLAY_BACKLIGHT_CHANNEL  LEDC_CHANNEL_0
+#define DISPLAY_BACKLIGHT_MAX_DUTY 1023
+
+/**
+ * @brief
+ * Allocate the display buffers and set the flush callback of the driver,
+ * before it is registered.
+ *
+ * LVGL renders into one strip buffer while the other one is sent to the
+ * display by the SPI DMA, the transfer calling lv_disp_flush_ready from the
+ * SPI post-transaction interrupt. With CONFIG_SR_DISPLAY_FULL_FRAME the frame
+ * is rendered in PSRAM and sent through the two strip buffers, since the SPI
+ * DMA can't read from PSRAM.
+ *
+ * With CONFIG_SR_UI_PERF_MONITOR the flushes and the frames are timed for the
+ * UI performance monitor.
+ *
+ * @param disp_drv Display driver initialized by lv_disp_drv_init
+ */
+void display_init(lv_disp_drv_t *disp_drv);
+
+/**
+ * @brief
+ * Take over the backlight set up by lvgl_driver_init, so the display power
+ * manager can fade it.
+ *
+ */
+void display_power_init(void);
+
+/**
+ * @brief
+ * Run the display power manager, from the UI task after lv_task_handler.
+ *
+ * The backlight fades to DISPLAY_DIM_LEVEL once nothing was touched for
+ * DISPLAY_DIM_TIMEOUT and is restored by the next touch. While the UI shows
+ * the sleep screen the backlight is switched off and the ILI9341 is put in
+ * sleep in, which keeps its frame memory: on a touch, or when the UI leaves
+ * the sleep screen, it's woken up with the frame it showed.
+ *
+ * @param sleep_screen Whether the UI shows the sleep screen
+ * @return Time until the manager has to run again (ms), 0 when the panel was
+ *         just woken up, UINT32_MAX when only a touch or the UI can change
+ *         its state
+ */
+uint32_t display_power_update(bool sleep_screen);
+
+/**
+ * @brief
+ * Whether the panel is in sleep in, nothing drawn reaches it until it's
+ * woken up.
+ *
+ * @return true while the panel sleeps
+ */
+bool display_power_is_asleep(void);
+
+#endif
@@ -43,6 +43,13 @@
 #define MAX_HTTP_RECV_BUFFER   512
 #define MAX_HTTP_OUTPUT_BUFFER 4096
 
+// Persistent connection pool
+/// Number of endpoints the client keeps a connection open to
+#define HTTP_CLIENT_POOL_SIZE            2
+/// Time, in seconds, an idle pooled connection is reused for. Older ones are
+/// closed by the next request instead
+#define HTTP_CLIENT_POOL_IDLE_TIMEOUT    30
+
 
 /// Certificate start for the OTA update
 extern const uint8_t ota_root_pem_start[] asm("_binary_ota_root_pem_start");
@@ -64,6 +71,12 @@ void smart_ring_http_client_get_check_firmware();
  */
 void smart_ring_http_client_get_update_firmware();
 
+/**
+ * @brief
+ * Request a new device certificate and private key from the claim API and
+ * store them on the device
+ *
+ */
 void smart_ring_http_client_get_certificate(void);
 
 #endif
\ No newline at end of file
@@ -31,6 +31,28 @@
 /// The task runs on the Core 0 (APP core)
 #define HTTP_SERVER_TASK_CORE_ID 0
 
+// Background network scan for the provisioning page
+/// Stack size for the scan task
+#define HTTP_SERVER_SCAN_TASK_STACK_SIZE 4096
+/// Priority of the scan task, below the server so requests are never delayed
+#define HTTP_SERVER_SCAN_TASK_PRIORITY 2
+/// Shortest time between two scans, in milliseconds. The networks are scanned
+/// again when the page asks for them and the last scan is older
+#define HTTP_SERVER_SCAN_INTERVAL_MS 15000
+/// Access point records read from the driver on each scan
+#define HTTP_SERVER_SCAN_MAX_RECORDS 32
+/// Networks kept in the cache (after removing duplicated SSIDs)
+#define HTTP_SERVER_SCAN_MAX_NETWORKS 20
+
+// Webpage caching
+/// Cache-Control of index.html: always revalidated, so a new firmware is picked up
+#define HTTP_SERVER_CACHE_CONTROL_PAGE "no-cache"
+/// Cache-Control of the other assets. index.html asks for them with their ETag
+/// in the URL (see tools/webpage_assets.py), so they're cached for good
+#define HTTP_SERVER_CACHE_CONTROL_ASSET "public, max-age=31536000, immutable"
+/// Biggest If-None-Match header value that is checked against the ETags
+#define HTTP_SERVER_IF_NONE_MATCH_MAX_LEN 128
+
 /**
  * @brief
  * Status of the provision operation, to send to the user web browser.
@@ -70,6 +70,7 @@
 //#include "tcpip_adapter.h"
 
 #include "driver/gpio.h"
+#include "driver/ledc.h"
 
 #include "cJSON.h"
 
@@ -86,6 +87,10 @@
 #include "mqtt.h"
 #include "nvs.h"
 #include "spiffs.h"
+#include "boot_profiler.h"
+#include "link_quality.h"
+#include "scheduler.h"
+#include "display.h"
 #include "sensors.h"
 #include "sleep.h"
 #include "vars.h"
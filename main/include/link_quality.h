@@ -0,0 +1,96 @@
+/**
+ * @file link_quality.h
+ * @brief Link quality window header
+ * @version 2.1.2
+ * @date 2023-05-03
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef __LINK_QUALITY_H_
+#define __LINK_QUALITY_H_
+
+// Rolling window
+/// Samples kept of each measure, the oldest one is replaced
+#define LINK_QUALITY_WINDOW      12
+
+// Signal levels
+/// Average RSSI from which the link is strong (dBm)
+#define LINK_QUALITY_RSSI_STRONG -60
+/// Average RSSI under which the link is weak (dBm)
+#define LINK_QUALITY_RSSI_WEAK   -75
+/// Retransmissions in the window from which the link is weak, whatever the RSSI
+#define LINK_QUALITY_RETRANSMITS_WEAK 8
+
+/**
+ * @brief
+ * Summary of the samples in the window
+ *
+ */
+typedef struct link_quality_summary_t {
+  /// RSSI samples in the window
+  uint8_t rssi_samples;
+  /// Average RSSI (dBm)
+  int8_t rssi_avg;
+  /// Lowest RSSI (dBm)
+  int8_t rssi_min;
+  /// Highest RSSI (dBm)
+  int8_t rssi_max;
+  /// TCP retransmissions during the window
+  uint32_t retransmits;
+  /// MQTT round trip samples in the window
+  uint8_t rtt_samples;
+  /// Average MQTT round trip (ms)
+  uint32_t rtt_avg_ms;
+  /// Longest MQTT round trip (ms)
+  uint32_t rtt_max_ms;
+  /// Signal icon level, 0 (no network) to 3
+  uint8_t level;
+} link_quality_summary_t;
+
+/**
+ * @brief
+ * Add a RSSI sample to the window, with the TCP retransmissions since the
+ * previous sample
+ *
+ * @param rssi RSSI of the access point (dBm)
+ *
+ */
+void link_quality_add_rssi(int8_t rssi);
+
+/**
+ * @brief
+ * Add the round trip of an MQTT exchange to the window
+ *
+ * @param rtt_ms Time between the message and its acknowledge (ms)
+ *
+ */
+void link_quality_add_rtt(uint32_t rtt_ms);
+
+/**
+ * @brief
+ * Empty the window, when connected to another access point
+ *
+ */
+void link_quality_reset(void);
+
+/**
+ * @brief
+ * Summarize the samples in the window
+ *
+ * @param summary Filled with the summary
+ *
+ */
+void link_quality_get_summary(struct link_quality_summary_t *summary);
+
+/**
+ * @brief
+ * Tell whether the link is strong, weak or in between
+ *
+ * @return Position of the link between weak (0) and strong (100)
+ *
+ */
+int link_quality_get_strength(void);
+
+#endif
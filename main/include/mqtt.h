@@ -42,8 +42,34 @@
 /// Task runs on core 0
 #define MQTT_APP_TASK_CORE_ID    0
 
-// Define time interval to check version
-#define TIME_VERSION_INTERVAL  2000
+/// Period of the client loop (ms)
+#define MQTT_LOOP_PERIOD_MS    1000
+
+// Scheduler jobs
+/// Job asking the backend for the latest firmware version
+#define MQTT_VERSION_CHECK_JOB "version"
+/// Job sending the link quality summary
+#define MQTT_LINK_QUALITY_JOB  "lq"
+/// Job sending the frame times of the slowest menus
+#define MQTT_UI_PERF_JOB       "uip"
+/// Job sending the settings change counters
+#define MQTT_SETTINGS_WEAR_JOB "sw"
+
+// Link adaptation
+/// Keepalive negotiated with the broker, and used on a strong link (s)
+#define MQTT_KEEPALIVE_MAX_SEC          120
+/// Keepalive used on a weak link, to notice a dead connection sooner (s)
+#define MQTT_KEEPALIVE_MIN_SEC          30
+/// Shortest timeout of the outgoing packets (ms)
+#define MQTT_COMMAND_TIMEOUT_MIN_MS     5000
+/// Longest timeout of the outgoing packets, also used before any round trip is known (ms)
+#define MQTT_COMMAND_TIMEOUT_MAX_MS     20000
+/// Command timeout as a multiple of the longest round trip in the window
+#define MQTT_COMMAND_TIMEOUT_RTT_FACTOR 4
+/// Default interval of the link quality reports (s)
+#define MQTT_LINK_QUALITY_INTERVAL_S    300
+/// Default interval of the UI performance reports (s)
+#define MQTT_UI_PERF_INTERVAL_S         900
 
 
 // Certificates
@@ -248,7 +274,44 @@ typedef enum mqtt_message_type_t {
    * Info  : " "
    *
    */
-  SEND_REQUEST_LATESTVERSION
+  SEND_REQUEST_LATESTVERSION,
+
+  /**
+   * @brief
+   * Send the link quality summary
+   *
+   * Topic : d/{device_mac}/lq
+   * Info  : rssi average, min and max
+   *         tcp retransmissions
+   *         mqtt round trip average and max
+   *         keepalive in use
+   *
+   */
+  SEND_LINK_QUALITY,
+
+  /**
+   * @brief
+   * Send the frame times of the slowest menus since the last report
+   *
+   * Topic : d/{device_mac}/uip
+   * Info  : lvgl memory pool highest use, fragmentation and smallest
+   *         biggest free block
+   *         per menu: id, frames, render average and max, flush average
+   *         and max (us), average area drawn (px)
+   *
+   */
+  SEND_UI_PERF,
+
+  /**
+   * @brief
+   * Send the lifetime change counters of the settings, to find the ones
+   * wearing the flash
+   *
+   * Topic : d/{device_mac}/sw
+   * Info  : per settings key: changes requested and flash writes
+   *
+   */
+  SEND_SETTINGS_WEAR
 };
 
 /**
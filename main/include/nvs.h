@@ -19,18 +19,241 @@
 #ifndef __NVS_H_
 #define __NVS_H_
 
+// Settings blob
+/// NVS namespace of the settings blob
+#define NVS_SETTINGS_NAMESPACE "settings"
+/// NVS key of the settings blob
+#define NVS_SETTINGS_KEY "blob"
+/// Layout version of smart_ring_settings_t. New fields are only appended, and
+/// the version is bumped when they are
+#define NVS_SETTINGS_VERSION 5
+/// Longest time a change waits in RAM before being written (ms)
+#define NVS_SETTINGS_WRITE_DELAY_MS 10000
+/// Pause in the changes after which they are written (ms)
+#define NVS_SETTINGS_IDLE_MS 2000
+/// WiFi networks stored, the one with the worst history is replaced when full
+#define NVS_WIFI_MAX_NETWORKS 4
+/// Scheduler rules received from the backend that are stored
+#define NVS_SCHEDULE_MAX_JOBS 6
+/// Longest name of a scheduler job, with the terminator
+#define NVS_SCHEDULE_NAME_MAX_LEN 12
+/// Change counters kept in the blob, more than the settings keys so keys can
+/// be added without moving the fields after the counters
+#define NVS_SETTINGS_COUNTER_SLOTS 8
+
+// Persistence task
+/// Stack size of the persistence task
+#define NVS_SETTINGS_TASK_STACK_SIZE 3072
+/// Priority of the persistence task, below the UI and sensors
+#define NVS_SETTINGS_TASK_PRIORITY 2
+/// The task runs on the Core 0, with the rest of the flash users
+#define NVS_SETTINGS_TASK_CORE_ID 0
+/// Write intents waiting for the persistence task
+#define NVS_SETTINGS_QUEUE_LENGTH 16
+
+/**
+ * @brief
+ * Groups of settings, counted separately to find the ones wearing the flash
+ *
+ */
+typedef enum smart_ring_settings_key_t {
+  SETTINGS_KEY_WIFI,
+  SETTINGS_KEY_CONNECTION_TYPE,
+  SETTINGS_KEY_ORDER_MODE,
+  SETTINGS_KEY_CALIBRATION,
+  SETTINGS_KEY_STOCK,
+  SETTINGS_KEY_SCHEDULE,
+  SETTINGS_KEY_MAX
+} smart_ring_settings_key_t;
+
+/**
+ * @brief
+ * Lifetime counters of the settings changes, kept in the settings blob
+ *
+ */
+typedef struct smart_ring_settings_counters_t {
+  /// Changes requested per key, the slots past SETTINGS_KEY_MAX are unused
+  uint32_t requests[NVS_SETTINGS_COUNTER_SLOTS];
+  /// Flash writes that included a change of the key
+  uint32_t writes[NVS_SETTINGS_COUNTER_SLOTS];
+} smart_ring_settings_counters_t;
+
+/**
+ * @brief
+ * Last successful WiFi connection, used to reconnect without a full scan
+ *
+ */
+typedef struct smart_ring_settings_network_t {
+  /// The fields hold a connection
+  uint8_t valid;
+  /// Primary channel of the access point
+  uint8_t channel;
+  /// BSSID of the access point
+  uint8_t bssid[6];
+  /// Address given by DHCP, in network byte order
+  uint32_t ip;
+  /// Netmask given by DHCP, in network byte order
+  uint32_t netmask;
+  /// Gateway given by DHCP, in network byte order
+  uint32_t gateway;
+  /// Main DNS server given by DHCP, in network byte order
+  uint32_t dns;
+} smart_ring_settings_network_t;
+
+/**
+ * @brief
+ * WiFi network stored for the failover
+ *
+ */
+typedef struct smart_ring_settings_wifi_network_t {
+  /// Network SSID, empty for an unused entry
+  char ssid[33];
+  /// Network password
+  char password[65];
+  /// Priority, the network provisioned last has the highest
+  uint8_t priority;
+  /// Connections to the network
+  uint16_t successes;
+  /// Times the network was given up for another one
+  uint16_t failures;
+} smart_ring_settings_wifi_network_t;
+
 /**
  * @brief
- * Save the wifi credentials received during provision
+ * Scheduler rule received from the backend, see scheduler_rule_t
+ *
+ */
+typedef struct smart_ring_settings_job_t {
+  /// Job name, empty for an unused entry
+  char name[NVS_SCHEDULE_NAME_MAX_LEN];
+  /// Runs every period_s instead of at wall clock times
+  uint8_t monotonic;
+  /// Minute of the hours it runs at
+  uint8_t minute;
+  /// Days of the week it runs on, bit 0 for Sunday
+  uint8_t weekdays;
+  /// Hours of the day it runs at, bit n for the hour n
+  uint32_t hours;
+  /// Period (s)
+  uint32_t period_s;
+} smart_ring_settings_job_t;
+
+/**
+ * @brief
+ * Device settings kept on flash. A copy lives in RAM and is written as one
+ * CRC protected blob, instead of one NVS key per value.
+ *
+ */
+typedef struct smart_ring_settings_t {
+  /// Network SSID
+  char ssid[33];
+  /// Network password
+  char password[65];
+  /// Device provisioned
+  uint8_t provisioned;
+  /// Connection type (w: WiFi, g: GSM, l: LoRa, 0: not selected)
+  char connection_type;
+  /// Order mode (m: manual, a: automatic)
+  char order_mode;
+  /// Sensor is stable
+  uint8_t is_stable;
+  /// No deposit raw value
+  uint32_t no_deposit;
+  /// Full deposit raw value
+  uint32_t full_deposit;
+  /// Stock
+  uint16_t stock;
+  /// Change counters (version 2)
+  struct smart_ring_settings_counters_t counters;
+  /// Last connection, for the fast reconnect (version 3)
+  struct smart_ring_settings_network_t network;
+  /// Networks stored for the failover, ssid and password hold the one in use
+  /// (version 4)
+  struct smart_ring_settings_wifi_network_t networks[NVS_WIFI_MAX_NETWORKS];
+  /// Scheduler rules received from the backend (version 5)
+  struct smart_ring_settings_job_t schedule[NVS_SCHEDULE_MAX_JOBS];
+} smart_ring_settings_t;
+
+/**
+ * @brief
+ * Settings as stored on the NVS
+ *
+ */
+typedef struct smart_ring_settings_blob_t {
+  /// NVS_SETTINGS_VERSION of the firmware that wrote the blob
+  uint16_t version;
+  /// Size of the settings written
+  uint16_t length;
+  /// CRC32 of the settings written
+  uint32_t crc;
+  /// Settings
+  struct smart_ring_settings_t settings;
+} smart_ring_settings_blob_t;
+
+/**
+ * @brief
+ * Load the settings blob into RAM and start the persistence task. Must be
+ * called after nvs_flash_init and before any other nvs_save/nvs_load function.
+ *
+ * If there's no blob, the values saved one key at a time by the previous
+ * firmwares are migrated into a new one. A blob that can't be read is left on
+ * flash until a setting changes, the defaults are used meanwhile.
+ *
+ * The nvs_save functions only change the copy in RAM and return. The
+ * persistence task merges the changes and writes them in the background, and
+ * anything pending is written before esp_restart.
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK Settings loaded
+ * @retval Other Blob missing or invalid, values migrated or left at default
+ */
+esp_err_t nvs_settings_init(void);
+
+/**
+ * @brief
+ * Write the pending settings changes to flash now, on the calling task. The
+ * settings stay free to read and change during the write, the changes made
+ * meanwhile are left pending.
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK Settings written, or nothing to write
+ * @retval Other Error on NVS, the changes stay pending
+ */
+esp_err_t nvs_settings_commit(void);
+
+/**
+ * @brief
+ * Get the lifetime change counters of each settings key, reported over MQTT
+ * by the MQTT_SETTINGS_WEAR_JOB
+ *
+ * @param counters Filled with the counters
+ */
+void nvs_settings_get_counters(struct smart_ring_settings_counters_t *counters);
+
+/**
+ * @brief
+ * Ask the persistence task to write the pending changes right away, the power
+ * is failing. Safe to call from an interrupt.
+ *
+ * Called by the CONFIG_SR_POWER_FAIL_GPIO interrupt when the board has a power
+ * fail signal.
+ *
+ */
+void nvs_settings_power_fail_from_isr(void);
+
+/**
+ * @brief
+ * Save the wifi credentials received during provision. The network is also
+ * added to the stored networks, with the highest priority
  *
  * ***
  *
- * ### Namespaces
+ * ### Settings fields
  *
 <table>
    <tr>
       <th>Variable</th>
-      <th>NVS Namespace</th>
+      <th>Settings field</th>
    </tr>
    <tr>
       <td style="text-align:center">SSID</td>
@@ -64,7 +287,96 @@ esp_err_t nvs_load_wifi_credentials(void);
 
 /**
  * @brief
- * Delete the Wifi credentials namespaces from the NVS
+ * Save the access point and the DHCP lease of the last connection. Nothing is
+ * written when they did not change.
+ *
+ * @param network Connection to save, valid is set to 0 to forget it
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK Connection saved
+ */
+esp_err_t nvs_save_wifi_network(const struct smart_ring_settings_network_t *network);
+
+/**
+ * @brief
+ * Load the access point and the DHCP lease of the last connection
+ *
+ * @param network Filled with the connection
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK Connection loaded
+ * @retval ESP_ERR_NVS_NOT_FOUND No connection saved
+ */
+esp_err_t nvs_load_wifi_network(struct smart_ring_settings_network_t *network);
+
+/**
+ * @brief
+ * Get the networks stored for the failover
+ *
+ * @param networks Filled with NVS_WIFI_MAX_NETWORKS entries, the unused ones
+ * have an empty SSID
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK At least one network stored
+ * @retval ESP_ERR_NVS_NOT_FOUND No network stored
+ */
+esp_err_t nvs_load_wifi_networks(struct smart_ring_settings_wifi_network_t *networks);
+
+/**
+ * @brief
+ * Use another of the stored networks, it becomes the network loaded by
+ * nvs_load_wifi_credentials
+ *
+ * @param ssid SSID of the stored network
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK Network selected
+ * @retval ESP_ERR_NVS_NOT_FOUND The network is not stored
+ */
+esp_err_t nvs_select_wifi_network(const char *ssid);
+
+/**
+ * @brief
+ * Count a connection to a stored network, or the network being given up for
+ * another one. The counts rank the networks on failover, they're only written
+ * right away when the ranking changes.
+ *
+ * @param ssid SSID of the stored network
+ * @param success Connected to the network
+ */
+void nvs_save_wifi_network_result(const char *ssid, bool success);
+
+/**
+ * @brief
+ * Save the scheduler rule of a job, replacing the one with the same name.
+ * Nothing is written when it did not change.
+ *
+ * @param job Rule and name of the job
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK Rule saved
+ * @retval ESP_ERR_NO_MEM NVS_SCHEDULE_MAX_JOBS rules already stored
+ */
+esp_err_t nvs_save_schedule_job(const struct smart_ring_settings_job_t *job);
+
+/**
+ * @brief
+ * Load the scheduler rule saved for a job
+ *
+ * @param name Name of the job
+ * @param job Filled with the rule
+ *
+ * @return esp_err_t - Result of the operations on storage
+ * @retval ESP_OK Rule loaded
+ * @retval ESP_ERR_NVS_NOT_FOUND No rule saved for the job
+ */
+esp_err_t nvs_load_schedule_job(const char *name, struct smart_ring_settings_job_t *job);
+
+/**
+ * @brief
+ * Forget the Wifi network in use and the last connection, so the device is
+ * provisioned again. The stored networks are kept, the provisioned network is
+ * added to them for the failover.
  *
  * @return esp_err_t - Result of the operations on storage
  * @retval ESP_OK Credentials saved successfully
@@ -78,12 +390,12 @@ esp_err_t nvs_clear_wifi_credentials();
  *
  * ***
  *
- * ### Namespaces
+ * ### Settings fields
  *
 <table>
    <tr>
       <th>Variable</th>
-      <th>NVS Namespace</th>
+      <th>Settings field</th>
    </tr>
    <tr>
       <td style="text-align:center">No deposit</td>
@@ -131,12 +443,12 @@ esp_err_t nvs_load_calibration(void);
  *
  * ***
  *
- * ### Namespaces
+ * ### Settings fields
  *
 <table>
    <tr>
       <th>Variable</th>
-      <th>NVS Namespace</th>
+      <th>Settings field</th>
    </tr>
    <tr>
       <td style="text-align:center">Order mode</td>
@@ -179,12 +491,12 @@ esp_err_t nvs_save_connection_type(char connection_type);
  *
  * ***
  *
- * ### Namespaces
+ * ### Settings fields
  *
 <table>
    <tr>
       <th>Variable</th>
-      <th>NVS Namespace</th>
+      <th>Settings field</th>
    </tr>
    <tr>
       <td style="text-align:center">Connection type</td>
@@ -0,0 +1,111 @@
+/**
+ * @file scheduler.h
+ * @brief Periodic jobs scheduler header
+ * @version 2.1.2
+ * @date 2024-04-09
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef __SCHEDULER_H_
+#define __SCHEDULER_H_
+
+// Scheduler task
+/// Thread stack size, the jobs run on it
+#define SCHEDULER_TASK_STACK_SIZE 4096
+/// Task priority, with the MQTT thread
+#define SCHEDULER_TASK_PRIORITY   2
+/// The task runs on the Core 0, with the network
+#define SCHEDULER_TASK_CORE_ID    0
+/// Jobs that can be registered
+#define SCHEDULER_MAX_JOBS        8
+/// Longest wait of the task, bounding the drift between the wall clock and
+/// the monotonic clock (ms)
+#define SCHEDULER_MAX_WAIT_MS     3600000
+/// Wall clock before which the time is not set yet (2024-01-01 UTC)
+#define SCHEDULER_TIME_SET_AFTER  1704067200
+
+// Rules
+/// Bit of an hour of the day in scheduler_rule_t.hours
+#define SCHEDULER_HOUR(hour)      (1UL << (hour))
+/// Every hour of the day
+#define SCHEDULER_EVERY_HOUR      0x00FFFFFFUL
+/// Every day of the week, bit 0 is Sunday
+#define SCHEDULER_EVERY_DAY       0x7F
+
+/**
+ * @brief
+ * Function run when a job is due, on the scheduler task
+ *
+ */
+typedef void (*scheduler_callback_t)(void *arg);
+
+/**
+ * @brief
+ * When a job runs. Wall clock rules run at the given minute of the given hours
+ * in the local timezone, and only once the time is set by SNTP. Monotonic rules
+ * run every period from the moment they're set
+ *
+ */
+typedef struct scheduler_rule_t {
+  /// Runs every period_s instead of at wall clock times
+  bool monotonic;
+  /// Minute of the hours it runs at (wall clock)
+  uint8_t minute;
+  /// Days of the week it runs on, bit 0 for Sunday (wall clock)
+  uint8_t weekdays;
+  /// Hours of the day it runs at, SCHEDULER_HOUR() bits (wall clock)
+  uint32_t hours;
+  /// Period (s), 0 to disable the job (monotonic)
+  uint32_t period_s;
+} scheduler_rule_t;
+
+/**
+ * @brief
+ * Start the scheduler task. Must be called after nvs_settings_init, the rules
+ * received from the backend are kept in the settings
+ *
+ */
+void scheduler_init(void);
+
+/**
+ * @brief
+ * Register a job. The rule received from the backend for the same name, if
+ * any, replaces the default one
+ *
+ * @param name Name of the job, used by the backend to change its rule
+ * @param rule Default rule
+ * @param callback Function run when the job is due
+ * @param arg Argument of the callback
+ *
+ * @return esp_err_t
+ * @retval ESP_OK Job registered
+ * @retval ESP_ERR_NO_MEM SCHEDULER_MAX_JOBS already registered
+ */
+esp_err_t scheduler_add(const char *name, const struct scheduler_rule_t *rule,
+                        scheduler_callback_t callback, void *arg);
+
+/**
+ * @brief
+ * Change the rule of a job
+ *
+ * @param name Name of the job
+ * @param rule New rule
+ * @param persist Keep the rule in the settings, for the next boots
+ *
+ * @return esp_err_t
+ * @retval ESP_OK Rule changed, or saved for a job registered later
+ * @retval ESP_ERR_NOT_FOUND No such job and the rule isn't persisted
+ */
+esp_err_t scheduler_set_rule(const char *name, const struct scheduler_rule_t *rule,
+                             bool persist);
+
+/**
+ * @brief
+ * Compute the wall clock jobs again after the time was set or changed
+ *
+ */
+void scheduler_time_changed(void);
+
+#endif
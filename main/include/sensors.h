@@ -59,6 +59,9 @@
 /// STABILIZED_INTERVAL
 #define STABILIZED_INTERVAL 15
 
+/// Scheduler job sending the consumption percentage
+#define SENSORS_PERCENTUAL_JOB "perc"
+
 /**
  * @brief
  * Thread resposible for controlling the reading of the sensors
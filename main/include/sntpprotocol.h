@@ -11,11 +11,10 @@
  *
  */
 
-#define TIME_PERC_INTERVAL  2000 // Time interval to check SNTP Time 
-
 /**
  * @brief
- * Function responsible to initialize SNTP Protocol
+ * Function responsible to initialize SNTP Protocol. Only the first call starts
+ * it, called when the station gets an IP address
  */
 void initialize_sntp();
 
@@ -33,26 +32,9 @@ void set_timezone();
 
 /**
  * @brief
- * Alert function to confirm SNTP Sync
+ * Alert function to confirm SNTP Sync, the scheduler computes the wall clock
+ * jobs again
  *
  * @param tv
  */
 void time_sync_notification_cb(struct timeval *tv);
-
-/**
- * @brief
- * Function to verify scheduled time to send Percentage Consumption
- *
- * @param controller
- * @return true OR false
- */
-bool isTimePerc(struct smart_ring_controller_t *controller);
-
-/**
- * @brief
- * Function to verify scheduled time to send Version Check
- *
- * @param controller
- * @return true OR false
- */
-bool versionCheck(struct smart_ring_controller_t *controller);
\ No newline at end of file
@@ -2,8 +2,9 @@
  * @file spiffs.h
  * @author Ayinde Olayiwola @ Quantum Leap (olay@quleap.com)
  * @brief
- * This file contains the functions responsible for the initialization and
- * update of the SPIFFs storage portion of the device
+ * This file contains the functions responsible for mounting the SPIFFs
+ * storage partition once, replacing its files atomically and caching the
+ * files read often
  *
  *
  * @version -
@@ -33,10 +34,73 @@
 #include "esp_log.h"
 
 
+// Storage partition
+/// Mount point of the storage partition
+#define SPIFFS_BASE_PATH "/mqtt"
+/// Label of the storage partition in partitions.csv
+#define SPIFFS_PARTITION_LABEL "storage"
+/// Files open at the same time on the partition
+#define SPIFFS_MAX_FILES 5
+/// Longest file name, bounded by CONFIG_SPIFFS_OBJ_NAME_LEN with the suffix
+#define SPIFFS_NAME_MAX_LEN 24
+/// Suffix of the file being written, dropped if a reset interrupts it
+#define SPIFFS_TMP_SUFFIX ".tmp"
+/// Suffix of the file completely written, about to replace the original one
+#define SPIFFS_NEW_SUFFIX ".new"
+
+// File cache
+/// Files whose content is kept in RAM after the first read
+#define SPIFFS_CACHE_ENTRIES 2
+/// File of the MQTT private key
+#define SPIFFS_KEY_FILE "key.txt"
+
+
 typedef struct spiffs_t {
-       void (*saveMQTTCertificatePrivateKey) (char *key);
-       void (*loadMQTTCertificatePrivateKey)(char*);
+       esp_err_t (*init)(void);
+       esp_err_t (*saveMQTTCertificatePrivateKey)(const char *key);
+       esp_err_t (*loadMQTTCertificatePrivateKey)(char *key, size_t size);
 }spiffs_t;
 
 extern spiffs_t spiffs;
-#endif
\ No newline at end of file
+
+
+/**
+ * @brief
+ * Mount the storage partition, once for the whole run, and finish a write
+ * interrupted by a reset
+ *
+ * @return esp_err_t ESP_OK when the partition is mounted
+ *
+ */
+esp_err_t spiffs_init(void);
+
+/**
+ * @brief
+ * Replace the content of a file. The data is written to a temporary file
+ * first, which is renamed once complete, so a reset never leaves a truncated
+ * file behind
+ *
+ * @param name Name of the file, without the mount point
+ * @param data Content of the file
+ * @param length Length of the content
+ * @return esp_err_t ESP_OK when the file is written
+ *
+ */
+esp_err_t spiffs_write_file(const char *name, const void *data, size_t length);
+
+/**
+ * @brief
+ * Read a file into a buffer, from the RAM cache when it was read before. The
+ * content is terminated by a null character
+ *
+ * @param name Name of the file, without the mount point
+ * @param buffer Destination of the content
+ * @param size Size of the buffer
+ * @param length Length of the content, may be NULL
+ * @return esp_err_t ESP_ERR_NOT_FOUND when the file does not exist,
+ * ESP_ERR_INVALID_SIZE when it does not fit in the buffer
+ *
+ */
+esp_err_t spiffs_read_file(const char *name, char *buffer, size_t size, size_t *length);
+
+#endif
@@ -23,8 +23,10 @@
 // Firmware version to be used on the UI, version check and Back-Office
 #define FIRMWARE_VERSION          "3.2.3"
 
-// Refresh rate for the display interface
-#define LV_TICK_PERIOD_MS         1
+// UI task
+/// Longest sleep of the UI task between two runs of lv_task_handler (ms), the
+/// events posted by the other tasks wake it
+#define UI_TASK_MAX_SLEEP_MS      1000
 
 // Wifi related settings
 // Provision AP network name
@@ -47,8 +49,20 @@
 #define WIFI_AP_NETMASK           "255.255.255.0"
 /// Provision AP network bandwidtch
 #define WIFI_AP_BANDWIDTH         WIFI_BW_HT20
-/// Provision AP network power save mode
+/// Station power save mode while connected and idle
+#if defined(CONFIG_SR_WIFI_POWER_SAVE_MAX)
+#define WIFI_STA_POWER_SAVE       WIFI_PS_MAX_MODEM
+#elif defined(CONFIG_SR_WIFI_POWER_SAVE_MIN)
+#define WIFI_STA_POWER_SAVE       WIFI_PS_MIN_MODEM
+#else
 #define WIFI_STA_POWER_SAVE       WIFI_PS_NONE
+#endif
+/// Beacons the station sleeps through in WIFI_PS_MAX_MODEM
+#ifdef CONFIG_SR_WIFI_LISTEN_INTERVAL
+#define WIFI_STA_LISTEN_INTERVAL  CONFIG_SR_WIFI_LISTEN_INTERVAL
+#else
+#define WIFI_STA_LISTEN_INTERVAL  3
+#endif
 
 /**
  * @brief
@@ -175,21 +189,9 @@ typedef struct smart_ring_flags_t {
    */
   int start_mqtt : 1;
 
-  /**
-   * @brief
-   * Flag the message of percentage to be sent
-   *
-   */
-  bool sent_perc_message : true; 
-
-  /**
-   * @brief
-   * Flag the message of version check
-   *
-   */
-  bool sent_version_check_message : true; 
-
   /// Every flag below this one can be used before increasing the variable size
+  int flag_6 : 1;
+  int flag_7 : 1;
   int flag_8 : 1;
   int flag_9 : 1;
   int flag_10 : 1;
@@ -19,10 +19,160 @@
 #ifndef __WIFI_H_
 #define __WIFI_h_
 
+// Connectivity manager task
+/// Thread stack size
+#define WIFI_APP_TASK_STACK_SIZE 4096
+/// Task priority, above the MQTT thread
+#define WIFI_APP_TASK_PRIORITY   5
+/// The task runs on the Core 0, with the WiFi driver
+#define WIFI_APP_TASK_CORE_ID    0
+/// Events waiting for the connectivity manager
+#define WIFI_APP_QUEUE_LENGTH    8
+
+// Reconnection backoff
+/// Delay before the first reconnection attempt (ms)
+#define WIFI_RECONNECT_MIN_MS    1000
+/// Longest delay between reconnection attempts (ms)
+#define WIFI_RECONNECT_MAX_MS    60000
+/// Failed attempts after which the boot screen stops waiting for the network
+#define WIFI_BOOT_RETRIES        2
+/// Time the boot screen shows the connection warning before the main screen (ms)
+#define WIFI_BOOT_WARNING_MS     3000
+/// Time the main screen shows before the no connection modal (ms)
+#define WIFI_NO_CONNECTION_MS    500
+
+// Failover between the stored networks
+/// Failed attempts on a network before the other stored networks are ranked
+#define WIFI_FAILOVER_ATTEMPTS         3
+/// Interval of the link quality samples while connected (ms)
+#define WIFI_LINK_CHECK_INTERVAL_MS    10000
+/// Average signal under which the link is weak (dBm)
+#define WIFI_FAILOVER_RSSI_DBM         -80
+/// Consecutive weak averages before the other stored networks are ranked
+#define WIFI_FAILOVER_WEAK_CHECKS      6
+/// Score another network needs above a connected one to replace it (dB)
+#define WIFI_FAILOVER_HYSTERESIS_DB    10
+/// Score lost for every stored network with a higher priority (dB)
+#define WIFI_FAILOVER_PRIORITY_DB      5
+/// Score of a network whose connections always worked (dB)
+#define WIFI_FAILOVER_HISTORY_DB       10
+/// Access points read from a failover scan
+#define WIFI_FAILOVER_SCAN_MAX_RECORDS 20
+
+// Power save
+/// Time the radio stays at full power after the last touch (ms)
+#define WIFI_POWER_TOUCH_HOLD_MS 10000
+/// Reasons to keep the radio at full power, wifi_power_hold()
+#define WIFI_POWER_HOLD_TOUCH    BIT0
+#define WIFI_POWER_HOLD_OTA      BIT1
+
+// Wifi event group
+/// The station is connected and has an IP address
+#define WIFI_CONNECTED_BIT    BIT0
+/// The station is not connected
+#define WIFI_DISCONNECTED_BIT BIT1
+/// The access point is up to provision the device
+#define WIFI_PROVISIONING_BIT BIT2
+
+/**
+ * @brief
+ * States of the connectivity manager
+ *
+ */
+typedef enum wifi_app_state_t {
+  WIFI_STATE_STOPPED,
+  WIFI_STATE_PROVISIONING,
+  WIFI_STATE_CONNECTING,
+  WIFI_STATE_CONNECTED,
+  WIFI_STATE_BACKOFF
+} wifi_app_state_t;
+
+/**
+ * @brief
+ * Messages handled by the connectivity manager
+ *
+ */
+typedef enum wifi_app_message_t {
+  WIFI_APP_MSG_CONNECT,
+  WIFI_APP_MSG_AP_START,
+  WIFI_APP_MSG_AP_STOP,
+  WIFI_APP_MSG_STA_DISCONNECTED,
+  WIFI_APP_MSG_STA_GOT_IP,
+  WIFI_APP_MSG_POWER_UPDATE
+} wifi_app_message_t;
+
+/**
+ * @brief
+ * Message queued to the connectivity manager
+ *
+ */
+typedef struct wifi_app_queue_message_t {
+  wifi_app_message_t id;
+  uint8_t reason;
+} wifi_app_queue_message_t;
+
+/**
+ * @brief
+ * Create the wifi event group, before any task waits on it
+ *
+ */
+void wifi_events_init(void);
+
+/**
+ * @brief
+ * Wait for the station to be connected with an IP address
+ *
+ * @param ticks Longest time to wait
+ * @return true when connected
+ */
+bool wifi_wait_connected(TickType_t ticks);
+
+/**
+ * @brief
+ * Event group publishing the WIFI_*_BIT of the connection, for the consumers
+ * blocking on other bits
+ *
+ * @retval Event group handle
+ */
+EventGroupHandle_t wifi_get_event_group(void);
+
+/**
+ * @brief
+ * Current state of the connectivity manager
+ *
+ * @retval State
+ */
+wifi_app_state_t wifi_get_state(void);
+
+/**
+ * @brief
+ * Keep the radio at full power until wifi_power_release() is called with the
+ * same reason. The modem sleep is only used while there is no hold
+ *
+ * @param reason WIFI_POWER_HOLD_* bits
+ */
+void wifi_power_hold(uint32_t reason);
+
+/**
+ * @brief
+ * Release a hold taken with wifi_power_hold()
+ *
+ * @param reason WIFI_POWER_HOLD_* bits
+ */
+void wifi_power_release(uint32_t reason);
+
+/**
+ * @brief
+ * Signal a user interaction, keeping the radio at full power for
+ * WIFI_POWER_TOUCH_HOLD_MS after the last one
+ *
+ */
+void wifi_power_activity(void);
+
 /**
  * @brief
  * Initialize the wifi interface and thread for the wireless
- * communication
+ * communication. Only the first call starts the interface
  *
  * @param  *connection_controller: Connection object
  */
@@ -39,9 +189,10 @@ wifi_ap_init(struct smart_ring_connection_controller_t *connection_controller);
 
 /**
  * @brief
- * Get the wifi rssi level
+ * Get the wifi rssi level, adding it to the link quality window and updating
+ * the signal icon
  *
- * @retval rssi RSSI level of the device
+ * @retval rssi RSSI level of the device, INT8_MIN when not connected
  */
 int8_t wifi_get_rssi();
 
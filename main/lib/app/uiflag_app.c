@@ -17,318 +17,208 @@
 #include "sntp.h"
 #include "libs.h"
 
-void uiflag_startLogin(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-void uiflag_selectCommunication(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-void uiflag_startCommunication(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-void uiflag_signIn(struct smart_ring_controller_t*);
-void uiflag_changePin(struct smart_ring_controller_t *);
-void uiflag_sendTicket(struct smart_ring_controller_t*);
-void uiflag_changeStock(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-void uiflag_popupPendingOrders (struct smart_ring_controller_t*);
-void uiflag_changeOrderMode(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-void uiflag_manageOrders(struct smart_ring_controller_t*);
-void uiflag_resetDevice(struct smart_ring_controller_t*);
-void uiflag_resetWifi(struct smart_ring_controller_t*);
-void uiflag_updateFirmware(struct smart_ring_controller_t *);
-void uiflag_updateFirmwareFailed(struct smart_ring_controller_t*);
-void uiflag_updateFirmwareComplete(struct smart_ring_controller_t*);
-void uiflag_startOrder(struct smart_ring_controller_t*);
-void uiflag_startCalibration(struct smart_ring_controller_t*);
-void uiflag_emptyCalibration(struct smart_ring_controller_t*);
-void uiflag_cancelCalibration(struct smart_ring_controller_t*);
-void uiflag_confirmOrder(struct smart_ring_controller_t*); 
-
-
 static const char *TAG = "MAIN";
 
- ui_flag_t uiflag = {
-           .startLogin             =  uiflag_startLogin,
-           .selectCommunication    =  uiflag_selectCommunication,
-           .startCommunication     =  uiflag_startCommunication,
-           .signIn                 =  uiflag_signIn,
-           .sendTicket             =  uiflag_sendTicket,
-           .changeStock            =  uiflag_changeStock,
-           .popupPendingOrders     =  uiflag_popupPendingOrders,
-           .changeOrderMode        =  uiflag_changeOrderMode,
-           .manageOrders           =  uiflag_manageOrders,
-           .resetDevice            =  uiflag_resetDevice,
-           .resetWifi              =  uiflag_resetWifi,
-           .changePin              =  uiflag_changePin,
-           .updateFirmware         =  uiflag_updateFirmware,
-           .updateFirmwareFailed   =  uiflag_updateFirmwareFailed,
-           .updateFirmwareComplete =  uiflag_updateFirmwareComplete,
-           .startOrder             =  uiflag_startOrder,
-           .startCalibration       =  uiflag_startCalibration,
-           .emptyCalibration       =  uiflag_emptyCalibration,
-           .cancelCalibration      =  uiflag_cancelCalibration,
-           .confirmOrder           =  uiflag_confirmOrder,
-
- };
-
- 
-void uiflag_startLogin(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
-     if (uiController->flags.flag.start_login) {
-         if (controller->connection.is_connected)  {
-             smart_ring_ui_get_controller()->flags.flag.update_pin  = false;
-             smart_ring_ui_update_state(STATE_7);
-         }
-         else  
-             smart_ring_ui_update_state(STATE_6);
-         uiController->flags.flag.start_login = false;
-     }
-}
-
 
-void uiflag_selectCommunication(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
-     if (uiController->flags.flag.select_communication) {
-         controller->connection.type = uiController->connection_type;
-         nvs_save_connection_type(controller->connection.type);
-         smart_ring_ui_update_state(STATE_2);
-         uiController->flags.flag.select_communication = false;
+static void uiflag_startLogin(struct smart_ring_controller_t *controller) {
+     if (controller->connection.is_connected)  {
+         smart_ring_ui_get_controller()->flags.update_pin  = false;
+         smart_ring_ui_update_state(STATE_7);
      }
+     else  
+         smart_ring_ui_update_state(STATE_6);
 }
 
 
-void uiflag_startCommunication(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
-     if (uiController->flags.flag.start_communication) {
-
-         // Initiate the Communication interface
-         switch (controller->connection.type) {
-              case 'w':
-                        if (!controller->connection.is_provisioned) smart_ring_ui_update_state(STATE_3);
-                        else smart_ring_ui_update_state(STATE_4);
-                        wifi_interface_start(&(controller->connection));
-                        break;
-              case 'g':
-                        break;
-              case 'l':
-                        break;
-              default:
-                        ESP_LOGE(TAG, "No communication type selected");
-                        break;
-         }
-         uiController->flags.flag.start_communication = false;
-      }
+static void uiflag_selectCommunication(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
+     controller->connection.type = uiController->connection_type;
+     nvs_save_connection_type(controller->connection.type);
+     smart_ring_ui_update_state(STATE_2);
 }
 
 
-void uiflag_signIn(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.sign_in) {
-         mqtt_send_message(SEND_LOGIN);
-         controller->ui_controller->flags.flag.sign_in = false;
+static void uiflag_startCommunication(struct smart_ring_controller_t *controller) {
+     // Initiate the Communication interface
+     switch (controller->connection.type) {
+          case 'w':
+                    if (!controller->connection.is_provisioned) smart_ring_ui_update_state(STATE_3);
+                    else {
+                         smart_ring_ui_update_state(STATE_4);
+                         // The interface starts early in the boot, so the
+                         // configuration may already be received
+                         if (boot_wait(BOOT_CONFIG_RECEIVED_BIT, 0)) smart_ring_ui_update_state(STATE_5);
+                    }
+                    wifi_interface_start(&(controller->connection));
+                    break;
+          case 'g':
+                    break;
+          case 'l':
+                    break;
+          default:
+                    ESP_LOGE(TAG, "No communication type selected");
+                    break;
      }
 }
 
 
-void uiflag_changePin(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.pin_changed) {
-         mqtt_send_message(SEND_CHANGE_PIN);
-         controller->ui_controller->flags.flag.pin_changed = false;
-     }
-}
-
+static void uiflag_sendTicket(struct smart_ring_controller_t *controller) {
+     int err = mqtt_send_message(SEND_TICKET);
 
-void uiflag_sendTicket(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.send_ticket) {
-         int err = mqtt_send_message(SEND_TICKET);
-
-        if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
-            ESP_LOGE(TAG, "Error sending support message");
-            modal_complete_progress(controller->ui_controller, false, "Error sending request");
-
-            controller->ui_controller->timer_type = CLOSE_MODAL;
-            esp_timer_start_once(controller->ui_controller->timer, 1000000 * 3);
-        } 
-        else
-            smart_ring_ui_update_state(STATE_17);
-
-        controller->ui_controller->flags.flag.send_ticket = false;
-      }
+     if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
+         ESP_LOGE(TAG, "Error sending support message");
+         smart_ring_ui_request_failed("Error sending request");
+     } 
+     else
+         smart_ring_ui_update_state(STATE_17);
 }
 
 
-void uiflag_changeStock(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
-     if (controller->ui_controller->flags.flag.change_stock) {
-         int err = mqtt_send_message(SEND_STOCK);
-
-         if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
-             ESP_LOGE(TAG, "Error sending stock message");
-             modal_complete_progress(controller->ui_controller, false, "Error sending request");
+static void uiflag_changeStock(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
+     int err = mqtt_send_message(SEND_STOCK);
 
-             controller->ui_controller->timer_type = CLOSE_MODAL;
-             esp_timer_start_once(controller->ui_controller->timer, 1000000 * 3);
-         } 
-         else {
-             smart_ring_set_stock(uiController->updated_stock);
-             smart_ring_ui_update_state(STATE_14);
-         }
-         controller->ui_controller->flags.flag.change_stock = false;
+     if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
+         ESP_LOGE(TAG, "Error sending stock message");
+         smart_ring_ui_request_failed("Error sending request");
+     } 
+     else {
+         smart_ring_set_stock(uiController->updated_stock);
+         smart_ring_ui_update_state(STATE_14);
      }
 }
 
 
-void uiflag_popupPendingOrders (struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.order_popup_message) {
+static void uiflag_popupPendingOrders(struct smart_ring_controller_t *controller) {
 #ifndef NDEBUG
-         ESP_LOGI(TAG, "Sending request to get pending order(s)");
+     ESP_LOGI(TAG, "Sending request to get pending order(s)");
 #endif
-         int err = mqtt_send_message(SEND_GET_ORDERS);
+     int err = mqtt_send_message(SEND_GET_ORDERS);
 
-         if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
+     if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
 #ifndef NDEBUG
-             ESP_LOGE(TAG, "Error Sending request to get pending order(s)");
+         ESP_LOGE(TAG, "Error Sending request to get pending order(s)");
 #endif
-             smart_ring_ui_update_state(STATE_46);
-         }
-
-         controller->ui_controller->flags.flag.order_popup_message = false;
+         smart_ring_ui_update_state(STATE_46);
      }
 }
 
 
-void uiflag_changeOrderMode(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
-     if (controller->ui_controller->flags.flag.change_order_mode) {
-         int err = mqtt_send_message(SEND_ORDER_MODE);
-
-         if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
-             ESP_LOGE(TAG, "Error sending stock message");
-             modal_complete_progress(controller->ui_controller, false, "Error communicating");
+static void uiflag_changeOrderMode(struct smart_ring_controller_t *controller, struct smart_ring_ui_controller_t *uiController) {
+     int err = mqtt_send_message(SEND_ORDER_MODE);
 
-             controller->ui_controller->timer_type = CLOSE_MODAL;
-             esp_timer_start_once(controller->ui_controller->timer, 1000000 * 3);
-         } 
-         else {
-             smart_ring_set_order_mode(uiController->updated_order_mode);
-             smart_ring_ui_update_state(STATE_21);
-         }
-         controller->ui_controller->flags.flag.change_order_mode = false;
+     if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
+         ESP_LOGE(TAG, "Error sending stock message");
+         smart_ring_ui_request_failed("Error communicating");
+     } 
+     else {
+         smart_ring_set_order_mode(uiController->updated_order_mode);
+         smart_ring_ui_update_state(STATE_21);
      }
 }
 
 
-void uiflag_manageOrders(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.manage_orders) {
-         esp_timer_stop(controller->ui_controller->standby_timer);
+static void uiflag_manageOrders(struct smart_ring_controller_t *controller) {
+     esp_timer_stop(controller->ui_controller->standby_timer);
 
-         int err = mqtt_send_message(SEND_GET_ORDERS);
+     int err = mqtt_send_message(SEND_GET_ORDERS);
 
-         if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
-             ESP_LOGE(TAG, "Error sending request orders message");
-             smart_ring_ui_update_state(STATE_19);
-             esp_timer_stop(controller->ui_controller->timer);
-         }
-         controller->ui_controller->flags.flag.manage_orders = false;
+     if (SUCCESS != err && MQTT_REQUEST_TIMEOUT_ERROR != err) {
+         ESP_LOGE(TAG, "Error sending request orders message");
+         smart_ring_ui_update_state(STATE_19);
+         esp_timer_stop(controller->ui_controller->timer);
      }
 }
 
 
-void uiflag_resetDevice(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.reset_device) {
-         esp_restart();
-         controller->ui_controller->flags.flag.reset_device = false;
-     }
+static void uiflag_resetWifi(struct smart_ring_controller_t *controller) {
+     esp_err_t err = nvs_clear_wifi_credentials();
+     if (ESP_OK == err) smart_ring_ui_update_state(STATE_40);
+     else smart_ring_ui_update_state(STATE_41);
 }
 
 
-void uiflag_resetWifi(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.reset_wifi) {
-         esp_err_t err = nvs_clear_wifi_credentials();
-         if (ESP_OK == err) smart_ring_ui_update_state(STATE_40);
-         else smart_ring_ui_update_state(STATE_41);
-         controller->ui_controller->flags.flag.reset_wifi = false;
-     }
-}
+static void uiflag_updateFirmware(struct smart_ring_controller_t *controller) {
+     controller->connection.mqtt_controller.auto_reconnect = false;
+     aws_iot_mqtt_autoreconnect_set_status(&controller->connection.mqtt_controller.client, false);
+     aws_iot_mqtt_disconnect(&controller->connection.mqtt_controller.client);
+     vTaskDelay(500 / portTICK_PERIOD_MS);
+     smart_ring_http_client_get_update_firmware();
 
-
-void uiflag_updateFirmware(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.update_firmware) {
-         controller->connection.mqtt_controller.auto_reconnect = false;
-         aws_iot_mqtt_autoreconnect_set_status(&controller->connection.mqtt_controller.client, false);
-         aws_iot_mqtt_disconnect(&controller->connection.mqtt_controller.client);
-         vTaskDelay(500 / portTICK_PERIOD_MS);
-         smart_ring_http_client_get_update_firmware();
-        
-         controller->ui_controller->flags.flag.update_firmware = false;
-     }
+     // The download runs on this task, it's over once it returns. An update
+     // that didn't start sets no flag, it failed too
+     controller->connection.mqtt_controller.auto_reconnect = true;
+     aws_iot_mqtt_autoreconnect_set_status(&controller->connection.mqtt_controller.client, true);
+     smart_ring_ui_set_update_result(controller->flags.flag.update_complete);
+     controller->flags.flag.update_failed   = false;
+     controller->flags.flag.update_complete = false;
 }
 
 
-void uiflag_updateFirmwareFailed(struct smart_ring_controller_t *controller) {
-    if (controller->flags.flag.update_failed) {
-        controller->connection.mqtt_controller.auto_reconnect = true;
-        aws_iot_mqtt_autoreconnect_set_status(&controller->connection.mqtt_controller.client, true);
-        controller->ui_controller->flags.flag.cancel_update = true;
-        controller->flags.flag.update_failed                = false;
-    }
+static void uiflag_startOrder(struct smart_ring_controller_t *controller) {
+     smart_ring_ui_update_state(STATE_23);
+     mqtt_send_message(SEND_NEW_DELIVERY);
 }
 
 
-void uiflag_updateFirmwareComplete(struct smart_ring_controller_t *controller) {
-     if (controller->flags.flag.update_complete) {
-          controller->connection.mqtt_controller.auto_reconnect = true;
-          aws_iot_mqtt_autoreconnect_set_status(&controller->connection.mqtt_controller.client, true);
-          controller->ui_controller->flags.flag.success = true;
-          controller->flags.flag.update_complete        = false;
-     }
+static void uiflag_startCalibration(struct smart_ring_controller_t *controller) {
+     controller->sensor.calibration.timestamp   = esp_timer_get_time();
+     controller->sensor.calibration.calibrating = true;
+     controller->sensor.calibration.step        = 1;
 }
 
 
-void uiflag_startOrder(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.start_order) {
-         smart_ring_ui_update_state(STATE_23);
-         mqtt_send_message(SEND_NEW_DELIVERY);
-         controller->ui_controller->flags.flag.start_order = false;
-     }
+static void uiflag_emptyCalibration(struct smart_ring_controller_t *controller) {
+     controller->sensor.calibration.step        = 2;
+     controller->sensor.calibration.calibrating = true;
+     controller->sensor.calibration.timestamp   = esp_timer_get_time();
 }
 
 
-void uiflag_startCalibration(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.start_calibration) {
-         controller->sensor.calibration.timestamp                = esp_timer_get_time();
-         controller->ui_controller->flags.flag.start_calibration = false;
-         controller->sensor.calibration.calibrating              = true;
-         controller->sensor.calibration.step                     = 1;
-         controller->ui_controller->flags.flag.start_calibration = false;
-     }
+static void uiflag_cancelCalibration(struct smart_ring_controller_t *controller) {
+     controller->sensor.calibration.calibrating        = false;
+     controller->sensor.calibration.number_of_readings = 0;
+     controller->sensor.calibration.step               = 0;
+     controller->sensor.calibration.sum_of_readings    = 0;
+     controller->sensor.calibration.timestamp          = -1;
 }
 
 
-void uiflag_emptyCalibration(struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.empty_calibration) {
-         controller->sensor.calibration.step        = 2;
-         controller->sensor.calibration.calibrating = true;
-         controller->sensor.calibration.timestamp   = esp_timer_get_time();
-         controller->ui_controller->flags.flag.empty_calibration = false;
-     }
-}
+static void uiflag_confirmOrder(struct smart_ring_controller_t *controller) {
+     mqtt_send_message(SEND_CONFIRM_DELIVERY); 
+     int __timer = 0;
 
-
-void uiflag_cancelCalibration (struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.cancel_calibration) {
-         controller->sensor.calibration.calibrating               = false;
-         controller->sensor.calibration.number_of_readings        = 0;
-         controller->sensor.calibration.step                      = 0;
-         controller->sensor.calibration.sum_of_readings           = 0;
-         controller->sensor.calibration.timestamp                 = -1;
-         controller->ui_controller->flags.flag.cancel_calibration = false;
+     while(!controller->ui_controller->flags.order_confirmed_response) {
+        vTaskDelay(100 / portTICK_PERIOD_MS);
+        if(__timer++ > 5) break;
      }
+     mqtt_send_message(SEND_GET_ORDERS);
+     controller->ui_controller->flags.order_confirmed_response = false;
 }
 
 
-void uiflag_confirmOrder (struct smart_ring_controller_t *controller) {
-     if (controller->ui_controller->flags.flag.confirm_order) {
-          mqtt_send_message(SEND_CONFIRM_DELIVERY); 
-          int __timer = 0;
+void uiflag_handle_request(struct smart_ring_controller_t *controller, enum smart_ring_ui_request_t request) {
+     struct smart_ring_ui_controller_t *uiController = controller->ui_controller;
 
-          while(!controller->ui_controller->flags.flag.order_confirmed_response) {
-             vTaskDelay(100 / portTICK_PERIOD_MS);
-             if(__timer++ > 5) break;
-          }
-          mqtt_send_message(SEND_GET_ORDERS);
-          controller->ui_controller->flags.flag.order_confirmed_response = false;
-          controller->ui_controller->flags.flag.confirm_order            = false;
-    }
+     switch (request) {
+          case UI_REQUEST_START_LOGIN:          uiflag_startLogin(controller);                        break;
+          case UI_REQUEST_SELECT_COMMUNICATION: uiflag_selectCommunication(controller, uiController);  break;
+          case UI_REQUEST_START_COMMUNICATION:  uiflag_startCommunication(controller);                break;
+          case UI_REQUEST_SIGN_IN:              mqtt_send_message(SEND_LOGIN);                        break;
+          case UI_REQUEST_CHANGE_PIN:           mqtt_send_message(SEND_CHANGE_PIN);                   break;
+          case UI_REQUEST_SEND_TICKET:          uiflag_sendTicket(controller);                        break;
+          case UI_REQUEST_CHANGE_STOCK:         uiflag_changeStock(controller, uiController);         break;
+          case UI_REQUEST_PENDING_ORDERS:       uiflag_popupPendingOrders(controller);                break;
+          case UI_REQUEST_CHANGE_ORDER_MODE:    uiflag_changeOrderMode(controller, uiController);     break;
+          case UI_REQUEST_MANAGE_ORDERS:        uiflag_manageOrders(controller);                      break;
+          case UI_REQUEST_RESET_DEVICE:         esp_restart();                                        break;
+          case UI_REQUEST_RESET_WIFI:           uiflag_resetWifi(controller);                         break;
+          case UI_REQUEST_UPDATE_FIRMWARE:      uiflag_updateFirmware(controller);                    break;
+          case UI_REQUEST_START_ORDER:          uiflag_startOrder(controller);                        break;
+          case UI_REQUEST_START_CALIBRATION:    uiflag_startCalibration(controller);                  break;
+          case UI_REQUEST_EMPTY_CALIBRATION:    uiflag_emptyCalibration(controller);                  break;
+          case UI_REQUEST_CANCEL_CALIBRATION:   uiflag_cancelCalibration(controller);                 break;
+          case UI_REQUEST_CONFIRM_ORDER:        uiflag_confirmOrder(controller);                      break;
+          default:
+                    ESP_LOGE(TAG, "Unknown UI request %d", request);
+                    break;
+     }
 }
-
-
-
@@ -33,31 +33,15 @@
 
 #define UI_FLAG_CODE_NOT_USED  1
 
-typedef struct ui_flag_t {
-        void (*startLogin)(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-        void (*selectCommunication)(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-        void (*startCommunication)(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-        void (*signIn)(struct smart_ring_controller_t*);
-        void (*sendTicket)(struct smart_ring_controller_t*);
-        void (*changeStock)(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-        void (*popupPendingOrders)(struct smart_ring_controller_t*);
-        void (*changeOrderMode)(struct smart_ring_controller_t*, struct smart_ring_ui_controller_t*);
-        void (*manageOrders)(struct smart_ring_controller_t*);
-        void (*resetDevice)(struct smart_ring_controller_t*);
-        void (*resetWifi)(struct smart_ring_controller_t*);
-        void (*changePin)(struct smart_ring_controller_t*);
-        void (*updateFirmware)(struct smart_ring_controller_t*);
-        void (*updateFirmwareFailed)(struct smart_ring_controller_t *);
-        void (*updateFirmwareComplete)(struct smart_ring_controller_t*);
-        void (*startOrder)(struct smart_ring_controller_t*);
-        void (*startCalibration)(struct smart_ring_controller_t*); 
-        void (*emptyCalibration)(struct smart_ring_controller_t*);
-        void (*cancelCalibration)(struct smart_ring_controller_t*);
-        void (*confirmOrder)(struct smart_ring_controller_t*); 
-}ui_flag_t;
-
-
-extern ui_flag_t uiflag;
+/**
+ * @brief
+ * Handle a request of the UI, on the main task. The requests are received in
+ * the order the UI sent them
+ *
+ * @param controller Smart ring controller
+ * @param request Request received with smart_ring_ui_receive_request
+ */
+void uiflag_handle_request(struct smart_ring_controller_t *controller, enum smart_ring_ui_request_t request);
 
 
 #endif
\ No newline at end of file
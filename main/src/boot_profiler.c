@@ -0,0 +1,91 @@
+/**
+ * @file boot_profiler.c
+ * @brief
+ * This file contains the boot timeline, recording when each phase of the boot
+ * ends and in which task, and the event group used by the boot steps to wait
+ * for the ones they depend on instead of fixed delays
+ *
+ *
+ * @version 2.1.2
+ * @date 2023-05-03
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "libs.h"
+
+#include "esp_timer.h"
+
+static const char *TAG = "BOOT";
+
+/**
+ * @brief
+ * End of a boot phase
+ *
+ */
+struct boot_profiler_phase_t {
+  const char *name;
+  char task[configMAX_TASK_NAME_LEN];
+  int64_t time_us;
+};
+
+static struct boot_profiler_phase_t boot_phases[BOOT_PROFILER_MAX_PHASES];
+static unsigned int boot_phases_count = 0;
+static portMUX_TYPE boot_profiler_lock = portMUX_INITIALIZER_UNLOCKED;
+static EventGroupHandle_t boot_event_group = NULL;
+
+void boot_profiler_init(void) {
+  if (boot_event_group == NULL)
+    boot_event_group = xEventGroupCreate();
+
+  boot_profiler_mark("app_main");
+}
+
+void boot_profiler_mark(const char *phase) {
+  int64_t now = esp_timer_get_time();
+  const char *task = pcTaskGetTaskName(NULL);
+
+  portENTER_CRITICAL(&boot_profiler_lock);
+  if (boot_phases_count < BOOT_PROFILER_MAX_PHASES) {
+    struct boot_profiler_phase_t *entry = &boot_phases[boot_phases_count++];
+    entry->name = phase;
+    entry->time_us = now;
+    strlcpy(entry->task, task, sizeof(entry->task));
+  }
+  portEXIT_CRITICAL(&boot_profiler_lock);
+}
+
+void boot_profiler_print(void) {
+  struct boot_profiler_phase_t phases[BOOT_PROFILER_MAX_PHASES];
+  unsigned int count;
+  int64_t previous = 0;
+
+  portENTER_CRITICAL(&boot_profiler_lock);
+  count = boot_phases_count;
+  memcpy(phases, boot_phases, count * sizeof(phases[0]));
+  portEXIT_CRITICAL(&boot_profiler_lock);
+
+  ESP_LOGI(TAG, "Boot timeline (%u phases)", count);
+  ESP_LOGI(TAG, "%8s %8s  %-16s %s", "time", "delta", "task", "phase");
+  for (unsigned int i = 0; i < count; i++) {
+    ESP_LOGI(TAG, "%5lld ms %+5lld ms  %-16s %s",
+             (long long)(phases[i].time_us / 1000),
+             (long long)((phases[i].time_us - previous) / 1000),
+             phases[i].task, phases[i].name);
+    previous = phases[i].time_us;
+  }
+}
+
+void boot_signal(EventBits_t bits) {
+  if (boot_event_group != NULL)
+    xEventGroupSetBits(boot_event_group, bits);
+}
+
+bool boot_wait(EventBits_t bits, TickType_t ticks) {
+  if (boot_event_group == NULL)
+    return false;
+
+  EventBits_t set = xEventGroupWaitBits(boot_event_group, bits, pdFALSE, pdTRUE, ticks);
+  return (set & bits) == bits;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file display.c
+ * @brief
+ * This file contains the display rendering pipeline: the buffers LVGL renders
+ * into and the way they're flushed to the ILI9341 over the SPI DMA, and the
+ * power manager dimming the backlight and putting the panel to sleep
+ *
+ * @version 2.1.2
+ * @date 2024-10-22
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "libs.h"
+
+_Static_assert(DISPLAY_BUFFER_SIZE <= DISP_BUF_SIZE,
+               "The strip buffers are larger than the SPI bus transfers");
+
+static const char *TAG = "DISPLAY";
+
+static lv_disp_buf_t display_buf;
+
+/**
+ * @brief
+ * Power states of the display
+ *
+ */
+typedef enum {
+  DISPLAY_POWER_ON,
+  DISPLAY_POWER_DIMMED,
+  DISPLAY_POWER_ASLEEP,
+} display_power_t;
+
+static display_power_t display_power = DISPLAY_POWER_ON;
+// LVGL tick of the last wake up, the panel stays awake DISPLAY_WAKE_GRACE_MS
+static uint32_t display_woken_tick;
+// LVGL tick of the last sleep in, it's woken up DISPLAY_SLEEP_IN_MS later at
+// the earliest
+static uint32_t display_asleep_tick;
+
+#ifdef CONFIG_SR_DISPLAY_FULL_FRAME
+// Internal DMA buffers the PSRAM frame is copied into to be sent
+static lv_color_t *display_bounce[2];
+
+/**
+ * @brief
+ * Send an area of the PSRAM frame to the display, one strip at a time. A strip
+ * is copied into a bounce buffer while the previous one is in flight, the
+ * display driver waits for the previous transfer before starting the next one
+ *
+ */
+static void display_flush_full_frame(lv_disp_drv_t *drv, const lv_area_t *area,
+                                     lv_color_t *color_map) {
+  lv_coord_t width = lv_area_get_width(area);
+  lv_coord_t lines = DISPLAY_BUFFER_SIZE / width;
+  lv_area_t strip = *area;
+  int bounce = 0;
+
+  for (strip.y1 = area->y1; strip.y1 <= area->y2; strip.y1 += lines) {
+    strip.y2 = LV_MATH_MIN(strip.y1 + lines - 1, area->y2);
+
+    uint32_t size = width * lv_area_get_height(&strip);
+    memcpy(display_bounce[bounce], color_map, size * sizeof(lv_color_t));
+    color_map += size;
+
+    // Every strip signals the flush, LVGL may render into the frame again as
+    // soon as the last one is copied
+    disp_driver_flush(drv, &strip, display_bounce[bounce]);
+    bounce ^= 1;
+  }
+}
+#endif
+
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+// Flush function timed by display_flush_timed
+static void (*display_flush)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+
+/**
+ * @brief
+ * Time the flush for the UI performance monitor. With the double buffers it's
+ * the time waiting for the previous strip to be sent, the SPI bound part of
+ * the frame
+ *
+ */
+static void display_flush_timed(lv_disp_drv_t *drv, const lv_area_t *area,
+                                lv_color_t *color_map) {
+  int64_t start = esp_timer_get_time();
+  display_flush(drv, area, color_map);
+  perf_flush_done(esp_timer_get_time() - start);
+}
+#endif
+
+void display_init(lv_disp_drv_t *disp_drv) {
+#ifdef CONFIG_SR_DISPLAY_FULL_FRAME
+  uint32_t size = LV_HOR_RES_MAX * LV_VER_RES_MAX;
+  lv_color_t *frame = heap_caps_malloc(size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+  assert(frame != NULL);
+
+  for (int i = 0; i < 2; i++) {
+    display_bounce[i] = heap_caps_malloc(DISPLAY_BUFFER_SIZE * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    assert(display_bounce[i] != NULL);
+  }
+
+  lv_disp_buf_init(&display_buf, frame, NULL, size);
+  disp_drv->flush_cb = display_flush_full_frame;
+
+  ESP_LOGI(TAG, "Full frame in PSRAM, %d line bounce buffers", DISPLAY_BUFFER_LINES);
+#else
+  lv_color_t *buf1 = heap_caps_malloc(DISPLAY_BUFFER_SIZE * sizeof(lv_color_t), MALLOC_CAP_DMA);
+  lv_color_t *buf2 = heap_caps_malloc(DISPLAY_BUFFER_SIZE * sizeof(lv_color_t), MALLOC_CAP_DMA);
+  assert(buf1 != NULL && buf2 != NULL);
+
+  // LVGL renders into one buffer while the other one is in flight
+  lv_disp_buf_init(&display_buf, buf1, buf2, DISPLAY_BUFFER_SIZE);
+  disp_drv->flush_cb = disp_driver_flush;
+
+  ESP_LOGI(TAG, "Double buffered, %d line strips", DISPLAY_BUFFER_LINES);
+#endif
+
+  disp_drv->buffer = &display_buf;
+
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+  display_flush = disp_drv->flush_cb;
+  disp_drv->flush_cb = display_flush_timed;
+  disp_drv->monitor_cb = perf_monitor_cb;
+#endif
+}
+
+/**
+ * @brief
+ * Set the brightness of the backlight, fading to it over fade_ms. Without
+ * CONFIG_LV_DISP_BACKLIGHT_PWM the backlight can only be switched on or off
+ *
+ */
+static void display_backlight_set(uint8_t percent, uint32_t fade_ms) {
+#if defined(CONFIG_LV_DISP_BACKLIGHT_PWM)
+  uint32_t duty = DISPLAY_BACKLIGHT_MAX_DUTY * percent / 100;
+  // Both wait for a fade in progress, they aren't mixed
+  if (fade_ms > 0) {
+    ledc_set_fade_time_and_start(LEDC_LOW_SPEED_MODE, DISPLAY_BACKLIGHT_CHANNEL, duty, fade_ms,
+                                 LEDC_FADE_NO_WAIT);
+  } else {
+    ledc_set_duty_and_update(LEDC_LOW_SPEED_MODE, DISPLAY_BACKLIGHT_CHANNEL, duty, 0);
+  }
+#elif defined(CONFIG_LV_DISP_BACKLIGHT_SWITCH)
+  (void)fade_ms;
+  // The active level is set by disp_driver_init inverting the output
+  gpio_set_level(CONFIG_LV_DISP_PIN_BCKL, percent > 0);
+#else
+  (void)percent;
+  (void)fade_ms;
+#endif
+}
+
+/**
+ * @brief
+ * Put the panel in sleep in with the backlight off. The frame memory is kept,
+ * LVGL isn't drawing anymore
+ *
+ */
+static void display_sleep(void) {
+  display_backlight_set(0, 0);
+#ifdef CONFIG_LV_TFT_DISPLAY_CONTROLLER_ILI9341
+  // Waits for the strips still in flight
+  ili9341_sleep_in();
+#endif
+  display_power = DISPLAY_POWER_ASLEEP;
+  display_asleep_tick = lv_tick_get();
+  ESP_LOGI(TAG, "Asleep");
+}
+
+/**
+ * @brief
+ * Wake the panel up, showing the frame it had before the backlight is
+ * switched on
+ *
+ */
+static void display_wake(void) {
+#ifdef CONFIG_LV_TFT_DISPLAY_CONTROLLER_ILI9341
+  // A touch right after the sleep in waits for the panel to be ready
+  uint32_t asleep_ms = lv_tick_elaps(display_asleep_tick);
+  if (asleep_ms < DISPLAY_SLEEP_IN_MS) {
+    vTaskDelay(pdMS_TO_TICKS(DISPLAY_SLEEP_IN_MS - asleep_ms) + 1);
+  }
+  ili9341_sleep_out();
+  vTaskDelay(pdMS_TO_TICKS(DISPLAY_SLEEP_OUT_MS));
+#endif
+  display_backlight_set(100, 0);
+  display_power = DISPLAY_POWER_ON;
+  display_woken_tick = lv_tick_get();
+  ESP_LOGI(TAG, "Awake");
+}
+
+void display_power_init(void) {
+#ifdef CONFIG_LV_DISP_BACKLIGHT_PWM
+  // The channel is configured by disp_driver_init, only the fades are added
+  ESP_ERROR_CHECK(ledc_fade_func_install(0));
+#endif
+  display_woken_tick = lv_tick_get();
+}
+
+uint32_t display_power_update(bool sleep_screen) {
+  uint32_t inactive_ms = lv_disp_get_inactive_time(NULL);
+  uint32_t awake_ms = lv_tick_elaps(display_woken_tick);
+  // A touch since the last run, or the sleep screen was left
+  bool activity = inactive_ms < awake_ms || !sleep_screen;
+
+  if (display_power == DISPLAY_POWER_ASLEEP) {
+    if (!activity) {
+      return UINT32_MAX;
+    }
+    display_wake();
+    return 0;
+  }
+
+  if (sleep_screen) {
+    uint32_t idle_ms = LV_MATH_MIN(inactive_ms, awake_ms);
+    if (idle_ms >= DISPLAY_WAKE_GRACE_MS) {
+      display_sleep();
+      return UINT32_MAX;
+    }
+    return DISPLAY_WAKE_GRACE_MS - idle_ms;
+  }
+
+#if defined(CONFIG_LV_DISP_BACKLIGHT_PWM) && DISPLAY_DIM_TIMEOUT > 0
+  const uint32_t dim_ms = DISPLAY_DIM_TIMEOUT * 1000;
+
+  if (inactive_ms < dim_ms) {
+    if (display_power == DISPLAY_POWER_DIMMED) {
+      display_backlight_set(100, 0);
+      display_power = DISPLAY_POWER_ON;
+    }
+    return dim_ms - inactive_ms;
+  }
+  if (display_power == DISPLAY_POWER_ON) {
+    display_backlight_set(DISPLAY_DIM_LEVEL, DISPLAY_DIM_FADE_MS);
+    display_power = DISPLAY_POWER_DIMMED;
+  }
+#endif
+
+  return UINT32_MAX;
+}
+
+bool display_power_is_asleep(void) {
+  return display_power == DISPLAY_POWER_ASLEEP;
+}
@@ -70,6 +70,231 @@ struct smart_ring_http_client_ota_information ota_information = {
 
 };
 
+/**
+ * @brief
+ * Persistent connection kept open to one of the back-end endpoints, so that
+ * consecutive requests reuse the socket and the TLS session instead of paying
+ * a full handshake each time.
+ *
+ */
+struct smart_ring_http_client_pool_entry {
+  /**
+   * @brief
+   * Base URL of the endpoint this connection belongs to, one of the endpoint
+   * string literals
+   *
+   */
+  const char *endpoint;
+
+  /**
+   * @brief
+   * Event handler the client handle was created with
+   *
+   */
+  http_event_handle_cb event_handler;
+
+  /**
+   * @brief
+   * ESP-IDF HTTP client handle, NULL when the slot is free
+   *
+   */
+  esp_http_client_handle_t handle;
+
+  /**
+   * @brief
+   * Flag signaling the connection is being used by a request
+   *
+   */
+  bool in_use;
+
+  /**
+   * @brief
+   * Timestamp, in microseconds, of the last time the connection was released
+   *
+   */
+  int64_t last_used;
+};
+
+/// Pooled connections
+static struct smart_ring_http_client_pool_entry http_client_pool[HTTP_CLIENT_POOL_SIZE];
+
+/// Mutex protecting the pool
+static SemaphoreHandle_t http_client_pool_mutex = NULL;
+
+/**
+ * @brief
+ * Free a pool slot. Called with the pool mutex held, the caller closes the
+ * returned handle once it gave the mutex back, so the TLS teardown never
+ * blocks the other requests.
+ *
+ * @param entry {smart_ring_http_client_pool_entry} - Slot to free
+ * @return esp_http_client_handle_t - Handle the slot held, NULL if none
+ */
+static esp_http_client_handle_t http_client_pool_detach_entry(struct smart_ring_http_client_pool_entry *entry) {
+  esp_http_client_handle_t handle = entry->handle;
+
+  entry->endpoint      = NULL;
+  entry->event_handler = NULL;
+  entry->handle        = NULL;
+  entry->in_use        = false;
+
+  return handle;
+}
+
+static void http_client_pool_close_handle(esp_http_client_handle_t handle) {
+  if (handle == NULL) {
+    return;
+  }
+
+  esp_http_client_close(handle);
+  esp_http_client_cleanup(handle);
+}
+
+/**
+ * @brief
+ * Close the connections idle for HTTP_CLIENT_POOL_IDLE_TIMEOUT, which the
+ * server has likely closed already. Run by the requests themselves rather than
+ * a timer, so the TLS teardown happens on the requesting task, outside of the
+ * pool mutex, and never holds up the esp_timer callbacks.
+ *
+ */
+static void http_client_pool_close_idle(void) {
+  esp_http_client_handle_t idle[HTTP_CLIENT_POOL_SIZE];
+  int64_t now = esp_timer_get_time();
+  int count   = 0;
+
+  xSemaphoreTake(http_client_pool_mutex, portMAX_DELAY);
+  for (int i = 0; i < HTTP_CLIENT_POOL_SIZE; i++) {
+    struct smart_ring_http_client_pool_entry *entry = &http_client_pool[i];
+
+    if (entry->handle != NULL && !entry->in_use &&
+        now - entry->last_used >= (int64_t)HTTP_CLIENT_POOL_IDLE_TIMEOUT * 1000000) {
+#ifndef NDEBUG
+      ESP_LOGI(TAG, "Closing idle connection to %s", entry->endpoint);
+#endif
+      idle[count++] = http_client_pool_detach_entry(entry);
+    }
+  }
+  xSemaphoreGive(http_client_pool_mutex);
+
+  for (int i = 0; i < count; i++) {
+    http_client_pool_close_handle(idle[i]);
+  }
+}
+
+static void http_client_pool_init(void) {
+  if (http_client_pool_mutex != NULL) {
+    return;
+  }
+
+  http_client_pool_mutex = xSemaphoreCreateMutex();
+}
+
+/**
+ * @brief
+ * Get a client handle for the given endpoint, reusing the open connection when
+ * there is one.
+ *
+ * @param endpoint {String} - Base URL of the endpoint
+ * @param event_handler {http_event_handle_cb} - Handler for the client events
+ * @return esp_http_client_handle_t - Client handle, NULL if none available
+ */
+static esp_http_client_handle_t http_client_pool_acquire(const char *endpoint, http_event_handle_cb event_handler) {
+  struct smart_ring_http_client_pool_entry *free_entry = NULL;
+  esp_http_client_handle_t handle  = NULL;
+  esp_http_client_handle_t evicted = NULL;
+
+  http_client_pool_init();
+  http_client_pool_close_idle();
+
+  xSemaphoreTake(http_client_pool_mutex, portMAX_DELAY);
+  for (int i = 0; i < HTTP_CLIENT_POOL_SIZE; i++) {
+    struct smart_ring_http_client_pool_entry *entry = &http_client_pool[i];
+
+    if (entry->handle == NULL) {
+      if (free_entry == NULL) {
+        free_entry = entry;
+      }
+    } else if (!entry->in_use && strcmp(entry->endpoint, endpoint) == 0 && entry->event_handler == event_handler) {
+#ifndef NDEBUG
+      ESP_LOGI(TAG, "Reusing connection to %s", endpoint);
+#endif
+      entry->in_use = true;
+      handle        = entry->handle;
+      break;
+    } else if (!entry->in_use && free_entry == NULL) {
+      // Evict the idle connection of another endpoint
+      free_entry = entry;
+    }
+  }
+
+  if (handle == NULL && free_entry != NULL) {
+    evicted = http_client_pool_detach_entry(free_entry);
+
+    esp_http_client_config_t config = {
+        .url               = endpoint,
+        .event_handler     = event_handler,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+        .transport_type    = HTTP_TRANSPORT_OVER_SSL,
+        .method            = HTTP_METHOD_GET,
+    };
+
+    free_entry->handle = esp_http_client_init(&config);
+    if (free_entry->handle != NULL) {
+      free_entry->endpoint      = endpoint;
+      free_entry->event_handler = event_handler;
+      free_entry->in_use        = true;
+      handle                    = free_entry->handle;
+    }
+  }
+  xSemaphoreGive(http_client_pool_mutex);
+
+  http_client_pool_close_handle(evicted);
+
+  if (handle == NULL) {
+    ESP_LOGE(TAG, "No HTTP client available for %s", endpoint);
+  }
+
+  return handle;
+}
+
+/**
+ * @brief
+ * Give back a handle obtained with http_client_pool_acquire. The connection is
+ * kept open for the next request unless the request failed.
+ *
+ * @param handle {esp_http_client_handle_t} - Client handle
+ * @param keep {boolean} - Keep the connection open
+ */
+static void http_client_pool_release(esp_http_client_handle_t handle, bool keep) {
+  esp_http_client_handle_t closed = NULL;
+
+  if (handle == NULL) {
+    return;
+  }
+
+  xSemaphoreTake(http_client_pool_mutex, portMAX_DELAY);
+  for (int i = 0; i < HTTP_CLIENT_POOL_SIZE; i++) {
+    struct smart_ring_http_client_pool_entry *entry = &http_client_pool[i];
+
+    if (entry->handle == handle) {
+      if (keep) {
+        entry->in_use    = false;
+        entry->last_used = esp_timer_get_time();
+      } else {
+        closed = http_client_pool_detach_entry(entry);
+      }
+      break;
+    }
+  }
+  xSemaphoreGive(http_client_pool_mutex);
+
+  http_client_pool_close_handle(closed);
+
+  // The other connections may have been idle long enough meanwhile
+  http_client_pool_close_idle();
+}
+
 /**
  * @brief
  * Handle the responses from the AWS and trigger the corresponding callbacks
@@ -120,6 +345,7 @@ esp_err_t smart_ring_http_client_event_handler(esp_http_client_event_t *event) {
                  ESP_LOGI(TAG, "No new firmware available");
               }
 
+              // The check answers with the image itself, drop it unread
               esp_http_client_close(event->client);
               return ESP_OK;
           } 
@@ -134,7 +360,7 @@ esp_err_t smart_ring_http_client_event_handler(esp_http_client_event_t *event) {
 #endif
               if (current_percentage > ota_information.last_percentage + 5) {
                   ota_information.last_percentage = current_percentage;
-                  smart_ring_ui_update_change_percentage(ota_information.last_percentage);
+                  smart_ring_ui_set_download_progress(ota_information.last_percentage);
                   vTaskDelay(100 / portTICK_PERIOD_MS);
               }
               esp_err_t ota_err = esp_ota_write(ota_information.ota_handle, (const char *)event->data, event->data_len);
@@ -173,10 +399,8 @@ esp_err_t smart_ring_http_client_event_handler(esp_http_client_event_t *event) {
                ESP_LOGI(TAG, "Last esp error code: 0x%x", err);
                ESP_LOGI(TAG, "Last mbedtls failure: 0x%x", mbedtls_err);
            }
-           if (event_data != NULL) {
-               free(event_data);
-               event_data = NULL;
-           }
+           // The data buffer belongs to the client handle, only drop the reference
+           event_data        = NULL;
            event_data_length = 0;
            break;
 
@@ -200,17 +424,16 @@ void smart_ring_http_client_get_check_firmware() {
   sprintf(url, "%s/%s?sr=true&version=%s", API_ENDPOINT, "firmware",
           FIRMWARE_VERSION);
 
-  esp_http_client_config_t config = {
-      .url = url,
-      .event_handler = smart_ring_http_client_event_handler,
-      .crt_bundle_attach = esp_crt_bundle_attach,
-      .transport_type = HTTP_TRANSPORT_OVER_SSL,
-      .method = HTTP_METHOD_GET,
-  };
-
   ESP_LOGI(TAG, "URL: %s", url);
-  
-  esp_http_client_handle_t client = esp_http_client_init(&config);
+
+  esp_http_client_handle_t client = http_client_pool_acquire(API_ENDPOINT, smart_ring_http_client_event_handler);
+  if (client == NULL) {
+    return;
+  }
+
+  esp_http_client_set_url(client, url);
+  esp_http_client_set_method(client, HTTP_METHOD_GET);
+
   // Add api key header to validate on API
   esp_http_client_set_header(client, "X-Api-Key", API_KEY);
   
@@ -236,10 +459,12 @@ void smart_ring_http_client_get_check_firmware() {
     }
   } while (connection_error && connection_retries < 3 && status_code > 400);
 
+  // The body was aborted, the connection can't be reused
+  http_client_pool_release(client, false);
+
   connection_error = false;
   connection_has_response = false;
   connection_retries = 0;
-  esp_http_client_cleanup(client);
 
   // TODO : Error on connection set the error flag for the system
   switch (status_code) {
@@ -278,7 +503,10 @@ void smart_ring_http_client_get_update_firmware() {
 
   ESP_LOGI(TAG, "OTA Handle started\nRequesting image");
 
-  smart_ring_ui_update_download_started();
+  // Download the image at full radio power
+  wifi_power_hold(WIFI_POWER_HOLD_OTA);
+
+  smart_ring_ui_set_download_started();
 
   char type[sizeof(int) + 1];
   itoa(HTTP_CLIENT_GET_UPDATE_FIRMWARE, type, 10);
@@ -287,19 +515,18 @@ void smart_ring_http_client_get_update_firmware() {
 
   sprintf(url, "%s/%s?sr=true&version=%s", API_ENDPOINT, "firmware",
           FIRMWARE_VERSION);
-  esp_http_client_config_t config = {
-      .url = API_ENDPOINT,
-      .event_handler = smart_ring_http_client_event_handler,
-      .crt_bundle_attach = esp_crt_bundle_attach,
-      .transport_type = HTTP_TRANSPORT_OVER_SSL,
-      .method = HTTP_METHOD_GET,
-  };
-  
 
   ESP_LOGI(TAG, "URL: %s", url);
 
-  esp_http_client_handle_t client = esp_http_client_init(&config);
+  esp_http_client_handle_t client = http_client_pool_acquire(API_ENDPOINT, smart_ring_http_client_event_handler);
+  if (client == NULL) {
+    esp_ota_abort(ota_information.ota_handle);
+    wifi_power_release(WIFI_POWER_HOLD_OTA);
+    smart_ring_get_controller()->flags.flag.update_failed = true;
+    return;
+  }
 
+  esp_http_client_set_method(client, HTTP_METHOD_GET);
 
   // Add api key header to validate on API
   esp_http_client_set_header(client, "X-Api-Key", API_KEY);
@@ -355,7 +582,10 @@ void smart_ring_http_client_get_update_firmware() {
       }
     }
   }
-  esp_http_client_cleanup(client);
+
+  // The device restarts after the update, release the TLS buffers right away
+  http_client_pool_release(client, false);
+  wifi_power_release(WIFI_POWER_HOLD_OTA);
 }
 
 esp_err_t certificate_http_event_handle(esp_http_client_event_t *evt)
@@ -466,7 +696,8 @@ esp_err_t certificate_http_event_handle(esp_http_client_event_t *evt)
                        const cJSON *keyPair   = cJSON_GetObjectItemCaseSensitive(createKeysResult,"keyPair"); 
                        const char *privateKey = cJSON_GetObjectItemCaseSensitive(keyPair, "PrivateKey")->valuestring;
                        if(privateKey != NULL) {
-                          spiffs.saveMQTTCertificatePrivateKey(privateKey);
+                          if (spiffs.saveMQTTCertificatePrivateKey(privateKey) != ESP_OK)
+                             ESP_LOGE(TAG, "Failed to store the PrivateKey\n");
                           ESP_LOGI(TAG, "PrivateKey  %s\n", privateKey);
                        }
                        else 
@@ -500,19 +731,13 @@ esp_err_t certificate_http_event_handle(esp_http_client_event_t *evt)
 void smart_ring_http_client_get_certificate(void) {
   
      esp_err_t err_http;
-  
-     const esp_http_client_config_t config = {
-      .url               = MQTT_API_ENDPOINT,
-      .event_handler     = certificate_http_event_handle,
-      .crt_bundle_attach = esp_crt_bundle_attach,
-      .transport_type    = HTTP_TRANSPORT_OVER_SSL,
-      .method            = HTTP_METHOD_GET,
-     };
-     
-  
+
      ESP_LOGI(TAG, "URL: %s", MQTT_API_ENDPOINT);
 
-     esp_http_client_handle_t client = esp_http_client_init(&config);
+     esp_http_client_handle_t client = http_client_pool_acquire(MQTT_API_ENDPOINT, certificate_http_event_handle);
+     if (client == NULL) {
+         return;
+     }
 
      // Add headers to validate on API
     esp_http_client_set_method(client, HTTP_METHOD_POST);
@@ -537,11 +762,10 @@ void smart_ring_http_client_get_certificate(void) {
         ESP_LOGE(TAG, "Error perform http request %s", esp_err_to_name(err_http));
             
 
-    while(esp_http_client_cleanup(client)!=ESP_OK) {
-        ESP_LOGE(TAG,"http cleanup failed!");
-        vTaskDelay(1000 / portTICK_PERIOD_MS);
-    }
-    ESP_LOGI(TAG,"http connection closed clean");
+    esp_http_client_set_post_field(client, NULL, 0);
+
+    http_client_pool_release(client, err_http == ESP_OK);
+    ESP_LOGI(TAG,"http request finished");
 }
 
 
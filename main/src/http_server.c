@@ -14,6 +14,7 @@
  */
 
 #include "libs.h"
+#include "webpage_assets.h"
 
 // Tag used for ESP serial console messages
 static const char *TAG = "http_server";
@@ -30,24 +31,63 @@ static QueueHandle_t http_server_monitor_queue_handle;
 // Variable with the provision status
 static enum smart_ring_provision_status_t provision_status;
 
-// Embedded files: JQuery, index.html, app.css, app.js and favicon.ico files
-/// Start of JQUERY file
-extern const uint8_t jquery_3_6_0_min_js_start[] asm("_binary_jquery_3_6_0_min_js_start");
+/**
+ * @brief
+ * Network found by the background scan
+ *
+ */
+struct smart_ring_scanned_network
+{
+  /// Network name
+  char ssid[33];
+  /// Strongest signal seen for this SSID
+  int8_t rssi;
+  /// Channel of the strongest access point
+  uint8_t channel;
+  /// Authentication mode
+  wifi_auth_mode_t authmode;
+};
+
+// Background scan task handle
+static TaskHandle_t task_http_server_scan = NULL;
+
+// Cached networks of the last scan, sorted by signal strength
+static struct smart_ring_scanned_network scan_cache[HTTP_SERVER_SCAN_MAX_NETWORKS];
+
+// Number of cached networks
+static size_t scan_cache_len = 0;
+
+// Mutex protecting the scan cache
+static SemaphoreHandle_t scan_cache_mutex = NULL;
 
-/// End of JQUERY file
-extern const uint8_t jquery_3_6_0_min_js_end[] asm("_binary_jquery_3_6_0_min_js_end");
+// Tick count of the last scan, a request finding the cache older scans again
+static TickType_t scan_cache_time = 0;
+
+// Given by the scan task when it exits, for http_server_stop to wait on it
+static SemaphoreHandle_t scan_task_exited = NULL;
+
+// Cleared to stop the background scan task
+static volatile bool scan_running = false;
+
+// Set while a provision connection is in progress, since the station can't
+// scan and connect at the same time
+static volatile bool scan_paused = false;
+
+// Embedded files: index.html, index.css and app.js (gzipped) and the logos. In
+// bundle mode everything is inlined into index.html
 /// Start of HTML file
-extern const uint8_t index_html_start[] asm("_binary_index_html_start");
+extern const uint8_t index_html_gz_start[] asm("_binary_index_html_gz_start");
 /// End of HTML file
-extern const uint8_t index_html_end[] asm("_binary_index_html_end");
+extern const uint8_t index_html_gz_end[] asm("_binary_index_html_gz_end");
+#ifndef CONFIG_SR_WEBPAGE_BUNDLE
 /// Start of CSS file
-extern const uint8_t index_css_start[] asm("_binary_index_css_start");
+extern const uint8_t index_css_gz_start[] asm("_binary_index_css_gz_start");
 /// End of CSS file
-extern const uint8_t index_css_end[] asm("_binary_index_css_end");
+extern const uint8_t index_css_gz_end[] asm("_binary_index_css_gz_end");
 /// Start of JS file
-extern const uint8_t app_js_start[] asm("_binary_app_js_start");
+extern const uint8_t app_js_gz_start[] asm("_binary_app_js_gz_start");
 /// End of JS file
-extern const uint8_t app_js_end[] asm("_binary_app_js_end");
+extern const uint8_t app_js_gz_end[] asm("_binary_app_js_gz_end");
 /// Start of QL image
 extern const uint8_t quantum_leap_png_start[] asm("_binary_quantum_leap_png_start");
 /// End of QL image
@@ -56,115 +96,275 @@ extern const uint8_t quantum_leap_png_end[] asm("_binary_quantum_leap_png_end");
 extern const uint8_t fonte_viva_png_start[] asm("_binary_fonte_viva_png_start");
 /// End of Fonte Viva image
 extern const uint8_t fonte_viva_png_end[] asm("_binary_fonte_viva_png_end");
+#endif
 
-static esp_err_t http_server_jquery_handler(httpd_req_t *req)
+/**
+ * @brief
+ * Description of an embedded webpage file, given as user context to
+ * http_server_asset_handler
+ *
+ */
+struct smart_ring_http_server_asset
 {
-  ESP_LOGI(TAG, "Jquery requested");
-
-  httpd_resp_set_type(req, "application/javascript");
-  httpd_resp_send(req, (const char *)jquery_3_6_0_min_js_start, jquery_3_6_0_min_js_end - jquery_3_6_0_min_js_start);
-  return ESP_OK;
-}
+  /// Name shown in the logs
+  const char *name;
+  /// Start of the embedded data
+  const uint8_t *start;
+  /// End of the embedded data
+  const uint8_t *end;
+  /// MIME type of the original file
+  const char *content_type;
+  /// Strong ETag, generated from the original content at build time
+  const char *etag;
+  /// Value of the Cache-Control header
+  const char *cache_control;
+  /// Whether the embedded data is gzipped
+  bool gzipped;
+};
+
+static const struct smart_ring_http_server_asset asset_index_html = {
+    "index.html", index_html_gz_start, index_html_gz_end, "text/html",
+    WEBPAGE_ETAG_INDEX_HTML, HTTP_SERVER_CACHE_CONTROL_PAGE, true};
+
+#ifndef CONFIG_SR_WEBPAGE_BUNDLE
+static const struct smart_ring_http_server_asset asset_index_css = {
+    "index.css", index_css_gz_start, index_css_gz_end, "text/css",
+    WEBPAGE_ETAG_INDEX_CSS, HTTP_SERVER_CACHE_CONTROL_ASSET, true};
+
+static const struct smart_ring_http_server_asset asset_app_js = {
+    "app.js", app_js_gz_start, app_js_gz_end, "application/javascript",
+    WEBPAGE_ETAG_APP_JS, HTTP_SERVER_CACHE_CONTROL_ASSET, true};
+
+static const struct smart_ring_http_server_asset asset_ql_logo = {
+    "QL logo", quantum_leap_png_start, quantum_leap_png_end, "image/png",
+    WEBPAGE_ETAG_QUANTUM_LEAP_PNG, HTTP_SERVER_CACHE_CONTROL_ASSET, false};
+
+static const struct smart_ring_http_server_asset asset_fv_logo = {
+    "FV logo", fonte_viva_png_start, fonte_viva_png_end, "image/png",
+    WEBPAGE_ETAG_FONTE_VIVA_PNG, HTTP_SERVER_CACHE_CONTROL_ASSET, false};
+#endif
 
-static esp_err_t http_server_index_html_handler(httpd_req_t *req)
+/**
+ * @brief
+ * Check if the If-None-Match header of the request contains the given ETag
+ *
+ * @param req Request
+ * @param etag ETag of the requested file
+ * @return true The client copy is up to date
+ */
+static bool http_server_etag_matches(httpd_req_t *req, const char *etag)
 {
-  ESP_LOGI(TAG, "index.html requested");
+  size_t len = httpd_req_get_hdr_value_len(req, "If-None-Match") + 1;
+  if (len <= 1 || len > HTTP_SERVER_IF_NONE_MATCH_MAX_LEN)
+  {
+    return false;
+  }
 
-  httpd_resp_set_type(req, "text/html");
-  httpd_resp_send(req, (const char *)index_html_start, index_html_end - index_html_start);
-  return ESP_OK;
+  char value[HTTP_SERVER_IF_NONE_MATCH_MAX_LEN];
+  if (httpd_req_get_hdr_value_str(req, "If-None-Match", value, len) != ESP_OK)
+  {
+    return false;
+  }
+
+  return strstr(value, etag) != NULL || strcmp(value, "*") == 0;
 }
 
-static esp_err_t http_server_index_css_handler(httpd_req_t *req)
+static esp_err_t http_server_asset_handler(httpd_req_t *req)
 {
-  ESP_LOGI(TAG, "index.css requested");
+  const struct smart_ring_http_server_asset *asset = req->user_ctx;
 
-  httpd_resp_set_type(req, "text/css");
-  httpd_resp_send(req, (const char *)index_css_start, index_css_end - index_css_start);
-  return ESP_OK;
-}
+  httpd_resp_set_hdr(req, "ETag", asset->etag);
+  httpd_resp_set_hdr(req, "Cache-Control", asset->cache_control);
 
-static esp_err_t http_server_app_js_handler(httpd_req_t *req)
-{
-  ESP_LOGI(TAG, "app.js requested");
+  if (http_server_etag_matches(req, asset->etag))
+  {
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "%s not modified", asset->name);
+#endif
+    httpd_resp_set_status(req, "304 Not Modified");
+    return httpd_resp_send(req, NULL, 0);
+  }
 
-  httpd_resp_set_type(req, "application/javascript");
-  httpd_resp_send(req, (const char *)app_js_start, app_js_end - app_js_start);
-  return ESP_OK;
-}
+  ESP_LOGI(TAG, "%s requested", asset->name);
 
-static esp_err_t http_server_ql_logo_png_handler(httpd_req_t *req)
-{
-  ESP_LOGI(TAG, "QL logo requested");
+  httpd_resp_set_type(req, asset->content_type);
+  if (asset->gzipped)
+  {
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+  }
 
-  httpd_resp_set_type(req, "image/png");
-  httpd_resp_send(req, (const char *)quantum_leap_png_start, quantum_leap_png_end - quantum_leap_png_start);
-  return ESP_OK;
+  return httpd_resp_send(req, (const char *)asset->start, asset->end - asset->start);
 }
 
-static esp_err_t http_server_fv_logo_png_handler(httpd_req_t *req)
+/**
+ * @brief
+ * Sort scan records by signal strength, strongest first
+ *
+ */
+static int http_server_scan_compare(const void *a, const void *b)
 {
-  ESP_LOGI(TAG, "FV logo requested");
-
-  httpd_resp_set_type(req, "image/png");
-  httpd_resp_send(req, (const char *)fonte_viva_png_start, fonte_viva_png_end - fonte_viva_png_start);
-  return ESP_OK;
+  return ((const wifi_ap_record_t *)b)->rssi - ((const wifi_ap_record_t *)a)->rssi;
 }
 
-static esp_err_t http_server_scan_networks_handler(httpd_req_t *req)
+/**
+ * @brief
+ * Replace the cached networks with the given scan records. Hidden networks are
+ * skipped and only the strongest record of each SSID is kept.
+ *
+ * @param records Scan records, sorted in place
+ * @param n_records Number of records
+ */
+static void http_server_scan_update_cache(wifi_ap_record_t *records, uint16_t n_records)
 {
-  ESP_LOGI(TAG, "Surrounding networks requested");
-
-  // Scan networks
-  const wifi_scan_config_t scan_config = {};
-  int err = esp_wifi_scan_start(&scan_config, true);
-  ESP_LOGI(TAG, "NETWORKS SCANNED: %s", esp_err_to_name(err));
+  struct smart_ring_scanned_network networks[HTTP_SERVER_SCAN_MAX_NETWORKS];
+  size_t n_networks = 0;
 
-  // List networks
-  uint16_t n_networks;
-  err = esp_wifi_scan_get_ap_num(&n_networks);
-  ESP_LOGI(TAG, "NETWORKS FOUND: %s - %d", esp_err_to_name(err), n_networks);
+  qsort(records, n_records, sizeof(records[0]), http_server_scan_compare);
 
-  if (n_networks > 10)
+  for (size_t i = 0; i < n_records && n_networks < HTTP_SERVER_SCAN_MAX_NETWORKS; i++)
   {
-    n_networks = 10;
+    const char *ssid = (const char *)records[i].ssid;
+    bool duplicated = false;
+
+    for (size_t j = 0; j < n_networks && !duplicated; j++)
+    {
+      duplicated = strcmp(networks[j].ssid, ssid) == 0;
+    }
+
+    if (ssid[0] == '\0' || duplicated)
+    {
+      continue;
+    }
+
+    strlcpy(networks[n_networks].ssid, ssid, sizeof(networks[n_networks].ssid));
+    networks[n_networks].rssi = records[i].rssi;
+    networks[n_networks].authmode = records[i].authmode;
+    networks[n_networks].channel = records[i].primary;
+    n_networks++;
   }
 
-  char response[(n_networks * 33) + (n_networks * 3) + 2];
-  strcpy(response, "[\"");
+  xSemaphoreTake(scan_cache_mutex, portMAX_DELAY);
+  memcpy(scan_cache, networks, n_networks * sizeof(networks[0]));
+  scan_cache_len = n_networks;
+  xSemaphoreGive(scan_cache_mutex);
+}
 
-  wifi_ap_record_t networks[n_networks];
-  err = esp_wifi_scan_get_ap_records(&n_networks, networks);
-  ESP_LOGI(TAG, "NETWORKS RETRIEVED: %s", esp_err_to_name(err));
-  
-  if (err == ESP_OK)
+/**
+ * @brief
+ * Background task scanning the surrounding networks once when the
+ * provisioning server starts, and then only when the page asks for the list.
+ * A scan takes the radio off the SoftAP channel, so nobody polling the list
+ * means no scans disturbing the phone connected to the access point
+ *
+ */
+static void http_server_scan_thread(void *pvParameters)
+{
+  const wifi_scan_config_t scan_config = {};
+  wifi_ap_record_t *records = malloc(HTTP_SERVER_SCAN_MAX_RECORDS * sizeof(wifi_ap_record_t));
+
+  while (scan_running && records != NULL)
   {
-    ESP_LOGI(TAG, "NETWORKS: %d", n_networks);
-    for (size_t i = 0; i < n_networks; i++)
+    if (!scan_paused && xTaskGetTickCount() - scan_cache_time >= pdMS_TO_TICKS(HTTP_SERVER_SCAN_INTERVAL_MS))
     {
-      ESP_LOGI(TAG, "%d - %s", i + 1, networks[i].ssid);
-      char temp[33 + 3];
-      if (i == n_networks - 1)
+      uint16_t n_records = HTTP_SERVER_SCAN_MAX_RECORDS;
+
+      // Reading the records also releases the driver copy of the scan results
+      esp_err_t err = esp_wifi_scan_start(&scan_config, true);
+      if (err == ESP_OK)
       {
-        sprintf(temp, "%s\"]", networks[i].ssid);
-        strcat(response, temp);
+        err = esp_wifi_scan_get_ap_records(&n_records, records);
       }
-      else
+
+#ifndef NDEBUG
+      ESP_LOGI(TAG, "NETWORKS SCANNED: %s - %d", esp_err_to_name(err), n_records);
+#endif
+
+      // Results of a scan aborted by a provision request are discarded
+      if (err == ESP_OK && n_records > 0 && !scan_paused)
       {
-        sprintf(temp, "%s\",\"", networks[i].ssid);
-        strcat(response, temp);
+        http_server_scan_update_cache(records, n_records);
       }
+      scan_cache_time = xTaskGetTickCount();
     }
 
-    ESP_LOGI(TAG, "Response: %s", response);
+    // Sleep until the list is requested, or until the server stops
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
   }
 
-  esp_wifi_scan_stop();
+  free(records);
+  xSemaphoreGive(scan_task_exited);
+  vTaskDelete(NULL);
+}
+
+/**
+ * @brief
+ * Copy an SSID escaping the characters that would break a JSON string
+ *
+ * @param dst Destination, with room for twice the SSID length
+ * @param src SSID
+ */
+static void http_server_json_escape(char *dst, const char *src)
+{
+  for (; *src != '\0'; src++)
+  {
+    if (*src == '"' || *src == '\\')
+    {
+      *dst++ = '\\';
+      *dst++ = *src;
+    }
+    else if ((unsigned char)*src >= 0x20)
+    {
+      *dst++ = *src;
+    }
+  }
+  *dst = '\0';
+}
+
+static esp_err_t http_server_scan_networks_handler(httpd_req_t *req)
+{
+  ESP_LOGI(TAG, "Surrounding networks requested");
+
+  // Copy the cache so the scanner isn't blocked while sending
+  struct smart_ring_scanned_network networks[HTTP_SERVER_SCAN_MAX_NETWORKS];
+  size_t n_networks;
+
+  xSemaphoreTake(scan_cache_mutex, portMAX_DELAY);
+  n_networks = scan_cache_len;
+  memcpy(networks, scan_cache, n_networks * sizeof(networks[0]));
+  xSemaphoreGive(scan_cache_mutex);
+
+  // Refreshed for the next poll, at most every HTTP_SERVER_SCAN_INTERVAL_MS
+  if (task_http_server_scan)
+  {
+    xTaskNotifyGive(task_http_server_scan);
+  }
 
   httpd_resp_set_type(req, "application/json");
-  httpd_resp_send(req, response, HTTPD_RESP_USE_STRLEN);
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
 
-  return ESP_OK;
+  // One chunk per network: {"ssid":"...","rssi":-50,"auth":3,"channel":6}
+  esp_err_t err = ESP_OK;
+  for (size_t i = 0; i < n_networks && err == ESP_OK; i++)
+  {
+    char ssid[2 * sizeof(networks[i].ssid)];
+    char entry[sizeof(ssid) + 64];
+
+    http_server_json_escape(ssid, networks[i].ssid);
+    snprintf(entry, sizeof(entry), "%c{\"ssid\":\"%s\",\"rssi\":%d,\"auth\":%d,\"channel\":%d}",
+             i == 0 ? '[' : ',', ssid, networks[i].rssi, networks[i].authmode, networks[i].channel);
+    err = httpd_resp_send_chunk(req, entry, HTTPD_RESP_USE_STRLEN);
+  }
+
+  if (err == ESP_OK)
+  {
+    err = httpd_resp_send_chunk(req, n_networks == 0 ? "[]" : "]", HTTPD_RESP_USE_STRLEN);
+  }
+  if (err == ESP_OK)
+  {
+    err = httpd_resp_send_chunk(req, NULL, 0);
+  }
+
+  return err;
 }
 
 static esp_err_t http_server_start_provision_handler(httpd_req_t *req)
@@ -203,6 +403,10 @@ static esp_err_t http_server_start_provision_handler(httpd_req_t *req)
   httpd_resp_set_type(req, "application/json");
   httpd_resp_send(req, "{\"result\":\"OK\"}", HTTPD_RESP_USE_STRLEN);
 
+  // Stop the background scan before connecting
+  scan_paused = true;
+  esp_wifi_scan_stop();
+
   wifi_config_t sta_config = {};
 
   strcpy(&sta_config.sta.ssid, ssid_str);
@@ -244,6 +448,13 @@ static esp_err_t http_server_configure(void)
   // Generate the default configuration
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
 
+  // Protects the network list shared by the scan task and the server
+  if (scan_cache_mutex == NULL)
+  {
+    scan_cache_mutex = xSemaphoreCreateMutex();
+    scan_task_exited = xSemaphoreCreateBinary();
+  }
+
   // The core that the HTTP server will run on
   config.core_id = HTTP_SERVER_TASK_CORE_ID;
 
@@ -270,47 +481,42 @@ static esp_err_t http_server_configure(void)
   {
     ESP_LOGI(TAG, "http_server_configure: Registering URI handlers");
 
-    // register query handler
-    httpd_uri_t jquery_js = {.uri = "/jquery-3.6.0.min.js",
-                             .method = HTTP_GET,
-                             .handler = http_server_jquery_handler,
-                             .user_ctx = NULL};
-    httpd_register_uri_handler(http_server_handle, &jquery_js);
-
     // register index.html handler
     httpd_uri_t index_html = {.uri = "/",
                               .method = HTTP_GET,
-                              .handler = http_server_index_html_handler,
-                              .user_ctx = NULL};
+                              .handler = http_server_asset_handler,
+                              .user_ctx = (void *)&asset_index_html};
     httpd_register_uri_handler(http_server_handle, &index_html);
 
+#ifndef CONFIG_SR_WEBPAGE_BUNDLE
     // register app.css handler
     httpd_uri_t app_css = {.uri = "/index.css",
                            .method = HTTP_GET,
-                           .handler = http_server_index_css_handler,
-                           .user_ctx = NULL};
+                           .handler = http_server_asset_handler,
+                           .user_ctx = (void *)&asset_index_css};
     httpd_register_uri_handler(http_server_handle, &app_css);
 
     // register app.js handler
     httpd_uri_t app_js = {.uri = "/app.js",
                           .method = HTTP_GET,
-                          .handler = http_server_app_js_handler,
-                          .user_ctx = NULL};
+                          .handler = http_server_asset_handler,
+                          .user_ctx = (void *)&asset_app_js};
     httpd_register_uri_handler(http_server_handle, &app_js);
 
     // register quantum leap logo
     httpd_uri_t ql_logo = {.uri = "/quantum_leap.png",
                            .method = HTTP_GET,
-                           .handler = http_server_ql_logo_png_handler,
-                           .user_ctx = NULL};
+                           .handler = http_server_asset_handler,
+                           .user_ctx = (void *)&asset_ql_logo};
     httpd_register_uri_handler(http_server_handle, &ql_logo);
 
     // register fonte viva logo
     httpd_uri_t fv_logo = {.uri = "/fonte_viva.png",
                            .method = HTTP_GET,
-                           .handler = http_server_fv_logo_png_handler,
-                           .user_ctx = NULL};
+                           .handler = http_server_asset_handler,
+                           .user_ctx = (void *)&asset_fv_logo};
     httpd_register_uri_handler(http_server_handle, &fv_logo);
+#endif
 
     // register scan networks endpoint
     httpd_uri_t scan_networks = {.uri = "/scan_networks",
@@ -333,6 +539,15 @@ static esp_err_t http_server_configure(void)
                           .user_ctx = NULL};
     httpd_register_uri_handler(http_server_handle, &status);
 
+    // Start the background scan, so the first request already has results
+    scan_running = true;
+    scan_paused = false;
+    scan_cache_time = xTaskGetTickCount() - pdMS_TO_TICKS(HTTP_SERVER_SCAN_INTERVAL_MS);
+    xTaskCreatePinnedToCore(&http_server_scan_thread, "http_server_scan",
+                            HTTP_SERVER_SCAN_TASK_STACK_SIZE, NULL,
+                            HTTP_SERVER_SCAN_TASK_PRIORITY, &task_http_server_scan,
+                            HTTP_SERVER_TASK_CORE_ID);
+
     return ESP_OK;
   }
 
@@ -357,6 +572,17 @@ void http_server_stop(void)
     ESP_LOGI(TAG, "http_server_stop: stopping HTTP server");
     http_server_handle = NULL;
   }
+  if (task_http_server_scan)
+  {
+    // The task finishes the current scan and deletes itself, it's only
+    // forgotten once gone so a restart can't race with it
+    scan_running = false;
+    esp_wifi_scan_stop();
+    xTaskNotifyGive(task_http_server_scan);
+    xSemaphoreTake(scan_task_exited, portMAX_DELAY);
+    task_http_server_scan = NULL;
+    ESP_LOGI(TAG, "http_server_stop: stopping network scan");
+  }
   if (task_http_server_monitor)
   {
     vTaskDelete(task_http_server_monitor);
@@ -365,6 +591,15 @@ void http_server_stop(void)
   }
 }
 
-void provision_set_status(int state) { provision_status = state; }
+void provision_set_status(int state)
+{
+  provision_status = state;
+
+  // Resume the background scan so the user can pick another network
+  if (state == PROVISION_FAILED)
+  {
+    scan_paused = false;
+  }
+}
 
 int provision_get_status(void) { return provision_status; }
\ No newline at end of file
@@ -0,0 +1,135 @@
+/**
+ * @file link_quality.c
+ * @brief
+ * This file contains the rolling window of the link quality samples: the RSSI
+ * of the access point, the TCP retransmissions and the MQTT round trips. The
+ * window drives the signal icon, the MQTT keepalive and timeouts, and is sent
+ * with the telemetry
+ *
+ *
+ * @version 2.1.2
+ * @date 2023-05-03
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "libs.h"
+
+#include "lwip/stats.h"
+
+static int8_t rssi_window[LINK_QUALITY_WINDOW];
+static uint32_t retransmit_window[LINK_QUALITY_WINDOW];
+static uint8_t rssi_count = 0;
+static uint8_t rssi_next = 0;
+
+static uint32_t rtt_window[LINK_QUALITY_WINDOW];
+static uint8_t rtt_count = 0;
+static uint8_t rtt_next = 0;
+
+// TCP retransmissions counted by lwIP at the last sample
+static uint32_t last_retransmits = 0;
+
+static portMUX_TYPE link_quality_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief
+ * TCP retransmissions since boot, 0 when lwIP does not keep statistics
+ *
+ */
+static uint32_t link_quality_retransmits(void) {
+#if LWIP_STATS && TCP_STATS
+  return lwip_stats.tcp.rexmit;
+#else
+  return 0;
+#endif
+}
+
+void link_quality_add_rssi(int8_t rssi) {
+  uint32_t retransmits = link_quality_retransmits();
+
+  portENTER_CRITICAL(&link_quality_lock);
+  rssi_window[rssi_next] = rssi;
+  retransmit_window[rssi_next] = retransmits - last_retransmits;
+  rssi_next = (rssi_next + 1) % LINK_QUALITY_WINDOW;
+  rssi_count = MIN(rssi_count + 1, LINK_QUALITY_WINDOW);
+  last_retransmits = retransmits;
+  portEXIT_CRITICAL(&link_quality_lock);
+}
+
+void link_quality_add_rtt(uint32_t rtt_ms) {
+  portENTER_CRITICAL(&link_quality_lock);
+  rtt_window[rtt_next] = rtt_ms;
+  rtt_next = (rtt_next + 1) % LINK_QUALITY_WINDOW;
+  rtt_count = MIN(rtt_count + 1, LINK_QUALITY_WINDOW);
+  portEXIT_CRITICAL(&link_quality_lock);
+}
+
+void link_quality_reset(void) {
+  uint32_t retransmits = link_quality_retransmits();
+
+  portENTER_CRITICAL(&link_quality_lock);
+  rssi_count = rssi_next = 0;
+  rtt_count = rtt_next = 0;
+  last_retransmits = retransmits;
+  portEXIT_CRITICAL(&link_quality_lock);
+}
+
+void link_quality_get_summary(struct link_quality_summary_t *summary) {
+  int rssi_sum = 0;
+  uint32_t rtt_sum = 0;
+
+  memset(summary, 0, sizeof(*summary));
+  summary->rssi_min = INT8_MAX;
+  summary->rssi_max = INT8_MIN;
+
+  portENTER_CRITICAL(&link_quality_lock);
+  summary->rssi_samples = rssi_count;
+  for (int i = 0; i < rssi_count; i++) {
+    rssi_sum += rssi_window[i];
+    summary->rssi_min = MIN(summary->rssi_min, rssi_window[i]);
+    summary->rssi_max = MAX(summary->rssi_max, rssi_window[i]);
+    summary->retransmits += retransmit_window[i];
+  }
+  summary->rtt_samples = rtt_count;
+  for (int i = 0; i < rtt_count; i++) {
+    rtt_sum += rtt_window[i];
+    summary->rtt_max_ms = MAX(summary->rtt_max_ms, rtt_window[i]);
+  }
+  portEXIT_CRITICAL(&link_quality_lock);
+
+  if (summary->rssi_samples == 0) {
+    summary->rssi_min = summary->rssi_max = 0;
+    return;
+  }
+  summary->rssi_avg = rssi_sum / summary->rssi_samples;
+  if (summary->rtt_samples > 0) {
+    summary->rtt_avg_ms = rtt_sum / summary->rtt_samples;
+  }
+
+  // Same thresholds as the single samples used to have, on the average
+  if (summary->rssi_avg > -50) {
+    summary->level = 3;
+  } else if (summary->rssi_avg > -70) {
+    summary->level = 2;
+  } else if (summary->rssi_avg > -90) {
+    summary->level = 1;
+  }
+}
+
+int link_quality_get_strength(void) {
+  struct link_quality_summary_t summary;
+
+  link_quality_get_summary(&summary);
+
+  if (summary.rssi_samples == 0 ||
+      summary.retransmits >= LINK_QUALITY_RETRANSMITS_WEAK ||
+      summary.rssi_avg <= LINK_QUALITY_RSSI_WEAK) {
+    return 0;
+  }
+  if (summary.rssi_avg >= LINK_QUALITY_RSSI_STRONG) {
+    return 100;
+  }
+  return (summary.rssi_avg - LINK_QUALITY_RSSI_WEAK) * 100 /
+         (LINK_QUALITY_RSSI_STRONG - LINK_QUALITY_RSSI_WEAK);
+}
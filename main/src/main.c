@@ -22,37 +22,95 @@ static const char *TAG = "MAIN";              // Tag for logging to the monitor
 SemaphoreHandle_t xGuiSemaphore;              // Semaphore variable for the GUI
 
 
+static TaskHandle_t ui_task = NULL;           // UI task, notified when the UI has work to do
+
+#if CONFIG_SR_TOUCH_IRQ_GPIO >= 0
+static lv_indev_t *touch_indev;               // Touch input device, not read while released
+static volatile bool touch_irq_pending;       // The touch controller signaled a touch
+
+
 /**
- * @name    lv_tick_task
- * @brief   Periodically updates the LVGL tick counter to maintain the internal time base.
+ * @name    touch_irq_isr
+ * @brief   Wakes the UI task when the touch controller signals a touch.
  * 
  * @param   arg   Pointer to user-provided data (unused).
- * 
- * @note    This function is intended to be called at regular intervals to ensure that the LVGL
- *          library keeps accurate timing for tasks like animations, input handling, and timeouts.
  */
-static void lv_tick_task(void *arg) {
+static void IRAM_ATTR touch_irq_isr(void *arg) {
+    BaseType_t woken = pdFALSE;
+
     (void)arg;
 
-    lv_tick_inc(LV_TICK_PERIOD_MS);
+    touch_irq_pending = true;
+    vTaskNotifyGiveFromISR(ui_task, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
 }
 
 
+/**
+ * @name    touch_irq_init
+ * @brief   Configures the touch controller interrupt input.
+ */
+static void touch_irq_init(void) {
+    gpio_config_t config = {
+                            .pin_bit_mask = 1ULL << CONFIG_SR_TOUCH_IRQ_GPIO,
+                            .mode         = GPIO_MODE_INPUT,
+                            .pull_up_en   = GPIO_PULLUP_ENABLE,
+                            .intr_type    = GPIO_INTR_NEGEDGE,
+                           };
+    gpio_config(&config);
+
+    // The service may already be installed by another driver
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err == ESP_OK || err == ESP_ERR_INVALID_STATE) {
+        gpio_isr_handler_add(CONFIG_SR_TOUCH_IRQ_GPIO, touch_irq_isr, NULL);
+    }
+}
+
+
+/**
+ * @name    touch_read_task_update
+ * @brief   Pauses the LVGL touch read task while the panel is released, and resumes it
+ *          when the touch controller interrupt fires.
+ * 
+ * @note    Must be called with the GUI semaphore taken.
+ */
+static void touch_read_task_update(void) {
+    lv_task_t *read_task = touch_indev->driver.read_task;
+
+    if (touch_irq_pending) {
+        touch_irq_pending = false;
+        lv_task_set_prio(read_task, LV_TASK_PRIO_HIGH);
+        lv_task_ready(read_task);
+    } else if (touch_indev->proc.state == LV_INDEV_STATE_REL &&
+               gpio_get_level(CONFIG_SR_TOUCH_IRQ_GPIO) == 1) {
+        // The interrupt line is low while touched, the release was already read
+        lv_task_set_prio(read_task, LV_TASK_PRIO_OFF);
+    }
+}
+#endif
+
+
 /**
  * @name    smart_ring_ui_touch_feedback
- * @brief   Detects press and release touches and activates corresponding smart ring UI flags.
+ * @brief   Detects press and release touches and posts the corresponding smart ring UI events.
  * 
  * @param   input_driver   Pointer to the input driver handling the touch events.
  * @param   event          Touch event.
  * 
- * @note    This function is used to handle touch feedback for the smart ring UI, setting the appropriate flags
- *          based on the detected touch events.
+ * @note    This function is used to handle touch feedback for the smart ring UI, it runs on the UI task
+ *          from `lv_task_handler` and the events are handled right after it.
  */
 static void smart_ring_ui_touch_feedback(struct _lv_indev_drv_t *input_driver,lv_event_t event) {
     if (event == LV_EVENT_PRESSED) {
-        smart_ring_ui_get_controller()->flags.flag.touch_pressed = true;
+        // Keep the radio at full power while the user interacts with the screen
+        wifi_power_activity();
+        struct smart_ring_ui_event_t pressed = {.type = UI_EVENT_TOUCH_PRESSED};
+        smart_ring_ui_post_event(&pressed);
     } else if (event == LV_EVENT_RELEASED) {
-        smart_ring_ui_get_controller()->flags.flag.touch_released = true;
+        struct smart_ring_ui_event_t released = {.type = UI_EVENT_TOUCH_RELEASED};
+        smart_ring_ui_post_event(&released);
     }
 }
 
@@ -65,19 +123,30 @@ static void smart_ring_ui_touch_feedback(struct _lv_indev_drv_t *input_driver,lv
  * 
  * @details This function initializes the LVGL graphics library and related hardware drivers
  *          (e.g., SPI or I2C for display and touch control). It sets up the LVGL display
- *          and input devices, creates a periodic timer for LVGL's tick increment, and starts
- *          the main loop to handle UI tasks.
+ *          and input devices and starts the main loop to handle UI tasks.
  * 
  *          Key steps include:
  *          - Initialization of the LVGL library and hardware drivers.
- *          - Allocation of display buffer memory and display buffer initialization.
+ *          - Allocation of the double display buffers, see display_init.
  *          - Setting up display and input drivers for LVGL.
- *          - Creating a periodic timer to call `lv_tick_task` for keeping LVGL timing accurate.
  *          - Running an infinite loop where the UI task (`lv_task_handler`) is executed while
  *            ensuring thread safety with a semaphore.
  * 
- *          The task will continuously check and process UI flags and interactions using LVGL
- *          and Smart Ring UI functions. Semaphore locking is used to ensure exclusive access
+ *          LVGL's tick is read from `esp_timer_get_time` (CONFIG_LV_TICK_CUSTOM), there is no
+ *          tick interrupt. Between two runs the task sleeps until the next LVGL task is due,
+ *          or a rate limited value held back by `smart_ring_ui_process_events`, or until it
+ *          is notified by `smart_ring_ui_post_event` or the touch interrupt. The sleep is
+ *          bounded by UI_TASK_MAX_SLEEP_MS.
+ * 
+ *          The display power manager dims the backlight when nothing is touched and puts the
+ *          panel to sleep on the sleep screen, see display_power_update. With the touch
+ *          interrupt (CONFIG_SR_TOUCH_IRQ_GPIO) `lv_task_handler` isn't run at all while the
+ *          panel sleeps, the task only wakes up for the posted events and the touch that
+ *          wakes the panel up. Without it LVGL keeps polling the touch.
+ * 
+ *          The task is the only one calling LVGL: the other tasks post events, which are
+ *          handled in order by `smart_ring_ui_process_events`, and the requests of the UI
+ *          are sent back to the main task. Semaphore locking is used to ensure exclusive access
  *          to LVGL functions when shared across threads.
  * 
  *          This function is designed to run indefinitely as part of a FreeRTOS task, and
@@ -89,64 +158,87 @@ static void ui_thread(void *param) {
     /* Create a mutex semaphore for synchronizing GUI access */
     xGuiSemaphore = xSemaphoreCreateMutex();
 
+    /* Let the other tasks and the touch interrupt wake the UI task */
+    ui_task = xTaskGetCurrentTaskHandle();
+    smart_ring_ui_set_task(ui_task);
+
     /* Initialize LVGL library */
     lv_init();
 
     /* Initialize SPI or I2C bus used by the drivers */
     lvgl_driver_init();
-
-    /* Allocate memory for the display buffer */
-    lv_color_t *buf1 = heap_caps_malloc(
-                                        DISP_BUF_SIZE * sizeof(lv_color_t), 
-                                        MALLOC_CAP_DMA
-                                       );
-    assert(buf1 != NULL);                                                              // Ensure that memory allocation was successful
-    static lv_color_t *buf2 = NULL;                                                    // Optional second buffer for double buffering
-
-    /* Initialize the display buffer */
-    static lv_disp_buf_t disp_buf;
-    uint32_t size_in_px = DISP_BUF_SIZE;
-    lv_disp_buf_init(&disp_buf, buf1, buf2, size_in_px);
+    display_power_init();                                                              // Dim the backlight and put the panel to sleep when idle
+    boot_profiler_mark("display drivers");
 
     /* Initialize the display driver */ 
     lv_disp_drv_init(&disp_drv);                                                                
-    disp_drv.flush_cb = disp_driver_flush;                                             // Set the function to flush the display buffer
-    disp_drv.buffer = &disp_buf;                                                       // Assign the display buffer to the driver
+    display_init(&disp_drv);                                                           // Allocate the double buffers and set the flush function
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+    perf_monitor_attach(lv_disp_drv_register(&disp_drv));                              // Register the display driver with LVGL, its refreshes timed in us
+#else
     lv_disp_drv_register(&disp_drv);                                                   // Register the display driver with LVGL
+#endif
 
     /* Initialize the input device driver */
     lv_indev_drv_init(&indev_drv);
     indev_drv.read_cb     = touch_driver_read;                                         // Set the function to read touch input
     indev_drv.type        = LV_INDEV_TYPE_POINTER;                                     // Set the input device type to pointer
     indev_drv.feedback_cb = smart_ring_ui_touch_feedback;                              // Set feedback callback for touch events
+#if CONFIG_SR_TOUCH_IRQ_GPIO >= 0
+    touch_indev = lv_indev_drv_register(&indev_drv);                                   // Register the input device driver with LVGL
+    touch_irq_init();                                                                  // Read the touch only once the controller signals it
+#else
     lv_indev_drv_register(&indev_drv);                                                 // Register the input device driver with LVGL
-
-    /* Create a periodic timer to call the LVGL tick increment function */
-    const esp_timer_create_args_t periodic_timer_args = {
-                                                         .callback = &lv_tick_task, 
-                                                         .name = "periodic_gui"
-                                                        };
-    esp_timer_handle_t periodic_timer;
-    ESP_ERROR_CHECK(esp_timer_create(&periodic_timer_args, &periodic_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(
-                                             periodic_timer, 
-                                             LV_TICK_PERIOD_MS * 1000
-                                            ));
+#endif
 
     /* Initialize the Smart Ring UI system */
     smart_ring_ui_init_system();
     ESP_LOGI(TAG, "SmartRing UI initialized.");
 
-    /* Main task loop to handle LVGL tasks and check UI flags */
+    /* Release the boot steps waiting for the UI */
+    boot_profiler_mark("ui ready");
+    boot_signal(BOOT_UI_READY_BIT);
+
+    /* Main task loop to handle LVGL tasks and the UI events */
     for (;;) {
-        vTaskDelay(pdMS_TO_TICKS(10));                                                 // Delay to prevent excessive CPU usage
+        uint32_t wait_ms = UI_TASK_MAX_SLEEP_MS;
+        bool paused = false;
 
         // Try to lock the semaphore; if successful, process LVGL tasks
         if (xSemaphoreTake(xGuiSemaphore, portMAX_DELAY)) {
-            lv_task_handler();                                                         // Handle LVGL tasks such as animations and input
-            smart_ring_ui_check_flags();                                               // Check and handle any Smart Ring UI flags
+            uint32_t value_ms = smart_ring_ui_process_events();                        // Handle the events posted to the UI, returns when a held back value is due
+            bool sleep_screen = smart_ring_ui_get_controller()->menu == MENU_ID_SLEEP;
+#if CONFIG_SR_TOUCH_IRQ_GPIO >= 0
+            // Nothing is drawn on the sleeping panel until a touch or the UI wakes it up
+            paused = display_power_is_asleep() && sleep_screen && !touch_irq_pending;
+#endif
+            uint32_t next_ms = UINT32_MAX;
+            if (!paused) {
+#if CONFIG_SR_TOUCH_IRQ_GPIO >= 0
+                touch_read_task_update();                                              // Read the touch only while it is pressed
+#endif
+                next_ms = lv_task_handler();                                           // Handle LVGL tasks, returns when the next one is due
+            }
+            uint32_t power_ms = display_power_update(sleep_screen);                    // Dim or sleep the display when idle, returns when it's due
             xSemaphoreGive(xGuiSemaphore);                                             // Release the semaphore
+
+            if (paused) {
+                wait_ms = UINT32_MAX;
+            }
+            if (next_ms < wait_ms) {
+                wait_ms = next_ms;
+            }
+            if (value_ms < wait_ms) {
+                wait_ms = value_ms;
+            }
+            if (power_ms < wait_ms) {
+                wait_ms = power_ms;
+            }
         }
+
+        // Sleep until the next LVGL task, a posted event or a touch, only woken up by them
+        // while the panel sleeps
+        ulTaskNotifyTake(pdTRUE, wait_ms == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms) + 1);
     }
 
     vTaskDelete(NULL);
@@ -162,9 +254,10 @@ static void ui_thread(void *param) {
  *          user interface, and configuring system parameters.
  *          Key tasks performed:
  *          - Load information from NVS storage.
- *          - Set up the communication interface (WiFi, GSM, LoRa).
+ *          - Set up the communication interface (WiFi, GSM, LoRa). A provisioned WiFi
+ *            interface is started here, so it associates while the UI draws the splash.
  *          - Update the Smart Ring UI system with necessary information.
- *          - Delay to allow for proper UI initialization.
+ *          - Wait for the UI thread to be initialized.
  */
 void initial_config() {
 
@@ -180,14 +273,19 @@ void initial_config() {
 
     /* Load information from NVS storage */
     nvs_flash_init();                           // Initialize NVS flash storage
+    nvs_settings_init();                        // Load the settings blob into RAM
     nvs_load_calibration();                     // Load sensor calibration data from NVS
     nvs_load_connection_type();                 // Load the type of connection (WiFi, GSM, LoRa) from NVS
     nvs_load_order_mode();                      // Load the order mode configuration from NVS
+    boot_profiler_mark("settings loaded");
 
     /* Initiate the Communication interface based on the connection type */
     switch (controller->connection.type) {
     case 'w':
         nvs_load_wifi_credentials();                            // Load WiFi credentials if the connection type is WiFi
+        if (controller->connection.is_provisioned) {
+            wifi_interface_start(&controller->connection);      // Associate while the UI initializes
+        }
         break;
     case 'g':
         // Placeholder for GSM connection initialization
@@ -199,6 +297,7 @@ void initial_config() {
         ESP_LOGE(TAG, "No communication type selected");        // Log an error if no valid communication type is selected
         break;
     }
+    boot_signal(BOOT_SETTINGS_LOADED_BIT);
 
     /* Get the UI controller for the smart ring */
     controller->ui_controller = smart_ring_ui_get_controller();
@@ -220,8 +319,10 @@ void initial_config() {
     /* Update the initial state of the UI */
     smart_ring_ui_update_state(STATE_0);
 
-    /* Allow for 5 seconds to guarantee the UI initialization */
-    vTaskDelay(5000 / portTICK_PERIOD_MS);
+    /* Wait for the UI thread to be initialized */
+    if (!boot_wait(BOOT_UI_READY_BIT, pdMS_TO_TICKS(BOOT_UI_READY_TIMEOUT_MS))) {
+        ESP_LOGE(TAG, "UI not ready after %d ms", BOOT_UI_READY_TIMEOUT_MS);
+    }
 
     /* Update the UI state based on the connection type */
     if (controller->connection.type != NULL) {
@@ -259,8 +360,8 @@ void heap_caps_alloc_failed_hook(size_t requested_size, uint32_t caps, const cha
  * 
  * @details This function sets up the core tasks needed to operate the smart ring. It registers a callback
  *          for handling heap allocation failures, initializes the UI thread, and creates other core threads
- *          such as the sensors and MQTT threads. It also manages flags for the smart ring and UI controllers
- *          in the main task loop.
+ *          such as the sensors and MQTT threads. The main task loop then handles the requests of the UI,
+ *          in the order they're sent.
  * 
  * @return  esp_err_t        Returns ESP_OK if the function executes successfully.
  */
@@ -269,12 +370,22 @@ esp_err_t app_main(void) {
     /* Register a callback function for heap allocation failures */
     esp_err_t error = heap_caps_register_failed_alloc_callback(heap_caps_alloc_failed_hook);
 
+    /* Start the boot timeline and the events the boot steps wait on */
+    boot_profiler_init();
+    wifi_events_init();
+    smart_ring_ui_events_init();
+
     /* Initialize the UI thread */
     // Note: The UI thread should not be on the same core as WiFi (core 0)
     xTaskCreatePinnedToCore(&ui_thread, "ui_thread", 4096, NULL, 10, NULL, 1);
 
     /* Perform initial configuration of the smart ring system */
     initial_config();
+    boot_profiler_mark("initial config");
+
+    /* Start the periodic jobs, in local time */
+    set_timezone();
+    scheduler_init();
 
     /* Create a task to handle sensor data for the smart ring */
     xTaskCreate(&smart_ring_sensors_task, "sensors_thread", 4098, NULL, 10, NULL);
@@ -288,33 +399,24 @@ esp_err_t app_main(void) {
     struct smart_ring_controller_t    *controller    = smart_ring_get_controller();
     struct smart_ring_ui_controller_t *ui_controller = controller->ui_controller;
 
-    /* Main task loop to manage smart ring and UI flags */ 
+    /* Main task loop to handle the requests of the UI */
     for (;;) {
-        if (ui_controller->flags.has_flags || controller->flags.has_flags) {
-            uiflag.startLogin(controller, ui_controller);                       // Handle user login process
-            uiflag.selectCommunication(controller, ui_controller);              // Handle communication type selection
-            uiflag.startCommunication(controller, ui_controller);               // Start communication process
-            uiflag.signIn(controller);                                          // Handle sign-in process
-            uiflag.changePin(controller);                                       // Handle PIN change request
-            uiflag.sendTicket(controller);                                      // Handle sending of a ticket
-            uiflag.changeStock(controller, ui_controller);                      // Handle stock changes
-            uiflag.popupPendingOrders(controller);                              // Display pending orders popup
-            uiflag.changeOrderMode(controller, ui_controller);                  // Change the order mode
-            uiflag.manageOrders(controller);                                    // Manage orders in the system
-            uiflag.resetDevice(controller);                                     // Reset the device
-            uiflag.resetWifi(controller);                                       // Reset WiFi settings
-            uiflag.updateFirmware(controller);                                  // Start firmware update
-            uiflag.updateFirmwareFailed(controller);                            // Handle firmware update failure
-            uiflag.updateFirmwareComplete(controller);                          // Handle firmware update completion
-            uiflag.startOrder(controller);                                      // Start a new order
-            uiflag.startCalibration(controller);                                // Start sensor calibration
-            uiflag.emptyCalibration(controller);                                // Handle empty calibration
-            uiflag.cancelCalibration(controller);                               // Cancel the calibration process
-            uiflag.confirmOrder(controller);                                    // Confirm an order
+        enum smart_ring_ui_request_t request;
+        bool main_screen_shown = boot_wait(BOOT_MAIN_SCREEN_BIT, 0);
+
+        /* Close the boot timeline when the main screen is first shown */
+        if (!main_screen_shown && ui_controller->state == STATE_5) {
+            boot_profiler_mark("main screen");
+            boot_signal(BOOT_MAIN_SCREEN_BIT);
+            boot_profiler_print();
+            main_screen_shown = true;
         }
 
-        /* Delay to prevent excessive CPU usage */
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        // Until then the state is checked every 100 ms, the requests wake the task afterwards
+        TickType_t wait = main_screen_shown ? portMAX_DELAY : pdMS_TO_TICKS(100);
+        if (smart_ring_ui_receive_request(&request, wait)) {
+            uiflag_handle_request(controller, request);
+        }
     }
     return ESP_OK; 
 }
@@ -30,6 +30,12 @@
 static const char *TAG = "MQTT";
 enum mqtt_message_type_t resend_mqtt_message;
 
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+// Frame times of the last UI performance report, kept for a resend
+static struct perf_summary_t mqtt_ui_perf[PERF_REPORT_MENUS];
+static int mqtt_ui_perf_count = 0;
+#endif
+
 static IoT_Error_t
 publish(AWS_IoT_Client *pubClient, const char *topic, char *msg, uint8_t ret, int QOS)
 {
@@ -75,11 +81,17 @@ publish(AWS_IoT_Client *pubClient, const char *topic, char *msg, uint8_t ret, in
     // Try to publish the message
     do
     {
+      int64_t start = esp_timer_get_time();
       err_mqtt = aws_iot_mqtt_publish(pubClient, topic, topic_len, &params);
       retries++;
 #ifdef NDEBUG
       ESP_LOGI(TAG, "Message published : %d", err_mqtt);
 #endif
+
+      // A QOS1 publish returns with the broker acknowledge, so its duration is
+      // the round trip of the link
+      if (SUCCESS == err_mqtt && QOS1 == params.qos)
+        link_quality_add_rtt((uint32_t)((esp_timer_get_time() - start) / 1000));
     } while (SUCCESS != err_mqtt && retries < 2);
   }
   else
@@ -148,8 +160,8 @@ IoT_Error_t mqtt_send_message(enum mqtt_message_type_t type)
     break;
   case SEND_STOCK:
     sprintf(topic, "d/%s/stock", smart_ring_get_mac_address());
-    sprintf(message, controller->ui_controller->flags.flag.update_stock_manual ? "{\"au\":%d}" : "{\"mu\":%d}", controller->ui_controller->updated_stock); // au means automatic update when bottle is replaced
-    controller->ui_controller->flags.flag.update_stock_manual = false;                                                                                     // mu means manual update is when stock is updated maually
+    sprintf(message, controller->ui_controller->flags.update_stock_manual ? "{\"au\":%d}" : "{\"mu\":%d}", controller->ui_controller->updated_stock); // au means automatic update when bottle is replaced
+    controller->ui_controller->flags.update_stock_manual = false;                                                                                     // mu means manual update is when stock is updated maually
     break;
   case SEND_ALERT_CHNGGALLON:
     sprintf(topic, "d/%s/change", smart_ring_get_mac_address());
@@ -176,6 +188,59 @@ IoT_Error_t mqtt_send_message(enum mqtt_message_type_t type)
     sprintf(topic, "d/%s/version", smart_ring_get_mac_address());
     sprintf(message, "%s", FIRMWARE_VERSION);
     break;
+  case SEND_LINK_QUALITY:
+  {
+    struct link_quality_summary_t summary;
+    link_quality_get_summary(&summary);
+    sprintf(topic, "d/%s/lq", smart_ring_get_mac_address());
+    sprintf(message, "{\"r\":%d,\"rn\":%d,\"rx\":%d,\"tr\":%u,\"t\":%u,\"tx\":%u,\"k\":%u}",
+            summary.rssi_avg, summary.rssi_min, summary.rssi_max,
+            summary.retransmits, summary.rtt_avg_ms, summary.rtt_max_ms,
+            controller->connection.mqtt_controller.client.clientData.keepAliveInterval);
+    break;
+  }
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+  case SEND_UI_PERF:
+  {
+    uint8_t used = 0, frag = 0;
+    uint32_t biggest = UINT32_MAX;
+    for (int i = 0; i < mqtt_ui_perf_count; i++)
+    {
+      used = MAX(used, mqtt_ui_perf[i].mem_used_pct);
+      frag = MAX(frag, mqtt_ui_perf[i].mem_frag_pct);
+      biggest = MIN(biggest, mqtt_ui_perf[i].mem_biggest_free);
+    }
+
+    sprintf(topic, "d/%s/uip", smart_ring_get_mac_address());
+    int len = sprintf(message, "{\"u\":%u,\"g\":%u,\"b\":%u,\"m\":[", used, frag,
+                      mqtt_ui_perf_count ? biggest : 0);
+    // The slowest menus are first, the ones that don't fit are left out
+    for (int i = 0; i < mqtt_ui_perf_count && len < (int)sizeof(message) - 64; i++)
+    {
+      len += snprintf(message + len, sizeof(message) - len, "%s[%u,%u,%u,%u,%u,%u,%u]", i ? "," : "",
+                      mqtt_ui_perf[i].menu, mqtt_ui_perf[i].frames,
+                      mqtt_ui_perf[i].render_avg_us, mqtt_ui_perf[i].render_max_us,
+                      mqtt_ui_perf[i].flush_avg_us, mqtt_ui_perf[i].flush_max_us,
+                      mqtt_ui_perf[i].area_avg_px);
+    }
+    snprintf(message + len, sizeof(message) - len, "]}");
+    break;
+  }
+#endif
+  case SEND_SETTINGS_WEAR:
+  {
+    struct smart_ring_settings_counters_t counters;
+    nvs_settings_get_counters(&counters);
+    sprintf(topic, "d/%s/sw", smart_ring_get_mac_address());
+    int len = sprintf(message, "{\"k\":[");
+    for (int key = 0; key < SETTINGS_KEY_MAX; key++)
+    {
+      len += snprintf(message + len, sizeof(message) - len, "%s[%u,%u]", key ? "," : "",
+                      counters.requests[key], counters.writes[key]);
+    }
+    snprintf(message + len, sizeof(message) - len, "]}");
+    break;
+  }
   default:
     ESP_LOGE(TAG, "Invalid MQTT message type");
     break;
@@ -192,6 +257,150 @@ IoT_Error_t mqtt_send_message(enum mqtt_message_type_t type)
   return pub_error;
 }
 
+/**
+ * @brief
+ * Adapt the client to the link quality. The keepalive negotiated with the
+ * broker stays the longest one, the client only pings sooner on a weak link,
+ * and the timeout of the outgoing packets follows the measured round trip
+ *
+ * @param client MQTT client handle
+ */
+static void mqtt_adapt_to_link(AWS_IoT_Client *client)
+{
+  struct link_quality_summary_t summary;
+  uint32_t timeout_ms = MQTT_COMMAND_TIMEOUT_MAX_MS;
+  uint16_t keepalive;
+
+  keepalive = MQTT_KEEPALIVE_MIN_SEC +
+              (MQTT_KEEPALIVE_MAX_SEC - MQTT_KEEPALIVE_MIN_SEC) * link_quality_get_strength() / 100;
+
+  link_quality_get_summary(&summary);
+  if (summary.rtt_samples > 0)
+  {
+    timeout_ms = summary.rtt_max_ms * MQTT_COMMAND_TIMEOUT_RTT_FACTOR;
+    if (timeout_ms < MQTT_COMMAND_TIMEOUT_MIN_MS)
+      timeout_ms = MQTT_COMMAND_TIMEOUT_MIN_MS;
+    else if (timeout_ms > MQTT_COMMAND_TIMEOUT_MAX_MS)
+      timeout_ms = MQTT_COMMAND_TIMEOUT_MAX_MS;
+  }
+
+#ifndef NDEBUG
+  if (keepalive != client->clientData.keepAliveInterval || timeout_ms != client->clientData.commandTimeoutMs)
+    ESP_LOGI(TAG, "Link adapted, keepalive %ds, command timeout %ums", keepalive, timeout_ms);
+#endif
+
+  client->clientData.keepAliveInterval = keepalive;
+  client->clientData.commandTimeoutMs = timeout_ms;
+}
+
+/**
+ * @brief
+ * Scheduler job asking the backend for the latest firmware version
+ *
+ * @param arg Not used
+ */
+static void mqtt_version_check_job(void *arg)
+{
+  ESP_LOGI(TAG, "Sending message with device version...");
+  mqtt_send_message(SEND_REQUEST_LATESTVERSION);
+}
+
+/**
+ * @brief
+ * Scheduler job sending the link quality summary
+ *
+ * @param arg Not used
+ */
+static void mqtt_link_quality_job(void *arg)
+{
+  if (aws_iot_mqtt_is_client_connected(&smart_ring_get_controller()->connection.mqtt_controller.client))
+  {
+    mqtt_send_message(SEND_LINK_QUALITY);
+  }
+}
+
+/**
+ * @brief
+ * Scheduler job sending the settings change counters
+ *
+ * @param arg Not used
+ */
+static void mqtt_settings_wear_job(void *arg)
+{
+  if (aws_iot_mqtt_is_client_connected(&smart_ring_get_controller()->connection.mqtt_controller.client))
+  {
+    mqtt_send_message(SEND_SETTINGS_WEAR);
+  }
+}
+
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+/**
+ * @brief
+ * Scheduler job printing the frame times of the menus, and sending the ones
+ * of the slowest menus since the last report
+ *
+ * @param arg Not used
+ */
+static void mqtt_ui_perf_job(void *arg)
+{
+  perf_print();
+
+  if (aws_iot_mqtt_is_client_connected(&smart_ring_get_controller()->connection.mqtt_controller.client))
+  {
+    mqtt_ui_perf_count = perf_get_summaries(mqtt_ui_perf, PERF_REPORT_MENUS, true);
+    if (mqtt_ui_perf_count > 0)
+    {
+      mqtt_send_message(SEND_UI_PERF);
+    }
+  }
+}
+#endif
+
+/**
+ * @brief
+ * Register the periodic messages in the scheduler, once the client is
+ * connected for the first time
+ *
+ */
+static void mqtt_schedule_jobs(void)
+{
+  static bool scheduled = false;
+
+  if (scheduled)
+    return;
+  scheduled = true;
+
+  // Firmware version check every day at 8h30
+  const struct scheduler_rule_t version_rule = {
+      .hours = SCHEDULER_HOUR(8),
+      .minute = 30,
+      .weekdays = SCHEDULER_EVERY_DAY,
+  };
+  scheduler_add(MQTT_VERSION_CHECK_JOB, &version_rule, mqtt_version_check_job, NULL);
+
+  const struct scheduler_rule_t link_quality_rule = {
+      .monotonic = true,
+      .period_s = MQTT_LINK_QUALITY_INTERVAL_S,
+  };
+  scheduler_add(MQTT_LINK_QUALITY_JOB, &link_quality_rule, mqtt_link_quality_job, NULL);
+
+  // Settings wear every day at 3h00, the counters change slowly
+  const struct scheduler_rule_t settings_wear_rule = {
+      .hours = SCHEDULER_HOUR(3),
+      .minute = 0,
+      .weekdays = SCHEDULER_EVERY_DAY,
+  };
+  scheduler_add(MQTT_SETTINGS_WEAR_JOB, &settings_wear_rule, mqtt_settings_wear_job, NULL);
+
+#ifdef CONFIG_SR_UI_PERF_MONITOR
+  const struct scheduler_rule_t ui_perf_rule = {
+      .monotonic = true,
+      .period_s = MQTT_UI_PERF_INTERVAL_S,
+  };
+  scheduler_add(MQTT_UI_PERF_JOB, &ui_perf_rule, mqtt_ui_perf_job, NULL);
+#endif
+}
+
 static void mqtt_subscribe_to_topics(void)
 {
   struct smart_ring_controller_t *controller = smart_ring_get_controller();
@@ -424,7 +633,7 @@ static void mqtt_subscribed_handler(AWS_IoT_Client *client, char *received_topic
     mqtt_subscribe_to_group_topics();
 
     // Register the current water level
-    controller->ui_controller->flags.flag.register_water_level = true;
+    controller->ui_controller->flags.register_water_level = true;
     cJSON_Delete(payload_json);
 
     return;
@@ -479,7 +688,7 @@ static void mqtt_subscribed_handler(AWS_IoT_Client *client, char *received_topic
       ESP_LOGI(TAG, "Confirmation Validation data received is failed - payload: %c\n\n", payload[1]);
 #endif
     }
-    controller->ui_controller->flags.flag.order_confirmed_response = true;
+    controller->ui_controller->flags.order_confirmed_response = true;
   }
 
   // PIN validation
@@ -610,7 +819,9 @@ static void mqtt_subscribed_handler(AWS_IoT_Client *client, char *received_topic
       smart_ring_set_stock(item->valueint);
     }
 
-    // Change state if on boot screen
+    // Change state if on boot screen, or let the boot screens move on when
+    // the configuration arrives before them
+    boot_signal(BOOT_CONFIG_RECEIVED_BIT);
     if (smart_ring_ui_get_controller()->state == STATE_4)
     {
       smart_ring_ui_update_state(STATE_5);
@@ -618,6 +829,62 @@ static void mqtt_subscribed_handler(AWS_IoT_Client *client, char *received_topic
     cJSON_Delete(payload_json);
   }
 
+  // Schedule of the periodic messages
+  // {"<job>":{"h":[<hours>],"m":<minute>,"d":<weekdays>}} or {"<job>":{"p":<period s>}}
+  sprintf(topic_to_compare, "%s/sch", topic_prefix);
+  if (strcmp(topic, topic_to_compare) == TOPIC_OK)
+  {
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "Schedule received");
+#endif
+    cJSON *payload_json = cJSON_Parse(payload);
+    if (payload_json == NULL)
+    {
+      const char *error_ptr = cJSON_GetErrorPtr();
+      if (error_ptr != NULL)
+      {
+        ESP_LOGE(TAG, "Error parsing JSON object : %s", error_ptr);
+      }
+      return;
+    }
+
+    const cJSON *job = NULL;
+    cJSON_ArrayForEach(job, payload_json)
+    {
+      struct scheduler_rule_t rule = {.weekdays = SCHEDULER_EVERY_DAY};
+      const cJSON *item = cJSON_GetObjectItemCaseSensitive(job, "p");
+
+      if (cJSON_IsNumber(item))
+      {
+        rule.monotonic = true;
+        rule.period_s = item->valueint > 0 ? item->valueint : 0;
+      }
+      else
+      {
+        const cJSON *hour = NULL;
+        item = cJSON_GetObjectItemCaseSensitive(job, "h");
+        cJSON_ArrayForEach(hour, item)
+        {
+          if (cJSON_IsNumber(hour) && hour->valueint >= 0 && hour->valueint < 24)
+            rule.hours |= SCHEDULER_HOUR(hour->valueint);
+        }
+
+        item = cJSON_GetObjectItemCaseSensitive(job, "m");
+        if (cJSON_IsNumber(item) && item->valueint >= 0 && item->valueint < 60)
+          rule.minute = item->valueint;
+
+        item = cJSON_GetObjectItemCaseSensitive(job, "d");
+        if (cJSON_IsNumber(item))
+          rule.weekdays = item->valueint & SCHEDULER_EVERY_DAY;
+      }
+
+      if (job->string != NULL && scheduler_set_rule(job->string, &rule, true) != ESP_OK)
+        ESP_LOGE(TAG, "Invalid schedule job '%s'", job->string);
+    }
+
+    cJSON_Delete(payload_json);
+  }
+
   // Order list
   sprintf(topic_to_compare, "%s/o/list", topic_prefix);
   if (strcmp(topic, topic_to_compare) == TOPIC_OK)
@@ -664,11 +931,7 @@ static void mqtt_subscribed_handler(AWS_IoT_Client *client, char *received_topic
         smart_ring_ui_update_state(STATE_18);
       }
 
-      // Check by menu, becuase state can state before object is created
-      if (controller->ui_controller->menu == MENU_ID_MAIN)
-      {
-        smart_ring_ui_main_clear_next_eta();
-      }
+      smart_ring_ui_update_deliveries();
 
       if (controller->ui_controller->state == STATE_35)
       {
@@ -750,17 +1013,7 @@ static void mqtt_subscribed_handler(AWS_IoT_Client *client, char *received_topic
     controller->ui_controller->number_of_deliveries = pointer;
 
     // Set the next delivery to be delivered
-    if (controller->ui_controller->state == STATE_5)
-    {
-      if (pointer > 0)
-      {
-        smart_ring_ui_main_update_next_eta();
-      }
-      else
-      {
-        smart_ring_ui_main_clear_next_eta();
-      }
-    }
+    smart_ring_ui_update_deliveries();
 
     esp_timer_stop(controller->ui_controller->timer);
     if (controller->ui_controller->state == STATE_35)
@@ -833,7 +1086,7 @@ static void mqtt_subscribed_handler(AWS_IoT_Client *client, char *received_topic
                controller->ui_controller->order.price);
 #endif
 
-      smart_ring_ui_order_update_review_data(controller->ui_controller->order.price);
+      smart_ring_ui_set_order_price(controller->ui_controller->order.price);
       cJSON_Delete(payload_json);
     }
   }
@@ -879,27 +1132,28 @@ static void mqtt_disconnect_handler(AWS_IoT_Client *client, void *data)
 
 void mqtt_aws_thread(void *param)
 {
+  char *certificatePem = (char *)calloc(2000, sizeof(char));
+  char *privateKey = (char *)calloc(2000, sizeof(char));
+
+  // Load the credentials while the WiFi associates
+  bool has_certificate = nvs_load_temporary_mqtt_certificate_pem(certificatePem) == ESP_OK;
+  if (has_certificate && spiffs.loadMQTTCertificatePrivateKey(privateKey, 2000) != ESP_OK)
+    ESP_LOGE(TAG, "Failed to load the MQTT private key");
+  boot_profiler_mark("mqtt credentials");
 
-  while (!smart_ring_get_controller()->connection.is_connected)
-  {
 #ifndef NDEBUG
-    ESP_LOGI(TAG, "WiFi not connected");
+  ESP_LOGI(TAG, "Waiting for the WiFi connection");
 #endif
-    vTaskDelay(1000 / portTICK_PERIOD_MS);
-  }
-
-  char *certificatePem = (char *)calloc(2000, sizeof(char));
-  char *privateKey = (char *)calloc(2000, sizeof(char));
+  wifi_wait_connected(portMAX_DELAY);
 
-  if (nvs_load_temporary_mqtt_certificate_pem(certificatePem) != ESP_OK)
+  if (!has_certificate)
   {
-    boot_update_warning_label("  A configurar o MQTT");
+    smart_ring_ui_set_boot_warning("  A configurar o MQTT");
     smart_ring_http_client_get_certificate();
-    boot_update_warning_label("A reiniciar...");
+    smart_ring_ui_set_boot_warning("A reiniciar...");
     vTaskDelay(2000 / portTICK_PERIOD_MS);
     esp_restart();
   }
-  spiffs.loadMQTTCertificatePrivateKey(privateKey);
 
 #ifndef NDEBUG
   printf("----  NVS Certificate ------ \n%s", certificatePem);
@@ -922,7 +1176,7 @@ void mqtt_aws_thread(void *param)
   mqtt_init_config.pRootCALocation = (const char *)aws_root_ca_pem_start;
   mqtt_init_config.pDeviceCertLocation = (const char *)certificatePem;
   mqtt_init_config.pDevicePrivateKeyLocation = (const char *)privateKey;
-  mqtt_init_config.mqttCommandTimeout_ms = 20000;
+  mqtt_init_config.mqttCommandTimeout_ms = MQTT_COMMAND_TIMEOUT_MAX_MS;
   mqtt_init_config.tlsHandshakeTimeout_ms = 5000;
   mqtt_init_config.isSSLHostnameVerify = true;
   mqtt_init_config.disconnectHandlerData = NULL;
@@ -964,7 +1218,7 @@ void mqtt_aws_thread(void *param)
   char client_id[100];
   sprintf(client_id, "%s%s", CLIENT_ID_PREFIX, smart_ring_get_mac_address());
 
-  mqtt_connect_config.keepAliveIntervalInSec = 60;
+  mqtt_connect_config.keepAliveIntervalInSec = MQTT_KEEPALIVE_MAX_SEC;
   mqtt_connect_config.isCleanSession = true;
   mqtt_connect_config.MQTTVersion = MQTT_3_1_1;
   mqtt_connect_config.pClientID = client_id;
@@ -972,7 +1226,7 @@ void mqtt_aws_thread(void *param)
   mqtt_connect_config.isWillMsgPresent = true;
   mqtt_connect_config.will = last_will_options;
 
-  boot_update_warning_label("A conectar ao servidor");
+  smart_ring_ui_set_boot_warning("A conectar ao servidor");
 
 #ifndef NDEBUG
   ESP_LOGI(TAG, "Connection parameters configured");
@@ -1026,19 +1280,18 @@ void mqtt_aws_thread(void *param)
 
   if (retries < 3)
   {
-    boot_update_warning_label("A obter configurações");
+    boot_profiler_mark("mqtt connected");
+    smart_ring_ui_set_boot_warning("A obter configurações");
     mqtt_subscribe_to_topics(); // CHECK #1
 
     // Get controller for flags
     struct smart_ring_controller_t *controller = smart_ring_get_controller();
 
-    initialize_sntp();
-    wait_for_sntp_sync();
-    set_timezone();
+    mqtt_schedule_jobs();
   }
   else
   {
-    boot_update_warning_label("Erro de conexão");
+    smart_ring_ui_set_boot_warning("Erro de conexão");
     vTaskDelay(2000 / portTICK_PERIOD_MS);
     smart_ring_ui_update_state(STATE_5);
   }
@@ -1048,7 +1301,6 @@ void mqtt_aws_thread(void *param)
 
   ClientState client_state;
   bool client_connected_state;
-  static TickType_t lastTimePercCheck = 0;
   struct smart_ring_controller_t *controller = smart_ring_get_controller();
 
   for (;;)
@@ -1070,19 +1322,9 @@ void mqtt_aws_thread(void *param)
     } 
     
 
-    if (xTaskGetTickCount() - lastTimePercCheck >= TIME_VERSION_INTERVAL)
+    if (client_connected_state)
     {
-      ESP_LOGI(TAG, "Checking time for VersionCheck");
-
-      // Verify if it is time to send version check message
-      if (versionCheck(controller))
-      {
-        ESP_LOGI(TAG, "Sending message with device version...");
-        mqtt_send_message(SEND_REQUEST_LATESTVERSION);
-        controller->flags.flag.sent_version_check_message = true;
-      }
-
-      lastTimePercCheck = xTaskGetTickCount(); // Update the last checked time
+      mqtt_adapt_to_link(&mqtt_controller->client);
     }
 
     if (NETWORK_ATTEMPTING_RECONNECT == err_mqtt)
@@ -1092,7 +1334,7 @@ void mqtt_aws_thread(void *param)
       continue;
     }
 
-    vTaskDelay(1000 / portTICK_RATE_MS);
+    vTaskDelay(pdMS_TO_TICKS(MQTT_LOOP_PERIOD_MS));
   }
 
   ESP_LOGE(TAG, "Error ocurred in the mqtt loop");
@@ -14,426 +14,823 @@
  */
 
 #include "libs.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+
+_Static_assert(SETTINGS_KEY_MAX <= NVS_SETTINGS_COUNTER_SLOTS,
+               "The settings counters have no slot left for the new keys");
 
 // Tag for logging to the monitor
 static const char *TAG = "NVS";
 
-//
-// Save WIFI credentials to NVS
-//
-esp_err_t nvs_save_wifi_credentials(char *ssid, char *password, bool provisioned) {
+// Settings shadow, the copy in RAM of the settings blob
+static struct smart_ring_settings_t settings;
 
-  nvs_handle handle;
-  esp_err_t err;
+// Mutex protecting the shadow and the dirty state
+static SemaphoreHandle_t settings_mutex = NULL;
 
-  ESP_LOGI(TAG, "Saving WiFi credentials to flash");
+// Keys changed in the shadow and not on flash yet (bit per key)
+static uint32_t settings_dirty_keys = 0;
 
-  err = nvs_open("wifi", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"wifi\" space : %s", esp_err_to_name(err));
-    return err;
-  }
+// Serializes the flash writes, held without the settings mutex so the
+// nvs_save functions never wait for the flash
+static SemaphoreHandle_t settings_commit_mutex = NULL;
 
-  // Set SSID
-  err = nvs_set_str(handle, "ssid", ssid);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"ssid\" information : %s",
-             esp_err_to_name(err));
-    return err;
-  }
+// Queue of write intents for the persistence task
+static QueueHandle_t settings_queue = NULL;
 
-  // Set Password
-  err = nvs_set_str(handle, "password", password);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"password\" information : %s",
-             esp_err_to_name(err));
-    return err;
-  }
+/**
+ * @brief
+ * Write intent sent to the persistence task
+ *
+ */
+struct smart_ring_settings_intent_t {
+  /// Changed key
+  enum smart_ring_settings_key_t key;
+  /// Write without waiting for more changes
+  bool urgent;
+};
 
-  // Set the device as provisioned
-  err = nvs_set_u8(handle, "provisioned", provisioned);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"provisioned\" information : %s",
-             esp_err_to_name(err));
-    return err;
+/**
+ * @brief
+ * Mark a key as changed and let the persistence task know. Must be called with
+ * the settings mutex taken.
+ *
+ */
+static void nvs_settings_mark_dirty(enum smart_ring_settings_key_t key,
+                                    bool urgent) {
+  struct smart_ring_settings_intent_t intent = {.key = key, .urgent = urgent};
+
+  settings_dirty_keys |= 1 << key;
+  settings.counters.requests[key]++;
+
+  // If the queue is full the change is still written with the next flush
+  if (settings_queue != NULL) {
+    xQueueSend(settings_queue, &intent, 0);
   }
+}
 
-  // Commit credentials to NVS
-  err = nvs_commit(handle);
+/**
+ * @brief
+ * Find a stored network. Must be called with the settings mutex taken.
+ *
+ */
+static struct smart_ring_settings_wifi_network_t *
+nvs_settings_find_network(const char *ssid) {
+  for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+    if (settings.networks[i].ssid[0] != '\0' &&
+        strncmp(settings.networks[i].ssid, ssid,
+                sizeof(settings.networks[i].ssid)) == 0) {
+      return &settings.networks[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief
+ * Compare the connection history of two stored networks, as their share of
+ * successes ranks them on failover.
+ *
+ * @return 1 if a has the better history, -1 if b has, 0 if they're equal
+ */
+static int8_t nvs_settings_compare_history(
+    const struct smart_ring_settings_wifi_network_t *a,
+    const struct smart_ring_settings_wifi_network_t *b) {
+  uint32_t share_a = (uint32_t)a->successes * (b->successes + b->failures + 1);
+  uint32_t share_b = (uint32_t)b->successes * (a->successes + a->failures + 1);
+
+  return share_a > share_b ? 1 : share_a < share_b ? -1 : 0;
+}
+
+/**
+ * @brief
+ * Add or update a stored network, with a priority above the others. When full,
+ * the network with the worst history is replaced. Must be called with the
+ * settings mutex taken.
+ *
+ */
+static void nvs_settings_store_network(const char *ssid, const char *password) {
+  struct smart_ring_settings_wifi_network_t *entry =
+      nvs_settings_find_network(ssid);
+  uint8_t priority = 0;
+
+  for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+    struct smart_ring_settings_wifi_network_t *network = &settings.networks[i];
+
+    if (network->ssid[0] == '\0') {
+      if (entry == NULL) {
+        entry = network;
+      }
+      continue;
+    }
+    priority = MAX(priority, network->priority);
+  }
+
+  if (entry == NULL) {
+    entry = &settings.networks[0];
+    for (int i = 1; i < NVS_WIFI_MAX_NETWORKS; i++) {
+      struct smart_ring_settings_wifi_network_t *network = &settings.networks[i];
+      int score = network->successes - network->failures;
+      int worst = entry->successes - entry->failures;
+
+      if (score < worst ||
+          (score == worst && network->priority < entry->priority)) {
+        entry = network;
+      }
+    }
+  }
+
+  // Keep room above the highest priority
+  if (priority == UINT8_MAX) {
+    for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+      if (settings.networks[i].priority > 0) {
+        settings.networks[i].priority--;
+      }
+    }
+    priority--;
+  }
+
+  if (strncmp(entry->ssid, ssid, sizeof(entry->ssid)) != 0) {
+    memset(entry, 0, sizeof(*entry));
+    strlcpy(entry->ssid, ssid, sizeof(entry->ssid));
+  }
+  strlcpy(entry->password, password, sizeof(entry->password));
+  entry->priority = priority + 1;
+}
+
+/**
+ * @brief
+ * Write the given settings as a single blob
+ *
+ */
+static esp_err_t nvs_settings_write(const struct smart_ring_settings_t *values) {
+  nvs_handle_t handle;
+  esp_err_t err;
+
+  struct smart_ring_settings_blob_t blob = {
+      .version = NVS_SETTINGS_VERSION,
+      .length = sizeof(struct smart_ring_settings_t),
+      .crc = esp_rom_crc32_le(0, (const uint8_t *)values,
+                              sizeof(struct smart_ring_settings_t)),
+      .settings = *values,
+  };
+
+  err = nvs_open(NVS_SETTINGS_NAMESPACE, NVS_READWRITE, &handle);
   if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error commiting \"wifi\" changes : %s",
-             esp_err_to_name(err));
+    ESP_LOGE(TAG, "Error opening nvs \"%s\" space : %s",
+             NVS_SETTINGS_NAMESPACE, esp_err_to_name(err));
     return err;
   }
 
+  err = nvs_set_blob(handle, NVS_SETTINGS_KEY, &blob, sizeof(blob));
+  if (err == ESP_OK) {
+    err = nvs_commit(handle);
+  }
   nvs_close(handle);
 
-  ESP_LOGI(TAG, "Successfully stored \"wifi\" credentials");
-  return ESP_OK;
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error storing settings : %s", esp_err_to_name(err));
+  }
+  return err;
 }
 
-//
-// Load WIFI credentials to NVS
-//
-esp_err_t nvs_load_wifi_credentials(void) {
-  nvs_handle handle;
+/**
+ * @brief
+ * Read the settings blob. Fields are only appended to the layout, so blobs
+ * written by an older firmware are a prefix of the current settings and the
+ * remaining fields keep their defaults, and blobs written by a newer firmware
+ * (after an OTA rollback) are read up to the fields this one knows.
+ *
+ */
+static esp_err_t nvs_settings_read(struct smart_ring_settings_t *values) {
+  nvs_handle_t handle;
   esp_err_t err;
+  size_t size = 0;
 
-  struct smart_ring_controller_t *controller = smart_ring_get_controller();
-
-  ESP_LOGI(TAG, "Loading WiFi credentials from flash");
-
-  err = nvs_open("wifi", NVS_READONLY, &handle);
+  err = nvs_open(NVS_SETTINGS_NAMESPACE, NVS_READONLY, &handle);
   if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"wifi\" space : %s",
-             esp_err_to_name(err));
     return err;
   }
 
-  // Load SSID
-  size_t required_size;
-  err = nvs_get_str(handle, "ssid", NULL, &required_size);
+  // Sized by the firmware that wrote it
+  err = nvs_get_blob(handle, NVS_SETTINGS_KEY, NULL, &size);
+  struct smart_ring_settings_blob_t *blob = err == ESP_OK ? malloc(size) : NULL;
+  if (err == ESP_OK && blob == NULL) {
+    err = ESP_ERR_NO_MEM;
+  }
+  if (err == ESP_OK) {
+    err = nvs_get_blob(handle, NVS_SETTINGS_KEY, blob, &size);
+  }
+  nvs_close(handle);
 
   if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"ssid\" size : %s", esp_err_to_name(err));
+    free(blob);
     return err;
   }
 
-  char *SavedData = malloc(required_size);
-  err = nvs_get_str(handle, "ssid", SavedData, &required_size);
-  if (err != ESP_OK) {
-    free(SavedData);
-    ESP_LOGE(TAG, "Error retrieving \"ssid\" information");
-    return err;
+  size_t header = offsetof(struct smart_ring_settings_blob_t, settings);
+  if (size < header || blob->length != size - header) {
+    ESP_LOGE(TAG, "Invalid settings blob (version %d, %d bytes)",
+             size < header ? 0 : blob->version, size);
+    free(blob);
+    return ESP_ERR_INVALID_SIZE;
   }
 
-  strcpy(&controller->connection.wifi_controller.ssid, SavedData);
+  if (esp_rom_crc32_le(0, (const uint8_t *)&blob->settings, blob->length) !=
+      blob->crc) {
+    ESP_LOGE(TAG, "Settings blob CRC mismatch");
+    free(blob);
+    return ESP_ERR_INVALID_CRC;
+  }
 
-  ESP_LOGI(TAG, "Successfully retrieved \"ssid\" information");
+  if (blob->version > NVS_SETTINGS_VERSION) {
+    ESP_LOGW(TAG, "Settings blob of a newer firmware (version %d), reading "
+                  "the known fields", blob->version);
+  }
+  memcpy(values, &blob->settings,
+         MIN(blob->length, sizeof(struct smart_ring_settings_t)));
+  free(blob);
+  return ESP_OK;
+}
 
-  // Load Password
-  err = nvs_get_str(handle, "password", NULL, &required_size);
+/**
+ * @brief
+ * Read the settings stored one key at a time by the previous firmwares.
+ * Missing keys keep their defaults.
+ *
+ */
+static void nvs_settings_read_legacy(struct smart_ring_settings_t *values) {
+  nvs_handle_t handle;
 
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"password\" size : %s",
-             esp_err_to_name(err));
-    return err;
+  if (nvs_open("wifi", NVS_READONLY, &handle) == ESP_OK) {
+    size_t size = sizeof(values->ssid);
+    nvs_get_str(handle, "ssid", values->ssid, &size);
+    size = sizeof(values->password);
+    nvs_get_str(handle, "password", values->password, &size);
+    nvs_get_u8(handle, "provisioned", &values->provisioned);
+    nvs_close(handle);
+  }
+
+  if (nvs_open("configuration", NVS_READONLY, &handle) == ESP_OK) {
+    uint8_t value;
+    nvs_get_u32(handle, "no_deposit", &values->no_deposit);
+    nvs_get_u32(handle, "full_deposit", &values->full_deposit);
+    nvs_get_u8(handle, "is_stable", &values->is_stable);
+    nvs_get_u16(handle, "stock", &values->stock);
+    if (nvs_get_u8(handle, "order_mode", &value) == ESP_OK) {
+      values->order_mode = (char)value;
+    }
+    if (nvs_get_u8(handle, "connection_type", &value) == ESP_OK) {
+      values->connection_type = (char)value;
+    }
+    nvs_close(handle);
   }
+}
 
-  free(SavedData);
+/**
+ * @brief
+ * Erase the per-key namespaces once their values live in the blob, so a
+ * damaged blob can't bring back stale values
+ *
+ */
+static void nvs_settings_erase_legacy(void) {
+  const char *namespaces[] = {"wifi", "configuration"};
+  nvs_handle_t handle;
 
-  SavedData = malloc(required_size);
-  err = nvs_get_str(handle, "password", SavedData, &required_size);
-  if (err != ESP_OK) {
-    free(SavedData);
-    ESP_LOGE(TAG, "Error retrieving \"password\" information");
-    return err;
+  for (size_t i = 0; i < sizeof(namespaces) / sizeof(namespaces[0]); i++) {
+    if (nvs_open(namespaces[i], NVS_READWRITE, &handle) == ESP_OK) {
+      nvs_erase_all(handle);
+      nvs_commit(handle);
+      nvs_close(handle);
+    }
   }
+}
 
-  strcpy(&controller->connection.wifi_controller.password, SavedData);
+/**
+ * @brief
+ * Write pending changes when the device restarts
+ *
+ */
+static void nvs_settings_shutdown_handler(void) { nvs_settings_commit(); }
 
-  ESP_LOGI(TAG, "Successfully retrieved \"password\" information");
+esp_err_t nvs_settings_commit(void) {
+  struct smart_ring_settings_t values;
+  uint32_t dirty_keys;
+  esp_err_t err = ESP_OK;
 
-  // Load if the device is provisioned
-  uint8_t provisioned;
-  err = nvs_get_u8(handle, "provisioned", &provisioned);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"provisioned\" information");
-    return err;
+  if (settings_mutex == NULL) {
+    return ESP_ERR_INVALID_STATE;
   }
 
-  controller->connection.is_provisioned = provisioned;
+  xSemaphoreTake(settings_commit_mutex, portMAX_DELAY);
 
-  free(SavedData);
-  nvs_close(handle);
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  values = settings;
+  dirty_keys = settings_dirty_keys;
+  xSemaphoreGive(settings_mutex);
 
-  return ESP_OK;
-}
+  if (dirty_keys) {
+    for (size_t key = 0; key < SETTINGS_KEY_MAX; key++) {
+      if (dirty_keys & (1 << key)) {
+        values.counters.writes[key]++;
+      }
+    }
 
-//
-// Clear WIFI credentials to NVS
-//
-esp_err_t nvs_clear_wifi_credentials() {
-  nvs_handle_t handle;
-  esp_err_t err;
+    err = nvs_settings_write(&values);
 
-  ESP_LOGI(TAG, "Clearing WiFi credentials from flash");
+    if (err == ESP_OK) {
+      xSemaphoreTake(settings_mutex, portMAX_DELAY);
+      for (size_t key = 0; key < SETTINGS_KEY_MAX; key++) {
+        if (!(dirty_keys & (1 << key))) {
+          continue;
+        }
+        settings.counters.writes[key] = values.counters.writes[key];
 
-  err = nvs_open("wifi", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"wifi\" space : %s",
-             esp_err_to_name(err));
-    return err;
+        // The request counter is the generation of the key, a change made
+        // during the write is still to be written
+        if (settings.counters.requests[key] == values.counters.requests[key]) {
+          settings_dirty_keys &= ~(1 << key);
+        }
+      }
+      xSemaphoreGive(settings_mutex);
+    }
   }
 
-  err = nvs_erase_all(handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error deleting \"wifi\" keys : %s", esp_err_to_name(err));
-  }
+  xSemaphoreGive(settings_commit_mutex);
 
-  // Commit credentials to NVS
-  err = nvs_commit(handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error commiting \"wifi\" changes : %s",
-             esp_err_to_name(err));
-    return err;
+  return err;
+}
+
+void nvs_settings_get_counters(struct smart_ring_settings_counters_t *counters) {
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  *counters = settings.counters;
+  xSemaphoreGive(settings_mutex);
+}
+
+void IRAM_ATTR nvs_settings_power_fail_from_isr(void) {
+  struct smart_ring_settings_intent_t intent = {.key = SETTINGS_KEY_MAX,
+                                                .urgent = true};
+  BaseType_t woken = pdFALSE;
+
+  if (settings_queue != NULL) {
+    xQueueSendToFrontFromISR(settings_queue, &intent, &woken);
   }
+  if (woken) {
+    portYIELD_FROM_ISR();
+  }
+}
 
-  nvs_close(handle);
+/**
+ * @brief
+ * Power fail input interrupt
+ *
+ */
+static void IRAM_ATTR nvs_settings_power_fail_isr(void *arg) {
+  nvs_settings_power_fail_from_isr();
+}
 
-  ESP_LOGI(TAG, "Successfully stored \"wifi\" credentials");
-  return ESP_OK;
+/**
+ * @brief
+ * Configure the power fail input, if the board has one
+ *
+ */
+static void nvs_settings_power_fail_init(void) {
+#if CONFIG_SR_POWER_FAIL_GPIO >= 0
+  gpio_config_t config = {
+      .pin_bit_mask = 1ULL << CONFIG_SR_POWER_FAIL_GPIO,
+      .mode = GPIO_MODE_INPUT,
+      .pull_up_en = GPIO_PULLUP_ENABLE,
+      .intr_type = GPIO_INTR_NEGEDGE,
+  };
+  gpio_config(&config);
+
+  // The service may already be installed by another driver
+  esp_err_t err = gpio_install_isr_service(0);
+  if (err == ESP_OK || err == ESP_ERR_INVALID_STATE) {
+    gpio_isr_handler_add(CONFIG_SR_POWER_FAIL_GPIO, nvs_settings_power_fail_isr,
+                         NULL);
+  }
+#endif
 }
 
-//
-// Save calibration values to NVS
-//
-esp_err_t nvs_save_calibration(int no_deposit, int full_deposit, bool is_stable, int stock) {
-  nvs_handle handle;
-  esp_err_t err;
+/**
+ * @brief
+ * Persistence task. Changes are merged while they keep coming, and written
+ * once there's a pause of NVS_SETTINGS_IDLE_MS, once the oldest one waited
+ * NVS_SETTINGS_WRITE_DELAY_MS, or right away when urgent (new credentials or
+ * calibration, power failing).
+ *
+ */
+static void nvs_settings_thread(void *pvParameters) {
+  struct smart_ring_settings_intent_t intent;
+  int64_t first_change = 0;
+  int64_t last_change = 0;
+  bool pending = false;
+
+  for (;;) {
+    TickType_t wait =
+        pending ? pdMS_TO_TICKS(NVS_SETTINGS_IDLE_MS) : portMAX_DELAY;
+    bool flush = false;
+
+    if (xQueueReceive(settings_queue, &intent, wait) == pdTRUE) {
+      last_change = esp_timer_get_time();
+      if (!pending) {
+        first_change = last_change;
+        pending = true;
+      }
+      flush = intent.urgent;
 
-  ESP_LOGI(TAG, "Saving configuration values to flash");
+#ifndef NDEBUG
+      if (intent.key == SETTINGS_KEY_MAX) {
+        ESP_LOGI(TAG, "Power failing, writing settings");
+      }
+#endif
+    }
 
-  err = nvs_open("configuration", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"configuration\" space : %s",
-             esp_err_to_name(err));
-    return err;
+    int64_t now = esp_timer_get_time();
+    flush = flush || now - last_change >= NVS_SETTINGS_IDLE_MS * 1000LL ||
+            now - first_change >= NVS_SETTINGS_WRITE_DELAY_MS * 1000LL;
+
+    if (pending && flush) {
+      // On failure the keys stay dirty and are retried with the next change
+      // or at shutdown
+      esp_err_t err = nvs_settings_commit();
+      pending = false;
+
+#ifndef NDEBUG
+      ESP_LOGI(TAG, "Settings written after %lld ms : %s",
+               (now - first_change) / 1000, esp_err_to_name(err));
+#endif
+    }
   }
+}
 
-  // Set no deposit
-  err = nvs_set_u32(handle, "no_deposit", no_deposit);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"no_deposit\" information : %s",
-             esp_err_to_name(err));
-    return err;
+esp_err_t nvs_settings_init(void) {
+  esp_err_t err;
+
+  if (settings_mutex == NULL) {
+    settings_mutex = xSemaphoreCreateMutex();
+    settings_commit_mutex = xSemaphoreCreateMutex();
+    esp_register_shutdown_handler(nvs_settings_shutdown_handler);
   }
 
-  // Set full deposit
-  err = nvs_set_u32(handle, "full_deposit", full_deposit);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"full_deposit\" information : %s",
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  memset(&settings, 0, sizeof(settings));
+
+  err = nvs_settings_read(&settings);
+  if (err == ESP_ERR_NVS_NOT_FOUND) {
+    // The per-key settings are only migrated once, they are erased with it
+    ESP_LOGI(TAG, "No settings blob, migrating per-key settings");
+
+    memset(&settings, 0, sizeof(settings));
+    nvs_settings_read_legacy(&settings);
+
+    err = nvs_settings_write(&settings);
+    if (err == ESP_OK) {
+      nvs_settings_erase_legacy();
+    } else {
+      settings_dirty_keys = (1 << SETTINGS_KEY_MAX) - 1;
+    }
+  } else if (err != ESP_OK) {
+    // The blob isn't replaced by the defaults, only by the next change
+    ESP_LOGE(TAG, "Unreadable settings blob (%s), using the defaults",
              esp_err_to_name(err));
-    return err;
+    memset(&settings, 0, sizeof(settings));
   }
 
-  err = nvs_set_u8(handle, "is_stable", is_stable);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"full_deposit\" information : %s",
-             esp_err_to_name(err));
-    return err;
+  // Networks were not stored before the version 4
+  if (settings.ssid[0] != '\0' && nvs_settings_find_network(settings.ssid) == NULL) {
+    nvs_settings_store_network(settings.ssid, settings.password);
+    settings_dirty_keys |= 1 << SETTINGS_KEY_WIFI;
   }
+  xSemaphoreGive(settings_mutex);
 
-  err = nvs_set_u16(handle, "stock", stock);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"stock\" information : %s",
-             esp_err_to_name(err));
-    return err;
+  if (settings_queue == NULL) {
+    settings_queue = xQueueCreate(NVS_SETTINGS_QUEUE_LENGTH,
+                                  sizeof(struct smart_ring_settings_intent_t));
+    xTaskCreatePinnedToCore(&nvs_settings_thread, "nvs_settings",
+                            NVS_SETTINGS_TASK_STACK_SIZE, NULL,
+                            NVS_SETTINGS_TASK_PRIORITY, NULL,
+                            NVS_SETTINGS_TASK_CORE_ID);
+    nvs_settings_power_fail_init();
   }
 
-  // Commit credentials to NVS
-  err = nvs_commit(handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error commiting \"configuration\" changes : %s",
-             esp_err_to_name(err));
-    return err;
+  for (size_t key = 0; key < SETTINGS_KEY_MAX; key++) {
+    ESP_LOGI(TAG, "Settings key %d: %u requests, %u flash writes", key,
+             settings.counters.requests[key], settings.counters.writes[key]);
   }
 
 #ifndef NDEBUG
   ESP_LOGI(TAG,
-           "SAVED calibration values\n\tNO_DEPOSIT : %d\n\tFULL "
-           "DEPOSIT : %d\n\tSTOCK : %d\n\t",
-           no_deposit, full_deposit, stock);
+           "Loaded settings\n\tCONNECTION : %c\n\tORDER MODE : %c\n\tNO_DEPOSIT : "
+           "%d\n\tFULL DEPOSIT : %d\n\tSTOCK : %d\n\t",
+           settings.connection_type ? settings.connection_type : '-',
+           settings.order_mode ? settings.order_mode : '-', settings.no_deposit,
+           settings.full_deposit, settings.stock);
 #endif
 
-  nvs_close(handle);
+  return err;
+}
+
+//
+// Save WIFI credentials to NVS
+//
+esp_err_t nvs_save_wifi_credentials(char *ssid, char *password, bool provisioned) {
+  ESP_LOGI(TAG, "Saving WiFi credentials to flash");
+
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  // The last connection belongs to the previous network
+  if (strncmp(settings.ssid, ssid, sizeof(settings.ssid)) != 0) {
+    memset(&settings.network, 0, sizeof(settings.network));
+  }
+  strlcpy(settings.ssid, ssid, sizeof(settings.ssid));
+  strlcpy(settings.password, password, sizeof(settings.password));
+  settings.provisioned = provisioned;
+  nvs_settings_store_network(settings.ssid, settings.password);
+  nvs_settings_mark_dirty(SETTINGS_KEY_WIFI, true);
+  xSemaphoreGive(settings_mutex);
 
-  ESP_LOGI(TAG, "Successfully stored \"configuration\" credentials");
   return ESP_OK;
 }
 
 //
-// Load calibration values to NVS
+// Load WIFI credentials to NVS
 //
-esp_err_t nvs_load_calibration() {
-  nvs_handle handle;
-  esp_err_t err;
-
+esp_err_t nvs_load_wifi_credentials(void) {
   struct smart_ring_controller_t *controller = smart_ring_get_controller();
 
-  ESP_LOGI(TAG, "Loading calibration values to flash");
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  strlcpy(controller->connection.wifi_controller.ssid, settings.ssid,
+          sizeof(controller->connection.wifi_controller.ssid));
+  strlcpy(controller->connection.wifi_controller.password, settings.password,
+          sizeof(controller->connection.wifi_controller.password));
+  controller->connection.is_provisioned = settings.provisioned;
+  bool found = settings.ssid[0] != '\0';
+  xSemaphoreGive(settings_mutex);
 
-  err = nvs_open("configuration", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"configuration\" space : %s",
-             esp_err_to_name(err));
-    return err;
-  }
+  return found ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
 
-  // Load no_deposit
-  uint32_t no_deposit;
-  err = nvs_get_u32(handle, "no_deposit", &no_deposit);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"no_deposit\" information : %s",
-             esp_err_to_name(err));
-    return err;
+//
+// Save the last WIFI connection to NVS
+//
+esp_err_t nvs_save_wifi_network(const struct smart_ring_settings_network_t *network) {
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  // A renewed lease gives the same values, which are not written again
+  if (memcmp(&settings.network, network, sizeof(settings.network)) != 0) {
+    settings.network = *network;
+    nvs_settings_mark_dirty(SETTINGS_KEY_WIFI, false);
   }
+  xSemaphoreGive(settings_mutex);
 
-  controller->sensor.no_deposit = no_deposit;
+  return ESP_OK;
+}
 
-  // Load full_deposit
-  uint32_t full_deposit;
-  err = nvs_get_u32(handle, "full_deposit", &full_deposit);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"full_deposit\" information : %s",
-             esp_err_to_name(err));
-    return err;
-  }
+//
+// Load the last WIFI connection from NVS
+//
+esp_err_t nvs_load_wifi_network(struct smart_ring_settings_network_t *network) {
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  *network = settings.network;
+  xSemaphoreGive(settings_mutex);
 
-  controller->sensor.full_deposit = full_deposit;
+  return network->valid ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
 
-  // Load is_stable
-  uint32_t is_stable;
-  err = nvs_get_u8(handle, "is_stable", &is_stable);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"is_stable\" information : %s",
-             esp_err_to_name(err));
-    return err;
+//
+// Load the stored WIFI networks from NVS
+//
+esp_err_t nvs_load_wifi_networks(struct smart_ring_settings_wifi_network_t *networks) {
+  bool found = false;
+
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  memcpy(networks, settings.networks, sizeof(settings.networks));
+  for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+    found = found || settings.networks[i].ssid[0] != '\0';
   }
+  xSemaphoreGive(settings_mutex);
 
-  controller->sensor.stable = is_stable;
+  return found ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
 
-  // Load stock
-  uint16_t stock;
-  err = nvs_get_u16(handle, "stock", &stock);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"stock\" information : %s",
-             esp_err_to_name(err));
-    return err;
-  }
+//
+// Select the WIFI network in use
+//
+esp_err_t nvs_select_wifi_network(const char *ssid) {
+  esp_err_t err = ESP_ERR_NVS_NOT_FOUND;
+
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  struct smart_ring_settings_wifi_network_t *network =
+      nvs_settings_find_network(ssid);
+  if (network != NULL) {
+    if (strncmp(settings.ssid, ssid, sizeof(settings.ssid)) != 0) {
+      // The last connection belongs to the previous network
+      memset(&settings.network, 0, sizeof(settings.network));
+      strlcpy(settings.ssid, network->ssid, sizeof(settings.ssid));
+      strlcpy(settings.password, network->password, sizeof(settings.password));
+      nvs_settings_mark_dirty(SETTINGS_KEY_WIFI, false);
+    }
+    err = ESP_OK;
+  }
+  xSemaphoreGive(settings_mutex);
+
+  return err;
+}
+
+//
+// Count a connection to a WIFI network or its failover
+//
+void nvs_save_wifi_network_result(const char *ssid, bool success) {
+  int8_t before[NVS_WIFI_MAX_NETWORKS];
+  bool reordered = false;
+
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  struct smart_ring_settings_wifi_network_t *network =
+      nvs_settings_find_network(ssid);
+  if (network != NULL) {
+    uint16_t *count = success ? &network->successes : &network->failures;
+
+    for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+      before[i] = nvs_settings_compare_history(network, &settings.networks[i]);
+    }
+    if (*count < UINT16_MAX) {
+      (*count)++;
+    }
+    for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+      if (settings.networks[i].ssid[0] != '\0' && &settings.networks[i] != network &&
+          nvs_settings_compare_history(network, &settings.networks[i]) != before[i]) {
+        reordered = true;
+      }
+    }
+
+    // Every reconnection counts, but only a change of the ranking is worth a
+    // flash write. The counts are written with the next change otherwise
+    if (reordered) {
+      nvs_settings_mark_dirty(SETTINGS_KEY_WIFI, false);
+    }
+  }
+  xSemaphoreGive(settings_mutex);
+}
 
-  controller->stock = stock;
+//
+// Save a scheduler rule to NVS
+//
+esp_err_t nvs_save_schedule_job(const struct smart_ring_settings_job_t *job) {
+  struct smart_ring_settings_job_t *entry = NULL;
+  esp_err_t err = ESP_OK;
+
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  for (int i = 0; i < NVS_SCHEDULE_MAX_JOBS; i++) {
+    if (strncmp(settings.schedule[i].name, job->name,
+                sizeof(settings.schedule[i].name)) == 0) {
+      entry = &settings.schedule[i];
+      break;
+    }
+    if (entry == NULL && settings.schedule[i].name[0] == '\0') {
+      entry = &settings.schedule[i];
+    }
+  }
+
+  if (entry == NULL) {
+    err = ESP_ERR_NO_MEM;
+  } else if (memcmp(entry, job, sizeof(*entry)) != 0) {
+    *entry = *job;
+    nvs_settings_mark_dirty(SETTINGS_KEY_SCHEDULE, false);
+  }
+  xSemaphoreGive(settings_mutex);
+
+  return err;
+}
 
-#ifndef NDEBUG
-  ESP_LOGI(TAG,
-           "Loaded calibration values\n\tNO_DEPOSIT : %d\n\tFULL "
-           "DEPOSIT : %d\n\tSTOCK : %d\n\t",
-           controller->sensor.no_deposit, controller->sensor.full_deposit,
-           controller->stock);
-#endif
+//
+// Load a scheduler rule from NVS
+//
+esp_err_t nvs_load_schedule_job(const char *name,
+                                struct smart_ring_settings_job_t *job) {
+  esp_err_t err = ESP_ERR_NVS_NOT_FOUND;
+
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  for (int i = 0; i < NVS_SCHEDULE_MAX_JOBS; i++) {
+    if (settings.schedule[i].name[0] != '\0' &&
+        strncmp(settings.schedule[i].name, name,
+                sizeof(settings.schedule[i].name)) == 0) {
+      *job = settings.schedule[i];
+      err = ESP_OK;
+      break;
+    }
+  }
+  xSemaphoreGive(settings_mutex);
+
+  return err;
+}
 
-  nvs_close(handle);
+//
+// Clear WIFI credentials to NVS
+//
+esp_err_t nvs_clear_wifi_credentials() {
+  ESP_LOGI(TAG, "Clearing WiFi credentials from flash");
+
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  // The stored networks are kept, the network provisioned next is added to
+  // them for the failover
+  memset(settings.ssid, 0, sizeof(settings.ssid));
+  memset(settings.password, 0, sizeof(settings.password));
+  memset(&settings.network, 0, sizeof(settings.network));
+  settings.provisioned = false;
+  nvs_settings_mark_dirty(SETTINGS_KEY_WIFI, true);
+  xSemaphoreGive(settings_mutex);
 
   return ESP_OK;
 }
 
 //
-// Save order mode to NVS
+// Save calibration values to NVS
 //
-esp_err_t nvs_save_order_mode(char order_mode) {
-  nvs_handle handle;
-  esp_err_t err;
+esp_err_t nvs_save_calibration(int no_deposit, int full_deposit, bool is_stable, int stock) {
+  bool calibrated;
 
-  ESP_LOGI(TAG, "Saving order mode to flash");
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  calibrated = settings.no_deposit != no_deposit ||
+               settings.full_deposit != full_deposit ||
+               settings.is_stable != is_stable;
 
-  err = nvs_open("configuration", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"configuration\" space : %s",
-             esp_err_to_name(err));
-    return err;
+  // A new calibration is written right away, stock changes are merged
+  if (calibrated) {
+    settings.no_deposit = no_deposit;
+    settings.full_deposit = full_deposit;
+    settings.is_stable = is_stable;
+    nvs_settings_mark_dirty(SETTINGS_KEY_CALIBRATION, true);
   }
-
-  // Set order mode
-  err = nvs_set_u8(handle, "order_mode", order_mode);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"order_mode\" information : %s",
-             esp_err_to_name(err));
-    return err;
+  if (settings.stock != stock) {
+    settings.stock = stock;
+    nvs_settings_mark_dirty(SETTINGS_KEY_STOCK, false);
   }
+  xSemaphoreGive(settings_mutex);
 
-  // Commit credentials to NVS
-  err = nvs_commit(handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error commiting \"configuration\" changes : %s",
-             esp_err_to_name(err));
-    return err;
-  }
-
-  nvs_close(handle);
+#ifndef NDEBUG
+  ESP_LOGI(TAG,
+           "SAVED calibration values\n\tNO_DEPOSIT : %d\n\tFULL "
+           "DEPOSIT : %d\n\tSTOCK : %d\n\t",
+           no_deposit, full_deposit, stock);
+#endif
 
-  ESP_LOGI(TAG, "Successfully stored \"configuration\" credentials");
   return ESP_OK;
 }
 
 //
-// Load order mode to NVS
+// Load calibration values to NVS
 //
-esp_err_t nvs_load_order_mode() {
-  nvs_handle handle;
-  esp_err_t err;
-
+esp_err_t nvs_load_calibration() {
   struct smart_ring_controller_t *controller = smart_ring_get_controller();
 
-  ESP_LOGI(TAG, "Loading order mode value from flash");
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  controller->sensor.no_deposit = settings.no_deposit;
+  controller->sensor.full_deposit = settings.full_deposit;
+  controller->sensor.stable = settings.is_stable;
+  controller->stock = settings.stock;
+  xSemaphoreGive(settings_mutex);
 
-  err = nvs_open("configuration", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"configuration\" space : %s",
-             esp_err_to_name(err));
-    return err;
-  }
+  return ESP_OK;
+}
 
-  // Load order mode
-  uint8_t order_mode;
-  err = nvs_get_u8(handle, "order_mode", &order_mode);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"order_mode\" information : %s",
-             esp_err_to_name(err));
-    return err;
+//
+// Save order mode to NVS
+//
+esp_err_t nvs_save_order_mode(char order_mode) {
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  if (settings.order_mode != order_mode) {
+    settings.order_mode = order_mode;
+    nvs_settings_mark_dirty(SETTINGS_KEY_ORDER_MODE, false);
   }
+  xSemaphoreGive(settings_mutex);
 
-  controller->order_mode = (char)order_mode;
+  return ESP_OK;
+}
 
-  nvs_close(handle);
+//
+// Load order mode to NVS
+//
+esp_err_t nvs_load_order_mode() {
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  char order_mode = settings.order_mode;
+  xSemaphoreGive(settings_mutex);
 
-  return ESP_OK;
+  smart_ring_get_controller()->order_mode = order_mode;
+  return order_mode ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
 }
 
 //
 // Save connection type to NVS
 //
 esp_err_t nvs_save_connection_type(char connection_type) {
-  nvs_handle handle;
-  esp_err_t err;
-
-  ESP_LOGI(TAG, "Saving connection type to flash");
-
-  err = nvs_open("configuration", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"configuration\" space : %s",
-             esp_err_to_name(err));
-    return err;
-  }
-
-  // Set order mode
-  err = nvs_set_u8(handle, "connection_type", connection_type);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error storing \"connection_type\" information : %s",
-             esp_err_to_name(err));
-    return err;
-  }
-
-  // Commit credentials to NVS
-  err = nvs_commit(handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error commiting \"configuration\" changes : %s",
-             esp_err_to_name(err));
-    return err;
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  if (settings.connection_type != connection_type) {
+    settings.connection_type = connection_type;
+    nvs_settings_mark_dirty(SETTINGS_KEY_CONNECTION_TYPE, false);
   }
+  xSemaphoreGive(settings_mutex);
 
-  nvs_close(handle);
-
-  ESP_LOGI(TAG, "Successfully stored \"configuration\" credentials");
   return ESP_OK;
 }
 
@@ -441,34 +838,12 @@ esp_err_t nvs_save_connection_type(char connection_type) {
 // Load connection type to NVS
 //
 esp_err_t nvs_load_connection_type() {
-  nvs_handle handle;
-  esp_err_t err;
+  xSemaphoreTake(settings_mutex, portMAX_DELAY);
+  char connection_type = settings.connection_type;
+  xSemaphoreGive(settings_mutex);
 
-  struct smart_ring_controller_t *controller = smart_ring_get_controller();
-
-  ESP_LOGI(TAG, "Loading connection type value from flash");
-
-  err = nvs_open("configuration", NVS_READWRITE, &handle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error opening nvs \"configuration\" space : %s",
-             esp_err_to_name(err));
-    return err;
-  }
-
-  // Load order mode
-  uint8_t connection_type;
-  err = nvs_get_u8(handle, "connection_type", &connection_type);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error retrieving \"connection_type\" information : %s",
-             esp_err_to_name(err));
-    return err;
-  }
-
-  controller->connection.type = (char)connection_type;
-
-  nvs_close(handle);
-
-  return ESP_OK;
+  smart_ring_get_controller()->connection.type = connection_type;
+  return connection_type ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
 }
 
 //
@@ -492,6 +867,7 @@ esp_err_t nvs_load_temporary_mqtt_certificate_pem(char* pem) {
 
   if (err != ESP_OK) {
     ESP_LOGE(TAG, "Error retrieving \"cert_pem\" size : %s", esp_err_to_name(err));
+    nvs_close(handle);
     return err;
   }
 
@@ -500,6 +876,7 @@ esp_err_t nvs_load_temporary_mqtt_certificate_pem(char* pem) {
   if (err != ESP_OK) {
     free(SavedData);
     ESP_LOGE(TAG, "Error retrieving \"cert_pem\" information");
+    nvs_close(handle);
     return err;
   }
 
@@ -535,6 +912,7 @@ esp_err_t nvs_save_mqtt_certificate_pem(char *pem) {
   if (err != ESP_OK) {
     ESP_LOGE(TAG, "Error storing \"cert_pem\" information : %s",
              esp_err_to_name(err));
+    nvs_close(handle);
     return err;
   }
 
@@ -543,6 +921,7 @@ esp_err_t nvs_save_mqtt_certificate_pem(char *pem) {
   if (err != ESP_OK) {
     ESP_LOGE(TAG, "Error commiting \"cert_pem\" changes : %s",
              esp_err_to_name(err));
+    nvs_close(handle);
     return err;
   }
 
@@ -578,6 +957,7 @@ esp_err_t nvs_clear_certificate_credentials(void) {
   if (err != ESP_OK) {
     ESP_LOGE(TAG, "Error commiting \"mqtt\" changes : %s",
              esp_err_to_name(err));
+    nvs_close(handle);
     return err;
   }
 
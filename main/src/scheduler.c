@@ -0,0 +1,272 @@
+/**
+ * @file scheduler.c
+ * @brief
+ * This file contains the scheduler of the periodic jobs. Each job has a wall
+ * clock rule (minute of some hours, in the local timezone) or a monotonic one
+ * (a period), and the scheduler task blocks until the closest one is due
+ * instead of every module polling the time
+ *
+ * @version 2.1.2
+ * @date 2024-04-09
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "libs.h"
+
+#include "esp_timer.h"
+
+static const char *TAG = "SCHEDULER";
+
+/**
+ * @brief
+ * Registered job
+ *
+ */
+struct scheduler_job_t {
+  char name[NVS_SCHEDULE_NAME_MAX_LEN];
+  struct scheduler_rule_t rule;
+  scheduler_callback_t callback;
+  void *arg;
+  /// Monotonic time the job is due (us), 0 when not scheduled
+  int64_t due_us;
+  /// Wall clock the job is due, for the wall clock rules
+  time_t due_time;
+};
+
+static struct scheduler_job_t scheduler_jobs[SCHEDULER_MAX_JOBS];
+static int scheduler_jobs_count = 0;
+static SemaphoreHandle_t scheduler_mutex = NULL;
+static TaskHandle_t scheduler_task = NULL;
+
+// The wall clock was set or changed, the wall clock jobs are computed again
+static volatile bool scheduler_time_dirty = false;
+
+/**
+ * @brief
+ * Next wall clock time matching the rule, after now
+ *
+ * @return time_t Time, 0 when the rule never matches
+ */
+static time_t scheduler_next_time(const struct scheduler_rule_t *rule, time_t now) {
+  uint8_t weekdays = rule->weekdays ? rule->weekdays : SCHEDULER_EVERY_DAY;
+  struct tm today;
+
+  localtime_r(&now, &today);
+
+  // Today and the next seven days hold the next time of any rule
+  for (int day = 0; day <= 7; day++) {
+    for (int hour = 0; hour < 24; hour++) {
+      if (!(rule->hours & SCHEDULER_HOUR(hour)))
+        continue;
+
+      // mktime normalizes the day, and the DST change of the candidate
+      struct tm candidate = today;
+      candidate.tm_mday += day;
+      candidate.tm_hour = hour;
+      candidate.tm_min = rule->minute;
+      candidate.tm_sec = 0;
+      candidate.tm_isdst = -1;
+
+      time_t candidate_time = mktime(&candidate);
+      if (candidate_time > now && (weekdays & (1 << candidate.tm_wday)))
+        return candidate_time;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief
+ * Compute when the job is due next. Must be called with the mutex taken
+ *
+ */
+static void scheduler_arm(struct scheduler_job_t *job, int64_t now_us, time_t now) {
+  if (job->rule.monotonic) {
+    job->due_us = job->rule.period_s ? now_us + job->rule.period_s * 1000000LL : 0;
+    return;
+  }
+
+  // Wall clock jobs wait for SNTP, scheduler_time_changed arms them
+  job->due_time = now >= SCHEDULER_TIME_SET_AFTER ? scheduler_next_time(&job->rule, now) : 0;
+  job->due_us = job->due_time ? now_us + (int64_t)(job->due_time - now) * 1000000LL : 0;
+
+#ifndef NDEBUG
+  if (job->due_time) {
+    struct tm due;
+    char buffer[20];
+    localtime_r(&job->due_time, &due);
+    strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M", &due);
+    ESP_LOGI(TAG, "Job '%s' due at %s", job->name, buffer);
+  }
+#endif
+}
+
+/**
+ * @brief
+ * Copy the rule of the settings into a scheduler rule
+ *
+ */
+static void scheduler_rule_from_settings(const struct smart_ring_settings_job_t *saved,
+                                         struct scheduler_rule_t *rule) {
+  rule->monotonic = saved->monotonic;
+  rule->minute = saved->minute;
+  rule->weekdays = saved->weekdays;
+  rule->hours = saved->hours;
+  rule->period_s = saved->period_s;
+}
+
+/**
+ * @brief
+ * Scheduler task. Runs the due jobs and blocks until the next one, or until a
+ * job or the wall clock changes
+ *
+ */
+static void scheduler_thread(void *param) {
+  scheduler_callback_t callbacks[SCHEDULER_MAX_JOBS];
+  void *args[SCHEDULER_MAX_JOBS];
+
+  for (;;) {
+    int64_t now_us = esp_timer_get_time();
+    int64_t next_us = INT64_MAX;
+    time_t now = time(NULL);
+    int due = 0;
+
+    xSemaphoreTake(scheduler_mutex, portMAX_DELAY);
+    bool time_dirty = scheduler_time_dirty;
+    scheduler_time_dirty = false;
+
+    for (int i = 0; i < scheduler_jobs_count; i++) {
+      struct scheduler_job_t *job = &scheduler_jobs[i];
+
+      if (time_dirty && !job->rule.monotonic)
+        scheduler_arm(job, now_us, now);
+
+      if (job->due_us != 0 && job->due_us <= now_us) {
+        if (!job->rule.monotonic && now < job->due_time) {
+          // The monotonic clock ran ahead of the wall clock
+          job->due_us = now_us + (int64_t)(job->due_time - now) * 1000000LL;
+        } else {
+          callbacks[due] = job->callback;
+          args[due++] = job->arg;
+
+          if (job->rule.monotonic) {
+            // Keep the period from drifting with the time the jobs take
+            job->due_us += job->rule.period_s * 1000000LL;
+            if (job->due_us <= now_us)
+              scheduler_arm(job, now_us, now);
+          } else {
+            scheduler_arm(job, now_us, now);
+          }
+        }
+      }
+
+      if (job->due_us != 0 && job->due_us < next_us)
+        next_us = job->due_us;
+    }
+    xSemaphoreGive(scheduler_mutex);
+
+    for (int i = 0; i < due; i++)
+      callbacks[i](args[i]);
+
+    if (due > 0)
+      continue;
+
+    uint32_t wait_ms = SCHEDULER_MAX_WAIT_MS;
+    if (next_us != INT64_MAX && (next_us - now_us) / 1000 < SCHEDULER_MAX_WAIT_MS)
+      wait_ms = (next_us - now_us + 999) / 1000;
+
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms) + 1);
+  }
+}
+
+void scheduler_init(void) {
+  if (scheduler_task != NULL)
+    return;
+
+  scheduler_mutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(&scheduler_thread, "scheduler", SCHEDULER_TASK_STACK_SIZE,
+                          NULL, SCHEDULER_TASK_PRIORITY, &scheduler_task,
+                          SCHEDULER_TASK_CORE_ID);
+}
+
+esp_err_t scheduler_add(const char *name, const struct scheduler_rule_t *rule,
+                        scheduler_callback_t callback, void *arg) {
+  struct smart_ring_settings_job_t saved;
+  esp_err_t err = ESP_ERR_NO_MEM;
+
+  xSemaphoreTake(scheduler_mutex, portMAX_DELAY);
+  if (scheduler_jobs_count < SCHEDULER_MAX_JOBS) {
+    struct scheduler_job_t *job = &scheduler_jobs[scheduler_jobs_count++];
+
+    memset(job, 0, sizeof(*job));
+    strlcpy(job->name, name, sizeof(job->name));
+    job->rule = *rule;
+    job->callback = callback;
+    job->arg = arg;
+
+    if (nvs_load_schedule_job(name, &saved) == ESP_OK)
+      scheduler_rule_from_settings(&saved, &job->rule);
+
+    scheduler_arm(job, esp_timer_get_time(), time(NULL));
+    err = ESP_OK;
+  }
+  xSemaphoreGive(scheduler_mutex);
+
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "No room for job '%s'", name);
+    return err;
+  }
+
+  xTaskNotifyGive(scheduler_task);
+  return ESP_OK;
+}
+
+esp_err_t scheduler_set_rule(const char *name, const struct scheduler_rule_t *rule,
+                             bool persist) {
+  esp_err_t err = ESP_ERR_NOT_FOUND;
+
+  xSemaphoreTake(scheduler_mutex, portMAX_DELAY);
+  for (int i = 0; i < scheduler_jobs_count; i++) {
+    if (strncmp(scheduler_jobs[i].name, name, sizeof(scheduler_jobs[i].name)) == 0) {
+      scheduler_jobs[i].rule = *rule;
+      scheduler_arm(&scheduler_jobs[i], esp_timer_get_time(), time(NULL));
+      err = ESP_OK;
+      break;
+    }
+  }
+  xSemaphoreGive(scheduler_mutex);
+
+  if (persist) {
+    struct smart_ring_settings_job_t saved = {};
+
+    strlcpy(saved.name, name, sizeof(saved.name));
+    saved.monotonic = rule->monotonic;
+    saved.minute = rule->minute;
+    saved.weekdays = rule->weekdays;
+    saved.hours = rule->hours;
+    saved.period_s = rule->period_s;
+
+    esp_err_t nvs_err = nvs_save_schedule_job(&saved);
+    if (nvs_err != ESP_OK) {
+      ESP_LOGE(TAG, "Error saving the rule of '%s' : %s", name, esp_err_to_name(nvs_err));
+    } else {
+      err = ESP_OK;
+    }
+  }
+
+  if (err == ESP_OK)
+    xTaskNotifyGive(scheduler_task);
+
+  return err;
+}
+
+void scheduler_time_changed(void) {
+  if (scheduler_task == NULL)
+    return;
+
+  scheduler_time_dirty = true;
+  xTaskNotifyGive(scheduler_task);
+}
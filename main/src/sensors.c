@@ -15,8 +15,6 @@
 
 static const char *TAG = "SENSOR";
 
-static TickType_t lastTimePercCheck = 0;
-
 static int smart_ring_sensors_read(void)
 {
   adc_update();
@@ -128,10 +126,10 @@ smart_ring_sensors_validate(struct smart_ring_controller_t *controller, int sens
                                   controller->sensor.stable);
 
     // If on debug screen change the value in real time
-    if (controller->ui_controller->state == STATE_28 && !controller->ui_controller->flags.flag.update_state)
+    if (controller->ui_controller->state == STATE_28)
     {
-      smart_ring_main_debug_update_sensor_values(controller->sensor.new_reading, controller->sensor.old_reading,
-                                                 controller->sensor.stable);
+      smart_ring_ui_set_sensor_values(controller->sensor.new_reading, controller->sensor.old_reading,
+                                      controller->sensor.stable);
     }
 
     // Check if the consumption is greater 0.3litres
@@ -157,14 +155,13 @@ smart_ring_sensors_validate(struct smart_ring_controller_t *controller, int sens
           if (controller->sensor.no_bottle && (controller->sensor.calibration.step == 0))
           {
             controller->stock > 0 ? controller->stock-- : NULL;
-            controller->ui_controller->stock = controller->stock;
-            if (controller->ui_controller->state == STATE_5 && !controller->ui_controller->flags.flag.update_state)
+            smart_ring_ui_set_stock(controller->stock);
+            if (controller->ui_controller->state == STATE_5)
             {
-              smart_ring_ui_main_update_stock_value(controller->stock);
               nvs_save_calibration(controller->sensor.no_deposit, controller->sensor.full_deposit,
                                    controller->sensor.stable, controller->stock);
               controller->ui_controller->updated_stock = controller->stock;
-              controller->ui_controller->flags.flag.update_stock_manual = true;
+              controller->ui_controller->flags.update_stock_manual = true;
             }
 #ifndef NDEBUG
             ESP_LOGI(TAG, "Send stock to MQTT");
@@ -212,8 +209,7 @@ smart_ring_sensors_validate(struct smart_ring_controller_t *controller, int sens
 
         // The sensor value is stable
         controller->sensor.current_deposit = controller->sensor.new_reading;
-        if (controller->ui_controller->state == STATE_5 &&
-            !controller->ui_controller->flags.flag.update_state)
+        if (controller->ui_controller->state == STATE_5)
         {
           // printf("New Reading : %d \n",  controller->sensor.new_reading );
           // smart_ring_ui_set_current_deposit(controller->sensor.new_reading);
@@ -225,10 +221,9 @@ smart_ring_sensors_validate(struct smart_ring_controller_t *controller, int sens
 #ifndef NDEBUG
           ESP_LOGI(TAG, "Send sensor to MQTT");
 #endif
-          if (controller->ui_controller->state == STATE_28 &&
-              !controller->ui_controller->flags.flag.update_state)
+          if (controller->ui_controller->state == STATE_28)
           {
-            smart_ring_main_debug_update_sensor_values(NO_UPDATE, NO_UPDATE, controller->sensor.stable);
+            smart_ring_ui_set_sensor_values(NO_UPDATE, NO_UPDATE, controller->sensor.stable);
           }
         }
       }
@@ -240,15 +235,27 @@ smart_ring_sensors_validate(struct smart_ring_controller_t *controller, int sens
         controller->sensor.stable = false;
         controller->sensor.static_counter = 0;
 
-        if (controller->ui_controller->state == STATE_28 && !controller->ui_controller->flags.flag.update_state)
+        if (controller->ui_controller->state == STATE_28)
         {
-          smart_ring_main_debug_update_sensor_values(NO_UPDATE, NO_UPDATE, controller->sensor.stable);
+          smart_ring_ui_set_sensor_values(NO_UPDATE, NO_UPDATE, controller->sensor.stable);
         }
       }
     }
   }
 }
 
+/**
+ * @brief
+ * Scheduler job sending the consumption percentage
+ *
+ * @param arg Not used
+ */
+static void smart_ring_sensors_report_percentual(void *arg)
+{
+  ESP_LOGI(TAG, "Send Percentual to MQTT");
+  mqtt_send_message(SEND_PERCENTUAL);
+}
+
 void smart_ring_sensors_task(void *pvParameter)
 {
 
@@ -259,27 +266,22 @@ void smart_ring_sensors_task(void *pvParameter)
   adc_setCalFactor(100.0); // user set calibration factor (float)
   ESP_LOGI(TAG, "Done");
 
+  // Consumption percentage reported five times a day
+  const struct scheduler_rule_t percentual_rule = {
+      .hours = SCHEDULER_HOUR(1) | SCHEDULER_HOUR(6) | SCHEDULER_HOUR(11) |
+               SCHEDULER_HOUR(17) | SCHEDULER_HOUR(22),
+      .minute = 0,
+      .weekdays = SCHEDULER_EVERY_DAY,
+  };
+  scheduler_add(SENSORS_PERCENTUAL_JOB, &percentual_rule, smart_ring_sensors_report_percentual, NULL);
+
   for (;;)
   {
     smart_ring_sensors_validate(controller, smart_ring_sensors_read());
-    if (controller->ui_controller->flags.flag.register_water_level)
+    if (controller->ui_controller->flags.register_water_level)
     {
       //mqtt_send_message(SEND_SENSORS);
-      controller->ui_controller->flags.flag.register_water_level = false;
-    }
-
-    if (xTaskGetTickCount() - lastTimePercCheck >= TIME_PERC_INTERVAL)
-    {
-      ESP_LOGI("SNTP", "Check Time Percentage");
-
-      if (isTimePerc(controller))
-      {
-        ESP_LOGI("SNTP", "Send Percentual to MQTT");
-        mqtt_send_message(SEND_PERCENTUAL);
-        controller->flags.flag.sent_perc_message = true;
-      }
-
-      lastTimePercCheck = xTaskGetTickCount(); // Update the last checked time
+      controller->ui_controller->flags.register_water_level = false;
     }
 
     vTaskDelay(200 / portTICK_PERIOD_MS);
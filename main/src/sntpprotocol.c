@@ -17,9 +17,14 @@ static const char *TAG = "SNTP";
 
 void time_sync_notification_cb(struct timeval *tv){
     ESP_LOGI(TAG, "Time sync from NTP server");
+    scheduler_time_changed();
 }
 
 void initialize_sntp(){
+    if (sntp_enabled()) {
+        return;
+    }
+
     ESP_LOGI(TAG, "Initializing SNTP");
     
     sntp_setoperatingmode(SNTP_OPMODE_POLL);
@@ -47,47 +52,3 @@ void set_timezone() {
     ESP_LOGI(TAG, "Timezone set");
     tzset();
 }
-
-bool isTimePerc(struct smart_ring_controller_t *controller){
-    time_t now;
-    struct tm timeinfo;
-    char buffer[64];
-
-    time(&now);
-    localtime_r(&now, &timeinfo);
-
-    if (timeinfo.tm_min != 0) {
-        controller->flags.flag.sent_perc_message = false;
-    }
-    
-    if ((timeinfo.tm_hour == 1  ||
-         timeinfo.tm_hour == 6  ||
-         timeinfo.tm_hour == 11 ||
-         timeinfo.tm_hour == 17 || 
-         timeinfo.tm_hour == 22  ) && 
-         timeinfo.tm_min  == 0     && !controller->flags.flag.sent_perc_message) {
-        return true;
-    }
-    return false;
-}
-
-// Version Check Function
-// Verifies if time equals 8h30
-//     If true makes a firmware version check
-bool versionCheck(struct smart_ring_controller_t *controller){
-    time_t now;
-    struct tm timeinfo;
-    char buffer[64];
-
-    time(&now);
-    localtime_r(&now, &timeinfo);
-
-    if (timeinfo.tm_min != 30) {
-        controller->flags.flag.sent_version_check_message = false;
-    }
-    
-    if (timeinfo.tm_hour == 8 && timeinfo.tm_min  == 30 && !controller->flags.flag.sent_version_check_message) {
-        return true;
-    }
-    return false;
-}
\ No newline at end of file
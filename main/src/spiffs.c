@@ -5,6 +5,9 @@
  * This file contains the functions responsible for the initialization and
  * update of the SPIFFs storage portion of the device
  *
+ * The partition is mounted once at boot and stays mounted. Files are replaced
+ * through a temporary file renamed twice, and the files read are kept in a
+ * small RAM cache, so loading the MQTT key does not touch the flash again.
  *
  * @version -
  * @date 2023-05-03
@@ -16,11 +19,17 @@
 
 #include "libs.h"
 
-void spiffs_save_mqtt_certificate_privateKey(char*);
-void spiffs_load_mqtt_certificate_privateKey(char*);
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "esp_timer.h"
+
+esp_err_t spiffs_save_mqtt_certificate_privateKey(const char*);
+esp_err_t spiffs_load_mqtt_certificate_privateKey(char*, size_t);
 
 
 spiffs_t spiffs = {
+        .init = spiffs_init,
         .saveMQTTCertificatePrivateKey = spiffs_save_mqtt_certificate_privateKey,
         .loadMQTTCertificatePrivateKey = spiffs_load_mqtt_certificate_privateKey,
 };
@@ -28,54 +37,287 @@ spiffs_t spiffs = {
 
 static const char *TAG = "spiffs";
 
+/**
+ * @brief
+ * Content of a file kept in RAM after it was read or written
+ *
+ */
+struct spiffs_cache_entry {
+    char name[SPIFFS_NAME_MAX_LEN + 1];
+    char *data;
+    size_t length;
+};
+
+static struct spiffs_cache_entry spiffs_cache[SPIFFS_CACHE_ENTRIES];
+static unsigned int spiffs_cache_next = 0;      // Entry replaced when the cache is full
+static SemaphoreHandle_t spiffs_mutex = NULL;
+static bool spiffs_mounted = false;
+
+#define SPIFFS_PATH_MAX_LEN (sizeof(SPIFFS_BASE_PATH) + SPIFFS_NAME_MAX_LEN + \
+                             MAX(sizeof(SPIFFS_TMP_SUFFIX), sizeof(SPIFFS_NEW_SUFFIX)))
+
+
+static bool spiffs_make_path(char *path, size_t size, const char *name, const char *suffix) {
+    if (name == NULL || strlen(name) > SPIFFS_NAME_MAX_LEN) {
+        ESP_LOGE(TAG, "Invalid file name");
+        return false;
+    }
+    snprintf(path, size, SPIFFS_BASE_PATH "/%s%s", name, suffix);
+    return true;
+}
+
+static struct spiffs_cache_entry *spiffs_cache_find(const char *name) {
+    for (int i = 0; i < SPIFFS_CACHE_ENTRIES; i++) {
+        if (spiffs_cache[i].data != NULL && strcmp(spiffs_cache[i].name, name) == 0)
+            return &spiffs_cache[i];
+    }
+    return NULL;
+}
+
+static void spiffs_cache_store(const char *name, const void *data, size_t length) {
+    struct spiffs_cache_entry *entry = spiffs_cache_find(name);
+
+    if (entry == NULL) {
+        entry = &spiffs_cache[spiffs_cache_next];
+        spiffs_cache_next = (spiffs_cache_next + 1) % SPIFFS_CACHE_ENTRIES;
+    }
+    free(entry->data);
+
+    entry->data = malloc(length + 1);
+    if (entry->data == NULL) {
+        ESP_LOGE(TAG, "No memory to cache %s", name);
+        return;
+    }
+    memcpy(entry->data, data, length);
+    entry->data[length] = '\0';
+    entry->length = length;
+    strlcpy(entry->name, name, sizeof(entry->name));
+}
+
+/**
+ * @brief
+ * Get the file name a temporary file belongs to
+ *
+ * @return true The entry ends with the suffix
+ */
+static bool spiffs_strip_suffix(const char *entry, const char *suffix, char *name) {
+    size_t len = strlen(entry);
+    size_t suffix_len = strlen(suffix);
+
+    if (len <= suffix_len || len - suffix_len > SPIFFS_NAME_MAX_LEN ||
+        strcmp(entry + len - suffix_len, suffix) != 0)
+        return false;
+
+    memcpy(name, entry, len - suffix_len);
+    name[len - suffix_len] = '\0';
+    return true;
+}
+
+/**
+ * @brief
+ * Finish the writes interrupted by a reset. A .tmp file may be truncated, even
+ * with no original next to it on the first write of a file, and is dropped. A
+ * .new file was synced before its rename, so it replaces the original
+ *
+ */
+static void spiffs_recover(void) {
+    DIR *dir = opendir(SPIFFS_BASE_PATH);
+    struct dirent *entry;
+    char name[SPIFFS_NAME_MAX_LEN + 1];
+    char path[SPIFFS_PATH_MAX_LEN];
+    char tmp_path[SPIFFS_PATH_MAX_LEN];
+
+    if (dir == NULL)
+        return;
+
+    while ((entry = readdir(dir)) != NULL) {
+        if (spiffs_strip_suffix(entry->d_name, SPIFFS_TMP_SUFFIX, name)) {
+            ESP_LOGI(TAG, "Dropping an incomplete write of %s", name);
+            spiffs_make_path(tmp_path, sizeof(tmp_path), name, SPIFFS_TMP_SUFFIX);
+            unlink(tmp_path);
+        }
+        else if (spiffs_strip_suffix(entry->d_name, SPIFFS_NEW_SUFFIX, name)) {
+            ESP_LOGI(TAG, "Completing the write of %s", name);
+            spiffs_make_path(path, sizeof(path), name, "");
+            spiffs_make_path(tmp_path, sizeof(tmp_path), name, SPIFFS_NEW_SUFFIX);
+            unlink(path);
+            rename(tmp_path, path);
+        }
+    }
+    closedir(dir);
+}
 
-void spiffs_save_mqtt_certificate_privateKey(char *key) {
+esp_err_t spiffs_init(void) {
     esp_vfs_spiffs_conf_t config = {
-        .base_path = "/mqtt",
-        .partition_label = NULL,
-        .max_files = 5,
+        .base_path = SPIFFS_BASE_PATH,
+        .partition_label = SPIFFS_PARTITION_LABEL,
+        .max_files = SPIFFS_MAX_FILES,
         .format_if_mount_failed = true,
     };
-    esp_vfs_spiffs_register(&config);
+    esp_err_t err;
 
-    /*Create file with name hello.txt */
-    ESP_LOGI(TAG, "Creating New file: key.txt");
-    FILE *f = fopen("/mqtt/key.txt", "w");
+    if (spiffs_mutex == NULL)
+        spiffs_mutex = xSemaphoreCreateMutex();
+
+    xSemaphoreTake(spiffs_mutex, portMAX_DELAY);
+    if (!spiffs_mounted) {
+        err = esp_vfs_spiffs_register(&config);
+        if (err == ESP_OK) {
+            spiffs_mounted = true;
+            spiffs_recover();
+        }
+        else {
+            ESP_LOGE(TAG, "Failed to mount the storage partition (%s)", esp_err_to_name(err));
+        }
+    }
+    err = spiffs_mounted ? ESP_OK : ESP_FAIL;
+    xSemaphoreGive(spiffs_mutex);
+
+    return err;
+}
+
+esp_err_t spiffs_write_file(const char *name, const void *data, size_t length) {
+    char path[SPIFFS_PATH_MAX_LEN];
+    char tmp_path[SPIFFS_PATH_MAX_LEN];
+    char new_path[SPIFFS_PATH_MAX_LEN];
+    esp_err_t err = ESP_FAIL;
+
+    if (spiffs_init() != ESP_OK)
+        return ESP_ERR_INVALID_STATE;
+    if (!spiffs_make_path(path, sizeof(path), name, "") ||
+        !spiffs_make_path(tmp_path, sizeof(tmp_path), name, SPIFFS_TMP_SUFFIX) ||
+        !spiffs_make_path(new_path, sizeof(new_path), name, SPIFFS_NEW_SUFFIX))
+        return ESP_ERR_INVALID_ARG;
+
+    xSemaphoreTake(spiffs_mutex, portMAX_DELAY);
+
+    FILE *f = fopen(tmp_path, "wb");
     if (f == NULL) {
-        ESP_LOGE(TAG, "Failed to open file for writing");
-        return;
+        ESP_LOGE(TAG, "Failed to open %s for writing", tmp_path);
+        goto exit;
     }
 
-    ESP_LOGI(TAG, "Writing data to file: key.txt");
-    fprintf(f, key);  // write data to pem.txt file
+    bool written = fwrite(data, 1, length, f) == length;
+    written = fflush(f) == 0 && written;
+    written = fsync(fileno(f)) == 0 && written;
     fclose(f);
-    ESP_LOGI(TAG, "File written");
+
+    if (!written) {
+        ESP_LOGE(TAG, "Failed to write %s", tmp_path);
+        unlink(tmp_path);
+        goto exit;
+    }
+
+    // Only a complete file gets the .new suffix, spiffs_recover installs it
+    // if a reset comes before the last rename
+    unlink(new_path);
+    if (rename(tmp_path, new_path) != 0) {
+        ESP_LOGE(TAG, "Failed to rename %s", tmp_path);
+        unlink(tmp_path);
+        goto exit;
+    }
+
+    // SPIFFS does not rename over an existing file
+    unlink(path);
+    if (rename(new_path, path) != 0) {
+        ESP_LOGE(TAG, "Failed to rename %s", new_path);
+        goto exit;
+    }
+
+    spiffs_cache_store(name, data, length);
+    err = ESP_OK;
+
+exit:
+    xSemaphoreGive(spiffs_mutex);
+    return err;
 }
 
+esp_err_t spiffs_read_file(const char *name, char *buffer, size_t size, size_t *length) {
+    char path[SPIFFS_PATH_MAX_LEN];
+    struct spiffs_cache_entry *entry;
+    struct stat st;
+    esp_err_t err = ESP_OK;
 
+    if (buffer == NULL || size == 0)
+        return ESP_ERR_INVALID_ARG;
+    if (spiffs_init() != ESP_OK)
+        return ESP_ERR_INVALID_STATE;
+    if (!spiffs_make_path(path, sizeof(path), name, ""))
+        return ESP_ERR_INVALID_ARG;
 
-void spiffs_load_mqtt_certificate_privateKey(char* key) {
-     esp_vfs_spiffs_conf_t config = {
-      .base_path              = "/mqtt",
-      .partition_label        = NULL,
-      .max_files              = 5,
-      .format_if_mount_failed = true,
-    };
+    xSemaphoreTake(spiffs_mutex, portMAX_DELAY);
 
-    char tempString[100];
-    esp_vfs_spiffs_register(&config);
+    entry = spiffs_cache_find(name);
+    if (entry == NULL) {
+        FILE *f = fopen(path, "rb");
+        if (f == NULL) {
+            err = ESP_ERR_NOT_FOUND;
+            goto exit;
+        }
+        if (fstat(fileno(f), &st) != 0 || st.st_size < 0) {
+            fclose(f);
+            err = ESP_FAIL;
+            goto exit;
+        }
 
-    /* read data from key.txt file */
-    ESP_LOGI(TAG, "Reading data from file: key.txt");
-    FILE *file = fopen("/mqtt/key.txt", "r");
-    if (file == NULL) {
-        ESP_LOGE(TAG, "File does not exist!");
-    }
-    else {
-        while (fgets(tempString, sizeof(tempString), file) != NULL) {
-            strcat(key, tempString);
+        char *data = malloc(st.st_size + 1);
+        if (data == NULL) {
+            fclose(f);
+            err = ESP_ERR_NO_MEM;
+            goto exit;
+        }
+        size_t read = fread(data, 1, st.st_size, f);
+        fclose(f);
+
+        spiffs_cache_store(name, data, read);
+        free(data);
+
+        entry = spiffs_cache_find(name);
+        if (entry == NULL) {
+            err = ESP_ERR_NO_MEM;
+            goto exit;
         }
-        fclose(file);
     }
-    esp_vfs_spiffs_unregister(NULL);
+
+    if (entry->length + 1 > size) {
+        ESP_LOGE(TAG, "%s does not fit in %u bytes", name, (unsigned int)size);
+        err = ESP_ERR_INVALID_SIZE;
+        goto exit;
+    }
+    memcpy(buffer, entry->data, entry->length + 1);
+    if (length != NULL)
+        *length = entry->length;
+
+exit:
+    xSemaphoreGive(spiffs_mutex);
+    return err;
+}
+
+
+esp_err_t spiffs_save_mqtt_certificate_privateKey(const char *key) {
+    ESP_LOGI(TAG, "Writing data to file: " SPIFFS_KEY_FILE);
+
+    esp_err_t err = spiffs_write_file(SPIFFS_KEY_FILE, key, strlen(key));
+    if (err == ESP_OK)
+        ESP_LOGI(TAG, "File written");
+
+    return err;
+}
+
+
+
+esp_err_t spiffs_load_mqtt_certificate_privateKey(char *key, size_t size) {
+#ifndef NDEBUG
+    int64_t start = esp_timer_get_time();
+#endif
+
+    esp_err_t err = spiffs_read_file(SPIFFS_KEY_FILE, key, size, NULL);
+    if (err == ESP_ERR_NOT_FOUND)
+        ESP_LOGE(TAG, "File does not exist!");
+
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "Key loaded in %lld us", (long long)(esp_timer_get_time() - start));
+#endif
+
+    return err;
 }
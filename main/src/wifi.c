@@ -24,12 +24,103 @@ static QueueHandle_t wifi_app_queue_handle;
 // Global wifi group
 static volatile EventGroupHandle_t wifi_app_event_group;
 
-// Variable for the retries
-static int retries = 0;
+// State of the connectivity manager
+static wifi_app_state_t wifi_app_state = WIFI_STATE_STOPPED;
+
+// Failed connection attempts since the last connection, for the backoff
+static int reconnect_attempts = 0;
+
+// Tick at which the next connection attempt is made, in WIFI_STATE_BACKOFF
+static TickType_t reconnect_tick = 0;
+
+// UI state shown at ui_step_tick, after a disconnection
+static enum smart_ring_ui_state_machine_t ui_step_state;
+static TickType_t ui_step_tick = 0;
+static bool ui_step_pending = false;
+
+// Set once the interface is started
+static bool wifi_started = false;
+
+// Station interface, to read and set its IP configuration
+static esp_netif_t *wifi_netif_sta = NULL;
+
+// Last connection, loaded from the NVS and updated on every connection
+static struct smart_ring_settings_network_t wifi_network = {};
+
+// The current attempt is a directed connection to the last access point
+static bool fast_connect = false;
+
+// The directed connection failed, the next attempts scan all the channels
+static bool fast_connect_failed = false;
+
+#ifdef CONFIG_SR_WIFI_STATIC_IP_REUSE
+// The station uses the address of the last lease instead of DHCP
+static bool static_ip = false;
+#endif
+
+// Failed attempts on the network in use, for the failover
+static int failed_attempts = 0;
+
+// Consecutive link checks with a weak signal
+static int weak_checks = 0;
+
+// The station is leaving the network for a better one
+static bool switching_network = false;
+
+// Reasons to keep the radio at full power, WIFI_POWER_HOLD_*
+static volatile uint32_t power_holds = 0;
+static portMUX_TYPE power_holds_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Power save mode applied to the station
+static wifi_ps_type_t power_save = WIFI_PS_NONE;
+
+// Releases the touch hold after the last interaction
+static esp_timer_handle_t power_touch_timer = NULL;
+
+/**
+ * @brief  Send a message to the connectivity manager
+ * @param  id: Message to be sent
+ * @param  reason: Disconnection reason, for WIFI_APP_MSG_STA_DISCONNECTED
+ * @retval pdTRUE if the message was queued
+ */
+static BaseType_t wifi_app_send_message(wifi_app_message_t id, uint8_t reason) {
+  wifi_app_queue_message_t msg = {
+      .id = id,
+      .reason = reason,
+  };
+
+  if (wifi_app_queue_handle == NULL)
+    return pdFALSE;
+
+  return xQueueSend(wifi_app_queue_handle, &msg, 0);
+}
+
+/**
+ * @brief  Use the modem sleep only while connected and nothing holds the
+ *         radio at full power. Provisioning and connecting stay at full power
+ * @retval None
+ */
+static void wifi_app_apply_power_save(void) {
+  wifi_ps_type_t mode = WIFI_STA_POWER_SAVE;
+
+  if (wifi_app_state != WIFI_STATE_CONNECTED || power_holds != 0)
+    mode = WIFI_PS_NONE;
+
+  if (mode == power_save)
+    return;
+
+  if (esp_wifi_set_ps(mode) == ESP_OK) {
+    power_save = mode;
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "Power save %d (holds 0x%x)", mode, power_holds);
+#endif
+  }
+}
 
 /**
  * @brief  Wifi event handler for status changes on the interface and connection
- * @note   It may change during the course of the firmware integration
+ * @note   Runs in the default event loop, so it only forwards the events to the
+ *         connectivity manager and never blocks
  * @param  *arg: User custom argument to be passed if required
  * @param  event_base: Group of event type - WiFi in this case
  * @param  event_id: Type of event
@@ -42,14 +133,11 @@ static void wifi_app_event_handler(void *arg, esp_event_base_t event_base,
     switch (event_id) {
     case WIFI_EVENT_AP_START:
       ESP_LOGI(TAG, "WIFI_EVENT_AP_START");
-      int err = http_server_start();
-      if (err != ESP_OK) {
-        ESP_LOGI(TAG, "ERROR STARTING SERVER: %s", esp_err_to_name(err));
-      }
+      wifi_app_send_message(WIFI_APP_MSG_AP_START, 0);
       break;
     case WIFI_EVENT_AP_STOP:
       ESP_LOGI(TAG, "WIFI_EVENT_AP_STOP");
-      http_server_stop();
+      wifi_app_send_message(WIFI_APP_MSG_AP_STOP, 0);
       break;
     case WIFI_EVENT_AP_STACONNECTED:
       ESP_LOGI(TAG, "WIFI_EVENT_AP_STACONNECTED");
@@ -64,115 +152,634 @@ static void wifi_app_event_handler(void *arg, esp_event_base_t event_base,
       ESP_LOGI(TAG, "WIFI_EVENT_STA_CONNECTED");
       break;
     case WIFI_EVENT_STA_DISCONNECTED:
-      ESP_LOGI(TAG, "WIFI_EVENT_STA_DISCONNECTED");
+      ESP_LOGI(TAG, "WIFI_EVENT_STA_DISCONNECTED, reason code %d",
+               ((wifi_event_sta_disconnected_t *)event_data)->reason);
+      wifi_app_send_message(WIFI_APP_MSG_STA_DISCONNECTED,
+                            ((wifi_event_sta_disconnected_t *)event_data)->reason);
+      break;
+    }
+  } else if (event_base == IP_EVENT) {
+    switch (event_id) {
+    case IP_EVENT_STA_GOT_IP:
+      ESP_LOGI(TAG, "IP_EVENT_STA_GOT_IP");
+      wifi_app_send_message(WIFI_APP_MSG_STA_GOT_IP, 0);
+      break;
+    }
+  }
+}
 
-      if (smart_ring_get_controller()->connection.is_connected) {
-        // Change the signal icon to no network
-        smart_ring_ui_set_rssi_level(0);
-      }
+/**
+ * @brief  Configure the event handler function for the interface
+ * @retval None
+ */
+static void wifi_app_event_handler_init(void) {
+  // Event loop for the WiFi driver
+  ESP_ERROR_CHECK(esp_event_loop_create_default());
+
+  // Event handler for the connection
+  esp_event_handler_instance_t instance_wifi_event;
+  esp_event_handler_instance_t instance_ip_event;
+  ESP_ERROR_CHECK(esp_event_handler_instance_register(
+      WIFI_EVENT, ESP_EVENT_ANY_ID, &wifi_app_event_handler, NULL,
+      &instance_wifi_event));
+  ESP_ERROR_CHECK(esp_event_handler_instance_register(
+      IP_EVENT, ESP_EVENT_ANY_ID, &wifi_app_event_handler, NULL,
+      &instance_ip_event));
+}
+
+/**
+ * @brief  Change the state of the connectivity manager and publish it in the
+ *         event group
+ * @param  state: New state
+ * @retval None
+ */
+static void wifi_app_set_state(wifi_app_state_t state) {
+  wifi_app_state = state;
+
+  if (state == WIFI_STATE_CONNECTED) {
+    smart_ring_get_controller()->connection.is_connected = true;
+    xEventGroupClearBits(wifi_app_event_group, WIFI_DISCONNECTED_BIT);
+    xEventGroupSetBits(wifi_app_event_group, WIFI_CONNECTED_BIT);
+  } else {
+    smart_ring_get_controller()->connection.is_connected = false;
+    xEventGroupClearBits(wifi_app_event_group, WIFI_CONNECTED_BIT);
+    xEventGroupSetBits(wifi_app_event_group, WIFI_DISCONNECTED_BIT);
+  }
+
+  if (state == WIFI_STATE_PROVISIONING) {
+    xEventGroupSetBits(wifi_app_event_group, WIFI_PROVISIONING_BIT);
+  } else {
+    xEventGroupClearBits(wifi_app_event_group, WIFI_PROVISIONING_BIT);
+  }
+
+  wifi_app_apply_power_save();
+}
+
+/**
+ * @brief  Schedule the next connection attempt, doubling the delay after every
+ *         failed attempt up to WIFI_RECONNECT_MAX_MS, with some jitter so a
+ *         site full of devices does not retry at the same time
+ * @retval None
+ */
+static void wifi_app_schedule_reconnect(void) {
+  uint32_t delay_ms = WIFI_RECONNECT_MAX_MS;
+
+  if (reconnect_attempts < 16) {
+    delay_ms = MIN((uint32_t)WIFI_RECONNECT_MIN_MS << reconnect_attempts,
+                   WIFI_RECONNECT_MAX_MS);
+  }
+  delay_ms += esp_random() % (delay_ms / 4 + 1);
+  reconnect_attempts++;
 
-      smart_ring_get_controller()->connection.is_connected = false;
-
-      wifi_event_sta_disconnected_t *wifi_event_sta_disconnected =
-          (wifi_event_sta_disconnected_t *)malloc(
-              sizeof(wifi_event_sta_disconnected_t));
-      *wifi_event_sta_disconnected =
-          *((wifi_event_sta_disconnected_t *)event_data);
-      printf("WIFI_EVENT_STA_DISCONNECTED, reason code %d\n",
-             wifi_event_sta_disconnected->reason);
-
-      if (!smart_ring_get_controller()->connection.is_provisioned) {
-        provision_set_status(PROVISION_FAILED);
-        break;
-      } else {
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
 #ifndef NDEBUG
-        ESP_LOGI(TAG, "DISCONNECTED, Retrying to connect\n");
+  ESP_LOGI(TAG, "Reconnecting in %u ms (attempt %d)", delay_ms,
+           reconnect_attempts);
 #endif
 
-        if (smart_ring_ui_get_controller()->state == STATE_4 && retries >= 2) {
-          boot_update_warning_label("Could not connect");
-          vTaskDelay(3000 / portTICK_PERIOD_MS);
-          smart_ring_ui_update_state(STATE_5);
-        }
+  reconnect_tick = xTaskGetTickCount() + pdMS_TO_TICKS(delay_ms);
+  wifi_app_set_state(WIFI_STATE_BACKOFF);
+}
 
-        if (smart_ring_ui_get_controller()->state > STATE_6) {
-          smart_ring_ui_update_state(STATE_5);
-          vTaskDelay(500 / portTICK_PERIOD_MS);
-          smart_ring_ui_update_state(STATE_6);
-        }
+/**
+ * @brief  Show a UI state later, from the connectivity manager task, so the
+ *         messages are still handled meanwhile
+ * @param  state: UI state to show
+ * @param  delay_ms: Delay before showing it
+ * @retval None
+ */
+static void wifi_app_schedule_ui_state(enum smart_ring_ui_state_machine_t state,
+                                       uint32_t delay_ms) {
+  ui_step_state = state;
+  ui_step_tick = xTaskGetTickCount() + pdMS_TO_TICKS(delay_ms);
+  ui_step_pending = true;
+}
 
-        retries++;
-        esp_wifi_connect();
+/**
+ * @brief  Ticks left until the given tick, 0 if it passed
+ * @retval Ticks to wait
+ */
+static TickType_t wifi_app_ticks_until(TickType_t tick) {
+  TickType_t now = xTaskGetTickCount();
+
+  return (int32_t)(tick - now) > 0 ? tick - now : 0;
+}
+
+#ifdef CONFIG_SR_WIFI_STATIC_IP_REUSE
+/**
+ * @brief  Switch the station between the address of the last lease and DHCP
+ * @param  enable: Use the address of the last lease
+ * @retval None
+ */
+static void wifi_app_set_static_ip(bool enable) {
+  if (enable == static_ip || (enable && wifi_network.ip == 0))
+    return;
+
+  if (enable) {
+    esp_netif_ip_info_t ip_info = {
+        .ip.addr = wifi_network.ip,
+        .netmask.addr = wifi_network.netmask,
+        .gw.addr = wifi_network.gateway,
+    };
+    esp_netif_dns_info_t dns_info = {
+        .ip.u_addr.ip4.addr = wifi_network.dns,
+        .ip.type = ESP_IPADDR_TYPE_V4,
+    };
+
+    esp_netif_dhcpc_stop(wifi_netif_sta);
+    esp_netif_set_ip_info(wifi_netif_sta, &ip_info);
+    if (wifi_network.dns != 0)
+      esp_netif_set_dns_info(wifi_netif_sta, ESP_NETIF_DNS_MAIN, &dns_info);
+  } else {
+    esp_netif_dhcpc_start(wifi_netif_sta);
+  }
+  static_ip = enable;
+
+#ifndef NDEBUG
+  ESP_LOGI(TAG, "%s", enable ? "Reusing the last address" : "Using DHCP");
+#endif
+}
+#endif
+
+/**
+ * @brief  Configure the station for the next connection attempt
+ * @param  fast: Connect directly to the BSSID and channel of the last
+ *         connection, otherwise scan all the channels for the strongest AP
+ * @retval None
+ */
+static void wifi_app_configure_sta(bool fast) {
+  struct smart_ring_wifi_controller_t *wifi_controller =
+      &smart_ring_get_controller()->connection.wifi_controller;
+  wifi_config_t sta_config = {};
+
+  strncpy((char *)sta_config.sta.ssid, wifi_controller->ssid,
+          sizeof(sta_config.sta.ssid));
+  strncpy((char *)sta_config.sta.password, wifi_controller->password,
+          sizeof(sta_config.sta.password));
+
+  if (fast) {
+    sta_config.sta.scan_method = WIFI_FAST_SCAN;
+    sta_config.sta.bssid_set = true;
+    memcpy(sta_config.sta.bssid, wifi_network.bssid, sizeof(wifi_network.bssid));
+    sta_config.sta.channel = wifi_network.channel;
+  } else {
+    sta_config.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+    sta_config.sta.sort_method = WIFI_CONNECT_AP_BY_SIGNAL;
+  }
+
+  // Beacons the station sleeps through in WIFI_PS_MAX_MODEM
+  sta_config.sta.listen_interval = WIFI_STA_LISTEN_INTERVAL;
+
+  esp_wifi_set_config(WIFI_IF_STA, &sta_config);
+  fast_connect = fast;
+
+#ifdef CONFIG_SR_WIFI_STATIC_IP_REUSE
+  // The address is only reused with the access point it was leased on
+  wifi_app_set_static_ip(fast);
+#endif
+}
+
+/**
+ * @brief  Keep the access point and the lease of the current connection for
+ *         the next fast reconnect
+ * @retval None
+ */
+static void wifi_app_save_network(void) {
+  struct smart_ring_settings_network_t network = {.valid = true};
+  wifi_ap_record_t ap_record;
+  esp_netif_ip_info_t ip_info;
+  esp_netif_dns_info_t dns_info;
+
+  if (esp_wifi_sta_get_ap_info(&ap_record) != ESP_OK ||
+      esp_netif_get_ip_info(wifi_netif_sta, &ip_info) != ESP_OK) {
+    return;
+  }
+
+  memcpy(network.bssid, ap_record.bssid, sizeof(network.bssid));
+  network.channel = ap_record.primary;
+  network.ip = ip_info.ip.addr;
+  network.netmask = ip_info.netmask.addr;
+  network.gateway = ip_info.gw.addr;
+  if (esp_netif_get_dns_info(wifi_netif_sta, ESP_NETIF_DNS_MAIN, &dns_info) ==
+      ESP_OK) {
+    network.dns = dns_info.ip.u_addr.ip4.addr;
+  }
+
+  wifi_network = network;
+  nvs_save_wifi_network(&network);
+}
+
+/**
+ * @brief  Start a connection attempt to the saved network, directed to the
+ *         last access point until that fails once
+ * @retval None
+ */
+static void wifi_app_connect(void) {
+  wifi_app_configure_sta(wifi_network.valid && !fast_connect_failed);
+  wifi_app_set_state(WIFI_STATE_CONNECTING);
+
+  esp_err_t err = esp_wifi_connect();
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Connect failed: %s", esp_err_to_name(err));
+    wifi_app_schedule_reconnect();
+  }
+}
+
+/**
+ * @brief  Score a stored network seen by a scan, higher is better. The signal
+ *         is the base, lowered for every network with a higher priority and
+ *         raised by the share of connections that worked
+ * @param  *networks: Stored networks
+ * @param  index: Network to score
+ * @param  rssi: Strongest signal of the network in the scan
+ * @retval Score, in dB
+ */
+static int wifi_app_network_score(
+    const struct smart_ring_settings_wifi_network_t *networks, int index,
+    int8_t rssi) {
+  const struct smart_ring_settings_wifi_network_t *network = &networks[index];
+  int rank = 0;
+
+  for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+    if (networks[i].ssid[0] != '\0' && networks[i].priority > network->priority)
+      rank++;
+  }
+
+  return rssi - rank * WIFI_FAILOVER_PRIORITY_DB +
+         WIFI_FAILOVER_HISTORY_DB * network->successes /
+             (network->successes + network->failures + 1);
+}
+
+/**
+ * @brief  Scan for the stored networks and move to the best ranked one
+ * @param  connected: The network in use is connected, and is only left for a
+ *         network at least WIFI_FAILOVER_HYSTERESIS_DB better
+ * @retval true if another network was selected
+ */
+static bool wifi_app_failover(bool connected) {
+  struct smart_ring_wifi_controller_t *wifi_controller =
+      &smart_ring_get_controller()->connection.wifi_controller;
+  struct smart_ring_settings_wifi_network_t networks[NVS_WIFI_MAX_NETWORKS];
+  wifi_scan_config_t scan_config = {.show_hidden = false};
+  uint16_t count = WIFI_FAILOVER_SCAN_MAX_RECORDS;
+  int best = -1, best_score = INT_MIN, current_score = INT_MIN;
+  int stored = 0;
+
+  nvs_load_wifi_networks(networks);
+  for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+    stored += networks[i].ssid[0] != '\0';
+  }
+  if (stored < 2)
+    return false;
+
+  wifi_ap_record_t *records = malloc(count * sizeof(wifi_ap_record_t));
+  if (records == NULL)
+    return false;
+
+  if (esp_wifi_scan_start(&scan_config, true) != ESP_OK ||
+      esp_wifi_scan_get_ap_records(&count, records) != ESP_OK) {
+    ESP_LOGE(TAG, "Failover scan failed");
+    free(records);
+    return false;
+  }
+
+  for (int i = 0; i < NVS_WIFI_MAX_NETWORKS; i++) {
+    int8_t rssi = INT8_MIN;
+    bool seen = false;
+
+    if (networks[i].ssid[0] == '\0')
+      continue;
+
+    for (int j = 0; j < count; j++) {
+      if (strncmp((char *)records[j].ssid, networks[i].ssid,
+                  sizeof(records[j].ssid)) == 0) {
+        rssi = MAX(rssi, records[j].rssi);
+        seen = true;
       }
-      free(wifi_event_sta_disconnected);
-      break;
     }
-  } else if (event_base == IP_EVENT) {
-    switch (event_id) {
-    case IP_EVENT_STA_GOT_IP:
-      ESP_LOGI(TAG, "IP_EVENT_STA_GOT_IP");
+    if (!seen)
+      continue;
 
-      wifi_config_t current_config = {};
-      esp_wifi_get_config(WIFI_IF_STA, &current_config);
+    int score = wifi_app_network_score(networks, i, rssi);
+#ifndef NDEBUG
+    ESP_LOGI(TAG, "Network %s: RSSI %d, score %d", networks[i].ssid, rssi,
+             score);
+#endif
 
-      if (!smart_ring_get_controller()->connection.is_provisioned) {
-        provision_set_status(PROVISION_SUCCESSFUL);
+    if (strncmp(networks[i].ssid, wifi_controller->ssid,
+                sizeof(wifi_controller->ssid)) == 0) {
+      current_score = score;
+    } else if (score > best_score) {
+      best = i;
+      best_score = score;
+    }
+  }
+  free(records);
+
+  // Keep the network in use while it ranks best
+  if (best < 0 || (connected && best_score < current_score + WIFI_FAILOVER_HYSTERESIS_DB) ||
+      (!connected && best_score <= current_score)) {
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Failing over from %s to %s", wifi_controller->ssid,
+           networks[best].ssid);
+
+  nvs_save_wifi_network_result(wifi_controller->ssid, false);
+  nvs_select_wifi_network(networks[best].ssid);
+  strlcpy(wifi_controller->ssid, networks[best].ssid,
+          sizeof(wifi_controller->ssid));
+  strlcpy(wifi_controller->password, networks[best].password,
+          sizeof(wifi_controller->password));
+  smart_ring_ui_set_ssid(wifi_controller->ssid);
+
+  // The last connection belongs to the previous network
+  memset(&wifi_network, 0, sizeof(wifi_network));
+  fast_connect_failed = false;
+  failed_attempts = 0;
+
+  return true;
+}
+
+/**
+ * @brief  Sample the signal of the connected network, and look for a better
+ *         stored network when the average stays weak
+ * @retval None
+ */
+static void wifi_app_check_link(void) {
+  struct link_quality_summary_t summary;
+
+  wifi_get_rssi();
+  link_quality_get_summary(&summary);
+
+  weak_checks = summary.rssi_avg < WIFI_FAILOVER_RSSI_DBM ? weak_checks + 1 : 0;
+  if (weak_checks < WIFI_FAILOVER_WEAK_CHECKS)
+    return;
+  weak_checks = 0;
+
+  if (wifi_app_failover(true)) {
+    switching_network = true;
+    wifi_app_set_state(WIFI_STATE_CONNECTING);
+    esp_wifi_disconnect();
+  }
+}
+
+/**
+ * @brief  Handle the loss of the station connection
+ * @retval None
+ */
+static void wifi_app_sta_disconnected(void) {
+  struct smart_ring_controller_t *controller = smart_ring_get_controller();
+
+  if (wifi_app_state == WIFI_STATE_CONNECTED) {
+    // Change the signal icon to no network
+    smart_ring_ui_set_rssi_level(0);
+  }
+
+  if (!controller->connection.is_provisioned) {
+    wifi_app_set_state(WIFI_STATE_PROVISIONING);
+    provision_set_status(PROVISION_FAILED);
+    return;
+  }
+
+  if (switching_network) {
+    // Left on purpose for a better network
+    switching_network = false;
+    wifi_app_connect();
+    return;
+  }
+
+  if (wifi_app_state == WIFI_STATE_CONNECTING && fast_connect) {
+    // The access point moved or is gone, scan all the channels right away
+    ESP_LOGI(TAG, "Fast connect failed, falling back to a full scan");
+    fast_connect_failed = true;
+    wifi_app_connect();
+    return;
+  }
+
+  if (smart_ring_ui_get_controller()->state == STATE_4 &&
+      reconnect_attempts >= WIFI_BOOT_RETRIES) {
+    smart_ring_ui_set_boot_warning("Could not connect");
+    wifi_app_schedule_ui_state(STATE_5, WIFI_BOOT_WARNING_MS);
+  } else if (smart_ring_ui_get_controller()->state > STATE_6) {
+    smart_ring_ui_update_state(STATE_5);
+    wifi_app_schedule_ui_state(STATE_6, WIFI_NO_CONNECTION_MS);
+  }
+
+  // Try the other stored networks when this one keeps failing
+  if (wifi_app_state == WIFI_STATE_CONNECTING &&
+      ++failed_attempts >= WIFI_FAILOVER_ATTEMPTS) {
+    failed_attempts = 0;
+    if (wifi_app_failover(false)) {
+      wifi_app_connect();
+      return;
+    }
+  }
+
+  wifi_app_schedule_reconnect();
+}
+
+/**
+ * @brief  Handle a station connection with an IP address
+ * @retval None
+ */
+static void wifi_app_sta_got_ip(void) {
+  struct smart_ring_controller_t *controller = smart_ring_get_controller();
+
+  if (!controller->connection.is_provisioned) {
+    wifi_config_t current_config = {};
+    esp_wifi_get_config(WIFI_IF_STA, &current_config);
+
+    provision_set_status(PROVISION_SUCCESSFUL);
 
 #ifndef NDEBUG
-        ESP_LOGI(TAG, "Saving credentials\nSSID : %s\nPASS : %s",
-                 (char *)&current_config.sta.ssid,
-                 (char *)&current_config.sta.password);
+    ESP_LOGI(TAG, "Saving credentials\nSSID : %s\nPASS : %s",
+             (char *)&current_config.sta.ssid,
+             (char *)&current_config.sta.password);
 #endif
 
-        nvs_save_wifi_credentials(&current_config.sta.ssid,
-                                  &current_config.sta.password, true);
+    nvs_save_wifi_credentials(&current_config.sta.ssid,
+                              &current_config.sta.password, true);
 
-        vTaskDelay(5000 / portTICK_PERIOD_MS);
-        esp_restart();
-      }
+    // Leave the webpage time to show the result before restarting
+    vTaskDelay(5000 / portTICK_PERIOD_MS);
+    esp_restart();
+  }
 
-      // Set rssi level
-      wifi_get_rssi();
+  // Save the connected state and reset the backoff
+  wifi_app_set_state(WIFI_STATE_CONNECTED);
+  boot_profiler_mark("wifi connected");
+  reconnect_attempts = 0;
+  fast_connect_failed = false;
+  failed_attempts = 0;
+  weak_checks = 0;
+  nvs_save_wifi_network_result(controller->connection.wifi_controller.ssid, true);
 
-      // Save the connected flag and reset retries variable
-      smart_ring_get_controller()->connection.is_connected = true;
+  // The samples of the previous access point don't apply anymore
+  link_quality_reset();
 
-      retries = 0;
+  // Keep the access point and the lease for the next boot
+  wifi_app_save_network();
 
+  // The clock is set as soon as there's a network, the wall clock jobs and
+  // the TLS certificates need it
+  initialize_sntp();
+
+  // Set rssi level
+  wifi_get_rssi();
+}
+
+/**
+ * @brief  Connectivity manager task. It owns the connection state machine,
+ *         handling the events forwarded by the event handler and the
+ *         reconnections
+ * @param  *param: Connection controller
+ * @retval None
+ */
+static void wifi_app_thread(void *param) {
+  wifi_app_queue_message_t msg;
+
+  for (;;) {
+    TickType_t wait = portMAX_DELAY;
+
+    if (wifi_app_state == WIFI_STATE_BACKOFF) {
+      wait = wifi_app_ticks_until(reconnect_tick);
+    } else if (wifi_app_state == WIFI_STATE_CONNECTED) {
+      wait = pdMS_TO_TICKS(WIFI_LINK_CHECK_INTERVAL_MS);
+    }
+    if (ui_step_pending) {
+      wait = MIN(wait, wifi_app_ticks_until(ui_step_tick));
+    }
+
+    if (xQueueReceive(wifi_app_queue_handle, &msg, wait) != pdTRUE) {
+      if (ui_step_pending && wifi_app_ticks_until(ui_step_tick) == 0) {
+        ui_step_pending = false;
+        smart_ring_ui_update_state(ui_step_state);
+      } else if (wifi_app_state == WIFI_STATE_BACKOFF) {
+        wifi_app_connect();
+      } else if (wifi_app_state == WIFI_STATE_CONNECTED) {
+        wifi_app_check_link();
+      }
+      continue;
+    }
+
+    switch (msg.id) {
+    case WIFI_APP_MSG_CONNECT:
+      ESP_LOGI(TAG, "WIFI_APP_MSG_CONNECT");
+      reconnect_attempts = 0;
+      wifi_app_connect();
+      break;
+    case WIFI_APP_MSG_AP_START: {
+      wifi_app_set_state(WIFI_STATE_PROVISIONING);
+      esp_err_t err = http_server_start();
+      if (err != ESP_OK) {
+        ESP_LOGI(TAG, "ERROR STARTING SERVER: %s", esp_err_to_name(err));
+      }
+      break;
+    }
+    case WIFI_APP_MSG_AP_STOP:
+      http_server_stop();
+      break;
+    case WIFI_APP_MSG_STA_DISCONNECTED:
+#ifndef NDEBUG
+      ESP_LOGI(TAG, "DISCONNECTED (reason %d) in state %d", msg.reason,
+               wifi_app_state);
+#endif
+      wifi_app_sta_disconnected();
+      break;
+    case WIFI_APP_MSG_STA_GOT_IP:
+      wifi_app_sta_got_ip();
+      break;
+    case WIFI_APP_MSG_POWER_UPDATE:
+      wifi_app_apply_power_save();
       break;
     }
   }
 }
 
 /**
- * @brief  Configure the event handler function for the interface
+ * @brief  Release the touch hold, WIFI_POWER_TOUCH_HOLD_MS after the last
+ *         interaction
+ * @param  *arg: Not used
  * @retval None
  */
-static void wifi_app_event_handler_init(void) {
-  // Event loop for the WiFi driver
-  ESP_ERROR_CHECK(esp_event_loop_create_default());
+static void wifi_power_touch_timeout(void *arg) {
+  wifi_power_release(WIFI_POWER_HOLD_TOUCH);
+}
 
-  // Event handler for the connection
-  esp_event_handler_instance_t instance_wifi_event;
-  esp_event_handler_instance_t instance_ip_event;
-  ESP_ERROR_CHECK(esp_event_handler_instance_register(
-      WIFI_EVENT, ESP_EVENT_ANY_ID, &wifi_app_event_handler, NULL,
-      &instance_wifi_event));
-  ESP_ERROR_CHECK(esp_event_handler_instance_register(
-      IP_EVENT, ESP_EVENT_ANY_ID, &wifi_app_event_handler, NULL,
-      &instance_ip_event));
+void wifi_events_init(void) {
+  if (wifi_app_event_group == NULL) {
+    wifi_app_event_group = xEventGroupCreate();
+    xEventGroupSetBits(wifi_app_event_group, WIFI_DISCONNECTED_BIT);
+  }
+
+  if (power_touch_timer == NULL) {
+    const esp_timer_create_args_t timer_args = {
+        .callback = wifi_power_touch_timeout,
+        .name = "wifi_touch",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &power_touch_timer));
+  }
+}
+
+void wifi_power_hold(uint32_t reason) {
+  uint32_t previous;
+
+  portENTER_CRITICAL(&power_holds_lock);
+  previous = power_holds;
+  power_holds |= reason;
+  portEXIT_CRITICAL(&power_holds_lock);
+
+  if (previous == 0)
+    wifi_app_send_message(WIFI_APP_MSG_POWER_UPDATE, 0);
+}
+
+void wifi_power_release(uint32_t reason) {
+  bool released;
+
+  portENTER_CRITICAL(&power_holds_lock);
+  released = power_holds != 0 && (power_holds & ~reason) == 0;
+  power_holds &= ~reason;
+  portEXIT_CRITICAL(&power_holds_lock);
+
+  if (released)
+    wifi_app_send_message(WIFI_APP_MSG_POWER_UPDATE, 0);
+}
+
+void wifi_power_activity(void) {
+  wifi_power_hold(WIFI_POWER_HOLD_TOUCH);
+
+  if (power_touch_timer != NULL) {
+    esp_timer_stop(power_touch_timer);
+    esp_timer_start_once(power_touch_timer, WIFI_POWER_TOUCH_HOLD_MS * 1000ULL);
+  }
 }
 
+bool wifi_wait_connected(TickType_t ticks) {
+  EventBits_t bits = xEventGroupWaitBits(wifi_app_event_group, WIFI_CONNECTED_BIT,
+                                         pdFALSE, pdTRUE, ticks);
+  return (bits & WIFI_CONNECTED_BIT) != 0;
+}
+
+EventGroupHandle_t wifi_get_event_group(void) { return wifi_app_event_group; }
+
+wifi_app_state_t wifi_get_state(void) { return wifi_app_state; }
+
 void wifi_interface_start(
     struct smart_ring_connection_controller_t *connection_controller) {
-  ESP_LOGI(TAG, "STARTING WIFI INTERFACE");
+  // The interface may already be started early in the boot
+  if (wifi_started)
+    return;
+  wifi_started = true;
 
-  // Create Wifi application event group
-  wifi_app_event_group = xEventGroupCreate();
+  ESP_LOGI(TAG, "STARTING WIFI INTERFACE");
 
-  // Start the WiFi application task
-  EventBits_t eventBits;
+  // Create Wifi application event group and the connectivity manager
+  wifi_events_init();
+  wifi_app_queue_handle =
+      xQueueCreate(WIFI_APP_QUEUE_LENGTH, sizeof(wifi_app_queue_message_t));
+  xTaskCreatePinnedToCore(&wifi_app_thread, "wifi_app_thread",
+                          WIFI_APP_TASK_STACK_SIZE, connection_controller,
+                          WIFI_APP_TASK_PRIORITY, NULL, WIFI_APP_TASK_CORE_ID);
 
   // Initialize the event handler
   wifi_app_event_handler_init();
@@ -187,7 +794,7 @@ void wifi_interface_start(
   if (err != ESP_OK) {
     printf("ERROR %s\n", esp_err_to_name(err));
   }
-  esp_netif_create_default_wifi_sta();
+  wifi_netif_sta = esp_netif_create_default_wifi_sta();
   connection_controller->wifi_controller.esp_netif_ap =
       esp_netif_create_default_wifi_ap();
 
@@ -197,24 +804,26 @@ void wifi_interface_start(
 
   // Define AP config if device is not provisioned
   if (!connection_controller->is_provisioned) {
+    wifi_app_set_state(WIFI_STATE_PROVISIONING);
     wifi_ap_init(connection_controller);
   } else {
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     ESP_LOGI(TAG, "WIFI_APP_MSG_LOAD_SAVED_CREDENTIALS");
 
-    wifi_config_t sta_config = {};
-
-    strcpy(&sta_config.sta.ssid, &connection_controller->wifi_controller.ssid);
-    strcpy(&sta_config.sta.password,
-           &connection_controller->wifi_controller.password);
-
 #ifndef NDEBUG
     ESP_LOGI(TAG, "Using saved credentials\nSSID : %s\nPASS : %s",
-             (char *)&sta_config.sta.ssid, (char *)&sta_config.ap.password);
+             connection_controller->wifi_controller.ssid,
+             connection_controller->wifi_controller.password);
 #endif
-    esp_wifi_set_config(ESP_IF_WIFI_STA, &sta_config);
-    esp_wifi_connect();
+
+    // Connect directly to the last access point when there's one
+    if (nvs_load_wifi_network(&wifi_network) == ESP_OK) {
+      ESP_LOGI(TAG, "Last AP " MACSTR " on channel %d", MAC2STR(wifi_network.bssid),
+               wifi_network.channel);
+    }
+    wifi_app_send_message(WIFI_APP_MSG_CONNECT, 0);
   }
+  boot_profiler_mark("wifi started");
 }
 
 static void
@@ -272,31 +881,30 @@ wifi_ap_init(struct smart_ring_connection_controller_t *connection_controller) {
                                       &ap_config)); ///>Set our configuration
   ESP_ERROR_CHECK(esp_wifi_set_bandwidth(
       WIFI_IF_AP, WIFI_AP_BANDWIDTH)); ///> Our default bandwidth 20MHz
-  ESP_ERROR_CHECK(
-      esp_wifi_set_ps(WIFI_STA_POWER_SAVE)); ///> Power save set to "NONE"
+  ESP_ERROR_CHECK(esp_wifi_set_ps(
+      WIFI_PS_NONE)); ///> No power save while provisioning, the station is
+                      ///> set to WIFI_STA_POWER_SAVE once connected
+  power_save = WIFI_PS_NONE;
 }
 
 int8_t wifi_get_rssi() {
   wifi_ap_record_t ap_record;
+  struct link_quality_summary_t summary;
 
-  ESP_LOGI(TAG, "Getting WiFi RSSI");
-
-  esp_wifi_sta_get_ap_info(&ap_record);
+  if (esp_wifi_sta_get_ap_info(&ap_record) != ESP_OK) {
+    smart_ring_ui_set_rssi_level(0);
+    return INT8_MIN;
+  }
 
 #ifndef NDEBUG
   ESP_LOGI(TAG, "RSSI %d", ap_record.rssi);
 #endif
 
-  // Set the ui new level
-  if (ap_record.rssi > -50) {
-    smart_ring_ui_set_rssi_level(3);
-  } else if (ap_record.rssi > -70) {
-    smart_ring_ui_set_rssi_level(2);
-  } else if (ap_record.rssi > -90) {
-    smart_ring_ui_set_rssi_level(1);
-  } else {
-    smart_ring_ui_set_rssi_level(0);
-  }
+  // Set the ui new level from the window, so a single sample doesn't make
+  // the icon flicker
+  link_quality_add_rssi(ap_record.rssi);
+  link_quality_get_summary(&summary);
+  smart_ring_ui_set_rssi_level(summary.level);
 
   return ap_record.rssi;
 }
@@ -34,15 +34,9 @@ window.onload = () => {
         document.querySelector(".input").style.display = "none";
         document.querySelector(".result").style.display = "flex";
 
-        $.ajax({
-            url: "/provision",
-            type: "GET",
-            dataType: "json", // added data type
-            headers: { ssid: network, pass: password },
-            success: function (res) {
-                provision_status();
-                interval = setInterval(provision_status, 2500);
-            },
+        get_json("/provision", { ssid: network, pass: password }).then(() => {
+            provision_status();
+            interval = setInterval(provision_status, 2500);
         });
     });
 
@@ -53,7 +47,7 @@ window.onload = () => {
             return;
         }
 
-        network = active_element.innerHTML;
+        network = active_element.textContent;
         document.querySelector("#wifi").innerHTML = network;
         document.querySelector(".form1").style.display = "none";
         document.querySelector(".form2").style.display = "flex";
@@ -62,56 +56,57 @@ window.onload = () => {
     scan_networks();
 };
 
-async function provision_status() {
-    await $.ajax({
-        url: "/status",
-        type: "GET",
-        dataType: "json",
-        success: function (res) {
-            var code = res.status;
+// Request a JSON document from the device
+function get_json(url, headers) {
+    return fetch(url, { headers: headers || {} }).then((res) => res.json());
+}
 
-            if (code == 0) {
-                document.querySelector("#state").innerHTML =
-                    "A conectar-se à rede";
-            } else if (code == 1) {
-                document.querySelector("#state").innerHTML = "Conectado";
-                document.querySelector("#final").style.opacity = 1;
-                clearInterval(interval);
-            } else if (code == 2) {
-                document.querySelector("#state").innerHTML = "Erro";
-                clearInterval(interval);
-            }
-        },
+function provision_status() {
+    get_json("/status").then((res) => {
+        var code = res.status;
+
+        if (code == 0) {
+            document.querySelector("#state").innerHTML =
+                "A conectar-se à rede";
+        } else if (code == 1) {
+            document.querySelector("#state").innerHTML = "Conectado";
+            document.querySelector("#final").style.opacity = 1;
+            clearInterval(interval);
+        } else if (code == 2) {
+            document.querySelector("#state").innerHTML = "Erro";
+            clearInterval(interval);
+        }
     });
 }
 
 function scan_networks() {
     // Request the surrounding networks from the device
-    $.ajax({
-        url: "/scan_networks",
-        type: "GET",
-        dataType: "json", // added data type
-        success: function (res) {
-            document.querySelector(".redes").innerHTML = "";
-            res.forEach((wifi) => {
-                var wifi_node = document.createElement("p");
-                wifi_node.innerHTML = wifi;
-                document.querySelector(".redes").appendChild(wifi_node);
-            });
+    get_json("/scan_networks").then((res) => {
+        // The first scan may still be running
+        if (res.length === 0) {
+            setTimeout(scan_networks, 2000);
+            return;
+        }
 
-            document
-                .querySelector(".redes")
-                .querySelectorAll("p")
-                .forEach((element) => {
-                    element.addEventListener("click", () => {
-                        var active_element = document.querySelector(".active");
-                        console.log(active_element);
-                        if (active_element != null) {
-                            active_element.classList.remove("active");
-                        }
-                        element.classList.add("active");
-                    });
+        document.querySelector(".redes").innerHTML = "";
+        res.forEach((wifi) => {
+            var wifi_node = document.createElement("p");
+            wifi_node.textContent = wifi.ssid;
+            document.querySelector(".redes").appendChild(wifi_node);
+        });
+
+        document
+            .querySelector(".redes")
+            .querySelectorAll("p")
+            .forEach((element) => {
+                element.addEventListener("click", () => {
+                    var active_element = document.querySelector(".active");
+                    console.log(active_element);
+                    if (active_element != null) {
+                        active_element.classList.remove("active");
+                    }
+                    element.classList.add("active");
                 });
-        },
+            });
     });
 }
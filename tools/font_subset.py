@@ -0,0 +1,332 @@
+#!/usr/bin/env python
+#
+# Subset the LVGL fonts of the UI to the characters it can draw.
+#
+# The fonts in components/smart_ring_ui/fonts are generated by lv_font_conv
+# with many more glyphs than the UI shows. The glyphs kept are the characters
+# of the string literals of the sources, with the LV_SYMBOL_* macros they
+# use, and the characters of the charset file, for the text received at run
+# time (device names, networks, products...). Every font is written to a
+# single C file under the same lv_font_t name, with the kerning classes of the
+# glyphs dropped reduced to the ones still used.
+#
+# With --compress the bitmaps are compressed with the RLE of lv_font_conv,
+# decoded by LVGL, and the font draws them through the glyph cache of
+# components/smart_ring_ui/fonts/font_cache.c.
+#
+# Usage: font_subset.py --output <font_assets.c> --charset <charset.txt> [--symbols <lv_symbol_def.h>]
+#                       [--compress] --sources <file.c> [...] --fonts <font.c> [...]
+#
+
+import argparse
+import re
+
+# LV_FONT_FMT_TXT_* of lv_font_fmt_txt.h
+FMT_TXT_PLAIN = 0
+FMT_TXT_COMPRESSED = 1
+
+# Shortest range of consecutive characters in a cmap of its own
+CMAP_RANGE_MIN = 8
+
+# C string literals, with the comments skipped
+C_TOKENS = re.compile(r'//[^\n]*|/\*.*?\*/|\'(?:[^\'\\\n]|\\.)*\'|"((?:[^"\\\n]|\\.)*)"', re.S)
+C_ESCAPES = {'n': 10, 't': 9, 'r': 13, '0': 0, 'a': 7, 'b': 8, 'f': 12, 'v': 11}
+
+
+def c_string(literal):
+    """Characters of the body of a C string literal, UTF-8 encoded"""
+    data = bytearray()
+    i = 0
+    while i < len(literal):
+        if literal[i] != '\\':
+            data += literal[i].encode('utf-8')
+            i += 1
+            continue
+        escape = literal[i + 1]
+        if escape == 'x':
+            digits = re.match(r'[0-9A-Fa-f]+', literal[i + 2:]).group(0)
+            data.append(int(digits, 16) & 0xff)
+            i += 2 + len(digits)
+        elif escape in '01234567':
+            digits = re.match(r'[0-7]{1,3}', literal[i + 1:]).group(0)
+            data.append(int(digits, 8) & 0xff)
+            i += 1 + len(digits)
+        else:
+            data.append(C_ESCAPES.get(escape, ord(escape)))
+            i += 2
+    return data.decode('utf-8', errors='ignore')
+
+
+def read_symbols(path):
+    """Characters of the LV_SYMBOL_* macros"""
+    with open(path, encoding='utf-8') as header:
+        return {name: c_string(value) for name, value in
+                re.findall(r'#define\s+(LV_SYMBOL_\w+)\s+"([^"]*)"', header.read())}
+
+
+def read_charset(paths, charset, symbols):
+    """Characters of the string literals and the symbols used by the sources, and of the charset file"""
+    chars = set()
+    for path in paths:
+        with open(path, encoding='utf-8', errors='ignore') as source:
+            code = source.read()
+        for match in C_TOKENS.finditer(code):
+            if match.group(1) is not None:
+                chars.update(c_string(match.group(1)))
+        code = C_TOKENS.sub(lambda match: match.group(0) if match.group(1) is not None else ' ', code)
+        for name in re.findall(r'\bLV_SYMBOL_\w+', code):
+            chars.update(symbols.get(name, ''))
+
+    # Every character of the lines that aren't comments
+    with open(charset, encoding='utf-8') as keep:
+        for line in keep:
+            if not line.startswith('#'):
+                chars.update(line.rstrip('\r\n'))
+
+    return set(ord(c) for c in chars if ord(c) >= 0x20)
+
+
+def c_array_values(code, name):
+    body = re.search(r'\b%s\[\]\s*=\s*\{(.*?)\};' % name, code, re.S).group(1)
+    return [int(value, 0) for value in re.findall(r'-?(?:0x[0-9a-fA-F]+|\d+)', re.sub(r'/\*.*?\*/', '', body, flags=re.S))]
+
+
+def c_field(code, name):
+    return int(re.search(r'\.%s\s*=\s*(-?\d+)' % name, code).group(1))
+
+
+def read_font(path):
+    """Glyphs of an lv_font_conv font, by character, and its metrics and kerning classes"""
+    with open(path, encoding='utf-8') as source:
+        code = source.read()
+
+    font = {'name': re.search(r'lv_font_t\s+(\w+)\s*=', code).group(1)}
+    for field in ('line_height', 'base_line', 'underline_position', 'underline_thickness', 'bpp', 'kern_scale'):
+        font[field] = c_field(code, field)
+    if c_field(code, 'bitmap_format') != FMT_TXT_PLAIN or c_field(code, 'kern_classes') != 1:
+        raise ValueError('%s: only fonts not compressed, with kerning classes' % path)
+
+    # The glyphs are in the order of their ids, each after its character
+    bitmap = re.search(r'(?:gylph|glyph)_bitmap\[\]\s*=\s*\{(.*?)\};', code, re.S).group(1)
+    letters = [int(letter, 16) for letter in re.findall(r'/\* U\+([0-9A-F]+) ', bitmap)]
+    data = bytes(int(value, 16) for value in re.findall(r'0x[0-9a-fA-F]+', re.sub(r'/\*.*?\*/', '', bitmap, flags=re.S)))
+    dscs = re.findall(r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), '
+                      r'\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}', code)
+    left = c_array_values(code, 'kern_left_class_mapping')
+    right = c_array_values(code, 'kern_right_class_mapping')
+    if not len(letters) + 1 == len(dscs) == len(left) == len(right):
+        raise ValueError('%s: %d glyphs, %d descriptors' % (path, len(letters), len(dscs) - 1))
+
+    font['glyphs'] = {}
+    for gid, letter in enumerate(letters, 1):
+        index, adv_w, box_w, box_h, ofs_x, ofs_y = (int(value) for value in dscs[gid])
+        size = (box_w * box_h * font['bpp'] + 7) // 8
+        font['glyphs'][letter] = {'bitmap': data[index:index + size], 'adv_w': adv_w, 'box_w': box_w,
+                                  'box_h': box_h, 'ofs_x': ofs_x, 'ofs_y': ofs_y,
+                                  'left': left[gid], 'right': right[gid]}
+
+    font['left_cnt'] = c_field(code, 'left_class_cnt')
+    font['right_cnt'] = c_field(code, 'right_class_cnt')
+    font['kern'] = c_array_values(code, 'kern_class_values')
+    font['size'] = len(data) + len(dscs) * 16 + len(left) + len(right) + len(font['kern'])
+    return font
+
+
+def pixels(glyph, bpp):
+    """Values of the pixels of a plain bitmap, rows first"""
+    bits = ''.join('{:08b}'.format(byte) for byte in glyph['bitmap'])
+    return [int(bits[i * bpp:(i + 1) * bpp], 2) for i in range(glyph['box_w'] * glyph['box_h'])]
+
+
+def compress(glyph, bpp):
+    """RLE of lv_font_conv, decoded by rle_next of lv_font_fmt_txt.c, of the rows XORed with the previous one"""
+    values = pixels(glyph, bpp)
+    width = glyph['box_w']
+    values = values[:width] + [values[i] ^ values[i - width] for i in range(width, len(values))]
+
+    bits = []
+
+    def put(value, length):
+        bits.append('{:0{}b}'.format(value, length))
+
+    # After two equal values every value is a bit, 1 for the same value again.
+    # The 11th same value is followed by the count - 1 of the next ones
+    i = 0
+    while i < len(values):
+        put(values[i], bpp)
+        i += 1
+        if i < 2 or values[i - 1] != values[i - 2]:
+            continue
+        repeat = 0
+        while i < len(values):
+            if values[i] != values[i - 1]:
+                put(0, 1)
+                put(values[i], bpp)
+                i += 1
+                break
+            put(1, 1)
+            repeat += 1
+            i += 1
+            if repeat == 11:
+                count = 0
+                while i + count < len(values) and count < 62 and values[i + count] == values[i - 1]:
+                    count += 1
+                put(count + 1, 6)
+                i += count
+                # The value after the counted ones is written whole
+                if i < len(values):
+                    put(values[i], bpp)
+                    i += 1
+                break
+
+    stream = ''.join(bits)
+    stream += '0' * (-len(stream) % 8)
+    return bytes(int(stream[i:i + 8], 2) for i in range(0, len(stream), 8))
+
+
+def cmaps(letters):
+    """Ranges of consecutive characters and lists of the others between them"""
+    runs = []
+    for letter in letters:
+        if runs and letter == runs[-1][-1] + 1:
+            runs[-1].append(letter)
+        else:
+            runs.append([letter])
+
+    maps = []
+    for run in runs:
+        if len(run) >= CMAP_RANGE_MIN:
+            maps.append(('range', run))
+        elif maps and maps[-1][0] == 'list':
+            maps[-1][1].extend(run)
+        else:
+            maps.append(('list', list(run)))
+    return maps
+
+
+def c_array(values, fmt='0x%02x', per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(fmt % value for value in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def subset(font, chars, compressed):
+    """C code of the font with only the glyphs of the characters"""
+    name = font['name']
+    letters = sorted(letter for letter in font['glyphs'] if letter in chars)
+    maps = cmaps(letters)
+    # The ids follow the order of the cmaps, which follow the characters
+    glyphs = [font['glyphs'][letter] for letter in letters]
+
+    # Kerning classes still used, the others are dropped
+    left_classes = sorted(set(glyph['left'] for glyph in glyphs) - {0})
+    right_classes = sorted(set(glyph['right'] for glyph in glyphs) - {0})
+    left_ids = {cls: i + 1 for i, cls in enumerate(left_classes)}
+    right_ids = {cls: i + 1 for i, cls in enumerate(right_classes)}
+    kern = [font['kern'][(left - 1) * font['right_cnt'] + right - 1] for left in left_classes for right in right_classes]
+
+    bitmap = bytearray()
+    dscs = ['    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,']
+    for letter, glyph in zip(letters, glyphs):
+        dscs.append('    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}, '
+                    '/* U+%04X */' % (len(bitmap), glyph['adv_w'], glyph['box_w'], glyph['box_h'], glyph['ofs_x'],
+                                      glyph['ofs_y'], letter))
+        bitmap += compress(glyph, font['bpp']) if compressed and glyph['box_w'] else glyph['bitmap']
+    # The RLE decoder reads a byte after the last value
+    bitmap += b'\x00'
+
+    out = ['/* %s: %d of %d glyphs */' % (name, len(letters), len(font['glyphs'])), '',
+           'static LV_ATTRIBUTE_LARGE_CONST const uint8_t %s_bitmap[] = {' % name, c_array(bitmap), '};', '',
+           'static const lv_font_fmt_txt_glyph_dsc_t %s_glyph_dsc[] = {' % name] + dscs + ['};', '']
+
+    cmap_lines = []
+    gid = 1
+    for i, (kind, codes) in enumerate(maps):
+        if kind == 'range':
+            cmap_lines.append('    {.range_start = %d, .range_length = %d, .glyph_id_start = %d, .unicode_list = NULL, '
+                              '.glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},'
+                              % (codes[0], len(codes), gid))
+        else:
+            out += ['static const uint16_t %s_unicode_list_%d[] = {' % (name, i),
+                    c_array([code - codes[0] for code in codes], '0x%x', 8), '};', '']
+            cmap_lines.append('    {.range_start = %d, .range_length = %d, .glyph_id_start = %d, .unicode_list = '
+                              '%s_unicode_list_%d, .glyph_id_ofs_list = NULL, .list_length = %d, .type = '
+                              'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY},' % (codes[0], codes[-1] - codes[0] + 1, gid, name, i,
+                                                                      len(codes)))
+        gid += len(codes)
+    out += ['static const lv_font_fmt_txt_cmap_t %s_cmaps[] = {' % name] + cmap_lines + ['};', '']
+
+    out += ['static const uint8_t %s_kern_left_class_mapping[] = {' % name,
+            c_array([0] + [left_ids.get(glyph['left'], 0) for glyph in glyphs], '%d'), '};', '',
+            'static const uint8_t %s_kern_right_class_mapping[] = {' % name,
+            c_array([0] + [right_ids.get(glyph['right'], 0) for glyph in glyphs], '%d'), '};', '',
+            'static const int8_t %s_kern_class_values[] = {' % name, c_array(kern or [0], '%d'), '};', '',
+            'static const lv_font_fmt_txt_kern_classes_t %s_kern_classes = {' % name,
+            '    .class_pair_values   = %s_kern_class_values,' % name,
+            '    .left_class_mapping  = %s_kern_left_class_mapping,' % name,
+            '    .right_class_mapping = %s_kern_right_class_mapping,' % name,
+            '    .left_class_cnt      = %d,' % len(left_classes),
+            '    .right_class_cnt     = %d,' % len(right_classes),
+            '};', '',
+            'static lv_font_fmt_txt_dsc_t %s_dsc = {' % name,
+            '    .glyph_bitmap = %s_bitmap,' % name,
+            '    .glyph_dsc = %s_glyph_dsc,' % name,
+            '    .cmaps = %s_cmaps,' % name,
+            '    .kern_dsc = &%s_kern_classes,' % name,
+            '    .kern_scale = %d,' % font['kern_scale'],
+            '    .cmap_num = %d,' % len(maps),
+            '    .bpp = %d,' % font['bpp'],
+            '    .kern_classes = 1,',
+            '    .bitmap_format = %d,' % (FMT_TXT_COMPRESSED if compressed else FMT_TXT_PLAIN),
+            '};', '',
+            'lv_font_t %s = {' % name,
+            '    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,',
+            '    .get_glyph_bitmap = %s,' % ('font_cache_get_bitmap' if compressed else 'lv_font_get_bitmap_fmt_txt'),
+            '    .line_height = %d,' % font['line_height'],
+            '    .base_line = %d,' % font['base_line'],
+            '    .subpx = LV_FONT_SUBPX_NONE,',
+            '    .underline_position = %d,' % font['underline_position'],
+            '    .underline_thickness = %d,' % font['underline_thickness'],
+            '    .dsc = &%s_dsc,' % name,
+            '};', '']
+
+    size = len(bitmap) + len(dscs) * 16 + 2 * (len(letters) + 1) + len(kern)
+    return out, len(letters), size
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Subset the LVGL fonts of the UI to the characters it can draw')
+    parser.add_argument('--output', required=True, help='C file of the fonts')
+    parser.add_argument('--charset', required=True, help='Characters kept besides the ones of the sources')
+    parser.add_argument('--symbols', help='lv_symbol_def.h of LVGL, for the LV_SYMBOL_* macros of the sources')
+    parser.add_argument('--compress', action='store_true', help='Compress the bitmaps of the glyphs')
+    parser.add_argument('--sources', nargs='+', required=True, help='Sources of the UI strings')
+    parser.add_argument('--fonts', nargs='+', required=True, help='Fonts generated by lv_font_conv')
+    args = parser.parse_args()
+
+    symbols = read_symbols(args.symbols) if args.symbols else {}
+    chars = read_charset(args.sources, args.charset, symbols)
+
+    out = ['/* Generated by tools/font_subset.py, do not edit */', '',
+           '#include "lvgl.h"', '#include "font_cache.h"', '']
+    glyphs_total = kept_total = size_total = subset_total = 0
+
+    for path in args.fonts:
+        font = read_font(path)
+        code, kept, size = subset(font, chars, args.compress)
+        out += code
+        glyphs_total += len(font['glyphs'])
+        kept_total += kept
+        size_total += font['size']
+        subset_total += size
+
+    with open(args.output, 'w') as output:
+        output.write('\n'.join(out))
+
+    print('%d fonts, %d of %d glyphs, %d bytes from %d' % (len(args.fonts), kept_total, glyphs_total, subset_total,
+                                                           size_total))
+
+
+if __name__ == '__main__':
+    main()
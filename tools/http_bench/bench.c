@@ -0,0 +1,517 @@
+/**
+ * @file bench.c
+ * @brief
+ * Load test of the provisioning HTTP server (main/src/http_server.c) on the
+ * host. The server is built against the POSIX shim of esp_http_server and is
+ * driven over loopback by simulated phones connected to the SoftAP: each one
+ * loads the page (spread over a few connections, like a browser), asks for the
+ * surrounding networks and then polls the provision status.
+ *
+ * Reports requests per second, latency percentiles per URI and the peak heap
+ * used by the server (allocations, session data and task stacks).
+ *
+ * Usage: http_bench [-c phones] [-k connections] [-d seconds] [-p poll_ms]
+ *                   [-n polls] [-s max_open_sockets] [-u max_uri_handlers]
+ *                   [-t stack_size] [-l] [-r] [-v]
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "libs.h"
+
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#undef malloc
+#undef free
+
+/// Latency samples kept per URI
+#define BENCH_MAX_SAMPLES 200000
+/// Phones simulated by default, as WIFI_AP_MAX_CONNECTIONS in vars.h
+#define BENCH_PHONES 5
+/// Connection attempts before a request is counted as failed
+#define BENCH_CONNECT_RETRIES 50
+
+/// URIs requested on each page load, in the order the browser finds them
+static const char *page_uris[] = {
+    "/",
+#ifndef CONFIG_SR_WEBPAGE_BUNDLE
+    "/index.css",
+    "/app.js",
+    "/quantum_leap.png",
+    "/fonte_viva.png",
+#endif
+    "/scan_networks",
+};
+
+#define BENCH_PAGE_URIS (sizeof(page_uris) / sizeof(page_uris[0]))
+/// Index of the status URI in the statistics
+#define BENCH_STATUS_URI BENCH_PAGE_URIS
+#define BENCH_URIS (BENCH_PAGE_URIS + 1)
+
+struct bench_stats
+{
+  const char *uri;
+  double *samples;
+  size_t n_samples;
+  size_t not_modified;
+  size_t errors;
+  size_t bytes;
+};
+
+struct bench_options
+{
+  int phones;
+  int connections;
+  int duration;
+  int poll_ms;
+  int polls;
+  int max_open_sockets;
+  int max_uri_handlers;
+  int stack_size;
+  bool lru_purge;
+  bool revalidate;
+};
+
+static struct bench_options options = {
+    .phones = BENCH_PHONES,
+    .connections = 3,
+    .duration = 10,
+    .poll_ms = 250,
+    .polls = 8,
+    .max_open_sockets = -1,
+    .max_uri_handlers = -1,
+    .stack_size = -1,
+    .lru_purge = false,
+    .revalidate = true,
+};
+
+static struct bench_stats stats[BENCH_URIS];
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+static size_t reconnects = 0;
+static volatile bool bench_running = true;
+
+/// ETags received by any phone, sent back as If-None-Match on reloads
+static char etags[BENCH_PAGE_URIS][64];
+
+static double bench_now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void bench_config_hook(httpd_config_t *config)
+{
+  config->server_port = 0;
+  if (options.max_open_sockets > 0)
+  {
+    config->max_open_sockets = options.max_open_sockets;
+  }
+  if (options.max_uri_handlers > 0)
+  {
+    config->max_uri_handlers = options.max_uri_handlers;
+  }
+  if (options.stack_size > 0)
+  {
+    config->stack_size = options.stack_size;
+  }
+  config->lru_purge_enable = options.lru_purge;
+}
+
+static int bench_connect(void)
+{
+  struct sockaddr_in addr = {
+      .sin_family = AF_INET,
+      .sin_port = htons(shim_httpd_port),
+      .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+  };
+
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct timeval timeout = {.tv_sec = 15};
+  int nodelay = 1;
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+  if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+  {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * @brief
+ * Read a whole response (Content-Length or chunked body)
+ *
+ * @return Status code, or -1 if the connection failed
+ */
+static int bench_read_response(int fd, size_t *bytes, char *etag, size_t etag_size)
+{
+  static __thread char buffer[256 * 1024];
+  size_t len = 0;
+  char *body = NULL;
+
+  while (body == NULL)
+  {
+    ssize_t received = recv(fd, buffer + len, sizeof(buffer) - len - 1, 0);
+    if (received <= 0)
+    {
+      return -1;
+    }
+    len += received;
+    buffer[len] = '\0';
+    body = strstr(buffer, "\r\n\r\n");
+  }
+  body += 4;
+
+  int status = atoi(buffer + 9);
+  const char *header = strcasestr(buffer, "\r\nETag: ");
+  if (header != NULL && header < body && etag != NULL)
+  {
+    sscanf(header + 8, "%63[^\r]", etag);
+  }
+
+  const char *content_length = strcasestr(buffer, "\r\nContent-Length: ");
+  bool chunked = strcasestr(buffer, "\r\nTransfer-Encoding: chunked") != NULL;
+  size_t header_len = body - buffer;
+
+  if (!chunked)
+  {
+    size_t total = header_len + (content_length != NULL ? strtoul(content_length + 18, NULL, 10) : 0);
+    while (len < total)
+    {
+      ssize_t received = recv(fd, buffer, sizeof(buffer) - 1 < total - len ? sizeof(buffer) - 1 : total - len, 0);
+      if (received <= 0)
+      {
+        return -1;
+      }
+      len += received;
+    }
+    *bytes += total;
+    return status;
+  }
+
+  // Chunked: read until the terminating chunk
+  while (strstr(body, "\r\n0\r\n\r\n") == NULL && strncmp(body, "0\r\n\r\n", 5) != 0)
+  {
+    ssize_t received = recv(fd, buffer + len, sizeof(buffer) - len - 1, 0);
+    if (received <= 0)
+    {
+      return -1;
+    }
+    len += received;
+    buffer[len] = '\0';
+  }
+  *bytes += len;
+  return status;
+}
+
+static void bench_record(size_t uri, double latency, int status, size_t bytes)
+{
+  pthread_mutex_lock(&stats_mutex);
+  struct bench_stats *s = &stats[uri];
+  if (status < 0 || status >= 400)
+  {
+    s->errors++;
+  }
+  else
+  {
+    if (s->n_samples < BENCH_MAX_SAMPLES)
+    {
+      s->samples[s->n_samples++] = latency;
+    }
+    s->not_modified += status == 304;
+    s->bytes += bytes;
+  }
+  pthread_mutex_unlock(&stats_mutex);
+}
+
+/**
+ * @brief
+ * Send one request on the connection, reconnecting when the server closed it
+ *
+ */
+static void bench_request(int *fd, size_t uri, const char *path)
+{
+  char request[256];
+  char etag[64] = {0};
+  int len;
+
+  pthread_mutex_lock(&stats_mutex);
+  if (uri < BENCH_PAGE_URIS && options.revalidate && etags[uri][0] != '\0')
+  {
+    len = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: gzip\r\nIf-None-Match: %s\r\n\r\n",
+                   path, etags[uri]);
+  }
+  else
+  {
+    len = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: gzip\r\n\r\n", path);
+  }
+  pthread_mutex_unlock(&stats_mutex);
+
+  for (int attempt = 0; attempt < BENCH_CONNECT_RETRIES && bench_running; attempt++)
+  {
+    if (*fd < 0)
+    {
+      *fd = bench_connect();
+      if (*fd < 0)
+      {
+        usleep(20 * 1000);
+        continue;
+      }
+    }
+
+    double start = bench_now();
+    size_t bytes = 0;
+    int status = -1;
+    if (send(*fd, request, len, MSG_NOSIGNAL) == len)
+    {
+      status = bench_read_response(*fd, &bytes, etag, sizeof(etag));
+    }
+
+    if (status < 0)
+    {
+      // Closed by the server (purged session or handler error), retry once reconnected
+      close(*fd);
+      *fd = -1;
+      pthread_mutex_lock(&stats_mutex);
+      reconnects++;
+      pthread_mutex_unlock(&stats_mutex);
+      continue;
+    }
+
+    bench_record(uri, bench_now() - start, status, bytes);
+
+    if (uri < BENCH_PAGE_URIS && etag[0] != '\0')
+    {
+      pthread_mutex_lock(&stats_mutex);
+      strcpy(etags[uri], etag);
+      pthread_mutex_unlock(&stats_mutex);
+    }
+    return;
+  }
+
+  // Requests interrupted by the end of the run aren't failures
+  if (bench_running)
+  {
+    bench_record(uri, 0, -1, 0);
+  }
+}
+
+struct bench_connection
+{
+  int index;
+  pthread_t thread;
+};
+
+/**
+ * @brief
+ * One browser connection: takes its share of the page URIs, then polls the
+ * provision status like app.js
+ *
+ */
+static void *bench_connection_thread(void *arg)
+{
+  struct bench_connection *connection = arg;
+  int fd = -1;
+
+  while (bench_running)
+  {
+    for (size_t i = connection->index; i < BENCH_PAGE_URIS && bench_running; i += options.connections)
+    {
+      bench_request(&fd, i, page_uris[i]);
+    }
+
+    if (connection->index == 0)
+    {
+      for (int i = 0; i < options.polls && bench_running; i++)
+      {
+        usleep(options.poll_ms * 1000);
+        bench_request(&fd, BENCH_STATUS_URI, "/status");
+      }
+    }
+    else
+    {
+      usleep(options.polls * options.poll_ms * 1000);
+    }
+  }
+
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+  return NULL;
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+  return x < y ? -1 : x > y;
+}
+
+static double bench_percentile(const struct bench_stats *s, double p)
+{
+  if (s->n_samples == 0)
+  {
+    return 0;
+  }
+  size_t i = (size_t)(p * (s->n_samples - 1));
+  return s->samples[i] * 1000;
+}
+
+static void bench_print_row(const struct bench_stats *s, double elapsed)
+{
+  printf("%-18s %8zu %8.1f %6zu %6zu %8.2f %8.2f %8.2f %8.2f %9zu\n", s->uri,
+         s->n_samples, s->n_samples / elapsed, s->not_modified, s->errors,
+         bench_percentile(s, 0.50), bench_percentile(s, 0.90),
+         bench_percentile(s, 0.99), bench_percentile(s, 1.0), s->bytes / 1024);
+}
+
+static void bench_usage(const char *name)
+{
+  fprintf(stderr,
+          "Usage: %s [options]\n"
+          "  -c phones            simultaneous phones (default %d)\n"
+          "  -k connections       connections per phone (default %d)\n"
+          "  -d seconds           duration (default %d)\n"
+          "  -p poll_ms           interval between status polls (default %d)\n"
+          "  -n polls             status polls between page loads (default %d)\n"
+          "  -s max_open_sockets  override the server configuration\n"
+          "  -u max_uri_handlers  override the server configuration\n"
+          "  -t stack_size        override the server task stack\n"
+          "  -l                   enable the LRU purge of sessions\n"
+          "  -r                   don't revalidate cached assets (cold browser cache)\n"
+          "  -v                   print the server logs\n",
+          name, options.phones, options.connections, options.duration,
+          options.poll_ms, options.polls);
+}
+
+int main(int argc, char **argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "c:k:d:p:n:s:u:t:lrvh")) != -1)
+  {
+    switch (opt)
+    {
+    case 'c':
+      options.phones = atoi(optarg);
+      break;
+    case 'k':
+      options.connections = atoi(optarg);
+      break;
+    case 'd':
+      options.duration = atoi(optarg);
+      break;
+    case 'p':
+      options.poll_ms = atoi(optarg);
+      break;
+    case 'n':
+      options.polls = atoi(optarg);
+      break;
+    case 's':
+      options.max_open_sockets = atoi(optarg);
+      break;
+    case 'u':
+      options.max_uri_handlers = atoi(optarg);
+      break;
+    case 't':
+      options.stack_size = atoi(optarg);
+      break;
+    case 'l':
+      options.lru_purge = true;
+      break;
+    case 'r':
+      options.revalidate = false;
+      break;
+    case 'v':
+      shim_log_enabled = true;
+      break;
+    default:
+      bench_usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (options.phones < 1 || options.connections < 1 || options.duration < 1)
+  {
+    bench_usage(argv[0]);
+    return 1;
+  }
+
+  for (size_t i = 0; i < BENCH_URIS; i++)
+  {
+    stats[i].uri = i < BENCH_PAGE_URIS ? page_uris[i] : "/status";
+    stats[i].samples = malloc(BENCH_MAX_SAMPLES * sizeof(double));
+  }
+
+  shim_httpd_config_hook = bench_config_hook;
+  size_t heap_idle = shim_heap_used();
+
+  if (http_server_start() != ESP_OK)
+  {
+    fprintf(stderr, "Could not start the HTTP server\n");
+    return 1;
+  }
+
+  size_t heap_started = shim_heap_used();
+  printf("Server on 127.0.0.1:%u, %zu URI handlers registered, %zu rejected\n",
+         shim_httpd_port, shim_httpd_handlers_registered, shim_httpd_handlers_rejected);
+  printf("%d phones x %d connections, %d s, status poll every %d ms\n\n",
+         options.phones, options.connections, options.duration, options.poll_ms);
+
+  // Give the background scan time to fill the cache, like a user joining the AP
+  usleep((shim_scan_time_ms + 200) * 1000);
+  shim_heap_reset_peak();
+
+  size_t n_connections = options.phones * options.connections;
+  struct bench_connection *connections = calloc(n_connections, sizeof(struct bench_connection));
+
+  double start = bench_now();
+  for (size_t i = 0; i < n_connections; i++)
+  {
+    connections[i].index = i % options.connections;
+    pthread_create(&connections[i].thread, NULL, bench_connection_thread, &connections[i]);
+  }
+
+  sleep(options.duration);
+  bench_running = false;
+
+  for (size_t i = 0; i < n_connections; i++)
+  {
+    pthread_join(connections[i].thread, NULL);
+  }
+  double elapsed = bench_now() - start;
+
+  printf("%-18s %8s %8s %6s %6s %8s %8s %8s %8s %9s\n", "uri", "requests",
+         "req/s", "304", "errors", "p50 ms", "p90 ms", "p99 ms", "max ms", "KiB");
+
+  struct bench_stats total = {.uri = "total", .samples = malloc(BENCH_MAX_SAMPLES * BENCH_URIS * sizeof(double))};
+  for (size_t i = 0; i < BENCH_URIS; i++)
+  {
+    qsort(stats[i].samples, stats[i].n_samples, sizeof(double), bench_compare);
+    bench_print_row(&stats[i], elapsed);
+
+    memcpy(total.samples + total.n_samples, stats[i].samples, stats[i].n_samples * sizeof(double));
+    total.n_samples += stats[i].n_samples;
+    total.not_modified += stats[i].not_modified;
+    total.errors += stats[i].errors;
+    total.bytes += stats[i].bytes;
+  }
+  qsort(total.samples, total.n_samples, sizeof(double), bench_compare);
+  bench_print_row(&total, elapsed);
+
+  printf("\nReconnections: %zu\n", reconnects);
+  printf("Heap: %zu B idle, %zu B after start, %zu B peak under load\n",
+         heap_idle, heap_started, shim_heap_peak());
+
+  http_server_stop();
+  return total.errors > 0 ? 2 : 0;
+}
@@ -0,0 +1,240 @@
+/**
+ * @file libs.h
+ * @brief
+ * Host replacement of main/include/libs.h, used to build http_server.c for the
+ * provisioning server benchmark. It declares the small subset of ESP-IDF and
+ * FreeRTOS used by the server, implemented on top of POSIX in shim.c.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef __LIBS_H_
+#define __LIBS_H_
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+/*** Heap accounting ***/
+
+/// Allocate and account the block in the benchmark heap statistics
+void *shim_malloc(size_t size);
+/// Release a block allocated by shim_malloc
+void shim_free(void *ptr);
+/// Bytes currently allocated through the shim
+size_t shim_heap_used(void);
+/// Highest value of shim_heap_used since the last reset
+size_t shim_heap_peak(void);
+/// Reset the heap peak to the current usage
+void shim_heap_reset_peak(void);
+
+#define malloc(size) shim_malloc(size)
+#define free(ptr) shim_free(ptr)
+
+size_t shim_strlcpy(char *dst, const char *src, size_t size);
+#define strlcpy shim_strlcpy
+
+/*** esp_err / esp_log ***/
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_NOT_FOUND 0x105
+#define ESP_ERR_NOT_SUPPORTED 0x106
+#define ESP_ERR_HTTPD_BASE 0xb000
+#define ESP_ERR_HTTPD_HANDLERS_FULL (ESP_ERR_HTTPD_BASE + 1)
+#define ESP_ERR_HTTPD_RESULT_TRUNC (ESP_ERR_HTTPD_BASE + 6)
+#define ESP_ERR_HTTPD_RESP_SEND (ESP_ERR_HTTPD_BASE + 8)
+
+const char *esp_err_to_name(esp_err_t code);
+
+/// Set by the benchmark to print the server logs
+extern bool shim_log_enabled;
+
+#define ESP_LOGI(tag, format, ...)                                             \
+  do                                                                           \
+  {                                                                            \
+    if (shim_log_enabled)                                                      \
+      printf("I (%s) " format "\n", tag, ##__VA_ARGS__);                       \
+  } while (0)
+#define ESP_LOGW ESP_LOGI
+#define ESP_LOGE ESP_LOGI
+
+/*** FreeRTOS ***/
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef struct shim_task *TaskHandle_t;
+typedef struct shim_mutex *SemaphoreHandle_t;
+typedef void *QueueHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY UINT32_MAX
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name,
+                                   uint32_t stack_size, void *parameters,
+                                   int priority, TaskHandle_t *handle, int core_id);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+
+/*** esp_wifi ***/
+
+typedef enum
+{
+  WIFI_AUTH_OPEN = 0,
+  WIFI_AUTH_WEP,
+  WIFI_AUTH_WPA_PSK,
+  WIFI_AUTH_WPA2_PSK,
+  WIFI_AUTH_WPA_WPA2_PSK,
+} wifi_auth_mode_t;
+
+typedef struct
+{
+  uint8_t ssid[33];
+  uint8_t primary;
+  int8_t rssi;
+  wifi_auth_mode_t authmode;
+} wifi_ap_record_t;
+
+typedef struct
+{
+  uint8_t *ssid;
+  uint8_t channel;
+  bool show_hidden;
+} wifi_scan_config_t;
+
+typedef union
+{
+  struct
+  {
+    uint8_t ssid[32];
+    uint8_t password[64];
+  } sta;
+} wifi_config_t;
+
+#define ESP_IF_WIFI_STA 0
+
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t *config, bool block);
+esp_err_t esp_wifi_scan_stop(void);
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t *number, wifi_ap_record_t *records);
+esp_err_t esp_wifi_set_config(int interface, wifi_config_t *conf);
+esp_err_t esp_wifi_connect(void);
+
+/// Duration of a simulated scan, in milliseconds
+extern unsigned int shim_scan_time_ms;
+
+/*** esp_http_server ***/
+
+typedef struct httpd_req
+{
+  /// Handle of the server that received the request
+  void *handle;
+  /// Method of the request
+  int method;
+  /// URI of the request
+  const char uri[512 + 1];
+  /// Length of the request body
+  size_t content_len;
+  /// User context given when the URI was registered
+  void *user_ctx;
+  /// Private data of the shim
+  void *aux;
+} httpd_req_t;
+
+typedef void *httpd_handle_t;
+
+typedef enum
+{
+  HTTP_GET = 1,
+  HTTP_POST = 3,
+} httpd_method_t;
+
+typedef struct httpd_uri
+{
+  const char *uri;
+  httpd_method_t method;
+  esp_err_t (*handler)(httpd_req_t *r);
+  void *user_ctx;
+} httpd_uri_t;
+
+typedef struct httpd_config
+{
+  unsigned task_priority;
+  size_t stack_size;
+  int core_id;
+  uint16_t server_port;
+  uint16_t ctrl_port;
+  uint16_t max_open_sockets;
+  uint16_t max_uri_handlers;
+  uint16_t max_resp_headers;
+  uint16_t backlog_conn;
+  bool lru_purge_enable;
+  uint16_t recv_wait_timeout;
+  uint16_t send_wait_timeout;
+} httpd_config_t;
+
+#define HTTPD_DEFAULT_CONFIG()                                                 \
+  {                                                                            \
+    .task_priority = 5, .stack_size = 4096, .core_id = 0x7FFFFFFF,             \
+    .server_port = 80, .ctrl_port = 32768, .max_open_sockets = 7,              \
+    .max_uri_handlers = 8, .max_resp_headers = 8, .backlog_conn = 5,           \
+    .lru_purge_enable = false, .recv_wait_timeout = 5,                         \
+    .send_wait_timeout = 5,                                                    \
+  }
+
+#define HTTPD_RESP_USE_STRLEN -1
+
+/// Called by httpd_start before the configuration is used, to let the
+/// benchmark override it (port, sockets, handlers)
+extern void (*shim_httpd_config_hook)(httpd_config_t *config);
+
+/// Port the shim server is listening on
+extern uint16_t shim_httpd_port;
+
+/// URI handlers registered and refused because max_uri_handlers was reached
+extern size_t shim_httpd_handlers_registered;
+extern size_t shim_httpd_handlers_rejected;
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config);
+esp_err_t httpd_stop(httpd_handle_t handle);
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler);
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field);
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size);
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status);
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type);
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value);
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len);
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len);
+
+/*** Application ***/
+
+struct smart_ring_controller_t;
+struct smart_ring_controller_t *smart_ring_get_controller(void);
+
+#include "http_server.h"
+
+#endif /* __LIBS_H_ */
@@ -0,0 +1,882 @@
+/**
+ * @file shim.c
+ * @brief
+ * POSIX implementation of the ESP-IDF and FreeRTOS subset declared in the
+ * benchmark libs.h. The HTTP server follows the esp_http_server model: a
+ * single task serving at most max_open_sockets sessions with select(), with
+ * blocking receives and sends bounded by the configured timeouts.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "libs.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+
+// The shim itself uses the C library allocator
+#undef malloc
+#undef free
+
+/// Maximum request header length, as CONFIG_HTTPD_MAX_REQ_HDR_LEN
+#define SHIM_HTTPD_MAX_REQ_HDR_LEN 512
+/// Maximum URI length, as CONFIG_HTTPD_MAX_URI_LEN
+#define SHIM_HTTPD_MAX_URI_LEN 512
+/// Size of the TCB accounted for every task
+#define SHIM_TASK_TCB_SIZE 360
+
+bool shim_log_enabled = false;
+unsigned int shim_scan_time_ms = 2000;
+uint16_t shim_httpd_port = 0;
+size_t shim_httpd_handlers_registered = 0;
+size_t shim_httpd_handlers_rejected = 0;
+void (*shim_httpd_config_hook)(httpd_config_t *config) = NULL;
+
+/*** Heap accounting ***/
+
+static pthread_mutex_t heap_mutex = PTHREAD_MUTEX_INITIALIZER;
+static size_t heap_used = 0;
+static size_t heap_peak = 0;
+
+static void shim_heap_account(ssize_t size)
+{
+  pthread_mutex_lock(&heap_mutex);
+  heap_used += size;
+  if (heap_used > heap_peak)
+  {
+    heap_peak = heap_used;
+  }
+  pthread_mutex_unlock(&heap_mutex);
+}
+
+void *shim_malloc(size_t size)
+{
+  size_t *block = malloc(sizeof(size_t) * 2 + size);
+  if (block == NULL)
+  {
+    return NULL;
+  }
+
+  block[0] = size;
+  shim_heap_account(size);
+  return block + 2;
+}
+
+void shim_free(void *ptr)
+{
+  if (ptr == NULL)
+  {
+    return;
+  }
+
+  size_t *block = (size_t *)ptr - 2;
+  shim_heap_account(-(ssize_t)block[0]);
+  free(block);
+}
+
+size_t shim_heap_used(void)
+{
+  pthread_mutex_lock(&heap_mutex);
+  size_t used = heap_used;
+  pthread_mutex_unlock(&heap_mutex);
+  return used;
+}
+
+size_t shim_heap_peak(void)
+{
+  pthread_mutex_lock(&heap_mutex);
+  size_t peak = heap_peak;
+  pthread_mutex_unlock(&heap_mutex);
+  return peak;
+}
+
+void shim_heap_reset_peak(void)
+{
+  pthread_mutex_lock(&heap_mutex);
+  heap_peak = heap_used;
+  pthread_mutex_unlock(&heap_mutex);
+}
+
+size_t shim_strlcpy(char *dst, const char *src, size_t size)
+{
+  size_t len = strlen(src);
+  if (size > 0)
+  {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+
+const char *esp_err_to_name(esp_err_t code)
+{
+  switch (code)
+  {
+  case ESP_OK:
+    return "ESP_OK";
+  case ESP_FAIL:
+    return "ESP_FAIL";
+  case ESP_ERR_NO_MEM:
+    return "ESP_ERR_NO_MEM";
+  case ESP_ERR_INVALID_ARG:
+    return "ESP_ERR_INVALID_ARG";
+  case ESP_ERR_INVALID_STATE:
+    return "ESP_ERR_INVALID_STATE";
+  case ESP_ERR_NOT_FOUND:
+    return "ESP_ERR_NOT_FOUND";
+  case ESP_ERR_HTTPD_HANDLERS_FULL:
+    return "ESP_ERR_HTTPD_HANDLERS_FULL";
+  default:
+    return "UNKNOWN ERROR";
+  }
+}
+
+/*** FreeRTOS ***/
+
+// Mutexes and binary semaphores alike, a binary semaphore may be given by
+// another task than the one taking it
+struct shim_mutex
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  bool available;
+};
+
+struct shim_task
+{
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  uint32_t notifications;
+  TaskFunction_t function;
+  void *parameters;
+  uint32_t stack_size;
+};
+
+static __thread struct shim_task *current_task = NULL;
+
+static void shim_deadline(struct timespec *deadline, TickType_t ticks)
+{
+  clock_gettime(CLOCK_REALTIME, deadline);
+  deadline->tv_sec += ticks / 1000;
+  deadline->tv_nsec += (long)(ticks % 1000) * 1000000L;
+  if (deadline->tv_nsec >= 1000000000L)
+  {
+    deadline->tv_sec++;
+    deadline->tv_nsec -= 1000000000L;
+  }
+}
+
+static SemaphoreHandle_t shim_semaphore_create(bool available)
+{
+  struct shim_mutex *mutex = malloc(sizeof(struct shim_mutex));
+  pthread_mutex_init(&mutex->mutex, NULL);
+  pthread_cond_init(&mutex->cond, NULL);
+  mutex->available = available;
+  return mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) { return shim_semaphore_create(true); }
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) { return shim_semaphore_create(false); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks)
+{
+  struct timespec deadline;
+  shim_deadline(&deadline, ticks);
+
+  pthread_mutex_lock(&mutex->mutex);
+  while (!mutex->available)
+  {
+    if (ticks == portMAX_DELAY)
+    {
+      pthread_cond_wait(&mutex->cond, &mutex->mutex);
+    }
+    else if (pthread_cond_timedwait(&mutex->cond, &mutex->mutex, &deadline) == ETIMEDOUT)
+    {
+      break;
+    }
+  }
+
+  BaseType_t taken = mutex->available ? pdTRUE : pdFALSE;
+  mutex->available = false;
+  pthread_mutex_unlock(&mutex->mutex);
+
+  return taken;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex)
+{
+  pthread_mutex_lock(&mutex->mutex);
+  mutex->available = true;
+  pthread_cond_signal(&mutex->cond);
+  pthread_mutex_unlock(&mutex->mutex);
+
+  return pdTRUE;
+}
+
+static void *shim_task_entry(void *arg)
+{
+  current_task = arg;
+  current_task->function(current_task->parameters);
+  vTaskDelete(NULL);
+  return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name,
+                                   uint32_t stack_size, void *parameters,
+                                   int priority, TaskHandle_t *handle, int core_id)
+{
+  struct shim_task *task = calloc(1, sizeof(struct shim_task));
+  pthread_mutex_init(&task->mutex, NULL);
+  pthread_cond_init(&task->cond, NULL);
+  task->function = function;
+  task->parameters = parameters;
+  task->stack_size = stack_size;
+
+  // On the device the stack and the TCB come from the heap
+  shim_heap_account(stack_size + SHIM_TASK_TCB_SIZE);
+
+  if (handle != NULL)
+  {
+    *handle = task;
+  }
+
+  pthread_create(&task->thread, NULL, shim_task_entry, task);
+  pthread_detach(task->thread);
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  if (task != NULL && task != current_task)
+  {
+    // Only self deletion is supported by the shim
+    return;
+  }
+
+  task = current_task;
+  shim_heap_account(-(ssize_t)(task->stack_size + SHIM_TASK_TCB_SIZE));
+  pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks) { usleep(ticks * 1000); }
+
+TickType_t xTaskGetTickCount(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (TickType_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+  struct shim_task *task = current_task;
+  struct timespec deadline;
+  shim_deadline(&deadline, ticks);
+
+  pthread_mutex_lock(&task->mutex);
+  while (task->notifications == 0)
+  {
+    if (pthread_cond_timedwait(&task->cond, &task->mutex, &deadline) == ETIMEDOUT)
+    {
+      break;
+    }
+  }
+
+  uint32_t value = task->notifications;
+  if (value > 0)
+  {
+    task->notifications = clear ? 0 : value - 1;
+  }
+  pthread_mutex_unlock(&task->mutex);
+
+  return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  pthread_mutex_lock(&task->mutex);
+  task->notifications++;
+  pthread_cond_signal(&task->cond);
+  pthread_mutex_unlock(&task->mutex);
+  return pdPASS;
+}
+
+/*** esp_wifi ***/
+
+/// Networks returned by the simulated scan, with repeated SSIDs as seen with
+/// mesh systems and dual band routers
+static const struct
+{
+  const char *ssid;
+  int8_t rssi;
+  uint8_t channel;
+  wifi_auth_mode_t authmode;
+} scan_networks[] = {
+    {"MEO-4F2A10", -48, 1, WIFI_AUTH_WPA2_PSK},
+    {"MEO-WiFi", -52, 1, WIFI_AUTH_OPEN},
+    {"NOS-8C21", -61, 6, WIFI_AUTH_WPA_WPA2_PSK},
+    {"Vodafone-C0FFEE", -66, 11, WIFI_AUTH_WPA2_PSK},
+    {"Fonte Viva", -44, 6, WIFI_AUTH_WPA2_PSK},
+    {"Fonte Viva", -71, 11, WIFI_AUTH_WPA2_PSK},
+    {"Fonte Viva Guest", -58, 6, WIFI_AUTH_OPEN},
+    {"", -63, 3, WIFI_AUTH_WPA2_PSK},
+    {"Armazem \"B\"", -80, 9, WIFI_AUTH_WPA_PSK},
+    {"DIRECT-7B-HP Printer", -75, 6, WIFI_AUTH_WPA2_PSK},
+    {"NOS-8C21", -83, 1, WIFI_AUTH_WPA_WPA2_PSK},
+    {"iPhone de Ana", -69, 11, WIFI_AUTH_WPA2_PSK},
+    {"Escritorio", -57, 4, WIFI_AUTH_WPA2_PSK},
+    {"Escritorio", -62, 9, WIFI_AUTH_WPA2_PSK},
+    {"Cozinha_EXT", -77, 4, WIFI_AUTH_WPA2_PSK},
+    {"eduroam", -85, 13, WIFI_AUTH_WPA2_PSK},
+    {"MEO-WiFi", -88, 13, WIFI_AUTH_OPEN},
+    {"Linksys00042", -90, 2, WIFI_AUTH_WEP},
+    {"TP-Link_3A9E", -73, 7, WIFI_AUTH_WPA2_PSK},
+    {"Galaxy A52 1F0D", -65, 1, WIFI_AUTH_WPA2_PSK},
+    {"ZON-5A31", -79, 5, WIFI_AUTH_WPA_WPA2_PSK},
+    {"Armazem A", -68, 8, WIFI_AUTH_WPA2_PSK},
+    {"Armazem A", -70, 12, WIFI_AUTH_WPA2_PSK},
+    {"CASA", -91, 10, WIFI_AUTH_WPA2_PSK},
+};
+
+static volatile bool scan_abort = false;
+
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t *config, bool block)
+{
+  scan_abort = false;
+  for (unsigned int elapsed = 0; elapsed < shim_scan_time_ms && !scan_abort; elapsed += 10)
+  {
+    usleep(10 * 1000);
+  }
+  return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_stop(void)
+{
+  scan_abort = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t *number, wifi_ap_record_t *records)
+{
+  size_t n = sizeof(scan_networks) / sizeof(scan_networks[0]);
+  if (*number < n)
+  {
+    n = *number;
+  }
+
+  for (size_t i = 0; i < n; i++)
+  {
+    shim_strlcpy((char *)records[i].ssid, scan_networks[i].ssid, sizeof(records[i].ssid));
+    records[i].rssi = scan_networks[i].rssi - (rand() % 5);
+    records[i].primary = scan_networks[i].channel;
+    records[i].authmode = scan_networks[i].authmode;
+  }
+
+  *number = n;
+  return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_config(int interface, wifi_config_t *conf) { return ESP_OK; }
+
+esp_err_t esp_wifi_connect(void) { return ESP_OK; }
+
+struct smart_ring_controller_t *smart_ring_get_controller(void) { return NULL; }
+
+/*** esp_http_server ***/
+
+struct shim_httpd_session
+{
+  int fd;
+  /// Request bytes received and not yet handled
+  char buffer[SHIM_HTTPD_MAX_REQ_HDR_LEN + SHIM_HTTPD_MAX_URI_LEN];
+  size_t buffer_len;
+  /// Last time the session was used, for the LRU purge
+  uint64_t last_used;
+};
+
+struct shim_httpd
+{
+  httpd_config_t config;
+  int listen_fd;
+  volatile bool running;
+  pthread_t thread;
+  httpd_uri_t *handlers;
+  size_t n_handlers;
+  struct shim_httpd_session **sessions;
+  uint64_t use_counter;
+};
+
+/// Request data private to the shim (httpd_req_t.aux)
+struct shim_httpd_req_aux
+{
+  struct shim_httpd_session *session;
+  /// Start of the headers in the session buffer, NUL terminated
+  char *headers;
+  const char *status;
+  const char *content_type;
+  const char *resp_hdr_fields[16];
+  const char *resp_hdr_values[16];
+  size_t n_resp_hdrs;
+  bool headers_sent;
+  bool chunked;
+  bool close;
+};
+
+static esp_err_t shim_send_all(int fd, const char *buf, size_t len)
+{
+  while (len > 0)
+  {
+    ssize_t sent = send(fd, buf, len, MSG_NOSIGNAL);
+    if (sent <= 0)
+    {
+      return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    buf += sent;
+    len -= sent;
+  }
+  return ESP_OK;
+}
+
+static const char *shim_find_header(httpd_req_t *r, const char *field, size_t *len)
+{
+  struct shim_httpd_req_aux *aux = r->aux;
+  size_t field_len = strlen(field);
+
+  for (char *line = aux->headers; line != NULL && *line != '\0';)
+  {
+    char *end = strstr(line, "\r\n");
+    if (end == NULL)
+    {
+      break;
+    }
+
+    if (strncasecmp(line, field, field_len) == 0 && line[field_len] == ':')
+    {
+      const char *value = line + field_len + 1;
+      while (*value == ' ')
+      {
+        value++;
+      }
+      *len = end - value;
+      return value;
+    }
+
+    line = end + 2;
+  }
+
+  return NULL;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field)
+{
+  size_t len = 0;
+  return shim_find_header(r, field, &len) != NULL ? len : 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size)
+{
+  size_t len = 0;
+  const char *value = shim_find_header(r, field, &len);
+  if (value == NULL)
+  {
+    return ESP_ERR_NOT_FOUND;
+  }
+
+  size_t n = len < val_size - 1 ? len : val_size - 1;
+  memcpy(val, value, n);
+  val[n] = '\0';
+  return n < len ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status)
+{
+  ((struct shim_httpd_req_aux *)r->aux)->status = status;
+  return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
+{
+  ((struct shim_httpd_req_aux *)r->aux)->content_type = type;
+  return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value)
+{
+  struct shim_httpd_req_aux *aux = r->aux;
+  struct shim_httpd *hd = r->handle;
+
+  if (aux->n_resp_hdrs >= hd->config.max_resp_headers)
+  {
+    return ESP_ERR_HTTPD_RESP_SEND;
+  }
+
+  aux->resp_hdr_fields[aux->n_resp_hdrs] = field;
+  aux->resp_hdr_values[aux->n_resp_hdrs] = value;
+  aux->n_resp_hdrs++;
+  return ESP_OK;
+}
+
+static esp_err_t shim_send_headers(httpd_req_t *r, ssize_t content_len)
+{
+  struct shim_httpd_req_aux *aux = r->aux;
+  char head[1024];
+  int len = snprintf(head, sizeof(head), "HTTP/1.1 %s\r\nContent-Type: %s\r\n",
+                     aux->status, aux->content_type);
+
+  if (content_len < 0)
+  {
+    len += snprintf(head + len, sizeof(head) - len, "Transfer-Encoding: chunked\r\n");
+  }
+  else
+  {
+    len += snprintf(head + len, sizeof(head) - len, "Content-Length: %zd\r\n", content_len);
+  }
+
+  for (size_t i = 0; i < aux->n_resp_hdrs; i++)
+  {
+    len += snprintf(head + len, sizeof(head) - len, "%s: %s\r\n",
+                    aux->resp_hdr_fields[i], aux->resp_hdr_values[i]);
+  }
+  len += snprintf(head + len, sizeof(head) - len, "\r\n");
+
+  aux->headers_sent = true;
+  return shim_send_all(aux->session->fd, head, len);
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+  if (buf_len == HTTPD_RESP_USE_STRLEN)
+  {
+    buf_len = buf != NULL ? strlen(buf) : 0;
+  }
+
+  esp_err_t err = shim_send_headers(r, buf_len);
+  if (err == ESP_OK && buf_len > 0)
+  {
+    err = shim_send_all(((struct shim_httpd_req_aux *)r->aux)->session->fd, buf, buf_len);
+  }
+  return err;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+  struct shim_httpd_req_aux *aux = r->aux;
+  esp_err_t err = ESP_OK;
+
+  if (buf_len == HTTPD_RESP_USE_STRLEN)
+  {
+    buf_len = buf != NULL ? strlen(buf) : 0;
+  }
+
+  if (!aux->headers_sent)
+  {
+    aux->chunked = true;
+    err = shim_send_headers(r, -1);
+  }
+
+  char size[16];
+  int size_len = snprintf(size, sizeof(size), "%zx\r\n", buf_len);
+  if (err == ESP_OK)
+  {
+    err = shim_send_all(aux->session->fd, size, size_len);
+  }
+  if (err == ESP_OK && buf_len > 0)
+  {
+    err = shim_send_all(aux->session->fd, buf, buf_len);
+  }
+  if (err == ESP_OK)
+  {
+    err = shim_send_all(aux->session->fd, "\r\n", 2);
+  }
+  return err;
+}
+
+static void shim_httpd_close_session(struct shim_httpd *hd, size_t index)
+{
+  close(hd->sessions[index]->fd);
+  shim_free(hd->sessions[index]);
+  hd->sessions[index] = NULL;
+}
+
+/**
+ * @brief
+ * Read one request from the session and run its handler. Like esp_http_server,
+ * the whole server blocks until the request headers are received.
+ *
+ * @return false The session must be closed
+ */
+static bool shim_httpd_serve(struct shim_httpd *hd, struct shim_httpd_session *session)
+{
+  char *end;
+  while ((end = memmem(session->buffer, session->buffer_len, "\r\n\r\n", 4)) == NULL)
+  {
+    if (session->buffer_len == sizeof(session->buffer))
+    {
+      shim_send_all(session->fd, "HTTP/1.1 431 Request Header Fields Too Large\r\nContent-Length: 0\r\n\r\n", 67);
+      return false;
+    }
+
+    ssize_t received = recv(session->fd, session->buffer + session->buffer_len,
+                            sizeof(session->buffer) - session->buffer_len, 0);
+    if (received <= 0)
+    {
+      return false;
+    }
+    session->buffer_len += received;
+  }
+
+  // Split the request line from the headers
+  end[2] = '\0';
+  char *line_end = strstr(session->buffer, "\r\n");
+  *line_end = '\0';
+
+  char method[8] = {0};
+  char uri[SHIM_HTTPD_MAX_URI_LEN + 1] = {0};
+  if (sscanf(session->buffer, "%7s %512s", method, uri) != 2)
+  {
+    return false;
+  }
+
+  char *query = strchr(uri, '?');
+  if (query != NULL)
+  {
+    *query = '\0';
+  }
+
+  struct shim_httpd_req_aux aux = {
+      .session = session,
+      .headers = line_end + 2,
+      .status = "200 OK",
+      .content_type = "text/html",
+  };
+  httpd_req_t req = {.handle = hd, .aux = &aux};
+  strcpy((char *)req.uri, uri);
+  req.method = strcmp(method, "POST") == 0 ? HTTP_POST : HTTP_GET;
+
+  char connection[16];
+  if (httpd_req_get_hdr_value_str(&req, "Connection", connection, sizeof(connection)) == ESP_OK)
+  {
+    aux.close = strcasecmp(connection, "close") == 0;
+  }
+
+  const httpd_uri_t *handler = NULL;
+  for (size_t i = 0; i < hd->n_handlers && handler == NULL; i++)
+  {
+    if (strcmp(hd->handlers[i].uri, uri) == 0 && hd->handlers[i].method == req.method)
+    {
+      handler = &hd->handlers[i];
+    }
+  }
+
+  bool keep = true;
+  if (handler == NULL)
+  {
+    aux.status = "404 Not Found";
+    keep = httpd_resp_send(&req, "Nothing matches the given URI", HTTPD_RESP_USE_STRLEN) == ESP_OK;
+  }
+  else
+  {
+    req.user_ctx = handler->user_ctx;
+    keep = handler->handler(&req) == ESP_OK;
+  }
+
+  // Keep the bytes of a pipelined request
+  size_t consumed = (end + 4) - session->buffer;
+  memmove(session->buffer, end + 4, session->buffer_len - consumed);
+  session->buffer_len -= consumed;
+
+  return keep && !aux.close;
+}
+
+static void *shim_httpd_thread(void *arg)
+{
+  struct shim_httpd *hd = arg;
+  size_t max_sessions = hd->config.max_open_sockets;
+
+  while (hd->running)
+  {
+    fd_set fds;
+    FD_ZERO(&fds);
+    int max_fd = -1;
+    size_t n_sessions = 0;
+
+    for (size_t i = 0; i < max_sessions; i++)
+    {
+      if (hd->sessions[i] != NULL)
+      {
+        FD_SET(hd->sessions[i]->fd, &fds);
+        max_fd = hd->sessions[i]->fd > max_fd ? hd->sessions[i]->fd : max_fd;
+        n_sessions++;
+      }
+    }
+
+    // Without free sessions new connections wait in the listen backlog
+    if (n_sessions < max_sessions || hd->config.lru_purge_enable)
+    {
+      FD_SET(hd->listen_fd, &fds);
+      max_fd = hd->listen_fd > max_fd ? hd->listen_fd : max_fd;
+    }
+
+    struct timeval timeout = {.tv_sec = 0, .tv_usec = 100000};
+    if (select(max_fd + 1, &fds, NULL, NULL, &timeout) <= 0)
+    {
+      continue;
+    }
+
+    for (size_t i = 0; i < max_sessions; i++)
+    {
+      struct shim_httpd_session *session = hd->sessions[i];
+      if (session != NULL && FD_ISSET(session->fd, &fds))
+      {
+        session->last_used = ++hd->use_counter;
+        if (!shim_httpd_serve(hd, session))
+        {
+          shim_httpd_close_session(hd, i);
+        }
+      }
+    }
+
+    if (!FD_ISSET(hd->listen_fd, &fds))
+    {
+      continue;
+    }
+
+    int fd = accept(hd->listen_fd, NULL, NULL);
+    if (fd < 0)
+    {
+      continue;
+    }
+
+    size_t slot = max_sessions;
+    size_t lru = 0;
+    for (size_t i = 0; i < max_sessions; i++)
+    {
+      if (hd->sessions[i] == NULL)
+      {
+        slot = slot == max_sessions ? i : slot;
+      }
+      else if (hd->sessions[lru] == NULL || hd->sessions[i]->last_used < hd->sessions[lru]->last_used)
+      {
+        lru = i;
+      }
+    }
+
+    if (slot == max_sessions)
+    {
+      shim_httpd_close_session(hd, lru);
+      slot = lru;
+    }
+
+    struct timeval recv_timeout = {.tv_sec = hd->config.recv_wait_timeout};
+    struct timeval send_timeout = {.tv_sec = hd->config.send_wait_timeout};
+    int nodelay = 1;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &recv_timeout, sizeof(recv_timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &send_timeout, sizeof(send_timeout));
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+    struct shim_httpd_session *session = shim_malloc(sizeof(struct shim_httpd_session));
+    session->fd = fd;
+    session->buffer_len = 0;
+    session->last_used = ++hd->use_counter;
+    hd->sessions[slot] = session;
+  }
+
+  for (size_t i = 0; i < max_sessions; i++)
+  {
+    if (hd->sessions[i] != NULL)
+    {
+      shim_httpd_close_session(hd, i);
+    }
+  }
+
+  return NULL;
+}
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
+{
+  struct shim_httpd *hd = shim_malloc(sizeof(struct shim_httpd));
+  memset(hd, 0, sizeof(*hd));
+  hd->config = *config;
+
+  if (shim_httpd_config_hook != NULL)
+  {
+    shim_httpd_config_hook(&hd->config);
+  }
+
+  hd->handlers = shim_malloc(hd->config.max_uri_handlers * sizeof(httpd_uri_t));
+  hd->sessions = shim_malloc(hd->config.max_open_sockets * sizeof(struct shim_httpd_session *));
+  memset(hd->sessions, 0, hd->config.max_open_sockets * sizeof(struct shim_httpd_session *));
+
+  hd->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  int reuse = 1;
+  setsockopt(hd->listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  struct sockaddr_in addr = {
+      .sin_family = AF_INET,
+      .sin_port = htons(hd->config.server_port),
+      .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+  };
+  socklen_t addr_len = sizeof(addr);
+
+  if (bind(hd->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+      listen(hd->listen_fd, hd->config.backlog_conn) != 0 ||
+      getsockname(hd->listen_fd, (struct sockaddr *)&addr, &addr_len) != 0)
+  {
+    close(hd->listen_fd);
+    shim_free(hd->sessions);
+    shim_free(hd->handlers);
+    shim_free(hd);
+    return ESP_FAIL;
+  }
+
+  shim_httpd_port = ntohs(addr.sin_port);
+
+  // Stack of the server task
+  shim_heap_account(hd->config.stack_size + SHIM_TASK_TCB_SIZE);
+
+  hd->running = true;
+  pthread_create(&hd->thread, NULL, shim_httpd_thread, hd);
+
+  *handle = hd;
+  return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle)
+{
+  struct shim_httpd *hd = handle;
+
+  hd->running = false;
+  pthread_join(hd->thread, NULL);
+  close(hd->listen_fd);
+
+  shim_heap_account(-(ssize_t)(hd->config.stack_size + SHIM_TASK_TCB_SIZE));
+  shim_free(hd->sessions);
+  shim_free(hd->handlers);
+  shim_free(hd);
+  return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler)
+{
+  struct shim_httpd *hd = handle;
+
+  if (hd->n_handlers >= hd->config.max_uri_handlers)
+  {
+    shim_httpd_handlers_rejected++;
+    return ESP_ERR_HTTPD_HANDLERS_FULL;
+  }
+
+  hd->handlers[hd->n_handlers++] = *uri_handler;
+  shim_httpd_handlers_registered = hd->n_handlers;
+  return ESP_OK;
+}
@@ -0,0 +1,178 @@
+#!/usr/bin/env python
+#
+# Convert the PNG images of the UI into run-length encoded LVGL images.
+#
+# Every image is written to a single C file as an lv_img_dsc_t named after the
+# PNG file, with the LV_IMG_CF_USER_ENCODED_0 color format, decoded on the
+# device by components/smart_ring_ui/img/img_decoder.c. The colors are reduced
+# to RGB565, as drawn by the display, and the alpha channel, if any, is kept.
+#
+# Images with at most 256 different pixels are indexed: a palette of the
+# pixels, followed by runs of palette indexes. The others are runs of the
+# pixels themselves. The runs of a row never continue on the next one, so the
+# decoder can stop at the end of any row.
+#
+# Usage: img_assets.py --output <img_assets.c> <image.png> [<image.png> ...]
+#
+
+import argparse
+import os
+import re
+import struct
+import zlib
+
+# Formats of img_decoder.h
+IMG_RLE_INDEXED = 1
+IMG_RLE_RAW = 2
+
+# Longest run of a control byte
+RUN_MAX = 128
+
+
+def read_png(path):
+    """Return the width, the height, the alpha flag and the rows of RGB(A) bytes"""
+    with open(path, 'rb') as png:
+        data = png.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+
+    position = 8
+    idat = b''
+    while position < len(data):
+        length, kind = struct.unpack('>I4s', data[position:position + 8])
+        body = data[position + 8:position + 8 + length]
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'IDAT':
+            idat += body
+        position += length + 12
+
+    # Only the formats written by image editors for icons, without a palette
+    if depth != 8 or color not in (2, 6) or interlace:
+        raise ValueError('%s: only 8 bit RGB or RGBA images, not interlaced' % path)
+
+    alpha = color == 6
+    bpp = 4 if alpha else 3
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for x in range(stride):
+            left = row[x - bpp] if x >= bpp else 0
+            up = previous[x]
+            up_left = previous[x - bpp] if x >= bpp else 0
+            if kind == 1:
+                row[x] = (row[x] + left) & 0xff
+            elif kind == 2:
+                row[x] = (row[x] + up) & 0xff
+            elif kind == 3:
+                row[x] = (row[x] + (left + up) // 2) & 0xff
+            elif kind == 4:
+                estimate = left + up - up_left
+                distances = (abs(estimate - left), abs(estimate - up), abs(estimate - up_left))
+                predictor = (left, up, up_left)[distances.index(min(distances))]
+                row[x] = (row[x] + predictor) & 0xff
+        rows.append(bytes(row))
+        previous = row
+
+    return width, height, alpha, rows
+
+
+def pixels(width, alpha, rows):
+    """Rows of pixels, each the RGB565 color in little endian and the alpha byte"""
+    bpp = 4 if alpha else 3
+    for row in rows:
+        line = []
+        for x in range(width):
+            r, g, b = row[x * bpp:x * bpp + 3]
+            color = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+            line.append(struct.pack('<H', color) + (bytes([row[x * bpp + 3]]) if alpha else b''))
+        yield line
+
+
+def encode_row(items):
+    """Runs of a row: a repeated item, (count - 1) | 0x80, or literal items, count - 1"""
+    out = bytearray()
+    literal = []
+    x = 0
+    while x < len(items):
+        count = 1
+        while x + count < len(items) and count < RUN_MAX and items[x + count] == items[x]:
+            count += 1
+        # Two equal items are cheaper as a repeat only outside of a literal run
+        if count > 2 or (count == 2 and not literal):
+            if literal:
+                out += bytes([len(literal) - 1]) + b''.join(literal)
+                literal = []
+            out += bytes([0x80 | (count - 1)]) + items[x]
+        else:
+            literal += items[x:x + count]
+            if len(literal) >= RUN_MAX:
+                out += bytes([RUN_MAX - 1]) + b''.join(literal[:RUN_MAX])
+                literal = literal[RUN_MAX:]
+        x += count
+    if literal:
+        out += bytes([len(literal) - 1]) + b''.join(literal)
+    return out
+
+
+def encode(width, height, alpha, rows):
+    lines = list(pixels(width, alpha, rows))
+    palette = sorted(set(px for line in lines for px in line))
+
+    if len(palette) <= 256:
+        index = {px: bytes([i]) for i, px in enumerate(palette)}
+        header = struct.pack('<BBH', IMG_RLE_INDEXED, alpha, len(palette)) + b''.join(palette)
+        return header + b''.join(encode_row([index[px] for px in line]) for line in lines)
+
+    header = struct.pack('<BBH', IMG_RLE_RAW, alpha, 0)
+    return header + b''.join(encode_row(line) for line in lines)
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert the PNG images of the UI into RLE LVGL images')
+    parser.add_argument('--output', required=True, help='C file of the images')
+    parser.add_argument('images', nargs='+', help='PNG images, named as their lv_img_dsc_t')
+    args = parser.parse_args()
+
+    out = ['/* Generated by tools/img_assets.py, do not edit */', '',
+           '#include "lvgl.h"', '#include "img_decoder.h"', '']
+    raw_total = encoded_total = 0
+
+    for path in args.images:
+        name = re.sub(r'[^A-Za-z0-9_]', '_', os.path.splitext(os.path.basename(path))[0])
+        width, height, alpha, rows = read_png(path)
+        data = encode(width, height, alpha, rows)
+        raw_total += width * height * (3 if alpha else 2)
+        encoded_total += len(data)
+
+        # Aligned for the 16 bit field of the header
+        out += ['static const LV_ATTRIBUTE_LARGE_CONST uint8_t %s_map[] __attribute__((aligned(4))) = {' % name,
+                c_array(data), '};', '',
+                'const lv_img_dsc_t %s = {' % name,
+                '  .header.always_zero = 0,',
+                '  .header.w = %d,' % width,
+                '  .header.h = %d,' % height,
+                '  .data_size = %d,' % len(data),
+                '  .header.cf = IMG_RLE_CF,',
+                '  .data = %s_map,' % name,
+                '};', '']
+
+    with open(args.output, 'w') as output:
+        output.write('\n'.join(out))
+
+    print('%d images, %d bytes encoded from %d' % (len(args.images), encoded_total, raw_total))
+
+
+if __name__ == '__main__':
+    main()
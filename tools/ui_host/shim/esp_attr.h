@@ -0,0 +1,2 @@
+/* Host replacement of the ESP-IDF header, see shim.h */
+#include "shim.h"
@@ -0,0 +1,30 @@
+/**
+ * @file libs.h
+ * @brief
+ * Host replacement of main/include/libs.h, included by the menus of the
+ * smart_ring_ui component and by the harness. The component only needs LVGL,
+ * its own header and the ESP-IDF subset of shim.h.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef __LIBS_H_
+#define __LIBS_H_
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "shim.h"
+
+#include "lvgl.h"
+#include "smart_ring_ui.h"
+
+#endif
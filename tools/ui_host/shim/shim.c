@@ -0,0 +1,217 @@
+/**
+ * @file shim.c
+ * @brief
+ * Single threaded implementation of the ESP-IDF and FreeRTOS subset declared
+ * in shim.h, on the virtual clock of the harness.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "shim.h"
+
+/// Timers the UI may create
+#define SHIM_MAX_TIMERS 8
+
+struct shim_task
+{
+  int notifications;
+};
+
+struct shim_queue
+{
+  uint32_t length;
+  uint32_t item_size;
+  uint32_t head;
+  uint32_t count;
+  uint8_t items[];
+};
+
+struct shim_timer
+{
+  esp_timer_cb_t callback;
+  void *arg;
+  const char *name;
+  /// Virtual time the timer is due (us), valid while active
+  int64_t due_us;
+  /// Period of a periodic timer (us), 0 for a one shot timer
+  int64_t period_us;
+  bool active;
+};
+
+bool shim_log_enabled = false;
+
+static struct shim_task shim_ui_task;
+static struct shim_timer shim_timers[SHIM_MAX_TIMERS];
+static int shim_timers_count = 0;
+static int64_t shim_now_us = 0;
+
+void esp_restart(void)
+{
+  fprintf(stderr, "esp_restart called, exiting\n");
+  exit(2);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+  return &shim_ui_task;
+}
+
+void xTaskNotifyGive(TaskHandle_t task)
+{
+  task->notifications++;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  shim_advance((int64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+QueueHandle_t xQueueCreate(uint32_t length, uint32_t item_size)
+{
+  struct shim_queue *queue = calloc(1, sizeof(*queue) + length * item_size);
+
+  if (queue != NULL)
+  {
+    queue->length = length;
+    queue->item_size = item_size;
+  }
+
+  return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+  (void)ticks;
+
+  if (queue->count == queue->length)
+    return pdFALSE;
+
+  uint32_t tail = (queue->head + queue->count) % queue->length;
+  memcpy(&queue->items[tail * queue->item_size], item, queue->item_size);
+  queue->count++;
+
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+  (void)ticks;
+
+  if (queue->count == 0)
+    return pdFALSE;
+
+  memcpy(item, &queue->items[queue->head * queue->item_size], queue->item_size);
+  queue->head = (queue->head + 1) % queue->length;
+  queue->count--;
+
+  return pdTRUE;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *handle)
+{
+  if (shim_timers_count == SHIM_MAX_TIMERS)
+    return ESP_ERR_NO_MEM;
+
+  struct shim_timer *timer = &shim_timers[shim_timers_count++];
+  timer->callback = args->callback;
+  timer->arg = args->arg;
+  timer->name = args->name;
+  *handle = timer;
+
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+  if (timer->active)
+    return ESP_ERR_INVALID_STATE;
+
+  timer->due_us = shim_now_us + (int64_t)timeout_us;
+  timer->period_us = 0;
+  timer->active = true;
+
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us)
+{
+  if (timer->active)
+    return ESP_ERR_INVALID_STATE;
+
+  timer->due_us = shim_now_us + (int64_t)period_us;
+  timer->period_us = (int64_t)period_us;
+  timer->active = true;
+
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+  if (!timer->active)
+    return ESP_ERR_INVALID_STATE;
+
+  timer->active = false;
+  return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer)
+{
+  return timer->active;
+}
+
+int64_t esp_timer_get_time(void)
+{
+  return shim_now_us;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio, uint32_t level)
+{
+  (void)gpio;
+  (void)level;
+  return ESP_OK;
+}
+
+int64_t shim_next_timer(void)
+{
+  int64_t next = -1;
+
+  for (int i = 0; i < shim_timers_count; i++)
+  {
+    if (shim_timers[i].active && (next < 0 || shim_timers[i].due_us - shim_now_us < next))
+      next = MAX(shim_timers[i].due_us - shim_now_us, 0);
+  }
+
+  return next;
+}
+
+void shim_advance(int64_t us)
+{
+  int64_t end_us = shim_now_us + us;
+
+  // Run the timers in the order they're due, a callback may start another one
+  for (;;)
+  {
+    struct shim_timer *due = NULL;
+
+    for (int i = 0; i < shim_timers_count; i++)
+    {
+      struct shim_timer *timer = &shim_timers[i];
+      if (timer->active && timer->due_us <= end_us && (due == NULL || timer->due_us < due->due_us))
+        due = timer;
+    }
+
+    if (due == NULL)
+      break;
+
+    shim_now_us = MAX(shim_now_us, due->due_us);
+    if (due->period_us)
+      due->due_us += due->period_us;
+    else
+      due->active = false;
+
+    due->callback(due->arg);
+  }
+
+  shim_now_us = end_us;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file shim.h
+ * @brief
+ * Host replacement of the ESP-IDF and FreeRTOS subset used by the
+ * smart_ring_ui component, implemented in shim.c. The UI runs in a single
+ * thread on a virtual clock: the time only moves when the harness advances
+ * it, which runs the esp_timer callbacks that are due, so the animations and
+ * the timeouts of the UI are the same on every run.
+ *
+ * The ESP-IDF headers included by the component (esp_log.h, esp_timer.h,
+ * freertos/queue.h, ...) all include this file.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef __SHIM_H_
+#define __SHIM_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/param.h>
+
+/*** esp_err / esp_log ***/
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+
+/// Set by the harness to print the UI logs
+extern bool shim_log_enabled;
+
+#define ESP_LOGI(tag, format, ...)                                             \
+  do                                                                           \
+  {                                                                            \
+    if (shim_log_enabled)                                                      \
+      printf("I (%s) " format "\n", tag, ##__VA_ARGS__);                       \
+  } while (0)
+#define ESP_LOGW ESP_LOGI
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+
+#define IRAM_ATTR
+#define BIT0 (1UL << 0)
+#define BIT1 (1UL << 1)
+#define BIT2 (1UL << 2)
+#define BIT3 (1UL << 3)
+
+/*** esp_system ***/
+
+/// Ends the harness: none of the scripted screens restarts the device
+void esp_restart(void) __attribute__((noreturn));
+
+/*** FreeRTOS ***/
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef struct shim_task *TaskHandle_t;
+typedef struct shim_queue *QueueHandle_t;
+typedef int portMUX_TYPE;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define portMAX_DELAY UINT32_MAX
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define configMAX_TASK_NAME_LEN 16
+
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+/// The UI thread of the harness, the only task
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+void xTaskNotifyGive(TaskHandle_t task);
+/// Advances the virtual clock
+void vTaskDelay(TickType_t ticks);
+
+/// Queues never block: the single thread would never be woken
+QueueHandle_t xQueueCreate(uint32_t length, uint32_t item_size);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+
+/*** esp_timer ***/
+
+typedef struct shim_timer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+
+typedef struct esp_timer_create_args_t
+{
+  esp_timer_cb_t callback;
+  void *arg;
+  int dispatch_method;
+  const char *name;
+  bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *handle);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+bool esp_timer_is_active(esp_timer_handle_t timer);
+/// Virtual time since the harness started (us)
+int64_t esp_timer_get_time(void);
+
+/*** driver/gpio ***/
+
+typedef int gpio_num_t;
+
+esp_err_t gpio_set_level(gpio_num_t gpio, uint32_t level);
+
+/*** Harness ***/
+
+/**
+ * @brief
+ * Advance the virtual clock, running the esp_timer callbacks as they're due
+ *
+ * @param us Time to advance (us)
+ */
+void shim_advance(int64_t us);
+
+/**
+ * @brief
+ * Time until the next esp_timer is due
+ *
+ * @return int64_t Time (us), -1 when no timer is active
+ */
+int64_t shim_next_timer(void);
+
+#endif
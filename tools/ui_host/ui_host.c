@@ -0,0 +1,616 @@
+/**
+ * @file ui_host.c
+ * @brief
+ * Headless host run of the smart_ring_ui component. LVGL and every menu are
+ * built for Linux and drawn into an in-memory 320x240 framebuffer, through the
+ * same double strip buffers as the device, with a scripted touch input.
+ *
+ * By default every state of the UI state machine is shown in order: each one
+ * is saved as a PNG snapshot, compared to the reference snapshots when asked,
+ * and timed. The time to build the screen, to draw its first frame (the area
+ * invalidated by the change) and to redraw it whole are reported per state.
+ * The times are host times, to compare the screens between themselves and
+ * between two builds, not device times.
+ *
+ * With -t the touch script is run instead. A script has one command per line:
+ *
+ *   state <n>         go to STATE_<n>
+ *   tap <x> <y>       press and release at a point
+ *   press <x> <y>     press, or drag while pressed
+ *   release           release the touch
+ *   wait <ms>         let the UI run
+ *   snap <name>       save the screen as <name>.png
+ *   sensor <old> <new> <stable>, stock <n>, rssi <level>
+ *                     post a new value, as the sensors and the network do
+ *
+ * Usage: ui_host [-o snapshot_dir] [-c reference_dir] [-r passes]
+ *                [-s state] [-w settle_ms] [-t script] [-v]
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "libs.h"
+
+#include <errno.h>
+#include <getopt.h>
+#include <png.h>
+#include <sys/stat.h>
+
+/// Strip buffer lines, as DISPLAY_BUFFER_LINES on the device
+#define UI_HOST_BUFFER_LINES 20
+/// Virtual time between two runs of the UI loop (ms)
+#define UI_HOST_STEP_MS 10
+/// Time the UI runs after a state change before the snapshot (ms)
+#define UI_HOST_SETTLE_MS 1000
+/// Time a tap is held (ms)
+#define UI_HOST_TAP_MS 100
+/// Full redraws timed per state and pass
+#define UI_HOST_REDRAWS 10
+/// States of the state machine
+#define UI_HOST_STATES (STATE_48 + 1)
+
+struct ui_host_timing
+{
+  uint32_t samples;
+  uint64_t sum_us;
+  uint64_t max_us;
+};
+
+struct ui_host_state_stats
+{
+  uint16_t menu;
+  struct ui_host_timing create;
+  struct ui_host_timing first_frame;
+  struct ui_host_timing redraw;
+  uint32_t first_frame_px;
+  uint8_t mem_used_pct;
+  uint32_t snapshot_diff_px;
+  bool snapshot_compared;
+};
+
+static lv_color_t ui_host_fb[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static lv_color_t ui_host_buf[2][LV_HOR_RES_MAX * UI_HOST_BUFFER_LINES];
+static lv_disp_buf_t ui_host_disp_buf;
+
+// Scripted touch
+static lv_point_t ui_host_touch_point;
+static bool ui_host_touch_pressed = false;
+
+// Pixels drawn by the last refresh, from the monitor callback
+static uint32_t ui_host_refresh_px = 0;
+
+static const char *ui_host_snapshot_dir = "snapshots";
+static const char *ui_host_reference_dir = NULL;
+static uint32_t ui_host_settle_ms = UI_HOST_SETTLE_MS;
+static struct ui_host_state_stats ui_host_stats[UI_HOST_STATES];
+
+static uint64_t ui_host_now_us(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static void ui_host_timing_add(struct ui_host_timing *timing, uint64_t us)
+{
+  timing->samples++;
+  timing->sum_us += us;
+  timing->max_us = MAX(timing->max_us, us);
+}
+
+static uint64_t ui_host_timing_avg(const struct ui_host_timing *timing)
+{
+  return timing->samples ? timing->sum_us / timing->samples : 0;
+}
+
+/*** Drivers ***/
+
+static void ui_host_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+  lv_coord_t width = lv_area_get_width(area);
+
+  for (lv_coord_t y = area->y1; y <= area->y2; y++)
+  {
+    memcpy(&ui_host_fb[y * LV_HOR_RES_MAX + area->x1], color_map, width * sizeof(lv_color_t));
+    color_map += width;
+  }
+
+  lv_disp_flush_ready(drv);
+}
+
+static void ui_host_monitor(lv_disp_drv_t *drv, uint32_t time, uint32_t px)
+{
+  (void)drv;
+  (void)time;
+  ui_host_refresh_px = px;
+}
+
+static bool ui_host_touch_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+  (void)drv;
+  data->point = ui_host_touch_point;
+  data->state = ui_host_touch_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+  return false;
+}
+
+/**
+ * @brief
+ * Same touch feedback as the device, posting the touch events to the UI
+ *
+ */
+static void ui_host_touch_feedback(lv_indev_drv_t *drv, lv_event_t event)
+{
+  (void)drv;
+
+  if (event == LV_EVENT_PRESSED)
+  {
+    struct smart_ring_ui_event_t pressed = {.type = UI_EVENT_TOUCH_PRESSED};
+    smart_ring_ui_post_event(&pressed);
+  }
+  else if (event == LV_EVENT_RELEASED)
+  {
+    struct smart_ring_ui_event_t released = {.type = UI_EVENT_TOUCH_RELEASED};
+    smart_ring_ui_post_event(&released);
+  }
+}
+
+static void ui_host_init(void)
+{
+  static lv_disp_drv_t disp_drv;
+  static lv_indev_drv_t indev_drv;
+
+  lv_init();
+
+  lv_disp_buf_init(&ui_host_disp_buf, ui_host_buf[0], ui_host_buf[1], LV_HOR_RES_MAX * UI_HOST_BUFFER_LINES);
+  lv_disp_drv_init(&disp_drv);
+  disp_drv.hor_res = LV_HOR_RES_MAX;
+  disp_drv.ver_res = LV_VER_RES_MAX;
+  disp_drv.buffer = &ui_host_disp_buf;
+  disp_drv.flush_cb = ui_host_flush;
+  disp_drv.monitor_cb = ui_host_monitor;
+  lv_disp_drv_register(&disp_drv);
+
+  lv_indev_drv_init(&indev_drv);
+  indev_drv.type = LV_INDEV_TYPE_POINTER;
+  indev_drv.read_cb = ui_host_touch_read;
+  indev_drv.feedback_cb = ui_host_touch_feedback;
+  lv_indev_drv_register(&indev_drv);
+
+  smart_ring_ui_set_task(xTaskGetCurrentTaskHandle());
+  smart_ring_ui_events_init();
+  smart_ring_ui_init_system();
+}
+
+/**
+ * @brief
+ * Values shown by the screens, the same on every run
+ *
+ */
+static void ui_host_set_model(void)
+{
+  static struct smart_ring_ui_delivery_t deliveries[] = {
+      {.date = "12/03/2024", .ordered_date = "10/03/2024", .bottles = 2, .cups = 0, .status = "Entregue"},
+      {.date = "20/03/2024", .ordered_date = "18/03/2024", .bottles = 1, .cups = 50, .status = "Pendente"},
+  };
+  struct smart_ring_ui_controller_t *ui = smart_ring_ui_get_controller();
+
+  strcpy(ui->firmware_version, "2.1.2");
+  strcpy(ui->mac_address, "24:0A:C4:00:00:01");
+  strcpy(ui->ssid, "SmartRing");
+  ui->deliveries = deliveries;
+  ui->number_of_deliveries = sizeof(deliveries) / sizeof(deliveries[0]);
+  ui->order.bottles = 2;
+  ui->order.cups = 50;
+  ui->order.price = 12.5f;
+  ui->is_admin = true;
+
+  smart_ring_ui_set_device_name("Escritório Lisboa");
+  smart_ring_ui_set_rssi_level(3);
+  smart_ring_ui_set_stock(12);
+  smart_ring_ui_set_current_deposit(60);
+}
+
+/*** UI loop ***/
+
+/**
+ * @brief
+ * Run the UI loop once: the events, the LVGL tasks, and the requests of the
+ * UI, which are only logged since there is no firmware to answer them
+ *
+ */
+static void ui_host_run_once(void)
+{
+  enum smart_ring_ui_request_t request;
+
+  smart_ring_ui_process_events();
+  lv_task_handler();
+
+  while (smart_ring_ui_receive_request(&request, 0))
+  {
+    if (shim_log_enabled)
+      printf("request %d\n", request);
+  }
+}
+
+/**
+ * @brief
+ * Let the UI run on the virtual clock
+ *
+ */
+static void ui_host_wait(uint32_t ms)
+{
+  for (uint32_t elapsed = 0; elapsed < ms; elapsed += UI_HOST_STEP_MS)
+  {
+    shim_advance(UI_HOST_STEP_MS * 1000);
+    ui_host_run_once();
+  }
+}
+
+/**
+ * @brief
+ * Go to a state from the current screen, without the timers of the previous
+ * state changing it behind the harness back
+ *
+ */
+static void ui_host_go_to_state(enum smart_ring_ui_state_machine_t state)
+{
+  struct smart_ring_ui_controller_t *ui = smart_ring_ui_get_controller();
+
+  esp_timer_stop(ui->timer);
+  esp_timer_stop(ui->standby_timer);
+  smart_ring_ui_update_state(state);
+}
+
+/*** Snapshots ***/
+
+static int ui_host_png_write(const char *path)
+{
+  FILE *file = fopen(path, "wb");
+  if (file == NULL)
+  {
+    fprintf(stderr, "Can't write %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+
+  png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+  png_infop info = png_create_info_struct(png);
+  if (setjmp(png_jmpbuf(png)))
+  {
+    png_destroy_write_struct(&png, &info);
+    fclose(file);
+    return -1;
+  }
+
+  png_init_io(png, file);
+  png_set_IHDR(png, info, LV_HOR_RES_MAX, LV_VER_RES_MAX, 8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
+               PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+  png_write_info(png, info);
+
+  png_byte row[LV_HOR_RES_MAX * 3];
+  for (int y = 0; y < LV_VER_RES_MAX; y++)
+  {
+    for (int x = 0; x < LV_HOR_RES_MAX; x++)
+    {
+      uint32_t color = lv_color_to32(ui_host_fb[y * LV_HOR_RES_MAX + x]);
+      row[x * 3] = color >> 16;
+      row[x * 3 + 1] = color >> 8;
+      row[x * 3 + 2] = color;
+    }
+    png_write_row(png, row);
+  }
+
+  png_write_end(png, NULL);
+  png_destroy_write_struct(&png, &info);
+  fclose(file);
+  return 0;
+}
+
+/**
+ * @brief
+ * Compare the framebuffer to a reference snapshot
+ *
+ * @return int Pixels that differ, -1 when the reference can't be read
+ */
+static int ui_host_png_compare(const char *path)
+{
+  png_image image = {.version = PNG_IMAGE_VERSION};
+  static png_byte reference[LV_HOR_RES_MAX * LV_VER_RES_MAX * 3];
+
+  if (!png_image_begin_read_from_file(&image, path))
+    return -1;
+
+  image.format = PNG_FORMAT_RGB;
+  if (image.width != LV_HOR_RES_MAX || image.height != LV_VER_RES_MAX ||
+      !png_image_finish_read(&image, NULL, reference, 0, NULL))
+  {
+    png_image_free(&image);
+    return -1;
+  }
+
+  int diff = 0;
+  for (int i = 0; i < LV_HOR_RES_MAX * LV_VER_RES_MAX; i++)
+  {
+    uint32_t color = lv_color_to32(ui_host_fb[i]);
+    if (reference[i * 3] != ((color >> 16) & 0xFF) || reference[i * 3 + 1] != ((color >> 8) & 0xFF) ||
+        reference[i * 3 + 2] != (color & 0xFF))
+      diff++;
+  }
+
+  return diff;
+}
+
+/**
+ * @brief
+ * Save the screen, and compare it to its reference
+ *
+ * @return int Pixels that differ from the reference, 0 without references
+ */
+static int ui_host_snapshot(const char *name)
+{
+  char path[PATH_MAX];
+  int diff = 0;
+
+  lv_refr_now(NULL);
+
+  snprintf(path, sizeof(path), "%s/%s.png", ui_host_snapshot_dir, name);
+  ui_host_png_write(path);
+
+  if (ui_host_reference_dir != NULL)
+  {
+    snprintf(path, sizeof(path), "%s/%s.png", ui_host_reference_dir, name);
+    diff = ui_host_png_compare(path);
+    if (diff != 0)
+      fprintf(stderr, "%s: %s\n", name, diff < 0 ? "no reference" : "differs from the reference");
+  }
+
+  return diff;
+}
+
+/*** State sweep ***/
+
+/**
+ * @brief
+ * Show a state, timing its screen and its frames
+ *
+ */
+static void ui_host_time_state(enum smart_ring_ui_state_machine_t state, bool snapshot)
+{
+  struct ui_host_state_stats *stats = &ui_host_stats[state];
+  uint64_t start;
+
+  // The state change is applied by the events, where the screen is built
+  start = ui_host_now_us();
+  ui_host_go_to_state(state);
+  smart_ring_ui_process_events();
+  ui_host_timing_add(&stats->create, ui_host_now_us() - start);
+  stats->menu = smart_ring_ui_get_controller()->menu;
+
+  ui_host_refresh_px = 0;
+  start = ui_host_now_us();
+  lv_refr_now(NULL);
+  ui_host_timing_add(&stats->first_frame, ui_host_now_us() - start);
+  stats->first_frame_px = ui_host_refresh_px;
+
+  ui_host_wait(ui_host_settle_ms);
+
+  for (int i = 0; i < UI_HOST_REDRAWS; i++)
+  {
+    lv_obj_invalidate(lv_scr_act());
+    start = ui_host_now_us();
+    lv_refr_now(NULL);
+    ui_host_timing_add(&stats->redraw, ui_host_now_us() - start);
+  }
+
+  lv_mem_monitor_t mem;
+  lv_mem_monitor(&mem);
+  stats->mem_used_pct = MAX(stats->mem_used_pct, mem.used_pct);
+
+  if (snapshot)
+  {
+    char name[16];
+    snprintf(name, sizeof(name), "state_%02d", state);
+    stats->snapshot_diff_px = ui_host_snapshot(name);
+    stats->snapshot_compared = ui_host_reference_dir != NULL;
+  }
+}
+
+static void ui_host_print_stats(int first, int last)
+{
+  printf("%5s %4s %16s %16s %7s %16s %4s %s\n", "state", "menu", "create avg/max", "frame avg/max", "area",
+         "redraw avg/max", "mem", "snapshot");
+
+  for (int state = first; state <= last; state++)
+  {
+    struct ui_host_state_stats *stats = &ui_host_stats[state];
+    const char *snapshot = !stats->snapshot_compared ? "-" : stats->snapshot_diff_px == 0 ? "same" : "DIFF";
+
+    printf("%5d %4u %7llu/%6llu us %7llu/%6llu us %7u %7llu/%6llu us %3u%% %s\n", state, stats->menu,
+           (unsigned long long)ui_host_timing_avg(&stats->create), (unsigned long long)stats->create.max_us,
+           (unsigned long long)ui_host_timing_avg(&stats->first_frame), (unsigned long long)stats->first_frame.max_us,
+           stats->first_frame_px, (unsigned long long)ui_host_timing_avg(&stats->redraw),
+           (unsigned long long)stats->redraw.max_us, stats->mem_used_pct, snapshot);
+  }
+}
+
+static void ui_host_print_caches(void)
+{
+  struct img_cache_stats_t images;
+  struct font_cache_stats_t glyphs;
+  img_decoder_get_stats(&images);
+  font_cache_get_stats(&glyphs);
+
+  printf("images: %u decoded (%u bytes), %u hits, %u misses, %u evictions, %u by rows\n", images.images, images.used,
+         images.hits, images.misses, images.evictions, images.lines);
+  printf("glyphs: %u decompressed (%u bytes), %u hits, %u misses, %u evictions\n", glyphs.glyphs, glyphs.used,
+         glyphs.hits, glyphs.misses, glyphs.evictions);
+}
+
+/*** Touch script ***/
+
+static int ui_host_run_script(const char *path)
+{
+  FILE *script = fopen(path, "r");
+  char line[128], name[64];
+  int x, y, value, old_value, new_value, stable, line_number = 0, failures = 0;
+
+  if (script == NULL)
+  {
+    fprintf(stderr, "Can't read %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+
+  while (fgets(line, sizeof(line), script) != NULL)
+  {
+    line_number++;
+
+    if (line[0] == '#' || line[strspn(line, " \t\r\n")] == '\0')
+      continue;
+
+    if (sscanf(line, "state %d", &value) == 1 && value >= 0 && value < UI_HOST_STATES)
+    {
+      ui_host_go_to_state(value);
+      ui_host_run_once();
+    }
+    else if (sscanf(line, "tap %d %d", &x, &y) == 2)
+    {
+      ui_host_touch_point = (lv_point_t){.x = x, .y = y};
+      ui_host_touch_pressed = true;
+      ui_host_wait(UI_HOST_TAP_MS);
+      ui_host_touch_pressed = false;
+      ui_host_wait(UI_HOST_STEP_MS * 5);
+    }
+    else if (sscanf(line, "press %d %d", &x, &y) == 2)
+    {
+      ui_host_touch_point = (lv_point_t){.x = x, .y = y};
+      ui_host_touch_pressed = true;
+      ui_host_wait(UI_HOST_STEP_MS * 5);
+    }
+    else if (strncmp(line, "release", 7) == 0)
+    {
+      ui_host_touch_pressed = false;
+      ui_host_wait(UI_HOST_STEP_MS * 5);
+    }
+    else if (sscanf(line, "wait %d", &value) == 1)
+    {
+      ui_host_wait(value);
+    }
+    else if (sscanf(line, "snap %63s", name) == 1)
+    {
+      if (ui_host_snapshot(name) != 0)
+        failures++;
+      printf("%-24s state %2d menu %2u\n", name, smart_ring_ui_get_controller()->state,
+             smart_ring_ui_get_controller()->menu);
+    }
+    else if (sscanf(line, "sensor %d %d %d", &old_value, &new_value, &stable) == 3)
+    {
+      smart_ring_ui_set_sensor_values(old_value, new_value, stable);
+    }
+    else if (sscanf(line, "stock %d", &value) == 1)
+    {
+      smart_ring_ui_set_stock(value);
+    }
+    else if (sscanf(line, "rssi %d", &value) == 1)
+    {
+      smart_ring_ui_set_rssi_level(value);
+    }
+    else
+    {
+      fprintf(stderr, "%s:%d: unknown command: %s", path, line_number, line);
+      failures++;
+    }
+  }
+
+  fclose(script);
+  return failures;
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr,
+          "Usage: %s [-o snapshot_dir] [-c reference_dir] [-r passes] [-s state] [-w settle_ms] [-t script] [-v]\n"
+          "  -o  directory the PNG snapshots are written to (snapshots)\n"
+          "  -c  directory of the reference snapshots, the run fails when a snapshot differs\n"
+          "  -r  passes over the states, the snapshots are taken on the first one (1)\n"
+          "  -s  only show this state\n"
+          "  -w  time the UI runs after a state change before the snapshot, ms (%d)\n"
+          "  -t  run a touch script instead of the states\n"
+          "  -v  print the UI logs and requests\n",
+          name, UI_HOST_SETTLE_MS);
+}
+
+int main(int argc, char **argv)
+{
+  const char *script = NULL;
+  int passes = 1, first = 0, last = UI_HOST_STATES - 1, option;
+
+  while ((option = getopt(argc, argv, "o:c:r:s:w:t:vh")) != -1)
+  {
+    switch (option)
+    {
+    case 'o':
+      ui_host_snapshot_dir = optarg;
+      break;
+    case 'c':
+      ui_host_reference_dir = optarg;
+      break;
+    case 'r':
+      passes = MAX(atoi(optarg), 1);
+      break;
+    case 's':
+      first = last = atoi(optarg);
+      if (first < 0 || first >= UI_HOST_STATES)
+      {
+        usage(argv[0]);
+        return 1;
+      }
+      break;
+    case 'w':
+      ui_host_settle_ms = atoi(optarg);
+      break;
+    case 't':
+      script = optarg;
+      break;
+    case 'v':
+      shim_log_enabled = true;
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (mkdir(ui_host_snapshot_dir, 0755) != 0 && errno != EEXIST)
+  {
+    fprintf(stderr, "Can't create %s: %s\n", ui_host_snapshot_dir, strerror(errno));
+    return 1;
+  }
+
+  ui_host_init();
+  ui_host_set_model();
+  ui_host_run_once();
+
+  if (script != NULL)
+  {
+    int failures = ui_host_run_script(script);
+    ui_host_print_caches();
+    return failures == 0 ? 0 : 1;
+  }
+
+  for (int pass = 0; pass < passes; pass++)
+  {
+    for (int state = first; state <= last; state++)
+      ui_host_time_state(state, pass == 0);
+  }
+
+  ui_host_print_stats(first, last);
+  ui_host_print_caches();
+
+  for (int state = first; state <= last; state++)
+  {
+    if (ui_host_stats[state].snapshot_compared && ui_host_stats[state].snapshot_diff_px != 0)
+      return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+#!/usr/bin/env python
+#
+# Compress the provisioning webpage assets and generate their ETags.
+#
+# Every text input file is written to the output directory as <name>.gz, using
+# a fixed timestamp so the result only changes when the content does. Images
+# are already compressed and are embedded as they are. A header with one ETag
+# define per asset is generated next to them, to be used by the HTTP server when
+# answering conditional requests.
+#
+# The references of the HTML pages to the other files get the file ETag as
+# query string (app.js?v=<etag>), so the server can let the browsers cache those
+# files for good: a new content comes with a new URL.
+#
+# With --bundle, the first file must be the HTML page: its stylesheets, scripts
+# and images are minified and inlined, and only the resulting page is written
+# (as <page>.gz), so the browser loads everything in a single request. The other
+# files are only listed so the build knows the page depends on them.
+#
+# Usage: webpage_assets.py --output-dir <dir> --header <name.h> [--bundle] <file> [<file> ...]
+#
+
+import argparse
+import base64
+import gzip
+import hashlib
+import io
+import os
+import re
+
+# Formats that don't get smaller with gzip
+PRECOMPRESSED_EXTENSIONS = ('.png', '.jpg', '.jpeg', '.gif', '.ico')
+
+
+def asset_define(prefix, file_name):
+    return prefix + re.sub(r'[^A-Za-z0-9]', '_', file_name).upper()
+
+
+def compress(data):
+    buffer = io.BytesIO()
+    with gzip.GzipFile(filename='', mode='wb', compresslevel=9, fileobj=buffer, mtime=0) as gz:
+        gz.write(data)
+    return buffer.getvalue()
+
+
+def minify_css(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'\s+', ' ', text)
+    text = re.sub(r'\s*([{},>])\s*', r'\1', text)
+
+    # A space before a colon is a descendant selector ("a :hover"), so the
+    # spaces around the colons and semicolons are only removed in declarations
+    def minify_declarations(match):
+        return '{%s}' % re.sub(r'\s*([;:])\s*', r'\1', match.group(1))
+
+    return re.sub(r'\{([^{}]*)\}', minify_declarations, text).strip()
+
+
+def minify_js(text):
+    # Only whole-line comments and indentation are removed, keeping the line
+    # breaks so automatic semicolon insertion still applies
+    lines = (line.strip() for line in text.splitlines())
+    return '\n'.join(line for line in lines if line and not line.startswith('//'))
+
+
+def minify_html(text):
+    text = re.sub(r'<!--.*?-->', '', text, flags=re.S)
+    return re.sub(r'>\s+<', '><', text).strip()
+
+
+def etag_of(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def fingerprint_page(data, etags):
+    def add_version(match):
+        name = match.group(2)
+        if name not in etags:
+            return match.group(0)
+        return '%s="%s?v=%s"' % (match.group(1), name, etags[name])
+
+    return re.sub(r'\b(href|src)="([^"?:]+)"', add_version, data.decode('utf-8')).encode()
+
+
+def bundle_page(path):
+    base_dir = os.path.dirname(path)
+
+    def read_text(name):
+        with open(os.path.join(base_dir, name), encoding='utf-8') as f:
+            return f.read()
+
+    def inline_style(match):
+        return '<style>%s</style>' % minify_css(read_text(match.group(1)))
+
+    def inline_script(match):
+        return '<script>%s</script>' % minify_js(read_text(match.group(1)))
+
+    def inline_image(match):
+        with open(os.path.join(base_dir, match.group(1)), 'rb') as f:
+            data = base64.b64encode(f.read()).decode()
+        return 'src="data:image/png;base64,%s"' % data
+
+    page = read_text(os.path.basename(path))
+    page = re.sub(r'<link rel="stylesheet" href="([^"]+)">', inline_style, page)
+    page = re.sub(r'<script src="([^"]+)"></script>', inline_script, page)
+    page = re.sub(r'src="([^"]+\.png)"', inline_image, page)
+    return minify_html(page).encode()
+
+
+def write_if_changed(path, data):
+    if os.path.exists(path):
+        with open(path, 'rb') as f:
+            if f.read() == data:
+                # Newer than the inputs all the same, or the build runs the
+                # step again every time
+                os.utime(path, None)
+                return
+    with open(path, 'wb') as f:
+        f.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress webpage assets and generate their ETags')
+    parser.add_argument('--output-dir', required=True)
+    parser.add_argument('--header', required=True)
+    parser.add_argument('--bundle', action='store_true', help='inline every asset into the first file')
+    parser.add_argument('files', nargs='+')
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+
+    lines = [
+        '/* Generated by tools/webpage_assets.py, do not edit */',
+        '',
+        '#ifndef __WEBPAGE_ASSETS_H',
+        '#define __WEBPAGE_ASSETS_H',
+        '',
+    ]
+
+    assets = []
+    if args.bundle:
+        assets.append((args.files[0], bundle_page(args.files[0])))
+    else:
+        for path in args.files:
+            with open(path, 'rb') as f:
+                assets.append((path, f.read()))
+
+        pages = ('.html', '.htm')
+        etags = {os.path.basename(path): etag_of(data) for path, data in assets
+                 if not path.lower().endswith(pages)}
+        assets = [(path, fingerprint_page(data, etags) if path.lower().endswith(pages) else data)
+                  for path, data in assets]
+
+    for path, data in assets:
+
+        file_name = os.path.basename(path)
+        gzipped = not file_name.lower().endswith(PRECOMPRESSED_EXTENSIONS)
+        etag = etag_of(data)
+
+        if gzipped:
+            compressed = compress(data)
+            write_if_changed(os.path.join(args.output_dir, file_name + '.gz'), compressed)
+            lines.append('/// ETag of %s (%d bytes, %d gzipped)' % (file_name, len(data), len(compressed)))
+        else:
+            lines.append('/// ETag of %s (%d bytes)' % (file_name, len(data)))
+
+        lines.append('#define %s "\\"%s\\""' % (asset_define('WEBPAGE_ETAG_', file_name), etag))
+        lines.append('')
+
+    lines.append('#endif')
+    lines.append('')
+
+    write_if_changed(os.path.join(args.output_dir, args.header), '\n'.join(lines).encode())
+
+
+if __name__ == '__main__':
+    main()